@@ -13,6 +13,8 @@ LIBRARY DEPENDENCY:
 */
 
 #include "GunnsElectBattery.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
@@ -25,6 +27,7 @@ LIBRARY DEPENDENCY:
 /// @param[in] interconnectResistance (ohm)    Total interconnect resistance between all cells.
 /// @param[in] maxCapacity            (amp*hr) Maximum charge capacity of the battery.
 /// @param[in] socVocTable            (--)     Pointer to open-circuit voltage vs. State of Charge table.
+/// @param[in] groupNominalCells      (--)     Whether identical nominal cells are updated as one equivalent cell.
 ///
 /// @details  Default constructs this GunnsElectBattery config data.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,7 +38,8 @@ GunnsElectBatteryConfigData::GunnsElectBatteryConfigData(const std::string     n
                                                          const double          cellResistance,
                                                          const double          interconnectResistance,
                                                          const double          maxCapacity,
-                                                         TsLinearInterpolator* socVocTable)
+                                                         TsLinearInterpolator* socVocTable,
+                                                         const bool            groupNominalCells)
     :
     GunnsBasicPotentialConfigData(name, nodes, 0.0),
     mNumCells(numCells),
@@ -43,7 +47,8 @@ GunnsElectBatteryConfigData::GunnsElectBatteryConfigData(const std::string     n
     mCellResistance(cellResistance),
     mInterconnectResistance(interconnectResistance),
     mMaxCapacity(maxCapacity),
-    mSocVocTable(socVocTable)
+    mSocVocTable(socVocTable),
+    mGroupNominalCells(groupNominalCells)
 {
     // Nothing to to.
 }
@@ -111,7 +116,12 @@ GunnsElectBattery::GunnsElectBattery()
     mVoltage(0.0),
     mHeat(0.0),
     mThermalRunawayCell(0),
-    mThermalRunawayTimer(0.0)
+    mThermalRunawayTimer(0.0),
+    mGroupNominalCells(false),
+    mCellResistances(0),
+    mCellVoltages(0),
+    mGroupSoc(0.0),
+    mNumGroupedCells(0)
 {
     // Nothing to to.
 }
@@ -150,6 +160,8 @@ void GunnsElectBattery::initialize(GunnsElectBatteryConfigData&  configData,
     mCellsInParallel            = configData.mCellsInParallel;
     mInterconnectResistance     = configData.mInterconnectResistance;
     mSocVocTable                = configData.mSocVocTable;
+    mGroupNominalCells          = configData.mGroupNominalCells;
+    mGroupSoc                   = inputData.mSoc;
     mMalfThermalRunawayFlag     = inputData.mMalfThermalRunawayFlag;
     mMalfThermalRunawayDuration = inputData.mMalfThermalRunawayDuration;
     mMalfThermalRunawayInterval = inputData.mMalfThermalRunawayInterval;
@@ -176,7 +188,14 @@ void GunnsElectBattery::initialize(GunnsElectBatteryConfigData&  configData,
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsElectBattery::allocateArrays()
 {
+    cleanup();
     TS_NEW_CLASS_ARRAY_EXT(mCells, static_cast<int>(mNumCells), GunnsElectBatteryCell, (), std::string(mName) + ".mCells");
+    TS_NEW_PRIM_ARRAY_EXT(mCellResistances, static_cast<int>(mNumCells), double, std::string(mName) + ".mCellResistances");
+    TS_NEW_PRIM_ARRAY_EXT(mCellVoltages,    static_cast<int>(mNumCells), double, std::string(mName) + ".mCellVoltages");
+    for (unsigned int i = 0; i < mNumCells; i++) {
+        mCellResistances[i] = 0.0;
+        mCellVoltages[i]    = 0.0;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,6 +203,12 @@ void GunnsElectBattery::allocateArrays()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsElectBattery::cleanup()
 {
+    if (mCellVoltages) {
+        TS_DELETE_ARRAY(mCellVoltages);
+    }
+    if (mCellResistances) {
+        TS_DELETE_ARRAY(mCellResistances);
+    }
     if (mCells) {
         TS_DELETE_ARRAY(mCells);
     }
@@ -201,6 +226,46 @@ void GunnsElectBattery::restartModel()
     updateOutputs();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           malfunctions, outputs and thermal runaway state of the battery, and the state of its
+///           cells.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectBattery::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicPotential::snapshotState(snapshot);
+
+    snapshot.sync(mMalfThermalRunawayFlag);
+    snapshot.sync(mMalfThermalRunawayDuration);
+    snapshot.sync(mMalfThermalRunawayInterval);
+    snapshot.sync(mSoc);
+    snapshot.sync(mCapacity);
+    snapshot.sync(mCurrent);
+    snapshot.sync(mVoltage);
+    snapshot.sync(mHeat);
+    snapshot.sync(mThermalRunawayCell);
+    snapshot.sync(mThermalRunawayTimer);
+    snapshot.sync(mCellResistances, static_cast<int>(mNumCells));
+    snapshot.sync(mCellVoltages,    static_cast<int>(mNumCells));
+    snapshot.sync(mGroupSoc);
+    snapshot.sync(mNumGroupedCells);
+    for (unsigned int i = 0; i < mNumCells; ++i) {
+        mCells[i].snapshotState(snapshot);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsElectBattery.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsElectBattery::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsElectBattery);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] configData (--) Configuration data.
 /// @param[in] inputData  (--) Input Data.
@@ -271,6 +336,9 @@ void GunnsElectBattery::updateState(const double timeStep __attribute__((unused)
         mThermalRunawayCell  = 0;
     }
 
+    /// - Gather the cells' effective resistance and open-circuit voltage for the totals below.
+    updateCellBank();
+
     /// - Total resistance = battery interconnect resistance + total cell resistance.
     double resistance = mInterconnectResistance;
     if (mCellsInParallel) {
@@ -290,6 +358,46 @@ void GunnsElectBattery::updateState(const double timeStep __attribute__((unused)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Gathers each cell's effective resistance and open-circuit voltage into the contiguous
+///           cell bank arrays in one sweep.  When grouping is enabled, the Voc table lookup is only
+///           done for the first cell of the group and copied to the rest of the group.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectBattery::updateCellBank()
+{
+    int group = -1;
+    mNumGroupedCells = 0;
+    for (unsigned int i = 0; i < mNumCells; i++) {
+        mCellResistances[i] = mCells[i].getEffectiveResistance();
+        if (group >= 0 and isGroupedCell(i)
+                and mCells[group].getMaxCapacity() == mCells[i].getMaxCapacity()) {
+            mCellVoltages[i] = mCellVoltages[group];
+            mNumGroupedCells++;
+        } else {
+            mCellVoltages[i] = mCells[i].getEffectiveVoltage(mSocVocTable);
+            if (group < 0 and isGroupedCell(i)) {
+                group = static_cast<int>(i);
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] cell (--) Index of the cell to check.
+///
+/// @returns  bool (--) True if the cell is a member of the group of identical nominal cells.
+///
+/// @details  A cell is in the group if grouping is enabled, it is nominal, and it has the group's
+///           State of Charge.  The first such cell is updated individually for the whole group, and
+///           the others that also have its capacity share its results, since they see the same
+///           current.  Cells that diverge from the group, such as from a malfunction, are updated
+///           individually from then on.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsElectBattery::isGroupedCell(const unsigned int cell) const
+{
+    return mGroupNominalCells and mCells[cell].isNominal() and mGroupSoc == mCells[cell].getSoc();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @returns  double (ohm) Total resistance of all cells in parallel, limited to > 0.
 ///
@@ -300,7 +408,7 @@ double GunnsElectBattery::computeParallelResistance() const
     double conductance = 0.0;
     for (unsigned int i = 0; i < mNumCells; i++ )
     {
-        conductance += 1.0 / std::max(mCells[i].getEffectiveResistance(), DBL_EPSILON);
+        conductance += 1.0 / std::max(mCellResistances[i], DBL_EPSILON);
     }
     return 1.0 / std::max(conductance, DBL_EPSILON);
 }
@@ -315,7 +423,7 @@ double GunnsElectBattery::computeSeriesResistance() const
     double resistance = 0.0;
     for (unsigned int i = 0; i < mNumCells; i++ )
     {
-        resistance += mCells[i].getEffectiveResistance();
+        resistance += mCellResistances[i];
     }
     return std::max(resistance, DBL_EPSILON);
 }
@@ -330,10 +438,7 @@ double GunnsElectBattery::computeParallelVoc() const
     double Voc = 0.0;
     for (unsigned int i = 0; i < mNumCells; i++ )
     {
-        const double cellVoc = mCells[i].getEffectiveVoltage(mSocVocTable);
-        if (cellVoc > Voc) {
-            Voc = cellVoc;
-        }
+        Voc = std::max(Voc, mCellVoltages[i]);
     }
     return Voc;
 }
@@ -348,7 +453,7 @@ double GunnsElectBattery::computeSeriesVoc() const
     double Voc = 0.0;
     for (unsigned int i = 0; i < mNumCells; i++ )
     {
-        Voc += mCells[i].getEffectiveVoltage(mSocVocTable);
+        Voc += mCellVoltages[i];
     }
     return Voc;
 }
@@ -370,7 +475,9 @@ void GunnsElectBattery::updateFlux(const double timeStep, const double flux __at
 ///
 /// @details  Updates the cells' State of Charge as a result of current integrated over the step.
 ///           In a real battery, cells with different SOC and Voc would get different loads, but we
-///           assume they all get the same load as a simplification.
+///           assume they all get the same load as a simplification.  When grouping is enabled, only
+///           the first nominal cell is integrated, and its new State of Charge is copied to the
+///           identical nominal cells after it.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsElectBattery::updateCells(const double timeStep)
 {
@@ -387,8 +494,30 @@ void GunnsElectBattery::updateCells(const double timeStep)
     ///   the cell model.
     if (count > 0) {
         const double current = mFlux / count;
+        int          group   = -1;
         for (unsigned int i = 0; i < mNumCells; i++) {
-            mCells[i].updateSoc(current, timeStep, mSocVocTable);
+            if (group >= 0 and isGroupedCell(i)
+                    and mCells[group].getMaxCapacity() == mCells[i].getMaxCapacity()) {
+                mCells[i].setSoc(mCells[group].getSoc());
+            } else {
+                if (group < 0 and isGroupedCell(i)) {
+                    group = static_cast<int>(i);
+                }
+                mCells[i].updateSoc(current, timeStep, mSocVocTable);
+            }
+        }
+
+        /// - The group follows its first cell's new State of Charge.  If no cells are left in the
+        ///   group, a new group is started from the first nominal cell.
+        if (group >= 0) {
+            mGroupSoc = mCells[group].getSoc();
+        } else if (mGroupNominalCells) {
+            for (unsigned int i = 0; i < mNumCells; i++) {
+                if (mCells[i].isNominal()) {
+                    mGroupSoc = mCells[i].getSoc();
+                    break;
+                }
+            }
         }
     }
 }
@@ -48,6 +48,7 @@ class GunnsElectBatteryConfigData : public GunnsBasicPotentialConfigData
         double                mInterconnectResistance; /**< (ohm)    trick_chkpnt_io(**) Total interconnect resistance between all cells. */
         double                mMaxCapacity;            /**< (amp*hr) trick_chkpnt_io(**) Maximum charge capacity of the battery. */
         TsLinearInterpolator* mSocVocTable;            /**< (1)      trick_chkpnt_io(**) Pointer to open-circuit voltage vs. State of Charge table. */
+        bool                  mGroupNominalCells;      /**< (1)      trick_chkpnt_io(**) Whether identical nominal cells are updated as one equivalent cell. */
         /// @brief Electrical Battery Model configuration data default constructor.
         GunnsElectBatteryConfigData(const std::string     name                   = "",
                                     GunnsNodeList*        nodes                  = 0,
@@ -56,7 +57,8 @@ class GunnsElectBatteryConfigData : public GunnsBasicPotentialConfigData
                                     const double          cellResistance         = 0.0,
                                     const double          interconnectResistance = 0.0,
                                     const double          maxCapacity            = 0.0,
-                                    TsLinearInterpolator* socVocTable            = 0);
+                                    TsLinearInterpolator* socVocTable            = 0,
+                                    const bool            groupNominalCells      = false);
         /// @brief Electrical Battery Model configuration data default destructor.
         virtual ~GunnsElectBatteryConfigData();
 
@@ -111,6 +113,16 @@ class GunnsElectBatteryInputData : public GunnsBasicPotentialInputData
 ///           of their individual States of Charge.  With the cells in parallel, the battery's open-
 ///           circuit voltage is that of the cell with the highest voltage.
 ///
+///           Each step, the cells' effective resistances and open-circuit voltages are gathered
+///           into contiguous arrays in one sweep, and the battery totals are reduced from these
+///           arrays.  Optionally, cells that are nominal (no malfunctions) and have the group's
+///           State of Charge and the same capacity are grouped as one equivalent cell: only the
+///           first cell of the group does the Voc table lookup and State of Charge integration, and
+///           the results are copied to the rest of the group.  Since the group's cells are
+///           identical and see the same current, this gives the same results as updating them
+///           individually, while only malfunctioned or divergent cells are modeled individually.
+///           This is a large savings for batteries with many cells.
+///
 ///           Port 0 of the link is the input port, and Port 1 is the output port.  The closed-
 ///           circuit output voltage is equal to the Port 1 node potential.
 ///
@@ -141,6 +153,10 @@ class GunnsElectBattery: public GunnsBasicPotential
                                   std::vector<GunnsBasicLink*>& networkLinks,
                                   const int                     port0,
                                   const int                     port1);
+        /// @brief   Saves or restores the link dynamic state in a network snapshot.
+        virtual void   snapshotState(GunnsSnapshot& snapshot);
+        /// @brief   Returns whether snapshotState includes all of the link's dynamic state.
+        virtual bool   isSnapshotSupported() const;
         /// @brief   Updates the link's conductance and potential source.
         virtual void   updateState(const double timeStep);
         /// @brief   Updates the flux through the link and its effects.
@@ -173,6 +189,11 @@ class GunnsElectBattery: public GunnsBasicPotential
         double                mHeat;                   /**< (W)      trick_chkpnt_io(**) Heat created by the battery. */
         unsigned int          mThermalRunawayCell;     /**< (1)                          Current cell index for the thermal runaway cascade. */
         double                mThermalRunawayTimer;    /**< (s)                          Elapsed time of the thermal runaway malfunction. */
+        bool                  mGroupNominalCells;      /**< (1)      trick_chkpnt_io(**) Whether identical nominal cells are updated as one equivalent cell. */
+        double*               mCellResistances;        /**< (ohm)    trick_chkpnt_io(**) Effective resistance of each cell. */
+        double*               mCellVoltages;           /**< (V)      trick_chkpnt_io(**) Effective open-circuit voltage of each cell. */
+        double                mGroupSoc;               /**< (1)                          State of Charge of the group of identical nominal cells. */
+        unsigned int          mNumGroupedCells;        /**< (1)      trick_chkpnt_io(**) Number of cells copied from the equivalent nominal cell in the last update. */
         /// @brief   Validates the link's configuration and input data.
         void         validate(GunnsElectBatteryConfigData& configData,
                               GunnsElectBatteryInputData&  inputData);
@@ -190,6 +211,10 @@ class GunnsElectBattery: public GunnsBasicPotential
         double       computeParallelVoc() const;
         /// @brief   Finds total Voc of all cells in series.
         double       computeSeriesVoc() const;
+        /// @brief   Gathers the cells' effective resistance and open-circuit voltage.
+        void         updateCellBank();
+        /// @brief   Returns whether the given cell is in the group of identical nominal cells.
+        bool         isGroupedCell(const unsigned int cell) const;
         /// @brief   Updates the cells State of Charge.
         void         updateCells(const double timeStep);
         /// @brief   Updates the battery model output terms.
@@ -7,10 +7,12 @@
 
 LIBRARY DEPENDENCY:
  ((math/UnitConversion.o)
-  (math/approximation/TsLinearInterpolator.o))
+  (math/approximation/TsLinearInterpolator.o)
+  (core/GunnsSnapshot.o))
 */
 
 #include "GunnsElectBatteryCell.hh"
+#include "core/GunnsSnapshot.hh"
 #include "math/MsMath.hh"
 #include "core/GunnsBasicNode.hh"    // for H&S macros
 #include "math/approximation/TsLinearInterpolator.hh"
@@ -311,3 +313,34 @@ double GunnsElectBatteryCell::getEffectiveVoltage(TsLinearInterpolator* socVocTa
         return socVocTable->get(mSoc);
     }
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] soc (--) State of Charge (0-1).
+///
+/// @details  Sets the actual State of Charge of the cell, limited to (0-1).  This is used by the
+///           battery to copy the State of Charge of one nominal cell to the other identical nominal
+///           cells, in place of updating them all.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectBatteryCell::setSoc(const double soc)
+{
+    mSoc = MsMath::limitRange(0.0, soc, 1.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the malfunctions, State of Charge and thermal runaway state of this
+///           battery cell in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectBatteryCell::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mMalfOpenCircuit);
+    snapshot.sync(mMalfShortCircuit);
+    snapshot.sync(mMalfCapacityFlag);
+    snapshot.sync(mMalfCapacityValue);
+    snapshot.sync(mMalfThermalRunawayFlag);
+    snapshot.sync(mMalfThermalRunawayDuration);
+    snapshot.sync(mSoc);
+    snapshot.sync(mRunawayPower);
+    snapshot.sync(mRunawayPowerRate);
+}
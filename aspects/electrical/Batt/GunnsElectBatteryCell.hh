@@ -90,6 +90,7 @@ class GunnsElectBatteryCellInputData
 };
 
 // Forward declarations
+class GunnsSnapshot;
 class TsLinearInterpolator;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,6 +150,14 @@ class GunnsElectBatteryCell
         void   setMalfThermalRunaway(const bool flag = false, const double duration = 0.0);
         /// @brief   Gets the maximum capacity of the cell.
         double getMaxCapacity() const;
+        /// @brief   Gets the cell actual State of Charge.
+        double getSoc() const;
+        /// @brief   Sets the cell actual State of Charge.
+        void   setSoc(const double soc);
+        /// @brief   Saves or restores the cell state and malfunctions in a network snapshot.
+        void   snapshotState(GunnsSnapshot& snapshot);
+        /// @brief   Returns whether the cell has no active malfunctions or thermal runaway discharge.
+        bool   isNominal() const;
 
     protected:
         std::string mName;             /**< *o (1)      trick_chkpnt_io(**) Instance name for error messages. */
@@ -231,4 +240,26 @@ inline double GunnsElectBatteryCell::getMaxCapacity() const
     return mMaxCapacity;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (--) The actual State of Charge of the cell (0-1).
+///
+/// @details  Returns the value of mSoc, regardless of the failure malfunctions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsElectBatteryCell::getSoc() const
+{
+    return mSoc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if no malfunctions are active and there is no thermal runaway discharge.
+///
+/// @details  A nominal cell's State of Charge is only changed by the current through it, so nominal
+///           cells with the same State of Charge and capacity stay identical under the same current.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsElectBatteryCell::isNominal() const
+{
+    return not (mMalfOpenCircuit or mMalfShortCircuit or mMalfCapacityFlag or mMalfThermalRunawayFlag)
+       and 0.0 == mRunawayPower and 0.0 == mRunawayPowerRate;
+}
+
 #endif
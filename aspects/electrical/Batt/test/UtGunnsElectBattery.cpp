@@ -134,6 +134,7 @@ void UtGunnsElectBattery::testConfig()
     CPPUNIT_ASSERT(tInterconnectResistance == tConfigData->mInterconnectResistance);
     CPPUNIT_ASSERT(tMaxCapacity            == tConfigData->mMaxCapacity);
     CPPUNIT_ASSERT(tSocVocTable            == tConfigData->mSocVocTable);
+    CPPUNIT_ASSERT(false                   == tConfigData->mGroupNominalCells);
 
     /// @test default config construction.
     GunnsElectBatteryConfigData defaultConfig;
@@ -145,6 +146,7 @@ void UtGunnsElectBattery::testConfig()
     CPPUNIT_ASSERT(0.0                     == defaultConfig.mInterconnectResistance);
     CPPUNIT_ASSERT(0.0                     == defaultConfig.mMaxCapacity);
     CPPUNIT_ASSERT(0                       == defaultConfig.mSocVocTable);
+    CPPUNIT_ASSERT(false                   == defaultConfig.mGroupNominalCells);
 
     UT_PASS;
 }
@@ -203,6 +205,11 @@ void UtGunnsElectBattery::testDefaultConstruction()
     CPPUNIT_ASSERT(0.0   == tArticle->mHeat);
     CPPUNIT_ASSERT(0     == tArticle->mThermalRunawayCell);
     CPPUNIT_ASSERT(0.0   == tArticle->mThermalRunawayTimer);
+    CPPUNIT_ASSERT(false == tArticle->mGroupNominalCells);
+    CPPUNIT_ASSERT(0     == tArticle->mCellResistances);
+    CPPUNIT_ASSERT(0     == tArticle->mCellVoltages);
+    CPPUNIT_ASSERT(0.0   == tArticle->mGroupSoc);
+    CPPUNIT_ASSERT(0     == tArticle->mNumGroupedCells);
 
     UT_PASS;
 }
@@ -233,6 +240,9 @@ void UtGunnsElectBattery::testNominalInitialization()
     CPPUNIT_ASSERT(tInterconnectResistance     == tArticle->mInterconnectResistance);
     CPPUNIT_ASSERT(tSocVocTable                == tArticle->mSocVocTable);
     CPPUNIT_ASSERT(0                           != tArticle->mCells);
+    CPPUNIT_ASSERT(0                           != tArticle->mCellResistances);
+    CPPUNIT_ASSERT(0                           != tArticle->mCellVoltages);
+    CPPUNIT_ASSERT(false                       == tArticle->mGroupNominalCells);
 
     for (int i=0; i<tNumCells; ++i) {
         CPPUNIT_ASSERT(tCellResistance      == tArticle->mCells[i].getEffectiveResistance());
@@ -553,6 +563,111 @@ void UtGunnsElectBattery::testThermalRunaway()
     UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the grouping of identical nominal cells against a battery with every cell
+///           updated individually.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsElectBattery::testGroupedCells()
+{
+    UT_RESULT;
+
+    /// - Initialize a test article without grouping, and a test article with grouping in its own
+    ///   network with the same node potentials.
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0, tPort1);
+
+    GunnsBasicNode               nodes[N_NODES];
+    GunnsNodeList                nodeList;
+    std::vector<GunnsBasicLink*> links;
+    nodes[0].initialize("UtNode0", 1.0);
+    nodes[1].initialize("UtNode1", 0.0);
+    nodeList.mNodes    = nodes;
+    nodeList.mNumNodes = N_NODES;
+    tConfigData->mNodeList          = &nodeList;
+    tConfigData->mGroupNominalCells = true;
+    FriendlyGunnsElectBattery grouped;
+    grouped.initialize(*tConfigData, *tInputData, links, tPort0, tPort1);
+    CPPUNIT_ASSERT(true == grouped.mGroupNominalCells);
+    CPPUNIT_ASSERT(tSoc == grouped.mGroupSoc);
+
+    /// @test all nominal cells after the first are grouped, and the results are identical to the
+    ///       individual cell updates.
+    const double dt = 0.1;
+    tArticle->mPotentialVector[1] = 0.5 * tSoc;
+    grouped.mPotentialVector[1]   = 0.5 * tSoc;
+    for (int step = 0; step < 3; ++step) {
+        tArticle->step(dt);
+        grouped.step(dt);
+        tArticle->computeFlows(dt);
+        grouped.computeFlows(dt);
+    }
+    CPPUNIT_ASSERT(0                 == tArticle->mNumGroupedCells);
+    CPPUNIT_ASSERT(tNumCells - 1     == static_cast<int>(grouped.mNumGroupedCells));
+    CPPUNIT_ASSERT(tSoc               > grouped.mSoc);
+    CPPUNIT_ASSERT(tArticle->mSourcePotential       == grouped.mSourcePotential);
+    CPPUNIT_ASSERT(tArticle->mEffectiveConductivity == grouped.mEffectiveConductivity);
+    CPPUNIT_ASSERT(tArticle->mSoc                   == grouped.mSoc);
+    CPPUNIT_ASSERT(tArticle->mHeat                  == grouped.mHeat);
+    for (int i = 0; i < tNumCells; ++i) {
+        CPPUNIT_ASSERT(tArticle->mCells[i].getSoc() == grouped.mCells[i].getSoc());
+        CPPUNIT_ASSERT(tArticle->mCellVoltages[i]   == grouped.mCellVoltages[i]);
+    }
+
+    /// @test a failed cell is modeled individually, and the next nominal cell leads the group.
+    tArticle->mCells[0].setMalfOpenCircuit(true);
+    grouped.mCells[0].setMalfOpenCircuit(true);
+    for (int step = 0; step < 3; ++step) {
+        tArticle->step(dt);
+        grouped.step(dt);
+        tArticle->computeFlows(dt);
+        grouped.computeFlows(dt);
+    }
+    CPPUNIT_ASSERT(tNumCells - 2     == static_cast<int>(grouped.mNumGroupedCells));
+    CPPUNIT_ASSERT(tArticle->mSoc    == grouped.mSoc);
+
+    /// @test the cell stays divergent after its malfunction is removed, since its State of Charge
+    ///       no longer matches the group.
+    tArticle->mCells[0].setMalfOpenCircuit();
+    grouped.mCells[0].setMalfOpenCircuit();
+    for (int step = 0; step < 3; ++step) {
+        tArticle->step(dt);
+        grouped.step(dt);
+        tArticle->computeFlows(dt);
+        grouped.computeFlows(dt);
+    }
+    CPPUNIT_ASSERT(tNumCells - 2     == static_cast<int>(grouped.mNumGroupedCells));
+    CPPUNIT_ASSERT(tArticle->mSourcePotential == grouped.mSourcePotential);
+    CPPUNIT_ASSERT(tArticle->mSoc             == grouped.mSoc);
+    for (int i = 0; i < tNumCells; ++i) {
+        CPPUNIT_ASSERT(tArticle->mCells[i].getSoc() == grouped.mCells[i].getSoc());
+    }
+
+    /// @test the thermal runaway malfunction is modeled individually.
+    tArticle->setMalfThermalRunaway(true, 10.0, 5.0);
+    grouped.setMalfThermalRunaway(true, 10.0, 5.0);
+    for (int step = 0; step < 3; ++step) {
+        tArticle->step(dt);
+        grouped.step(dt);
+        tArticle->computeFlows(dt);
+        grouped.computeFlows(dt);
+    }
+    CPPUNIT_ASSERT(tNumCells - 2     == static_cast<int>(grouped.mNumGroupedCells));
+    CPPUNIT_ASSERT(tArticle->mHeat   == grouped.mHeat);
+    CPPUNIT_ASSERT(tArticle->mSoc    == grouped.mSoc);
+
+    /// @test a new group is started from the first nominal cell when the group has no cells left.
+    grouped.setMalfThermalRunaway();
+    for (int i = 1; i < tNumCells; ++i) {
+        grouped.mCells[i].setSoc(0.1 * i);
+    }
+    grouped.step(dt);
+    grouped.computeFlows(dt);
+    CPPUNIT_ASSERT(grouped.mCells[0].getSoc() == grouped.mGroupSoc);
+    grouped.step(dt);
+    CPPUNIT_ASSERT(0 == grouped.mNumGroupedCells);
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Tests the getter and setter methods.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
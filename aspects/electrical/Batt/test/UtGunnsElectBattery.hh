@@ -62,6 +62,7 @@ class UtGunnsElectBattery: public CppUnit::TestFixture
         void testUpdateStateSeries();
         void testUpdateFlux();
         void testThermalRunaway();
+        void testGroupedCells();
         void testAccessors();
 
     private:
@@ -76,6 +77,7 @@ class UtGunnsElectBattery: public CppUnit::TestFixture
         CPPUNIT_TEST(testUpdateStateSeries);
         CPPUNIT_TEST(testUpdateFlux);
         CPPUNIT_TEST(testThermalRunaway);
+        CPPUNIT_TEST(testGroupedCells);
         CPPUNIT_TEST(testAccessors);
         CPPUNIT_TEST_SUITE_END();
         enum {N_NODES = 2};
@@ -538,5 +538,32 @@ void UtGunnsElectBatteryCell::testAccessors()
     tArticle->mMaxCapacity = 4.0;
     CPPUNIT_ASSERT_DOUBLES_EQUAL(4.0, tArticle->getMaxCapacity(),   0.0);
 
+    /// @test    Get and set actual State of Charge, limited to (0-1).
+    tArticle->setSoc(0.4);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.4, tArticle->getSoc(),           0.0);
+    tArticle->setSoc(1.1);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, tArticle->getSoc(),           0.0);
+    tArticle->setSoc(-0.1);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->getSoc(),           0.0);
+
+    /// @test    Cell is nominal only with no malfunctions and no thermal runaway discharge.
+    CPPUNIT_ASSERT(tArticle->isNominal());
+    tArticle->setMalfOpenCircuit(true);
+    CPPUNIT_ASSERT(not tArticle->isNominal());
+    tArticle->setMalfOpenCircuit();
+    tArticle->setMalfShortCircuit(true);
+    CPPUNIT_ASSERT(not tArticle->isNominal());
+    tArticle->setMalfShortCircuit();
+    tArticle->setMalfCapacity(true, 1.0);
+    CPPUNIT_ASSERT(not tArticle->isNominal());
+    tArticle->setMalfCapacity();
+    tArticle->setMalfThermalRunaway(true, 1.0);
+    CPPUNIT_ASSERT(not tArticle->isNominal());
+    tArticle->setMalfThermalRunaway();
+    tArticle->mRunawayPower = 1.0;
+    CPPUNIT_ASSERT(not tArticle->isNominal());
+    tArticle->mRunawayPower = 0.0;
+    CPPUNIT_ASSERT(tArticle->isNominal());
+
     UT_PASS_LAST;
 }
@@ -11,6 +11,8 @@ LIBRARY DEPENDENCY:
 */
 
 #include "EpsConstantPowerLoad.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "math/MsMath.hh"
 
@@ -181,6 +183,31 @@ void EpsConstantPowerLoad::restartModel()
     mPowerDraw = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           desired power and its user bias.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void EpsConstantPowerLoad::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicConductor::snapshotState(snapshot);
+
+    snapshot.sync(mDesiredPower);
+    snapshot.sync(mPowerDraw);
+    snapshot.sync(mBiasPowerLoadValue);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a EpsConstantPowerLoad.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool EpsConstantPowerLoad::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(EpsConstantPowerLoad);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Updates the link's effective conductivity during the time step
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -107,6 +107,10 @@ class EpsConstantPowerLoad : public GunnsBasicConductor
                         std::vector<GunnsBasicLink*>&         networkLinks,
                         const int                             port0,
                         const int                             port1);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief Minor step method for non-linear iterations.
         virtual void minorStep(const double dt, const int);
         /// @brief Updates the State of the link.
@@ -27,6 +27,7 @@ LIBRARY DEPENDENCY:
 /// @param[in] inputUnderVoltageTripLimit (--) Input under-voltage trip limit.
 /// @param[in] inputOverVoltageTripLimit  (--) Input over-voltage trip limit.
 /// @param[in] efficiencyTable            (--) Pointer to the converter efficiency vs. power fraction table.
+/// @param[in] predictLoad                (--) Predict the load current from the estimated input network source.
 ///
 /// @details  Default Electrical Converter Input link config data constructor.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,7 +39,8 @@ GunnsElectConverterInputConfigData::GunnsElectConverterInputConfigData(
         const unsigned int        tripPriority,
         const float               inputUnderVoltageTripLimit,
         const float               inputOverVoltageTripLimit,
-        TsLinearInterpolator*     efficiencyTable)
+        TsLinearInterpolator*     efficiencyTable,
+        const bool                predictLoad)
     :
     GunnsBasicLinkConfigData(name, nodes),
     mInputVoltageSensor(inputVoltageSensor),
@@ -46,7 +48,8 @@ GunnsElectConverterInputConfigData::GunnsElectConverterInputConfigData(
     mTripPriority(tripPriority),
     mInputUnderVoltageTripLimit(inputUnderVoltageTripLimit),
     mInputOverVoltageTripLimit(inputOverVoltageTripLimit),
-    mEfficiencyTable(efficiencyTable)
+    mEfficiencyTable(efficiencyTable),
+    mPredictLoad(predictLoad)
 {
     // nothing to do
 }
@@ -73,7 +76,8 @@ GunnsElectConverterInputConfigData::GunnsElectConverterInputConfigData(
     mTripPriority(that.mTripPriority),
     mInputUnderVoltageTripLimit(that.mInputUnderVoltageTripLimit),
     mInputOverVoltageTripLimit(that.mInputOverVoltageTripLimit),
-    mEfficiencyTable(that.mEfficiencyTable)
+    mEfficiencyTable(that.mEfficiencyTable),
+    mPredictLoad(that.mPredictLoad)
 {
     // nothing to do
 }
@@ -152,7 +156,14 @@ GunnsElectConverterInput::GunnsElectConverterInput()
     mTotalPowerLoss(0.0),
     mLeadsInterface(false),
     mOverloadedState(false),
-    mLastOverloadedState(false)
+    mLastOverloadedState(false),
+    mPredictLoad(false),
+    mLastLoadVoltage(0.0),
+    mLastLoadCurrent(0.0),
+    mLastLoadValid(false),
+    mNumMinorSteps(0),
+    mMaxNumMinorSteps(0),
+    mNumPredictions(0)
 {
     // nothing to do
 }
@@ -207,6 +218,7 @@ void GunnsElectConverterInput::initialize(      GunnsElectConverterInputConfigDa
     mInputUnderVoltageTrip.initialize(configData.mInputUnderVoltageTripLimit, configData.mTripPriority, false);
     mInputOverVoltageTrip .initialize(configData.mInputOverVoltageTripLimit,  configData.mTripPriority, false);
     mEfficiencyTable = configData.mEfficiencyTable;
+    mPredictLoad     = configData.mPredictLoad;
     mEnabled         = inputData.mEnabled;
     mInputVoltage    = inputData.mInputVoltage;
     mInputPower      = inputData.mInputPower;
@@ -221,6 +233,12 @@ void GunnsElectConverterInput::initialize(      GunnsElectConverterInputConfigDa
     mInputPowerValid     = true;
     mConverterEfficiency = 1.0;
     mTotalPowerLoss      = 0.0;
+    mLastLoadVoltage     = 0.0;
+    mLastLoadCurrent     = 0.0;
+    mLastLoadValid       = false;
+    mNumMinorSteps       = 0;
+    mMaxNumMinorSteps    = 0;
+    mNumPredictions      = 0;
     mNodes[0]->setPotential(mInputVoltage);
 
     /// - Set init flag on successful validation.
@@ -298,6 +316,10 @@ void GunnsElectConverterInput::restartModel()
     mInputVoltageValid   = true;
     mOverloadedState     = false;
     mLastOverloadedState = false;
+    mLastLoadValid       = false;
+    mNumMinorSteps       = 0;
+    mMaxNumMinorSteps    = 0;
+    mNumPredictions      = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -319,6 +341,8 @@ void GunnsElectConverterInput::step(const double dt __attribute__((unused)))
         mResetTrips = false;
         resetTrips();
     }
+    mNumMinorSteps  = 0;
+    mNumPredictions = 0;
 
     minorStep(0.0, 1);
 }
@@ -333,7 +357,12 @@ void GunnsElectConverterInput::step(const double dt __attribute__((unused)))
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsElectConverterInput::minorStep(const double dt __attribute__((unused)), const int minorStep __attribute__((unused)))
 {
+    /// - Update the minor step metrics.
+    ++mNumMinorSteps;
+    mMaxNumMinorSteps = std::max(mMaxNumMinorSteps, mNumMinorSteps);
+
     if (mNodeMap[0] == getGroundNodeIndex()) {
+        mLastLoadValid       = false;
         /// - Skip processing when on the Ground node.
         mInputVoltage        = 0.0;
         mInputPower          = 0.0;
@@ -391,6 +420,9 @@ void GunnsElectConverterInput::minorStep(const double dt __attribute__((unused))
                 ///   voltage, then we'll either undervolt trip off, enter the overloaded state, or
                 ///   reset this potential in resetLastMinorStep().
                 current = -mSourceVector[0];
+            } else if (mPredictLoad and predictLoadCurrent(current, scaledInputLoad, 0.99 * iuvLimit)) {
+                /// - The optional predicted load current was used.
+                ++mNumPredictions;
             } else if (iuvLimit > DBL_EPSILON) {
                 /// - If there is a non-zero IUV limit, then don't load the input circuit much
                 ///   farther below it.  This avoids increasing our load too aggressively in
@@ -404,6 +436,12 @@ void GunnsElectConverterInput::minorStep(const double dt __attribute__((unused))
             } // else current = 0 from above.
         }     // else current = 0 from above.
 
+        /// - Save the last node voltage and the load current that produced it, for the next
+        ///   prediction.
+        mLastLoadVoltage = mPotentialVector[0];
+        mLastLoadCurrent = -mSourceVector[0];
+        mLastLoadValid   = true;
+
         /// - Build the admittance matrix and source vector.  Admittance is always forced to zero
         ///   since this link is only ever a current source.
         if (mAdmittanceMatrix[0] != 0.0) {
@@ -414,6 +452,57 @@ void GunnsElectConverterInput::minorStep(const double dt __attribute__((unused))
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] current    (amp) Returned predicted load current.
+/// @param[in]  power      (W)   Power load to be drawn from the input node.
+/// @param[in]  minVoltage (V)   Lowest allowed predicted input node voltage.
+///
+/// @returns  bool  (--)  True if the prediction was made and the returned current is valid.
+///
+/// @details  Predicts the current that draws the given power from the input node, by estimating
+///           the rest of the input network as a Thevenin equivalent source.  The last two minor step
+///           solutions give the node voltage response V to the load current I that was applied:
+///           the slope of this line is the secant of the node's voltage-current Jacobian, and
+///           gives the source conductance G = -dI/dV and voltage Vth = V + I/G.  Solving the power
+///           load P = V * G * (Vth - V) for V on the high-voltage side of the source's maximum
+///           power gives V = (Vth + sqrt(Vth^2 - 4P/G)) / 2, and the current is P/V.
+///
+///           No prediction is made when there is no valid previous solution, the node voltage or
+///           current didn't change, the estimated source conductance isn't positive, the source
+///           can't supply the power, or the predicted voltage is below the given minimum.  Then the
+///           caller falls back to the normal fixed-point load current.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsElectConverterInput::predictLoadCurrent(double&      current,
+                                                  const double power,
+                                                  const double minVoltage) const
+{
+    if (not mLastLoadValid or power < DBL_EPSILON) {
+        return false;
+    }
+    const double voltage = mPotentialVector[0];
+    const double applied = -mSourceVector[0];
+    const double dV      = voltage - mLastLoadVoltage;
+    const double dI      = applied - mLastLoadCurrent;
+    if (std::fabs(dV) < DBL_EPSILON or std::fabs(dI) < DBL_EPSILON) {
+        return false;
+    }
+    const double conductance = -dI / dV;
+    if (conductance < DBL_EPSILON) {
+        return false;
+    }
+    const double vth  = voltage + applied / conductance;
+    const double disc = vth * vth - 4.0 * power / conductance;
+    if (disc < 0.0) {
+        return false;
+    }
+    const double vLoad = 0.5 * (vth + std::sqrt(disc));
+    if (vLoad < std::max(DBL_EPSILON, minVoltage)) {
+        return false;
+    }
+    current = power / vLoad;
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Not used.
 ///
@@ -519,6 +608,9 @@ bool GunnsElectConverterInput::resetLastMinorStep(const int convergedStep,
     if (convergedStep > 0 and mPotentialVector[0] < 0.0) {
         mPotentialVector[0] = 0.0;
     }
+
+    /// - The last solution was rejected so it isn't valid for the next load prediction.
+    mLastLoadValid = false;
     return true;
 }
 
@@ -75,6 +75,18 @@ class GunnsElectConverterOutput;
 ///           output link.  This should be used when and only when both links are in the same
 ///           network.  This causes the two links to share input voltage and load values between
 ///           the network minor steps, for less latency in the supply-demand loop.
+///
+///           The I = P/V current source converges on the power load by fixed-point iteration over
+///           the minor steps, which can be slow when the input network is soft compared to the
+///           load.  The optional predicted load (mPredictLoad) speeds this up: from the node
+///           voltage responses to the currents applied in the last two minor steps, it estimates
+///           the input network as a Thevenin equivalent source, i.e. the secant of the node's
+///           voltage-current Jacobian, and solves the power load against that source directly for
+///           the current on the high-voltage side.  For a linear input network this converges in
+///           about two minor steps after the load changes.  The link still only contributes a
+///           current source, so the admittance matrix isn't changed and needs no extra
+///           decompositions.  Metrics of minor steps and predictions per major step are kept for
+///           comparing convergence with and without this option.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //TODO extract new CPL to a utility class for reuse by other links what do CPL...
 class GunnsElectConverterInput : public GunnsBasicLink
@@ -132,6 +144,12 @@ class GunnsElectConverterInput : public GunnsBasicLink
         double getConverterEfficiency() const;
         /// @brief Calculates what mConverterEfficiency would be at given load.
         double getConverterEfficiencyAtLoad(const double load) const;
+        /// @brief Returns the number of minor steps in the last major step.
+        int getNumMinorSteps() const;
+        /// @brief Returns the highest number of minor steps in a major step.
+        int getMaxNumMinorSteps() const;
+        /// @brief Returns the number of minor steps that used the predicted load in the last major step.
+        int getNumPredictions() const;
 
     protected:
         SensorAnalog*              mInputVoltageSensor;    /**<    (1) trick_chkpnt_io(**) Pointer to the input voltage sensor. */
@@ -152,11 +170,20 @@ class GunnsElectConverterInput : public GunnsBasicLink
         bool                       mLeadsInterface;        /**< *o (1) trick_chkpnt_io(**) This precedes the mOutputLink in the network. */
         bool                       mOverloadedState;       /**<    (1) trick_chkpnt_io(**) Network can't supply the power load. */
         bool                       mLastOverloadedState;   /**<    (1) trick_chkpnt_io(**) Last pass value of mOverloadedState. */
+        bool                       mPredictLoad;           /**<    (1) trick_chkpnt_io(**) Predict the load current from the estimated input network source. */
+        double                     mLastLoadVoltage;       /**<    (V) trick_chkpnt_io(**) Node voltage solved in the previous minor step. */
+        double                     mLastLoadCurrent;       /**<  (amp) trick_chkpnt_io(**) Load current that produced mLastLoadVoltage. */
+        bool                       mLastLoadValid;         /**<    (1) trick_chkpnt_io(**) The last load voltage and current are valid for prediction. */
+        int                        mNumMinorSteps;         /**<    (1) trick_chkpnt_io(**) Number of minor steps in the last major step. */
+        int                        mMaxNumMinorSteps;      /**<    (1) trick_chkpnt_io(**) Highest number of minor steps in a major step since restart. */
+        int                        mNumPredictions;        /**<    (1) trick_chkpnt_io(**) Number of minor steps that used the predicted load in the last major step. */
         /// @brief  Validates the configuration and input data.
         void validate(const GunnsElectConverterInputConfigData& configData,
                       const GunnsElectConverterInputInputData&  inputData) const;
         /// @brief  Virtual method for derived links to perform their restart functions.
         virtual void restartModel();
+        /// @brief  Predicts the load current from the estimated input network source.
+        bool predictLoadCurrent(double& current, const double power, const double minVoltage) const;
 
     private:
         /// @details Define the number of ports this link class has.  All objects of the same link
@@ -184,6 +211,7 @@ class GunnsElectConverterInputConfigData: public GunnsBasicLinkConfigData
         float                     mInputUnderVoltageTripLimit; /**< (V) trick_chkpnt_io(**) Input under-voltage trip limit. */
         float                     mInputOverVoltageTripLimit;  /**< (V) trick_chkpnt_io(**) Input over-voltage trip limit. */
         TsLinearInterpolator*     mEfficiencyTable;            /**< (1) trick_chkpnt_io(**) Pointer to the converter efficiency vs. power fraction table. */
+        bool                      mPredictLoad;                /**< (1) trick_chkpnt_io(**) Predict the load current from the estimated input network source. */
         /// @brief  Default constructs this Electrical Converter Input configuration data.
         GunnsElectConverterInputConfigData(
                 const std::string&        name                       = "",
@@ -193,7 +221,8 @@ class GunnsElectConverterInputConfigData: public GunnsBasicLinkConfigData
                 const unsigned int        tripPriority               = 0,
                 const float               inputUnderVoltageTripLimit = 0.0,
                 const float               inputOverVoltageTripLimit  = 0.0,
-                TsLinearInterpolator*     efficiencyTable            = 0);
+                TsLinearInterpolator*     efficiencyTable            = 0,
+                const bool                predictLoad                = false);
         /// @brief  Default destructs this Electrical Converter Input configuration data.
         virtual ~GunnsElectConverterInputConfigData();
         /// @brief  Copy constructs this Electrical Converter Input configuration data.
@@ -370,4 +399,34 @@ inline double GunnsElectConverterInput::getConverterEfficiencyAtLoad(const doubl
     return mEfficiencyTable->get(powerFraction);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  Number of minor steps in the last major step.
+///
+/// @details  Returns the value of mNumMinorSteps.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsElectConverterInput::getNumMinorSteps() const
+{
+    return mNumMinorSteps;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  Highest number of minor steps in a major step since restart.
+///
+/// @details  Returns the value of mMaxNumMinorSteps.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsElectConverterInput::getMaxNumMinorSteps() const
+{
+    return mMaxNumMinorSteps;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  Number of minor steps that used the predicted load in the last major step.
+///
+/// @details  Returns the value of mNumPredictions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsElectConverterInput::getNumPredictions() const
+{
+    return mNumPredictions;
+}
+
 #endif
@@ -3,6 +3,7 @@
            National Aeronautics and Space Administration.  All Rights Reserved.
 */
 #include "software/exceptions/TsInitializationException.hh"
+#include <cmath>
 #include <iostream>
 #include "strings/UtResult.hh"
 #include "math/MsMath.hh"
@@ -152,6 +153,7 @@ void UtGunnsElectConverterInput::testConfig()
     CPPUNIT_ASSERT(tInUnderVoltageTrip == static_cast<double>(tConfigData->mInputUnderVoltageTripLimit));
     CPPUNIT_ASSERT(tInOverVoltageTrip  == static_cast<double>(tConfigData->mInputOverVoltageTripLimit));
     CPPUNIT_ASSERT(tEfficiencyTable    == tConfigData->mEfficiencyTable);
+    CPPUNIT_ASSERT(false               == tConfigData->mPredictLoad);
 
     /// @test    Configuration data default construction.
     GunnsElectConverterInputConfigData defaultConfig;
@@ -161,8 +163,10 @@ void UtGunnsElectConverterInput::testConfig()
     CPPUNIT_ASSERT(0.0F == defaultConfig.mInputUnderVoltageTripLimit);
     CPPUNIT_ASSERT(0.0F == defaultConfig.mInputOverVoltageTripLimit);
     CPPUNIT_ASSERT(0    == defaultConfig.mEfficiencyTable);
+    CPPUNIT_ASSERT(false == defaultConfig.mPredictLoad);
 
     /// @test    Configuration data copy construction.
+    tConfigData->mPredictLoad = true;
     GunnsElectConverterInputConfigData copyConfig(*tConfigData);
     CPPUNIT_ASSERT(&tSensorVin         == copyConfig.mInputVoltageSensor);
     CPPUNIT_ASSERT(&tSensorIin         == copyConfig.mInputCurrentSensor);
@@ -170,6 +174,7 @@ void UtGunnsElectConverterInput::testConfig()
     CPPUNIT_ASSERT(tInUnderVoltageTrip == static_cast<double>(copyConfig.mInputUnderVoltageTripLimit));
     CPPUNIT_ASSERT(tInOverVoltageTrip  == static_cast<double>(copyConfig.mInputOverVoltageTripLimit));
     CPPUNIT_ASSERT(tEfficiencyTable    == copyConfig.mEfficiencyTable);
+    CPPUNIT_ASSERT(true                == copyConfig.mPredictLoad);
 
     UT_PASS;
 }
@@ -234,6 +239,13 @@ void UtGunnsElectConverterInput::testConstruction()
     CPPUNIT_ASSERT(false == tArticle->mLeadsInterface);
     CPPUNIT_ASSERT(false == tArticle->mOverloadedState);
     CPPUNIT_ASSERT(false == tArticle->mLastOverloadedState);
+    CPPUNIT_ASSERT(false == tArticle->mPredictLoad);
+    CPPUNIT_ASSERT(0.0   == tArticle->mLastLoadVoltage);
+    CPPUNIT_ASSERT(0.0   == tArticle->mLastLoadCurrent);
+    CPPUNIT_ASSERT(false == tArticle->mLastLoadValid);
+    CPPUNIT_ASSERT(0     == tArticle->mNumMinorSteps);
+    CPPUNIT_ASSERT(0     == tArticle->mMaxNumMinorSteps);
+    CPPUNIT_ASSERT(0     == tArticle->mNumPredictions);
     CPPUNIT_ASSERT(""    == tArticle->mName);
 
     /// @test    New/delete for code coverage.
@@ -368,10 +380,18 @@ void UtGunnsElectConverterInput::testRestart()
     tArticle->mResetTrips          = true;
     tArticle->mOverloadedState     = true;
     tArticle->mLastOverloadedState = true;
+    tArticle->mLastLoadValid       = true;
+    tArticle->mNumMinorSteps       = 1;
+    tArticle->mMaxNumMinorSteps    = 1;
+    tArticle->mNumPredictions      = 1;
     tArticle->restart();
     CPPUNIT_ASSERT(false == tArticle->mResetTrips);
     CPPUNIT_ASSERT(false == tArticle->mOverloadedState);
     CPPUNIT_ASSERT(false == tArticle->mLastOverloadedState);
+    CPPUNIT_ASSERT(false == tArticle->mLastLoadValid);
+    CPPUNIT_ASSERT(0     == tArticle->mNumMinorSteps);
+    CPPUNIT_ASSERT(0     == tArticle->mMaxNumMinorSteps);
+    CPPUNIT_ASSERT(0     == tArticle->mNumPredictions);
 
     UT_PASS;
 }
@@ -844,6 +864,95 @@ void UtGunnsElectConverterInput::testResetLastMinorStep()
     CPPUNIT_ASSERT(true == tArticle->resetLastMinorStep(1, 1));
     CPPUNIT_ASSERT(0.0  == tArticle->mPotentialVector[0]);
 
+    /// @test    Invalidates the last load for prediction.
+    tArticle->mLastLoadValid = true;
+    CPPUNIT_ASSERT(true  == tArticle->resetLastMinorStep(0, 1));
+    CPPUNIT_ASSERT(false == tArticle->mLastLoadValid);
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the predicted load option, by iterating the minorStep against a Thevenin
+///           equivalent input network, with and without the prediction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsElectConverterInput::testPredictLoad()
+{
+    UT_RESULT;
+
+    /// - Input network Thevenin source, and the expected node voltage at the power load, on the
+    ///   high-voltage side.
+    const double sourceV   = 120.0;
+    const double sourceG   = 0.5;
+    const double power     = 1500.0;
+    const double expectedV = 0.5 * (sourceV + std::sqrt(sourceV * sourceV - 4.0 * power / sourceG));
+    const double expectedI = power / expectedV;
+
+    int numMinorSteps[2] = {0, 0};
+    for (int predict = 0; predict < 2; ++predict) {
+        /// - Initialize with and without the prediction, no efficiency loss and a low IUV limit.
+        tConfigData->mPredictLoad = (1 == predict);
+        tInputData->mInputPower   = power;
+        tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0);
+        CPPUNIT_ASSERT(tConfigData->mPredictLoad == tArticle->mPredictLoad);
+        tArticle->mEfficiencyTable = 0;
+        tArticle->setMalfBlockage();
+        tArticle->mInputUnderVoltageTrip.setLimit(50.0);
+
+        /// - Step with the node at the source voltage, then iterate minor steps, solving the node
+        ///   voltage from the load current, until the current converges.
+        tArticle->mPotentialVector[0] = sourceV;
+        tArticle->step(0.0);
+        double lastI = 0.0;
+        for (int minorStep = 2; minorStep < 100; ++minorStep) {
+            const double current = -tArticle->mSourceVector[0];
+            if (std::fabs(current - lastI) < 1.0e-8) {
+                break;
+            }
+            lastI = current;
+            tArticle->mPotentialVector[0] = sourceV - current / sourceG;
+            tArticle->minorStep(0.0, minorStep);
+        }
+        numMinorSteps[predict] = tArticle->getNumMinorSteps();
+
+        /// @test    Converges to the power load on the high-voltage side.
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedV, tArticle->mPotentialVector[0], 1.0e-6);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedI, -tArticle->mSourceVector[0],   1.0e-6);
+        CPPUNIT_ASSERT(0.0 == tArticle->mAdmittanceMatrix[0]);
+
+        /// @test    Minor step metrics.
+        CPPUNIT_ASSERT(tArticle->getNumMinorSteps() == tArticle->getMaxNumMinorSteps());
+        if (predict) {
+            CPPUNIT_ASSERT(0 < tArticle->getNumPredictions());
+        } else {
+            CPPUNIT_ASSERT(0 == tArticle->getNumPredictions());
+        }
+    }
+
+    /// @test    The prediction converges in fewer minor steps.
+    CPPUNIT_ASSERT(numMinorSteps[1] < numMinorSteps[0]);
+
+    /// @test    No prediction without a change in the node voltage.
+    double current = 0.0;
+    tArticle->mLastLoadVoltage = tArticle->mPotentialVector[0];
+    CPPUNIT_ASSERT(false == tArticle->predictLoadCurrent(current, power, 0.0));
+
+    /// @test    No prediction when the estimated source can't supply the power.
+    tArticle->mLastLoadVoltage = tArticle->mPotentialVector[0] + 1.0;
+    tArticle->mLastLoadCurrent = -tArticle->mSourceVector[0] - 0.001;
+    CPPUNIT_ASSERT(false == tArticle->predictLoadCurrent(current, 1.0e10, 0.0));
+
+    /// @test    No prediction when the estimated source conductance isn't positive.
+    tArticle->mLastLoadCurrent = -tArticle->mSourceVector[0] + 1.0;
+    CPPUNIT_ASSERT(false == tArticle->predictLoadCurrent(current, power, 0.0));
+
+    /// @test    No prediction below the minimum voltage, or without a valid last load.
+    tArticle->mLastLoadCurrent = -tArticle->mSourceVector[0] - 1.0;
+    CPPUNIT_ASSERT(true  == tArticle->predictLoadCurrent(current, power, 0.0));
+    CPPUNIT_ASSERT(false == tArticle->predictLoadCurrent(current, power, 1.0e10));
+    tArticle->mLastLoadValid = false;
+    CPPUNIT_ASSERT(false == tArticle->predictLoadCurrent(current, power, 0.0));
+
     UT_PASS;
 }
 
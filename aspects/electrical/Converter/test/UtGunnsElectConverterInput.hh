@@ -85,6 +85,8 @@ class UtGunnsElectConverterInput: public CppUnit::TestFixture
         void testConfirmSolutionAcceptable();
         /// @brief  Tests the resetLastMinorStep method.
         void testResetLastMinorStep();
+        /// @brief  Tests the predicted load option.
+        void testPredictLoad();
         /// @brief  Tests the computeFlows method.
         void testComputeFlows();
 
@@ -103,6 +105,7 @@ class UtGunnsElectConverterInput: public CppUnit::TestFixture
         CPPUNIT_TEST(testAccessors);
         CPPUNIT_TEST(testConfirmSolutionAcceptable);
         CPPUNIT_TEST(testResetLastMinorStep);
+        CPPUNIT_TEST(testPredictLoad);
         CPPUNIT_TEST(testComputeFlows);
         CPPUNIT_TEST_SUITE_END();
         /// @brief  Enumeration for the number of nodes.
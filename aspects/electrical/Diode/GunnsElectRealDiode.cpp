@@ -10,6 +10,8 @@ LIBRARY DEPENDENCY:
 */
 
 #include "GunnsElectRealDiode.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -179,6 +181,29 @@ void GunnsElectRealDiode::restartModel()
     GunnsBasicPotential::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           bias direction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectRealDiode::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicPotential::snapshotState(snapshot);
+
+    snapshot.sync(mReverseBias);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsElectRealDiode.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsElectRealDiode::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsElectRealDiode);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Not used.
 ///
@@ -15,6 +15,7 @@ LIBRARY DEPENDENCY:
 #include "GunnsElectDistributedIf.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
+#include <algorithm>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name              (--)    Link name.
@@ -35,7 +36,8 @@ GunnsElectDistributedIfConfigData::GunnsElectDistributedIfConfigData(const std::
     mIsPairPrimary(isPairPrimary),
     mConductance(conductance),
     mNetCapDvThreshold(netCapDvThreshold),
-    mSupplies()
+    mSupplies(),
+    mLagPrediction(false)
 {
     // nothing to do
 }
@@ -52,7 +54,8 @@ GunnsElectDistributedIfConfigData::GunnsElectDistributedIfConfigData(
     mIsPairPrimary(that.mIsPairPrimary),
     mConductance(that.mConductance),
     mNetCapDvThreshold(that.mNetCapDvThreshold),
-    mSupplies(that.mSupplies)
+    mSupplies(that.mSupplies),
+    mLagPrediction(that.mLagPrediction)
 {
     // nothing to do
 }
@@ -119,7 +122,9 @@ GunnsElectDistributedIf::GunnsElectDistributedIf()
     mSupplies(),
     mNumSupplies(0),
     mSupplyMonitorIndex(0),
-    mSupplyMonitor(0)
+    mSupplyMonitor(0),
+    mLagPrediction(false),
+    mVoltagePredictor()
 {
     // nothing to do
 }
@@ -167,6 +172,8 @@ void GunnsElectDistributedIf::initialize(const GunnsElectDistributedIfConfigData
         mSupplies.push_back(supply);
     }
     mInterface.initialize(configData.mIsPairPrimary, static_cast<float>(mNodes[0]->getPotential()));
+    mLagPrediction = configData.mLagPrediction;
+    mVoltagePredictor.initialize();
     if (inputData.mForceSupplyMode) {
         mInterface.forceSupplyRole();
     } else if (inputData.mForceDemandMode) {
@@ -215,6 +222,7 @@ void GunnsElectDistributedIf::restartModel()
     /// - Reset non-checkpointed and non-configuration data attributes.
     mPowerLoad.restart();
     mVoltageSource.restart();
+    mVoltagePredictor.reset();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,8 +239,15 @@ void GunnsElectDistributedIf::step(const double dt)
 
     /// - The voltage supplied to this side from the remote side only needs to be updated once, here
     ///   at the beginning of the major step, since it only changes from the remote side between our
-    ///   steps.
-    mVoltageSource.setInputVoltage(static_cast<double>(mInterface.getRemoteSupply()));
+    ///   steps.  It is optionally extrapolated across the loop lag when in Demand mode.
+    double supplyVoltage = static_cast<double>(mInterface.getRemoteSupply());
+    if (mLagPrediction and mInterface.isInDemandRole()) {
+        supplyVoltage = std::max(0.0, mVoltagePredictor.predict(supplyVoltage,
+                mInterface.mInData.mFrameCount, mInterface.getLoopLatency()));
+    } else {
+        mVoltagePredictor.reset();
+    }
+    mVoltageSource.setInputVoltage(supplyVoltage);
 
     minorStep(dt, 1);
 }
@@ -293,7 +308,7 @@ void GunnsElectDistributedIf::updateSupplyData()
     /// - Set each voltage supply's availability flag to the interface utility if it is enabled and
     ///   has a conductive path to this location.
     for (unsigned int i=0; i<mSupplies.size(); ++i) {
-        const double dV = mNodes[0]->getNetCapDeltaPotential()[mSupplies[i].mLink->getNodeMap()[0]];
+        const double dV = mNodes[0]->getNetCapDeltaPotential(mSupplies[i].mLink->getNodeMap()[0]);
         mSupplies.at(i).mNetCapDV = dV;
         mSupplies.at(i).mSupplyData->mAvailable = mSupplies.at(i).mLink->getEnabled() and (dV > mNetCapDvThreshold);
     }
@@ -51,6 +51,7 @@ class GunnsElectDistributedIfConfigData : public GunnsBasicLinkConfigData
         double                                        mConductance;       /**<    (1/ohm) trick_chkpnt_io(**) Output channel conductance of the internal voltage source. */
         double                                        mNetCapDvThreshold; /**<    (V)     trick_chkpnt_io(**) Network capacitance delta-voltage threshold. */
         std::vector<const GunnsElectConverterOutput*> mSupplies;          /**< ** (1)     trick_chkpnt_io(**) Pointers to the voltage supplies in the network. */
+        bool                                          mLagPrediction;     /**<    (1)     trick_chkpnt_io(**) Extrapolate the remote supply voltage across the loop lag in Demand mode. */
         /// @brief Default constructs this Distributed Bi-Directional Interface configuration data.
         GunnsElectDistributedIfConfigData(const std::string& name              = "",
                                           GunnsNodeList*     nodes             = 0,
@@ -114,6 +115,11 @@ struct GunnsElectDistributedIfSupplyData
 ///           between it and the network.  This contains a ConverterOutput and Input, for applying
 ///           the voltage source and power load effects on the network node, respectively, and these
 ///           are driven depending on the state of the interface.
+///
+///           The optional lag prediction extrapolates the remote supply voltage received in Demand
+///           mode across half the measured loop lag.  The power load in Supply mode is never
+///           extrapolated, since step changes in the remote loads would overshoot and could trip
+///           the local supplies.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsElectDistributedIf : public GunnsBasicLink
 {
@@ -156,6 +162,8 @@ class GunnsElectDistributedIf : public GunnsBasicLink
         unsigned int                                   mNumSupplies;        /**< *o (1) trick_chkpnt_io(**) Number of supplies. */
         unsigned int                                   mSupplyMonitorIndex; /**<    (1) trick_chkpnt_io(**) Index of the supply data to monitor. */
         GunnsElectDistributedIfSupplyData*             mSupplyMonitor;      /**<    (1) trick_chkpnt_io(**) Pointer to the monitored supply data, for visbility. */
+        bool                                           mLagPrediction;      /**<    (1) trick_chkpnt_io(**) Extrapolate the remote supply voltage across the loop lag in Demand mode. */
+        Distributed2WayBusLagPredictor                 mVoltagePredictor;   /**<    (1)                     Extrapolates the remote supply voltage across the loop lag. */
         /// @brief Validates initialization data.
         void validate() const;
         /// @brief Checks for valid implementation-specific port node assignment.
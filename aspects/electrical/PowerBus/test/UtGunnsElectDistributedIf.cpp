@@ -124,6 +124,7 @@ void UtGunnsElectDistributedIf::testConfig()
     CPPUNIT_ASSERT(tNetCapDvThresh == tConfigData->mNetCapDvThreshold);
     CPPUNIT_ASSERT(1               == tConfigData->mSupplies.size());
     CPPUNIT_ASSERT(&tSupply        == tConfigData->mSupplies.at(0));
+    CPPUNIT_ASSERT(false           == tConfigData->mLagPrediction);
 
     /// @test    Configuration data default construction.
     GunnsElectDistributedIfConfigData defaultConfig;
@@ -133,8 +134,10 @@ void UtGunnsElectDistributedIf::testConfig()
     CPPUNIT_ASSERT(0.0   == defaultConfig.mConductance);
     CPPUNIT_ASSERT(0.0   == defaultConfig.mNetCapDvThreshold);
     CPPUNIT_ASSERT(0     == defaultConfig.mSupplies.size());
+    CPPUNIT_ASSERT(false == defaultConfig.mLagPrediction);
 
     /// @test    Configuration data copy construction.
+    tConfigData->mLagPrediction = true;
     GunnsElectDistributedIfConfigData copyConfig(*tConfigData);
     CPPUNIT_ASSERT(tName           == copyConfig.mName);
     CPPUNIT_ASSERT(&tNodeList      == copyConfig.mNodeList);
@@ -143,6 +146,7 @@ void UtGunnsElectDistributedIf::testConfig()
     CPPUNIT_ASSERT(tNetCapDvThresh == copyConfig.mNetCapDvThreshold);
     CPPUNIT_ASSERT(1               == copyConfig.mSupplies.size());
     CPPUNIT_ASSERT(&tSupply        == copyConfig.mSupplies.at(0));
+    CPPUNIT_ASSERT(true            == copyConfig.mLagPrediction);
 
     UT_PASS;
 }
@@ -197,6 +201,7 @@ void UtGunnsElectDistributedIf::testConstruction()
     CPPUNIT_ASSERT(0     == tArticle->mNumSupplies);
     CPPUNIT_ASSERT(0     == tArticle->mSupplyMonitorIndex);
     CPPUNIT_ASSERT(0     == tArticle->mSupplyMonitor);
+    CPPUNIT_ASSERT(false == tArticle->mLagPrediction);
 
     /// @test    New/delete for code coverage.
     GunnsElectDistributedIf* testArticle = new GunnsElectDistributedIf();
@@ -234,6 +239,7 @@ void UtGunnsElectDistributedIf::testNominalInitialization()
     CPPUNIT_ASSERT(false           == tArticle->mMalfPowerLoad);
     CPPUNIT_ASSERT(false           == tArticle->mMalfVoltageSource);
     CPPUNIT_ASSERT(tNetCapDvThresh == tArticle->mNetCapDvThreshold);
+    CPPUNIT_ASSERT(false           == tArticle->mLagPrediction);
     CPPUNIT_ASSERT(1               == tArticle->mNumSupplies);
     CPPUNIT_ASSERT(1               == tArticle->mSupplies.size());
     CPPUNIT_ASSERT(false           == tArticle->mSupplies.at(0).mSupplyData->mAvailable);
@@ -370,6 +376,58 @@ void UtGunnsElectDistributedIf::testStep()
     UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for Electrical Distributed Interface Link lag prediction of the remote supply
+///           voltage.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsElectDistributedIf::testLagPrediction()
+{
+    UT_RESULT;
+
+    /// - Initialize default constructed test article with lag prediction.
+    tConfigData->mLagPrediction = true;
+    CPPUNIT_ASSERT_NO_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0));
+    CPPUNIT_ASSERT(true == tArticle->mLagPrediction);
+
+    /// @test    first remote supply voltage in Demand mode isn't extrapolated.
+    tInterface->forceDemandRole();
+    tInterface->mOutData.mFrameCount   = 43;
+    tInterface->mInData.mDemandMode    = false;
+    tInterface->mInData.mFrameCount    = 44;
+    tInterface->mInData.mFrameLoopback = 42;
+    tInterface->mInData.mSupplyVoltage = 115.0F;
+    tArticle->step(0.0);
+    CPPUNIT_ASSERT(true  == tInterface->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(2     == tInterface->mLoopLatency);
+    CPPUNIT_ASSERT(115.0 == tVoltageSource->mInputVoltage);
+
+    /// @test    remote supply voltage is extrapolated by half the loop latency, with the default
+    ///          rate filter gain of 0.5.
+    tInterface->mInData.mFrameCount    = 45;
+    tInterface->mInData.mFrameLoopback = 43;
+    tInterface->mInData.mSupplyVoltage = 117.0F;
+    tArticle->step(0.0);
+    CPPUNIT_ASSERT(2 == tInterface->mLoopLatency);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(118.0, tVoltageSource->mInputVoltage, DBL_EPSILON);
+
+    /// @test    predictor is reset by restart.
+    tArticle->restart();
+    CPPUNIT_ASSERT(0.0 == tArticle->mVoltagePredictor.getRate());
+
+    /// @test    remote supply voltage isn't extrapolated in Supply mode.
+    tInterface->forceSupplyRole();
+    tInterface->mInData.mFrameCount    = 46;
+    tInterface->mInData.mFrameLoopback = 44;
+    tInterface->mInData.mDemandMode    = true;
+    tInterface->mInData.mSupplyVoltage = 119.0F;
+    tArticle->step(0.0);
+    CPPUNIT_ASSERT(false == tInterface->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(119.0 == tVoltageSource->mInputVoltage);
+    CPPUNIT_ASSERT(0.0   == tArticle->mVoltagePredictor.getRate());
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Tests the Electrical Distributed Interface Link minorStep method.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
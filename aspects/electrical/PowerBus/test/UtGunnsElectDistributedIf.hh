@@ -87,6 +87,8 @@ class UtGunnsElectDistributedIf: public CppUnit::TestFixture
         void testRestart();
         /// @brief  Tests the step method.
         void testStep();
+        /// @brief  Tests the lag prediction option.
+        void testLagPrediction();
         /// @brief  Tests the minorStep method.
         void testMinorStep();
         /// @brief  Tests the getter and setter methods.
@@ -106,6 +108,7 @@ class UtGunnsElectDistributedIf: public CppUnit::TestFixture
         CPPUNIT_TEST(testInitializationErrors);
         CPPUNIT_TEST(testRestart);
         CPPUNIT_TEST(testStep);
+        CPPUNIT_TEST(testLagPrediction);
         CPPUNIT_TEST(testMinorStep);
         CPPUNIT_TEST(testAccessors);
         CPPUNIT_TEST(testConfirmSolutionAcceptable);
@@ -18,6 +18,8 @@ LIBRARY DEPENDENCY:
 #include "math/MsMath.hh"
 #include "GunnsElectPvArray.hh"
 #include "core/GunnsBasicNode.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 
@@ -382,6 +384,40 @@ void GunnsElectPvArray::restartModel()
     mIvCornerCurrent     = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           array outputs and the state of its sections and strings.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectPvArray::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicLink::snapshotState(snapshot);
+
+    snapshot.sync(mOpenCircuitSide);
+    snapshot.sync(mCommonStringsOutput);
+    snapshot.sync(mPercentInsolation);
+    snapshot.sync(mShortCircuitCurrent);
+    snapshot.sync(mOpenCircuitVoltage);
+    mMpp.snapshotState(snapshot);
+    mTerminal.snapshotState(snapshot);
+    snapshot.sync(mIvCornerVoltage);
+    snapshot.sync(mIvCornerCurrent);
+    for (unsigned int section = 0; section < mConfig.mNumSections; ++section) {
+        mSections[section].snapshotState(snapshot);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsElectPvArray.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsElectPvArray::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsElectPvArray);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step.
 ///
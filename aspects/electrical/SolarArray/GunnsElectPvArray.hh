@@ -172,6 +172,10 @@ class GunnsElectPvArray : public GunnsBasicLink
                         const GunnsElectPvSectionInputData& inputData,
                         std::vector<GunnsBasicLink*>&       networkLinks,
                         const int                           port0);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief Updates the link in run-time and first minor step in non-linear systems.
         virtual void step(const double dt);
         /// @brief Minor Step method for non-linear systems.
@@ -18,6 +18,8 @@ LIBRARY DEPENDENCY:
 #include "GunnsElectPvRegShunt.hh"
 #include "GunnsElectPvArray.hh"
 #include "core/GunnsSensorAnalogWrapper.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -417,6 +419,48 @@ void GunnsElectPvRegShunt::restartModel()
     mMaxRegCurrent     = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           regulator state, setpoint, trips and outputs.  The optional sensors are not included.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectPvRegShunt::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicLink::snapshotState(snapshot);
+
+    snapshot.sync(mMalfVoltageBiasFlag);
+    snapshot.sync(mMalfVoltageBiasValue);
+    mInputOverVoltTrip.snapshotState(snapshot);
+    mOutputUnderVoltTrip.snapshotState(snapshot);
+    snapshot.sync(mVoltageSetpoint);
+    snapshot.sync(mPowered);
+    snapshot.sync(mEnabled);
+    snapshot.sync(mMinOperatePower);
+    snapshot.sync(mResetTrips);
+    mTrips.snapshotState(snapshot);
+    snapshot.sync(mState);
+    snapshot.sync(mRegulatedVoltage);
+    snapshot.sync(mInputConductance);
+    snapshot.sync(mShuntPower);
+    snapshot.sync(mInputPower);
+    snapshot.sync(mOutputPower);
+    snapshot.sync(mWasteHeat);
+    snapshot.sync(mPvBulkPowerAvail);
+    snapshot.sync(mMaxRegCurrent);
+    snapshot.sync(mOffToRegOccurred);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsElectPvRegShunt.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsElectPvRegShunt::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsElectPvRegShunt);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Not used.
 ///
@@ -224,6 +224,10 @@ class GunnsElectPvRegShunt : public GunnsBasicLink
                         std::vector<GunnsBasicLink*>&         networkLinks,
                         const int                             port0,
                         const int                             port1);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief Default constructor.
         virtual void step(const double dt);
         /// @brief Minor Step method for non-linear systems.
@@ -6,10 +6,12 @@
            National Aeronautics and Space Administration.  All Rights Reserved.
 
 LIBRARY DEPENDENCY:
-  ((aspects/electrical/TripLogic/GunnsTripLogic.o))
+  ((aspects/electrical/TripLogic/GunnsTripLogic.o)
+   (core/GunnsSnapshot.o))
 */
 
 #include "GunnsElectPvRegTrips.hh"
+#include "core/GunnsSnapshot.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Default constructs this GUNNS Photovoltaic Regulator Trip Functions.
@@ -41,3 +43,17 @@ void GunnsElectPvRegTrips::resetTrips()
     mOutOverCurrent.resetTrip();
     mOutUnderVoltage.resetTrip();
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the state of all the trip logics in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectPvRegTrips::snapshotState(GunnsSnapshot& snapshot)
+{
+    mInOverVoltage.snapshotState(snapshot);
+    mInOverCurrent.snapshotState(snapshot);
+    mOutOverVoltage.snapshotState(snapshot);
+    mOutOverCurrent.snapshotState(snapshot);
+    mOutUnderVoltage.snapshotState(snapshot);
+}
@@ -52,6 +52,8 @@ class GunnsElectPvRegTrips
         virtual ~GunnsElectPvRegTrips();
         /// @brief  Resets the tripped state for all trip logics.
         void resetTrips();
+        /// @brief  Saves or restores the trip logic states in a network snapshot.
+        void snapshotState(GunnsSnapshot& snapshot);
         /// @brief  Returns whether any trip logics are currently tripped.
         bool isTripped() const;
 
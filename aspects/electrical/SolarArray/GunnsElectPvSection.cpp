@@ -10,12 +10,14 @@ LIBRARY DEPENDENCY:
    (GunnsElectPvString.o)
    (GunnsElectPvString2.o)
    (software/exceptions/TsInitializationException.o)
+   (core/GunnsSnapshot.o)
   )
 */
 
 #include "math/MsMath.hh"
 #include "GunnsElectPvSection.hh"
 #include "core/GunnsBasicNode.hh"
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -314,6 +316,26 @@ void GunnsElectPvSection::initialize(const std::string&                  name,
     mTerminalPower     = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the environment inputs and outputs of this Photovoltaic Section, and
+///           the state of its strings, in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectPvSection::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mInput.mSourceFluxMagnitude);
+    snapshot.sync(mInput.mSourceAngle);
+    snapshot.sync(mInput.mSourceExposedFraction);
+    snapshot.sync(mInput.mTemperature);
+    mStringsInput.snapshotState(snapshot);
+    snapshot.sync(mPercentInsolation);
+    snapshot.sync(mTerminalPower);
+    for (unsigned int string = 0; string < mNumStrings; ++string) {
+        mStrings[string].snapshotState(snapshot);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @throws   TsInitializationException
 ///
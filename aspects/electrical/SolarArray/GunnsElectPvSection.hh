@@ -166,6 +166,8 @@ class GunnsElectPvSection
         void   setSourceExposedFraction(const double sourceExposedFraction);
         /// @brief Sets this Photovoltaic Section's temperature input data.
         void   setTemperature(const double temperature);
+        /// @brief Saves or restores the section state and its strings in a network snapshot.
+        void   snapshotState(GunnsSnapshot& snapshot);
 
     protected:
         std::string                          mName;              /**<    (1) trick_chkpnt_io(**) Instance name for H&S messages. */
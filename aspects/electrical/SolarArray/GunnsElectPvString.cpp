@@ -9,12 +9,14 @@ LIBRARY DEPENDENCY:
   (
    (software/exceptions/TsInitializationException.o)
    (math/UnitConversion.o)
+   (core/GunnsSnapshot.o)
   )
 */
 
 #include "math/MsMath.hh"
 #include "GunnsElectPvString.hh"
 #include "core/GunnsBasicNode.hh"
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -256,6 +258,201 @@ void GunnsElectPvCellEquivCircuit::clear()
     mSurfaceArea = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Photovoltaic Cell I-V Curve Table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsElectPvIvTable::GunnsElectPvIvTable()
+    :
+    mName(),
+    mNumPoints(0),
+    mCurrents(0),
+    mVoltageStep(0.0),
+    mVoc(0.0),
+    mTemperature(0.0),
+    mPhotoFlux(0.0),
+    mDegradation(0.0),
+    mValid(false)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Photovoltaic Cell I-V Curve Table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsElectPvIvTable::~GunnsElectPvIvTable()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes the allocated table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectPvIvTable::cleanup()
+{
+    TS_DELETE_ARRAY(mCurrents);
+    mNumPoints = 0;
+    mValid     = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] numPoints (--) Number of points in the table.
+/// @param[in] name      (--) Instance name for memory allocation and H&S messages.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Allocates the table with the given number of points, which must be at least 2 to span
+///           the curve from short-circuit to open-circuit.  The table isn't valid for use until it
+///           has been built.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectPvIvTable::initialize(const unsigned int numPoints, const std::string& name)
+{
+    mName = name;
+    cleanup();
+
+    /// - Throw an exception on # points < 2.
+    if (numPoints < 2) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "number of I-V table points < 2.");
+    }
+
+    mNumPoints = numPoints;
+    TS_NEW_PRIM_ARRAY_EXT(mCurrents, static_cast<int>(mNumPoints), double, mName + ".mCurrents");
+    for (unsigned int i = 0; i < mNumPoints; ++i) {
+        mCurrents[i] = 0.0;
+    }
+    mVoltageStep = 0.0;
+    mVoc         = 0.0;
+    mTemperature = 0.0;
+    mPhotoFlux   = 0.0;
+    mDegradation = 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] cell        (--)   Pointer to the cell equivalent circuit to tabulate.
+/// @param[in] temperature (K)    Cell temperature the cell was updated for.
+/// @param[in] photoFlux   (W/m2) Cell photo flux the cell was updated for.
+/// @param[in] degradation (--)   Fraction of cell degradation the cell was updated for.
+///
+/// @throws   TsOutOfBoundsException
+///
+/// @details  Tabulates the given cell's current at evenly spaced voltages from zero to its
+///           open-circuit voltage, and stores the conditions the table is valid for.  Each point's
+///           current is limited to be no greater than the previous point's, to keep the table
+///           monotonic despite the approximation error in the Lambert W solutions.  A cell with no
+///           open-circuit voltage, such as one in the dark, results in a table of zero current.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectPvIvTable::build(const GunnsElectPvCellEquivCircuit* cell, const double temperature,
+                                const double photoFlux, const double degradation)
+{
+    mVoc         = std::max(0.0, cell->mVoc);
+    mVoltageStep = mVoc / (mNumPoints - 1);
+    mCurrents[0] = (mVoc > 0.0) ? cell->computeCurrent(0.0) : 0.0;
+    for (unsigned int i = 1; i < mNumPoints - 1; ++i) {
+        mCurrents[i] = std::min(mCurrents[i-1], cell->computeCurrent(i * mVoltageStep));
+    }
+    mCurrents[mNumPoints - 1] = 0.0;
+    mTemperature = temperature;
+    mPhotoFlux   = photoFlux;
+    mDegradation = degradation;
+    mValid       = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] temperature          (K)    Current cell temperature.
+/// @param[in] photoFlux            (W/m2) Current cell photo flux.
+/// @param[in] degradation          (--)   Current fraction of cell degradation.
+/// @param[in] temperatureTolerance (K)    Allowed change in temperature before rebuilding.
+/// @param[in] fluxTolerance        (W/m2) Allowed change in photo flux before rebuilding.
+///
+/// @returns  bool  (--)  True if the table is invalid or its conditions are out of tolerance.
+///
+/// @details  Returns whether the table needs to be rebuilt for the given conditions.  Any change in
+///           degradation requires a rebuild, since it is driven by a malfunction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsElectPvIvTable::needsRebuild(const double temperature,
+                                       const double photoFlux,
+                                       const double degradation,
+                                       const double temperatureTolerance,
+                                       const double fluxTolerance) const
+{
+    return (not mValid)
+        or (std::fabs(temperature - mTemperature) > temperatureTolerance)
+        or (std::fabs(photoFlux   - mPhotoFlux)   > fluxTolerance)
+        or (degradation != mDegradation);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] voltage (V) Cell terminal voltage to interpolate the current for.
+///
+/// @returns  double (amp) Cell terminal current.
+///
+/// @details  Returns the cell current at the given voltage, interpolated from the table.  Since the
+///           table points are evenly spaced in voltage, the table segment is found directly.  For
+///           voltages at or below zero or at or above the open-circuit voltage, returns the
+///           short-circuit current and zero current, respectively, like the cell model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsElectPvIvTable::computeCurrent(const double voltage) const
+{
+    double current = 0.0;
+    if (voltage <= DBL_EPSILON) {
+        current = mCurrents[0];
+    } else if (voltage < mVoc) {
+        const double       x = voltage / mVoltageStep;
+        const unsigned int i = std::min(static_cast<unsigned int>(x), mNumPoints - 2);
+        current = mCurrents[i] + (x - i) * (mCurrents[i+1] - mCurrents[i]);
+    }
+    return current;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] current (amp) Cell terminal current to interpolate the voltage for.
+///
+/// @returns  double (V) Cell terminal voltage.
+///
+/// @details  Returns the cell voltage at the given current, interpolated from the table.  The table
+///           segment containing the current is found by bisection, since current is non-increasing
+///           with voltage.  For currents at or below zero or at or above the short-circuit current,
+///           returns the open-circuit voltage and zero voltage, respectively, like the cell model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsElectPvIvTable::computeVoltage(const double current) const
+{
+    double voltage = 0.0;
+    if (current <= DBL_EPSILON) {
+        voltage = mVoc;
+    } else if (current < mCurrents[0]) {
+        /// - Find the segment [lo, hi] with mCurrents[lo] > current >= mCurrents[hi].
+        unsigned int lo = 0;
+        unsigned int hi = mNumPoints - 1;
+        while (hi - lo > 1) {
+            const unsigned int mid = (lo + hi) / 2;
+            if (mCurrents[mid] > current) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        voltage = mVoltageStep * (lo + (mCurrents[lo] - current) / (mCurrents[lo] - mCurrents[hi]));
+    }
+    return voltage;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the tabulated currents and the conditions the table was built for in
+///           the given snapshot, so that a restored string continues with the same table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectPvIvTable::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mCurrents, static_cast<int>(mNumPoints));
+    snapshot.sync(mVoltageStep);
+    snapshot.sync(mVoc);
+    snapshot.sync(mTemperature);
+    snapshot.sync(mPhotoFlux);
+    snapshot.sync(mDegradation);
+    snapshot.sync(mValid);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Default constructs this Photovoltaic String Model Load State.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -301,6 +498,20 @@ void GunnsElectPvLoadState::clear()
     mVoltage     = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the attributes of this Photovoltaic String Model Load State in the
+///           given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectPvLoadState::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mConductance);
+    snapshot.sync(mCurrent);
+    snapshot.sync(mPower);
+    snapshot.sync(mVoltage);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Default constructs this Photovoltaic String model config data.  This only exists to
 ///           avoid ambiguity with the overloaded custom constructors below.  This shouldn't
@@ -313,7 +524,10 @@ GunnsElectPvStringConfigData::GunnsElectPvStringConfigData()
     mBypassDiodeVoltageDrop(0.0),
     mBypassDiodeInterval(0),
     mNumCells(0),
-    mCellConfig()
+    mCellConfig(),
+    mIvTableNumPoints(0),
+    mIvTableFluxTolerance(0.0),
+    mIvTableTempTolerance(0.0)
 {
     // nothing to do
 }
@@ -360,7 +574,10 @@ GunnsElectPvStringConfigData::GunnsElectPvStringConfigData(
                 cellOpenCircuitVoltage,
                 cellRefTemperature,
                 cellTemperatureVoltageCoeff,
-                cellTemperatureCurrentCoeff)
+                cellTemperatureCurrentCoeff),
+    mIvTableNumPoints(0),
+    mIvTableFluxTolerance(0.0),
+    mIvTableTempTolerance(0.0)
 {
     // nothing to do
 }
@@ -413,7 +630,10 @@ GunnsElectPvStringConfigData::GunnsElectPvStringConfigData(
                 cellCoeffDVocDT,
                 cellCoeffDIscDT,
                 cellIdeality,
-                cellArea)
+                cellArea),
+    mIvTableNumPoints(0),
+    mIvTableFluxTolerance(0.0),
+    mIvTableTempTolerance(0.0)
 {
     // nothing to do
 }
@@ -439,6 +659,9 @@ GunnsElectPvStringConfigData& GunnsElectPvStringConfigData::operator =(const Gun
         mBypassDiodeInterval      = that.mBypassDiodeInterval;
         mNumCells                 = that.mNumCells;
         mCellConfig               = that.mCellConfig;
+        mIvTableNumPoints         = that.mIvTableNumPoints;
+        mIvTableFluxTolerance     = that.mIvTableFluxTolerance;
+        mIvTableTempTolerance     = that.mIvTableTempTolerance;
     }
     return *this;
 }
@@ -545,6 +768,29 @@ double GunnsElectPvStringInputData::rampPhotoFlux(const double time, const doubl
     return outValue + rampFunction * (mMalfPhotoFluxMagnitude - outValue);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the inputs, malfunctions and malfunction ramp state of this
+///           Photovoltaic String Model input data in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectPvStringInputData::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mPhotoFlux);
+    snapshot.sync(mSourceExposedFraction);
+    snapshot.sync(mTemperature);
+    snapshot.sync(mMalfPhotoFluxFlag);
+    snapshot.sync(mMalfPhotoFluxMagnitude);
+    snapshot.sync(mMalfPhotoFluxDuration);
+    snapshot.sync(mMalfPhotoFluxRampTime);
+    snapshot.sync(mMalfExposedFractionFlag);
+    snapshot.sync(mMalfExposedFractionValue);
+    snapshot.sync(mMalfTemperatureFlag);
+    snapshot.sync(mMalfTemperatureValue);
+    snapshot.sync(mPhotoFluxElapsedTime);
+    snapshot.sync(mPhotoFluxStartMagnitude);
+}
+
 /// @details  This value is used as the ratio between forward and reverse bias conductance of the
 ///           modeled diodes.  This value is a trade between creating an ideal enough conductance
 ///           (high ratio) and avoiding truncation between conductances of differing magnitudes in
@@ -573,7 +819,8 @@ GunnsElectPvString::GunnsElectPvString()
     mNumBypassedGroups(0),
     mNumActiveCells(0),
     mShunted(false),
-    mRefCell(0)
+    mRefCell(0),
+    mIvTable()
 {
     // nothing to do
 }
@@ -605,7 +852,8 @@ GunnsElectPvString::GunnsElectPvString(const GunnsElectPvStringConfigData* confi
     mNumBypassedGroups(0),
     mNumActiveCells(0),
     mShunted(false),
-    mRefCell(0)
+    mRefCell(0),
+    mIvTable()
 {
     // nothing to do
 }
@@ -800,6 +1048,27 @@ void GunnsElectPvString::update()
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the malfunctions, shunted flag, terminal outputs and I-V curve table
+///           of this Photovoltaic String in the given snapshot.  The equivalent circuit properties
+///           are recomputed from the inputs on every update, so they are not saved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectPvString::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mMalfCellGroupFlag);
+    snapshot.sync(mMalfCellGroupValue);
+    snapshot.sync(mMalfDegradeFlag);
+    snapshot.sync(mMalfDegradeValue);
+    snapshot.sync(mShortCircuitCurrent);
+    snapshot.sync(mOpenCircuitVoltage);
+    mMpp.snapshotState(snapshot);
+    mTerminal.snapshotState(snapshot);
+    snapshot.sync(mShunted);
+    mIvTable.snapshotState(snapshot);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Determines the number of cell groups that are bypassed.  Since all cells in a group
 ///           are in series, if any one cell is either shaded or failed, it blocks current through
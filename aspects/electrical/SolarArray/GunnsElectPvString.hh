@@ -34,6 +34,8 @@ PROGRAMMERS:
 #include <string>
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 
+class GunnsSnapshot;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    GUNNS Photovoltaic Cell Configuration Data.
 ///
@@ -145,6 +147,72 @@ class GunnsElectPvCellEquivCircuit
         GunnsElectPvCellEquivCircuit(const GunnsElectPvCellEquivCircuit& that);
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Photovoltaic Cell I-V Curve Table.
+///
+/// @details  This tabulates the current of an equivalent circuit cell model at evenly spaced
+///           voltages between zero and the cell open-circuit voltage, for the cell's temperature and
+///           lighting conditions at the time the table is built.  Current and voltage are then
+///           interpolated linearly from the table, which is much faster than solving the cell's
+///           equivalent circuit with the Lambert W function.  The tabulated currents are limited to
+///           be non-increasing with voltage, so that the interpolated curve is monotonic and can be
+///           inverted to find voltage at a given current.
+///
+///           The table records the temperature, photo flux and degradation it was built for, so that
+///           the owner can decide when the conditions have moved far enough to rebuild it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsElectPvIvTable
+{
+    public:
+        /// @brief Default constructs this Photovoltaic Cell I-V Curve Table.
+        GunnsElectPvIvTable();
+        /// @brief Default destructs this Photovoltaic Cell I-V Curve Table.
+        virtual ~GunnsElectPvIvTable();
+        /// @brief Initializes this Photovoltaic Cell I-V Curve Table.
+        void initialize(const unsigned int numPoints, const std::string& name);
+        /// @brief Builds the table from the given cell at the given conditions.
+        void build(const GunnsElectPvCellEquivCircuit* cell, const double temperature,
+                   const double photoFlux, const double degradation);
+        /// @brief Marks the table as needing to be rebuilt.
+        void invalidate();
+        /// @brief Returns whether the table is built and still valid.
+        bool isValid() const;
+        /// @brief Returns whether the given conditions differ from the table's by more than tolerance.
+        bool needsRebuild(const double temperature, const double photoFlux, const double degradation,
+                          const double temperatureTolerance, const double fluxTolerance) const;
+        /// @brief Returns the interpolated cell current at the given cell voltage.
+        double computeCurrent(const double voltage) const;
+        /// @brief Returns the interpolated cell voltage at the given cell current.
+        double computeVoltage(const double current) const;
+        /// @brief Returns the number of points in the table.
+        unsigned int getNumPoints() const;
+        /// @brief Returns the cell voltage at the given table point.
+        double getVoltage(const unsigned int point) const;
+        /// @brief Returns the cell current at the given table point.
+        double getCurrent(const unsigned int point) const;
+        /// @brief Saves or restores the table in a network snapshot.
+        void snapshotState(GunnsSnapshot& snapshot);
+
+    protected:
+        std::string  mName;        /**<    (1)    trick_chkpnt_io(**) Instance name for H&S messages. */
+        unsigned int mNumPoints;   /**<    (1)    trick_chkpnt_io(**) Number of points in the table. */
+        double*      mCurrents;    /**< ** (amp)  trick_chkpnt_io(**) Cell current at each table point. */
+        double       mVoltageStep; /**<    (V)    trick_chkpnt_io(**) Cell voltage step between table points. */
+        double       mVoc;         /**<    (V)    trick_chkpnt_io(**) Cell open-circuit voltage, at the last table point. */
+        double       mTemperature; /**<    (K)    trick_chkpnt_io(**) Cell temperature the table was built for. */
+        double       mPhotoFlux;   /**<    (W/m2) trick_chkpnt_io(**) Cell photo flux the table was built for. */
+        double       mDegradation; /**<    (1)    trick_chkpnt_io(**) Cell degradation the table was built for. */
+        bool         mValid;       /**<    (1)    trick_chkpnt_io(**) The table is built and valid for use. */
+        /// @brief Deletes the allocated table.
+        void cleanup();
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsElectPvIvTable(const GunnsElectPvIvTable& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsElectPvIvTable& operator =(const GunnsElectPvIvTable& that);
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    GUNNS Photovoltaic String Model Load State.
 ///
@@ -165,6 +233,8 @@ class GunnsElectPvLoadState
         GunnsElectPvLoadState& operator =(const GunnsElectPvLoadState& that);
         /// @brief Zeroes the attributes of this Photovoltaic String Model Load State.
         void clear();
+        /// @brief Saves or restores this load state in a network snapshot.
+        void snapshotState(GunnsSnapshot& snapshot);
 
     private:
         /// @brief Copy constructor unavailable since declared private and not implemented.
@@ -184,6 +254,9 @@ class GunnsElectPvStringConfigData
         unsigned int               mBypassDiodeInterval;      /**< (1) trick_chkpnt_io(**) Number of cells per bypass diode. */
         unsigned int               mNumCells;                 /**< (1) trick_chkpnt_io(**) Number of cells in this string. */
         GunnsElectPvCellConfigData mCellConfig;               /**< (1) trick_chkpnt_io(**) Config data for the cells. */
+        unsigned int               mIvTableNumPoints;         /**< (1) trick_chkpnt_io(**) Optional number of points in the version 2 cell I-V curve table, zero disables the table. */
+        double                     mIvTableFluxTolerance;     /**< (W/m2) trick_chkpnt_io(**) Change in photo flux that causes the I-V curve table to be rebuilt. */
+        double                     mIvTableTempTolerance;     /**< (K) trick_chkpnt_io(**) Change in temperature that causes the I-V curve table to be rebuilt. */
         /// @brief Default constructs this Photovoltaic String Model config data.
         GunnsElectPvStringConfigData();
         /// @brief Constructs this Photovoltaic String Model config data for an original string model version.
@@ -258,6 +331,8 @@ class GunnsElectPvStringInputData
         void setMalfExposedFraction(const bool flag = false, const double value = 0.0);
         /// @brief Sets and clears the temperature malfunction controls.
         void setMalfTemperature(const bool flag = false, const double value = 0.0);
+        /// @brief Saves or restores this input data and malfunctions in a network snapshot.
+        void snapshotState(GunnsSnapshot& snapshot);
 
     protected:
         double mPhotoFluxElapsedTime;     /**< (s)    Elapsed time of the photo power flux malfunction. */
@@ -339,6 +414,10 @@ class GunnsElectPvString
         const GunnsElectPvLoadState& getTerminal() const;
         /// @brief Returns current output of the string at the given terminal voltage.
         virtual double predictCurrentAtVoltage(const double voltage) const;
+        /// @brief Returns the equivalent cell I-V curve table.
+        const GunnsElectPvIvTable& getIvTable() const;
+        /// @brief Saves or restores the string state and malfunctions in a network snapshot.
+        void snapshotState(GunnsSnapshot& snapshot);
 
     protected:
         std::string                         mName;                /**<    (1)    trick_chkpnt_io(**) Instance name for H&S messages. */
@@ -355,6 +434,7 @@ class GunnsElectPvString
         unsigned int                        mNumActiveCells;      /**<    (1)    trick_chkpnt_io(**) Number of cells that are not bypassed. */
         bool                                mShunted;             /**<    (1)    trick_chkpnt_io(**) String is currently shunted. */
         GunnsElectPvCellEquivCircuit*       mRefCell;             /**<    (1)    trick_chkpnt_io(**) Reference cell properties. */
+        GunnsElectPvIvTable                 mIvTable;             /**<    (1)    trick_chkpnt_io(**) Optional equivalent cell I-V curve table, used by derived string models. */
         /// @brief Validates the initialization of this Photovoltaic String Utility.
         virtual void validate() const;
         /// @brief Bypasses cell groups based on shading and malfunction.
@@ -441,6 +521,58 @@ inline double GunnsElectPvCellEquivCircuit::computeVoltage(const double current
     return 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Marks the table as invalid, so that it will be rebuilt before its next use.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsElectPvIvTable::invalidate()
+{
+    mValid = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if the table is built and valid for use.
+///
+/// @details  Returns the mValid attribute.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsElectPvIvTable::isValid() const
+{
+    return mValid;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  The number of points in the table.
+///
+/// @details  Returns the mNumPoints attribute.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned int GunnsElectPvIvTable::getNumPoints() const
+{
+    return mNumPoints;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] point (--) Index of the table point, must be less than the number of points.
+///
+/// @returns  double  (V)  The cell voltage at the given table point.
+///
+/// @details  Returns the cell voltage at the given table point, from the constant voltage step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsElectPvIvTable::getVoltage(const unsigned int point) const
+{
+    return point * mVoltageStep;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] point (--) Index of the table point, must be less than the number of points.
+///
+/// @returns  double  (amp)  The cell current at the given table point.
+///
+/// @details  Returns the cell current at the given table point.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsElectPvIvTable::getCurrent(const unsigned int point) const
+{
+    return mCurrents[point];
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] flag      (--)   Malfunction activation flag.
 /// @param[in] magnitude (W/m2) Malfunction magnitude.
@@ -564,4 +696,14 @@ inline const GunnsElectPvLoadState& GunnsElectPvString::getTerminal() const
     return mTerminal;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  GunnsElectPvIvTable&  (--)  Reference to the cell I-V curve table.
+///
+/// @details  Returns a const reference to the mIvTable attribute.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const GunnsElectPvIvTable& GunnsElectPvString::getIvTable() const
+{
+    return mIvTable;
+}
+
 #endif
@@ -370,6 +370,11 @@ void GunnsElectPvString2::initialize(const std::string& name)
     mRefCell->initialize(&mConfig->mCellConfig, mName + ".mRefCell");
     mEqProps->initialize(&mConfig->mCellConfig, mName + ".mEqProps");
 
+    /// - Allocate the optional I-V curve table.  It is built on the first update.
+    if (mConfig->mIvTableNumPoints > 0) {
+        mIvTable.initialize(mConfig->mIvTableNumPoints, mName + ".mIvTable");
+    }
+
     /// - Compute and validate the initial state.
     mEqProps->update(mRefCell, mInput->mTemperature, mInput->mPhotoFlux);
     mMpp.clear();
@@ -453,6 +458,24 @@ void GunnsElectPvString2::validate() const
                     "bypass diode interval not evenly divisible in number of cells.");
     }
 
+    /// - Throw an exception on I-V table # points == 1.
+    if (1 == mConfig->mIvTableNumPoints) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "number of I-V table points == 1.");
+    }
+
+    /// - Throw an exception on I-V table photo flux tolerance < 0.
+    if (mConfig->mIvTableFluxTolerance < 0.0) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "I-V table photo flux tolerance < 0.");
+    }
+
+    /// - Throw an exception on I-V table temperature tolerance < 0.
+    if (mConfig->mIvTableTempTolerance < 0.0) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "I-V table temperature tolerance < 0.");
+    }
+
     /// - Throw an exception on photo flux magnitude < 0.
     if (mInput->mPhotoFlux < 0.0) {
         GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
@@ -477,6 +500,12 @@ void GunnsElectPvString2::validate() const
 ///           properties, based on the current input conditions such as lighting and temperature.
 ///           These states do not depend on the current loading of the string.  Effects of loading
 ///           are calculated in other functions.
+///
+///           When the I-V curve table is used, the equivalent circuit properties and the table are
+///           only updated when the temperature, photo flux or degradation have changed beyond the
+///           configured tolerances since the table was last built.  Otherwise the string keeps the
+///           cell properties the table was built for, so its MPP and open-circuit outputs stay
+///           consistent with the table.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsElectPvString2::update()
 {
@@ -489,16 +518,24 @@ void GunnsElectPvString2::update()
     /// - Skip updating the model, and instead zero the string outputs, if there are no active
     ///   cells or if temperature is near zero.
     if (mNumActiveCells > 0 and mInput->mTemperature > 1.0) {
+        double degradation = 0.0;
         if (mMalfDegradeFlag) {
-            mEqProps->update(mRefCell, mInput->mTemperature, mInput->mPhotoFlux, MsMath::limitRange(0.0, mMalfDegradeValue, 1.0));
-        } else {
-            mEqProps->update(mRefCell, mInput->mTemperature, mInput->mPhotoFlux);
+            degradation = MsMath::limitRange(0.0, mMalfDegradeValue, 1.0);
+        }
+        if (0 == mIvTable.getNumPoints()) {
+            mEqProps->update(mRefCell, mInput->mTemperature, mInput->mPhotoFlux, degradation);
+        } else if (mIvTable.needsRebuild(mInput->mTemperature, mInput->mPhotoFlux, degradation,
+                                         mConfig->mIvTableTempTolerance,
+                                         mConfig->mIvTableFluxTolerance)) {
+            mEqProps->update(mRefCell, mInput->mTemperature, mInput->mPhotoFlux, degradation);
+            mIvTable.build(mEqProps, mInput->mTemperature, mInput->mPhotoFlux, degradation);
         }
         updateMpp();
         mShortCircuitCurrent = mEqProps->mIsc;
         mOpenCircuitVoltage  = std::max(0.0, mEqProps->mVoc * mNumActiveCells - mSeriesVoltageDrop);
     } else {
         mEqProps->clear();
+        mIvTable.invalidate();
         mMpp.clear();
         mShortCircuitCurrent = 0.0;
         mOpenCircuitVoltage  = 0.0;
@@ -525,8 +562,9 @@ void GunnsElectPvString2::updateMpp()
 /// @param[in]  shortSide  (--)  True uses the solution on the short-circuit side of maximum power.
 ///
 /// @details  This loads the string at either the MPP, or zero power at Isc or Voc, depending on the
-///           the given power output.  This version 2 string model does not have the ability to
-///           load the string at arbitrary power loads, only at either MPP or zero.
+///           the given power output.  Without the I-V curve table, this version 2 string model does
+///           not have the ability to load the string at arbitrary power loads, only at either MPP or
+///           zero.  With the table, powers less than MPP are loaded on the given side of the MPP.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsElectPvString2::loadAtPower(const double power, const bool shortSide)
 {
@@ -541,11 +579,50 @@ void GunnsElectPvString2::loadAtPower(const double power, const bool shortSide)
             mTerminal.mCurrent     = 0.0;
             mTerminal.mConductance = 0.0;
         }
+    } else if (mIvTable.isValid() and power < mMpp.mPower) {
+        loadAtPowerFromTable(power, shortSide);
     } else {
         loadAtMpp();
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  power      (W)   The output power load to apply, between zero and MPP power.
+/// @param[in]  shortSide  (--)  True uses the solution on the short-circuit side of maximum power.
+///
+/// @details  This loads the string at the given power on the given side of MPP, using the I-V curve
+///           table.  Starting from the short-circuit or open-circuit end of the table, this steps
+///           towards MPP until the string power at a table point reaches the given power, then
+///           interpolates the string voltage between that point and the previous one.  String power
+///           is monotonic between either end and the MPP, so this interpolation is also monotonic.
+///           The terminal current is then found from the power and voltage so that the terminal
+///           power is exactly as given.  If the table points never reach the given power because
+///           of interpolation error near the MPP, then the string is loaded at MPP.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectPvString2::loadAtPowerFromTable(const double power, const bool shortSide)
+{
+    const unsigned int numPoints = mIvTable.getNumPoints();
+    const int          step      = shortSide ? 1 : -1;
+    int                point     = shortSide ? 0 : numPoints - 1;
+    double             prevV     = 0.0;
+    double             prevP     = 0.0;
+    for (unsigned int i = 0; i < numPoints; ++i, point += step) {
+        const double v = std::max(0.0, mIvTable.getVoltage(point) * mNumActiveCells
+                                     - mSeriesVoltageDrop);
+        const double p = v * mIvTable.getCurrent(point);
+        if (p >= power and i > 0) {
+            mTerminal.mVoltage     = prevV + (v - prevV) * (power - prevP) / (p - prevP);
+            mTerminal.mPower       = power;
+            mTerminal.mCurrent     = power / std::max(DBL_EPSILON, mTerminal.mVoltage);
+            mTerminal.mConductance = mTerminal.mCurrent / std::max(DBL_EPSILON, mTerminal.mVoltage);
+            return;
+        }
+        prevV = v;
+        prevP = p;
+    }
+    loadAtMpp();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  v1  (V)  The terminal voltage to calculate outputs for.
 ///
@@ -599,7 +676,8 @@ void GunnsElectPvString2::loadAtConductance(const double g)
 ///          result or actually load the string.  Voltage is given for the entire string, but we can
 ///          only compute current for an equivalent cell, so we work out what the individual cell
 ///          voltage is by adding the series diode voltage drops and dividing by the number of
-///          active cells.
+///          active cells.  The cell current is interpolated from the I-V curve table when it is
+///          valid.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 double GunnsElectPvString2::predictCurrentAtVoltage(const double v1) const
 {
@@ -607,7 +685,11 @@ double GunnsElectPvString2::predictCurrentAtVoltage(const double v1) const
 
     if (mNumActiveCells > 0) {
         const double cellVoltage = (v1 + mSeriesVoltageDrop) / mNumActiveCells;
-        current = mEqProps->computeCurrent(cellVoltage);
+        if (mIvTable.isValid()) {
+            current = mIvTable.computeCurrent(cellVoltage);
+        } else {
+            current = mEqProps->computeCurrent(cellVoltage);
+        }
     }
     return current;
 }
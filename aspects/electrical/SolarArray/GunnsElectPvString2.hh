@@ -90,6 +90,17 @@ class GunnsElectPvCellEquivCircuit2 : public GunnsElectPvCellEquivCircuit
 ///           - Although this has improved realism when loaded at a given voltage, this model has
 ///             limited ability to load at arbitrary power loads or conductances, and is only suited
 ///             for use with shunting and MPP tracking regulators.
+///
+///           Optionally, the equivalent cell I-V curve can be tabulated, by configuring the number
+///           of table points in the string config data.  Then the cell model and its table are only
+///           updated when the string temperature or photo flux have changed by more than the
+///           configured tolerances since the table was last built, and loading the string at
+///           voltage or power interpolates the table rather than solving the cell equations.  This
+///           saves a lot of compute time in arrays with many strings, at the expense of some
+///           accuracy.  With the table, the string can also be loaded at arbitrary power.
+///
+/// @note     This class must not add data members to the base class, since the sections allocate
+///           their strings as arrays of this type and index them as the base type.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsElectPvString2 : public GunnsElectPvString
 {
@@ -120,6 +131,8 @@ class GunnsElectPvString2 : public GunnsElectPvString
         virtual void validate() const;
         /// @brief Computes the Maximum Power Point parameters.
         void updateMpp();
+        /// @brief Loads the string at the given power on the given side of MPP, from the table.
+        void loadAtPowerFromTable(const double power, const bool shortSide);
 
     private:
         /// @brief Copy constructor unavailable since declared private and not implemented.
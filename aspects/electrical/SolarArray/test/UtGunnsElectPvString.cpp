@@ -260,10 +260,19 @@ void UtGunnsElectPvString::testConfig()
     CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, defaultConfig.mCellConfig.mSurfaceArea,  0.0);
     CPPUNIT_ASSERT(0 == defaultConfig.mBypassDiodeInterval);
     CPPUNIT_ASSERT(0 == defaultConfig.mNumCells);
+    CPPUNIT_ASSERT(0 == defaultConfig.mIvTableNumPoints);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, defaultConfig.mIvTableFluxTolerance,     0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, defaultConfig.mIvTableTempTolerance,     0.0);
 
     /// @test    Configuration data assignment operator.
+    tConfigData->mIvTableNumPoints     = 11;
+    tConfigData->mIvTableFluxTolerance = 1.0;
+    tConfigData->mIvTableTempTolerance = 0.1;
     GunnsElectPvStringConfigData assignConfig;
     assignConfig = *tConfigData;
+    CPPUNIT_ASSERT(11 == assignConfig.mIvTableNumPoints);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, assignConfig.mIvTableFluxTolerance, 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.1, assignConfig.mIvTableTempTolerance, 0.0);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(tBlockingDiodeVoltageDrop, assignConfig.mBlockingDiodeVoltageDrop, 0.0);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(tBypassDiodeVoltageDrop,   assignConfig.mBypassDiodeVoltageDrop,   0.0);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(tCellSurfaceArea,          assignConfig.mCellConfig.mSurfaceArea,  0.0);
@@ -763,6 +763,21 @@ void UtGunnsElectPvString2::testInitializationErrors()
     CPPUNIT_ASSERT_THROW(tArticle->initialize(tName), TsInitializationException);
     tConfigData->mBypassDiodeInterval = tBypassDiodeInterval;
 
+    /// @test    Exception thrown for bad I-V table # points.
+    tConfigData->mIvTableNumPoints = 1;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName), TsInitializationException);
+    tConfigData->mIvTableNumPoints = 0;
+
+    /// @test    Exception thrown for bad I-V table photo flux tolerance.
+    tConfigData->mIvTableFluxTolerance = -0.01;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName), TsInitializationException);
+    tConfigData->mIvTableFluxTolerance = 0.0;
+
+    /// @test    Exception thrown for bad I-V table temperature tolerance.
+    tConfigData->mIvTableTempTolerance = -0.01;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tName), TsInitializationException);
+    tConfigData->mIvTableTempTolerance = 0.0;
+
     /// @test    Exception thrown for missing input data.
     tArticle->mInput = 0;
     CPPUNIT_ASSERT_THROW(tArticle->initialize(tName), TsInitializationException);
@@ -1104,6 +1119,134 @@ void UtGunnsElectPvString2::testLoadAtVoltage()
     UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the optional I-V curve table, its rebuild tolerances, and the loadAtVoltage and
+///           loadAtPower methods using the table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsElectPvString2::testIvTable()
+{
+    UT_RESULT;
+
+    /// - Initialize a reference string without the table, and the test article with the table.
+    FriendlyGunnsElectPvString2 refString(tConfigData, tInputData);
+    CPPUNIT_ASSERT_NO_THROW(refString.initialize("refString"));
+    tConfigData->mIvTableNumPoints     = 101;
+    tConfigData->mIvTableFluxTolerance = 10.0;
+    tConfigData->mIvTableTempTolerance = 1.0;
+    CPPUNIT_ASSERT_NO_THROW(tArticle->initialize(tName));
+
+    /// @test    Table is allocated on initialization but not built until the first update.
+    CPPUNIT_ASSERT(0   == refString.mIvTable.getNumPoints());
+    CPPUNIT_ASSERT(101 == tArticle->getIvTable().getNumPoints());
+    CPPUNIT_ASSERT(not tArticle->mIvTable.isValid());
+
+    /// @test    Table is built on update and matches the cell model, and is monotonic.
+    refString.update();
+    tArticle->update();
+    CPPUNIT_ASSERT(tArticle->mIvTable.isValid());
+    CPPUNIT_ASSERT(not refString.mIvTable.isValid());
+    const double voc = tArticle->mEqProps->mVoc;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->mIvTable.getVoltage(0),   0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(voc, tArticle->mIvTable.getVoltage(100), FLT_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->mIvTable.getCurrent(100), 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mEqProps->mIsc, tArticle->mIvTable.getCurrent(0), DBL_EPSILON);
+    for (unsigned int i = 1; i < 101; ++i) {
+        CPPUNIT_ASSERT(tArticle->mIvTable.getCurrent(i) <= tArticle->mIvTable.getCurrent(i-1));
+    }
+    for (unsigned int i = 1; i < 10; ++i) {
+        const double cellV    = 0.1 * i * voc;
+        const double expected = tArticle->mEqProps->computeCurrent(cellV);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, tArticle->mIvTable.computeCurrent(cellV), 0.01 * tCellShortCircuitCurrent);
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mIvTable.getCurrent(0), tArticle->mIvTable.computeCurrent(-1.0),    0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,                              tArticle->mIvTable.computeCurrent(voc),     0.0);
+
+    /// @test    Table voltage is the inverse of its current.
+    for (unsigned int i = 1; i < 10; ++i) {
+        const double cellV = 0.1 * i * voc;
+        const double cellI = tArticle->mIvTable.computeCurrent(cellV);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(cellV, tArticle->mIvTable.computeVoltage(cellI), 1.0e-3 * voc);
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(voc, tArticle->mIvTable.computeVoltage(0.0),                     0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->mIvTable.computeVoltage(tCellShortCircuitCurrent), 0.0);
+
+    /// @test    loadAtVoltage from the table matches the string without the table.
+    {
+        const double v1 = 0.95 * tArticle->mMpp.mVoltage;
+        refString.loadAtVoltage(v1);
+        tArticle->loadAtVoltage(v1);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(v1,                               tArticle->mTerminal.mVoltage, 0.0);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(refString.mTerminal.mCurrent,     tArticle->mTerminal.mCurrent, 0.01 * refString.mTerminal.mCurrent);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(refString.mTerminal.mPower,       tArticle->mTerminal.mPower,   0.01 * refString.mTerminal.mPower);
+    }
+
+    /// @test    loadAtPower from the table on the short-circuit and open-circuit sides of MPP.
+    {
+        const double power = 0.5 * tArticle->mMpp.mPower;
+        tArticle->loadAtPower(power, true);
+        const double shortV = tArticle->mTerminal.mVoltage;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(power, tArticle->mTerminal.mPower, 0.0);
+        CPPUNIT_ASSERT(shortV < tArticle->mMpp.mVoltage);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->predictCurrentAtVoltage(shortV), tArticle->mTerminal.mCurrent,
+                                     0.01 * tArticle->mTerminal.mCurrent);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mTerminal.mCurrent / shortV, tArticle->mTerminal.mConductance,
+                                     DBL_EPSILON);
+
+        tArticle->loadAtPower(power, false);
+        const double openV = tArticle->mTerminal.mVoltage;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(power, tArticle->mTerminal.mPower, 0.0);
+        CPPUNIT_ASSERT(openV > tArticle->mMpp.mVoltage);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->predictCurrentAtVoltage(openV), tArticle->mTerminal.mCurrent,
+                                     0.01 * tArticle->mTerminal.mCurrent);
+
+        /// @test    loadAtPower at and above MPP power loads at MPP.
+        tArticle->loadAtPower(2.0 * tArticle->mMpp.mPower, true);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mMpp.mVoltage, tArticle->mTerminal.mVoltage, 0.0);
+    }
+
+    /// @test    Changes in conditions within tolerance don't update the cell model or table.
+    const double photoFlux   = tArticle->mEqProps->mPhotoFlux;
+    const double temperature = tArticle->mEqProps->mTemperature;
+    const double tableI      = tArticle->mIvTable.getCurrent(50);
+    tInputData->mPhotoFlux   = tPhotoFlux   - 9.0;
+    tInputData->mTemperature = tTemperature + 0.9;
+    tArticle->update();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(photoFlux,   tArticle->mEqProps->mPhotoFlux,   0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(temperature, tArticle->mEqProps->mTemperature, 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tableI,      tArticle->mIvTable.getCurrent(50), 0.0);
+
+    /// @test    Change in photo flux beyond tolerance rebuilds the table.
+    tInputData->mPhotoFlux = tPhotoFlux - 11.0;
+    tArticle->update();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tPhotoFlux - 11.0,   tArticle->mEqProps->mPhotoFlux,   0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tTemperature + 0.9,  tArticle->mEqProps->mTemperature, 0.0);
+    CPPUNIT_ASSERT(tableI > tArticle->mIvTable.getCurrent(50));
+
+    /// @test    Change in temperature beyond tolerance rebuilds the table.
+    tInputData->mTemperature = tTemperature + 2.0;
+    tArticle->update();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tTemperature + 2.0, tArticle->mEqProps->mTemperature, 0.0);
+
+    /// @test    Any change in degradation rebuilds the table.
+    tArticle->mMalfDegradeFlag  = true;
+    tArticle->mMalfDegradeValue = 0.01;
+    tArticle->update();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.99 * tArticle->mRefCell->mImp * (tPhotoFlux - 11.0) / tCellPhotoFlux,
+                                 tArticle->mEqProps->mImp, 0.01 * tArticle->mEqProps->mImp);
+
+    /// @test    Table is invalidated with no active cells, and rebuilt when they return.
+    tArticle->mMalfCellGroupFlag  = true;
+    tArticle->mMalfCellGroupValue = 4;
+    tArticle->update();
+    CPPUNIT_ASSERT(not tArticle->mIvTable.isValid());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->predictCurrentAtVoltage(1.0), 0.0);
+    tArticle->mMalfCellGroupFlag  = false;
+    tArticle->update();
+    CPPUNIT_ASSERT(tArticle->mIvTable.isValid());
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Tests the loadAtConductance method.  Since the string vesrion 2 model has a limitation
 ///           that it can't be loaded at an arbitrary conductance, it can only load at either near
@@ -82,6 +82,8 @@ class UtGunnsElectPvString2: public CppUnit::TestFixture
         void testLoadAtPower();
         /// @brief  Tests the loadAtVoltage method.
         void testLoadAtVoltage();
+        /// @brief  Tests the optional I-V curve table.
+        void testIvTable();
         /// @brief  Tests the loadAtConductance method.
         void testLoadAtConductance();
 
@@ -102,6 +104,7 @@ class UtGunnsElectPvString2: public CppUnit::TestFixture
         CPPUNIT_TEST(testStep);
         CPPUNIT_TEST(testLoadAtPower);
         CPPUNIT_TEST(testLoadAtVoltage);
+        CPPUNIT_TEST(testIvTable);
         CPPUNIT_TEST(testLoadAtConductance);
         CPPUNIT_TEST_SUITE_END();
         /// @brief  Enumeration for the number of nodes.
@@ -6,11 +6,13 @@ LIBRARY DEPENDENCY:
  (
   (simulation/hs/TsHsMsg.o)
   (software/exceptions/TsInitializationException.o)
+  (core/GunnsSnapshot.o)
  )
 */
 
 #include <cmath>
 #include "GunnsElectSwitchUtil.hh"
+#include "core/GunnsSnapshot.hh"
 #include "math.h"
 #include "software/exceptions/TsHsException.hh"
 #include "software/exceptions/TsInitializationException.hh"
@@ -683,3 +685,44 @@ void GunnsElectSwitchUtil::setMalfNegTripSetpoint(const bool flag, const double
     mMalfNegTripSetpointFail      = flag;
     mMalfNegTripSetpointFailValue = value;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the malfunctions, position, trip state, flows and active limits of
+///           this switch in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectSwitchUtil::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mMalfFailClosed);
+    snapshot.sync(mMalfFailOpen);
+    snapshot.sync(mMalfFailResistance);
+    snapshot.sync(mMalfFailResistPercent);
+    snapshot.sync(mMalfPosTripSetpointFail);
+    snapshot.sync(mMalfPosTripSetpointFailValue);
+    snapshot.sync(mMalfNegTripSetpointFail);
+    snapshot.sync(mMalfNegTripSetpointFailValue);
+    snapshot.sync(mMalfIgnoreCurrentTrip);
+    snapshot.sync(mCurrentActual);
+    snapshot.sync(mCurrentSensed);
+    snapshot.sync(mVoltageIn);
+    snapshot.sync(mPowerDissipation);
+    snapshot.sync(mSwitchCommandedClosed);
+    snapshot.sync(mSwitchIsClosed);
+    snapshot.sync(mPosTrip);
+    snapshot.sync(mNegTrip);
+    snapshot.sync(mExternalTrip);
+    snapshot.sync(mWaitingToTrip);
+    snapshot.sync(mJustTripped);
+    snapshot.sync(mCurrentMinorStep);
+    snapshot.sync(mTripReset);
+    snapshot.sync(mActiveSwitchResistance);
+    snapshot.sync(mOverCurrentProtection);
+    snapshot.sync(mConfigDataCurrentProtection);
+    snapshot.sync(mLastMalfIgnoreCurrentTrip);
+    snapshot.sync(mDefaultPosTripLimit);
+    snapshot.sync(mActivePosTripLimit);
+    snapshot.sync(mDefaultNegTripLimit);
+    snapshot.sync(mActiveNegTripLimit);
+    snapshot.sync(mSwitchStateEnum);
+}
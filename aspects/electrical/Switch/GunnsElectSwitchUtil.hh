@@ -44,6 +44,8 @@ PROGRAMMERS:
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include <string>
 
+class GunnsSnapshot;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    GunnsElectSwitchUtil Configuration Data.
 ///
@@ -215,6 +217,8 @@ class GunnsElectSwitchUtil {
         void setMalfNegTripSetpoint(const bool flag = false, const double value = 0.0);
         /// @brief Returns whether this switch is initialized.
         bool isInitialized() const;
+        /// @brief Saves or restores the switch state and malfunctions in a network snapshot.
+        void snapshotState(GunnsSnapshot& snapshot);
 
     protected:
         double mCurrentActual;               /**<    (amp) actual current passing through the switch */
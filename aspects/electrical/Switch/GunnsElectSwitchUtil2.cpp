@@ -14,18 +14,22 @@ LIBRARY DEPENDENCY:
 
 #include "GunnsElectSwitchUtil2.hh"
 #include "core/GunnsMacros.hh"
+#include <algorithm>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] resistance   (--) Default electrical resistance of the switch.
-/// @param[in] tripPriority (--) Priority of trips in the network.
+/// @param[in] tripPriority     (--) Priority of trips in the network.
+/// @param[in] eventDrivenTrips (--) Skip trip checks while far from the trip limits.
 ///
 /// @details Constructs the GunnsElectSwitchUtil2 configuration data.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 GunnsElectSwitchUtil2ConfigData::GunnsElectSwitchUtil2ConfigData(const float        resistance,
-                                                                 const unsigned int tripPriority)
+                                                                 const unsigned int tripPriority,
+                                                                 const bool         eventDrivenTrips)
     :
     mResistance(resistance),
-    mTripPriority(tripPriority)
+    mTripPriority(tripPriority),
+    mEventDrivenTrips(eventDrivenTrips)
 {
     // nothing to do
 }
@@ -60,8 +64,9 @@ GunnsElectSwitchUtil2ConfigData& GunnsElectSwitchUtil2ConfigData::operator=(cons
 {
     /// - Skip attribute assignment if objects are the same
     if (this != &that) {
-        mResistance   = that.mResistance;
-        mTripPriority = that.mTripPriority;
+        mResistance       = that.mResistance;
+        mTripPriority     = that.mTripPriority;
+        mEventDrivenTrips = that.mEventDrivenTrips;
     }
     return *this;
 }
@@ -164,6 +169,13 @@ GunnsElectSwitchUtil2::GunnsElectSwitchUtil2()
     mNegOverCurrentTrip(),
     mWaitingToTrip(false),
     mJustTripped(false),
+    mEventDrivenTrips(false),
+    mTripMarginsValid(false),
+    mTripCheckCurrent(0.0),
+    mTripCheckVoltage(0.0),
+    mCurrentTripMargin(0.0),
+    mVoltageTripMargin(0.0),
+    mNumSkippedTripChecks(0),
     mName(),
     mInitFlag(false)
 {
@@ -204,6 +216,9 @@ void GunnsElectSwitchUtil2::initialize(const GunnsElectSwitchUtil2ConfigData& co
     mPosition          = inputData.mPosition;
     mPositionCommand   = inputData.mPositionCommand;
     mResetTripsCommand = inputData.mResetTripsCommand;
+    mEventDrivenTrips  = configData.mEventDrivenTrips;
+    mTripMarginsValid  = false;
+    mNumSkippedTripChecks = 0;
     mInputUnderVoltageTrip .initialize(inputData.mInputUnderVoltageTripLimit, configData.mTripPriority, false);
     mInputUnderVoltageReset.initialize(inputData.mInputUnderVoltageTripReset, configData.mTripPriority, false);
     mInputOverVoltageTrip  .initialize(inputData.mInputOverVoltageTripLimit,  configData.mTripPriority, false);
@@ -271,6 +286,10 @@ void GunnsElectSwitchUtil2::updateState()
 {
     applyConstraints();
 
+    /// - Invalidate the trip margins so the trip logic is fully checked again after any changes
+    ///   to the commands, malfunctions or trip limits since the last major step.
+    mTripMarginsValid = false;
+
     /// - Clear trips on reception of the open command.
     if (isTripped() and not mPositionCommand) {
         resetTrips();
@@ -351,6 +370,12 @@ void GunnsElectSwitchUtil2::updateTrips(const double current, const double volta
                 }
             }
 
+        /// - In the event-driven trips mode, skip the trip logic while the current and voltage
+        ///   remain within the trip margins from the last full check, since no trip can occur.
+        } else if (mEventDrivenTrips and mPositionCommand and not isTripped() and not mMalfFailClosed
+                and not isNearTrip(current, voltage)) {
+            ++mNumSkippedTripChecks;
+
         /// - Update the trip logic if the switch is not tripped open and not failed closed.
         } else if (mPositionCommand and not isTripped() and not mMalfFailClosed) {
 
@@ -388,17 +413,43 @@ void GunnsElectSwitchUtil2::updateTrips(const double current, const double volta
                 mJustTripped = true;
                 mPosition    = false;
             }
+
+            if (mEventDrivenTrips) {
+                updateTripMargins(current, voltage);
+            }
         }
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] current (amp) Electrical current through the switch at the full trip check.
+/// @param[in] voltage (V)   Input voltage to the switch at the full trip check.
+///
+/// @details  Saves the given current and voltage and their margins from the nearest of the current
+///           and voltage trip limits, for skipping the trip checks in later minor steps.  A trip
+///           logic that can't trip, such as one with a zero limit, has an unlimited margin.  When
+///           any trip logic is in or at its trip condition, the margin is zero or negative and
+///           the next trip check won't be skipped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectSwitchUtil2::updateTripMargins(const double current, const double voltage)
+{
+    mTripCheckCurrent  = current;
+    mTripCheckVoltage  = voltage;
+    mCurrentTripMargin = std::min(mPosOverCurrentTrip.getMargin(current),
+                                  mNegOverCurrentTrip.getMargin(current));
+    mVoltageTripMargin = std::min(mInputUnderVoltageTrip.getMargin(voltage),
+                                  mInputOverVoltageTrip.getMargin(voltage));
+    mTripMarginsValid  = true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Resets all trip and trip reset logic, and the waiting to trip and just tripped flags.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsElectSwitchUtil2::resetTrips()
 {
-    mWaitingToTrip = false;
-    mJustTripped   = false;
+    mWaitingToTrip    = false;
+    mJustTripped      = false;
+    mTripMarginsValid = false;
     mInputUnderVoltageTrip.resetTrip();
     mInputUnderVoltageReset.resetTrip();
     mInputOverVoltageTrip.resetTrip();
@@ -37,6 +37,7 @@ PROGRAMMERS:
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "aspects/electrical/TripLogic/GunnsTripLogic.hh"
 #include <cfloat>
+#include <cmath>
 #include <string>
 
 // Forward-declaration of types.
@@ -58,6 +59,15 @@ class GunnsElectSwitchUtil2InputData;
 ///           - remove switch state enumeration, relegating to external users,
 ///           - remove power dissipation, relegating to the parent link,
 ///           - remove two-port switch considerations and knowledge of a switch card, to simplify.
+///
+///           The optional event-driven trips mode (mEventDrivenTrips) saves the trip checks of
+///           switches that are far from tripping, such as the majority of RPC's in a large power
+///           distribution network.  After each full check of the trip logic, the switch saves the
+///           sensed current and voltage, and the margins they have from the nearest current and
+///           voltage trip limits.  The trip checks in following minor steps are skipped as long as
+///           the current and voltage remain within these margins of the saved values, since no
+///           trip can occur there.  The margins are invalidated every major step in updateState,
+///           so changes to the commands, malfunctions and trip limits take effect.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsElectSwitchUtil2
 {
@@ -98,6 +108,10 @@ class GunnsElectSwitchUtil2
         bool isWaitingToTrip() const;
         /// @brief Returns whether the switch has just tripped or trip auto-reset on this minor step.
         bool hasJustTripped() const;
+        /// @brief Returns whether the current or voltage is near enough to a trip limit to be checked.
+        bool isNearTrip(const double current, const double voltage) const;
+        /// @brief Returns the number of trip checks skipped in the event-driven trips mode.
+        unsigned int getNumSkippedTripChecks() const;
         /// @brief  Returns the input under-voltage trip logic.
         GunnsTripLogic* getInputUnderVoltageTrip();
         /// @brief  Returns the input under-voltage trip reset logic.
@@ -130,6 +144,13 @@ class GunnsElectSwitchUtil2
         GunnsTripLessThan    mNegOverCurrentTrip;     /**<    (1)                       Negative over-current trip function. */
         bool                 mWaitingToTrip;          /**<    (1)   trick_chkpnt_io(**) Switch is going to trip, waiting for its tip priority minor step. */
         bool                 mJustTripped;            /**<    (1)   trick_chkpnt_io(**) Switch has tripped on this minor step. */
+        bool                 mEventDrivenTrips;       /**<    (1)   trick_chkpnt_io(**) Skip trip checks while far from the trip limits. */
+        bool                 mTripMarginsValid;       /**<    (1)   trick_chkpnt_io(**) The trip margins are valid for skipping trip checks. */
+        double               mTripCheckCurrent;       /**<    (amp) trick_chkpnt_io(**) Current at the last full trip check. */
+        double               mTripCheckVoltage;       /**<    (V)   trick_chkpnt_io(**) Voltage at the last full trip check. */
+        double               mCurrentTripMargin;      /**<    (amp) trick_chkpnt_io(**) Distance of mTripCheckCurrent from the nearest current trip limit. */
+        double               mVoltageTripMargin;      /**<    (V)   trick_chkpnt_io(**) Distance of mTripCheckVoltage from the nearest voltage trip limit. */
+        unsigned int         mNumSkippedTripChecks;   /**<    (1)   trick_chkpnt_io(**) Number of trip checks skipped in the event-driven trips mode. */
         std::string          mName;                   /**< *o (1)                       Name of this switch instance for messaging. */
         bool                 mInitFlag;               /**< *o (1)   trick_chkpnt_io(**) True if this switch has been initialized. */
         /// @brief  Validates the configuration and input data.
@@ -137,6 +158,8 @@ class GunnsElectSwitchUtil2
                       const GunnsElectSwitchUtil2InputData&  inputData) const;
         /// @brief  Applies range limits to runtime variables.
         void applyConstraints();
+        /// @brief  Updates the trip margins from a full trip check.
+        void updateTripMargins(const double current, const double voltage);
 
     private:
         /// @brief  Copy constructor unavailable since declared private and not implemented.
@@ -152,11 +175,13 @@ class GunnsElectSwitchUtil2
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsElectSwitchUtil2ConfigData {
     public:
-        float        mResistance;   /**< (ohm) trick_chkpnt_io(**) Default electrical resistance of this switch. */
-        unsigned int mTripPriority; /**< (1)   trick_chkpnt_io(**) Priority of trips in the network. */
+        float        mResistance;       /**< (ohm) trick_chkpnt_io(**) Default electrical resistance of this switch. */
+        unsigned int mTripPriority;     /**< (1)   trick_chkpnt_io(**) Priority of trips in the network. */
+        bool         mEventDrivenTrips; /**< (1)   trick_chkpnt_io(**) Skip trip checks while far from the trip limits. */
         /// @brief Default GunnsElectSwitchUtil2 Configuration Data Constructor.
-        GunnsElectSwitchUtil2ConfigData(const float        resistance   = 0.0,
-                                        const unsigned int tripPriority = 0);
+        GunnsElectSwitchUtil2ConfigData(const float        resistance       = 0.0,
+                                        const unsigned int tripPriority     = 0,
+                                        const bool         eventDrivenTrips = false);
         /// @brief GunnsElectSwitchUtil2 configuration destructor.
         virtual ~GunnsElectSwitchUtil2ConfigData();
         /// @brief GunnsElectSwitchUtil2 configuration copy constructor.
@@ -298,6 +323,33 @@ inline bool GunnsElectSwitchUtil2::hasJustTripped() const
     return mJustTripped;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] current (amp) Electrical current through the switch.
+/// @param[in] voltage (V)   Input voltage to the switch.
+///
+/// @return bool (--) True if the trip logic must be checked for the given current and voltage.
+///
+/// @details  Returns false only when the trip margins from the last full trip check are valid and
+///           the given current and voltage are both within their margins of that check, in which
+///           case none of the trip logics can be in their trip condition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsElectSwitchUtil2::isNearTrip(const double current, const double voltage) const
+{
+    return (not mTripMarginsValid
+            or std::fabs(current - mTripCheckCurrent) >= mCurrentTripMargin
+            or std::fabs(voltage - mTripCheckVoltage) >= mVoltageTripMargin);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return unsigned int (--) Number of trip checks skipped in the event-driven trips mode.
+///
+/// @details  Returns the value of mNumSkippedTripChecks.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned int GunnsElectSwitchUtil2::getNumSkippedTripChecks() const
+{
+    return mNumSkippedTripChecks;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @returns  GunnsTripLogic*  (--)  Pointer to the input under-voltage trip logic.
 ///
@@ -17,6 +17,8 @@ LIBRARY DEPENDENCY:
 */
 
 #include "GunnsElectUserLoadSwitch.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "math/MsMath.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "aspects/electrical/UserLoad/GunnsElectUserLoad.hh"
@@ -180,6 +182,35 @@ void GunnsElectUserLoadSwitch::restartModel()
     mLoadsVoltage = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           switch and short models, and the loads voltage override.  The user loads aren't
+///           included, since they are saved with the network's spotters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectUserLoadSwitch::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicConductor::snapshotState(snapshot);
+
+    mSwitch.snapshotState(snapshot);
+    mShort.snapshotState(snapshot);
+    snapshot.sync(mLoadsVoltage);
+    snapshot.sync(mLoadsPower);
+    snapshot.sync(mLoadsOverrideActive);
+    snapshot.sync(mLoadsOverrideVoltage);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsElectUserLoadSwitch.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsElectUserLoadSwitch::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsElectUserLoadSwitch);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
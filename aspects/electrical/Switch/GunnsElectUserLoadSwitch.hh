@@ -137,6 +137,10 @@ class GunnsElectUserLoadSwitch : public GunnsBasicConductor
                         std::vector<GunnsBasicLink*>&             networkLinks,
                         const int                                 port0,
                         const int                                 port1);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief Updates the link contributions to the system of equations.
         virtual void step(const double dt);
         /// @brief Updates the link effective conductance.
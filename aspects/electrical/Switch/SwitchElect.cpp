@@ -29,8 +29,10 @@
  )
  **************************************************************************************************/
 #include <string>
+#include <typeinfo>
 #include <vector>
 #include "SwitchElect.hh"
+#include "core/GunnsSnapshot.hh"
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Constructs the SwitchElect Config data
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -146,6 +148,30 @@ void SwitchElect::restartModel()
     /// - Reset non-config & non-checkpointed attributes.
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           switch state and malfunctions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SwitchElect::snapshotState(GunnsSnapshot& snapshot) {
+    GunnsBasicConductor::snapshotState(snapshot);
+
+    mSwitch.snapshotState(snapshot);
+    snapshot.sync(mCurrent);
+    snapshot.sync(mVoltage);
+    snapshot.sync(mTimeStep);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a SwitchElect.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool SwitchElect::isSnapshotSupported() const {
+    return typeid(*this) == typeid(SwitchElect);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]   timeStep  (s)  time step
 /// @details  Method for updating the link for the network
@@ -123,6 +123,12 @@ class SwitchElect: public GunnsBasicConductor {
                     const int port0,
                     const int port1);
 
+    /// @brief Saves or restores the link dynamic state in a network snapshot
+    virtual void snapshotState(GunnsSnapshot& snapshot);
+
+    /// @brief Returns whether snapshotState includes all of the link's dynamic state
+    virtual bool isSnapshotSupported() const;
+
     /// @brief Updates the link during a frame
     virtual void updateState(const double timeStep);
 
@@ -104,22 +104,27 @@ void UtGunnsElectSwitchUtil2::testConfigData()
     /// @test    Nominal construction.
     CPPUNIT_ASSERT(tResistance   == tConfigData->mResistance);
     CPPUNIT_ASSERT(tTripPriority == tConfigData->mTripPriority);
+    CPPUNIT_ASSERT(false         == tConfigData->mEventDrivenTrips);
 
     /// @test    Copy construction.
+    tConfigData->mEventDrivenTrips = true;
     GunnsElectSwitchUtil2ConfigData copyConfig(*tConfigData);
     CPPUNIT_ASSERT(tResistance   == copyConfig.mResistance);
     CPPUNIT_ASSERT(tTripPriority == copyConfig.mTripPriority);
+    CPPUNIT_ASSERT(true          == copyConfig.mEventDrivenTrips);
 
     /// @test    Default construction.
     GunnsElectSwitchUtil2ConfigData defaultConfig;
-    CPPUNIT_ASSERT(0.0F == defaultConfig.mResistance);
-    CPPUNIT_ASSERT(0    == defaultConfig.mTripPriority);
+    CPPUNIT_ASSERT(0.0F  == defaultConfig.mResistance);
+    CPPUNIT_ASSERT(0     == defaultConfig.mTripPriority);
+    CPPUNIT_ASSERT(false == defaultConfig.mEventDrivenTrips);
 
     /// @test    Assignment operator.
     GunnsElectSwitchUtil2ConfigData assignConfig;
     assignConfig = copyConfig;
     CPPUNIT_ASSERT(tResistance   == assignConfig.mResistance);
     CPPUNIT_ASSERT(tTripPriority == assignConfig.mTripPriority);
+    CPPUNIT_ASSERT(true          == assignConfig.mEventDrivenTrips);
 
     UT_PASS;
 }
@@ -597,5 +602,82 @@ void UtGunnsElectSwitchUtil2::testUpdateTrips()
     CPPUNIT_ASSERT(true  == tArticle->hasJustTripped());
     CPPUNIT_ASSERT(true  == tArticle->getPosition());
 
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test for the event-driven trips mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsElectSwitchUtil2::testEventDrivenTrips()
+{
+    UT_RESULT;
+
+    /// - Initialize the test article with nominal initialization data and event-driven trips.
+    tConfigData->mEventDrivenTrips = true;
+    tInputData->mResetTripsCommand = false;
+    tArticle->initialize(*tConfigData, *tInputData, tName);
+    CPPUNIT_ASSERT(true  == tArticle->mEventDrivenTrips);
+    CPPUNIT_ASSERT(false == tArticle->mTripMarginsValid);
+    CPPUNIT_ASSERT(0     == tArticle->getNumSkippedTripChecks());
+
+    /// @test    Full trip check saves the margins to the nearest current and voltage limits.
+    tArticle->updateTrips(5.0, 12.5, 1);
+    CPPUNIT_ASSERT(true == tArticle->mTripMarginsValid);
+    CPPUNIT_ASSERT(0    == tArticle->getNumSkippedTripChecks());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(5.0,  tArticle->mTripCheckCurrent,  0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(12.5, tArticle->mTripCheckVoltage,  0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(5.0,  tArticle->mCurrentTripMargin, FLT_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.5,  tArticle->mVoltageTripMargin, FLT_EPSILON);
+
+    /// @test    isNearTrip within and beyond the margins.
+    CPPUNIT_ASSERT(false == tArticle->isNearTrip( 9.9, 13.9));
+    CPPUNIT_ASSERT(false == tArticle->isNearTrip( 0.1, 11.1));
+    CPPUNIT_ASSERT(true  == tArticle->isNearTrip(10.0, 12.5));
+    CPPUNIT_ASSERT(true  == tArticle->isNearTrip( 5.0, 11.0));
+
+    /// @test    Trip check is skipped within the margins, and the margins are kept.
+    tArticle->updateTrips(7.0, 13.0, 2);
+    CPPUNIT_ASSERT(1     == tArticle->getNumSkippedTripChecks());
+    CPPUNIT_ASSERT(false == tArticle->isWaitingToTrip());
+    CPPUNIT_ASSERT(false == tArticle->hasJustTripped());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(5.0, tArticle->mTripCheckCurrent, 0.0);
+
+    /// @test    Trip is checked near the limit, and waits for the trip priority step.
+    tArticle->updateTrips(10.5, 12.5, 2);
+    CPPUNIT_ASSERT(1    == tArticle->getNumSkippedTripChecks());
+    CPPUNIT_ASSERT(true == tArticle->isWaitingToTrip());
+    CPPUNIT_ASSERT(tArticle->mCurrentTripMargin < 0.0);
+
+    /// @test    Trip isn't skipped while in the trip condition, and trips on its priority step.
+    tArticle->updateTrips(10.5, 12.5, 3);
+    CPPUNIT_ASSERT(1     == tArticle->getNumSkippedTripChecks());
+    CPPUNIT_ASSERT(true  == tArticle->getPosOverCurrentTrip()->isTripped());
+    CPPUNIT_ASSERT(true  == tArticle->hasJustTripped());
+    CPPUNIT_ASSERT(false == tArticle->getPosition());
+
+    /// @test    Trip reset and updateState invalidate the margins.
+    tArticle->resetTrips();
+    CPPUNIT_ASSERT(false == tArticle->mTripMarginsValid);
+    tArticle->updateTrips(5.0, 12.5, 1);
+    CPPUNIT_ASSERT(true  == tArticle->mTripMarginsValid);
+    tArticle->updateState();
+    CPPUNIT_ASSERT(false == tArticle->mTripMarginsValid);
+
+    /// @test    Zero margin with a force trip malfunction prevents skipping.
+    tArticle->getNegOverCurrentTrip()->mMalfForceTrip = true;
+    tArticle->updateTripMargins(5.0, 12.5);
+    CPPUNIT_ASSERT(true == tArticle->isNearTrip(5.0, 12.5));
+    tArticle->updateTrips(5.0, 12.5, 1);
+    CPPUNIT_ASSERT(true == tArticle->getNegOverCurrentTrip()->isTripped());
+    tArticle->getNegOverCurrentTrip()->mMalfForceTrip = false;
+
+    /// @test    Trip checks are never skipped without the event-driven trips mode.
+    tArticle->resetTrips();
+    tArticle->mEventDrivenTrips = false;
+    tArticle->updateTrips(5.0, 12.5, 1);
+    tArticle->updateTrips(5.0, 12.5, 2);
+    CPPUNIT_ASSERT(false == tArticle->mTripMarginsValid);
+    CPPUNIT_ASSERT(1     == tArticle->getNumSkippedTripChecks());
+
     UT_PASS_LAST;
 }
@@ -67,6 +67,8 @@ class UtGunnsElectSwitchUtil2 : public CppUnit::TestFixture
         void testUpdateState();
         /// @brief    Tests the updateTrips method.
         void testUpdateTrips();
+        /// @brief    Tests the event-driven trips mode.
+        void testEventDrivenTrips();
 
     private:
         CPPUNIT_TEST_SUITE(UtGunnsElectSwitchUtil2);
@@ -78,6 +80,7 @@ class UtGunnsElectSwitchUtil2 : public CppUnit::TestFixture
         CPPUNIT_TEST(testInputConstraints);
         CPPUNIT_TEST(testUpdateState);
         CPPUNIT_TEST(testUpdateTrips);
+        CPPUNIT_TEST(testEventDrivenTrips);
         CPPUNIT_TEST_SUITE_END();
         std::string                      tName;                       /**< (1)   Nominal initialization data. */
         float                            tResistance;                 /**< (ohm) Nominal config data. */
@@ -6,10 +6,11 @@
            National Aeronautics and Space Administration.  All Rights Reserved.
 
 LIBRARY DEPENDENCY:
-  ()
+  ((core/GunnsSnapshot.o))
 */
 
 #include "GunnsTripLogic.hh"
+#include "core/GunnsSnapshot.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Default constructs this GUNNS Trip Logic.
@@ -99,6 +100,20 @@ bool GunnsTripLogic::checkForTrip(GunnsBasicLink::SolutionResult& result,
     return justTripped;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the trip state, limit and malfunctions of this GUNNS Trip Logic in
+///           the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsTripLogic::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mMalfInhibitTrip);
+    snapshot.sync(mMalfForceTrip);
+    snapshot.sync(mLimit);
+    snapshot.sync(mIsTripped);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Default constructs this GUNNS Trip Greater Than Logic.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,9 @@ PROGRAMMERS:
 
 #include "core/GunnsBasicLink.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <cfloat>
+
+class GunnsSnapshot;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    GUNNS Trip Logic Model base class.
@@ -67,6 +70,10 @@ class GunnsTripLogic
         void setLimit(const float limit);
         /// @brief  Returns the the trip limit value.
         float getLimit() const;
+        /// @brief  Returns the distance of the given parameter from the trip condition.
+        double getMargin(const double param) const;
+        /// @brief  Saves or restores the trip state and malfunctions in a network snapshot.
+        void snapshotState(GunnsSnapshot& snapshot);
 
     protected:
         float        mLimit;     /**<    (--) trick_chkpnt_io(**) Trip limit value to check against, zero disables checks. */
@@ -76,6 +83,8 @@ class GunnsTripLogic
         GunnsTripLogic();
         /// @brief  Pure virtual method to check the model parameter against the trip limit.
         virtual bool isTripCondition(const float param) = 0;
+        /// @brief  Pure virtual method to return the distance of the model parameter from the limit.
+        virtual double computeMargin(const double param) const = 0;
 
     private:
         /// @brief  Copy constructor unavailable since declared private and not implemented.
@@ -102,6 +111,8 @@ class GunnsTripGreaterThan : public GunnsTripLogic
     protected:
         /// @brief  Implements the greater-than value check.
         virtual bool isTripCondition(const float param);
+        /// @brief  Implements the greater-than margin.
+        virtual double computeMargin(const double param) const;
 
     private:
         /// @brief  Copy constructor unavailable since declared private and not implemented.
@@ -128,6 +139,8 @@ class GunnsTripLessThan : public GunnsTripLogic
     protected:
         /// @brief  Implements the less-than value check.
         virtual bool isTripCondition(const float param);
+        /// @brief  Implements the less-than margin.
+        virtual double computeMargin(const double param) const;
 
     private:
         /// @brief  Copy constructor unavailable since declared private and not implemented.
@@ -176,6 +189,27 @@ inline float GunnsTripLogic::getLimit() const
     return mLimit;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] param (--) The value to be checked against the trip limit.
+///
+/// @returns  double  (--)  Distance of the parameter from the trip condition.
+///
+/// @details  Returns how far the given parameter value can change before it is in the trip
+///           condition: positive when not in the trip condition, and zero or negative when it is.
+///           This returns DBL_MAX when this logic can't trip, i.e. when it is already tripped,
+///           inhibited or disabled, and zero when the force trip malfunction is active.  Callers
+///           can use this to skip checkForTrip while the parameter stays within this margin.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsTripLogic::getMargin(const double param) const
+{
+    if (mIsTripped or mMalfInhibitTrip or 0.0F == mLimit or 1 > mPriority) {
+        return DBL_MAX;
+    } else if (mMalfForceTrip) {
+        return 0.0;
+    }
+    return computeMargin(param);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] param (--) The value to be checked against the trip limit.
 ///
@@ -188,6 +222,18 @@ inline bool GunnsTripGreaterThan::isTripCondition(const float param)
     return param > mLimit;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] param (--) The value to be checked against the trip limit.
+///
+/// @returns  double  (--)  Distance of the parameter below the trip limit.
+///
+/// @details  Returns the trip limit minus the parameter value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsTripGreaterThan::computeMargin(const double param) const
+{
+    return static_cast<double>(mLimit) - param;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] param (--) The value to be checked against the trip limit.
 ///
@@ -200,4 +246,16 @@ inline bool GunnsTripLessThan::isTripCondition(const float param)
     return param < mLimit;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] param (--) The value to be checked against the trip limit.
+///
+/// @returns  double  (--)  Distance of the parameter above the trip limit.
+///
+/// @details  Returns the parameter value minus the trip limit.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsTripLessThan::computeMargin(const double param) const
+{
+    return param - static_cast<double>(mLimit);
+}
+
 #endif
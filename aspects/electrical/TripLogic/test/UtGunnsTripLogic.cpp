@@ -301,5 +301,47 @@ void UtGunnsTripLogic::testAccessors()
 
     delete article;
 
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the getMargin method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsTripLogic::testGetMargin()
+{
+    UT_RESULT;
+
+    FriendlyGunnsTripGreaterThan* greater = new FriendlyGunnsTripGreaterThan();
+    FriendlyGunnsTripLessThan*    less    = new FriendlyGunnsTripLessThan();
+    greater->initialize(10.0, tPriority, false);
+    less   ->initialize(10.0, tPriority, false);
+
+    /// @test    Margins of the greater-than and less-than logics on both sides of the limit.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 2.5, greater->getMargin( 7.5), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-2.5, greater->getMargin(12.5), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-2.5, less   ->getMargin( 7.5), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 2.5, less   ->getMargin(12.5), DBL_EPSILON);
+
+    /// @test    Zero margin with the force trip malfunction.
+    greater->mMalfForceTrip = true;
+    CPPUNIT_ASSERT(0.0 == greater->getMargin(7.5));
+
+    /// @test    Unlimited margin when inhibited, even with the force trip malfunction.
+    greater->mMalfInhibitTrip = true;
+    CPPUNIT_ASSERT(DBL_MAX == greater->getMargin(7.5));
+    greater->mMalfInhibitTrip = false;
+    greater->mMalfForceTrip   = false;
+
+    /// @test    Unlimited margin when already tripped, or disabled by zero limit or priority.
+    less->initialize(10.0, tPriority, true);
+    CPPUNIT_ASSERT(DBL_MAX == less->getMargin(12.5));
+    less->initialize(0.0, tPriority, false);
+    CPPUNIT_ASSERT(DBL_MAX == less->getMargin(12.5));
+    less->initialize(10.0, 0, false);
+    CPPUNIT_ASSERT(DBL_MAX == less->getMargin(12.5));
+
+    delete less;
+    delete greater;
+
     UT_PASS_LAST;
 }
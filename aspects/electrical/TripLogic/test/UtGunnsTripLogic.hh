@@ -76,6 +76,8 @@ class UtGunnsTripLogic: public CppUnit::TestFixture
         void testResetTrip();
         /// @brief  Tests the accessor methods.
         void testAccessors();
+        /// @brief  Tests the getMargin method.
+        void testGetMargin();
 
     private:
         /// @brief  Sets up the suite of tests for the GunnsTripLogicric unit testing.
@@ -86,6 +88,7 @@ class UtGunnsTripLogic: public CppUnit::TestFixture
         CPPUNIT_TEST(testIsTripped);
         CPPUNIT_TEST(testResetTrip);
         CPPUNIT_TEST(testAccessors);
+        CPPUNIT_TEST(testGetMargin);
         CPPUNIT_TEST_SUITE_END();
         float        tLimit;             /**< (--) Initialization data. */
         unsigned int tPriority;          /**< (--) Initialization data. */
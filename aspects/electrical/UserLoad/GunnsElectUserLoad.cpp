@@ -7,11 +7,13 @@
 
 LIBRARY DEPENDENCY:
   ((core/GunnsNetworkSpotter.o)
-   (software/exceptions/TsInitializationException.o))
+   (software/exceptions/TsInitializationException.o)
+   (core/GunnsSnapshot.o))
 */
 
 #include "GunnsElectUserLoad.hh"
 #include "core/GunnsBasicNode.hh"
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "math/MsMath.hh"
 
@@ -157,6 +159,20 @@ void GunnsElectUserLoad::stepPostSolver(const double dt __attribute__((unused)))
     // nothing to do
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the duty cycle timer and supply voltage of this GUNNS Electrical
+///           User Load Base Spotter, and the state of its contained user load, in the given
+///           snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectUserLoad::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mDutyCycleTimer);
+    snapshot.sync(mSupplyVoltage);
+    getLoad()->snapshotState(snapshot);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  configData  (--)  Instance configuration data.
 ///
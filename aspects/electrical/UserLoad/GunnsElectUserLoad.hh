@@ -123,6 +123,8 @@ class GunnsElectUserLoad : public GunnsNetworkSpotter
         void                  step();
         /// @brief Updates the user load duty cycle function.
         void                  stepDutyCycle(const double dt);
+        /// @brief Saves or restores the spotter and user load state in a network snapshot.
+        virtual void          snapshotState(GunnsSnapshot& snapshot);
 
     protected:
         double mDutyCycleFraction;  /**< (1) trick_chkpnt_io(**) Fraction of time the load spends in the on state in its duty cycle. */
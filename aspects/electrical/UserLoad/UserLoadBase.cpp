@@ -19,6 +19,7 @@
      (UserLoadBase.o)
      (simulation/hs/TsHsMsg.o)
      (software/exceptions/TsInitializationException.o)
+     (core/GunnsSnapshot.o)
  )
 
  PROGRAMMERS:
@@ -27,6 +28,7 @@
  )
  */
 #include "UserLoadBase.hh"
+#include "core/GunnsSnapshot.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include <iostream>
@@ -345,6 +347,31 @@ void UserLoadBase::step(double voltage) {
     mPowerValid = mVoltage > mUnderVoltageLimit;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the malfunctions, operating mode, outputs and fuse state of this
+///           user load in the given snapshot.  Derived classes with their own dynamic state should
+///           call this base implementation too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UserLoadBase::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mMalfOverrideCurrentFlag);
+    snapshot.sync(mMalfOverrideCurrentValue);
+    snapshot.sync(mMalfOverridePowerFlag);
+    snapshot.sync(mMalfOverridePower);
+    snapshot.sync(mMalfBlowFuse);
+    snapshot.sync(mMagicPowerFlag);
+    snapshot.sync(mMagicPowerValue);
+    snapshot.sync(mCurrent);
+    snapshot.sync(mActualPower);
+    snapshot.sync(mLoadOperMode);
+    snapshot.sync(mEquivalentResistance);
+    snapshot.sync(mVoltage);
+    snapshot.sync(mFuseIsBlown);
+    snapshot.sync(mPowerValid);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] flag  (--)  Malfunction activation flag, true activates.
 /// @param[in] value (amp) Malfunction current value.
@@ -56,6 +56,7 @@ PURPOSE:
 // #include "aspects/electrical/UserLoad/UserLoadElect.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 
+class GunnsSnapshot;
 
 /// @brief the enum values for load type
 typedef enum  {
@@ -248,6 +249,9 @@ public:
     /// @brief Returns whether this load is initialized.
     bool isInitialized() const;
 
+    /// @brief Saves or restores the load state and malfunctions in a network snapshot.
+    virtual void snapshotState(GunnsSnapshot& snapshot);
+
     /// -- resistance value for the load assigned maximum
     static const double MAXIMUM_RESISTANCE; /**< (ohm)  trick_chkpnt_io(**) const value set later  */
     static const double MINIMUM_RESISTANCE; /**< (ohm)  trick_chkpnt_io(**) const value set later  */
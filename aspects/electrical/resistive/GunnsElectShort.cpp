@@ -14,6 +14,8 @@ LIBRARY DEPENDENCY:
 #include "math/MsMath.hh"
 #include <cfloat>
 #include "GunnsElectShort.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name   (--)  Link name.
@@ -179,6 +181,29 @@ void GunnsElectShort::restartModel()
     /// - Reset non-config & non-checkpointed class attributes (there aren't any).
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           short model and its malfunctions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectShort::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicConductor::snapshotState(snapshot);
+
+    mShort.snapshotState(snapshot);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsElectShort.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsElectShort::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsElectShort);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt        (s)  Integration time step.
 /// @param[in] minorStep (--) Not used.
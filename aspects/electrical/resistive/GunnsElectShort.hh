@@ -115,6 +115,10 @@ class GunnsElectShort : public GunnsBasicConductor
                         std::vector<GunnsBasicLink*>&    networkLinks,
                         const int                        port0,
                         const int                        port1);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief Minor Step method for non-linear networks.
         virtual void minorStep(const double dt, const int minorStep);
         /// @brief Updates the active link conductance based on current malfunctions and network conditions.
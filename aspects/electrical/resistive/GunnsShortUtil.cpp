@@ -6,10 +6,11 @@
            National Aeronautics and Space Administration.  All Rights Reserved.
 
 LIBRARY DEPENDENCY:
-    ()
+    ((core/GunnsSnapshot.o))
 */
 
 #include "GunnsShortUtil.hh"
+#include "core/GunnsSnapshot.hh"
 #include "math/MsMath.hh"
 #include <cfloat>
 
@@ -270,3 +271,27 @@ void GunnsShortUtil::setMalfResistance(const bool flag, const double value, cons
     mMalfResistanceValue = value;
     mMalfMinimumVoltage  = minV;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the malfunctions, conductance and last-pass initial malfunction
+///           values of this short in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsShortUtil::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mMalfMinimumVoltage);
+    snapshot.sync(mMalfConstantPowerFlag);
+    snapshot.sync(mMalfConstantPowerValue);
+    snapshot.sync(mMalfConstantCurrentFlag);
+    snapshot.sync(mMalfConstantCurrentValue);
+    snapshot.sync(mMalfInitialPowerFlag);
+    snapshot.sync(mMalfInitialPowerValue);
+    snapshot.sync(mMalfInitialCurrentFlag);
+    snapshot.sync(mMalfInitialCurrentValue);
+    snapshot.sync(mMalfResistanceFlag);
+    snapshot.sync(mMalfResistanceValue);
+    snapshot.sync(mShortConductance);
+    snapshot.sync(mPreviousCurrent);
+    snapshot.sync(mPreviousPower);
+}
@@ -137,6 +137,8 @@ class GunnsShortUtil
         void setMalfInitialCurrent(const bool flag = false, const double value = 0.0, const double minV = 0.0);
         /// @brief  Sets and clears the constant resistance short malfunction.
         void setMalfResistance(const bool flag = false, const double value = 0.0, const double minV = 0.0);
+        /// @brief  Saves or restores the short state and malfunctions in a network snapshot.
+        void snapshotState(GunnsSnapshot& snapshot);
 
     protected:
         double mShortConductance;         /**< (1/ohm) Conductance of the short. */
@@ -14,6 +14,8 @@
 
 #include "GunnsFluidAccum.hh"
 #include "core/GunnsFluidUtils.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 const int GunnsFluidAccum::LIQUID_PORT = 1;
@@ -874,6 +876,59 @@ void GunnsFluidAccum::restartModel()
     mFillMode    = EQUALIZED;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           bellows position, edits and malfunctions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidAccum::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidLink::snapshotState(snapshot);
+
+    snapshot.sync(mMalfBellowsStickFlag);
+    snapshot.sync(mMalfBellowsStickToPosFlag);
+    snapshot.sync(mMalfBellowsStickToPosValue);
+    snapshot.sync(mMalfBellowsStickToPosRate);
+    snapshot.sync(mEffectiveConductivity);
+    snapshot.sync(mEffConductivityScale);
+    snapshot.sync(mLiqCapacitance);
+    snapshot.sync(mBellowsPosition);
+    snapshot.sync(mLiquidPressureReading);
+    snapshot.sync(mLiquidHousingQ);
+    snapshot.sync(mLiquidVolume);
+    snapshot.sync(mPressurizerVolume);
+    snapshot.sync(mSpringCapacitance);
+    snapshot.sync(mSpringPressure);
+    snapshot.sync(mEditHoldTime);
+    snapshot.sync(mEditBellowsFlag);
+    snapshot.sync(mEditBellowsPosition);
+    snapshot.sync(mEditBellowsRate);
+    snapshot.sync(mEditBellowsTimer);
+    snapshot.sync(mEditTemperatureFlag);
+    snapshot.sync(mEditTemperatureValue);
+    snapshot.sync(mHoldAccumFlag);
+    snapshot.sync(mHoldTemperatureFlag);
+    snapshot.sync(mPressurizerOrideBellowsFlag);
+    snapshot.sync(mBellowsStuck);
+    snapshot.sync(mBellowsMalfSet);
+    snapshot.sync(mEditsAreReactive);
+    snapshot.sync(mSimultaneousEditsInProgress);
+    snapshot.sync(mFillMode);
+    snapshot.sync(mBellowsZone);
+    snapshot.sync(mAccelPressureHead);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidAccum.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidAccum::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidAccum);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] flag (--) Malfunction activation flag, true activates
 ///
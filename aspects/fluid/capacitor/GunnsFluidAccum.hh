@@ -189,6 +189,10 @@ class GunnsFluidAccum : public GunnsFluidLink {
         virtual void updateFluid(const double dt, const double);
         /// @brief Updates the state of the accumulator (admittance, conductance, source pressure)
         virtual void updateState(const double dt);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief Returns the bellows position of the accumulator
         double getBellowsPosition() const;
         /// @brief Returns the usable liquid mass in the accumulator.
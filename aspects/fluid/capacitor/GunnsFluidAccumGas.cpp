@@ -14,6 +14,8 @@
 
 #include "GunnsFluidAccumGas.hh"
 #include "core/GunnsFluidUtils.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 /// @details  Port zero of this link is always attached to a gas node.
@@ -410,6 +412,48 @@ void GunnsFluidAccumGas::restartModel()
     GunnsFluidAccum::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           pressure edits, rupture malfunction and the internal gas fluid.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidAccumGas::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidAccum::snapshotState(snapshot);
+
+    snapshot.sync(mMalfBellowsRuptureFlag);
+    snapshot.sync(mMalfBellowsRuptureBellowsPos);
+    snapshot.sync(mMalfBellowsRuptureBellowsRate);
+    snapshot.sync(mMalfBellowsRupturePress);
+    snapshot.sync(mMalfBellowsRupturePressRate);
+    snapshot.sync(mGasEffectiveConductivity);
+    snapshot.sync(mGasCapacitance);
+    snapshot.sync(mGasPressureReading);
+    snapshot.sync(mGasFlowRate);
+    snapshot.sync(mGasFlux);
+    snapshot.sync(mGasHousingQ);
+    snapshot.sync(mEditPressureFlag);
+    snapshot.sync(mEditPressureValue);
+    snapshot.sync(mEditPressureRate);
+    snapshot.sync(mEditPressureTimer);
+    snapshot.sync(mPressureMalfSet);
+    snapshot.sync(mEditHoldPressure);
+    if (mGasInternalFluid) {
+        mGasInternalFluid->snapshotState(snapshot);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidAccumGas.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidAccumGas::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidAccumGas);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] flag      (--)    Malfunction activation flag, true activates
 /// @param[in] pos       (--)    Fraction, Forced bellows position value
@@ -130,6 +130,10 @@ class GunnsFluidAccumGas : public GunnsFluidAccum {
         virtual ~GunnsFluidAccumGas();
         /// @brief Computes the flows in and out of accumulator.
         virtual void computeFlows(const double dt);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief Initializes this gas accumulator.
         void initialize(const GunnsFluidAccumGasConfigData& configData,
                         const GunnsFluidAccumGasInputData&  inputData,
@@ -15,6 +15,8 @@ PROGRAMMERS:
 
 #include "GunnsFluidTank.hh"
 #include "core/GunnsFluidUtils.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    name                 (--)   Name of object
@@ -304,6 +306,48 @@ void GunnsFluidTank::restartModel()
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           content edit controls, shell heat fluxes and the dP/dt filter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidTank::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidCapacitor::snapshotState(snapshot);
+
+    snapshot.sync(mEditTemperatureFlag);
+    snapshot.sync(mEditTemperaturePressureFlag);
+    snapshot.sync(mEditTemperaturePartialPressureFlag);
+    snapshot.sync(mEditPartialPressureRateFlag,  mNConstituents);
+    snapshot.sync(mEditTemperatureValue);
+    snapshot.sync(mEditPressureValue);
+    snapshot.sync(mEditPartialPressureValue,     mNConstituents);
+    snapshot.sync(mEditPartialPressureRateValue, mNConstituents);
+    snapshot.sync(mEditFluxTarget);
+    snapshot.sync(mBiasHeatFlux);
+    snapshot.sync(mHeatFluxFromShell);
+    snapshot.sync(mHeatFluxToShell);
+    snapshot.sync(mTemperature);
+    snapshot.sync(mShellTemperature);
+    snapshot.sync(mPreviousPressure);
+    snapshot.sync(mDensity);
+    snapshot.sync(mDpdt);
+    snapshot.sync(mPartialPressure,              mNConstituents);
+    snapshot.sync(mMassFraction,                 mNConstituents);
+    snapshot.sync(mMoleFraction,                 mNConstituents);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidTank.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidTank::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidTank);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    dt  (s)  Integration time step
 ///
@@ -129,6 +129,10 @@ class GunnsFluidTank : public  GunnsFluidCapacitor
         virtual void   computeFlows(const double dt);
         /// @brief  Updates the internal fluid of this Tank.
         virtual void   updateFluid(const double dt, const double);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief  Returns the heat flux from the tank shell.
         virtual double getHeatFlux() const;
         /// @brief  Returns the bias heat flux from the tank shell.
@@ -7,6 +7,7 @@
 
 LIBRARY DEPENDENCY:
   ((core/GunnsNetworkSpotter.o)
+   (core/GunnsSnapshot.o)
    (core/GunnsBasicConductor.o)
    (aspects/fluid/potential/GunnsGasFan.o)
    (aspects/fluid/conductor/GunnsGasTurbine.o)
@@ -18,6 +19,7 @@ LIBRARY DEPENDENCY:
 #include "GunnsDriveShaftSpotter.hh"
 #include "aspects/fluid/potential/GunnsGasFan.hh"
 #include "aspects/fluid/conductor/GunnsGasTurbine.hh"
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -289,6 +291,26 @@ void GunnsDriveShaftSpotter::stepPostSolver(const double dt __attribute__((unuse
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  snapshot  (--)  The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the shaft speed, loads and malfunctions in the given snapshot.  The
+///           connected fans and turbines are restored by the network solver with the other links.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsDriveShaftSpotter::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mMalfJamFlag);
+    snapshot.sync(mMalfJamValue);
+    snapshot.sync(mMalfSpeedOverrideFlag);
+    snapshot.sync(mMalfSpeedOverrideValue);
+    snapshot.sync(mMotorSpeed);
+    snapshot.sync(mFrictionTorque);
+    snapshot.sync(mTotalExternalLoad);
+    snapshot.sync(mPowerInFan);
+    snapshot.sync(mPowerOutTurb);
+    snapshot.sync(mPowerExcess);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  object  (--)  Object to be referenced by drive shaft.
 ///
@@ -123,6 +123,8 @@ class GunnsDriveShaftSpotter : public GunnsNetworkSpotter
         virtual void stepPreSolver(const double dt);
         /// @brief   Steps the GUNNS Drive Shaft Network Spotter after the GUNNS solver step.
         virtual void stepPostSolver(const double dt);
+        /// @brief   Saves or restores the drive shaft state in a network snapshot.
+        virtual void snapshotState(GunnsSnapshot& snapshot);
         /// @brief   Adds object pointers to the turbine and fan vectors
         void addImpeller(GunnsFluidConductor* object);
         /// @brief   Gets net power out of the shaft
@@ -24,6 +24,8 @@ PROGRAMMERS:
 **************************************************************************************************/
 
 #include "GunnsFluid3WayValve.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "core/GunnsFluidUtils.hh"
 #include "math/MsMath.hh"
 #include "software/exceptions/TsInitializationException.hh"
@@ -267,6 +269,29 @@ void GunnsFluid3WayValve::restartModel()
     GunnsFluidLink::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           valve position.  The path valves are network links, so they save their own state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluid3WayValve::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidLink::snapshotState(snapshot);
+
+    snapshot.sync(mPosition);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluid3WayValve.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluid3WayValve::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluid3WayValve);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
@@ -146,6 +146,10 @@ class GunnsFluid3WayValve : public GunnsFluidLink
                         const int                            port0,
                         const int                            port1,
                         const int                            port2);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief Steps the 3-way valve.
         virtual void step(const double dt);
         /// @brief Computes flows across the link.
@@ -19,8 +19,12 @@
  **************************************************************************************************/
 
 #include "software/exceptions/TsInitializationException.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "GunnsFluidHeatExchanger.hh"
+#include <algorithm>
+#include <cmath>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  name                  (--)  Name of object.
@@ -28,18 +32,21 @@
 /// @param[in]  maxConductivity       (m2)  Max conductivity.
 /// @param[in]  expansionScaleFactor  (--)  Scale factor for isentropic gas cooling.
 /// @param[in]  numSegs               (--)  Number of segments.
+/// @param[in]  segmentMethod         (--)  Method for updating the segments.
 ///
 /// @details  Default constructs this GUNNS Fluid Heat Exchanger link model configuration data.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 GunnsFluidHeatExchangerConfigData::GunnsFluidHeatExchangerConfigData(
-                                                            const std::string& name,
-                                                            GunnsNodeList*     nodes,
-                                                            const double       maxConductivity,
-                                                            const double       expansionScaleFactor,
-                                                            const int          numSegs)
+                                                            const std::string&  name,
+                                                            GunnsNodeList*      nodes,
+                                                            const double        maxConductivity,
+                                                            const double        expansionScaleFactor,
+                                                            const int           numSegs,
+                                                            const SegmentMethod segmentMethod)
     :
     GunnsFluidConductorConfigData(name, nodes, maxConductivity, expansionScaleFactor),
-    mNumSegs(numSegs)
+    mNumSegs(numSegs),
+    mSegmentMethod(segmentMethod)
 {
     // nothing to do
 }
@@ -53,7 +60,8 @@ GunnsFluidHeatExchangerConfigData::GunnsFluidHeatExchangerConfigData(
                                                       const GunnsFluidHeatExchangerConfigData& that)
     :
     GunnsFluidConductorConfigData(that),
-    mNumSegs(that.mNumSegs)
+    mNumSegs(that.mNumSegs),
+    mSegmentMethod(that.mSegmentMethod)
 {
     // nothing to do
 }
@@ -135,7 +143,8 @@ GunnsFluidHeatExchanger::GunnsFluidHeatExchanger()
     mSegEnergyGain(0),
     mTotalEnergyGain(0.0),
     mDeltaTemperature(0.0),
-    mTemperatureOverride(0.0)
+    mTemperatureOverride(0.0),
+    mSegmentMethod(GunnsFluidHeatExchangerConfigData::MARCHING)
 {
     // nothing to do
 }
@@ -184,7 +193,8 @@ void GunnsFluidHeatExchanger::initialize(const GunnsFluidHeatExchangerConfigData
     validate(configData, inputData);
 
     /// - Initialize with configuration data.
-    mNumSegs = configData.mNumSegs;
+    mNumSegs       = configData.mNumSegs;
+    mSegmentMethod = configData.mSegmentMethod;
 
     /// - Delete any old arrays and allocate new ones.
     TS_DELETE_ARRAY(mSegEnergyGain);
@@ -256,6 +266,13 @@ void GunnsFluidHeatExchanger::validate(const GunnsFluidHeatExchangerConfigData&
                     "Number of segments < 1.");
     }
 
+    /// - Throw an exception if the segment method is invalid.
+    if (configData.mSegmentMethod < GunnsFluidHeatExchangerConfigData::MARCHING or
+        configData.mSegmentMethod > GunnsFluidHeatExchangerConfigData::CORRECTED_PROPERTY) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "Invalid segment method.");
+    }
+
     /// - Throw an exception if default heat transfer coefficient < FLT_EPSILON.
     if (inputData.mHeatTransferCoefficient < static_cast<double>(FLT_EPSILON)) {
         GUNNS_ERROR(TsInitializationException, "Invalid Input Data",
@@ -282,6 +299,38 @@ void GunnsFluidHeatExchanger::restartModel()
     mDeltaTemperature = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           segment temperatures from the thermal aspect and the segment malfunctions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidHeatExchanger::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidConductor::snapshotState(snapshot);
+
+    snapshot.sync(mMalfHxDegradeFlag);
+    snapshot.sync(mMalfHxDegradeValue);
+    snapshot.sync(mMalfSegDegradeFlag,  mNumSegs);
+    snapshot.sync(mMalfSegDegradeValue, mNumSegs);
+    snapshot.sync(mSegHtc,              mNumSegs);
+    snapshot.sync(mSegTemperature,      mNumSegs);
+    snapshot.sync(mSegEnergyGain,       mNumSegs);
+    snapshot.sync(mTotalEnergyGain);
+    snapshot.sync(mDeltaTemperature);
+    snapshot.sync(mTemperatureOverride);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidHeatExchanger.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidHeatExchanger::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidHeatExchanger);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  dt        (s)     Time step.
 /// @param[in]  flowRate  (kg/s)  Mass flow rate.
@@ -331,6 +380,14 @@ void GunnsFluidHeatExchanger::updateSegments(const double dt, const double flowR
         /// - Apply temperature override on the internal fluid before the first segment.
         applyTemperatureOverride();
 
+        /// - The constant property methods skip the segment loop below, except with the temperature
+        ///   override, which needs the fluid properties in each segment for energy conservation.
+        if (GunnsFluidHeatExchangerConfigData::MARCHING != mSegmentMethod and
+                static_cast<double>(FLT_EPSILON) >= mTemperatureOverride) {
+            updateSegmentsConstantProperty(flowRate, start, end, inc);
+            return;
+        }
+
         /// - Perform the heat transfer in each segment and add the calculated heat flux to the
         ///   total.  Then apply the temperature override to the segment exit temperature.  The
         ///   internal fluid takes the fluid exit temperature of each segment and is re-used as the
@@ -351,6 +408,87 @@ void GunnsFluidHeatExchanger::updateSegments(const double dt, const double flowR
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  flowRate  (kg/s)  Mass flow rate.
+/// @param[in]  start     (--)    Index of the first segment in the flow direction.
+/// @param[in]  end       (--)    Index past the last segment in the flow direction.
+/// @param[in]  inc       (--)    Segment index increment in the flow direction.
+///
+/// @details  Updates the segment energy gains and the internal fluid exit temperature using the
+///           specific heat of the inlet fluid in all segments, and optionally corrects the specific
+///           heat once to the mean of the inlet and the first outlet estimate.  The internal fluid
+///           properties are only updated at the outlet, once or twice.  The segment energy gains
+///           are scaled so their total matches the enthalpy change of the internal fluid, for
+///           energy conservation with the downstream node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidHeatExchanger::updateSegmentsConstantProperty(const double flowRate,
+                                                             const int    start,
+                                                             const int    end,
+                                                             const int    inc)
+{
+    const double mDot             = std::fabs(flowRate);
+    const double inletTemperature = mInternalFluid->getTemperature();
+    const double inletEnthalpy    = mInternalFluid->getSpecificEnthalpy();
+    const double inletCp          = mInternalFluid->getSpecificHeat();
+    double outletTemperature = computeSegmentsConstantProperty(mDot * inletCp, inletTemperature,
+                                                               start, end, inc);
+    mInternalFluid->setTemperature(outletTemperature);
+
+    /// - For the corrected method, repeat with the mean of the inlet and outlet specific heats.
+    if (GunnsFluidHeatExchangerConfigData::CORRECTED_PROPERTY == mSegmentMethod and
+            std::fabs(inletTemperature - outletTemperature) > static_cast<double>(FLT_EPSILON)) {
+        const double meanCp = 0.5 * (inletCp + mInternalFluid->getSpecificHeat());
+        outletTemperature   = computeSegmentsConstantProperty(mDot * meanCp, inletTemperature,
+                                                              start, end, inc);
+        mInternalFluid->setTemperature(outletTemperature);
+    }
+
+    /// - Scale the segment energy gains to the fluid enthalpy change.
+    if (std::fabs(mTotalEnergyGain) > DBL_EPSILON) {
+        const double scale = mDot * (inletEnthalpy - mInternalFluid->getSpecificEnthalpy())
+                           / mTotalEnergyGain;
+        for (int i = 0; i < mNumSegs; ++i) {
+            mSegEnergyGain[i] *= scale;
+        }
+        mTotalEnergyGain *= scale;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  mDotCp            (W/K)  Mass flow rate times fluid specific heat.
+/// @param[in]  inletTemperature  (K)    Fluid temperature at the heat exchanger inlet.
+/// @param[in]  start             (--)   Index of the first segment in the flow direction.
+/// @param[in]  end               (--)   Index past the last segment in the flow direction.
+/// @param[in]  inc               (--)   Segment index increment in the flow direction.
+///
+/// @returns  double  (K)  Fluid temperature at the heat exchanger outlet.
+///
+/// @details  Steps the fluid temperature through the segments with the effectiveness-NTU relation
+///           for a constant wall temperature, the same as GunnsFluidUtils::computeConvectiveHeatFlux
+///           does with constant fluid properties, and stores the segment and total energy gains.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidHeatExchanger::computeSegmentsConstantProperty(const double mDotCp,
+                                                                const double inletTemperature,
+                                                                const int    start,
+                                                                const int    end,
+                                                                const int    inc)
+{
+    double temperature = inletTemperature;
+    mTotalEnergyGain   = 0.0;
+    for (int i = start; i != end; i += inc) {
+        mSegEnergyGain[i] = 0.0;
+        if (mDotCp > DBL_EPSILON and mSegHtc[i] > DBL_EPSILON) {
+            const double ntu   = std::min(mSegHtc[i], 100.0 * mDotCp) / mDotCp;
+            const double exitT = mSegTemperature[i]
+                               + std::exp(-ntu) * (temperature - mSegTemperature[i]);
+            mSegEnergyGain[i] = mDotCp * (temperature - exitT);
+            temperature       = exitT;
+        }
+        mTotalEnergyGain += mSegEnergyGain[i];
+    }
+    return temperature;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Applies the override temperature value (if it is above absolute zero) to the link's
 ///           internal fluid.  If the override temperature value is zero, nothing is done.
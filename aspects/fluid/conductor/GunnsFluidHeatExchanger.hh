@@ -45,13 +45,21 @@
 class GunnsFluidHeatExchangerConfigData: public GunnsFluidConductorConfigData
 {
     public:
-       int mNumSegs;                         /**< (--) trick_chkpnt_io(**) Number of segments for this Heat Exchanger */
+       /// @brief    Enumeration of the methods for updating the segments.
+       enum SegmentMethod {
+           MARCHING           = 0, ///< Update the fluid properties in each segment.
+           CONSTANT_PROPERTY  = 1, ///< Use the inlet fluid properties in all segments.
+           CORRECTED_PROPERTY = 2  ///< Use the inlet properties corrected once at the outlet.
+       };
+       int           mNumSegs;               /**< (--) trick_chkpnt_io(**) Number of segments for this Heat Exchanger */
+       SegmentMethod mSegmentMethod;         /**< (--) trick_chkpnt_io(**) Method for updating the segments */
        /// @brief    Default constructs this Heat Exchanger configuration data.
-       GunnsFluidHeatExchangerConfigData(const std::string& name                 = "",
-                                         GunnsNodeList*     nodes                = 0,
-                                         const double       maxConductivity      = 0.0,
-                                         const double       expansionScaleFactor = 0.0,
-                                         const int          numSegs              = 0);
+       GunnsFluidHeatExchangerConfigData(const std::string&  name                 = "",
+                                         GunnsNodeList*      nodes                = 0,
+                                         const double        maxConductivity      = 0.0,
+                                         const double        expansionScaleFactor = 0.0,
+                                         const int           numSegs              = 0,
+                                         const SegmentMethod segmentMethod        = MARCHING);
        /// @brief    Copy constructs this Heat Exchanger configuration data.
        GunnsFluidHeatExchangerConfigData(const GunnsFluidHeatExchangerConfigData& that);
        /// @brief    Default destructs this Heat Exchanger configuration data.
@@ -100,6 +108,15 @@ class GunnsFluidHeatExchangerInputData : public GunnsFluidConductorInputData
 ///
 /// @details  The GUNNS Fluid Heat Exchanger link model simulates a flow path through a segmented
 ///           pipe in a heat exchanger.
+///
+///           By default, the internal fluid is marched through the segments, updating its
+///           temperature and properties in each segment.  Optionally, the segment exit temperatures
+///           are found with an effectiveness-NTU recurrence using the specific heat of the inlet
+///           fluid, and the internal fluid temperature is set once at the outlet.  This is much
+///           faster for many segments, and is accurate when the specific heat doesn't vary much
+///           over the temperature change, such as for liquid coolants.  The corrected option
+///           repeats the recurrence once with the mean specific heat between the inlet and the
+///           first outlet estimate.  The temperature override always uses the marching method.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsFluidHeatExchanger : public  GunnsFluidConductor
 {
@@ -126,12 +143,18 @@ class GunnsFluidHeatExchanger : public  GunnsFluidConductor
                         const int                                port1);
         /// @brief    Updates the internal fluid of this Heat Exchanger.
         virtual void updateFluid(const double dt, const double flowRate);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief    Gets the energy gain from this Heat Exchanger.
         double getTotalEnergyGain() const;
         /// @brief    Gets the delta temperature from this Heat Exchanger.
         double getDeltaTemperature() const;
         /// @brief    Gets the number of segments from this Heat Exchanger.
         int getNumSegs() const;
+        /// @brief    Gets a segment energy gain from this Heat Exchanger.
+        double getSegEnergyGain(const int segment) const;
         /// @brief Sets and resets the HX heat transfer degradation malfunction.
         void setMalfHxDegrade(const bool flag = false, const double value = 0.0);
         /// @brief Sets and resets a segment heat transfer degradation malfunction.
@@ -150,6 +173,7 @@ class GunnsFluidHeatExchanger : public  GunnsFluidConductor
         double  mTotalEnergyGain;         /**<    (W)   trick_chkpnt_io(**) Total heat exchanger energy gain */
         double  mDeltaTemperature;        /**<    (K)   trick_chkpnt_io(**) Change in temperature across heat exchanger */
         double  mTemperatureOverride;     /**<    (K)                       Temperature override-to value (0 turns off) */
+        GunnsFluidHeatExchangerConfigData::SegmentMethod mSegmentMethod; /**< (--) trick_chkpnt_io(**) Method for updating the segments */
         /// @brief    Validates the initialization of this Heat Exchanger.
         void validate(const GunnsFluidHeatExchangerConfigData& configData,
                       const GunnsFluidHeatExchangerInputData&  inputData) const;
@@ -161,6 +185,17 @@ class GunnsFluidHeatExchanger : public  GunnsFluidConductor
         virtual void updateSegments(const double dt, const double flowRate);
         /// @brief    Applies the temperature override to the internal fluid.
         virtual void applyTemperatureOverride();
+        /// @brief    Updates the segments with constant fluid properties.
+        void updateSegmentsConstantProperty(const double flowRate,
+                                            const int    start,
+                                            const int    end,
+                                            const int    inc);
+        /// @brief    Computes the segment exit temperatures and energy gains for a specific heat.
+        double computeSegmentsConstantProperty(const double mDotCp,
+                                               const double inletTemperature,
+                                               const int    start,
+                                               const int    end,
+                                               const int    inc);
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details  Copy constructor unavailable since declared private and not implemented.
@@ -205,4 +240,20 @@ inline int GunnsFluidHeatExchanger::getNumSegs() const
     return mNumSegs;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] segment (--) Segment number.
+///
+/// @return   (W)  Segment energy gain, or zero for an invalid segment number.
+///
+/// @details  Returns the energy gain of the given segment of this GUNNS Fluid Heat Exchanger link
+///           model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsFluidHeatExchanger::getSegEnergyGain(const int segment) const
+{
+    if (segment >= 0 and segment < mNumSegs) {
+        return mSegEnergyGain[segment];
+    }
+    return 0.0;
+}
+
 #endif
@@ -22,6 +22,8 @@ PROGRAMMERS:
 **************************************************************************************************/
 
 #include "core/GunnsFluidUtils.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
@@ -217,6 +219,35 @@ void GunnsFluidLeak::restartModel()
     GunnsFluidConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           leak malfunctions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidLeak::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidConductor::snapshotState(snapshot);
+
+    snapshot.sync(mMalfLeakHoleFlag);
+    snapshot.sync(mMalfLeakHoleValue);
+    snapshot.sync(mMalfLeakRateFlag);
+    snapshot.sync(mMalfLeakRateValue);
+    snapshot.sync(mPreviousLeakHole);
+    snapshot.sync(mPreviousLeakRate);
+    snapshot.sync(mLeakConductivity);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidLeak.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidLeak::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidLeak);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s)  Time step (not used).
 ///
@@ -121,6 +121,10 @@ class GunnsFluidLeak : public  GunnsFluidConductor
                         std::vector<GunnsBasicLink*>&   networkLinks,
                         const int                       port0,
                         const int                       port1);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief    Sets and resets the leak effective hole area malfunction.
         void setMalfLeakHole(const bool flag = false, const double value = 0.0);
         /// @brief    Sets and resets the leak initial rate malfunction.
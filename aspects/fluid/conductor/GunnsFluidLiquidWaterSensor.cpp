@@ -10,6 +10,8 @@ PROGRAMMERS:
 **************************************************************************************************/
 
 #include "simulation/hs/TsHsMsg.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 
@@ -185,6 +187,32 @@ void GunnsFluidLiquidWaterSensor::restartModel()
     GunnsFluidConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           sensed truth values.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidLiquidWaterSensor::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidConductor::snapshotState(snapshot);
+
+    snapshot.sync(mLiquidPresent);
+    snapshot.sync(mRelativeHumidity);
+    snapshot.sync(mDewPoint);
+    snapshot.sync(mSaturationPressure);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidLiquidWaterSensor.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidLiquidWaterSensor::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidLiquidWaterSensor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Time step.
 ///
@@ -108,6 +108,10 @@ class GunnsFluidLiquidWaterSensor : public GunnsFluidConductor
                         std::vector<GunnsBasicLink*>&     networkLinks,
                         const int                         port0,
                         const int                         port1);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief    Returns true if liquid water is present.
         bool   getLiquidPresent() const;
         /// @brief    Returns the relative humidity.
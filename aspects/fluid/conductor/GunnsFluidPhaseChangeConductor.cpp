@@ -10,6 +10,8 @@ LIBRARY DEPENDENCY:
 */
 
 #include "GunnsFluidPhaseChangeConductor.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
@@ -295,6 +297,37 @@ void GunnsFluidPhaseChangeConductor::restartModel()
     GunnsFluidConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           wall temperature input and the internal liquid and gas fluids.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidPhaseChangeConductor::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidConductor::snapshotState(snapshot);
+
+    snapshot.sync(mEfficiency);
+    snapshot.sync(mWallHeatFlux);
+    snapshot.sync(mWallTemperature);
+    if (mLiquidFluid) {
+        mLiquidFluid->snapshotState(snapshot);
+    }
+    if (mGasFluid) {
+        mGasFluid->snapshotState(snapshot);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidPhaseChangeConductor.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidPhaseChangeConductor::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidPhaseChangeConductor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] forcedOutflow (--) not used.
 /// @param[in] fromPort      (--) not used.
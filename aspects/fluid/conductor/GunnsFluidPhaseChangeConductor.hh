@@ -115,6 +115,10 @@ class GunnsFluidPhaseChangeConductor : public  GunnsFluidConductor
                         std::vector<GunnsBasicLink*>&                   networkLinks,
                         const int                                       port0,
                         const int                                       port1);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief  Moves the fluid from one port to the other.
         virtual void transportFluid(const bool forcedOutflow,
                                     const int  fromPort = 0,
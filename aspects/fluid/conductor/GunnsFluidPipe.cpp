@@ -12,6 +12,8 @@ LIBRARY DEPENDENCY:
 #include "software/exceptions/TsInitializationException.hh"
 
 #include "GunnsFluidPipe.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]      name                 (--)    Name of object.
@@ -207,6 +209,30 @@ void GunnsFluidPipe::restartModel()
     GunnsFluidConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           wall temperature and heat flux.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidPipe::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidConductor::snapshotState(snapshot);
+
+    snapshot.sync(mWallTemperature);
+    snapshot.sync(mWallHeatFlux);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidPipe.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidPipe::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidPipe);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]      dt        (s)     Time step.
 /// @param[in]      flowRate  (kg/s)  Mass flow rate.
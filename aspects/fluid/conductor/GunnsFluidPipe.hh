@@ -108,6 +108,10 @@ class GunnsFluidPipe : public GunnsFluidConductor
                         std::vector<GunnsBasicLink*>&   networkLinks,
                         const int                       port0,
                         const int                       port1);
+        /// @brief    Saves or restores the link dynamic state in a network snapshot.
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief    Returns whether snapshotState includes all of the link's dynamic state.
+        virtual bool isSnapshotSupported() const;
         /// @brief    Returns the pipe segment heat flux.
         double getPipeHeatFlux() const;
         /// @brief    Sets the thermal surface area of this Pipe.
@@ -10,6 +10,8 @@ LIBRARY DEPENDENCY:
 */
 
 #include "math/MsMath.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "core/GunnsFluidUtils.hh"
 
@@ -354,6 +356,49 @@ void GunnsFluidPressureSensitiveValve::restartModel()
     mInletDependencyBias   = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           valve position, malfunctions and link tuning controls.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidPressureSensitiveValve::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidLink::snapshotState(snapshot);
+
+    snapshot.sync(mMalfLeakThruFlag);
+    snapshot.sync(mMalfLeakThruValue);
+    snapshot.sync(mMalfPressureBiasFlag);
+    snapshot.sync(mMalfPressureBiasValue);
+    snapshot.sync(mMalfStuckFlag);
+    snapshot.sync(mMalfFailToFlag);
+    snapshot.sync(mMalfFailToValue);
+    snapshot.sync(mPosition);
+    snapshot.sync(mSetPointPressureBias);
+    snapshot.sync(mWallTemperature);
+    snapshot.sync(mPreviousLeakRate);
+    snapshot.sync(mLeakConductivity);
+    snapshot.sync(mTuneMode);
+    snapshot.sync(mTuneMassFlow);
+    snapshot.sync(mTuneVolFlow);
+    snapshot.sync(mTuneDeltaT);
+    snapshot.sync(mInletDependencyBias);
+    snapshot.sync(mEffectiveConductivity);
+    snapshot.sync(mSystemConductance);
+    snapshot.sync(mControlPressure);
+    snapshot.sync(mWallHeatFlux);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidPressureSensitiveValve.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidPressureSensitiveValve::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidPressureSensitiveValve);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]      port  (--)  The port to be assigned (not used).
 /// @param[in]      node  (--)  The desired node to assign the port to (not used).
@@ -155,6 +155,10 @@ class GunnsFluidPressureSensitiveValve : public GunnsFluidLink
         virtual void computeFlows(const double dt);
         /// @brief  Transports the flows in this Pressure Sensitive Valve.
         virtual void transportFlows(const double dt);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
        /// @brief   Gets the position of this Pressure Sensitive Valve.
         double getPosition() const;
         /// @brief  Sets the position on this Pressure Sensitive Valve.
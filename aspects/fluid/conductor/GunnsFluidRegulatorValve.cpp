@@ -12,6 +12,8 @@ LIBRARY DEPENDENCY:
 #include <algorithm>
 
 #include "math/MsMath.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
@@ -305,6 +307,29 @@ void GunnsFluidRegulatorValve::restartModel()
     GunnsFluidPressureSensitiveValve::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidRegulatorValve::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidPressureSensitiveValve::snapshotState(snapshot);
+
+    snapshot.sync(mPreviousPressure);
+    snapshot.sync(mState);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidRegulatorValve.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidRegulatorValve::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidRegulatorValve);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return         void
 ///
@@ -157,6 +157,10 @@ class GunnsFluidRegulatorValve : public  GunnsFluidPressureSensitiveValve
                         const int                                  port1,
                         const int                                  pressurePort0,
                         const int                                  pressurePort1);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief    Returns the valve state of the regulator
         GunnsFluidValve::State getState() const;
     protected:
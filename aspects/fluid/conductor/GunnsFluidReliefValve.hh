@@ -158,6 +158,10 @@ class GunnsFluidReliefValve : public  GunnsFluidPressureSensitiveValve
                         const int                              port1,
                         const int                              pressurePort0,
                         const int                              pressurePort1);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief    Returns the state of the fluid relief valve
         GunnsFluidValve::State getState() const;
     protected:
@@ -7,6 +7,8 @@ LIBRARY DEPENDENCY:
 ***************************************************************************************************/
 
 #include "GunnsFluidSensor.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  name                  (--)   Name of object.
@@ -154,6 +156,34 @@ void GunnsFluidSensor::restartModel()
     GunnsFluidConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           sensed truth values.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidSensor::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidConductor::snapshotState(snapshot);
+
+    snapshot.sync(mTemperature);
+    snapshot.sync(mPressure);
+    snapshot.sync(mDeltaPressure);
+    snapshot.sync(mMassFlowRate);
+    snapshot.sync(mVolumetricFlowRate);
+    snapshot.sync(mPartialPressure, FluidProperties::NO_FLUID);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidSensor.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidSensor::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidSensor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  dt  (s)  Integration time step.
 ///
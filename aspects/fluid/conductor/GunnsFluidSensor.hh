@@ -105,6 +105,10 @@ class GunnsFluidSensor : public  GunnsFluidConductor
                         const int                         port1);
         /// @brief    Transport Flows.
         virtual void transportFlows(const double dt);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief    Returns the truth value from this Sensor for a fluid temperature sensor
         double       getTemperature() const;
         /// @brief    Returns the truth value from this Sensor for a fluid pressure sensor
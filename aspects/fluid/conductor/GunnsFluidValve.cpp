@@ -22,6 +22,8 @@ PROGRAMMERS:
 **************************************************************************************************/
 
 #include "core/GunnsFluidUtils.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
@@ -249,6 +251,35 @@ void GunnsFluidValve::restartModel()
     GunnsFluidConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           valve position and leak malfunction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidValve::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidConductor::snapshotState(snapshot);
+
+    snapshot.sync(mMalfLeakThruFlag);
+    snapshot.sync(mMalfLeakThruValue);
+    snapshot.sync(mWallTemperature);
+    snapshot.sync(mWallHeatFlux);
+    snapshot.sync(mPosition);
+    snapshot.sync(mPreviousLeakRate);
+    snapshot.sync(mLeakConductivity);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidValve.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidValve::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidValve);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s)  Time step (not used).
 ///
@@ -124,6 +124,10 @@ class GunnsFluidValve : public  GunnsFluidConductor
                         std::vector<GunnsBasicLink*>&      networkLinks,
                         const int                          port0,
                         const int                          port1);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief  Returns the heat flux from the fluid to the tube wall.
         double getWallHeatFlux() const;
         /// @brief    Gets the valve position of this Valve.
@@ -12,6 +12,8 @@ LIBRARY DEPENDENCY:
 
 #include "GunnsGasTurbine.hh"
 
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "math/MsMath.hh"
 
@@ -439,6 +441,38 @@ void GunnsGasTurbine::restartModel()
     mPressureDrop       = 0.0;
     mEfficiency         = 0.0;
 }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           motor speed and wall temperature inputs.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsGasTurbine::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidConductor::snapshotState(snapshot);
+
+    snapshot.sync(mMotorSpeed);
+    snapshot.sync(mWallTemperature);
+    snapshot.sync(mImpellerSpeed);
+    snapshot.sync(mPressureRatio);
+    snapshot.sync(mPressureDrop);
+    snapshot.sync(mEfficiency);
+    snapshot.sync(mWallHeatFlux);
+    snapshot.sync(mImpellerTorque);
+    snapshot.sync(mImpellerPower);
+    snapshot.sync(mPredictedFlowRate);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsGasTurbine.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsGasTurbine::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsGasTurbine);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s)  Time step (not used).
 ///
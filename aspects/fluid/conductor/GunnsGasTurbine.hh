@@ -184,6 +184,10 @@ class GunnsGasTurbine : public GunnsFluidConductor
                           std::vector<GunnsBasicLink*>&       links,
                           const int                           port0,
                           const int                           port1);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief  Returns the heat flux from the fluid to the impeller wall.
         double getWallHeatFlux();
         /// @brief  Returns the fluid torque assisting impeller rotation.
@@ -159,6 +159,7 @@ void UtGunnsFluidHeatExchanger::testConfigAndInput()
     CPPUNIT_ASSERT(mMaxConductivity           == mConfigData->mMaxConductivity);
     CPPUNIT_ASSERT(mExpansionScaleFactor      == mConfigData->mExpansionScaleFactor);
     CPPUNIT_ASSERT(mNumSegs                   == mConfigData->mNumSegs);
+    CPPUNIT_ASSERT(GunnsFluidHeatExchangerConfigData::MARCHING == mConfigData->mSegmentMethod);
 
     /// @test    Input data nominal construction.
     CPPUNIT_ASSERT(mMalfBlockageFlag          == mInputData->mMalfBlockageFlag);
@@ -174,6 +175,7 @@ void UtGunnsFluidHeatExchanger::testConfigAndInput()
     CPPUNIT_ASSERT(0.0                        == defaultConfig.mMaxConductivity);
     CPPUNIT_ASSERT(0.0                        == defaultConfig.mExpansionScaleFactor);
     CPPUNIT_ASSERT(0                          == defaultConfig.mNumSegs);
+    CPPUNIT_ASSERT(GunnsFluidHeatExchangerConfigData::MARCHING == defaultConfig.mSegmentMethod);
 
     /// @test    Input data default construction.
     GunnsFluidHeatExchangerInputData defaultInput;
@@ -184,12 +186,14 @@ void UtGunnsFluidHeatExchanger::testConfigAndInput()
     CPPUNIT_ASSERT(0                          == defaultInput.mSegmentHtcOverrides);
 
     /// @test    Configuration data copy construction.
+    mConfigData->mSegmentMethod = GunnsFluidHeatExchangerConfigData::CORRECTED_PROPERTY;
     GunnsFluidHeatExchangerConfigData copyConfig(*mConfigData);
     CPPUNIT_ASSERT(mName                      == copyConfig.mName);
     CPPUNIT_ASSERT(mNodeList.mNodes           == copyConfig.mNodeList->mNodes);
     CPPUNIT_ASSERT(mMaxConductivity           == copyConfig.mMaxConductivity);
     CPPUNIT_ASSERT(mExpansionScaleFactor      == copyConfig.mExpansionScaleFactor);
     CPPUNIT_ASSERT(mNumSegs                   == copyConfig.mNumSegs);
+    CPPUNIT_ASSERT(GunnsFluidHeatExchangerConfigData::CORRECTED_PROPERTY == copyConfig.mSegmentMethod);
 
     /// @test    Input data copy construction.
     double tSegmentHtc[4]            = {0.0};
@@ -260,6 +264,7 @@ void UtGunnsFluidHeatExchanger::testInitialization ()
     CPPUNIT_ASSERT(mMaxConductivity               == article.mMaxConductivity);
     CPPUNIT_ASSERT(mExpansionScaleFactor          == article.mExpansionScaleFactor);
     CPPUNIT_ASSERT(mNumSegs                       == article.mNumSegs);
+    CPPUNIT_ASSERT(GunnsFluidHeatExchangerConfigData::MARCHING == article.mSegmentMethod);
 
     /// @test    Nominal input data.
     CPPUNIT_ASSERT(mMalfBlockageFlag              == article.mMalfBlockageFlag);
@@ -321,6 +326,12 @@ void UtGunnsFluidHeatExchanger::testAccessors()
     /// - @test getNumSegs method
     CPPUNIT_ASSERT( mNumSegs == mArticle->getNumSegs());
 
+    /// - @test getSegEnergyGain method
+    mArticle->mSegEnergyGain[mNumSegs-1] = 4.4;
+    CPPUNIT_ASSERT( 4.4 == mArticle->getSegEnergyGain(mNumSegs-1));
+    CPPUNIT_ASSERT( 0.0 == mArticle->getSegEnergyGain(-1));
+    CPPUNIT_ASSERT( 0.0 == mArticle->getSegEnergyGain(mNumSegs));
+
     /// - @test setSegTemperature method
     mArticle->setSegTemperature(0, 123.456);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(123.456, mArticle->mSegTemperature[0], mTolerance);
@@ -580,6 +591,12 @@ void UtGunnsFluidHeatExchanger::testInitializationExceptions()
                          TsInitializationException);
     mConfigData->mNumSegs = mNumSegs;
 
+    /// @test    Initialization exception on invalid config data: invalid segment method.
+    mConfigData->mSegmentMethod = static_cast<GunnsFluidHeatExchangerConfigData::SegmentMethod>(3);
+    CPPUNIT_ASSERT_THROW(article.initialize(*mConfigData, *mInputData, mLinks, mPort0, mPort1),
+                         TsInitializationException);
+    mConfigData->mSegmentMethod = GunnsFluidHeatExchangerConfigData::MARCHING;
+
     /// @test    Initialization exception on invalid input data: mMalfBlockageValue < 0.
     mInputData->mMalfBlockageValue = -static_cast<double>(FLT_EPSILON);
     CPPUNIT_ASSERT_THROW(article.initialize(*mConfigData, *mInputData, mLinks, mPort0, mPort1),
@@ -607,6 +624,98 @@ void UtGunnsFluidHeatExchanger::testInitializationExceptions()
     UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Heat Exchanger link model constant and corrected property segment
+///           methods, against the marching method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidHeatExchanger::testSegmentMethods()
+{
+    UT_RESULT;
+
+    /// - Initialize articles with each segment method, more segments and a higher heat transfer
+    ///   coefficient, and different segment temperatures so the flow direction matters.
+    mConfigData->mNumSegs                = 10;
+    mInputData->mHeatTransferCoefficient = 500.0;
+    FriendlyGunnsFluidHeatExchanger articles[3];
+    for (int method = 0; method < 3; ++method) {
+        mConfigData->mSegmentMethod =
+                static_cast<GunnsFluidHeatExchangerConfigData::SegmentMethod>(method);
+        articles[method].initialize(*mConfigData, *mInputData, mLinks, mPort0, mPort1);
+        for (int i = 0; i < 10; ++i) {
+            articles[method].setSegmentTemp(i, 280.0 + 5.0 * i);
+        }
+    }
+
+    /// @test    Forward and reverse flow outlet temperatures and energy gains match the marching
+    ///          method, and the total energy gain matches the fluid enthalpy change.  The internal
+    ///          fluid is reset to the inlet node state before each update, as in the link transport.
+    const double flowRates[2] = {mFlowRate, -mFlowRate};
+    for (int dir = 0; dir < 2; ++dir) {
+        for (int method = 0; method < 3; ++method) {
+            articles[method].getFluid()->setState(mNodes[dir].getContent());
+            articles[method].updateFluid(mTimeStep, flowRates[dir]);
+        }
+        const double marchingT = articles[0].getFluid()->getTemperature();
+        CPPUNIT_ASSERT(std::fabs(marchingT - 295.0) > 1.0);
+        for (int method = 1; method < 3; ++method) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(marchingT, articles[method].getFluid()->getTemperature(),
+                                         0.05);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(articles[0].getTotalEnergyGain(),
+                                         articles[method].getTotalEnergyGain(),
+                                         0.02 * std::fabs(articles[0].getTotalEnergyGain()));
+            double sum = 0.0;
+            for (int i = 0; i < 10; ++i) {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(articles[0].getEnergyGain(i),
+                                             articles[method].getEnergyGain(i),
+                                             0.05 * std::fabs(articles[0].getEnergyGain(i)));
+                sum += articles[method].getEnergyGain(i);
+            }
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(articles[method].getTotalEnergyGain(), sum, 1.0e-8);
+            const double dh = mNodes[0].getContent()->getSpecificEnthalpy()
+                            - articles[method].getFluid()->getSpecificEnthalpy();
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(mFlowRate * dh, articles[method].getTotalEnergyGain(),
+                                         1.0e-6 * std::fabs(articles[method].getTotalEnergyGain()));
+        }
+    }
+
+    /// @test    The corrected method is closer to the marching method than the constant method.
+    for (int method = 0; method < 3; ++method) {
+        articles[method].getFluid()->setState(mNodes[0].getContent());
+        articles[method].updateFluid(mTimeStep, mFlowRate);
+    }
+    CPPUNIT_ASSERT(std::fabs(articles[2].getFluid()->getTemperature() -
+                             articles[0].getFluid()->getTemperature()) <=
+                   std::fabs(articles[1].getFluid()->getTemperature() -
+                             articles[0].getFluid()->getTemperature()));
+
+    /// @test    Temperature override uses the marching method.
+    articles[0].mTemperatureOverride = 285.0;
+    articles[2].mTemperatureOverride = 285.0;
+    articles[0].getFluid()->setState(mNodes[0].getContent());
+    articles[2].getFluid()->setState(mNodes[0].getContent());
+    articles[0].updateFluid(mTimeStep, mFlowRate);
+    articles[2].updateFluid(mTimeStep, mFlowRate);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(285.0, articles[2].getFluid()->getTemperature(), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(articles[0].getTotalEnergyGain(),
+                                 articles[2].getTotalEnergyGain(), DBL_EPSILON);
+    articles[0].mTemperatureOverride = 0.0;
+    articles[2].mTemperatureOverride = 0.0;
+
+    /// @test    No heat transfer with zero heat transfer coefficient.
+    for (int i = 0; i < 10; ++i) {
+        articles[1].mSegHtcDefault[i] = 0.0;
+    }
+    articles[1].getFluid()->setState(mNodes[0].getContent());
+    articles[1].updateFluid(mTimeStep, mFlowRate);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(295.0, articles[1].getFluid()->getTemperature(), 1.0e-8);
+    CPPUNIT_ASSERT(0.0 == articles[1].getTotalEnergyGain());
+    for (int i = 0; i < 10; ++i) {
+        CPPUNIT_ASSERT(0.0 == articles[1].getEnergyGain(i));
+    }
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Tests for GUNNS Fluid Heat Exchanger link model restart.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
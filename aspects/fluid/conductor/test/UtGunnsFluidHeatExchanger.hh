@@ -89,6 +89,8 @@ class UtGunnsFluidHeatExchanger: public CppUnit::TestFixture {
         void testHtc();
         /// @brief    Tests initialize method exceptions.
         void testInitializationExceptions();
+        /// @brief    Tests the constant and corrected property segment methods.
+        void testSegmentMethods();
         /// @brief    Tests restart method.
         void testRestart();
 
@@ -104,6 +106,7 @@ class UtGunnsFluidHeatExchanger: public CppUnit::TestFixture {
         CPPUNIT_TEST(testFlowDirections);
         CPPUNIT_TEST(testHtc);
         CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testSegmentMethods);
         CPPUNIT_TEST(testRestart);
         CPPUNIT_TEST_SUITE_END();
         ///  @brief   Enumeration for the number of nodes and fluid constituents.
@@ -6,7 +6,8 @@
            National Aeronautics and Space Administration.  All Rights Reserved.
 
 LIBRARY DEPENDENCY:
-   ((properties/ChemicalCompound.o)
+   ((core/GunnsSnapshot.o)
+    (properties/ChemicalCompound.o)
     (simulation/hs/TsHsMsg.o)
     (software/exceptions/TsInitializationException.o)
     (software/exceptions/TsOutOfBoundsException.o))
@@ -14,6 +15,7 @@ LIBRARY DEPENDENCY:
 
 #include "GunnsFluidTraceCompounds.hh"
 #include "core/GunnsBasicNode.hh"
+#include "core/GunnsSnapshot.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
@@ -401,6 +403,21 @@ void GunnsFluidTraceCompounds::restart()
     updateMasses();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the compound masses and mole fractions in the given snapshot.  Both
+///           are stored, rather than deriving one from the other on restore, so that the restored
+///           state exactly matches the saved state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidTraceCompounds::snapshotState(GunnsSnapshot& snapshot)
+{
+    if (mConfig) {
+        snapshot.sync(mMass,         mConfig->mNTypes);
+        snapshot.sync(mMoleFraction, mConfig->mNTypes);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  i  (--)  Index in the compounds array to get the compound type of.
 ///
@@ -36,6 +36,8 @@ ASSUMPTIONS AND LIMITATIONS:
 #include "properties/ChemicalCompound.hh"
 #include <vector>
 
+class GunnsSnapshot;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Fluid Trace Compounds Configuration Data
 ///
@@ -127,6 +129,8 @@ class GunnsFluidTraceCompounds
                            const std::string&                        name);
         /// @brief  Restart job method to be run after a checkpoint load.
         void    restart();
+        /// @brief  Saves or restores the compound masses and mole fractions in a network snapshot.
+        void    snapshotState(GunnsSnapshot& snapshot);
         /// @brief  Returns the pointer to the Fluid Trace Compounds config data.
         const GunnsFluidTraceCompoundsConfigData* getConfig() const;
         /// @brief  Returns the compound type at the specified index.
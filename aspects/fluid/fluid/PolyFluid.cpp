@@ -18,6 +18,7 @@ ASSUMPTIONS AND LIMITATIONS:
  (
   (aspects/fluid/fluid/MonoFluid.o)
   (aspects/fluid/fluid/GunnsFluidTraceCompounds.o)
+  (core/GunnsSnapshot.o)
   (math/approximation/LinearFit.o)
  )
 
@@ -35,6 +36,7 @@ ASSUMPTIONS AND LIMITATIONS:
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 #include "math/approximation/LinearFit.hh"
+#include "core/GunnsSnapshot.hh"
 
 #include "PolyFluid.hh"
 
@@ -331,6 +333,44 @@ void PolyFluid::cleanup()
     TS_DELETE_ARRAY(mConstituents);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the state and derived properties of this PolyFluid, its constituents
+///           and its trace compounds in the given snapshot.  The properties are stored rather than
+///           re-derived on restore, so that the restored fluid exactly matches the saved fluid.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void PolyFluid::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mTemperature);
+    snapshot.sync(mPressure);
+    snapshot.sync(mFlowRate);
+    snapshot.sync(mMass);
+    snapshot.sync(mMole);
+    snapshot.sync(mPhase);
+    snapshot.sync(mMWeight);
+    snapshot.sync(mDensity);
+    snapshot.sync(mViscosity);
+    snapshot.sync(mSpecificHeat);
+    snapshot.sync(mSpecificEnthalpy);
+    snapshot.sync(mThermalConductivity);
+    snapshot.sync(mPrandtlNumber);
+    snapshot.sync(mAdiabaticIndex);
+    for (int i = 0; i < mNConstituents; ++i) {
+        MonoFluid& fluid = mConstituents[i].mFluid;
+        snapshot.sync(fluid.mTemperature);
+        snapshot.sync(fluid.mPressure);
+        snapshot.sync(fluid.mFlowRate);
+        snapshot.sync(fluid.mMass);
+        snapshot.sync(fluid.mMole);
+        snapshot.sync(mConstituents[i].mMassFraction);
+        snapshot.sync(mConstituents[i].mMoleFraction);
+    }
+    if (mTraceCompounds) {
+        mTraceCompounds->snapshotState(snapshot);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    configData   (--)    Configuration data.
 /// @param[in]    inputData    (--)    Input data.
@@ -265,6 +265,9 @@ class PolyFluid
         /// @brief Deletes dynamic memory allocated by this PolyFluid
         void cleanup();
 
+        /// @brief Saves or restores the state of this PolyFluid in a network snapshot.
+        void snapshotState(GunnsSnapshot& snapshot);
+
     protected:
         static const double FRACTION_TOLERANCE;   /**<    (--)                     Fraction normalization threshold */
         static const double MOLE_INNER_LIMIT;     /**<    (--)                     Inner limit for various molar parameters */
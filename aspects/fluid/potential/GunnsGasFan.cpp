@@ -27,6 +27,8 @@ PROGRAMMERS:
 #include <complex>
 #include <string>
 #include "GunnsGasFan.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsNumericalException.hh"
 #include "math/MsMath.hh"
@@ -214,6 +216,8 @@ GunnsGasFan::GunnsGasFan()
     mImpellerSpeed(0.0),
     mImpellerPower(0.0),
     mSystemConstant(0.0),
+    mAffinitySpeed(0.0),
+    mAffinityDensity(0.0),
     mSourceQ(0.0),
     mCheckValveActive(false),
     mCheckValvePosition(0.0),
@@ -379,6 +383,8 @@ void GunnsGasFan::initialize(const GunnsGasFanConfigData&  configData,
     mAffinityCoeffs[3]  = 0.0;
     mAffinityCoeffs[4]  = 0.0;
     mAffinityCoeffs[5]  = 0.0;
+    mAffinitySpeed      = 0.0;
+    mAffinityDensity    = 0.0;
     mSourceQ            = 0.0;
     mCheckValvePosition = 0.0;
 
@@ -456,6 +462,43 @@ void GunnsGasFan::restartModel()
     mAffinityCoeffs[3]  = 0.0;
     mAffinityCoeffs[4]  = 0.0;
     mAffinityCoeffs[5]  = 0.0;
+    mAffinitySpeed      = 0.0;
+    mAffinityDensity    = 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           motor speed and wall temperature inputs, and the check valve position.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsGasFan::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidPotential::snapshotState(snapshot);
+
+    snapshot.sync(mMotorSpeed);
+    snapshot.sync(mWallTemperature);
+    snapshot.sync(mWallHeatFlux);
+    snapshot.sync(mImpellerTorque);
+    snapshot.sync(mImpellerSpeed);
+    snapshot.sync(mImpellerPower);
+    snapshot.sync(mSystemConstant);
+    snapshot.sync(mAffinityCoeffs, 6);
+    snapshot.sync(mAffinitySpeed);
+    snapshot.sync(mAffinityDensity);
+    snapshot.sync(mSourceQ);
+    snapshot.sync(mCheckValveActive);
+    snapshot.sync(mCheckValvePosition);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsGasFan.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsGasFan::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsGasFan);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -566,11 +609,16 @@ void GunnsGasFan::computeSourcePressure()
         /// - Scale fan curve coefficients based on speed and density.  This implements the Affinity
         ///   Laws in the polynomial as:
         ///            Coeff_order = Coeff_ref_order * (rho/rho_ref) * (N/N_ref)^(2-order).
+        ///   The coefficients are only re-scaled when the speed or density changes.
         const double densityFactor = sourceDensity  / mReferenceDensity;
         const double speedFactor   = mImpellerSpeed / mReferenceSpeed;
-        for (int order=0; order<6; ++order) {
-            mAffinityCoeffs[order] = mReferenceCoeffs[order] * densityFactor
-                                                             * std::pow(speedFactor, 2.0 - order);
+        if (speedFactor != mAffinitySpeed or densityFactor != mAffinityDensity) {
+            for (int order=0; order<6; ++order) {
+                mAffinityCoeffs[order] = mReferenceCoeffs[order] * densityFactor
+                                                                 * std::pow(speedFactor, 2.0 - order);
+            }
+            mAffinitySpeed   = speedFactor;
+            mAffinityDensity = densityFactor;
         }
 
         /// - Estimate system conductivity based on last-pass flow rate & pressure.  We assume the
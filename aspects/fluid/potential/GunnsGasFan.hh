@@ -161,6 +161,10 @@ class GunnsGasFan : public GunnsFluidPotential
                         std::vector<GunnsBasicLink*>& links,
                         const int                     port0,
                         const int                     port1);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief  Returns the heat flux from the fluid to the impeller wall.
         double getWallHeatFlux();
         /// @brief  Returns the fluid torque opposing impeller rotation.
@@ -200,6 +204,8 @@ class GunnsGasFan : public GunnsFluidPotential
         double mImpellerPower;      /**< (W)              trick_chkpnt_io(**) Power imparted on fluid by the impeller                 */
         double mSystemConstant;     /**< (kPa)                                Estimated system curve coefficient                      */
         double mAffinityCoeffs[6];  /**< (--)             trick_chkpnt_io(**) Performance curve coefficients scaled by affinity laws  */
+        double mAffinitySpeed;      /**< (--)             trick_chkpnt_io(**) Speed factor the affinity coefficients are scaled for   */
+        double mAffinityDensity;    /**< (--)             trick_chkpnt_io(**) Density factor the affinity coefficients are scaled for */
         double mSourceQ;            /**< (m3/s)                               Adjusted volumetric flow rate used in fan curve         */
         bool   mCheckValveActive;   /**< (--)             trick_chkpnt_io(**) Flag indicating check valve functionality is active     */
         double mCheckValvePosition; /**< (--)             trick_chkpnt_io(**) Check valve current position                            */
@@ -10,12 +10,19 @@ LIBRARY DEPENDENCY:
      ((Jason Harvey) (L-3 Communications) (2012-07) (Initial Delivery))
  **************************************************************************************************/
 
+#include <algorithm>
 #include <cfloat>
+#include <cmath>
 #include "GunnsGasFanCurve.hh"
 #include "math/MsMath.hh"
 #include "math/root_finding/LaguerreMethod.hh"
 #include "software/exceptions/TsNumericalException.hh"
 
+/// @details  Newton's method converges quadratically near the root, and bisection from the widest
+///           bracket takes about 60 iterations, so this is only reached when the curve is badly
+///           conditioned, and then Laguerre's method is used instead.
+const int GunnsGasFanCurve::mMaxNewtonIter = 100;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Default constructs this Gas Fan Curve object.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,7 +31,8 @@ GunnsGasFanCurve::GunnsGasFanCurve()
     BrentMethod(),
     mCoeffs(0),
     mIterLaguerre(0),
-    mIterBrent(0)
+    mIterBrent(0),
+    mIterNewton(0)
 {
     // nothing to do
 }
@@ -50,11 +58,20 @@ GunnsGasFanCurve::~GunnsGasFanCurve()
 ///          large system or fan transients.  If Laguerre's converges on a complex or negative root,
 ///          then Brent's method is used to find the positive real root.  Brent's method takes
 ///          longer so is only used as a last resort.
+///
+///          When the given root is positive, as when it is the last operating point, Newton's
+///          method is tried first, warm-started from the given root and bracketed by zero and
+///          maxQ.  Laguerre's method is only used if Newton's method can't bracket or converge.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsGasFanCurve::improveRoot(double& realRoot, double* realCoeffs, double maxQ)
 {
     mIterBrent    = 0;
     mIterLaguerre = 0;
+    mIterNewton   = 0;
+
+    if (realRoot > 0.0 and improveRootNewton(realRoot, realCoeffs, maxQ)) {
+        return;
+    }
 
     try {
         /// - First try Laguerre's method to improve the root.  Load the given coefficients into the
@@ -89,6 +106,78 @@ void GunnsGasFanCurve::improveRoot(double& realRoot, double* realCoeffs, double
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] realRoot   (m3/s) Root to improve
+/// @param[in]     realCoeffs (kPa)  Polynomial coefficients to find the root for
+/// @param[in]     maxQ       (m3/s) Maximum fan flow rate possible
+///
+/// @returns  bool (--) True if the root converged, otherwise the given root is unchanged.
+///
+/// @details  Improves the given root with Newton's method, bracketed by the sign change of the
+///           polynomial between zero and maxQ.  Steps that would leave the bracket or converge
+///           slowly are replaced by bisection, so this always converges on the root in the bracket.
+///           The polynomial and its derivative are evaluated together with Horner's rule.  Returns
+///           false without changing the root if the curve doesn't change sign over the bracket, or
+///           if it doesn't converge within the iteration limit.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsGasFanCurve::improveRootNewton(double& realRoot, const double* realCoeffs,
+                                         const double maxQ)
+{
+    double lower  = 0.0;
+    double upper  = maxQ;
+    double fLower = realCoeffs[0];
+    double fUpper = realCoeffs[5];
+    for (int order = 4; order >= 0; --order) {
+        fUpper = fUpper * upper + realCoeffs[order];
+    }
+    if (fLower * fUpper > 0.0) {
+        return false;
+    }
+
+    double x      = MsMath::limitRange(lower, realRoot, upper);
+    double dx     = upper - lower;
+    double dxLast = dx;
+    for (mIterNewton = 1; mIterNewton <= mMaxNewtonIter; ++mIterNewton) {
+        double f  = realCoeffs[5];
+        double df = 0.0;
+        for (int order = 4; order >= 0; --order) {
+            df = df * x + f;
+            f  = f  * x + realCoeffs[order];
+        }
+        if (0.0 == f) {
+            realRoot = x;
+            return true;
+        }
+
+        /// - Shrink the bracket to the side of x that still contains the sign change.
+        if ((f < 0.0) == (fLower < 0.0)) {
+            lower  = x;
+            fLower = f;
+        } else {
+            upper  = x;
+        }
+
+        /// - Take the Newton step, or bisect if the step would leave the bracket or isn't
+        ///   converging faster than bisection, as it is far from the root of a high-order curve.
+        if (((x - upper) * df - f) * ((x - lower) * df - f) > 0.0 or
+                std::fabs(2.0 * f) > std::fabs(dxLast * df)) {
+            dxLast = dx;
+            dx     = 0.5 * (upper - lower);
+            x      = lower + dx;
+        } else {
+            dxLast = dx;
+            dx     = f / df;
+            x     -= dx;
+        }
+        if (std::fabs(dx) <= 4.0 * DBL_EPSILON * std::max(1.0, x)) {
+            realRoot = x;
+            return true;
+        }
+    }
+    mIterNewton = mMaxNewtonIter;
+    return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] q    (m3/s) Volumetric flow rate to evaluate the fan-system curve delta-pressure for.
 ///
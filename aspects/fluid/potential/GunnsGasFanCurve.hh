@@ -38,6 +38,11 @@ PROGRAMMERS:
 /// @details  This class serves two purposes: it implements a 5th-order polynomial for impeller-like
 ///           class to use for its fan-system curves, which also acts as a target function for the
 ///           Brent's root-finding method, and finds the root (zero) of the curve.
+///
+///           When given a positive root from the last operating point, the root is first improved
+///           by a bracketed Newton's method on the real polynomial, which usually converges in 2-3
+///           iterations and avoids the complex arithmetic of Laguerre's method.  Laguerre's and
+///           Brent's methods remain as the fallbacks.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsGasFanCurve : public BrentMethod
 {
@@ -58,11 +63,18 @@ class GunnsGasFanCurve : public BrentMethod
         int            getLaguerreIterations() const;
         /// @brief  Returns the number of iterations in the last Brent method call.
         int            getBrentIterations() const;
+        /// @brief  Returns the number of iterations in the last Newton method call.
+        int            getNewtonIterations() const;
 
     protected:
         double* mCoeffs;                    /**< (--) Coefficients of the 5th-order polynomial.   */
         int     mIterLaguerre;              /**< (--) Number of Laguerre method iterations taken. */
         int     mIterBrent;                 /**< (--) Number of Brent method iterations taken.    */
+        int     mIterNewton;                /**< (--) Number of Newton method iterations taken.   */
+        static const int mMaxNewtonIter;    /**< (--) Maximum number of Newton method iterations. */
+        /// @brief  Improves the given root with a bracketed Newton's method.
+        bool           improveRootNewton(double& realRoot, const double* realCoeffs,
+                                         const double maxQ);
 
     private:
         /// @brief    Copy constructor unavailable since declared private and not implemented.
@@ -103,4 +115,14 @@ inline int GunnsGasFanCurve::getBrentIterations() const
     return mIterBrent;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The number of iterations in the last Newton method call.
+///
+/// @details  Returns the number of iterations in the last Newton method call.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsGasFanCurve::getNewtonIterations() const
+{
+    return mIterNewton;
+}
+
 #endif
@@ -23,6 +23,8 @@ PROGRAMMERS:
 ***************************************************************************************************/
 
 #include "GunnsLiquidCentrifugalPump.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 
@@ -262,6 +264,29 @@ void GunnsLiquidCentrifugalPump::restartModel()
     GunnsGasFan::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           pump cavitation state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsLiquidCentrifugalPump::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsGasFan::snapshotState(snapshot);
+
+    mCavitation.snapshotState(snapshot);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsLiquidCentrifugalPump.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsLiquidCentrifugalPump::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsLiquidCentrifugalPump);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Time step.
 ///
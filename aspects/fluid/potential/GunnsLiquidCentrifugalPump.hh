@@ -145,6 +145,12 @@ class GunnsLiquidCentrifugalPump : public GunnsGasFan
                         const int                     port0,
                         const int                     port1);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
     protected:
         FluidProperties::FluidType mLiquidType; /**< *o (--) trick_chkpnt_io(**) Type of the operating liquid   */
         /// @brief  Validates the initialization of this Liquid Centrifugal Pump.
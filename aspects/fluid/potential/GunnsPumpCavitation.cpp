@@ -15,7 +15,8 @@ ASSUMPTIONS AND LIMITATIONS:
    ()
 
 LIBRARY DEPENDENCY:
-   ((common/sensors/TsNoise.o))
+   ((common/sensors/TsNoise.o)
+    (core/GunnsSnapshot.o))
 
 PROGRAMMERS:
    ((Jason Harvey) (L-3 Communications) (Install) (2012-07))
@@ -25,6 +26,7 @@ PROGRAMMERS:
 #include "common/sensors/TsNoise.hh"
 #include "core/GunnsFluidUtils.hh"
 #include "core/GunnsBasicNode.hh"
+#include "core/GunnsSnapshot.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @note     This should be followed by a call to the initialize method before calling an update
@@ -204,3 +206,24 @@ void GunnsPumpCavitation::setMalfPartialCavitation(const bool   flag,
     mMalfPartialCavitationDuration  = duration;
     mMalfPartialCavitationAmplitude = amplitude;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the malfunctions and active cavitation event of this Pump Cavitation
+///           object in the given snapshot.  The random noise of partial and auto-cavitation comes
+///           from a global generator that isn't part of the snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsPumpCavitation::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mMalfFullCavitationFlag);
+    snapshot.sync(mMalfFullCavitationDuration);
+    snapshot.sync(mMalfPartialCavitationFlag);
+    snapshot.sync(mMalfPartialCavitationDuration);
+    snapshot.sync(mMalfPartialCavitationAmplitude);
+    snapshot.sync(mEnableAutoCavitation);
+    snapshot.sync(mCavitationElapsedTime);
+    snapshot.sync(mInletVaporPressure);
+    snapshot.sync(mDuration);
+    snapshot.sync(mCavitationFraction);
+}
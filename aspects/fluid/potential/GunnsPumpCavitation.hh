@@ -30,6 +30,7 @@ PROGRAMMERS:
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "properties/FluidProperties.hh"
 class GunnsBasicNode;
+class GunnsSnapshot;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Pump Cavitation Model
@@ -72,6 +73,9 @@ class GunnsPumpCavitation
                                       const double duration  = 0.0,
                                       const double amplitude = 0.0);
 
+        /// @brief  Saves or restores this Pump Cavitation object state in a network snapshot.
+        void snapshotState(GunnsSnapshot& snapshot);
+
     protected:
         double mAutoCavitationDuration;         /**< (s)  trick_chkpnt_io(**) Duration of auto-cavitation effect      */
         double mAutoCavitationAmplitude;        /**< (--) trick_chkpnt_io(**) Amplitude of autocavitation noise       */
@@ -350,6 +350,8 @@ void UtGunnsGasFan::testDefaultConstruction()
     CPPUNIT_ASSERT(0.0 == tArticle->mAffinityCoeffs[3]);
     CPPUNIT_ASSERT(0.0 == tArticle->mAffinityCoeffs[4]);
     CPPUNIT_ASSERT(0.0 == tArticle->mAffinityCoeffs[5]);
+    CPPUNIT_ASSERT(0.0 == tArticle->mAffinitySpeed);
+    CPPUNIT_ASSERT(0.0 == tArticle->mAffinityDensity);
     CPPUNIT_ASSERT(0.0 == tArticle->mSourceQ);
     CPPUNIT_ASSERT(false == tArticle->mCheckValveActive);
     CPPUNIT_ASSERT(0.0 == tArticle->mCheckValvePosition);
@@ -438,6 +440,8 @@ void UtGunnsGasFan::testNominalInitialization()
     CPPUNIT_ASSERT(0.0 == article.mAffinityCoeffs[3]);
     CPPUNIT_ASSERT(0.0 == article.mAffinityCoeffs[4]);
     CPPUNIT_ASSERT(0.0 == article.mAffinityCoeffs[5]);
+    CPPUNIT_ASSERT(0.0 == article.mAffinitySpeed);
+    CPPUNIT_ASSERT(0.0 == article.mAffinityDensity);
     CPPUNIT_ASSERT(0.0 == article.mSourceQ);
     CPPUNIT_ASSERT(0.0 == article.mCheckValvePosition);
 
@@ -489,6 +493,8 @@ void UtGunnsGasFan::testNominalInitialization()
     article2.mAffinityCoeffs[3]  = 1.0;
     article2.mAffinityCoeffs[4]  = 1.0;
     article2.mAffinityCoeffs[5]  = 1.0;
+    article2.mAffinitySpeed      = 1.0;
+    article2.mAffinityDensity    = 1.0;
 
     article2.restartModel();
 
@@ -500,6 +506,8 @@ void UtGunnsGasFan::testNominalInitialization()
     CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, article2.mAffinityCoeffs[3], tTolerance);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, article2.mAffinityCoeffs[4], tTolerance);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, article2.mAffinityCoeffs[5], tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, article2.mAffinitySpeed,     tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, article2.mAffinityDensity,   tTolerance);
 
     UT_PASS;
 }
@@ -737,6 +745,16 @@ void UtGunnsGasFan::testUpdateState()
     CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedSystemConst,   tArticle->mSystemConstant,    tTolerance);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedSourceQ,       tArticle->mSourceQ,           static_cast<double>(FLT_EPSILON));
     CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedSourceP,       tArticle->mSourcePressure,    0.000001);
+    CPPUNIT_ASSERT(expectedSpeedFactor   == tArticle->mAffinitySpeed);
+    CPPUNIT_ASSERT(expectedDensityFactor == tArticle->mAffinityDensity);
+
+    /// @test    Affinity coefficients aren't re-scaled when speed and density are unchanged.
+    tArticle->mAffinityCoeffs[5] = 0.0;
+    tArticle->updateState(tTimeStep);
+    CPPUNIT_ASSERT(0.0 == tArticle->mAffinityCoeffs[5]);
+    tArticle->mAffinitySpeed = 0.0;
+    tArticle->updateState(tTimeStep);
+    CPPUNIT_ASSERT(0.0 != tArticle->mAffinityCoeffs[5]);
 
     /// @test    Outputs at free-flow condition (max flow rate, zero pressure).
     tArticle->mFilterGain     = 0.0;
@@ -62,6 +62,7 @@ void UtGunnsGasFanCurve::testDefaultConstruction()
     CPPUNIT_ASSERT(0 == tArticle->mCoeffs);
     CPPUNIT_ASSERT(0 == tArticle->mIterLaguerre);
     CPPUNIT_ASSERT(0 == tArticle->mIterBrent);
+    CPPUNIT_ASSERT(0 == tArticle->mIterNewton);
 
     /// - New/delete for code coverage.
     GunnsGasFanCurve* article = new GunnsGasFanCurve();
@@ -137,21 +138,74 @@ void UtGunnsGasFanCurve::testImproveRoot()
     CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, root, FLT_EPSILON);
     CPPUNIT_ASSERT(0 <  tArticle->mIterLaguerre);
     CPPUNIT_ASSERT(0 <  tArticle->mIterBrent);
+    CPPUNIT_ASSERT(0 == tArticle->mIterNewton);
 
     /// - Now adjust the curve slightly to simulate the addition of a system curve that we must find
     ///   the intersection for.  The system curve is a polynomial so we only adjust the 2nd-order
-    ///   coeff.  This is expected to only need the Laguerre method to improve the previous root.
+    ///   coeff.  This is expected to only need the Newton method to improve the previous root.
     ///   This new curve has the real root at q = 0.063028342963641 (m3/s).
     coeffs[2]        = 1100.0;
     expected         = 0.063028342963641;
     tArticle->improveRoot(root, coeffs, 1000.0);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, root, FLT_EPSILON);
-    CPPUNIT_ASSERT(0 <  tArticle->mIterLaguerre);
+    CPPUNIT_ASSERT(0 <  tArticle->mIterNewton);
+    CPPUNIT_ASSERT(0 == tArticle->mIterLaguerre);
     CPPUNIT_ASSERT(0 == tArticle->mIterBrent);
 
     UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the improveRoot method of the GUNNS Gas Fan Curve class with Newton's method,
+///           warm-started from the last root.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsGasFanCurve::testImproveRootNewton()
+{
+    UT_RESULT;
+
+    /// @test    Newton's method converges from a nearby last root in a few iterations, to the
+    ///          real root at q = 0.0904418832603137 (m3/s), more closely than Brent's method does
+    ///          from a cold start.
+    double coeffs[6] = {0.357, -24.6528, 1167.09, -21093.2, 168250.0, -549729.0};
+    double expected  = 0.0904418832603137;
+    double root      = 0.0;
+    tArticle->improveRoot(root, coeffs, 1000.0);
+    CPPUNIT_ASSERT(0 == tArticle->mIterNewton);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, root, FLT_EPSILON);
+    root             = 0.09;
+    tArticle->improveRoot(root, coeffs, 1000.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, root, 1.0e-12);
+    CPPUNIT_ASSERT(0 <  tArticle->mIterNewton);
+    CPPUNIT_ASSERT(5 >= tArticle->mIterNewton);
+    CPPUNIT_ASSERT(0 == tArticle->mIterLaguerre);
+    CPPUNIT_ASSERT(0 == tArticle->mIterBrent);
+
+    /// @test    Newton's method converges on the root in the bracket from a far last root, by
+    ///          bisecting when the Newton step leaves the bracket.
+    root             = 500.0;
+    tArticle->improveRoot(root, coeffs, 1000.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, root, 1.0e-12);
+    CPPUNIT_ASSERT(0 <  tArticle->mIterNewton);
+    CPPUNIT_ASSERT(0 == tArticle->mIterLaguerre);
+
+    /// @test    Falls back to Laguerre's method when the curve doesn't change sign between zero and
+    ///          the maximum flow.  The Laguerre root is outside the maximum flow, so this goes on to
+    ///          Brent's method, which throws for the bad bounds.
+    root             = 0.005;
+    CPPUNIT_ASSERT_THROW(tArticle->improveRoot(root, coeffs, 0.01), TsNumericalException);
+    CPPUNIT_ASSERT(0 == tArticle->mIterNewton);
+    CPPUNIT_ASSERT(0 <  tArticle->mIterLaguerre);
+
+    /// @test    A root at the maximum flow bound.
+    double coeffs2[6] = {1.0, -1.0, 0.0, 0.0, 0.0, 0.0};
+    root              = 0.5;
+    tArticle->improveRoot(root, coeffs2, 1.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, root, 1.0e-12);
+    CPPUNIT_ASSERT(0 <  tArticle->mIterNewton);
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Tests exceptions thrown by the improveRoot method of the GUNNS Gas Fan Curve class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -189,11 +243,13 @@ void UtGunnsGasFanCurve::testAccessors()
 {
     UT_RESULT;
 
-    /// @test    The getLaguerreIterations and getBrentIterations methods.
+    /// @test    The getLaguerreIterations, getBrentIterations and getNewtonIterations methods.
     tArticle->mIterLaguerre = 42;
     tArticle->mIterBrent    = 3;
+    tArticle->mIterNewton   = 7;
     CPPUNIT_ASSERT( 42 == tArticle->getLaguerreIterations());
     CPPUNIT_ASSERT( 3  == tArticle->getBrentIterations());
+    CPPUNIT_ASSERT( 7  == tArticle->getNewtonIterations());
 
     UT_PASS_LAST;
 }
@@ -62,6 +62,8 @@ class UtGunnsGasFanCurve : public CppUnit::TestFixture
         void testEvaluate();
         /// @brief    Tests the improveRoot method.
         void testImproveRoot();
+        /// @brief    Tests the improveRoot method with Newton's method.
+        void testImproveRootNewton();
         /// @brief    Tests exceptions thrown by the improveRoot method.
         void testImproveRootExceptions();
         /// @brief    Tests accessor methods.
@@ -72,6 +74,7 @@ class UtGunnsGasFanCurve : public CppUnit::TestFixture
         CPPUNIT_TEST(testSetCoeffs);
         CPPUNIT_TEST(testEvaluate);
         CPPUNIT_TEST(testImproveRoot);
+        CPPUNIT_TEST(testImproveRootNewton);
         CPPUNIT_TEST(testImproveRootExceptions);
         CPPUNIT_TEST(testAccessors);
         CPPUNIT_TEST_SUITE_END();
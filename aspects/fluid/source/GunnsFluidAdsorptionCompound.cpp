@@ -6,7 +6,8 @@
            National Aeronautics and Space Administration.  All Rights Reserved.
 
 LIBRARY DEPENDENCY:
-   ((aspects/fluid/fluid/PolyFluid.o))
+   ((aspects/fluid/fluid/PolyFluid.o)
+    (core/GunnsSnapshot.o))
 */
 
 #include "GunnsFluidAdsorptionCompound.hh"
@@ -15,6 +16,7 @@ LIBRARY DEPENDENCY:
 #include "software/exceptions/TsOutOfBoundsException.hh"
 #include "aspects/fluid/fluid/PolyFluid.hh"
 #include "core/GunnsBasicNode.hh"
+#include "core/GunnsSnapshot.hh"
 #include "math/MsMath.hh"
 
 /// @details  Limit 100 * DBL_EPSILON for some applications.
@@ -341,3 +343,20 @@ void GunnsFluidAdsorptionCompound::sorb(const double dt, const double tAvg, cons
     ///     (kJ/mol) * (kg/s) * (1000 J/kJ) * (1000 g/kg) * (1/MW) (mol/g) = (1e6/MW)(J/s)
     mSorptionHeat = -mHeatOfAdsorption * adsorbRate * UnitConversion::UNIT_PER_MEGA / mMWeight;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the adsorbed mass, sorption outputs and efficiency malfunction of
+///           this Fluid Adsorbed Compound Model in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidAdsorptionCompound::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mMalfEfficiencyFlag);
+    snapshot.sync(mMalfEfficiencyValue);
+    snapshot.sync(mAdsorbedMass);
+    snapshot.sync(mFillFraction);
+    snapshot.sync(mBreakthroughExp);
+    snapshot.sync(mAdsorptionRate);
+    snapshot.sync(mSorptionHeat);
+}
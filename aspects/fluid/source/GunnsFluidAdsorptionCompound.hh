@@ -38,6 +38,7 @@ ASSUMPTIONS AND LIMITATIONS:
 #include <string>
 
 // Forward-declare pointer types.
+class GunnsSnapshot;
 class PolyFluid;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,6 +91,8 @@ class GunnsFluidAdsorptionCompound
         GunnsFluidAdsorptionCompound& operator=(const GunnsFluidAdsorptionCompound& that);
         /// @brief  Computes sorption and related outputs.
         void sorb(const double dt, const double tAvg, const double pAvg, const double mdot);
+        /// @brief  Saves or restores this Fluid Adsorbed Compound Model state in a network snapshot.
+        void snapshotState(GunnsSnapshot& snapshot);
         /// @brief  Returns whether this compound is a trace compound or fluid constituent in the network.
         bool isTraceCompound() const;
         /// @brief  Returns this Fluid Adsorbed Compound Model index in the network fluid or TC array.
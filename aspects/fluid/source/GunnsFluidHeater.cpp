@@ -22,6 +22,8 @@ PROGRAMMERS:
 **************************************************************************************************/
 
 #include "GunnsFluidHeater.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -195,6 +197,30 @@ void GunnsFluidHeater::restartModel()
     GunnsFluidLink::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidHeater::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidLink::snapshotState(snapshot);
+
+    snapshot.sync(mHeatFlux);
+    snapshot.sync(mHeaterPower);
+    snapshot.sync(mHeaterEfficiency);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidHeater.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidHeater::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidHeater);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Execution time step (not used).
 ///
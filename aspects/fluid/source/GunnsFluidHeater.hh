@@ -120,6 +120,10 @@ class GunnsFluidHeater : public GunnsFluidLink
         virtual void computeFlows(const double dt);
         /// @brief transports the flows heat flux through the link
         virtual void transportFlows(const double dt);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief Returns the heat flux
         double getHeatFlux() const;
         /// @brief sets the heater power
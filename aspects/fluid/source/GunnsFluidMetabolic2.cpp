@@ -14,6 +14,8 @@ LIBRARY DEPENDENCY:
 */
 
 #include "GunnsFluidMetabolic2.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "aspects/fluid/fluid/GunnsFluidTraceCompounds.hh"
 #include "properties/ChemicalCompound.hh"
 #include "math/MsMath.hh"
@@ -486,6 +488,52 @@ void GunnsFluidMetabolic2::restartModel()
     mProducedCH4    = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           number of crew in each metabolic state, the rates of this cycle and the user biases.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidMetabolic2::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidSource::snapshotState(snapshot);
+
+    snapshot.sync(mNCrew, GunnsFluidMetabolic2::NO_METABOLIC);
+    snapshot.sync(mConsumedO2);
+    snapshot.sync(mProducedCO2);
+    snapshot.sync(mProducedH2O);
+    snapshot.sync(mProducedHeat);
+    snapshot.sync(mProducedCH4O);
+    snapshot.sync(mProducedC2H6O);
+    snapshot.sync(mProducedC4H10O);
+    snapshot.sync(mProducedCH2O);
+    snapshot.sync(mProducedC2H4O);
+    snapshot.sync(mProducedC6H6);
+    snapshot.sync(mProducedC7H8);
+    snapshot.sync(mProducedC8H10);
+    snapshot.sync(mProducedCH2CL2);
+    snapshot.sync(mProducedC3H6O);
+    snapshot.sync(mProducedNH3);
+    snapshot.sync(mProducedCO);
+    snapshot.sync(mProducedH2);
+    snapshot.sync(mProducedCH4);
+    snapshot.sync(mShouldApplyBias);
+    snapshot.sync(mO2ConsumptionBias);
+    snapshot.sync(mCO2ProductionBias);
+    snapshot.sync(mH2OProductionBias);
+    snapshot.sync(mHeatProductionBias);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidMetabolic2.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidMetabolic2::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidMetabolic2);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]      configData   (--)  Configuration data.
 /// @param[in]      inputData    (--)  Input data.
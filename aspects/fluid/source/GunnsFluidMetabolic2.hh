@@ -195,6 +195,10 @@ class GunnsFluidMetabolic2 : public GunnsFluidSource
                         std::vector<GunnsBasicLink*>&         networkLinks,
                         const int                             port0,
                         const int                             port1);
+        /// @brief    Saves or restores the link dynamic state in a network snapshot.
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief    Returns whether snapshotState includes all of the link's dynamic state.
+        virtual bool isSnapshotSupported() const;
         /// @brief    Updates the state of this Metabolic.
         virtual void updateState(const double dt);
         /// @brief    Updates the internal fluid of this Metabolic model.
@@ -11,6 +11,8 @@ LIBRARY DEPENDENCY:
 */
 
 #include "math/MsMath.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
@@ -281,6 +283,37 @@ void GunnsFluidMultiAdsorber::restartModel()
     mSorptionHeat        = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           wall temperature input and the adsorbed compounds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidMultiAdsorber::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidConductor::snapshotState(snapshot);
+
+    snapshot.sync(mWallTemperature);
+    snapshot.sync(mWallHeatFlux);
+    snapshot.sync(mSorptionHeat);
+    for (unsigned int i = 0; i < mNCompounds; ++i) {
+        mCompounds[i].snapshotState(snapshot);
+    }
+    if (mSorptionFluid) {
+        mSorptionFluid->snapshotState(snapshot);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidMultiAdsorber.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidMultiAdsorber::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidMultiAdsorber);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]   dt         (s)     Time step.
 /// @param[in]   flowRate   (kg/s)  Mass flow rate (not used).
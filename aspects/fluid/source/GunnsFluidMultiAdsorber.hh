@@ -145,6 +145,10 @@ class GunnsFluidMultiAdsorber : public GunnsFluidConductor
                         const int                           port1);
         /// @brief  Updates the internal fluid of this GunnsFluidMultiAdsorber.
         virtual void updateFluid(const double dt, const double flowRate);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief  Sets the thermal surface area of this GunnsFluidMultiAdsorber.
         void   setThermalSurfaceArea(const double value);
         /// @brief  Sets the wall temperature of this GunnsFluidMultiAdsorber.
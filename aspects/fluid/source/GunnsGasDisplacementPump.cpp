@@ -22,6 +22,8 @@ PROGRAMMERS:
 **************************************************************************************************/
 
 #include "simulation/hs/TsHsMsg.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "core/GunnsFluidUtils.hh"
 #include "GunnsGasDisplacementPump.hh"
@@ -281,6 +283,36 @@ void GunnsGasDisplacementPump::restartModel()
     mImpellerPower = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           motor speed and wall temperature inputs, and the check valve position.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsGasDisplacementPump::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidSource::snapshotState(snapshot);
+
+    snapshot.sync(mMotorSpeed);
+    snapshot.sync(mWallTemperature);
+    snapshot.sync(mWallHeatFlux);
+    snapshot.sync(mImpellerTorque);
+    snapshot.sync(mImpellerSpeed);
+    snapshot.sync(mImpellerPower);
+    snapshot.sync(mCheckValveActive);
+    snapshot.sync(mCheckValvePosition);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsGasDisplacementPump.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsGasDisplacementPump::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsGasDisplacementPump);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Time step.
 ///
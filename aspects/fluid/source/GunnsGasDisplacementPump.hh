@@ -122,6 +122,10 @@ class GunnsGasDisplacementPump : public GunnsFluidSource
         virtual void updateState(const double dt);
         /// @brief    Updates the internal fluid of this Gas Displacement Pump model.
         virtual void updateFluid(const double dt, const double flowRate);
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
         /// @brief    Returns the wall heat flux.
         double getWallHeatFlux();
         /// @brief    Returns the impeller fluid torque.
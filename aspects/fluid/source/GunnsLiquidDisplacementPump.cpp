@@ -22,6 +22,8 @@ PROGRAMMERS:
 **************************************************************************************************/
 
 #include "GunnsLiquidDisplacementPump.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 
@@ -238,6 +240,29 @@ void GunnsLiquidDisplacementPump::restartModel()
     GunnsGasDisplacementPump::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           pump cavitation state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsLiquidDisplacementPump::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsGasDisplacementPump::snapshotState(snapshot);
+
+    mCavitation.snapshotState(snapshot);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsLiquidDisplacementPump.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsLiquidDisplacementPump::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsLiquidDisplacementPump);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Time step.
 ///
@@ -130,6 +130,12 @@ class GunnsLiquidDisplacementPump : public GunnsGasDisplacementPump
                         const int                               port0,
                         const int                               port1);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
     protected:
         FluidProperties::FluidType mLiquidType; /**< *o (--) trick_chkpnt_io(**) Type of the operating liquid   */
         /// @brief    Validates the initialization inputs of this Liquid Displacement Pump model.
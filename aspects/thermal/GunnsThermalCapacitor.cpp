@@ -10,6 +10,8 @@ LIBRARY DEPENDENCY:
 #include "GunnsThermalCapacitor.hh"
 #include <cfloat>    //needed for DBL_EPSILON in updateState()
 #include "aspects/thermal/PtcsMacros.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 
@@ -200,6 +202,31 @@ void GunnsThermalCapacitor::restartModel()
     mSumExternalHeatFluxes = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot, including the
+///           external heat fluxes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalCapacitor::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicCapacitor::snapshotState(snapshot);
+
+    snapshot.sync(mTemperature);
+    snapshot.sync(mExternalHeatFlux, NUM_EXT_HEATFLUXES);
+    snapshot.sync(mSumExternalHeatFluxes);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsThermalCapacitor.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalCapacitor::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsThermalCapacitor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    dt   (s)  Integration time step (not used)
 ///
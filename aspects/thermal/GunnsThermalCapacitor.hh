@@ -162,6 +162,12 @@ class GunnsThermalCapacitor : public GunnsBasicCapacitor
         ///          link's mPotentialVector. Used here to update mTemperature.
         virtual void processOutputs();
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
     protected:
         int     mEditCapacitanceGroup;            /**< (--) trick_chkpnt_io(**) Identifier for capacitance edit grouping */
         double  mTemperature;                     /**< (K)                      Temperature of link's non-vacuum node (port0) */
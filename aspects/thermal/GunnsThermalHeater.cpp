@@ -8,6 +8,8 @@ LIBRARY DEPENDENCY:
    )
 ***************************************************************************************************/
 #include "GunnsThermalHeater.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "aspects/thermal/PtcsMacros.hh"
 /**************************************************************************************************/
@@ -146,6 +148,28 @@ void GunnsThermalHeater::restartModel()
     /// - Reset the base class.
     GunnsThermalSource::restartModel();
 }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalHeater::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsThermalSource::snapshotState(snapshot);
+
+    snapshot.sync(mPowerElectrical);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsThermalHeater.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalHeater::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsThermalHeater);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    dt  (s)  Integration time step [not used]
 ///
@@ -120,6 +120,12 @@ class GunnsThermalHeater: public GunnsThermalSource
                         std::vector<GunnsBasicLink*>& networkLinks,
                         std::vector<int>* portsVector);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
         /// @brief  A setter for the Thermal Heater's electrical power.
         void setPowerElectrical(const double inputElectricalPower);
         /// @brief  A getter for the Thermal Heater's mPowerElectrical.
@@ -8,6 +8,8 @@ LIBRARY DEPENDENCY:
 
 #include "GunnsThermalMultiPanel.hh"
 #include "aspects/thermal/PtcsMacros.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "math/MsMath.hh" //needed for MsMath::isInRange() in validate()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -227,6 +229,30 @@ void GunnsThermalMultiPanel::restartModel()
     GunnsThermalSource::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           view scalars and incident fluxes of the radiant sources.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalMultiPanel::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsThermalSource::snapshotState(snapshot);
+
+    snapshot.sync(mViewScalar,   5);
+    snapshot.sync(mIncidentFlux, 5);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsThermalMultiPanel.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalMultiPanel::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsThermalMultiPanel);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]   dt  (s)  Integration time step (not used)
 ///
@@ -142,6 +142,12 @@ class GunnsThermalMultiPanel : public GunnsThermalSource
         /// @brief  Updates the link during a frame.
         virtual void updateState(const double dt);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
         /// @brief  Get absorptivity with index.
         virtual double getAbsorptivity(const int index) const;
 
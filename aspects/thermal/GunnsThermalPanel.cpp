@@ -6,6 +6,8 @@ LIBRARY DEPENDENCY:
      (GunnsThermalSource.o)
 ***************************************************************************************************/
 #include "GunnsThermalPanel.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "aspects/thermal/PtcsMacros.hh"
 #include "math/MsMath.hh" //needed for MsMath::isInRange() in validate()
 /**************************************************************************************************/
@@ -180,6 +182,29 @@ void GunnsThermalPanel::restartModel()
     /// - Reset the base class.
     GunnsThermalSource::restartModel();
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           incident heat flux.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalPanel::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsThermalSource::snapshotState(snapshot);
+
+    snapshot.sync(mIncidentHeatFluxPerArea);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsThermalPanel.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalPanel::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsThermalPanel);
+}
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]   dt  (s)  Integration time step (not used)
 ///
@@ -149,6 +149,12 @@ class GunnsThermalPanel : public GunnsThermalSource
                         std::vector<GunnsBasicLink*>&      networkLinks,
                         std::vector<int>*                  portsVector);
 
+        /// @brief  Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief  Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
         /// @brief  Updates the link during a frame
         virtual void updateState(const double dt);
 
@@ -8,6 +8,8 @@ LIBRARY DEPENDENCY:
    )
 **************************************************************************************************/
 #include "GunnsThermalPotential.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "aspects/thermal/PtcsMacros.hh"
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,6 +142,28 @@ void GunnsThermalPotential::restartModel()
     GunnsBasicPotential::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalPotential::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicPotential::snapshotState(snapshot);
+
+    snapshot.sync(mHeatFluxIntoNode);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsThermalPotential.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalPotential::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsThermalPotential);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] port  (--) The port to be assigned
 /// @param[in] node  (--) The desired node to assign the port to
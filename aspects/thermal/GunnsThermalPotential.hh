@@ -118,6 +118,12 @@ class GunnsThermalPotential : public GunnsBasicPotential
                         const int                               port0,
                         const int                               port1);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
         /// @brief  Prepares the object for a simbus write by setting the mHeatFluxIntoNode member.
         ///         Overwrites a base-class method that executes right after GUNNS updates every
         ///         link. Used here to update mHeatFluxIntoNode.
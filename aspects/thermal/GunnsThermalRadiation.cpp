@@ -30,6 +30,8 @@ LIBRARY_DEPENDENCY:
   )
 **************************************************************************************************/
 #include "GunnsThermalRadiation.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "math/MsMath.hh" // Needed for pow and DBL_EPSILON
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -163,6 +165,28 @@ void GunnsThermalRadiation::restartModel()
     GunnsBasicConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiation::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicConductor::snapshotState(snapshot);
+
+    snapshot.sync(mViewScalar);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsThermalRadiation.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalRadiation::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsThermalRadiation);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  dt  (s)  Integration time step
 ///
@@ -128,6 +128,12 @@ class GunnsThermalRadiation : public GunnsBasicConductor
                         const int                              port0,
                         const int                              port1);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
         /// @brief   Sets the mViewScalar value
         void   setViewScalar(const double scalar);
 
@@ -0,0 +1,622 @@
+/************************** TRICK HEADER **********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+  (Models a bank of thermal radiation paths in a single multi-port link.)
+
+REFERENCE:
+  ()
+
+ASSUMPTIONS AND LIMITATIONS:
+  ()
+
+LIBRARY_DEPENDENCY:
+  (
+   (core/GunnsBasicLink.o)
+  )
+
+PROGRAMMERS:
+  ()
+**************************************************************************************************/
+#include "GunnsThermalRadiationBank.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
+#include "aspects/thermal/PtcsMacros.hh"
+#include "math/MsMath.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name         (--)   Link name
+/// @param[in] nodes        (--)   Network nodes array
+/// @param[in] coefficients (W/K4) Pointer to vector of the radiation coefficient of each path
+///
+/// @details  Constructs the Thermal Radiation Bank Config data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationBankConfigData::GunnsThermalRadiationBankConfigData(
+        const std::string&   name,
+        GunnsNodeList*       nodes,
+        std::vector<double>* coefficients)
+    :
+    GunnsBasicLinkConfigData(name, nodes),
+    cCoefficients()
+{
+    if (0 != coefficients) {
+        cCoefficients = *coefficients;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] that (--) Object to copy from
+///
+/// @details  Copy Constructs the Thermal Radiation Bank Config data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationBankConfigData::GunnsThermalRadiationBankConfigData(
+        const GunnsThermalRadiationBankConfigData& that)
+    :
+    GunnsBasicLinkConfigData(that),
+    cCoefficients(that.cCoefficients)
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default Destructs the Thermal Radiation Bank Config Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationBankConfigData::~GunnsThermalRadiationBankConfigData()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] malfBlockageFlag  (--) Blockage malfunction flag
+/// @param[in] malfBlockageValue (--) Blockage malfunction fractional value (0-1)
+/// @param[in] viewScalars       (--) Pointer to vector of the initial view scalar of each path
+///
+/// @details  Default Constructs this Thermal Radiation Bank input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationBankInputData::GunnsThermalRadiationBankInputData(
+        const bool           malfBlockageFlag,
+        const double         malfBlockageValue,
+        std::vector<double>* viewScalars)
+    :
+    GunnsBasicLinkInputData(malfBlockageFlag, malfBlockageValue),
+    iViewScalars()
+{
+    if (0 != viewScalars) {
+        iViewScalars = *viewScalars;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] that (--) Object to copy
+///
+/// @details  Copy constructs this Thermal Radiation Bank input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationBankInputData::GunnsThermalRadiationBankInputData(
+        const GunnsThermalRadiationBankInputData& that)
+    :
+    GunnsBasicLinkInputData(that),
+    iViewScalars(that.iViewScalars)
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default Destructs this Thermal Radiation Bank Input Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationBankInputData::~GunnsThermalRadiationBankInputData()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Constructs the Thermal Radiation Bank.  The number of ports is set in initialize().
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationBank::GunnsThermalRadiationBank()
+    :
+    GunnsBasicLink(1),
+    mMalfPathBlockageFlag(0),
+    mMalfPathBlockageValue(0),
+    mNumPaths(0),
+    mPathPort0(0),
+    mPathPort1(0),
+    mCoefficients(0),
+    mViewScalars(0),
+    mConductances(0),
+    mPathFluxes(0),
+    mChangedPaths(0),
+    mDeferMapUpdate(false)
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default Destructor
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationBank::~GunnsThermalRadiationBank()
+{
+    cleanupPaths();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes the path arrays.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::cleanupPaths()
+{
+    TS_DELETE_ARRAY(mChangedPaths);
+    TS_DELETE_ARRAY(mPathFluxes);
+    TS_DELETE_ARRAY(mConductances);
+    TS_DELETE_ARRAY(mViewScalars);
+    TS_DELETE_ARRAY(mCoefficients);
+    TS_DELETE_ARRAY(mPathPort1);
+    TS_DELETE_ARRAY(mPathPort0);
+    TS_DELETE_ARRAY(mMalfPathBlockageValue);
+    TS_DELETE_ARRAY(mMalfPathBlockageFlag);
+    mNumPaths = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]     configData   (--) Reference to Link Config Data
+/// @param[in]     inputData    (--) Reference to Link Input Data
+/// @param[in,out] networkLinks (--) Reference to the Network Link Vector
+/// @param[in]     nodes0       (--) Vector of the network node at the port 0 side of each path
+/// @param[in]     nodes1       (--) Vector of the network node at the port 1 side of each path
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes the GunnsThermalRadiationBank.  The link is given one port for each unique
+///           node among all of its paths, in order of first appearance, and each path is stored as
+///           a pair of these ports.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::initialize(const GunnsThermalRadiationBankConfigData& configData,
+                                           const GunnsThermalRadiationBankInputData&  inputData,
+                                           std::vector<GunnsBasicLink*>&              networkLinks,
+                                           std::vector<int>*                          nodes0,
+                                           std::vector<int>*                          nodes1)
+{
+    /// - Reset init flag.
+    mInitFlag = false;
+
+    /// - Validate config and input data specific to a GunnsThermalRadiationBank.  This must be done
+    ///   before the ports are built from the node vectors.
+    validate(configData, inputData, nodes0, nodes1);
+
+    /// - Assign a port to each unique node, and store each path as its pair of ports.
+    cleanupPaths();
+    mNumPaths = static_cast<int>(nodes0->size());
+    TS_NEW_PRIM_ARRAY_EXT(mPathPort0,             mNumPaths, int,    configData.mName + ".mPathPort0");
+    TS_NEW_PRIM_ARRAY_EXT(mPathPort1,             mNumPaths, int,    configData.mName + ".mPathPort1");
+    TS_NEW_PRIM_ARRAY_EXT(mCoefficients,          mNumPaths, double, configData.mName + ".mCoefficients");
+    TS_NEW_PRIM_ARRAY_EXT(mViewScalars,           mNumPaths, double, configData.mName + ".mViewScalars");
+    TS_NEW_PRIM_ARRAY_EXT(mConductances,          mNumPaths, double, configData.mName + ".mConductances");
+    TS_NEW_PRIM_ARRAY_EXT(mPathFluxes,            mNumPaths, double, configData.mName + ".mPathFluxes");
+    TS_NEW_PRIM_ARRAY_EXT(mChangedPaths,          mNumPaths, int,    configData.mName + ".mChangedPaths");
+    TS_NEW_PRIM_ARRAY_EXT(mMalfPathBlockageFlag,  mNumPaths, bool,   configData.mName + ".mMalfPathBlockageFlag");
+    TS_NEW_PRIM_ARRAY_EXT(mMalfPathBlockageValue, mNumPaths, double, configData.mName + ".mMalfPathBlockageValue");
+
+    std::vector<int> portOfNode(configData.mNodeList->mNumNodes, -1);
+    std::vector<int> ports;
+    for (int i = 0; i < mNumPaths; ++i) {
+        const int node0 = nodes0->at(i);
+        const int node1 = nodes1->at(i);
+        if (portOfNode[node0] < 0) {
+            portOfNode[node0] = static_cast<int>(ports.size());
+            ports.push_back(node0);
+        }
+        if (portOfNode[node1] < 0) {
+            portOfNode[node1] = static_cast<int>(ports.size());
+            ports.push_back(node1);
+        }
+        mPathPort0[i]    = portOfNode[node0];
+        mPathPort1[i]    = portOfNode[node1];
+        mCoefficients[i] = configData.cCoefficients[i];
+        mViewScalars[i]  = inputData.iViewScalars.empty() ? 1.0 : inputData.iViewScalars[i];
+        mConductances[i] = 0.0;
+        mPathFluxes[i]   = 0.0;
+        mChangedPaths[i] = 0;
+        mMalfPathBlockageFlag[i]  = false;
+        mMalfPathBlockageValue[i] = 0.0;
+    }
+    mNumPorts = static_cast<int>(ports.size());
+
+    /// - Initialize the parent class, which sizes the compressed admittance matrix & map from the
+    ///   number of ports and paths.
+    GunnsBasicLink::initialize(configData, inputData, networkLinks, &ports[0]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] configData (--) Configuration data.
+/// @param[in] inputData  (--) Input data.
+/// @param[in] nodes0     (--) Vector of the network node at the port 0 side of each path
+/// @param[in] nodes1     (--) Vector of the network node at the port 1 side of each path
+///
+/// @throws   TsInitializationException
+///
+/// @details  Validates the initialization of this GUNNS ThermalRadiationBank link model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::validate(const GunnsThermalRadiationBankConfigData& configData,
+                                         const GunnsThermalRadiationBankInputData&  inputData,
+                                         const std::vector<int>*                    nodes0,
+                                         const std::vector<int>*                    nodes1) const
+{
+    /// - Throw an exception if the node list or either node vector is missing.
+    TS_PTCS_IF_ERREX(0 == configData.mNodeList, TsInitializationException,
+            "invalid config data", "Link has null node list.");
+    TS_PTCS_IF_ERREX(0 == nodes0 or 0 == nodes1, TsInitializationException,
+            "invalid initialization data", "Null pointer to path node vectors.");
+
+    /// - Throw an exception if there are no paths.
+    TS_PTCS_IF_ERREX(nodes0->empty(), TsInitializationException,
+            "invalid initialization data", "Path node vectors are empty.");
+
+    /// - Throw an exception if the path vectors are not all the same size.
+    const unsigned int numPaths = nodes0->size();
+    TS_PTCS_IF_ERREX(nodes1->size() != numPaths or configData.cCoefficients.size() != numPaths,
+            TsInitializationException,
+            "invalid config data", "Size of path node or coefficient vectors != number of paths.");
+    TS_PTCS_IF_ERREX(not inputData.iViewScalars.empty() and inputData.iViewScalars.size() != numPaths,
+            TsInitializationException,
+            "invalid input data", "Size of view scalar vector != number of paths.");
+
+    const int groundNode = configData.mNodeList->mNumNodes - 1;
+    for (unsigned int i = 0; i < numPaths; ++i) {
+        /// - Throw an exception if a path node is not in the network.
+        TS_PTCS_IF_ERREX(not MsMath::isInRange(0, nodes0->at(i), groundNode) or
+                         not MsMath::isInRange(0, nodes1->at(i), groundNode),
+                TsInitializationException,
+                "invalid initialization data", "Path node out of range.");
+
+        /// - Throw an exception if a path connects a non-boundary node to itself.
+        TS_PTCS_IF_ERREX(nodes0->at(i) == nodes1->at(i) and nodes0->at(i) != groundNode,
+                TsInitializationException,
+                "invalid initialization data", "Path connects a node to itself.");
+
+        /// - Throw an exception if a path has a negative coefficient.
+        TS_PTCS_IF_ERREX(configData.cCoefficients[i] < 0.0, TsInitializationException,
+                "invalid config data", "Radiation coefficient < 0.");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Derived classes should call their base class implementation too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::restartModel()
+{
+    /// - Reset the base class.
+    GunnsBasicLink::restartModel();
+
+    /// - Reset non-config & non-checkpointed class attributes.
+    for (int i = 0; i < mNumPaths; ++i) {
+        mConductances[i] = 0.0;
+        mPathFluxes[i]   = 0.0;
+    }
+
+    /// - Clear the compressed admittance matrix so the next step re-stamps every path.
+    for (int i = 0; i < mNumPorts + 2 * mNumPaths; ++i) {
+        mAdmittanceMatrix[i] = 0.0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This adds the view
+///           scalars, blockage malfunctions, conductances and fluxes of the paths to the compressed
+///           admittance matrix restored by the base class, so the next step compares its
+///           conductances against the same stamped terms, with the same view scalars, as the saved
+///           network did.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicLink::snapshotState(snapshot);
+
+    snapshot.sync(mViewScalars,           mNumPaths);
+    snapshot.sync(mMalfPathBlockageFlag,  mNumPaths);
+    snapshot.sync(mMalfPathBlockageValue, mNumPaths);
+    snapshot.sync(mConductances,          mNumPaths);
+    snapshot.sync(mPathFluxes,            mNumPaths);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsThermalRadiationBank.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalRadiationBank::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsThermalRadiationBank);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Sizes the admittance map for the compressed admittance matrix, which holds the block
+///           of this link's contributions to the network matrix: the diagonal term of each port,
+///           then the [p0p1, p1p0] off-diagonal terms of each path.  Since each port's diagonal is
+///           shared by all of its paths, this is about half the size of 4 terms per path.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::createAdmittanceMap()
+{
+    mAdmittanceMap.allocateMap(mName + ".mAdmittanceMap", mNumPorts + 2 * mNumPaths);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Allocates the compressed admittance matrix, 1 term per port and 2 per path, and fills
+///           it with zeros.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::allocateAdmittanceMatrix()
+{
+    const int size = mNumPorts + 2 * mNumPaths;
+    TS_NEW_PRIM_ARRAY_EXT(mAdmittanceMatrix, size, double, mName + ".mAdmittanceMatrix");
+    for (int i = 0; i < size; ++i) {
+        mAdmittanceMatrix[i] = 0.0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Maps each port's diagonal term and each path's off-diagonal terms to the network
+///           matrix.  Terms involving the network ground node, or a port not yet assigned, are
+///           mapped to -1 so the solver skips them.  This is skipped while registerNodes is
+///           assigning all ports, since setPort calls it for every port and it is O(paths).
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::updateAdmittanceMap()
+{
+    if (mDeferMapUpdate or 0 == mAdmittanceMap.mMap) {
+        return;
+    }
+
+    const int networkSize = getGroundNodeIndex();
+    for (int port = 0; port < mNumPorts; ++port) {
+        const int node = mNodeMap[port];
+        mAdmittanceMap.mMap[port] = MsMath::isInRange(0, node, networkSize - 1)
+                                  ? node * networkSize + node : -1;
+    }
+
+    for (int i = 0; i < mNumPaths; ++i) {
+        const int  a      = getOffDiagonalIndex(i);
+        const int  node0  = mNodeMap[mPathPort0[i]];
+        const int  node1  = mNodeMap[mPathPort1[i]];
+        const bool solve  = MsMath::isInRange(0, node0, networkSize - 1)
+                        and MsMath::isInRange(0, node1, networkSize - 1);
+        mAdmittanceMap.mMap[a]     = solve ? node0 * networkSize + node1 : -1;
+        mAdmittanceMap.mMap[a + 1] = solve ? node1 * networkSize + node0 : -1;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] portMap (--) Network port mapping array
+/// @param[in] source  (--) Source of the port assignment command for output message (i.e. "user")
+/// @param[in] verbose (--) Whether to output H&S messages indicating the move took place
+///
+/// @details  Assigns each port to the node position given by the portMap argument, deferring the
+///           admittance map update until all ports are assigned.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::registerNodes(const int* portMap, const std::string& source,
+                                              const bool verbose)
+{
+    mDeferMapUpdate = true;
+    GunnsBasicLink::registerNodes(portMap, source, verbose);
+    mDeferMapUpdate = false;
+    updateAdmittanceMap();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] dt (s) Integration time step
+///
+/// @details  Processes user port commands, then linearizes all paths and builds them into the
+///           system of equations.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::step(const double dt)
+{
+    /// - Process user commands to dynamically re-map ports.
+    processUserPortCommand();
+
+    updateState(dt);
+    buildConductance();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] dt (s) Integration time step
+///
+/// @details  Linearizes the radiative heat flux of every path in one pass over the path arrays.
+///           As in GunnsThermalRadiation, each path's admittance is:
+///
+///                A = C * (T0^4 - T1^4) / (T0 - T1)
+///
+///           which is evaluated in its factored form:
+///
+///                A = C * (T0 + T1) * (T0^2 + T1^2)
+///
+///           to avoid the division and the T0 = T1 special case.  C is the path's radiation
+///           coefficient times its view scalar, the bank's blockage and the path's own blockage.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::updateState(const double dt __attribute__((unused)))
+{
+    double blockage = 1.0;
+    if (mMalfBlockageFlag) {
+        blockage -= mMalfBlockageValue;
+    }
+
+    for (int i = 0; i < mNumPaths; ++i) {
+        const double t0 = mPotentialVector[mPathPort0[i]];
+        const double t1 = mPotentialVector[mPathPort1[i]];
+        const double b  = mMalfPathBlockageFlag[i] ? blockage * (1.0 - mMalfPathBlockageValue[i])
+                                                   : blockage;
+        const double g  = b * mViewScalars[i] * mCoefficients[i]
+                        * (t0 + t1) * (t0 * t0 + t1 * t1);
+        mConductances[i] = std::min(std::max(g, 0.0), mConductanceLimit);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Stamps the path conductances into the compressed admittance matrix, and flags an
+///           admittance update only if any path's conductance changed.  The conductance last
+///           stamped for each path is the negative of its off-diagonal terms, so the changed paths
+///           are found by comparing against those.
+///
+///           When only a few paths changed, such as when a few view scalars are changed with the
+///           node temperatures held, the change in each of those paths' conductance is added to its
+///           ports' diagonal terms, and the rest of the block is untouched.  When more than a
+///           quarter of the paths changed, the diagonal terms are instead re-summed from all paths,
+///           which also clears any round-off accumulated by the incremental updates.  Every path is
+///           re-linearized each step, so every step of a transient, where the node temperatures
+///           change, takes the re-stamp and gets no speedup from the incremental update.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::buildConductance()
+{
+    int numChanged = 0;
+    for (int i = 0; i < mNumPaths; ++i) {
+        if (-mAdmittanceMatrix[getOffDiagonalIndex(i)] != mConductances[i]) {
+            mChangedPaths[numChanged++] = i;
+        }
+    }
+
+    if (0 == numChanged) {
+        return;
+    }
+    mAdmittanceUpdate = true;
+
+    if (4 * numChanged > mNumPaths) {
+        /// - Re-stamp the whole block.
+        for (int port = 0; port < mNumPorts; ++port) {
+            mAdmittanceMatrix[port] = 0.0;
+        }
+        for (int i = 0; i < mNumPaths; ++i) {
+            const int a = getOffDiagonalIndex(i);
+            mAdmittanceMatrix[mPathPort0[i]] += mConductances[i];
+            mAdmittanceMatrix[mPathPort1[i]] += mConductances[i];
+            mAdmittanceMatrix[a]              = -mConductances[i];
+            mAdmittanceMatrix[a + 1]          = -mConductances[i];
+        }
+    } else {
+        /// - Update only the changed paths' terms.
+        for (int j = 0; j < numChanged; ++j) {
+            const int    i     = mChangedPaths[j];
+            const int    a     = getOffDiagonalIndex(i);
+            const double delta = mConductances[i] + mAdmittanceMatrix[a];
+            mAdmittanceMatrix[mPathPort0[i]] += delta;
+            mAdmittanceMatrix[mPathPort1[i]] += delta;
+            mAdmittanceMatrix[a]              = -mConductances[i];
+            mAdmittanceMatrix[a + 1]          = -mConductances[i];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] dt (s) Integration time step
+///
+/// @details  Computes the flux through each path, defined positive from its port 0 to port 1, and
+///           transports it between the path's nodes.  The link's power is the total of all paths.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::computeFlows(const double dt __attribute__((unused)))
+{
+    mPower = 0.0;
+    for (int i = 0; i < mNumPaths; ++i) {
+        const int    port0 = mPathPort0[i];
+        const int    port1 = mPathPort1[i];
+        const double drop  = mPotentialVector[port0] - mPotentialVector[port1];
+        const double hiP   = std::max(mPotentialVector[port0], mPotentialVector[port1]);
+
+        /// - Zero flux if dT is too low, as in GunnsBasicConductor::computeFlux.
+        double flux = 0.0;
+        if (std::fabs(drop) >= hiP * m100EpsilonLimit) {
+            flux = drop * mConductances[i];
+        }
+        mPathFluxes[i] = flux;
+        mPower        -= flux * drop;
+
+        if (flux > 0.0) {
+            mNodes[port0]->collectOutflux(flux);
+            mNodes[port1]->collectInflux (flux);
+        } else if (flux < 0.0) {
+            mNodes[port1]->collectOutflux(-flux);
+            mNodes[port0]->collectInflux (-flux);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] path   (--) Index of the radiation path.
+/// @param[in] scalar (--) Value to scale the path's radiation coefficient by.
+///
+/// @details  Sets the view scalar of the given path.  Issues a warning and does nothing if the
+///           path index is out of bounds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::setViewScalar(const int path, const double scalar)
+{
+    if (isValidPath(path)) {
+        mViewScalars[path] = scalar;
+    } else {
+        TS_PTCS_WARNING("Path index out of bounds. View scalar not set.");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] path (--) Index of the radiation path.
+///
+/// @returns  double  (--)  Current view scalar of the given path, or zero if out of bounds.
+///
+/// @details  Returns the view scalar of the given path.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsThermalRadiationBank::getViewScalar(const int path) const
+{
+    if (isValidPath(path)) {
+        return mViewScalars[path];
+    }
+    TS_PTCS_WARNING("Path index out of bounds. Zero returned.");
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] path (--) Index of the radiation path.
+///
+/// @returns  double  (W/K)  Linearized conductance of the given path, or zero if out of bounds.
+///
+/// @details  Returns the linearized conductance of the given path from the last step, including
+///           its view scalar and blockages.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsThermalRadiationBank::getConductance(const int path) const
+{
+    if (isValidPath(path)) {
+        return mConductances[path];
+    }
+    TS_PTCS_WARNING("Path index out of bounds. Zero returned.");
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] path (--) Index of the radiation path.
+///
+/// @returns  double  (W)  Heat flux through the given path, or zero if out of bounds.
+///
+/// @details  Returns the heat flux through the given path from the last step, positive from the
+///           path's port 0 node to its port 1 node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsThermalRadiationBank::getPathFlux(const int path) const
+{
+    if (isValidPath(path)) {
+        return mPathFluxes[path];
+    }
+    TS_PTCS_WARNING("Path index out of bounds. Zero returned.");
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] path  (--) Index of the radiation path.
+/// @param[in] flag  (--) Malfunction activation flag, true activates.
+/// @param[in] value (--) Malfunction blockage fraction (0-1) of the path.
+///
+/// @details  Sets the blockage malfunction of the given path, which acts like the blockage
+///           malfunction of an individual GunnsThermalRadiation link.  Calling this with the
+///           default arguments resets the malfunction.  Issues a warning and does nothing if the
+///           path index is out of bounds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBank::setMalfPathBlockage(const int path, const bool flag,
+                                                    const double value)
+{
+    if (isValidPath(path)) {
+        mMalfPathBlockageFlag[path]  = flag;
+        mMalfPathBlockageValue[path] = value;
+    } else {
+        TS_PTCS_WARNING("Path index out of bounds. Blockage malfunction not set.");
+    }
+}
@@ -0,0 +1,271 @@
+#ifndef GunnsThermalRadiationBank_EXISTS
+#define GunnsThermalRadiationBank_EXISTS
+
+/********************** TRICK HEADER **************************************************************
+@defgroup  TSM_GUNNS_THERMAL_RADIATION_BANK    GUNNS Thermal Radiation Bank Link
+@ingroup   TSM_GUNNS_THERMAL
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+  (Models a bank of thermal radiation paths in a single multi-port link.  Each radiation path
+   connects a pair of the link's ports and has the same linearized T^4 admittance as a
+   GunnsThermalRadiation link.  The path node pairs, radiation coefficients, view scalars and
+   linearized conductances are stored in contiguous arrays, so that all paths are linearized in one
+   pass per step and stamped into the network system as a single block: one diagonal term per port
+   plus the 2 off-diagonal terms of each path.  This replaces many individual GunnsThermalRadiation
+   links in large thermal networks, where the per-link overhead dominates the cost of the
+   linearization itself.  When only a few paths' conductances change in a step, such as when a few
+   view scalars are changed with the node temperatures held, only those paths' terms are updated.
+   This incremental update gives no speedup in a transient, where the node temperatures change and
+   every path is re-linearized: the whole block is re-stamped and the network matrix is
+   re-decomposed every step, as with individual links.)
+
+REFERENCE:
+  ()
+
+ASSUMPTIONS AND LIMITATIONS:
+  ((Radiation coefficients are constant.)
+   (The link blockage malfunction applies to all paths in the bank, and each path also has its own
+    blockage malfunction, for the per-link malfunctions of the GunnsThermalRadiation links it
+    replaces.)
+   (The link has one port per unique node among all of its paths.)
+   (Incremental updates of the diagonal terms accumulate round-off, which is bounded by re-stamping
+    the whole block whenever more than a quarter of the paths change.))
+
+LIBRARY DEPENDENCY:
+  (
+   (GunnsThermalRadiationBank.o)
+  )
+
+PROGRAMMERS:
+  ()
+
+@{
+**************************************************************************************************/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include "core/GunnsBasicLink.hh"
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GunnsThermalRadiationBank Configuration Data
+///
+/// @details  The sole purpose of this class is to provide a data structure for the Thermal
+///           Radiation Bank configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalRadiationBankConfigData : public GunnsBasicLinkConfigData
+{
+    public:
+        /// @details  Vector of variable size, defines the radiation coefficient of each path.
+        std::vector<double> cCoefficients; /**< (W/K4) trick_chkpnt_io(**) Radiation coefficient of each path */
+
+        /// @brief   Default constructs this GunnsThermalRadiationBank configuration data.
+        GunnsThermalRadiationBankConfigData(const std::string&   name         = "unnamed radiation bank",
+                                            GunnsNodeList*       nodes        = 0,
+                                            std::vector<double>* coefficients = 0);
+
+        /// @brief   Default destructs this GunnsThermalRadiationBank configuration data.
+        virtual ~GunnsThermalRadiationBankConfigData();
+
+        /// @brief   Copy constructs this GunnsThermalRadiationBank configuration data.
+        GunnsThermalRadiationBankConfigData(const GunnsThermalRadiationBankConfigData& that);
+
+    protected:
+        // Nothing
+
+    private:
+        /// @brief   Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalRadiationBankConfigData& operator = (const GunnsThermalRadiationBankConfigData& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GunnsThermalRadiationBank Input Data
+///
+/// @details  The sole purpose of this class is to provide a data structure for the Thermal
+///           Radiation Bank input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalRadiationBankInputData : public GunnsBasicLinkInputData
+{
+    public:
+        /// @details  Vector of variable size, defines the initial view scalar of each path.  When
+        ///           empty, all paths start with a view scalar of 1.
+        std::vector<double> iViewScalars; /**< (--) trick_chkpnt_io(**) Initial view scalar of each path */
+
+        /// @brief   Default constructs this Thermal Radiation Bank input data.
+        GunnsThermalRadiationBankInputData(const bool           malfBlockageFlag  = false,
+                                           const double         malfBlockageValue = 0.0,
+                                           std::vector<double>* viewScalars       = 0);
+
+        /// @brief   Default destructs this Thermal Radiation Bank input data.
+        virtual ~GunnsThermalRadiationBankInputData();
+
+        /// @brief   Copy constructs this Thermal Radiation Bank input data.
+        GunnsThermalRadiationBankInputData(const GunnsThermalRadiationBankInputData& that);
+
+    protected:
+        // Nothing
+
+    private:
+        /// @details Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalRadiationBankInputData& operator = (const GunnsThermalRadiationBankInputData& that);
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GunnsThermalRadiationBank Class
+///
+/// @details  The purpose of this class is to create the thermal radiation effect for many node
+///           pairs in one link, where the heat flux of each path is a function of T^4.  Each path
+///           is linearized as in GunnsThermalRadiation, using the factored form of
+///           (T0^4 - T1^4) / (T0 - T1) so that the linearization needs no division and is
+///           continuous through T0 = T1.  The paths are identified by their index in the
+///           configuration vectors, and their view scalars, conductances and fluxes are accessed by
+///           that index.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalRadiationBank : public GunnsBasicLink
+{
+        TS_MAKE_SIM_COMPATIBLE(GunnsThermalRadiationBank);
+
+    public:
+        /// @brief   Default Constructor
+        GunnsThermalRadiationBank();
+
+        /// @brief   Default Destructor
+        virtual ~GunnsThermalRadiationBank();
+
+        /// @brief   ThermalRadiationBank initialization method
+        void initialize(const GunnsThermalRadiationBankConfigData& configData,
+                        const GunnsThermalRadiationBankInputData&  inputData,
+                        std::vector<GunnsBasicLink*>&              networkLinks,
+                        std::vector<int>*                          nodes0,
+                        std::vector<int>*                          nodes1);
+
+        /// @brief   Step method for updating the link.
+        virtual void step(const double dt);
+
+        /// @brief   Method for computing the flows across the link.
+        virtual void computeFlows(const double dt);
+        /// @brief   Saves or restores the link dynamic state in a network snapshot.
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief   Returns whether snapshotState includes all of the link's dynamic state.
+        virtual bool isSnapshotSupported() const;
+
+        /// @brief   Returns the number of radiation paths in this bank.
+        int    getNumPaths() const;
+
+        /// @brief   Sets the view scalar of the given path.
+        void   setViewScalar(const int path, const double scalar);
+
+        /// @brief   Returns the view scalar of the given path.
+        double getViewScalar(const int path) const;
+
+        /// @brief   Returns the linearized conductance of the given path.
+        double getConductance(const int path) const;
+
+        /// @brief   Returns the heat flux through the given path.
+        double getPathFlux(const int path) const;
+        /// @brief   Sets and resets the blockage malfunction of the given path.
+        void   setMalfPathBlockage(const int path, const bool flag = false, const double value = 0.0);
+        /// @name    Malfunction terms.
+        /// @{
+        /// @details Malfunction targets are public to allow access from the Trick events processor.
+        bool*   mMalfPathBlockageFlag;  /**<    (--)                       Blockage malfunction flag of each path */
+        double* mMalfPathBlockageValue; /**<    (--)                       Blockage malfunction fraction of each path (0-1) */
+        /// @}
+
+    protected:
+        int     mNumPaths;         /**< *o (--)   trick_chkpnt_io(**) Number of radiation paths in this bank */
+        int*    mPathPort0;        /**< ** (--)   trick_chkpnt_io(**) Link port at the port 0 side of each path */
+        int*    mPathPort1;        /**< ** (--)   trick_chkpnt_io(**) Link port at the port 1 side of each path */
+        double* mCoefficients;     /**<    (W/K4) trick_chkpnt_io(**) Radiation coefficient of each path */
+        double* mViewScalars;      /**<    (--)                       View scalar of each path */
+        double* mConductances;     /**<    (W/K)                      Linearized conductance of each path */
+        double* mPathFluxes;       /**<    (W)                        Heat flux through each path, positive from port 0 to port 1 */
+        int*    mChangedPaths;     /**< ** (--)   trick_chkpnt_io(**) Work array of the paths whose conductance changed this step */
+        bool    mDeferMapUpdate;   /**< *o (--)   trick_chkpnt_io(**) Defers admittance map updates while all ports are registered */
+
+        /// @brief   Calculates the linearized conductance of every path.
+        virtual void updateState(const double dt);
+
+        /// @brief   Builds the path conductances into the compressed admittance matrix.
+        void buildConductance();
+
+        /// @brief   Validates the initialization of this link.
+        void validate(const GunnsThermalRadiationBankConfigData& configData,
+                      const GunnsThermalRadiationBankInputData&  inputData,
+                      const std::vector<int>*                    nodes0,
+                      const std::vector<int>*                    nodes1) const;
+
+        /// @brief   Virtual method for derived links to perform their restart functions.
+        virtual void restartModel();
+
+        /// @brief   Allocates the compressed admittance map, 1 term per port and 2 per path.
+        virtual void createAdmittanceMap();
+
+        /// @brief   Allocates the compressed admittance matrix, 1 term per port and 2 per path.
+        virtual void allocateAdmittanceMatrix();
+
+        /// @brief   Maps the compressed admittance matrix terms to the network matrix.
+        virtual void updateAdmittanceMap();
+
+        /// @brief   Assigns the ports to nodes with a single admittance map update.
+        virtual void registerNodes(const int* portMap, const std::string& source, const bool verbose);
+
+        /// @brief   Returns whether the given path index is valid.
+        bool   isValidPath(const int path) const;
+
+        /// @brief   Deletes the path arrays.
+        void   cleanupPaths();
+
+        /// @brief   Returns the compressed admittance matrix index of the given path's p0p1 term.
+        int    getOffDiagonalIndex(const int path) const;
+
+    private:
+        /// @brief   Copy constructor unavailable since declared private and not implemented.
+        GunnsThermalRadiationBank(const GunnsThermalRadiationBank& that);
+
+        /// @brief   Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalRadiationBank& operator = (const GunnsThermalRadiationBank& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  Number of radiation paths in this bank.
+///
+/// @details  Returns the number of radiation paths in this bank.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsThermalRadiationBank::getNumPaths() const
+{
+    return mNumPaths;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] path (--) Index of the radiation path.
+///
+/// @returns  bool  (--)  True if the given path index is within this bank.
+///
+/// @details  Returns whether the given path index is valid.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsThermalRadiationBank::isValidPath(const int path) const
+{
+    return (path >= 0 and path < mNumPaths);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] path (--) Index of the radiation path.
+///
+/// @returns  int  (--)  Index of the path's p0p1 term in the compressed admittance matrix.
+///
+/// @details  The compressed admittance matrix holds the diagonal term of each port, followed by the
+///           [p0p1, p1p0] terms of each path.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsThermalRadiationBank::getOffDiagonalIndex(const int path) const
+{
+    return mNumPorts + 2 * path;
+}
+
+#endif
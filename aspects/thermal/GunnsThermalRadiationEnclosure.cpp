@@ -0,0 +1,307 @@
+/************************** TRICK HEADER **********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+  (Models the radiation exchange between all surfaces of an enclosure in a single multi-port link.)
+
+REFERENCE:
+  ()
+
+ASSUMPTIONS AND LIMITATIONS:
+  ()
+
+LIBRARY_DEPENDENCY:
+  (
+   (aspects/thermal/GunnsThermalRadiationBank.o)
+  )
+
+PROGRAMMERS:
+  ()
+**************************************************************************************************/
+#include "GunnsThermalRadiationEnclosure.hh"
+#include "aspects/thermal/PtcsMacros.hh"
+#include "math/MsMath.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name         (--)   Link name
+/// @param[in] nodes        (--)   Network nodes array
+/// @param[in] rowStart     (--)   Pointer to vector of the index of the first coefficient of each row
+/// @param[in] columns      (--)   Pointer to vector of the other surface index of each coefficient
+/// @param[in] coefficients (W/K4) Pointer to vector of the radiation coefficients
+///
+/// @details  Constructs the Thermal Radiation Enclosure Config data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosureConfigData::GunnsThermalRadiationEnclosureConfigData(
+        const std::string&   name,
+        GunnsNodeList*       nodes,
+        std::vector<int>*    rowStart,
+        std::vector<int>*    columns,
+        std::vector<double>* coefficients)
+    :
+    GunnsThermalRadiationBankConfigData(name, nodes, coefficients),
+    cRowStart(),
+    cColumns()
+{
+    if (0 != rowStart) {
+        cRowStart = *rowStart;
+    }
+    if (0 != columns) {
+        cColumns = *columns;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] that (--) Object to copy from
+///
+/// @details  Copy Constructs the Thermal Radiation Enclosure Config data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosureConfigData::GunnsThermalRadiationEnclosureConfigData(
+        const GunnsThermalRadiationEnclosureConfigData& that)
+    :
+    GunnsThermalRadiationBankConfigData(that),
+    cRowStart(that.cRowStart),
+    cColumns(that.cColumns)
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default Destructs the Thermal Radiation Enclosure Config Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosureConfigData::~GunnsThermalRadiationEnclosureConfigData()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] malfBlockageFlag  (--) Blockage malfunction flag
+/// @param[in] malfBlockageValue (--) Blockage malfunction fractional value (0-1)
+/// @param[in] viewScalars       (--) Pointer to vector of the initial view scalar of each coefficient
+///
+/// @details  Default Constructs this Thermal Radiation Enclosure input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosureInputData::GunnsThermalRadiationEnclosureInputData(
+        const bool           malfBlockageFlag,
+        const double         malfBlockageValue,
+        std::vector<double>* viewScalars)
+    :
+    GunnsThermalRadiationBankInputData(malfBlockageFlag, malfBlockageValue, viewScalars)
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] that (--) Object to copy
+///
+/// @details  Copy constructs this Thermal Radiation Enclosure input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosureInputData::GunnsThermalRadiationEnclosureInputData(
+        const GunnsThermalRadiationEnclosureInputData& that)
+    :
+    GunnsThermalRadiationBankInputData(that)
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default Destructs this Thermal Radiation Enclosure Input Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosureInputData::~GunnsThermalRadiationEnclosureInputData()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Constructs the Thermal Radiation Enclosure.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosure::GunnsThermalRadiationEnclosure()
+    :
+    GunnsThermalRadiationBank(),
+    mNumSurfaces(0),
+    mRowStart(0),
+    mColumns(0)
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default Destructor
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosure::~GunnsThermalRadiationEnclosure()
+{
+    cleanupSurfaces();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes the surface arrays.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationEnclosure::cleanupSurfaces()
+{
+    TS_DELETE_ARRAY(mColumns);
+    TS_DELETE_ARRAY(mRowStart);
+    mNumSurfaces = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]     configData   (--) Reference to Link Config Data
+/// @param[in]     inputData    (--) Reference to Link Input Data
+/// @param[in,out] networkLinks (--) Reference to the Network Link Vector
+/// @param[in]     surfaceNodes (--) Vector of the network node of each surface
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes the GunnsThermalRadiationEnclosure.  Each coefficient of the sparse matrix
+///           becomes a path of the base radiation bank, from its row's surface node to its column's
+///           surface node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationEnclosure::initialize(
+        const GunnsThermalRadiationEnclosureConfigData& configData,
+        const GunnsThermalRadiationEnclosureInputData&  inputData,
+        std::vector<GunnsBasicLink*>&                   networkLinks,
+        std::vector<int>*                               surfaceNodes)
+{
+    /// - Reset init flag.
+    mInitFlag = false;
+
+    /// - Validate the sparse matrix and surface nodes.
+    validate(configData, surfaceNodes);
+
+    /// - Store the sparse matrix structure, and build the path node vectors from it.
+    cleanupSurfaces();
+    mNumSurfaces = static_cast<int>(surfaceNodes->size());
+    const int numPaths = static_cast<int>(configData.cColumns.size());
+    TS_NEW_PRIM_ARRAY_EXT(mRowStart, mNumSurfaces + 1, int, configData.mName + ".mRowStart");
+    TS_NEW_PRIM_ARRAY_EXT(mColumns,  numPaths,         int, configData.mName + ".mColumns");
+
+    std::vector<int> nodes0(numPaths);
+    std::vector<int> nodes1(numPaths);
+    for (int row = 0; row < mNumSurfaces; ++row) {
+        mRowStart[row] = configData.cRowStart[row];
+        for (int i = configData.cRowStart[row]; i < configData.cRowStart[row + 1]; ++i) {
+            mColumns[i] = configData.cColumns[i];
+            nodes0[i]   = surfaceNodes->at(row);
+            nodes1[i]   = surfaceNodes->at(mColumns[i]);
+        }
+    }
+    mRowStart[mNumSurfaces] = numPaths;
+
+    /// - Initialize the radiation bank with the paths, which validates the coefficients, view
+    ///   scalars and nodes.
+    GunnsThermalRadiationBank::initialize(configData, inputData, networkLinks, &nodes0, &nodes1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] configData   (--) Configuration data.
+/// @param[in] surfaceNodes (--) Vector of the network node of each surface
+///
+/// @throws   TsInitializationException
+///
+/// @details  Validates the sparse matrix structure and surface nodes of this GUNNS
+///           ThermalRadiationEnclosure link model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationEnclosure::validate(
+        const GunnsThermalRadiationEnclosureConfigData& configData,
+        const std::vector<int>*                         surfaceNodes) const
+{
+    /// - Throw an exception if the surface node vector is missing or has fewer than 2 surfaces.
+    TS_PTCS_IF_ERREX(0 == surfaceNodes, TsInitializationException,
+            "invalid initialization data", "Null pointer to surface node vector.");
+    TS_PTCS_IF_ERREX(surfaceNodes->size() < 2, TsInitializationException,
+            "invalid initialization data", "Enclosure has fewer than 2 surfaces.");
+
+    /// - Throw an exception if the sparse matrix vectors are not sized for the surfaces and
+    ///   coefficients.
+    const int numSurfaces = static_cast<int>(surfaceNodes->size());
+    TS_PTCS_IF_ERREX(static_cast<int>(configData.cRowStart.size()) != numSurfaces + 1,
+            TsInitializationException,
+            "invalid config data", "Size of row start vector != number of surfaces + 1.");
+    TS_PTCS_IF_ERREX(configData.cColumns.size() != configData.cCoefficients.size(),
+            TsInitializationException,
+            "invalid config data", "Size of column vector != size of coefficient vector.");
+    TS_PTCS_IF_ERREX(0 != configData.cRowStart.front() or
+                     static_cast<int>(configData.cColumns.size()) != configData.cRowStart.back(),
+            TsInitializationException,
+            "invalid config data", "Row start vector doesn't span the coefficients.");
+
+    for (int row = 0; row < numSurfaces; ++row) {
+        /// - Throw an exception if the row starts are decreasing.
+        TS_PTCS_IF_ERREX(configData.cRowStart[row + 1] < configData.cRowStart[row],
+                TsInitializationException,
+                "invalid config data", "Row start vector is decreasing.");
+
+        /// - Throw an exception if a column isn't in the upper triangle or isn't in ascending
+        ///   order, which also rejects duplicate coefficients.
+        int lastColumn = row;
+        for (int i = configData.cRowStart[row]; i < configData.cRowStart[row + 1]; ++i) {
+            TS_PTCS_IF_ERREX(configData.cColumns[i] <= lastColumn or
+                             configData.cColumns[i] >= numSurfaces,
+                    TsInitializationException,
+                    "invalid config data", "Column not ascending in upper triangle.");
+            lastColumn = configData.cColumns[i];
+        }
+    }
+
+    /// - Throw an exception if surfaces share a node.
+    std::vector<int> sortedNodes(*surfaceNodes);
+    std::sort(sortedNodes.begin(), sortedNodes.end());
+    TS_PTCS_IF_ERREX(sortedNodes.end() != std::adjacent_find(sortedNodes.begin(), sortedNodes.end()),
+            TsInitializationException,
+            "invalid initialization data", "Surfaces share a node.");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] surface0 (--) Index of one surface.
+/// @param[in] surface1 (--) Index of the other surface.
+///
+/// @returns  int  (--)  Index of the path between the given surfaces, or -1 if there is none.
+///
+/// @details  Finds the path between the given surfaces, in either order, by binary search of the
+///           lower surface's row.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int GunnsThermalRadiationEnclosure::getPathIndex(const int surface0, const int surface1) const
+{
+    const int row    = std::min(surface0, surface1);
+    const int column = std::max(surface0, surface1);
+    if (row < 0 or column >= mNumSurfaces or row == column) {
+        return -1;
+    }
+
+    const int* begin = mColumns + mRowStart[row];
+    const int* end   = mColumns + mRowStart[row + 1];
+    const int* found = std::lower_bound(begin, end, column);
+    if (found != end and column == *found) {
+        return static_cast<int>(found - mColumns);
+    }
+    return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] surface (--) Index of the surface.
+/// @param[in] scalar  (--) Value to scale the radiation coefficients by.
+///
+/// @details  Sets the view scalar of all paths between the given surface and any other surface,
+///           such as for a radiator that rotates relative to the rest of the enclosure.  Only these
+///           paths' admittance terms are updated in the next step if the temperatures are unchanged.
+///           Issues a warning and does nothing if the surface index is out of bounds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationEnclosure::setSurfaceViewScalar(const int surface, const double scalar)
+{
+    if (not MsMath::isInRange(0, surface, mNumSurfaces - 1)) {
+        TS_PTCS_WARNING("Surface index out of bounds. View scalars not set.");
+        return;
+    }
+
+    /// - Paths to lower surfaces are in their rows, and paths to higher surfaces are in this row.
+    for (int row = 0; row < surface; ++row) {
+        const int path = getPathIndex(row, surface);
+        if (path >= 0) {
+            mViewScalars[path] = scalar;
+        }
+    }
+    for (int i = mRowStart[surface]; i < mRowStart[surface + 1]; ++i) {
+        mViewScalars[i] = scalar;
+    }
+}
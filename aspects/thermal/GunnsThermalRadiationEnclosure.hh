@@ -0,0 +1,183 @@
+#ifndef GunnsThermalRadiationEnclosure_EXISTS
+#define GunnsThermalRadiationEnclosure_EXISTS
+
+/********************** TRICK HEADER **************************************************************
+@defgroup  TSM_GUNNS_THERMAL_RADIATION_ENCLOSURE    GUNNS Thermal Radiation Enclosure Link
+@ingroup   TSM_GUNNS_THERMAL
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+  (Models the radiation exchange between all surfaces of an enclosure in a single multi-port link.
+   The enclosure is defined by a sparse, symmetric matrix of radiation coefficients between its
+   surfaces, such as the Hottel script-F exchange factors times the Stefan-Boltzmann constant and
+   surface area.  Only the upper triangle of the matrix is given, in compressed sparse row form, so
+   each surface pair with a non-zero coefficient becomes one radiation path of the
+   GunnsThermalRadiationBank base class.  The enclosure is then linearized and stamped into the
+   network system as a single block, and surface pairs are found by binary search of the sparse
+   rows.  This replaces the N*(N-1)/2 individual GunnsThermalRadiation links of a full enclosure.)
+
+REFERENCE:
+  ()
+
+ASSUMPTIONS AND LIMITATIONS:
+  ((The exchange factors are symmetric, so coefficient(i, j) = coefficient(j, i).)
+   (Surfaces have no radiation exchange with themselves.)
+   (Each surface is a different network node.))
+
+LIBRARY DEPENDENCY:
+  (
+   (GunnsThermalRadiationEnclosure.o)
+  )
+
+PROGRAMMERS:
+  ()
+
+@{
+**************************************************************************************************/
+
+#include "aspects/thermal/GunnsThermalRadiationBank.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GunnsThermalRadiationEnclosure Configuration Data
+///
+/// @details  The sole purpose of this class is to provide a data structure for the Thermal
+///           Radiation Enclosure configuration data.  The upper triangle of the enclosure's
+///           coefficient matrix is given in compressed sparse row form: the non-zero coefficients of
+///           surface i are at indexes cRowStart[i] through cRowStart[i+1]-1 of the cColumns and
+///           cCoefficients vectors, and cColumns holds the index of the other surface of each
+///           coefficient.  The other surfaces of each row must be in ascending order and greater
+///           than the row's surface.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalRadiationEnclosureConfigData : public GunnsThermalRadiationBankConfigData
+{
+    public:
+        /// @details  Vector of variable size, number of surfaces + 1.
+        std::vector<int> cRowStart; /**< (--) trick_chkpnt_io(**) Index of the first coefficient of each surface's row */
+        /// @details  Vector of variable size, same size as cCoefficients.
+        std::vector<int> cColumns;  /**< (--) trick_chkpnt_io(**) Other surface index of each coefficient */
+
+        /// @brief   Default constructs this GunnsThermalRadiationEnclosure configuration data.
+        GunnsThermalRadiationEnclosureConfigData(const std::string&   name         = "unnamed radiation enclosure",
+                                                 GunnsNodeList*       nodes        = 0,
+                                                 std::vector<int>*    rowStart     = 0,
+                                                 std::vector<int>*    columns      = 0,
+                                                 std::vector<double>* coefficients = 0);
+
+        /// @brief   Default destructs this GunnsThermalRadiationEnclosure configuration data.
+        virtual ~GunnsThermalRadiationEnclosureConfigData();
+
+        /// @brief   Copy constructs this GunnsThermalRadiationEnclosure configuration data.
+        GunnsThermalRadiationEnclosureConfigData(const GunnsThermalRadiationEnclosureConfigData& that);
+
+    protected:
+        // Nothing
+
+    private:
+        /// @brief   Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalRadiationEnclosureConfigData& operator = (const GunnsThermalRadiationEnclosureConfigData& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GunnsThermalRadiationEnclosure Input Data
+///
+/// @details  The sole purpose of this class is to provide a data structure for the Thermal
+///           Radiation Enclosure input data.  The view scalars are given in the same order as the
+///           configuration coefficients.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalRadiationEnclosureInputData : public GunnsThermalRadiationBankInputData
+{
+    public:
+        /// @brief   Default constructs this Thermal Radiation Enclosure input data.
+        GunnsThermalRadiationEnclosureInputData(const bool           malfBlockageFlag  = false,
+                                                const double         malfBlockageValue = 0.0,
+                                                std::vector<double>* viewScalars       = 0);
+
+        /// @brief   Default destructs this Thermal Radiation Enclosure input data.
+        virtual ~GunnsThermalRadiationEnclosureInputData();
+
+        /// @brief   Copy constructs this Thermal Radiation Enclosure input data.
+        GunnsThermalRadiationEnclosureInputData(const GunnsThermalRadiationEnclosureInputData& that);
+
+    protected:
+        // Nothing
+
+    private:
+        /// @details Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalRadiationEnclosureInputData& operator = (const GunnsThermalRadiationEnclosureInputData& that);
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GunnsThermalRadiationEnclosure Class
+///
+/// @details  The purpose of this class is to model the radiation exchange of an enclosure from its
+///           sparse coefficient matrix.  Each non-zero coefficient in the upper triangle is a path
+///           of the base radiation bank, with the path index being the coefficient's index in the
+///           configuration vectors, so the linearization, admittance stamping and incremental update
+///           of changed paths are all done by the base class.  This class adds the mapping between
+///           surface pairs and paths, so that the view scalars of a surface pair, or of all pairs
+///           of one surface such as a rotating radiator, can be set.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalRadiationEnclosure : public GunnsThermalRadiationBank
+{
+        TS_MAKE_SIM_COMPATIBLE(GunnsThermalRadiationEnclosure);
+
+    public:
+        /// @brief   Default Constructor
+        GunnsThermalRadiationEnclosure();
+
+        /// @brief   Default Destructor
+        virtual ~GunnsThermalRadiationEnclosure();
+
+        /// @brief   ThermalRadiationEnclosure initialization method
+        void initialize(const GunnsThermalRadiationEnclosureConfigData& configData,
+                        const GunnsThermalRadiationEnclosureInputData&  inputData,
+                        std::vector<GunnsBasicLink*>&                   networkLinks,
+                        std::vector<int>*                               surfaceNodes);
+
+        /// @brief   Returns the number of surfaces in this enclosure.
+        int    getNumSurfaces() const;
+
+        /// @brief   Returns the path index between the given surfaces, or -1 if there is none.
+        int    getPathIndex(const int surface0, const int surface1) const;
+
+        /// @brief   Sets the view scalar of all paths to the given surface.
+        void   setSurfaceViewScalar(const int surface, const double scalar);
+
+    protected:
+        int     mNumSurfaces;      /**< *o (--) trick_chkpnt_io(**) Number of surfaces in this enclosure */
+        int*    mRowStart;         /**< ** (--) trick_chkpnt_io(**) Index of the first path of each surface's row */
+        int*    mColumns;          /**< ** (--) trick_chkpnt_io(**) Other surface of each path */
+
+        /// @brief   Validates the initialization of this link.
+        void validate(const GunnsThermalRadiationEnclosureConfigData& configData,
+                      const std::vector<int>*                         surfaceNodes) const;
+
+        /// @brief   Deletes the surface arrays.
+        void cleanupSurfaces();
+
+    private:
+        /// @brief   Copy constructor unavailable since declared private and not implemented.
+        GunnsThermalRadiationEnclosure(const GunnsThermalRadiationEnclosure& that);
+
+        /// @brief   Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalRadiationEnclosure& operator = (const GunnsThermalRadiationEnclosure& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  Number of surfaces in this enclosure.
+///
+/// @details  Returns the number of surfaces in this enclosure.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsThermalRadiationEnclosure::getNumSurfaces() const
+{
+    return mNumSurfaces;
+}
+
+#endif
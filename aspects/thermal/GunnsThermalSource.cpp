@@ -8,6 +8,8 @@ LIBRARY DEPENDENCY:
  )
 ***************************************************************************************************/
 #include "GunnsThermalSource.hh"
+#include <typeinfo>
+#include "core/GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "math/MsMath.hh" //needed for MsMath::isInRange() in validate()
 #include "aspects/thermal/PtcsMacros.hh"
@@ -287,6 +289,35 @@ void GunnsThermalSource::restartModel()
     /// - Reset the base class.
     GunnsBasicLink::restartModel();
 }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           demanded heat flux and the overrides.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalSource::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicLink::snapshotState(snapshot);
+
+    snapshot.sync(mMalfFluxOverrideFlag);
+    snapshot.sync(mMalfFluxOverrideValue);
+    snapshot.sync(mTemperatureOverrideFlag);
+    snapshot.sync(mTemperatureOverrideValue);
+    snapshot.sync(mDemandedFlux);
+    snapshot.sync(mTuningScalar);
+    snapshot.sync(mAvgPortTemperature);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsThermalSource.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalSource::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsThermalSource);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
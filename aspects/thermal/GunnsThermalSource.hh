@@ -138,6 +138,12 @@ class GunnsThermalSource: public GunnsBasicLink
                         std::vector<GunnsBasicLink*>& networkLinks,
                         std::vector<int>* portsVector);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
         /// @brief  Step method for updating the link.
         void step(const double dt);
 
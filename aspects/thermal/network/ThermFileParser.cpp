@@ -5,6 +5,7 @@
 LIBRARY DEPENDENCY:
    (
     (parsing/ParseTool.o)
+    (parsing/XmlElementStream.o)
     (parsing/tinyxml/tinyxml.o)
     (software/exceptions/TsInitializationException.o)
     (software/exceptions/TsParseException.o)
@@ -14,16 +15,185 @@ PROGRAMMERS:
    ((Joe Valerioti) (L3) (Dec 2012)))
 ***************************************************************************************************/
 #include "ThermFileParser.hh"
-#include "parsing/ParseTool.hh" //needed to check file accessibility in openFile
+#include "parsing/ParseTool.hh" //needed to check file accessibility in validateFile
 #include "software/exceptions/TsParseException.hh"
 #include "aspects/thermal/PtcsMacros.hh"
 #include "math/MsMath.hh" //needed for fabs() and FLT_EPSILON in confirmNodeBuild()
 #include <algorithm> //needed for find() function in getCapEditGroupId()
+#include <cstdio>    //needed for rename() and remove() in writeCacheFile()
+#include <cstring>   //needed for memcpy() in ThermFileCacheReader
+#include <fstream>
 #include <iostream>
+#include <sstream>
+#include <fcntl.h>    //needed for open() in readCacheFile()
+#include <sys/mman.h> //needed for mmap() in readCacheFile()
+#include <sys/stat.h> //needed for fstat() in readCacheFile()
+#include <unistd.h>   //needed for close() and getpid()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Integer used to designate a node name that is not yet registered in the Node map.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 const int ThermFileParser::NOT_FOUND  = -99;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Format version of the binary cache-file.  This must be incremented whenever the
+///           contents or order of the data written by writeCacheFile change.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const uint32_t ThermFileParser::CACHE_VERSION = 1;
+/**************************************************************************************************/
+/* ThermFileCacheWriter class */
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Serializes the ThermFileParser data vectors into the cache-file binary format.
+///
+/// @details  Scalars are stored as their native bytes.  Strings and vectors are stored as a 32-bit
+///           element count followed by their elements.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class ThermFileCacheWriter
+{
+    public:
+        /// @brief  Appends a scalar value.
+        template <typename T>
+        void putValue(const T& value)
+        {
+            mBuffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+        /// @brief  Appends a string.
+        void putString(const std::string& value)
+        {
+            putValue(static_cast<uint32_t>(value.size()));
+            mBuffer.append(value);
+        }
+        /// @brief  Appends a vector of scalar values.
+        template <typename T>
+        void putValues(const std::vector<T>& values)
+        {
+            putValue(static_cast<uint32_t>(values.size()));
+            if (not values.empty()) {
+                mBuffer.append(reinterpret_cast<const char*>(&values[0]), values.size() * sizeof(T));
+            }
+        }
+        /// @brief  Appends a vector of strings.
+        void putStrings(const std::vector<std::string>& values)
+        {
+            putValue(static_cast<uint32_t>(values.size()));
+            for (unsigned int i = 0; i < values.size(); ++i) {
+                putString(values[i]);
+            }
+        }
+        /// @brief  Appends a vector of vectors of scalar values.
+        template <typename T>
+        void putNested(const std::vector< std::vector<T> >& values)
+        {
+            putValue(static_cast<uint32_t>(values.size()));
+            for (unsigned int i = 0; i < values.size(); ++i) {
+                putValues(values[i]);
+            }
+        }
+        /// @brief  Returns the serialized data.
+        const std::string& getBuffer() const
+        {
+            return mBuffer;
+        }
+
+    private:
+        std::string mBuffer; /**< (--) Serialized data */
+};
+/**************************************************************************************************/
+/* ThermFileCacheReader class */
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Deserializes the ThermFileParser data vectors from the cache-file binary format.
+///
+/// @details  Reads directly from the memory-mapped cache-file.  Instead of throwing, a read past
+///           the end of the data flags the reader as invalid and stops further reads, so that the
+///           caller can discard a truncated or corrupt cache-file and parse the XML instead.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class ThermFileCacheReader
+{
+    public:
+        /// @brief  Constructs the reader over the given data.
+        ThermFileCacheReader(const char* data, const size_t size)
+            : mPos(data), mEnd(data + size), mValid(true) {}
+        /// @brief  Returns true if no read has gone past the end of the data.
+        bool isValid() const
+        {
+            return mValid;
+        }
+        /// @brief  Returns true if all of the data has been read.
+        bool isEnd() const
+        {
+            return mPos == mEnd;
+        }
+        /// @brief  Reads a scalar value.
+        template <typename T>
+        void getValue(T& value)
+        {
+            if (checkSize(sizeof(T))) {
+                std::memcpy(&value, mPos, sizeof(T));
+                mPos += sizeof(T);
+            }
+        }
+        /// @brief  Reads a string.
+        void getString(std::string& value)
+        {
+            uint32_t size = 0;
+            getValue(size);
+            if (checkSize(size)) {
+                value.assign(mPos, size);
+                mPos += size;
+            }
+        }
+        /// @brief  Reads a vector of scalar values.
+        template <typename T>
+        void getValues(std::vector<T>& values)
+        {
+            uint32_t size = 0;
+            getValue(size);
+            values.clear();
+            if (checkSize(static_cast<uint64_t>(size) * sizeof(T)) and size > 0) {
+                values.resize(size);
+                std::memcpy(&values[0], mPos, size * sizeof(T));
+                mPos += size * sizeof(T);
+            }
+        }
+        /// @brief  Reads a vector of strings.
+        void getStrings(std::vector<std::string>& values)
+        {
+            uint32_t size = 0;
+            getValue(size);
+            values.clear();
+            if (checkSize(static_cast<uint64_t>(size) * sizeof(uint32_t))) {
+                values.resize(size);
+                for (uint32_t i = 0; i < size and mValid; ++i) {
+                    getString(values[i]);
+                }
+            }
+        }
+        /// @brief  Reads a vector of vectors of scalar values.
+        template <typename T>
+        void getNested(std::vector< std::vector<T> >& values)
+        {
+            uint32_t size = 0;
+            getValue(size);
+            values.clear();
+            if (checkSize(static_cast<uint64_t>(size) * sizeof(uint32_t))) {
+                values.resize(size);
+                for (uint32_t i = 0; i < size and mValid; ++i) {
+                    getValues(values[i]);
+                }
+            }
+        }
+
+    private:
+        const char* mPos;   /**< (--) Current read position */
+        const char* mEnd;   /**< (--) End of the data */
+        bool        mValid; /**< (--) False after a read past the end of the data */
+        /// @brief  Returns whether the given number of bytes remain, flagging the reader if not.
+        bool checkSize(const uint64_t size)
+        {
+            if (mValid and size > static_cast<uint64_t>(mEnd - mPos)) {
+                mValid = false;
+            }
+            return mValid;
+        }
+};
 /**************************************************************************************************/
 /* ThermFileParser class */
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +211,8 @@ ThermFileParser::ThermFileParser(const std::string name)
     mEtcFile(),
     mThermInputFile(),
     mThermInputFileRad(),
+    mCacheFile(),
+    mCacheKey(0),
     numNodes(0),
     vNodeNames(0),
     mNodeMap(),
@@ -107,9 +279,18 @@ ThermFileParser::~ThermFileParser()
 ///
 /// @note  Since this function is intended to be called prior to initialization, H&S errors thrown
 ///        from the call to readFile won't have an instance name.
+///
+/// @note  The config-files hash is kept for the initialize method, so the config-files are only
+///        hashed once per initialization.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void ThermFileParser::preCountNodes()
 {
+    /// - Take the number of nodes from the cache-file if it is current.
+    mCacheKey = mCacheFile.empty() ? 0 : hashConfigFiles();
+    if (readCacheFile(mCacheKey)) {
+        return;
+    }
+
     /// - Reset number of nodes for a fresh count.
     numNodes = 0;
     /// - Cause the node file to be parsed and node elements counted in numNodes.
@@ -137,13 +318,22 @@ void ThermFileParser::initialize(const std::string& name)
             TS_PTCS_ERREX(TsInitializationException, "initialization error", "a ThermFileParser has empty object name.")
         }
 
-        /// - Read each file and build data vectors.
-        readNodeFile();
-        readCondFile();
-        readRadFile();
-        readHtrFile();
-        readPanFile();
-        readEtcFile();
+        /// - Load the data vectors from the cache-file if it is current.  Otherwise read each file
+        ///   and build data vectors, then update the cache-file for the next initialization.  The
+        ///   config-files hash from preCountNodes is reused, and then forgotten so that a later
+        ///   initialization hashes the config-files again.
+        const uint64_t cacheKey = (0 != mCacheKey or mCacheFile.empty()) ? mCacheKey
+                                                                         : hashConfigFiles();
+        mCacheKey = 0;
+        if (not readCacheFile(cacheKey)) {
+            readNodeFile();
+            readCondFile();
+            readRadFile();
+            readHtrFile();
+            readPanFile();
+            readEtcFile();
+            writeCacheFile(cacheKey);
+        }
 
         /// - Read ThermInput files for any overrides.
         readThermInputFile();
@@ -527,31 +717,28 @@ void ThermFileParser::readThermInputFileRad()
 /// @details  Private method used to generically read any of the thermal XML files. Opens the file
 ///           and accesses the <list> of thermal link data. Loops through every element in
 ///           the list and calls the register() method given by the function pointer argument.
+///           The file is streamed, so that only the current element is held in memory rather than
+///           a document of the whole file.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void ThermFileParser::readFile(std::string& xmlFile, const char* linkTag,
         void (ThermFileParser::*registerLink)(TiXmlElement*))
 {
     try
     {
-        /// - Instantiate a TiXmlDocument for loading data from the file.
-        TiXmlDocument doc;
+        /// - Validate file accessibility.
+        validateFile(xmlFile);
 
-        /// - Validate file accessibility and load XML data.
-        openFile(doc, xmlFile);
+        /// - Open the file to the contents of the <list> tag. Raise an error if not found.
+        XmlElementStream stream;
+        stream.open(xmlFile, "list");
 
-        /// - Get the element data from the <list> tag. Raise an error if not found.
-        TiXmlElement* list = getElement(&doc, "list", true);
-        /// - Get the element data from the <linkTag> tag. Don't raise an error if not found.
-        TiXmlElement* elem = getElement(list, linkTag, false);
-
-        /// - Loop through all relevant elements listed in the XML file.
-        while (0 != elem)
+        /// - Loop through all relevant elements listed in the XML file, each parsed on its own as
+        ///   it is read.
+        const std::string tag = linkTag;
+        for (TiXmlElement* elem = stream.next(tag); 0 != elem; elem = stream.next(tag))
         {
             /// - Call given register() function to populate data vectors.
             (this->*registerLink)(elem);
-
-            /// - Advance to the next element.
-            elem = elem->NextSiblingElement(linkTag);
         }
 
     } catch(TsParseException& e)
@@ -561,14 +748,13 @@ void ThermFileParser::readFile(std::string& xmlFile, const char* linkTag,
     }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in,out]  doc      (--) TiXmlDocument object to load XML file data into
-/// @param[in]      xmlFile  (--) path and name of XML file
+/// @param[in]  xmlFile  (--) path and name of XML file
 ///
-/// @throw      TsParseException if unable to access file or if XML load fails
+/// @throw      TsParseException if unable to access file
 ///
-/// @details    Loads given xml file into TiXmlDocument member.
+/// @details    Validates the accessibility of the given xml file.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::openFile(TiXmlDocument& doc, std::string& xmlFile)
+void ThermFileParser::validateFile(const std::string& xmlFile)
 {
     try
     {
@@ -580,6 +766,19 @@ void ThermFileParser::openFile(TiXmlDocument& doc, std::string& xmlFile)
         /// - Catch validateFile() exception and re-throw.
         TS_PTCS_ERREX(TsParseException, "file accessibility error", "Cannot open file for parsing.")
     }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  doc      (--) TiXmlDocument object to load XML file data into
+/// @param[in]      xmlFile  (--) path and name of XML file
+///
+/// @throw      TsParseException if unable to access file or if XML load fails
+///
+/// @details    Loads given xml file into TiXmlDocument member.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermFileParser::openFile(TiXmlDocument& doc, std::string& xmlFile)
+{
+    /// - Make sure the file is accessible.
+    validateFile(xmlFile);
 
     /// - Call TinyXml LoadFile().
     doc.LoadFile(xmlFile);
@@ -591,6 +790,270 @@ void ThermFileParser::openFile(TiXmlDocument& doc, std::string& xmlFile)
     }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  uint64_t  (--)  Hash of the config-files, or zero if a config-file can't be read.
+///
+/// @details  Computes a 64-bit FNV-1a hash of the names and contents of the six config-files.  The
+///           hash is seeded with the cache-file format version and this machine's type sizes and
+///           byte order, so that a cache-file written in another format is never matched.  The
+///           ThermInput files are not included, since their overrides are applied after the cache
+///           is loaded.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t ThermFileParser::hashConfigFiles() const
+{
+    static const uint64_t FNV_PRIME = 1099511628211ULL;
+    uint64_t hash = 14695981039346656037ULL;
+
+    const uint32_t seed[] = {CACHE_VERSION, sizeof(int), sizeof(double), 0x01020304};
+    const char* seedBytes = reinterpret_cast<const char*>(seed);
+    for (unsigned int i = 0; i < sizeof(seed); ++i) {
+        hash = (hash ^ static_cast<unsigned char>(seedBytes[i])) * FNV_PRIME;
+    }
+
+    const std::string* files[] = {&mNodeFile, &mCondFile, &mRadFile, &mHtrFile, &mPanFile, &mEtcFile};
+    for (unsigned int file = 0; file < 6; ++file) {
+        /// - Hash the file name, including its terminator so that adjacent names can't run together.
+        const std::string& name = *files[file];
+        for (unsigned int i = 0; i <= name.size(); ++i) {
+            hash = (hash ^ static_cast<unsigned char>(name.c_str()[i])) * FNV_PRIME;
+        }
+
+        /// - Hash the file contents.  Unused files have no contents, and a file that can't be read
+        ///   disables the cache, so that the XML parsing reports the error.
+        if (not name.empty()) {
+            std::ifstream stream(name.c_str(), std::ios::in | std::ios::binary);
+            if (not stream.is_open()) {
+                return 0;
+            }
+            char buffer[65536];
+            while (stream) {
+                stream.read(buffer, sizeof(buffer));
+                const std::streamsize count = stream.gcount();
+                for (std::streamsize i = 0; i < count; ++i) {
+                    hash = (hash ^ static_cast<unsigned char>(buffer[i])) * FNV_PRIME;
+                }
+            }
+        }
+    }
+
+    /// - Zero is reserved for no key.
+    return (0 == hash) ? 1 : hash;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  key  (--)  Hash of the current config-files, from hashConfigFiles().
+///
+/// @returns    bool  (--)  True if the data vectors were loaded from the cache-file.
+///
+/// @details    Memory-maps the cache-file and, if its format version and key match, loads all of the
+///             data vectors from it and rebuilds the Node map.  Returns false without changing the
+///             data if there is no cache-file or it is stale, so the caller parses the XML instead.
+///             A cache-file that matches the key but is truncated or inconsistent is discarded with
+///             a warning.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ThermFileParser::readCacheFile(const uint64_t key)
+{
+    if (mCacheFile.empty() or 0 == key) {
+        return false;
+    }
+
+    /// - Map the cache-file into memory.
+    const int fd = open(mCacheFile.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat fileStat;
+    if (0 != fstat(fd, &fileStat) or fileStat.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    const size_t size = static_cast<size_t>(fileStat.st_size);
+    void* data = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == data) {
+        return false;
+    }
+
+    /// - Check the cache-file's version and key.
+    ThermFileCacheReader reader(static_cast<const char*>(data), size);
+    uint32_t version = 0;
+    uint64_t fileKey = 0;
+    reader.getValue(version);
+    reader.getValue(fileKey);
+    if (not reader.isValid() or CACHE_VERSION != version or key != fileKey) {
+        munmap(data, size);
+        return false;
+    }
+
+    /// - Load the data vectors, in the same order as written by writeCacheFile.
+    clearAll();
+    reader.getValue(numNodes);
+    reader.getStrings(vNodeNames);
+    reader.getStrings(vCapEditGroupList);
+
+    reader.getValue(numLinksCap);
+    reader.getStrings(vCapNames);
+    reader.getValues(vCapPorts);
+    reader.getValues(vCapTemperatures);
+    reader.getValues(vCapCapacitances);
+    reader.getValues(vCapEditGroupIdentifiers);
+
+    reader.getValue(numLinksCond);
+    reader.getStrings(vCondNames);
+    reader.getValues(vCondPorts0);
+    reader.getValues(vCondPorts1);
+    reader.getValues(vCondConductivities);
+
+    reader.getValue(numLinksRad);
+    reader.getStrings(vRadNames);
+    reader.getValues(vRadPorts0);
+    reader.getValues(vRadPorts1);
+    reader.getValues(vRadCoefficients);
+
+    reader.getValue(numLinksHtr);
+    reader.getStrings(vHtrNames);
+    reader.getValues(vHtrScalars);
+    reader.getNested(vHtrPorts);
+    reader.getNested(vHtrFracs);
+
+    reader.getValue(numLinksPan);
+    reader.getStrings(vPanNames);
+    reader.getValues(vPanAreas);
+    reader.getValues(vPanAbsorptivities);
+    reader.getNested(vPanPorts);
+    reader.getNested(vPanFracs);
+
+    reader.getValue(numLinksPot);
+    reader.getStrings(vPotNames);
+    reader.getValues(vPotPorts);
+    reader.getValues(vPotTemperatures);
+    reader.getValues(vPotConductivities);
+
+    reader.getValue(numLinksSrc);
+    reader.getStrings(vSrcNames);
+    reader.getValues(vSrcInits);
+    reader.getValues(vSrcScalars);
+    reader.getNested(vSrcPorts);
+    reader.getNested(vSrcFracs);
+
+    const bool valid = reader.isValid() and reader.isEnd()
+                   and numNodes == static_cast<int>(vNodeNames.size())
+                   and numLinksCond == static_cast<int>(vCondNames.size())
+                   and numLinksRad  == static_cast<int>(vRadNames.size())
+                   and numLinksHtr  == static_cast<int>(vHtrNames.size())
+                   and numLinksPan  == static_cast<int>(vPanNames.size())
+                   and numLinksPot  == static_cast<int>(vPotNames.size())
+                   and numLinksSrc  == static_cast<int>(vSrcNames.size());
+    munmap(data, size);
+
+    if (not valid) {
+        clearAll();
+        TS_PTCS_WARNING("Ignoring corrupt cache-file: " << mCacheFile);
+        return false;
+    }
+
+    /// - Rebuild the Node map, the node index being the node's position in the names vector.
+    for (int i = 0; i < numNodes; ++i) {
+        mNodeMap[vNodeNames[i]] = i;
+    }
+    areNodesRegistered = true;
+    return true;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  key  (--)  Hash of the current config-files, from hashConfigFiles().
+///
+/// @details    Writes the data vectors parsed from the config-files to the cache-file, tagged with
+///             the given key.  The file is written under a temporary name and then renamed, so that
+///             another process never maps a partially written cache-file.  Failure to write the
+///             cache-file only issues a warning.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermFileParser::writeCacheFile(const uint64_t key)
+{
+    if (mCacheFile.empty() or 0 == key) {
+        return;
+    }
+
+    /// - Serialize the data vectors, in the same order as read by readCacheFile.
+    ThermFileCacheWriter writer;
+    writer.putValue(CACHE_VERSION);
+    writer.putValue(key);
+
+    writer.putValue(numNodes);
+    writer.putStrings(vNodeNames);
+    writer.putStrings(vCapEditGroupList);
+
+    writer.putValue(numLinksCap);
+    writer.putStrings(vCapNames);
+    writer.putValues(vCapPorts);
+    writer.putValues(vCapTemperatures);
+    writer.putValues(vCapCapacitances);
+    writer.putValues(vCapEditGroupIdentifiers);
+
+    writer.putValue(numLinksCond);
+    writer.putStrings(vCondNames);
+    writer.putValues(vCondPorts0);
+    writer.putValues(vCondPorts1);
+    writer.putValues(vCondConductivities);
+
+    writer.putValue(numLinksRad);
+    writer.putStrings(vRadNames);
+    writer.putValues(vRadPorts0);
+    writer.putValues(vRadPorts1);
+    writer.putValues(vRadCoefficients);
+
+    writer.putValue(numLinksHtr);
+    writer.putStrings(vHtrNames);
+    writer.putValues(vHtrScalars);
+    writer.putNested(vHtrPorts);
+    writer.putNested(vHtrFracs);
+
+    writer.putValue(numLinksPan);
+    writer.putStrings(vPanNames);
+    writer.putValues(vPanAreas);
+    writer.putValues(vPanAbsorptivities);
+    writer.putNested(vPanPorts);
+    writer.putNested(vPanFracs);
+
+    writer.putValue(numLinksPot);
+    writer.putStrings(vPotNames);
+    writer.putValues(vPotPorts);
+    writer.putValues(vPotTemperatures);
+    writer.putValues(vPotConductivities);
+
+    writer.putValue(numLinksSrc);
+    writer.putStrings(vSrcNames);
+    writer.putValues(vSrcInits);
+    writer.putValues(vSrcScalars);
+    writer.putNested(vSrcPorts);
+    writer.putNested(vSrcFracs);
+
+    /// - Write to a temporary file and rename it over the cache-file.
+    std::ostringstream tempFile;
+    tempFile << mCacheFile << "." << getpid() << ".tmp";
+    std::ofstream stream(tempFile.str().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    stream.write(writer.getBuffer().data(), writer.getBuffer().size());
+    stream.close();
+    if (stream.fail() or 0 != std::rename(tempFile.str().c_str(), mCacheFile.c_str())) {
+        std::remove(tempFile.str().c_str());
+        TS_PTCS_WARNING("Could not write cache-file: " << mCacheFile);
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Clears the Node, cap-edit group and all link data vectors and counts.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermFileParser::clearAll()
+{
+    areNodesRegistered = false;
+    clearNode();
+    clearCap();
+    vCapEditGroupList.clear();
+    vCapEditGroupIdentifiers.clear();
+    clearCond();
+    clearRad();
+    clearHtr();
+    clearPan();
+    clearPot();
+    clearSrc();
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Clears Node name vector and map object. Resets the number of Nodes count.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void ThermFileParser::clearNode()
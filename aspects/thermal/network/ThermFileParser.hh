@@ -20,13 +20,22 @@ PURPOSE:
           - etc-file:  et.cetera; Other link types, namely <potential> and <source>
     ThermalNetwork calls the ThermFileParser's initialize() method, which parses each file's
     specific XML tag structure, and stores the relevant data into its link-specific vectors.
-    ThermalNetwork accesses these vectors and uses their data to construct a GUNNS network.)
+    ThermalNetwork accesses these vectors and uses their data to construct a GUNNS network.
+    Optionally, the parsed data vectors are stored in a compiled binary cache-file, keyed by a hash
+    of the config-files' names and contents.  On later initializations the cache-file is
+    memory-mapped and loaded in place of parsing the XML, as long as the config-files are unchanged.)
 
 REFERENCE:
    ()
 
 ASSUMPTIONS AND LIMITATIONS:
-   (This class utilizes tinyxml, hence is limited to take in only XML files.)
+   ((This class utilizes tinyxml, hence is limited to take in only XML files.  The files are
+     streamed one link element at a time, so an ill-formed file may have links registered from the
+     elements preceding the error before the parsing error is thrown.)
+    (The cache-file is in the native binary format of the machine that wrote it.  A cache-file
+     written by a machine with a different byte order or type sizes is not recognized, and is
+     rewritten from the XML.)
+    (Warnings for links skipped while parsing the XML are not repeated when loading the cache.))
 
 LIBRARY DEPENDENCY:
    (ThermFileParser.o)
@@ -35,11 +44,13 @@ PROGRAMMERS:
    ((Joe Valerioti) (L3) (Dec 2012)))
 @{
 ***************************************************************************************************/
+#include "parsing/XmlElementStream.hh"
 #include "parsing/tinyxml/tinyxml.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include <string>
 #include <vector>
 #include <map>
+#include <stdint.h>
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Parses the ThermalNetwork config-files and stores the data into vectors.
 ///
@@ -63,6 +74,7 @@ class ThermFileParser
 
     protected:
         static const int                   NOT_FOUND;                /**<    (--)  trick_chkpnt_io(**) result for a node not registered in the Node map */
+        static const uint32_t              CACHE_VERSION;            /**<    (--)  trick_chkpnt_io(**) format version of the binary cache-file */
         bool                               areNodesRegistered;       /**<    (--)                      True if Nodes file successfully parsed. */
         std::string                        mName;                    /**<    (--)  trick_chkpnt_io(**) Parser name. */
 
@@ -76,6 +88,8 @@ class ThermFileParser
 
         std::string                        mThermInputFile;          /**<    (--)  trick_chkpnt_io(**) name of thermal input-file to parse */
         std::string                        mThermInputFileRad;       /**<    (--)  trick_chkpnt_io(**) name of radiation thermal input-file to parse */
+        std::string                        mCacheFile;               /**<    (--)  trick_chkpnt_io(**) optional binary cache-file of the parsed config-file data */
+        uint64_t                           mCacheKey;                /**<    (--)  trick_chkpnt_io(**) config-files hash from preCountNodes, reused by initialize, or zero */
 
         // Node attributes ////////////////////////////////////////////////////////////////////////////
         int                                numNodes;                 /**<    (--)                      number of nodes in the network */
@@ -161,11 +175,22 @@ class ThermFileParser
         /// @brief  Edits existing link data by reading overrides described in the ThermInput file.
         void readThermInputFileRad();
 
+        /// @brief  Returns the hash of the config-files names and contents, used as the cache key.
+        uint64_t hashConfigFiles() const;
+        /// @brief  Loads the parsed data vectors from the cache-file if it matches the given key.
+        bool readCacheFile(const uint64_t key);
+        /// @brief  Writes the parsed data vectors to the cache-file with the given key.
+        void writeCacheFile(const uint64_t key);
+
         /// @brief  Private method used to generically ready any of the thermal XML files.
         void readFile(std::string& xmlFile, const char* linkTag, void (ThermFileParser::*registerLink)(TiXmlElement*));
+        /// @brief  Private method used to validate file accessibility.
+        void validateFile(const std::string& xmlFile);
         /// @brief  Private method used to validate file accessibility and set doc member.
         void openFile(TiXmlDocument& doc, std::string& xmlFile);
 
+        /// @brief  Clears all Node and link data vectors.
+        void clearAll();
         /// @brief  Clears Node data vectors.
         void clearNode();
         /// @brief  Clears Capacitance link data vectors.
@@ -10,6 +10,7 @@ LIBRARY DEPENDENCY:
     (aspects/thermal/GunnsThermalCapacitor.o)
     (core/GunnsBasicConductor.o)
     (aspects/thermal/GunnsThermalRadiation.o)
+    (aspects/thermal/GunnsThermalRadiationBank.o)
     (aspects/thermal/GunnsThermalHeater.o)
     (aspects/thermal/GunnsThermalPanel.o)
     (aspects/thermal/GunnsThermalPotential.o)
@@ -33,6 +34,8 @@ LIBRARY DEPENDENCY:
 /// @param[in]  htrFile   (--)  xml file with heater link data
 /// @param[in]  panFile   (--)  xml file with thermal-panel data
 /// @param[in]  etcFile   (--)  xml file with other thermal link data (potentials, sources, etc)
+/// @param[in]  radiationBank (--) build the radiation links into one batched link
+/// @param[in]  cacheFile (--)  optional binary cache-file of the parsed xml file data
 ///
 /// @details    Constructs this ThermalNetwork configuration data.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,14 +45,18 @@ ThermalNetworkConfigData::ThermalNetworkConfigData(
         std::string radFile,
         std::string htrFile,
         std::string panFile,
-        std::string etcFile)
+        std::string etcFile,
+        const bool  radiationBank,
+        std::string cacheFile)
     :
     cNodeFile(nodeFile),
     cCondFile(condFile),
     cRadFile(radFile),
     cHtrFile(htrFile),
     cPanFile(panFile),
-    cEtcFile(etcFile)
+    cEtcFile(etcFile),
+    cRadiationBank(radiationBank),
+    cCacheFile(cacheFile)
 {
     // nothing to do
 }
@@ -65,7 +72,9 @@ ThermalNetworkConfigData::ThermalNetworkConfigData(const ThermalNetworkConfigDat
     cRadFile(that.cRadFile),
     cHtrFile(that.cHtrFile),
     cPanFile(that.cPanFile),
-    cEtcFile(that.cEtcFile)
+    cEtcFile(that.cEtcFile),
+    cRadiationBank(that.cRadiationBank),
+    cCacheFile(that.cCacheFile)
 {
     // nothing to do
 }
@@ -133,6 +142,7 @@ ThermalNetwork::ThermalNetwork(const std::string& name)
     mPanels(0),
     mPotentialLinks(0),
     mSources(0),
+    mRadiationBank(),
     mMalfHtrMiswireFlag(false),
     mMalfHtrIndexValue(0),
     mHtrPowerElectrical(0),
@@ -201,6 +211,7 @@ void ThermalNetwork::initNodes(const std::string& name)
     parser.mHtrFile           = mConfig.cHtrFile;
     parser.mPanFile           = mConfig.cPanFile;
     parser.mEtcFile           = mConfig.cEtcFile;
+    parser.mCacheFile         = mConfig.cCacheFile;
     parser.mThermInputFile    = mInput.iThermInputFile;
     parser.mThermInputFileRad = mInput.iInputRadFile;
 
@@ -441,9 +452,17 @@ void ThermalNetwork::allocate()
     ////////////////////////////////////////////////////////////////////////////////////////////////
     if (numLinksRad > 0)
     {
-        /// - Allocate links array.
-        TS_NEW_CLASS_ARRAY_EXT(mRadiationLinks, numLinksRad, GunnsThermalRadiation, (),
-                               std::string(mName) + ".mRadiationLinks");
+        /// - Allocate links array, unless the links are batched into the radiation bank, which
+        ///   still uses the ConfigData and InputData arrays.
+        if (not mConfig.cRadiationBank)
+        {
+            TS_NEW_CLASS_ARRAY_EXT(mRadiationLinks, numLinksRad, GunnsThermalRadiation, (),
+                                   std::string(mName) + ".mRadiationLinks");
+
+            /// - Throw an exception if null pointer to the Network's Radiation links.
+            TS_PTCS_IF_ERREX(0 == mRadiationLinks, TsInitializationException,
+                    "allocation error,", "Null pointer to RadiationLinks.");
+        }
 
         /// - Allocate ConfigData pointer array.
         mRadiationConfigData = new GunnsThermalRadiationConfigData*[numLinksRad];
@@ -451,9 +470,6 @@ void ThermalNetwork::allocate()
         /// - Allocate InputData pointer array.
         mRadiationInputData = new GunnsThermalRadiationInputData*[numLinksRad];
 
-        /// - Throw an exception if null pointer to the Network's Radiation links.
-        TS_PTCS_IF_ERREX(0 == mRadiationLinks, TsInitializationException,
-                "allocation error,", "Null pointer to RadiationLinks.");
         /// - Throw an exception if null pointer to the Network's RadiationConfigData.
         TS_PTCS_IF_ERREX(0 == mRadiationConfigData, TsInitializationException,
                 "allocation error,", "Null pointer to RadiationConfigData.");
@@ -807,8 +823,14 @@ void ThermalNetwork::buildLinks()
     /// - Call initialize() on each Conduction Link.
     buildLinkType("Conduction", numLinksCond, &ThermalNetwork::initializeCond);
 
-    /// - Call initialize() on each Radiation Link.
-    buildLinkType("Radiation", numLinksRad, &ThermalNetwork::initializeRad);
+    /// - Call initialize() on each Radiation Link, or on the batched radiation link.
+    if (mConfig.cRadiationBank)
+    {
+        initializeRadBank();
+    } else
+    {
+        buildLinkType("Radiation", numLinksRad, &ThermalNetwork::initializeRad);
+    }
 
     /// - Call initialize() on each Heater.
     buildLinkType("Heater", numLinksHtr, &ThermalNetwork::initializeHtr);
@@ -909,6 +931,45 @@ void ThermalNetwork::initializeRad(int i)
                                   port1);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Initializes all Radiation links as paths of the one batched radiation link, from the
+///           same Config and Input data as the individual links.  The path index of each link is
+///           its index in the Radiation arrays.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermalNetwork::initializeRadBank()
+{
+    if (numLinksRad < 1)
+    {
+        return;
+    }
+
+    /// - Gather the node numbers, coefficients and view scalars of all links.
+    std::vector<int>    nodes0(numLinksRad);
+    std::vector<int>    nodes1(numLinksRad);
+    std::vector<double> coefficients(numLinksRad);
+    std::vector<double> viewScalars(numLinksRad);
+    for(int i = 0; i < numLinksRad; ++i)
+    {
+        nodes0[i]       = parser.vRadPorts0.at(i) + netSuperNodesOffset;
+        nodes1[i]       = parser.vRadPorts1.at(i) + netSuperNodesOffset;
+        coefficients[i] = mRadiationConfigData[i]->mDefaultConductivity;
+        viewScalars[i]  = mRadiationInputData[i]->iViewScalar;
+    }
+
+    try
+    {
+        /// - Initialize the batched link with all of the paths.
+        const GunnsThermalRadiationBankConfigData config(std::string(mName) + ".mRadiationBank",
+                                                         &netNodeList, &coefficients);
+        const GunnsThermalRadiationBankInputData  input(false, 0.0, &viewScalars);
+        mRadiationBank.initialize(config, input, netLinks, &nodes0, &nodes1);
+
+    } catch (TsInitializationException& e)
+    {
+        /// - Send warning report on link initialization failure.
+        TS_PTCS_WARNING("Radiation bank: Exception while initializing.");
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  i  (--)  index of specific link within Heater arrays
 ///
 /// @details  Sub-function to initialize a specific Heater link. As an argument to its initialize()
@@ -1247,6 +1308,150 @@ void ThermalNetwork::setMalfHtrMiswire(const bool flag, const int* index)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name (--) Name of the radiation link, as given in the radiation config-file.
+///
+/// @returns  int  (--)  Index of the named radiation link, or -1 if not found.
+///
+/// @details  Returns the index of the named radiation link, for use with the other radiation access
+///           methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int ThermalNetwork::getRadiationIndex(const std::string& name) const
+{
+    for(int i = 0; i < numLinksRad; ++i)
+    {
+        if (name == parser.vRadNames.at(i))
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] index (--) Index of the radiation link.
+///
+/// @returns  bool  (--)  True if the given radiation link index is valid.
+///
+/// @details  Returns whether the given radiation link index is valid, and issues a warning if not.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ThermalNetwork::isValidRadiationIndex(const int index) const
+{
+    if (MsMath::isInRange(0, index, numLinksRad - 1))
+    {
+        return true;
+    }
+    TS_PTCS_WARNING("Radiation link index out of bounds.");
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] index  (--) Index of the radiation link.
+/// @param[in] scalar (--) Value to scale the link's radiation coefficient by.
+///
+/// @details  Sets the view scalar of the given radiation link, in either the batched radiation link
+///           or the individual links array.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermalNetwork::setRadiationViewScalar(const int index, const double scalar)
+{
+    if (isValidRadiationIndex(index))
+    {
+        if (mConfig.cRadiationBank)
+        {
+            mRadiationBank.setViewScalar(index, scalar);
+        } else
+        {
+            mRadiationLinks[index].setViewScalar(scalar);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] index (--) Index of the radiation link.
+///
+/// @returns  double  (--)  View scalar of the given radiation link, or zero if out of bounds.
+///
+/// @details  Returns the view scalar of the given radiation link.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double ThermalNetwork::getRadiationViewScalar(const int index) const
+{
+    if (isValidRadiationIndex(index))
+    {
+        if (mConfig.cRadiationBank)
+        {
+            return mRadiationBank.getViewScalar(index);
+        }
+        return mRadiationLinks[index].getViewScalar();
+    }
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] index (--) Index of the radiation link.
+///
+/// @returns  double  (W/K)  Linearized conductance of the given radiation link, or zero if out of
+///                          bounds.
+///
+/// @details  Returns the linearized conductance of the given radiation link from the last step,
+///           including its view scalar and blockage.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double ThermalNetwork::getRadiationConductance(const int index) const
+{
+    if (isValidRadiationIndex(index))
+    {
+        if (mConfig.cRadiationBank)
+        {
+            return mRadiationBank.getConductance(index);
+        }
+        return mRadiationLinks[index].getAdmittanceMatrix()[0];
+    }
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] index (--) Index of the radiation link.
+///
+/// @returns  double  (W)  Heat flux through the given radiation link, or zero if out of bounds.
+///
+/// @details  Returns the heat flux through the given radiation link from the last step, positive
+///           from its node0 to its node1.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double ThermalNetwork::getRadiationFlux(const int index) const
+{
+    if (isValidRadiationIndex(index))
+    {
+        if (mConfig.cRadiationBank)
+        {
+            return mRadiationBank.getPathFlux(index);
+        }
+        return mRadiationLinks[index].getFlux();
+    }
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] index (--) Index of the radiation link.
+/// @param[in] flag  (--) Malfunction activation flag, true activates.
+/// @param[in] value (--) Malfunction blockage fraction (0-1).
+///
+/// @details  Sets the blockage malfunction of the given radiation link, in either the batched
+///           radiation link or the individual links array.  Calling this with the default arguments
+///           resets the malfunction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermalNetwork::setRadiationMalfBlockage(const int index, const bool flag, const double value)
+{
+    if (isValidRadiationIndex(index))
+    {
+        if (mConfig.cRadiationBank)
+        {
+            mRadiationBank.setMalfPathBlockage(index, flag, value);
+        } else
+        {
+            mRadiationLinks[index].setMalfBlockage(flag, value);
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @throws   TsParseException
 ///
@@ -1255,7 +1460,13 @@ void ThermalNetwork::setMalfHtrMiswire(const bool flag, const int* index)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 int ThermalNetwork::getNumLocalNodes()
 {
-    parser.mNodeFile = mConfig.cNodeFile;
+    parser.mNodeFile  = mConfig.cNodeFile;
+    parser.mCondFile  = mConfig.cCondFile;
+    parser.mRadFile   = mConfig.cRadFile;
+    parser.mHtrFile   = mConfig.cHtrFile;
+    parser.mPanFile   = mConfig.cPanFile;
+    parser.mEtcFile   = mConfig.cEtcFile;
+    parser.mCacheFile = mConfig.cCacheFile;
     parser.preCountNodes();
     netNumLocalNodes = parser.numNodes;
     return netNumLocalNodes;
@@ -57,6 +57,7 @@ PROGRAMMERS:
 #include "aspects/thermal/GunnsThermalCapacitor.hh"
 #include "core/GunnsBasicConductor.hh"
 #include "aspects/thermal/GunnsThermalRadiation.hh"
+#include "aspects/thermal/GunnsThermalRadiationBank.hh"
 #include "aspects/thermal/GunnsThermalHeater.hh"
 #include "aspects/thermal/GunnsThermalPanel.hh"
 #include "aspects/thermal/GunnsThermalPotential.hh"
@@ -81,6 +82,8 @@ class ThermalNetworkConfigData
         std::string  cHtrFile;  /**< (--) trick_chkpnt_io(**) name of xml file with heater/source link data */
         std::string  cPanFile;  /**< (--) trick_chkpnt_io(**) name of xml file with thermal-panel data */
         std::string  cEtcFile;  /**< (--) trick_chkpnt_io(**) name of xml file with other thermal link data */
+        bool         cRadiationBank; /**< (--) trick_chkpnt_io(**) build the radiation links into one batched GunnsThermalRadiationBank link */
+        std::string  cCacheFile; /**< (--) trick_chkpnt_io(**) optional name of binary cache-file of the parsed xml file data */
 
         /// @brief   Default constructs this ThermalNetwork configuration data.
         ThermalNetworkConfigData(std::string nodeFile = "",
@@ -88,7 +91,9 @@ class ThermalNetworkConfigData
                                  std::string radFile = "",
                                  std::string htrFile = "",
                                  std::string panFile = "",
-                                 std::string etcFile = "");
+                                 std::string etcFile = "",
+                                 const bool  radiationBank = false,
+                                 std::string cacheFile = "");
         /// @brief   Default destructs this ThermalNetwork configuration data.
         ~ThermalNetworkConfigData();
         /// @brief   Copy constructs this ThermalNetwork configuration data.
@@ -135,6 +140,16 @@ class ThermalNetworkInputData
 ///           class can support any number of each link-type. ThermalNetwork initializes the links
 ///           with their Config/Input data and connects them to their respective nodes in the
 ///           GUNNS network.
+///
+///           When mConfig.cRadiationBank is set, the radiation links are built into the single
+///           mRadiationBank link instead of the mRadiationLinks array, which linearizes all of them
+///           in one pass over contiguous arrays.  This is much faster for networks with thousands of
+///           radiation links.  The radiation access methods below work with either form, and
+///           should be used for view scalars and blockage malfunctions instead of the
+///           mRadiationLinks terms, which don't exist in bank mode.  The radiation view scalar
+///           entries of an ICD for a bank mode network must be generated with the
+///           IcdSettings.mRadiationBank option of ThermAspectGenerate, so that they target the
+///           mRadiationBank.mViewScalars array instead of mRadiationLinks.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class ThermalNetwork : public GunnsNetworkBase
 {
@@ -161,6 +176,9 @@ class ThermalNetwork : public GunnsNetworkBase
         GunnsThermalSource*    mSources;          /**<    (--) trick_chkpnt_io(**) GunnsThermalSource object array    */
         /// @}
 
+        /// @details  Used instead of mRadiationLinks when mConfig.cRadiationBank is set.
+        GunnsThermalRadiationBank mRadiationBank; /**<    (--)                     Batched radiation link */
+
         /// @name    Malfunction terms.
         /// @{
         /// @details Malfunction targets are public to allow access from the Trick events processor.
@@ -197,6 +215,19 @@ class ThermalNetwork : public GunnsNetworkBase
         void setIslandMode(const Gunns::IslandMode mode);
         /// @brief Sets and resets the heater miswire malfunction.
         void setMalfHtrMiswire(const bool flag = false, const int* index = 0);
+        /// @brief Returns the index of the named radiation link.
+        int    getRadiationIndex(const std::string& name) const;
+        /// @brief Sets the view scalar of the given radiation link.
+        void   setRadiationViewScalar(const int index, const double scalar);
+        /// @brief Returns the view scalar of the given radiation link.
+        double getRadiationViewScalar(const int index) const;
+        /// @brief Returns the linearized conductance of the given radiation link.
+        double getRadiationConductance(const int index) const;
+        /// @brief Returns the heat flux through the given radiation link.
+        double getRadiationFlux(const int index) const;
+        /// @brief Sets and resets the blockage malfunction of the given radiation link.
+        void   setRadiationMalfBlockage(const int index, const bool flag = false,
+                                        const double value = 0.0);
 
    protected:
         /// @details  The mHtrPowerElectrical array will be set by the simbus with values from EPS.
@@ -270,6 +301,10 @@ class ThermalNetwork : public GunnsNetworkBase
         void initializeCond(int i);
         /// @brief  Sub-function to initialize a specific Radiation link
         void initializeRad(int i);
+        /// @brief  Initializes all Radiation links as one batched link
+        void initializeRadBank();
+        /// @brief  Returns whether the given radiation link index is valid.
+        bool isValidRadiationIndex(const int index) const;
         /// @brief  Sub-function to initialize a specific Heater link
         void initializeHtr(int i);
         /// @brief  Sub-function to initialize a specific Panel link
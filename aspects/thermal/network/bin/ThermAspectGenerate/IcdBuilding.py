@@ -172,7 +172,10 @@ class IcdBuilder:
         ## If no readElements passed, then Ptcs does the reading.
         elif None == readElements:
             ## Substitute the simVarName for Ptcs reads.
-            simVarName = self.mNetwork + self.mIcdSettings.mSvnRead[linkType].replace("%i", iter)
+            svnKey = linkType
+            if 'radiation' == linkType and self.mIcdSettings.mRadiationBank:
+                svnKey = 'radiationBank'
+            simVarName = self.mNetwork + self.mIcdSettings.mSvnRead[svnKey].replace("%i", iter)
             ptcsIcdElement.find("simVarName").text = simVarName  % id
             readElements = [ptcsIcdElement]
 
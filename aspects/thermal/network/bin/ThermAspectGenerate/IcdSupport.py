@@ -67,9 +67,15 @@ class IcdSettings():
         self.mSvnRead['capacitor']  = ".therm.mCapacitanceLinks[%s].mExternalHeatFlux[%i]"
         self.mSvnRead['potential']  = ".therm.mPotentialLinks[%s].mSourcePotential"
         self.mSvnRead['radiation']  = ".therm.mRadiationLinks[%s].mViewScalar"
+        self.mSvnRead['radiationBank'] = ".therm.mRadiationBank.mViewScalars[%s]"
         self.mSvnRead['panel']      = ".therm.mPanels[%s].mIncidentHeatFluxPerArea"
         self.mSvnRead['source']     = ".therm.mSources[%s].mDemandedFlux"
 
+        ## Set True when the network is configured with ThermalNetworkConfigData.cRadiationBank, so
+        ## that radiation reads target the batched radiation link's view scalar of each path
+        ## instead of the mRadiationLinks array, which isn't allocated in that mode.
+        self.mRadiationBank = False
+
         notSet = "[must explicitly be set]"
 
         ## Name of sim system, ex: "iss"
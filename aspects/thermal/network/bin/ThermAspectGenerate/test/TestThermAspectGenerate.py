@@ -295,6 +295,44 @@ class TestThermBuilder(unittest.TestCase):
         self.assertAlmostEqual(float(radCoeffRegis), tRadCoeffRegis)
         self.assertAlmostEqual(float(radCoeffTd), tRadCoeffTd)
 
+    def test_52_radiation_bank_icd(self):
+        print "\n(5.2) Test radiation bank ICD entries.\n  ",
+
+        ## Generate separate ICD and TrickView files with the radiation reads targeting the
+        ## radiation bank.
+        bankIcdFile = "TEXT_bank.txt"
+        bankFiles = [bankIcdFile]
+        self.mThermAspectConfig.cIcdFile = bankIcdFile
+        for indivNetworkConfig in self.mThermAspectConfig.cListNetworkConfigs:
+            indivNetworkConfig.cIcdSettings.mRadiationBank = True
+            indivNetworkConfig.cTvFile = "TV_icd_bank_%s.tv" % indivNetworkConfig.cNetwork
+            bankFiles.append(indivNetworkConfig.cTvFile)
+        bankArticle = ThermAspectBuilder()
+        bankArticle.initialize(self.mThermAspectConfig)
+        icdText = ""
+        tvText = ""
+        try:
+            bankArticle.execute()
+            f_icd = open(bankIcdFile, 'r')
+            icdText = f_icd.read()
+            f_icd.close()
+            f_tv = open("TV_icd_bank_%s.tv" % tNetwork, 'r')
+            tvText = f_tv.read()
+            f_tv.close()
+        except (Exception), e:
+            print e
+            self.fail("Uncaught exception during execute().")
+        finally:
+            for bankFile in bankFiles:
+                if os.path.exists(bankFile):
+                    os.remove(bankFile)
+
+        ## Test that the view scalar reads use the bank's path array instead of the radiation links.
+        self.assertTrue("test.therm.mRadiationBank.mViewScalars[rad0_GOOD_RAD_5]" in icdText)
+        self.assertFalse("mRadiationLinks" in icdText)
+        self.assertTrue("test.therm.mRadiationBank.mViewScalars[0]" in tvText)
+        self.assertFalse("mRadiationLinks" in tvText)
+
 # =================================================================================================
 # Primary function
 # =================================================================================================
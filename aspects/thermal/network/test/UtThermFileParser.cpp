@@ -8,7 +8,10 @@
 #include "UtThermFileParser.hh"
 #include "software/exceptions/TsParseException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <string>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -269,6 +272,7 @@ void UtThermFileParser::testConstruction()
     CPPUNIT_ASSERT_EQUAL_MESSAGE("NOT_FOUND", -99, article.NOT_FOUND );
     CPPUNIT_ASSERT_EQUAL_MESSAGE("areNodesRegistered", false, article.areNodesRegistered );
     CPPUNIT_ASSERT_MESSAGE("mName", "" == article.mName );
+    CPPUNIT_ASSERT_MESSAGE("mCacheFile", "" == article.mCacheFile );
 
     /// @test  Node data
     CPPUNIT_ASSERT_EQUAL_MESSAGE("numNodes",   0, article.numNodes );
@@ -623,3 +627,144 @@ void UtThermFileParser::testThermInput()
 
     std::cout << " Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the binary cache-file of parsed data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermFileParser::testCacheFile()
+{
+    std::cout << "\n ThermFileParser 13: Testing binary cache-file..................";
+
+    const std::string cacheFile = "ThermFileParser_cache.bin";
+    std::remove(cacheFile.c_str());
+
+    /// - Initialize an article with a cache-file, which doesn't exist yet.
+    FriendlyThermFileParser article1;
+    article1.mNodeFile  = tNodeFile;
+    article1.mCondFile  = tCondFile;
+    article1.mRadFile   = tRadFile;
+    article1.mHtrFile   = tHtrFile;
+    article1.mPanFile   = tPanFile;
+    article1.mEtcFile   = tEtcFile;
+    article1.mCacheFile = cacheFile;
+    const uint64_t key = article1.hashConfigFiles();
+    CPPUNIT_ASSERT(0 != key);
+    CPPUNIT_ASSERT(not article1.readCacheFile(key));
+    CPPUNIT_ASSERT_NO_THROW(article1.initialize("article1"));
+
+    /// @test  The cache-file is written from the parsed XML.
+    std::ifstream written(cacheFile.c_str());
+    CPPUNIT_ASSERT(written.is_open());
+    written.close();
+
+    /// @test  A second article loads the same data from the cache-file.
+    FriendlyThermFileParser article2;
+    article2.mNodeFile  = tNodeFile;
+    article2.mCondFile  = tCondFile;
+    article2.mRadFile   = tRadFile;
+    article2.mHtrFile   = tHtrFile;
+    article2.mPanFile   = tPanFile;
+    article2.mEtcFile   = tEtcFile;
+    article2.mCacheFile = cacheFile;
+    CPPUNIT_ASSERT_EQUAL(key, article2.hashConfigFiles());
+    CPPUNIT_ASSERT(article2.readCacheFile(key));
+    CPPUNIT_ASSERT(article2.areNodesRegistered);
+    CPPUNIT_ASSERT_EQUAL(tArticle->numNodes,     article2.numNodes);
+    CPPUNIT_ASSERT(tArticle->vNodeNames        == article2.vNodeNames);
+    CPPUNIT_ASSERT(tArticle->mNodeMap          == article2.mNodeMap);
+    CPPUNIT_ASSERT(tArticle->vCapEditGroupList == article2.vCapEditGroupList);
+    CPPUNIT_ASSERT_EQUAL(tArticle->numLinksCap,  article2.numLinksCap);
+    CPPUNIT_ASSERT(tArticle->vCapNames         == article2.vCapNames);
+    CPPUNIT_ASSERT(tArticle->vCapPorts         == article2.vCapPorts);
+    CPPUNIT_ASSERT(tArticle->vCapTemperatures  == article2.vCapTemperatures);
+    CPPUNIT_ASSERT(tArticle->vCapCapacitances  == article2.vCapCapacitances);
+    CPPUNIT_ASSERT(tArticle->vCapEditGroupIdentifiers == article2.vCapEditGroupIdentifiers);
+    CPPUNIT_ASSERT_EQUAL(tArticle->numLinksCond, article2.numLinksCond);
+    CPPUNIT_ASSERT(tArticle->vCondNames        == article2.vCondNames);
+    CPPUNIT_ASSERT(tArticle->vCondPorts0       == article2.vCondPorts0);
+    CPPUNIT_ASSERT(tArticle->vCondPorts1       == article2.vCondPorts1);
+    CPPUNIT_ASSERT(tArticle->vCondConductivities == article2.vCondConductivities);
+    CPPUNIT_ASSERT_EQUAL(tArticle->numLinksRad,  article2.numLinksRad);
+    CPPUNIT_ASSERT(tArticle->vRadNames         == article2.vRadNames);
+    CPPUNIT_ASSERT(tArticle->vRadPorts0        == article2.vRadPorts0);
+    CPPUNIT_ASSERT(tArticle->vRadPorts1        == article2.vRadPorts1);
+    CPPUNIT_ASSERT(tArticle->vRadCoefficients  == article2.vRadCoefficients);
+    CPPUNIT_ASSERT_EQUAL(tArticle->numLinksHtr,  article2.numLinksHtr);
+    CPPUNIT_ASSERT(tArticle->vHtrNames         == article2.vHtrNames);
+    CPPUNIT_ASSERT(tArticle->vHtrScalars       == article2.vHtrScalars);
+    CPPUNIT_ASSERT(tArticle->vHtrPorts         == article2.vHtrPorts);
+    CPPUNIT_ASSERT(tArticle->vHtrFracs         == article2.vHtrFracs);
+    CPPUNIT_ASSERT_EQUAL(tArticle->numLinksPan,  article2.numLinksPan);
+    CPPUNIT_ASSERT(tArticle->vPanNames         == article2.vPanNames);
+    CPPUNIT_ASSERT(tArticle->vPanAreas         == article2.vPanAreas);
+    CPPUNIT_ASSERT(tArticle->vPanAbsorptivities == article2.vPanAbsorptivities);
+    CPPUNIT_ASSERT(tArticle->vPanPorts         == article2.vPanPorts);
+    CPPUNIT_ASSERT(tArticle->vPanFracs         == article2.vPanFracs);
+    CPPUNIT_ASSERT_EQUAL(tArticle->numLinksPot,  article2.numLinksPot);
+    CPPUNIT_ASSERT(tArticle->vPotNames         == article2.vPotNames);
+    CPPUNIT_ASSERT(tArticle->vPotPorts         == article2.vPotPorts);
+    CPPUNIT_ASSERT(tArticle->vPotTemperatures  == article2.vPotTemperatures);
+    CPPUNIT_ASSERT(tArticle->vPotConductivities == article2.vPotConductivities);
+    CPPUNIT_ASSERT_EQUAL(tArticle->numLinksSrc,  article2.numLinksSrc);
+    CPPUNIT_ASSERT(tArticle->vSrcNames         == article2.vSrcNames);
+    CPPUNIT_ASSERT(tArticle->vSrcInits         == article2.vSrcInits);
+    CPPUNIT_ASSERT(tArticle->vSrcScalars       == article2.vSrcScalars);
+    CPPUNIT_ASSERT(tArticle->vSrcPorts         == article2.vSrcPorts);
+    CPPUNIT_ASSERT(tArticle->vSrcFracs         == article2.vSrcFracs);
+
+    /// @test  ThermInput overrides are still applied on top of the cached data.
+    article2.mThermInputFile = tThermInputFile;
+    CPPUNIT_ASSERT_NO_THROW(article2.initialize("article2"));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(12.34, article2.vCapTemperatures.at(0), tTol);
+
+    /// @test  The node pre-count from the cache-file.
+    FriendlyThermFileParser article3;
+    article3.mNodeFile  = tNodeFile;
+    article3.mCondFile  = tCondFile;
+    article3.mRadFile   = tRadFile;
+    article3.mHtrFile   = tHtrFile;
+    article3.mPanFile   = tPanFile;
+    article3.mEtcFile   = tEtcFile;
+    article3.mCacheFile = cacheFile;
+    article3.preCountNodes();
+    CPPUNIT_ASSERT_EQUAL(tNumNodes, article3.numNodes);
+
+    /// @test  The initialization reuses the config-files hash from the node pre-count, and then
+    ///        forgets it.
+    CPPUNIT_ASSERT_EQUAL(key, article3.mCacheKey);
+    CPPUNIT_ASSERT_NO_THROW(article3.initialize("article3"));
+    CPPUNIT_ASSERT_EQUAL(uint64_t(0), article3.mCacheKey);
+    CPPUNIT_ASSERT(tArticle->vCondNames == article3.vCondNames);
+
+    /// @test  A stale cache-file is not loaded and leaves the data alone.
+    CPPUNIT_ASSERT(not article2.readCacheFile(key + 1));
+    CPPUNIT_ASSERT_EQUAL(tNumNodes, article2.numNodes);
+
+    /// @test  A config-file change or missing config-file changes or disables the key.
+    article3.mEtcFile = "";
+    CPPUNIT_ASSERT(key != article3.hashConfigFiles());
+    article3.mEtcFile = "calabria.xml";
+    CPPUNIT_ASSERT(0 == article3.hashConfigFiles());
+    CPPUNIT_ASSERT(not article3.readCacheFile(0));
+
+    /// @test  A truncated cache-file is discarded, and then rewritten from the XML.
+    {
+        std::ifstream in(cacheFile.c_str(), std::ios::in | std::ios::binary);
+        const std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+        std::ofstream out(cacheFile.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        out.write(contents.data(), contents.size() / 2);
+        out.close();
+    }
+    CPPUNIT_ASSERT(not article2.readCacheFile(key));
+    CPPUNIT_ASSERT_EQUAL(0, article2.numNodes);
+    CPPUNIT_ASSERT(article2.vNodeNames.empty());
+    CPPUNIT_ASSERT(article2.mNodeMap.empty());
+    CPPUNIT_ASSERT_NO_THROW(article2.initialize("article2"));
+    CPPUNIT_ASSERT_EQUAL(tNumNodes, article2.numNodes);
+    CPPUNIT_ASSERT(article1.readCacheFile(key));
+
+    std::remove(cacheFile.c_str());
+
+    std::cout << " Pass";
+}
@@ -75,6 +75,8 @@ class UtThermFileParser: public CppUnit::TestFixture
         void testSrc();
         /// @brief  Tests for correct edit of data by reading of ThermInput file.
         void testThermInput();
+        /// @brief  Tests the binary cache-file of parsed data.
+        void testCacheFile();
 
     private:
         CPPUNIT_TEST_SUITE(UtThermFileParser);
@@ -89,6 +91,7 @@ class UtThermFileParser: public CppUnit::TestFixture
         CPPUNIT_TEST(testPot);
         CPPUNIT_TEST(testSrc);
         CPPUNIT_TEST(testThermInput);
+        CPPUNIT_TEST(testCacheFile);
         CPPUNIT_TEST_SUITE_END();
 
         /// @brief  (s)  Nominal time step
@@ -15,6 +15,7 @@
 #include "software/exceptions/TsInitializationException.hh"
 #include "simulation/hs/TsHsUtMacro.hh" // needed for TEST_HS macro
 #include "core/network/GunnsBasicSuperNetwork.hh"
+#include "core/GunnsSnapshot.hh"
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  This is the default constructor for the UtThermalNetwork class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -134,7 +135,7 @@ void UtThermalNetwork::testConfig()
     TEST_HS(test);
 
     /// - Nominally construct config.
-    ThermalNetworkConfigData config(tNodeFile,tCondFile,tRadFile,tHtrFile,tPanFile);
+    ThermalNetworkConfigData config(tNodeFile,tCondFile,tRadFile,tHtrFile,tPanFile,"",true,"cache.bin");
     /// @test   Default config data.
     CPPUNIT_ASSERT_MESSAGE("cNodeFile", tNodeFile == config.cNodeFile);
     CPPUNIT_ASSERT_MESSAGE("cCondFile", tCondFile == config.cCondFile);
@@ -142,6 +143,8 @@ void UtThermalNetwork::testConfig()
     CPPUNIT_ASSERT_MESSAGE( "cHtrFile", tHtrFile == config.cHtrFile);
     CPPUNIT_ASSERT_MESSAGE( "cPanFile", tPanFile == config.cPanFile);
     CPPUNIT_ASSERT_MESSAGE( "cEtcFile", "" == config.cEtcFile);
+    CPPUNIT_ASSERT_MESSAGE( "cRadiationBank", config.cRadiationBank);
+    CPPUNIT_ASSERT_MESSAGE( "cCacheFile", "cache.bin" == config.cCacheFile);
 
     /// - Default construct config.
     ThermalNetworkConfigData configDefault;
@@ -152,6 +155,8 @@ void UtThermalNetwork::testConfig()
     CPPUNIT_ASSERT_MESSAGE( "cHtrFile", "" == configDefault.cHtrFile );
     CPPUNIT_ASSERT_MESSAGE( "cPanFile", "" == configDefault.cPanFile );
     CPPUNIT_ASSERT_MESSAGE( "cEtcFile", "" == configDefault.cEtcFile );
+    CPPUNIT_ASSERT_MESSAGE( "cRadiationBank", not configDefault.cRadiationBank );
+    CPPUNIT_ASSERT_MESSAGE( "cCacheFile", "" == configDefault.cCacheFile );
 
     /// - Copy construct config.
     ThermalNetworkConfigData configCopy(config);
@@ -162,6 +167,8 @@ void UtThermalNetwork::testConfig()
     CPPUNIT_ASSERT_MESSAGE( "cHtrFile", tHtrFile == config.cHtrFile);
     CPPUNIT_ASSERT_MESSAGE( "cPanFile", tPanFile == config.cPanFile);
     CPPUNIT_ASSERT_MESSAGE( "cEtcFile", "" == config.cEtcFile);
+    CPPUNIT_ASSERT_MESSAGE( "cRadiationBank", configCopy.cRadiationBank);
+    CPPUNIT_ASSERT_MESSAGE( "cCacheFile", "cache.bin" == configCopy.cCacheFile);
 
     std::cout << " Pass";
 }
@@ -1241,3 +1248,179 @@ void UtThermalNetwork::testSuperNetwork()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the batched radiation link, by comparing a network built with it to the nominal
+///           test article with individual radiation links, and tests the radiation access methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermalNetwork::testRadiationBank()
+{
+    const char* test = "ThermalNetwork 14: Test radiation bank............................";
+    std::cout << "\n " << test;
+    TEST_HS(test);
+
+    /// - Configure a network from the same files, with the radiation links batched.
+    FriendlyThermalNetwork article("article");
+    article.mConfig.cNodeFile      = tNodeFile;
+    article.mConfig.cCondFile      = tCondFile;
+    article.mConfig.cRadFile       = tRadFile;
+    article.mConfig.cHtrFile       = tHtrFile;
+    article.mConfig.cPanFile       = tPanFile;
+    article.mConfig.cEtcFile       = tEtcFile;
+    article.mConfig.cRadiationBank = true;
+    article.initialize();
+
+    /// @test  The radiation links are built into the bank as one link, in the same order.
+    const int numRad = parserFriendly.numLinksRad;
+    CPPUNIT_ASSERT(0 < numRad);
+    CPPUNIT_ASSERT(0 == article.mRadiationLinks);
+    CPPUNIT_ASSERT_EQUAL(numRad, article.mRadiationBank.getNumPaths());
+    CPPUNIT_ASSERT_EQUAL(tArticle->netSolver.getNumLinks() - numRad + 1,
+                         article.netSolver.getNumLinks());
+    for(int i = 0; i < numRad; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(tArticle->getRadiationViewScalar(i), article.getRadiationViewScalar(i));
+    }
+
+    /// @test  Both networks give the same radiation conductances, fluxes and temperatures.
+    tArticle->update(tTimeStep);
+    article.update(tTimeStep);
+    for(int i = 0; i < numRad; ++i)
+    {
+        const double expectedG = tArticle->getRadiationConductance(i);
+        const double expectedQ = tArticle->getRadiationFlux(i);
+        CPPUNIT_ASSERT(0.0 < expectedG);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedG, article.getRadiationConductance(i),
+                                     expectedG * 1.0e-12);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedQ, article.getRadiationFlux(i),
+                                     std::fabs(expectedQ) * 1.0e-6 + tTolerance);
+    }
+    for(int i = 0; i < tArticle->numLinksCap; ++i)
+    {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mCapacitanceLinks[i].getTemperature(),
+                                     article.mCapacitanceLinks[i].getTemperature(), tTolerance);
+    }
+
+    /// @test  Radiation link lookup by name.
+    CPPUNIT_ASSERT_EQUAL(0,  article.getRadiationIndex(parserFriendly.vRadNames.at(0)));
+    CPPUNIT_ASSERT_EQUAL(numRad - 1,
+                         article.getRadiationIndex(parserFriendly.vRadNames.at(numRad - 1)));
+    CPPUNIT_ASSERT_EQUAL(-1, article.getRadiationIndex("not a link"));
+
+    /// @test  Blockage malfunction in both forms, and its effect on the next update.
+    article.setRadiationMalfBlockage(0, true, 0.25);
+    tArticle->setRadiationMalfBlockage(0, true, 0.25);
+    CPPUNIT_ASSERT(article.mRadiationBank.mMalfPathBlockageFlag[0]);
+    CPPUNIT_ASSERT_EQUAL(0.25, article.mRadiationBank.mMalfPathBlockageValue[0]);
+    CPPUNIT_ASSERT(tArticle->mRadiationLinks[0].mMalfBlockageFlag);
+    CPPUNIT_ASSERT_EQUAL(0.25, tArticle->mRadiationLinks[0].mMalfBlockageValue);
+    tArticle->update(tTimeStep);
+    article.update(tTimeStep);
+    const double expectedG = tArticle->getRadiationConductance(0);
+    CPPUNIT_ASSERT(0.0 < expectedG);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedG, article.getRadiationConductance(0), expectedG * 1.0e-6);
+    article.setRadiationMalfBlockage(0);
+    tArticle->setRadiationMalfBlockage(0);
+    CPPUNIT_ASSERT(not article.mRadiationBank.mMalfPathBlockageFlag[0]);
+    CPPUNIT_ASSERT(not tArticle->mRadiationLinks[0].mMalfBlockageFlag);
+
+    /// @test  View scalar access in both forms, and its effect on the next update.
+    article.setRadiationViewScalar(0, 0.0);
+    tArticle->setRadiationViewScalar(0, 0.0);
+    CPPUNIT_ASSERT_EQUAL(0.0, article.getRadiationViewScalar(0));
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->getRadiationViewScalar(0));
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->mRadiationLinks[0].getViewScalar());
+    article.update(tTimeStep);
+    CPPUNIT_ASSERT_EQUAL(0.0, article.getRadiationConductance(0));
+    CPPUNIT_ASSERT_EQUAL(0.0, article.getRadiationFlux(0));
+
+    /// @test  Out of bounds indexes are ignored or return zero.
+    article.setRadiationMalfBlockage(numRad, true, 0.5);
+    article.setRadiationViewScalar(numRad, 0.5);
+    tArticle->setRadiationViewScalar(-1, 0.5);
+    CPPUNIT_ASSERT_EQUAL(0.0, article.getRadiationViewScalar(numRad));
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->getRadiationConductance(-1));
+    CPPUNIT_ASSERT_EQUAL(0.0, article.getRadiationFlux(-1));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that a network with the batched radiation link, restored from a snapshot and
+///           re-run with the same view scalar changes, reproduces the original run.  The view
+///           scalar changed after the save must be restored, along with the conductances that the
+///           bank's incremental update compares against.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermalNetwork::testRadiationBankSnapshot()
+{
+    const char* test = "ThermalNetwork 15: Test radiation bank snapshot...................";
+    std::cout << "\n " << test;
+    TEST_HS(test);
+
+    FriendlyThermalNetwork article("article");
+    article.mConfig.cNodeFile      = tNodeFile;
+    article.mConfig.cCondFile      = tCondFile;
+    article.mConfig.cRadFile       = tRadFile;
+    article.mConfig.cHtrFile       = tHtrFile;
+    article.mConfig.cPanFile       = tPanFile;
+    article.mConfig.cEtcFile       = tEtcFile;
+    article.mConfig.cRadiationBank = true;
+    article.initialize();
+
+    const int numRad  = article.mRadiationBank.getNumPaths();
+    const int numCap  = article.numLinksCap;
+    const int nSteps  = 4;
+    CPPUNIT_ASSERT(0 < numRad);
+    for (int step = 0; step < 3; ++step) {
+        article.update(tTimeStep);
+    }
+
+    /// - Save the network, then run it with a view scalar change part way.
+    GunnsSnapshot snapshot("snapshot");
+    const double savedScalar = article.getRadiationViewScalar(0);
+    std::vector<double> savedG(numRad);
+    for (int i = 0; i < numRad; ++i) {
+        savedG[i] = article.getRadiationConductance(i);
+    }
+    CPPUNIT_ASSERT_NO_THROW(article.saveSnapshot(snapshot));
+
+    std::vector<double> expectedT(numCap * nSteps);
+    std::vector<double> expectedG(numRad * nSteps);
+    for (int step = 0; step < nSteps; ++step) {
+        if (1 == step) {
+            article.setRadiationViewScalar(0, 0.5 * savedScalar);
+        }
+        article.update(tTimeStep);
+        for (int i = 0; i < numCap; ++i) {
+            expectedT[step * numCap + i] = article.mCapacitanceLinks[i].getTemperature();
+        }
+        for (int i = 0; i < numRad; ++i) {
+            expectedG[step * numRad + i] = article.getRadiationConductance(i);
+        }
+    }
+
+    /// @test  The view scalars and conductances of the paths are restored.
+    CPPUNIT_ASSERT_NO_THROW(article.restoreSnapshot(snapshot));
+    CPPUNIT_ASSERT_EQUAL(savedScalar, article.getRadiationViewScalar(0));
+    for (int i = 0; i < numRad; ++i) {
+        CPPUNIT_ASSERT_EQUAL(savedG[i], article.getRadiationConductance(i));
+    }
+
+    /// @test  The re-run reproduces the original run.
+    for (int step = 0; step < nSteps; ++step) {
+        if (1 == step) {
+            article.setRadiationViewScalar(0, 0.5 * savedScalar);
+        }
+        article.update(tTimeStep);
+        for (int i = 0; i < numCap; ++i) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedT[step * numCap + i],
+                                         article.mCapacitanceLinks[i].getTemperature(), 0.0);
+        }
+        for (int i = 0; i < numRad; ++i) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedG[step * numRad + i],
+                                         article.getRadiationConductance(i), 0.0);
+        }
+    }
+
+    std::cout << "... Pass";
+}
@@ -91,6 +91,10 @@ class UtThermalNetwork: public CppUnit::TestFixture
         void testCapacitanceEdit();
         /// @brief  Tests the network in a super-network.
         void testSuperNetwork();
+        /// @brief  Tests the batched radiation link and radiation access methods.
+        void testRadiationBank();
+        /// @brief  Tests snapshot and restore of the network with the batched radiation link.
+        void testRadiationBankSnapshot();
 
     private:
         CPPUNIT_TEST_SUITE(UtThermalNetwork);
@@ -107,6 +111,8 @@ class UtThermalNetwork: public CppUnit::TestFixture
         CPPUNIT_TEST(testAccess);
         CPPUNIT_TEST(testCapacitanceEdit);
         CPPUNIT_TEST(testSuperNetwork);
+        CPPUNIT_TEST(testRadiationBank);
+        CPPUNIT_TEST(testRadiationBankSnapshot);
         CPPUNIT_TEST_SUITE_END();
 
         FriendlyThermalNetwork*  tArticle; /**< (--)  pointer to test article */
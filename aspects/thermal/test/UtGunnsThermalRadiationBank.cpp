@@ -0,0 +1,513 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    (
+        (aspects/thermal/GunnsThermalRadiationBank.o)
+    )
+***************************************************************************************************/
+#include "UtGunnsThermalRadiationBank.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsThermalRadiationBank class.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThermalRadiationBank::UtGunnsThermalRadiationBank()
+    :
+    tConfigData(),
+    tInputData(),
+    tArticle(),
+    tLinkName(),
+    tNodes(),
+    tNodeList(),
+    tNetworkLinks(),
+    tNodes0(),
+    tNodes1(),
+    tCoefficients(),
+    tViewScalars(),
+    tBlockage(),
+    tTimeStep(),
+    tTolerance()
+{
+    // Nothing to do
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsThermalRadiationBank class.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThermalRadiationBank::~UtGunnsThermalRadiationBank()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBank::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tInputData;
+    delete tConfigData;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBank::setUp()
+{
+    /// - Declare the standard Gunns Link test data.  Node 3 is the vacuum (Ground) node.
+    tLinkName           = "Test Thermal Radiation Bank";
+    tNodeList.mNumNodes = 4;
+    tNodeList.mNodes    = tNodes;
+    tNodes[0].initialize("tNodes_0", 300.0);
+    tNodes[1].initialize("tNodes_1", 250.0);
+    tNodes[2].initialize("tNodes_2", 200.0);
+    tNodes[3].initialize("tNodes_3",   3.0);
+    tBlockage           = 0.2;
+
+    /// - Four paths, including one to vacuum and one in reverse of a node pair used by another.
+    const int    nodes0[]       = {0, 1, 0, 2};
+    const int    nodes1[]       = {1, 2, 3, 0};
+    const double coefficients[] = {1.0e-8, 2.0e-8, 3.0e-8, 4.0e-8};
+    const double viewScalars[]  = {1.0, 0.5, 0.25, 0.75};
+    tNodes0.assign(nodes0, nodes0 + 4);
+    tNodes1.assign(nodes1, nodes1 + 4);
+    tCoefficients.assign(coefficients, coefficients + 4);
+    tViewScalars.assign(viewScalars, viewScalars + 4);
+
+    /// - Define nominal configuration data
+    tConfigData = new GunnsThermalRadiationBankConfigData(tLinkName, &tNodeList, &tCoefficients);
+
+    /// - Define nominal input data
+    tInputData = new GunnsThermalRadiationBankInputData(false, tBlockage, &tViewScalars);
+
+    /// - Initialize the test Article
+    tArticle.initialize(*tConfigData, *tInputData, tNetworkLinks, &tNodes0, &tNodes1);
+
+    /// - Declare the nominal test data
+    tTolerance = 1.0e-08;
+    tTimeStep  = 0.1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for construction of config data.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBank::testConfig()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsThermalRadiationBank 01: testConfig ......................";
+
+    /// - Check nominal config construction
+    CPPUNIT_ASSERT(tLinkName     == tConfigData->mName);
+    CPPUNIT_ASSERT(tNodes        == tConfigData->mNodeList->mNodes);
+    CPPUNIT_ASSERT(tCoefficients == tConfigData->cCoefficients);
+
+    /// - Check default config construction
+    GunnsThermalRadiationBankConfigData defaultConfig;
+    CPPUNIT_ASSERT("unnamed radiation bank" == defaultConfig.mName);
+    CPPUNIT_ASSERT(0                        == defaultConfig.mNodeList);
+    CPPUNIT_ASSERT(defaultConfig.cCoefficients.empty());
+
+    /// - Check copy config construction
+    GunnsThermalRadiationBankConfigData copyConfig(*tConfigData);
+    CPPUNIT_ASSERT(tLinkName     == copyConfig.mName);
+    CPPUNIT_ASSERT(tNodes        == copyConfig.mNodeList->mNodes);
+    CPPUNIT_ASSERT(tCoefficients == copyConfig.cCoefficients);
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for construction of input data.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBank::testInput()
+{
+    std::cout << "\n UtGunnsThermalRadiationBank 02: testInput .......................";
+
+    /// - Check nominal input construction
+    CPPUNIT_ASSERT(tViewScalars == tInputData->iViewScalars);
+    CPPUNIT_ASSERT(!tInputData->mMalfBlockageFlag);
+    CPPUNIT_ASSERT(tBlockage    == tInputData->mMalfBlockageValue);
+
+    /// - Check default input construction
+    GunnsThermalRadiationBankInputData defaultInput;
+    CPPUNIT_ASSERT(defaultInput.iViewScalars.empty());
+    CPPUNIT_ASSERT(!defaultInput.mMalfBlockageFlag);
+    CPPUNIT_ASSERT(0.0 == defaultInput.mMalfBlockageValue);
+
+    /// - Check copy input construction
+    GunnsThermalRadiationBankInputData copyInput(*tInputData);
+    CPPUNIT_ASSERT(tViewScalars == copyInput.iViewScalars);
+    CPPUNIT_ASSERT(tBlockage    == copyInput.mMalfBlockageValue);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBank::testDefaultConstruction()
+{
+    std::cout << "\n UtGunnsThermalRadiationBank 03: testDefaultConstruction .........";
+
+    /// - Construct an uninitialized test article
+    FriendlyGunnsThermalRadiationBank article;
+
+    /// @test Default values on construction
+    CPPUNIT_ASSERT(0 == article.mNumPaths);
+    CPPUNIT_ASSERT(0 == article.mPathPort0);
+    CPPUNIT_ASSERT(0 == article.mPathPort1);
+    CPPUNIT_ASSERT(0 == article.mCoefficients);
+    CPPUNIT_ASSERT(0 == article.mViewScalars);
+    CPPUNIT_ASSERT(0 == article.mConductances);
+    CPPUNIT_ASSERT(0 == article.mPathFluxes);
+    CPPUNIT_ASSERT(0 == article.mMalfPathBlockageFlag);
+    CPPUNIT_ASSERT(0 == article.mMalfPathBlockageValue);
+    CPPUNIT_ASSERT(!article.mDeferMapUpdate);
+    CPPUNIT_ASSERT(!article.mInitFlag);
+
+    /// @test Dynamic new/delete for code coverage of destructor.
+    GunnsThermalRadiationBank* article2 = new GunnsThermalRadiationBank;
+    delete article2;
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for initialization without exceptions.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBank::testInitialization()
+{
+    std::cout << "\n UtGunnsThermalRadiationBank 04: testInitialization ..............";
+
+    /// @test init flag and one port per unique node.
+    CPPUNIT_ASSERT(tArticle.mInitFlag);
+    CPPUNIT_ASSERT(4 == tArticle.mNumPaths);
+    CPPUNIT_ASSERT(4 == tArticle.getNumPaths());
+    CPPUNIT_ASSERT(4 == tArticle.mNumPorts);
+    CPPUNIT_ASSERT(0 == tArticle.mNodeMap[0]);
+    CPPUNIT_ASSERT(1 == tArticle.mNodeMap[1]);
+    CPPUNIT_ASSERT(2 == tArticle.mNodeMap[2]);
+    CPPUNIT_ASSERT(3 == tArticle.mNodeMap[3]);
+
+    /// @test path arrays.
+    const int ports0[] = {0, 1, 0, 2};
+    const int ports1[] = {1, 2, 3, 0};
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(ports0[i]         == tArticle.mPathPort0[i]);
+        CPPUNIT_ASSERT(ports1[i]         == tArticle.mPathPort1[i]);
+        CPPUNIT_ASSERT(tCoefficients[i]  == tArticle.mCoefficients[i]);
+        CPPUNIT_ASSERT(tViewScalars[i]   == tArticle.mViewScalars[i]);
+        CPPUNIT_ASSERT(0.0               == tArticle.mConductances[i]);
+        CPPUNIT_ASSERT(0.0               == tArticle.mPathFluxes[i]);
+        CPPUNIT_ASSERT(!tArticle.mMalfPathBlockageFlag[i]);
+        CPPUNIT_ASSERT(0.0               == tArticle.mMalfPathBlockageValue[i]);
+    }
+
+    /// @test compressed admittance map of the port diagonals then the path off-diagonals, with
+    ///       Ground terms mapped to -1.
+    CPPUNIT_ASSERT(12 == static_cast<int>(tArticle.mAdmittanceMap.mSize));
+    const int map[] = { 0,  4,  8, -1,
+                        1,  3,
+                        5,  7,
+                       -1, -1,
+                        6,  2};
+    for (int i = 0; i < 12; ++i) {
+        CPPUNIT_ASSERT(map[i] == tArticle.mAdmittanceMap.mMap[i]);
+    }
+
+    /// @test input data
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tBlockage, tArticle.mMalfBlockageValue, 0.0);
+
+    /// @test view scalars default to 1 when none are given.
+    FriendlyGunnsThermalRadiationBank article;
+    GunnsThermalRadiationBankInputData defaultInput;
+    article.initialize(*tConfigData, defaultInput, tNetworkLinks, &tNodes0, &tNodes1);
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(1.0 == article.mViewScalars[i]);
+    }
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for initialization with exceptions.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBank::testInitializationExceptions()
+{
+    std::cout << "\n UtGunnsThermalRadiationBank 05: testInitializationExceptions ....";
+
+    FriendlyGunnsThermalRadiationBank article;
+
+    /// @test exception on null node vectors.
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, 0, &tNodes1),
+                         TsInitializationException);
+
+    /// @test exception on empty node vectors.
+    std::vector<int> empty;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &empty, &empty),
+                         TsInitializationException);
+
+    /// @test exception on mismatched node vector size.
+    std::vector<int> badNodes(tNodes1);
+    badNodes.push_back(1);
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tNodes0, &badNodes),
+                         TsInitializationException);
+
+    /// @test exception on mismatched view scalar vector size.
+    tInputData->iViewScalars.push_back(1.0);
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tNodes0, &tNodes1),
+                         TsInitializationException);
+    tInputData->iViewScalars.pop_back();
+
+    /// @test exception on path node out of range.
+    badNodes = tNodes1;
+    badNodes[1] = 4;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tNodes0, &badNodes),
+                         TsInitializationException);
+
+    /// @test exception on path connecting a non-boundary node to itself.
+    badNodes[1] = 1;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tNodes0, &badNodes),
+                         TsInitializationException);
+
+    /// @test exception on negative coefficient.
+    tConfigData->cCoefficients[2] = -1.0;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tNodes0, &tNodes1),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(!article.mInitFlag);
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests restart method.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBank::testRestart()
+{
+    std::cout << "\n UtGunnsThermalRadiationBank 06: testRestart .....................";
+
+    tArticle.mConductances[1]     = 1.0;
+    tArticle.mPathFluxes[1]       = 1.0;
+    tArticle.mAdmittanceMatrix[1] = 1.0;
+    tArticle.mAdmittanceMatrix[6] = -1.0;
+
+    tArticle.restart();
+
+    CPPUNIT_ASSERT(0.0 == tArticle.mConductances[1]);
+    CPPUNIT_ASSERT(0.0 == tArticle.mPathFluxes[1]);
+    CPPUNIT_ASSERT(0.0 == tArticle.mAdmittanceMatrix[1]);
+    CPPUNIT_ASSERT(0.0 == tArticle.mAdmittanceMatrix[6]);
+    CPPUNIT_ASSERT(6   == tArticle.mAdmittanceMap.mMap[10]);
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests getter and setter methods.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBank::testAccessors()
+{
+    std::cout << "\n UtGunnsThermalRadiationBank 07: testAccessors ...................";
+
+    /// @test view scalar setter and getter.
+    tArticle.setViewScalar(2, 0.5);
+    CPPUNIT_ASSERT(0.5 == tArticle.getViewScalar(2));
+
+    /// @test conductance and flux getters.
+    tArticle.mConductances[3] = 5.0;
+    tArticle.mPathFluxes[3]   = 6.0;
+    CPPUNIT_ASSERT(5.0 == tArticle.getConductance(3));
+    CPPUNIT_ASSERT(6.0 == tArticle.getPathFlux(3));
+
+    /// @test out of bounds path indexes are ignored or return zero.
+    tArticle.setViewScalar(4, 0.1);
+    tArticle.setViewScalar(-1, 0.1);
+    CPPUNIT_ASSERT(0.0 == tArticle.getViewScalar(4));
+    CPPUNIT_ASSERT(0.0 == tArticle.getConductance(-1));
+    CPPUNIT_ASSERT(0.0 == tArticle.getPathFlux(4));
+
+    /// @test path blockage malfunction setter, reset and out of bounds indexes.
+    tArticle.setMalfPathBlockage(1, true, 0.25);
+    CPPUNIT_ASSERT(tArticle.mMalfPathBlockageFlag[1]);
+    CPPUNIT_ASSERT(0.25 == tArticle.mMalfPathBlockageValue[1]);
+    tArticle.setMalfPathBlockage(1);
+    CPPUNIT_ASSERT(!tArticle.mMalfPathBlockageFlag[1]);
+    CPPUNIT_ASSERT(0.0 == tArticle.mMalfPathBlockageValue[1]);
+    tArticle.setMalfPathBlockage(4, true, 0.25);
+    tArticle.setMalfPathBlockage(-1, true, 0.25);
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(!tArticle.mMalfPathBlockageFlag[i]);
+    }
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the step method.  The path conductances are compared to the linearization used
+///           by the individual GunnsThermalRadiation link.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBank::testStep()
+{
+    std::cout << "\n UtGunnsThermalRadiationBank 08: testStep ........................";
+
+    const double temperatures[] = {300.0, 250.0, 200.0, 3.0};
+    for (int i = 0; i < 4; ++i) {
+        tArticle.mPotentialVector[i] = temperatures[i];
+    }
+
+    /// - Step with the blockage malfunction active.
+    tArticle.mMalfBlockageFlag = true;
+    tArticle.mAdmittanceUpdate = false;
+    tArticle.step(tTimeStep);
+
+    /// @test each path's conductance and admittance matrix terms.
+    for (int i = 0; i < 4; ++i) {
+        const double t0 = temperatures[tNodes0[i]];
+        const double t1 = temperatures[tNodes1[i]];
+        const double expected = (1.0 - tBlockage) * tViewScalars[i] * tCoefficients[i]
+                              * (t0*t0*t0*t0 - t1*t1*t1*t1) / (t0 - t1);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected,  tArticle.mConductances[i],         expected * 1.0e-14);
+        CPPUNIT_ASSERT(tArticle.mConductances[i] == -tArticle.mAdmittanceMatrix[4 + 2*i]);
+        CPPUNIT_ASSERT(tArticle.mConductances[i] == -tArticle.mAdmittanceMatrix[5 + 2*i]);
+    }
+
+    /// @test each port's diagonal term is the sum of its paths' conductances.
+    const double* g = tArticle.mConductances;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(g[0] + g[2] + g[3], tArticle.mAdmittanceMatrix[0], tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(g[0] + g[1],        tArticle.mAdmittanceMatrix[1], tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(g[1] + g[3],        tArticle.mAdmittanceMatrix[2], tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(g[2],               tArticle.mAdmittanceMatrix[3], tTolerance);
+    CPPUNIT_ASSERT(tArticle.needAdmittanceUpdate());
+
+    /// @test no admittance update when nothing changed.
+    tArticle.mAdmittanceUpdate = false;
+    tArticle.step(tTimeStep);
+    CPPUNIT_ASSERT(!tArticle.needAdmittanceUpdate());
+
+    /// @test equal temperatures use the tangent 4 T^3 instead of a special case.
+    tArticle.mMalfBlockageFlag   = false;
+    tArticle.mPotentialVector[1] = 300.0;
+    tArticle.step(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(4.0 * tCoefficients[0] * 300.0 * 300.0 * 300.0,
+                                 tArticle.mConductances[0], tTolerance);
+    CPPUNIT_ASSERT(tArticle.needAdmittanceUpdate());
+
+    /// @test view scalar changes take effect on the next step.
+    tArticle.setViewScalar(0, 0.0);
+    tArticle.step(tTimeStep);
+    CPPUNIT_ASSERT(0.0 == tArticle.mConductances[0]);
+    CPPUNIT_ASSERT(0.0 == tArticle.mAdmittanceMatrix[4]);
+
+    /// @test a path blockage malfunction only affects its path, and combines with the bank's.
+    const double g1 = tArticle.mConductances[1];
+    const double g2 = tArticle.mConductances[2];
+    tArticle.setMalfPathBlockage(1, true, 0.25);
+    tArticle.step(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.75 * g1, tArticle.mConductances[1], g1 * 1.0e-14);
+    CPPUNIT_ASSERT(g2 == tArticle.mConductances[2]);
+    tArticle.mMalfBlockageFlag = true;
+    tArticle.step(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.75 * (1.0 - tBlockage) * g1, tArticle.mConductances[1],
+                                 g1 * 1.0e-14);
+    tArticle.mMalfBlockageFlag = false;
+    tArticle.setMalfPathBlockage(1);
+
+    /// @test conductance is limited to the conductance limit.
+    tArticle.mPotentialVector[0] = 1.0e8;
+    tArticle.step(tTimeStep);
+    CPPUNIT_ASSERT(tArticle.mConductanceLimit == tArticle.mConductances[2]);
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the computeFlows method.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBank::testComputeFlows()
+{
+    std::cout << "\n UtGunnsThermalRadiationBank 09: testComputeFlows ................";
+
+    const double temperatures[] = {300.0, 250.0, 200.0, 3.0};
+    for (int i = 0; i < 4; ++i) {
+        tArticle.mPotentialVector[i] = temperatures[i];
+    }
+    tArticle.step(tTimeStep);
+    tArticle.computeFlows(tTimeStep);
+
+    /// @test each path's flux and the total power.
+    double power = 0.0;
+    for (int i = 0; i < 4; ++i) {
+        const double drop = temperatures[tNodes0[i]] - temperatures[tNodes1[i]];
+        const double flux = drop * tArticle.mConductances[i];
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(flux, tArticle.mPathFluxes[i], tTolerance);
+        power -= flux * drop;
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(power, tArticle.mPower, tTolerance);
+
+    /// @test the fluxes are transported to the nodes: node 0 is hottest so only has outflux, and
+    ///       path 3 flows in reverse from node 0 to node 2.
+    const double* f = tArticle.mPathFluxes;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(f[0] + f[2] - f[3], tNodes[0].getOutflux(),  tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,                tNodes[0].getInflux(),   tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(f[0],               tNodes[1].getInflux(),   tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(f[1],               tNodes[1].getOutflux(),  tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(f[1] - f[3],        tNodes[2].getInflux(),   tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(f[2],               tNodes[3].getInflux(),   tTolerance);
+
+    /// @test zero flux for a negligible temperature difference.
+    tArticle.mPotentialVector[1] = 300.0;
+    tArticle.computeFlows(tTimeStep);
+    CPPUNIT_ASSERT(0.0 == tArticle.mPathFluxes[0]);
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the incremental update of the compressed admittance matrix when only a few
+///           paths' conductances change.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBank::testIncrementalUpdate()
+{
+    std::cout << "\n UtGunnsThermalRadiationBank 10: testIncrementalUpdate ...........";
+
+    const double temperatures[] = {300.0, 250.0, 200.0, 3.0};
+    for (int i = 0; i < 4; ++i) {
+        tArticle.mPotentialVector[i] = temperatures[i];
+    }
+    tArticle.step(tTimeStep);
+    const double g3 = tArticle.mConductances[3];
+
+    /// - Mark the diagonal terms with an offset, which is only kept by an incremental update.
+    const double offset = 1.0e-3;
+    for (int port = 0; port < 4; ++port) {
+        tArticle.mAdmittanceMatrix[port] += offset;
+    }
+
+    /// @test changing one path's view scalar only updates that path's terms.
+    tArticle.mAdmittanceUpdate = false;
+    tArticle.setViewScalar(3, 0.5 * tViewScalars[3]);
+    tArticle.step(tTimeStep);
+    const double* g = tArticle.mConductances;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5 * g3, g[3], g3 * 1.0e-14);
+    CPPUNIT_ASSERT(g[3] == -tArticle.mAdmittanceMatrix[10]);
+    CPPUNIT_ASSERT(g[3] == -tArticle.mAdmittanceMatrix[11]);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(g[0] + g[2] + g[3] + offset, tArticle.mAdmittanceMatrix[0], tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(g[0] + g[1]        + offset, tArticle.mAdmittanceMatrix[1], tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(g[1] + g[3]        + offset, tArticle.mAdmittanceMatrix[2], tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(g[2]               + offset, tArticle.mAdmittanceMatrix[3], tTolerance);
+    CPPUNIT_ASSERT(tArticle.needAdmittanceUpdate());
+
+    /// @test changing more than a quarter of the paths re-stamps the whole block.
+    tArticle.setViewScalar(0, 0.5);
+    tArticle.setViewScalar(1, 0.25);
+    tArticle.step(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(g[0] + g[2] + g[3], tArticle.mAdmittanceMatrix[0], tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(g[0] + g[1],        tArticle.mAdmittanceMatrix[1], tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(g[1] + g[3],        tArticle.mAdmittanceMatrix[2], tTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(g[2],               tArticle.mAdmittanceMatrix[3], tTolerance);
+
+    std::cout << "... Pass";
+}
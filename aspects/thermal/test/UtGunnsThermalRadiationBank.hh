@@ -0,0 +1,126 @@
+#ifndef UtGunnsThermalRadiationBank_EXISTS
+#define UtGunnsThermalRadiationBank_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup    UT_GUNNS_THERMAL_RADIATION_BANK  Gunns Thermal Radiation Bank Unit test
+/// @ingroup     UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details     Unit Tests for Gunns Thermal Radiation Bank
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "aspects/thermal/GunnsThermalRadiationBank.hh"
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsThermalRadiationBank and befriend UtGunnsThermalRadiationBank.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsThermalRadiationBank : public GunnsThermalRadiationBank
+{
+    public:
+        FriendlyGunnsThermalRadiationBank();
+        virtual ~FriendlyGunnsThermalRadiationBank();
+        friend class UtGunnsThermalRadiationBank;
+};
+inline FriendlyGunnsThermalRadiationBank::FriendlyGunnsThermalRadiationBank() : GunnsThermalRadiationBank() {};
+inline FriendlyGunnsThermalRadiationBank::~FriendlyGunnsThermalRadiationBank() {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Thermal Radiation Bank unit tests.
+///
+/// @details  This class provides unit tests for the Thermal Radiation Bank within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsThermalRadiationBank: public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default Constructor.
+        UtGunnsThermalRadiationBank();
+
+        /// @brief    Default Destructor.
+        virtual ~UtGunnsThermalRadiationBank();
+
+        /// @brief    Executes before each test.
+        void setUp();
+
+        /// @brief    Executes after each test.
+        void tearDown();
+
+        /// @brief    Tests ConfigData construction
+        void testConfig();
+
+        /// @brief    Tests InputData construction
+        void testInput();
+
+        /// @brief    Tests Default Construction.
+        void testDefaultConstruction();
+
+        /// @brief    Tests initialize method without exceptions
+        void testInitialization();
+
+        /// @brief    Tests initialize method with exceptions
+        void testInitializationExceptions();
+
+        /// @brief    Tests restart method.
+        void testRestart();
+
+        /// @brief    Tests getter and setter methods.
+        void testAccessors();
+
+        /// @brief    Tests the step method against individual radiation links.
+        void testStep();
+
+        /// @brief    Tests the computeFlows method.
+        void testComputeFlows();
+
+        /// @brief    Tests the incremental update of the admittance matrix.
+        void testIncrementalUpdate();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsThermalRadiationBank);
+        CPPUNIT_TEST(testConfig);
+        CPPUNIT_TEST(testInput);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialization);
+        CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testRestart);
+        CPPUNIT_TEST(testAccessors);
+        CPPUNIT_TEST(testStep);
+        CPPUNIT_TEST(testComputeFlows);
+        CPPUNIT_TEST(testIncrementalUpdate);
+        CPPUNIT_TEST_SUITE_END();
+
+        GunnsThermalRadiationBankConfigData* tConfigData;  /**< (--)   Pointer to nominal configuration data */
+        GunnsThermalRadiationBankInputData*  tInputData;   /**< (--)   Pointer to nominal input data */
+        FriendlyGunnsThermalRadiationBank    tArticle;     /**< (--)   Test Article */
+        std::string    tLinkName;                          /**< (--)   Link Name */
+        GunnsBasicNode tNodes[4];                          /**< (--)   Network Nodes */
+        GunnsNodeList  tNodeList;                          /**< (--)   Node List */
+        std::vector<GunnsBasicLink*> tNetworkLinks;        /**< (--)   Network Links */
+        std::vector<int>    tNodes0;                       /**< (--)   Node at port 0 of each path */
+        std::vector<int>    tNodes1;                       /**< (--)   Node at port 1 of each path */
+        std::vector<double> tCoefficients;                 /**< (W/K4) Radiation coefficient of each path */
+        std::vector<double> tViewScalars;                  /**< (--)   View scalar of each path */
+        double  tBlockage;                                 /**< (--)   Link Blockage */
+        double  tTimeStep;                                 /**< (s)    Nominal time step */
+        double  tTolerance;                                /**< (--)   Nominal tolerance for comparison
+                                                                       of expected and returned values */
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsThermalRadiationBank(const UtGunnsThermalRadiationBank& that);
+
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsThermalRadiationBank& operator =(const UtGunnsThermalRadiationBank& that);
+};
+
+///@}
+
+#endif
@@ -0,0 +1,409 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    (
+        (aspects/thermal/GunnsThermalRadiationEnclosure.o)
+    )
+***************************************************************************************************/
+#include "UtGunnsThermalRadiationEnclosure.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsThermalRadiationEnclosure class.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThermalRadiationEnclosure::UtGunnsThermalRadiationEnclosure()
+    :
+    tConfigData(),
+    tInputData(),
+    tArticle(),
+    tLinkName(),
+    tNodes(),
+    tNodeList(),
+    tNetworkLinks(),
+    tSurfaceNodes(),
+    tRowStart(),
+    tColumns(),
+    tCoefficients(),
+    tViewScalars(),
+    tBlockage(),
+    tTimeStep(),
+    tTolerance()
+{
+    // Nothing to do
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsThermalRadiationEnclosure class.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThermalRadiationEnclosure::~UtGunnsThermalRadiationEnclosure()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationEnclosure::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tInputData;
+    delete tConfigData;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationEnclosure::setUp()
+{
+    /// - Declare the standard Gunns Link test data.  Node 4 is the vacuum (Ground) node, and node 3
+    ///   isn't in the enclosure.
+    tLinkName           = "Test Thermal Radiation Enclosure";
+    tNodeList.mNumNodes = 5;
+    tNodeList.mNodes    = tNodes;
+    tNodes[0].initialize("tNodes_0", 300.0);
+    tNodes[1].initialize("tNodes_1", 250.0);
+    tNodes[2].initialize("tNodes_2", 280.0);
+    tNodes[3].initialize("tNodes_3", 200.0);
+    tNodes[4].initialize("tNodes_4",   3.0);
+    tBlockage           = 0.2;
+
+    /// - Four surfaces, with the upper triangle of the coefficient matrix:
+    ///       | -  1e-8  0     2e-8 |
+    ///       |    -     3e-8  0    |
+    ///       |          -     4e-8 |
+    ///       |                -    |
+    const int    surfaceNodes[] = {2, 0, 1, 4};
+    const int    rowStart[]     = {0, 2, 3, 4, 4};
+    const int    columns[]      = {1, 3, 2, 3};
+    const double coefficients[] = {1.0e-8, 2.0e-8, 3.0e-8, 4.0e-8};
+    const double viewScalars[]  = {1.0, 0.5, 0.25, 0.75};
+    tSurfaceNodes.assign(surfaceNodes, surfaceNodes + 4);
+    tRowStart.assign(rowStart, rowStart + 5);
+    tColumns.assign(columns, columns + 4);
+    tCoefficients.assign(coefficients, coefficients + 4);
+    tViewScalars.assign(viewScalars, viewScalars + 4);
+
+    /// - Define nominal configuration data
+    tConfigData = new GunnsThermalRadiationEnclosureConfigData(tLinkName, &tNodeList, &tRowStart,
+                                                               &tColumns, &tCoefficients);
+
+    /// - Define nominal input data
+    tInputData = new GunnsThermalRadiationEnclosureInputData(false, tBlockage, &tViewScalars);
+
+    /// - Initialize the test Article
+    tArticle.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes);
+
+    /// - Declare the nominal test data
+    tTolerance = 1.0e-08;
+    tTimeStep  = 0.1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for construction of config data.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationEnclosure::testConfig()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsThermalRadiationEnclosure 01: testConfig .....................";
+
+    /// - Check nominal config construction
+    CPPUNIT_ASSERT(tLinkName     == tConfigData->mName);
+    CPPUNIT_ASSERT(tNodes        == tConfigData->mNodeList->mNodes);
+    CPPUNIT_ASSERT(tRowStart     == tConfigData->cRowStart);
+    CPPUNIT_ASSERT(tColumns      == tConfigData->cColumns);
+    CPPUNIT_ASSERT(tCoefficients == tConfigData->cCoefficients);
+
+    /// - Check default config construction
+    GunnsThermalRadiationEnclosureConfigData defaultConfig;
+    CPPUNIT_ASSERT("unnamed radiation enclosure" == defaultConfig.mName);
+    CPPUNIT_ASSERT(0                             == defaultConfig.mNodeList);
+    CPPUNIT_ASSERT(defaultConfig.cRowStart.empty());
+    CPPUNIT_ASSERT(defaultConfig.cColumns.empty());
+    CPPUNIT_ASSERT(defaultConfig.cCoefficients.empty());
+
+    /// - Check copy config construction
+    GunnsThermalRadiationEnclosureConfigData copyConfig(*tConfigData);
+    CPPUNIT_ASSERT(tLinkName     == copyConfig.mName);
+    CPPUNIT_ASSERT(tNodes        == copyConfig.mNodeList->mNodes);
+    CPPUNIT_ASSERT(tRowStart     == copyConfig.cRowStart);
+    CPPUNIT_ASSERT(tColumns      == copyConfig.cColumns);
+    CPPUNIT_ASSERT(tCoefficients == copyConfig.cCoefficients);
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for construction of input data.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationEnclosure::testInput()
+{
+    std::cout << "\n UtGunnsThermalRadiationEnclosure 02: testInput ......................";
+
+    /// - Check nominal input construction
+    CPPUNIT_ASSERT(tViewScalars == tInputData->iViewScalars);
+    CPPUNIT_ASSERT(!tInputData->mMalfBlockageFlag);
+    CPPUNIT_ASSERT(tBlockage    == tInputData->mMalfBlockageValue);
+
+    /// - Check default input construction
+    GunnsThermalRadiationEnclosureInputData defaultInput;
+    CPPUNIT_ASSERT(defaultInput.iViewScalars.empty());
+    CPPUNIT_ASSERT(!defaultInput.mMalfBlockageFlag);
+    CPPUNIT_ASSERT(0.0 == defaultInput.mMalfBlockageValue);
+
+    /// - Check copy input construction
+    GunnsThermalRadiationEnclosureInputData copyInput(*tInputData);
+    CPPUNIT_ASSERT(tViewScalars == copyInput.iViewScalars);
+    CPPUNIT_ASSERT(tBlockage    == copyInput.mMalfBlockageValue);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationEnclosure::testDefaultConstruction()
+{
+    std::cout << "\n UtGunnsThermalRadiationEnclosure 03: testDefaultConstruction ........";
+
+    /// - Construct an uninitialized test article
+    FriendlyGunnsThermalRadiationEnclosure article;
+
+    /// @test Default values on construction
+    CPPUNIT_ASSERT(0 == article.mNumSurfaces);
+    CPPUNIT_ASSERT(0 == article.mRowStart);
+    CPPUNIT_ASSERT(0 == article.mColumns);
+    CPPUNIT_ASSERT(0 == article.mNumPaths);
+    CPPUNIT_ASSERT(!article.mInitFlag);
+
+    /// @test Dynamic new/delete for code coverage of destructor.
+    GunnsThermalRadiationEnclosure* article2 = new GunnsThermalRadiationEnclosure;
+    delete article2;
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for initialization without exceptions.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationEnclosure::testInitialization()
+{
+    std::cout << "\n UtGunnsThermalRadiationEnclosure 04: testInitialization .............";
+
+    /// @test init flag and the sparse matrix structure.
+    CPPUNIT_ASSERT(tArticle.mInitFlag);
+    CPPUNIT_ASSERT(4 == tArticle.mNumSurfaces);
+    CPPUNIT_ASSERT(4 == tArticle.getNumSurfaces());
+    for (int i = 0; i < 5; ++i) {
+        CPPUNIT_ASSERT(tRowStart[i] == tArticle.mRowStart[i]);
+    }
+
+    /// @test one path per coefficient, between the nodes of its row and column surfaces.
+    CPPUNIT_ASSERT(4 == tArticle.getNumPaths());
+    CPPUNIT_ASSERT(4 == tArticle.mNumPorts);
+    const int rows[] = {0, 0, 1, 2};
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(tColumns[i]                 == tArticle.mColumns[i]);
+        CPPUNIT_ASSERT(tSurfaceNodes[rows[i]]      == tArticle.mNodeMap[tArticle.mPathPort0[i]]);
+        CPPUNIT_ASSERT(tSurfaceNodes[tColumns[i]]  == tArticle.mNodeMap[tArticle.mPathPort1[i]]);
+        CPPUNIT_ASSERT(tCoefficients[i]            == tArticle.mCoefficients[i]);
+        CPPUNIT_ASSERT(tViewScalars[i]             == tArticle.mViewScalars[i]);
+    }
+
+    /// @test the compressed admittance matrix is sized for the block.
+    CPPUNIT_ASSERT(12 == static_cast<int>(tArticle.mAdmittanceMap.mSize));
+
+    /// @test re-initialization.
+    tArticle.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes);
+    CPPUNIT_ASSERT(tArticle.mInitFlag);
+    CPPUNIT_ASSERT(4 == tArticle.getNumSurfaces());
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for initialization with exceptions.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationEnclosure::testInitializationExceptions()
+{
+    std::cout << "\n UtGunnsThermalRadiationEnclosure 05: testInitializationExceptions ...";
+
+    FriendlyGunnsThermalRadiationEnclosure article;
+
+    /// @test exception on null surface node vector.
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, 0),
+                         TsInitializationException);
+
+    /// @test exception on fewer than 2 surfaces.
+    std::vector<int> badNodes(1, 0);
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &badNodes),
+                         TsInitializationException);
+
+    /// @test exception on row start vector size.
+    tConfigData->cRowStart.push_back(4);
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes),
+                         TsInitializationException);
+    tConfigData->cRowStart.pop_back();
+
+    /// @test exception on column vector size.
+    tConfigData->cColumns.push_back(3);
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes),
+                         TsInitializationException);
+    tConfigData->cColumns.pop_back();
+
+    /// @test exception on row start vector not spanning the coefficients.
+    tConfigData->cRowStart[0] = 1;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes),
+                         TsInitializationException);
+    tConfigData->cRowStart[0] = 0;
+    tConfigData->cRowStart[4] = 3;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes),
+                         TsInitializationException);
+    tConfigData->cRowStart[4] = 4;
+
+    /// @test exception on decreasing row start vector.
+    tConfigData->cRowStart[2] = 1;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes),
+                         TsInitializationException);
+    tConfigData->cRowStart[2] = 3;
+
+    /// @test exception on column in the lower triangle or diagonal.
+    tConfigData->cColumns[2] = 1;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes),
+                         TsInitializationException);
+    tConfigData->cColumns[2] = 0;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes),
+                         TsInitializationException);
+    tConfigData->cColumns[2] = 2;
+
+    /// @test exception on columns not ascending, or duplicated.
+    tConfigData->cColumns[0] = 3;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes),
+                         TsInitializationException);
+    tConfigData->cColumns[1] = 1;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes),
+                         TsInitializationException);
+    tConfigData->cColumns[0] = 1;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes),
+                         TsInitializationException);
+    tConfigData->cColumns[1] = 3;
+
+    /// @test exception on column out of range.
+    tConfigData->cColumns[3] = 4;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes),
+                         TsInitializationException);
+    tConfigData->cColumns[3] = 3;
+
+    /// @test exception on surfaces sharing a node.
+    badNodes = tSurfaceNodes;
+    badNodes[3] = 2;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &badNodes),
+                         TsInitializationException);
+
+    /// @test exception from the base class on a surface node out of range.
+    badNodes[3] = 5;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &badNodes),
+                         TsInitializationException);
+
+    /// @test exception from the base class on negative coefficient.
+    tConfigData->cCoefficients[2] = -1.0;
+    CPPUNIT_ASSERT_THROW(article.initialize(*tConfigData, *tInputData, tNetworkLinks, &tSurfaceNodes),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(!article.mInitFlag);
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the surface pair accessor and view scalar setter.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationEnclosure::testAccessors()
+{
+    std::cout << "\n UtGunnsThermalRadiationEnclosure 06: testAccessors ..................";
+
+    /// @test path index of surface pairs, in either order.
+    CPPUNIT_ASSERT( 0 == tArticle.getPathIndex(0, 1));
+    CPPUNIT_ASSERT( 0 == tArticle.getPathIndex(1, 0));
+    CPPUNIT_ASSERT( 1 == tArticle.getPathIndex(3, 0));
+    CPPUNIT_ASSERT( 2 == tArticle.getPathIndex(1, 2));
+    CPPUNIT_ASSERT( 3 == tArticle.getPathIndex(2, 3));
+
+    /// @test no path for zero coefficients, the diagonal, or surfaces out of range.
+    CPPUNIT_ASSERT(-1 == tArticle.getPathIndex(0, 2));
+    CPPUNIT_ASSERT(-1 == tArticle.getPathIndex(3, 1));
+    CPPUNIT_ASSERT(-1 == tArticle.getPathIndex(1, 1));
+    CPPUNIT_ASSERT(-1 == tArticle.getPathIndex(-1, 1));
+    CPPUNIT_ASSERT(-1 == tArticle.getPathIndex(1, 4));
+
+    /// @test setting the view scalar of all paths to a surface, in its row and column.
+    tArticle.setSurfaceViewScalar(3, 0.1);
+    CPPUNIT_ASSERT(tViewScalars[0] == tArticle.getViewScalar(0));
+    CPPUNIT_ASSERT(0.1             == tArticle.getViewScalar(1));
+    CPPUNIT_ASSERT(tViewScalars[2] == tArticle.getViewScalar(2));
+    CPPUNIT_ASSERT(0.1             == tArticle.getViewScalar(3));
+    tArticle.setSurfaceViewScalar(1, 0.2);
+    CPPUNIT_ASSERT(0.2             == tArticle.getViewScalar(0));
+    CPPUNIT_ASSERT(0.1             == tArticle.getViewScalar(1));
+    CPPUNIT_ASSERT(0.2             == tArticle.getViewScalar(2));
+    CPPUNIT_ASSERT(0.1             == tArticle.getViewScalar(3));
+
+    /// @test out of bounds surface indexes are ignored.
+    tArticle.setSurfaceViewScalar(4, 0.3);
+    tArticle.setSurfaceViewScalar(-1, 0.3);
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(0.3 != tArticle.getViewScalar(i));
+    }
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the step and computeFlows methods.  The net heat flux into each surface's node
+///           is compared to the radiation exchange with all other surfaces of the full enclosure.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationEnclosure::testStep()
+{
+    std::cout << "\n UtGunnsThermalRadiationEnclosure 07: testStep .......................";
+
+    /// - Full symmetric coefficient matrix of the enclosure, including view scalars.
+    const double c[4][4] = {{0.0,           1.0e-8 * 1.0,  0.0,            2.0e-8 * 0.5 },
+                            {1.0e-8 * 1.0,  0.0,           3.0e-8 * 0.25,  0.0          },
+                            {0.0,           3.0e-8 * 0.25, 0.0,            4.0e-8 * 0.75},
+                            {2.0e-8 * 0.5,  0.0,           4.0e-8 * 0.75,  0.0          }};
+    const double temperatures[] = {300.0, 250.0, 280.0, 200.0, 3.0};
+    for (int port = 0; port < tArticle.mNumPorts; ++port) {
+        tArticle.mPotentialVector[port] = temperatures[tArticle.mNodeMap[port]];
+    }
+
+    tArticle.step(tTimeStep);
+    CPPUNIT_ASSERT(tArticle.needAdmittanceUpdate());
+    tArticle.computeFlows(tTimeStep);
+
+    /// @test net heat into each surface's node equals its exchange with all other surfaces.
+    for (int i = 0; i < 4; ++i) {
+        const double ti = temperatures[tSurfaceNodes[i]];
+        double expected = 0.0;
+        for (int j = 0; j < 4; ++j) {
+            const double tj = temperatures[tSurfaceNodes[j]];
+            expected += c[i][j] * (tj*tj*tj*tj - ti*ti*ti*ti);
+        }
+        const GunnsBasicNode& node = tNodes[tSurfaceNodes[i]];
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, node.getInflux() - node.getOutflux(), 1.0e-10);
+    }
+
+    /// @test a rotating surface only changes its own paths' conductances.
+    const double g0 = tArticle.getConductance(0);
+    const double g3 = tArticle.getConductance(3);
+    tArticle.mAdmittanceUpdate = false;
+    tArticle.setSurfaceViewScalar(3, 0.0);
+    tArticle.step(tTimeStep);
+    CPPUNIT_ASSERT(tArticle.needAdmittanceUpdate());
+    CPPUNIT_ASSERT(g0  == tArticle.getConductance(0));
+    CPPUNIT_ASSERT(0.0 == tArticle.getConductance(1));
+    CPPUNIT_ASSERT(0.0 == tArticle.getConductance(3));
+    CPPUNIT_ASSERT(g3  != tArticle.getConductance(3));
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,115 @@
+#ifndef UtGunnsThermalRadiationEnclosure_EXISTS
+#define UtGunnsThermalRadiationEnclosure_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup    UT_GUNNS_THERMAL_RADIATION_ENCLOSURE  Gunns Thermal Radiation Enclosure Unit test
+/// @ingroup     UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details     Unit Tests for Gunns Thermal Radiation Enclosure
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "aspects/thermal/GunnsThermalRadiationEnclosure.hh"
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsThermalRadiationEnclosure and befriend UtGunnsThermalRadiationEnclosure.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsThermalRadiationEnclosure : public GunnsThermalRadiationEnclosure
+{
+    public:
+        FriendlyGunnsThermalRadiationEnclosure();
+        virtual ~FriendlyGunnsThermalRadiationEnclosure();
+        friend class UtGunnsThermalRadiationEnclosure;
+};
+inline FriendlyGunnsThermalRadiationEnclosure::FriendlyGunnsThermalRadiationEnclosure() : GunnsThermalRadiationEnclosure() {};
+inline FriendlyGunnsThermalRadiationEnclosure::~FriendlyGunnsThermalRadiationEnclosure() {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Thermal Radiation Enclosure unit tests.
+///
+/// @details  This class provides unit tests for the Thermal Radiation Enclosure within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsThermalRadiationEnclosure: public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default Constructor.
+        UtGunnsThermalRadiationEnclosure();
+
+        /// @brief    Default Destructor.
+        virtual ~UtGunnsThermalRadiationEnclosure();
+
+        /// @brief    Executes before each test.
+        void setUp();
+
+        /// @brief    Executes after each test.
+        void tearDown();
+
+        /// @brief    Tests ConfigData construction
+        void testConfig();
+
+        /// @brief    Tests InputData construction
+        void testInput();
+
+        /// @brief    Tests Default Construction.
+        void testDefaultConstruction();
+
+        /// @brief    Tests initialize method without exceptions
+        void testInitialization();
+
+        /// @brief    Tests initialize method with exceptions
+        void testInitializationExceptions();
+
+        /// @brief    Tests the surface pair accessor and view scalar setter.
+        void testAccessors();
+
+        /// @brief    Tests the step and computeFlows methods against the full enclosure.
+        void testStep();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsThermalRadiationEnclosure);
+        CPPUNIT_TEST(testConfig);
+        CPPUNIT_TEST(testInput);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialization);
+        CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testAccessors);
+        CPPUNIT_TEST(testStep);
+        CPPUNIT_TEST_SUITE_END();
+
+        GunnsThermalRadiationEnclosureConfigData* tConfigData;  /**< (--)   Pointer to nominal configuration data */
+        GunnsThermalRadiationEnclosureInputData*  tInputData;   /**< (--)   Pointer to nominal input data */
+        FriendlyGunnsThermalRadiationEnclosure    tArticle;     /**< (--)   Test Article */
+        std::string    tLinkName;                               /**< (--)   Link Name */
+        GunnsBasicNode tNodes[5];                               /**< (--)   Network Nodes */
+        GunnsNodeList  tNodeList;                               /**< (--)   Node List */
+        std::vector<GunnsBasicLink*> tNetworkLinks;             /**< (--)   Network Links */
+        std::vector<int>    tSurfaceNodes;                      /**< (--)   Network node of each surface */
+        std::vector<int>    tRowStart;                          /**< (--)   First coefficient of each surface row */
+        std::vector<int>    tColumns;                           /**< (--)   Other surface of each coefficient */
+        std::vector<double> tCoefficients;                      /**< (W/K4) Radiation coefficients */
+        std::vector<double> tViewScalars;                       /**< (--)   View scalar of each coefficient */
+        double  tBlockage;                                      /**< (--)   Link Blockage */
+        double  tTimeStep;                                      /**< (s)    Nominal time step */
+        double  tTolerance;                                     /**< (--)   Nominal tolerance for comparison
+                                                                            of expected and returned values */
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsThermalRadiationEnclosure(const UtGunnsThermalRadiationEnclosure& that);
+
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsThermalRadiationEnclosure& operator =(const UtGunnsThermalRadiationEnclosure& that);
+};
+
+///@}
+
+#endif
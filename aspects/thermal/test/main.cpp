@@ -12,6 +12,8 @@ LIBRARY DEPENDENCY:
 #include "UtGunnsThermalCapacitor.hh"
 #include "UtGunnsThermalCapacitorHeatQueues.hh"
 #include "UtGunnsThermalRadiation.hh"
+#include "UtGunnsThermalRadiationBank.hh"
+#include "UtGunnsThermalRadiationEnclosure.hh"
 #include "UtGunnsThermalHeater.hh"
 #include "UtGunnsThermalPanel.hh"
 #include "UtGunnsThermalMultiPanel.hh"
@@ -35,6 +37,8 @@ int main(int argc, char** argv)
     runner.addTest( UtGunnsThermalCapacitor::suite() );
     runner.addTest( UtGunnsThermalCapacitorHeatQueues::suite() );
     runner.addTest( UtGunnsThermalRadiation::suite() );
+    runner.addTest( UtGunnsThermalRadiationBank::suite() );
+    runner.addTest( UtGunnsThermalRadiationEnclosure::suite() );
     runner.addTest( UtGunnsThermalHeater::suite() );
     runner.addTest( UtGunnsThermalPotential::suite() );
     runner.addTest( UtGunnsThermalPanel::suite() );
@@ -24,6 +24,7 @@ LIBRARY DEPENDENCY:
     (core/GunnsInfraFunctions.o)
     (core/GunnsFluidFlowOrchestrator.o)
     (core/GunnsMinorStepLog.o)
+    (core/GunnsSnapshot.o)
     (math/linear_algebra/Sor.o)
     (math/linear_algebra/CholeskyLdu.o)
 #ifdef GUNNS_CUDA_ENABLE
@@ -48,10 +49,12 @@ LIBRARY DEPENDENCY:
 #include <cstdio>
 
 #include "core/Gunns.hh"
+#include "core/GunnsMacros.hh"
 #include "core/GunnsBasicLink.hh"
 #include "core/GunnsFluidNode.hh"
 #include "core/GunnsInfraFunctions.hh"
 #include "core/GunnsFluidFlowOrchestrator.hh"
+#include "core/GunnsSnapshot.hh"
 #include "math/linear_algebra/Sor.hh"
 #include "math/linear_algebra/CholeskyLdu.hh"
 #include "software/exceptions/TsInitializationException.hh"
@@ -134,6 +137,9 @@ Gunns::Gunns()
     mMajorPotentialVector  (0),
     mSlavePotentialVector  (0),
     mNetCapDeltaPotential  (0),
+    mNetCapDeltaIndices    (),
+    mNetCapRequests        (0),
+    mNetCapIsSet           (0),
     mIslandVectors         (),
     mNodeIslandNumbers     (0),
     mIslandCount           (0),
@@ -191,6 +197,18 @@ Gunns::Gunns()
     mSorTolerance          (1.0E-12),
     mSorLastIteration      (-1),
     mSorFailCount          (0),
+    mAdaptiveDecomposition (false),
+    mAdaptiveTolerance     (1.0E-3),
+    mAdaptiveRefineTolerance(1.0E-10),
+    mAdaptiveMaxRefinements(5),
+    mAdaptiveBaseValid     (false),
+    mAdaptiveRefining      (false),
+    mAdaptiveLastChange    (0.0),
+    mAdaptiveSkipCount     (0),
+    mAdaptiveFallbackCount (0),
+    mAdaptiveBaseMatrix    (0),
+    mAdaptiveBaseDecomp    (0),
+    mAdaptiveMatrix        (0),
     mLastSolverMode        (NORMAL),
     mLastIslandMode        (OFF),
     mLastRunMode           (RUN)
@@ -205,6 +223,12 @@ Gunns::Gunns()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 Gunns::~Gunns()
 {
+    /// - Networks can delete their nodes before this solver, such as the derived classes of
+    ///   GunnsNetworkBase, so forget the nodes before cleanup rather than detach them.
+    {
+        delete [] mNodes;
+        mNodes = 0;
+    }
     cleanup();
     {
         if (mFlowOrchestrator and mOwnsFlowOrchestrator) {
@@ -212,9 +236,6 @@ Gunns::~Gunns()
             mFlowOrchestrator     = 0;
             mOwnsFlowOrchestrator = false;
         }
-    } {
-        delete [] mNodes;
-        mNodes = 0;
     }
     if (mSolverGpuSparse) {
         delete mSolverGpuSparse;
@@ -230,10 +251,16 @@ Gunns::~Gunns()
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details  Deletes allocated memory objects.
+/// @details  Deletes allocated memory objects.  Nodes still known to this solver are detached from
+///           the network capacitance request mirror before it is deleted.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void Gunns::cleanup()
 {
+    if (mNodes and mNetCapRequests) {
+        for (int node = 0; node < mNetworkSize; ++node) {
+            mNodes[node]->setNetCapRequestMirror(0);
+        }
+    }
     {
         delete [] mLinkNumPorts;
         mLinkNumPorts = 0;
@@ -265,7 +292,15 @@ void Gunns::cleanup()
     TS_DELETE_ARRAY(mDebugSavedNode);
     TS_DELETE_ARRAY(mDebugSavedSlice);
     TS_DELETE_ARRAY(mNodeIslandNumbers);
-    TS_DELETE_ARRAY(mNetCapDeltaPotential);
+    if (mNetCapDeltaPotential) {
+        for (int node = 0; node < mNetworkSize; ++node) {
+            TS_DELETE_ARRAY(mNetCapDeltaPotential[node]);
+        }
+        TS_DELETE_ARRAY(mNetCapDeltaPotential);
+    }
+    mNetCapDeltaIndices.clear();
+    TS_DELETE_ARRAY(mNetCapIsSet);
+    TS_DELETE_ARRAY(mNetCapRequests);
     TS_DELETE_ARRAY(mSlavePotentialVector);
     TS_DELETE_ARRAY(mMajorPotentialVector);
     TS_DELETE_ARRAY(mMinorPotentialVector);
@@ -283,6 +318,15 @@ void Gunns::cleanup()
     } {
         delete [] mAdmittanceMatrix;
         mAdmittanceMatrix = 0;
+    } {
+        delete [] mAdaptiveMatrix;
+        mAdaptiveMatrix = 0;
+    } {
+        delete [] mAdaptiveBaseDecomp;
+        mAdaptiveBaseDecomp = 0;
+    } {
+        delete [] mAdaptiveBaseMatrix;
+        mAdaptiveBaseMatrix = 0;
     }
 }
 
@@ -304,6 +348,65 @@ void Gunns::setGpuOptions(const GpuMode mode, const int threshold)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  flag             (--)  True to enable the adaptive decomposition mode.
+/// @param[in]  tolerance        (--)  Maximum relative matrix change to re-use the decomposition.
+/// @param[in]  refineTolerance  (--)  Relative residual tolerance for the refinement to converge.
+/// @param[in]  maxRefinements   (--)  Iterative refinement limit before decomposing again.
+///
+/// @details  When enabling the mode, rejects invalid tolerances & refinement limit with an H&S
+///           warning, leaving the mode unchanged.  When disabling the mode, the tolerances & limit
+///           are ignored and the last valid ones are kept.  The mode's working arrays are allocated
+///           when it is first enabled in an initialized network, otherwise during initialization.
+///           Disabling the mode forces the admittance matrix to be rebuilt and decomposed on the
+///           next pass, since the last decomposition may not be of the current matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setAdaptiveDecomposition(const bool   flag,
+                                     const double tolerance,
+                                     const double refineTolerance,
+                                     const int    maxRefinements)
+{
+    if (flag) {
+        if (tolerance < 0.0 or refineTolerance <= 0.0 or maxRefinements < 1) {
+            GUNNS_WARNING("adaptive decomposition mode rejected because of invalid tolerances or "
+                          << "refinement limit.");
+            return;
+        }
+        mAdaptiveTolerance       = tolerance;
+        mAdaptiveRefineTolerance = refineTolerance;
+        mAdaptiveMaxRefinements  = maxRefinements;
+    }
+    if (flag != mAdaptiveDecomposition) {
+        mAdaptiveDecomposition = flag;
+        if (mAdaptiveRefining) {
+            mRebuild = true;
+        }
+        mAdaptiveBaseValid = false;
+        mAdaptiveRefining  = false;
+        if (flag and mInitFlag) {
+            allocateAdaptiveArrays();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Allocates the adaptive decomposition mode's matrix arrays if they don't already exist.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::allocateAdaptiveArrays()
+{
+    if (not mAdaptiveBaseMatrix) {
+        const int matrixSize = mNetworkSize * mNetworkSize;
+        mAdaptiveBaseMatrix = new double[matrixSize];
+        mAdaptiveBaseDecomp = new double[matrixSize];
+        mAdaptiveMatrix     = new double[matrixSize];
+        for (int i = 0; i < matrixSize; ++i) {
+            mAdaptiveBaseMatrix[i] = 0.0;
+            mAdaptiveBaseDecomp[i] = 0.0;
+            mAdaptiveMatrix[i]     = 0.0;
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]     configData  (--) Input configuration data
 /// @param[in,out] linksVector (--) Input network links vector
@@ -356,7 +459,9 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
     TS_NEW_PRIM_ARRAY_EXT(mMinorPotentialVector, mNetworkSize,       double, configData.mName + ".mMinorPotentialVector");
     TS_NEW_PRIM_ARRAY_EXT(mMajorPotentialVector, mNetworkSize,       double, configData.mName + ".mMajorPotentialVector");
     TS_NEW_PRIM_ARRAY_EXT(mSlavePotentialVector, mNetworkSize,       double, configData.mName + ".mSlavePotentialVector");
-    TS_NEW_PRIM_ARRAY_EXT(mNetCapDeltaPotential, matrixSize,         double, configData.mName + ".mNetCapDeltaPotential");
+    TS_NEW_PRIM_POINTER_ARRAY_EXT(mNetCapDeltaPotential, mNetworkSize,       double, configData.mName + ".mNetCapDeltaPotential");
+    TS_NEW_PRIM_ARRAY_EXT(mNetCapRequests,       mNetworkSize,       double, configData.mName + ".mNetCapRequests");
+    TS_NEW_PRIM_ARRAY_EXT(mNetCapIsSet,          mNetworkSize,       bool,   configData.mName + ".mNetCapIsSet");
     TS_NEW_PRIM_ARRAY_EXT(mNodeIslandNumbers,    mNetworkSize,       int,    configData.mName + ".mNodeIslandNumbers");
     TS_NEW_PRIM_ARRAY_EXT(mDebugSavedSlice,      mNetworkSize,       double, configData.mName + ".mDebugSavedSlice");
     TS_NEW_PRIM_ARRAY_EXT(mDebugSavedNode,      (mMinorStepLimit+1), double, configData.mName + ".mDebugSavedNode");
@@ -372,18 +477,24 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
         mSlavePotentialVector[i]  = 0.0;
         mNodeIslandNumbers[i]     = i;
         mDebugSavedSlice[i]       = 0.0;
+        mNetCapDeltaPotential[i]  = 0;
+        mNetCapRequests[i]        = 0.0;
+        mNetCapIsSet[i]           = false;
 
         /// - Pre-load the 2D island vectors' 1st dimension with vectors of ints, one for each row
         ///   in the matrix - so that we don't have to keep pushing & popping them during runtime.
         std::vector<int> v;
         mIslandVectors.push_back(v);
+        mNetCapDeltaIndices.push_back(v);
     }
     for (int i = 0; i < mNetworkSize*mNetworkSize; ++i) {
         mAdmittanceMatrix[i]       = 0.0;
         mAdmittanceMatrixIsland[i] = 0.0;
-        mNetCapDeltaPotential[i]   = 0.0;
     }
     clearDebugNode();
+    if (mAdaptiveDecomposition) {
+        allocateAdaptiveArrays();
+    }
 
     mNumLinks              = static_cast<int>(linksVector.size());
     mDebugDesiredSlice     = 0;
@@ -448,9 +559,12 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
         mLinkNumPorts[link]           = mLinks[link]->getNumberPorts();
     }
 
-    /// - Point the nodes to their network capacitance delta-potentials array.
+    /// - The nodes' network capacitance delta-potentials arrays are allocated on first request.
+    ///   Point the nodes to their network capacitance request mirrors.
     for (int node = 0; node < mNetworkSize; ++node) {
-        mNodes[node]->setNetCapDeltaPotential(&mNetCapDeltaPotential[node*mNetworkSize]);
+        mNodes[node]->setNetCapDeltaPotential(0);
+        mNodes[node]->setNetCapRequestMirror(&mNetCapRequests[node]);
+        mNetCapIsSet[node] = mNodes[node]->getNetworkCapacitance() != 0.0;
     }
 
     verifyNodeInitialization();
@@ -671,6 +785,8 @@ void Gunns::restart()
     try {
         for (int node = 0; node < mNetworkSize; ++node) {
             mNodes[node]->restart();
+            mNodes[node]->setNetCapRequestMirror(&mNetCapRequests[node]);
+            mNetCapIsSet[node] = true;
         }
 
         mNodes[mNumNodes-1]->resetContentState();
@@ -689,6 +805,192 @@ void Gunns::restart()
     mInitFlag = true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The snapshot to save the network state into.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Saves the dynamic state of this solver and all of its nodes and links into the given
+///           snapshot, replacing its previous contents.  This is for rolling the network back to
+///           this state later with restoreSnapshot, and is much faster than a checkpoint since it
+///           is an in-memory binary copy.  Networks with spotters should use the
+///           GunnsNetworkBase::saveSnapshot method instead, to include their spotters.  Throws if
+///           any link doesn't support snapshots: see isSnapshotSupported.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::saveSnapshot(GunnsSnapshot& snapshot)
+{
+    if (not mInitFlag) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "can't save a snapshot before initialization.");
+    }
+    snapshot.beginSave();
+    try {
+        snapshotState(snapshot);
+    } catch (...) {
+        snapshot.abort();
+        throw;
+    }
+    snapshot.end();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The snapshot to restore the network state from.
+///
+/// @throws   TsInitializationException, TsOutOfBoundsException
+///
+/// @details  Restores the dynamic state of this solver and all of its nodes and links from the
+///           given snapshot, which must have been saved from this network or an identical one.  The
+///           network continues from the restored state on the next step, without re-initializing.
+///           If the snapshot doesn't match this network, an exception is thrown and the network is
+///           left partially restored.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::restoreSnapshot(GunnsSnapshot& snapshot)
+{
+    if (not mInitFlag) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "can't restore a snapshot before initialization.");
+    }
+    snapshot.beginRestore();
+    try {
+        snapshotState(snapshot);
+    } catch (...) {
+        snapshot.abort();
+        throw;
+    }
+    snapshot.end();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @throws   TsInitializationException, TsOutOfBoundsException
+///
+/// @details  Saves or restores the solver's dynamic state, followed by all of the nodes, including
+///           Ground, and all of the links, in the given snapshot.  The snapshot must already have
+///           been started with beginSave or beginRestore.  Saving throws if any link doesn't
+///           support snapshots, since restoring it would only roll back part of its state.
+///
+///           The decomposed admittance matrix, islands and adaptive decomposition state are only
+///           included if the snapshot was saved with its include matrix option, so that the
+///           restored network continues exactly as the original did.  Otherwise they are left out
+///           to make the snapshot smaller, and restoring forces the matrix to be rebuilt and
+///           decomposed on the next step.
+///
+///           The GPU solvers don't keep state between steps, so they aren't included.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::snapshotState(GunnsSnapshot& snapshot)
+{
+    /// - Refuse to save links that would only be partially restored.
+    if (GunnsSnapshot::SAVE == snapshot.getMode()) {
+        for (int link = 0; link < mNumLinks; ++link) {
+            if (not mLinks[link]->isSnapshotSupported()) {
+                std::ostringstream msg;
+                msg << "Link " << mLinks[link]->getName() << " doesn't support snapshots.";
+                GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data", msg.str());
+            }
+        }
+    }
+
+    /// - The network sizes guard against restoring the wrong network.
+    int numNodes = mNumNodes;
+    int numLinks = mNumLinks;
+    snapshot.sync(numNodes);
+    snapshot.sync(numLinks);
+    if (numNodes != mNumNodes or numLinks != mNumLinks) {
+        GUNNS_ERROR(TsOutOfBoundsException, "Input Argument Out Of Range",
+                    "the snapshot doesn't match the size of this network.");
+    }
+
+    /// - Performance metrics.
+    snapshot.sync(mMajorStepCount);
+    snapshot.sync(mConvergenceFailCount);
+    snapshot.sync(mLinkResetStepFailCount);
+    snapshot.sync(mMinorStepCount);
+    snapshot.sync(mMaxMinorStepCount);
+    snapshot.sync(mLastMinorStep);
+    snapshot.sync(mAvgMinorStepCount);
+    snapshot.sync(mDecompositionCount);
+    snapshot.sync(mMaxDecompositionCount);
+    snapshot.sync(mLastDecomposition);
+    snapshot.sync(mAvgDecompositionCount);
+    snapshot.sync(mSorFailCount);
+    snapshot.sync(mAdaptiveSkipCount);
+    snapshot.sync(mAdaptiveFallbackCount);
+
+    /// - Solution vectors and the network capacitance flags.
+    snapshot.sync(mPotentialVector,      mNetworkSize);
+    snapshot.sync(mMinorPotentialVector, mNetworkSize);
+    snapshot.sync(mMajorPotentialVector, mNetworkSize);
+    snapshot.sync(mNetCapIsSet,          mNetworkSize);
+
+    /// - The decomposed admittance matrix and its related state.  A restore uses the option the
+    ///   snapshot was saved with.
+    bool includeMatrix = snapshot.getIncludeMatrix();
+    snapshot.sync(includeMatrix);
+    if (includeMatrix) {
+        snapshot.sync(mRebuild);
+        snapshot.sync(mLastSolverMode);
+        snapshot.sync(mLastIslandMode);
+        snapshot.sync(mLastRunMode);
+        snapshot.sync(mAdmittanceMatrix, mNetworkSize * mNetworkSize);
+        snapshot.sync(mNodeIslandNumbers, mNetworkSize);
+        for (int island = 0; island < mNetworkSize; ++island) {
+            snapshot.sync(mIslandVectors[island]);
+        }
+        snapshot.sync(mIslandCount);
+        snapshot.sync(mIslandMaxSize);
+
+        snapshot.sync(mAdaptiveBaseValid);
+        snapshot.sync(mAdaptiveRefining);
+        snapshot.sync(mAdaptiveLastChange);
+        bool adaptiveArrays = (0 != mAdaptiveBaseMatrix);
+        snapshot.sync(adaptiveArrays);
+        if (adaptiveArrays) {
+            allocateAdaptiveArrays();
+            const int matrixSize = mNetworkSize * mNetworkSize;
+            snapshot.sync(mAdaptiveBaseMatrix, matrixSize);
+            snapshot.sync(mAdaptiveBaseDecomp, matrixSize);
+            snapshot.sync(mAdaptiveMatrix,     matrixSize);
+        }
+
+        /// - Point the nodes to their restored islands.
+        if (snapshot.isRestoring()) {
+            for (int node = 0; node < mNetworkSize; ++node) {
+                mNodes[node]->setIslandVector(&mIslandVectors[mNodeIslandNumbers[node]]);
+            }
+        }
+    } else if (snapshot.isRestoring()) {
+        mRebuild           = true;
+        mAdaptiveBaseValid = false;
+        mAdaptiveRefining  = false;
+    }
+
+    /// - Nodes and links.
+    for (int node = 0; node < mNumNodes; ++node) {
+        mNodes[node]->snapshotState(snapshot);
+    }
+    for (int link = 0; link < mNumLinks; ++link) {
+        mLinks[link]->snapshotState(snapshot);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if all of the network's links support snapshots.
+///
+/// @details  Returns false if any link's snapshotState doesn't include all of its dynamic state, in
+///           which case saveSnapshot would throw.  Callers can check this first to skip snapshots
+///           of such networks.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::isSnapshotSupported() const
+{
+    for (int link = 0; link < mNumLinks; ++link) {
+        if (not mLinks[link]->isSnapshotSupported()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details   Performs functions common to initialization and restart.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -709,6 +1011,10 @@ inline void Gunns::initializeRestartCommonFunctions()
     /// - Reset the worst-case timing mode flag.
     mWorstCaseTiming        = false;
 
+    /// - Don't re-use a decomposition from before the restart in the adaptive decomposition mode.
+    mAdaptiveBaseValid      = false;
+    mAdaptiveRefining       = false;
+
     /// - Reset last-pass mode stats.
     mLastSolverMode         = mSolverMode;
     mLastIslandMode         = mIslandMode;
@@ -737,9 +1043,36 @@ void Gunns::step(const double timeStep)
 {
     double startTime = GunnsInfraFunctions::clockTime();
 
+    /// - Check for proper initialization and run-time mode settings, and start the major step.
+    if (not beginMajorStep()) return;
+
+    /// - Build & solve the system of equations.
+    bool isConverged = false;
+    try {
+        isConverged = iterateMinorSteps(timeStep);
+    } catch (TsNumericalException& e) {
+        mStepLog.recordStepResult(mLastDecomposition, GunnsMinorStepData::MATH_FAIL);
+        mStepLog.endMajorStep();
+        throw e;
+    }
+
+    finishMajorStep(isConverged, timeStep);
+    mStepTime = GunnsInfraFunctions::clockTime() - startTime;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) False if the network is paused and is not to be stepped.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Starts a major step: checks the mode settings, updates the major step count, calls the
+///           links to process their inputs and resets the node flows.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::beginMajorStep()
+{
     /// - Check for proper initialization and run-time mode settings.
     checkStepInputs();
-    if (PAUSE == mRunMode) return;
+    if (PAUSE == mRunMode) return false;
     ++mMajorStepCount;
     mStepLog.beginMajorStep();
 
@@ -753,17 +1086,19 @@ void Gunns::step(const double timeStep)
     for (int node = 0; node < mNumNodes; ++node) {
         mNodes[node]->resetFlows();
     }
+    return true;
+}
 
-    /// - Build & solve the system of equations.
-    bool isConverged = false;
-    try {
-        isConverged = iterateMinorSteps(timeStep);
-    } catch (TsNumericalException& e) {
-        mStepLog.recordStepResult(mLastDecomposition, GunnsMinorStepData::MATH_FAIL);
-        mStepLog.endMajorStep();
-        throw e;
-    }
-
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  isConverged (--) The network converged on a solution this major step.
+/// @param[in]  timeStep    (s)  The time step of the major frame.
+///
+/// @details  Finishes a major step after the system has been solved: updates the performance
+///           metrics, and either transports the flows and processes the link outputs, or resets
+///           the potential solution when the network didn't converge.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::finishMajorStep(const bool isConverged, const double timeStep)
+{
     /// - System performance metrics: update the average minor frame count per major frame.
     mAvgMinorStepCount     = double (mMinorStepCount)     / double (mMajorStepCount);
     mAvgDecompositionCount = double (mDecompositionCount) / double (mMajorStepCount);
@@ -788,7 +1123,7 @@ void Gunns::step(const double timeStep)
         overridePotential();
         outputPotentialVector();
         mStepLog.recordPotential(mPotentialVector);
-        GUNNS_WARNING("failed to converge.");
+        GUNNS_WARNING_DEFERRED("failed to converge.");
     }
 
     /// - Save the potential vector for next pass.  This covers linear networks, and the last minor
@@ -800,7 +1135,6 @@ void Gunns::step(const double timeStep)
     mStepLog.endMajorStep();
 
     mSolveTime = mSolveTimeWorking;
-    mStepTime  = GunnsInfraFunctions::clockTime() - startTime;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -852,29 +1186,8 @@ bool Gunns::iterateMinorSteps(const double timeStep)
         ///   building/solving the system.
         if (GunnsBasicLink::DELAY != result) {
 
-            /// - Step each link in the network.  On the first minor step, we call the link's main
-            ///   step method.  On subsequent minor steps (in a non-linear network), we call non-
-            ///   linear link's minorStep method.
-            for (int link = 0; link < mNumLinks; ++link) {
-
-                if (1 == mLastMinorStep) {
-                    mLinks[link]->step(timeStep);
-                }
-
-                else if(mLinks[link]->isNonLinear()) {
-                    mLinks[link]->minorStep(timeStep, mLastMinorStep);
-                }
-
-                /// - Rebuild the system if any link declares it is changing the admittance matrix.
-                if(mLinks[link]->needAdmittanceUpdate()) {
-                    mRebuild = true;
-                }
-            }
-
-            /// - Force rebuild of the system every minor step for worst-case timing mode.
-            if (mWorstCaseTiming) {
-                mRebuild = true;
-            }
+            /// - Step each link in the network.
+            stepLinks(timeStep);
 
             /// - Now that we have all the link contributions to the system of equations, build and
             ///   solve the system for a new solution vector, handle overrides of the solution, and
@@ -947,6 +1260,38 @@ bool Gunns::iterateMinorSteps(const double timeStep)
     return networkConverged;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  timeStep (s) The time step of the major frame
+///
+/// @details  Steps each link in the network for the current minor step.  On the first minor step,
+///           we call the link's main step method.  On subsequent minor steps (in a non-linear
+///           network), we call non-linear link's minorStep method.  The system is flagged for
+///           rebuild if any link changes its admittance matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::stepLinks(const double timeStep)
+{
+    for (int link = 0; link < mNumLinks; ++link) {
+
+        if (1 == mLastMinorStep) {
+            mLinks[link]->step(timeStep);
+        }
+
+        else if(mLinks[link]->isNonLinear()) {
+            mLinks[link]->minorStep(timeStep, mLastMinorStep);
+        }
+
+        /// - Rebuild the system if any link declares it is changing the admittance matrix.
+        if(mLinks[link]->needAdmittanceUpdate()) {
+            mRebuild = true;
+        }
+    }
+
+    /// - Force rebuild of the system every minor step for worst-case timing mode.
+    if (mWorstCaseTiming) {
+        mRebuild = true;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] minorStep (--) The absolute minor step # that the network is on
 /// @param[in] timeStep  (s)  Execution time step
@@ -961,6 +1306,18 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
 {
     //TODO prototype SOR/Cholesky mix
     buildSourceVector();
+
+    /// - When the adaptive decomposition mode can't be used this pass, forget its saved base, and
+    ///   if the last decomposition isn't of the current matrix, force a rebuild.
+    const bool adaptive = isAdaptiveEligible();
+    if (not adaptive) {
+        if (mAdaptiveRefining) {
+            mRebuild = true;
+        }
+        mAdaptiveBaseValid = false;
+        mAdaptiveRefining  = false;
+    }
+
     bool needDecomposition = false;
     if (mRebuild or mSorActive or mDebugDesiredStep != 0) {
         buildAdmittanceMatrix();
@@ -980,7 +1337,7 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
         if (mSorLastIteration < 0) {
             resetToMinorPotentialVector();
             mSorFailCount++;
-            GUNNS_WARNING("SOR failed to converge, reverting to Cholesky this step.");
+            GUNNS_WARNING_DEFERRED("SOR failed to converge, reverting to Cholesky this step.");
         }
     }
     //do cholesky if SOR either failed to converge or isn't being attempted.
@@ -992,6 +1349,25 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
                 saveDebugAdmittance();
             }
 
+            /// - In the adaptive decomposition mode, skip the decomposition when the new matrix is
+            ///   close enough to the last decomposed matrix.  The new matrix is saved for
+            ///   refinement of the solution, and the last decomposition is restored for solving.
+            mAdaptiveRefining = false;
+            if (adaptive and mAdaptiveBaseValid) {
+                mAdaptiveLastChange = computeAdaptiveChange();
+                if (mAdaptiveLastChange <= mAdaptiveTolerance) {
+                    const int matrixSize = mNetworkSize * mNetworkSize;
+                    for (int i = 0; i < matrixSize; ++i) {
+                        mAdaptiveMatrix[i]   = mAdmittanceMatrix[i];
+                        mAdmittanceMatrix[i] = mAdaptiveBaseDecomp[i];
+                    }
+                    mAdaptiveRefining = true;
+                    needDecomposition = false;
+                    mAdaptiveSkipCount++;
+                }
+            }
+        }
+        if (needDecomposition) {
             /// - Only decompose the admittance matrix in NORMAL mode when the matrix has changed, to
             ///   save CPU time.  This is by far the biggest CPU hog in GUNNS.  For a 400 node network,
             ///   90% of CPU time is spent in this method.
@@ -1032,7 +1408,9 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
                             }
                         }
 
-                    /// - Decompose the full matrix without islands.
+                    /// - Decompose the full matrix without islands, saving it as the adaptive base.
+                    } else if (adaptive) {
+                        decomposeAdaptiveBase();
                     } else {
                         decompose(mAdmittanceMatrix, mNetworkSize);
                     }
@@ -1049,6 +1427,32 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
         if (NORMAL == mSolverMode) {
             perturbNetworkCapacitances();
             solveCholesky();
+
+            /// - In the adaptive decomposition mode, refine the solution against the current
+            ///   matrix.  If the refinement fails to converge, decompose the current matrix and
+            ///   solve again.
+            if (mAdaptiveRefining and not refineAdaptiveSolution()) {
+                mAdaptiveRefining = false;
+                mAdaptiveFallbackCount++;
+                if (mDecompositionLimit > mLastDecomposition) {
+                    result = 1;
+                    mLastDecomposition++;
+                    mDecompositionCount++;
+                    const int matrixSize = mNetworkSize * mNetworkSize;
+                    for (int i = 0; i < matrixSize; ++i) {
+                        mAdmittanceMatrix[i] = mAdaptiveMatrix[i];
+                    }
+                    decomposeAdaptiveBase();
+                    perturbNetworkCapacitances();
+                    solveCholesky();
+                } else {
+                    /// - Force a rebuild next pass, since the last decomposition isn't of the
+                    ///   current matrix.
+                    mRebuild = true;
+                    throw TsOutOfBoundsException("Iteration Limit Exceeded", "Gunns",
+                                                 "decomposition limit exceeded.");
+                }
+            }
             cleanPotentialVector();
             computeNetworkCapacitances(timeStep);
         }
@@ -1088,6 +1492,212 @@ void Gunns::decompose(double *A, const int size, const int island)
     mSolveTimeWorking += GunnsInfraFunctions::clockTime() - startTime;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the adaptive decomposition mode can be used this pass.
+///
+/// @details  The adaptive decomposition mode requires the full matrix decomposition & solution on
+///           the CPU or dense GPU, so it isn't used with SOLVE island mode, GPU_SPARSE mode or SOR.
+///           It also isn't used with pre-decomposition debug slices or worst-case timing, which
+///           both expect every rebuilt matrix to be decomposed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::isAdaptiveEligible() const
+{
+    return mAdaptiveDecomposition and NORMAL == mSolverMode and SOLVE != mIslandMode
+           and GPU_SPARSE != mGpuMode and not mSorActive and 0 == mDebugDesiredStep
+           and not mWorstCaseTiming;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (--) Relative change of the admittance matrix from the adaptive base matrix.
+///
+/// @details  The change is the infinity-norm (maximum absolute row sum) of the difference between
+///           the current admittance matrix and the last decomposed matrix, relative to the
+///           infinity-norm of the last decomposed matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double Gunns::computeAdaptiveChange() const
+{
+    double deltaNorm = 0.0;
+    double baseNorm  = 0.0;
+    for (int row = 0; row < mNetworkSize; ++row) {
+        double deltaSum = 0.0;
+        double baseSum  = 0.0;
+        for (int index = row*mNetworkSize; index < (row+1)*mNetworkSize; ++index) {
+            deltaSum += std::fabs(mAdmittanceMatrix[index] - mAdaptiveBaseMatrix[index]);
+            baseSum  += std::fabs(mAdaptiveBaseMatrix[index]);
+        }
+        deltaNorm = std::max(deltaNorm, deltaSum);
+        baseNorm  = std::max(baseNorm,  baseSum);
+    }
+    if (baseNorm < DBL_EPSILON) {
+        return (deltaNorm < DBL_EPSILON) ? 0.0 : 1.0 / DBL_EPSILON;
+    }
+    return deltaNorm / baseNorm;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsNumericalException
+///
+/// @details  Saves the admittance matrix as the adaptive base matrix, decomposes it, and saves the
+///           decomposition for re-use by later passes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::decomposeAdaptiveBase()
+{
+    const int matrixSize = mNetworkSize * mNetworkSize;
+    for (int i = 0; i < matrixSize; ++i) {
+        mAdaptiveBaseMatrix[i] = mAdmittanceMatrix[i];
+    }
+    mAdaptiveBaseValid = false;
+    decompose(mAdmittanceMatrix, mNetworkSize);
+    for (int i = 0; i < matrixSize; ++i) {
+        mAdaptiveBaseDecomp[i] = mAdmittanceMatrix[i];
+    }
+    mAdaptiveBaseValid = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the refinement converged.
+///
+/// @throws   TsNumericalException
+///
+/// @details  Iteratively refines the potential vector solution {x} of the current admittance matrix
+///           [A], using the last decomposition as the approximate solver: {r} = {b} - [A]{x},
+///           {x} += [LDU]\{r}, until the refinement limit is reached or the residual of every row
+///           is within mAdaptiveRefineTolerance of that row's magnitude, |b| + sum(|A||x|).  The
+///           row-wise test isn't swamped by the very stiff potential sources common in networks.
+///           The islands working vectors are used for the residual and correction, since the
+///           adaptive mode isn't used with islands.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::refineAdaptiveSolution()
+{
+    double startTime = GunnsInfraFunctions::clockTime();
+    double* residual   = mSourceVectorIsland;
+    double* correction = mPotentialVectorIsland;
+
+    bool converged = false;
+    for (int iteration = 0; iteration <= mAdaptiveMaxRefinements; ++iteration) {
+        converged = true;
+        for (int row = 0; row < mNetworkSize; ++row) {
+            const double* rowA = &mAdaptiveMatrix[row*mNetworkSize];
+            double sum   = mSourceVector[row];
+            double scale = std::fabs(mSourceVector[row]);
+            for (int col = 0; col < mNetworkSize; ++col) {
+                const double product = rowA[col] * mPotentialVector[col];
+                sum   -= product;
+                scale += std::fabs(product);
+            }
+            residual[row] = sum;
+            if (std::fabs(sum) > mAdaptiveRefineTolerance * scale) {
+                converged = false;
+            }
+        }
+        if (converged) {
+            break;
+        }
+        if (iteration < mAdaptiveMaxRefinements) {
+            handleSolve(mSolverCpu, mAdmittanceMatrix, residual, correction, mNetworkSize);
+            for (int row = 0; row < mNetworkSize; ++row) {
+                mPotentialVector[row] += correction[row];
+            }
+        }
+    }
+    mSolveTimeWorking += GunnsInfraFunctions::clockTime() - startTime;
+    return converged;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the network can be stepped in a GunnsEnsemble batched solution.
+///
+/// @details  The batched solution replaces the single minor step of a linear network in NORMAL
+///           mode, decomposing and solving the full matrix on the CPU.  So it isn't used with
+///           non-linear networks, SOLVE island mode, GPU modes, SOR, the adaptive decomposition
+///           mode or pre-decomposition debug slices.  These networks are stepped by themselves.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::isBatchEligible() const
+{
+    return mInitFlag and mLinearNetwork and NORMAL == mSolverMode and SOLVE != mIslandMode
+           and NO_GPU == mGpuMode and not mSorActive and not mAdaptiveDecomposition
+           and 0 == mDebugDesiredStep;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  timeStep (s) The time step of the major frame
+///
+/// @returns  bool (--) True if the admittance matrix was rebuilt and needs to be decomposed.
+///
+/// @details  Performs the first half of the single minor step of a linear network for a batched
+///           solution, after beginMajorStep: steps the links and builds the system of equations,
+///           the same as iterateMinorSteps and buildAndSolveSystem do.  The caller then decomposes
+///           the admittance matrix if it was rebuilt, and solves the system into the potential
+///           vector before calling finishBatchStep.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::assembleBatchStep(const double timeStep)
+{
+    mSolveTimeWorking  = 0.0;
+    mLastDecomposition = 0;
+    mLastMinorStep     = 1;
+    ++mMinorStepCount;
+    if (mLastMinorStep > mMaxMinorStepCount) {
+        mMaxMinorStepCount = mLastMinorStep;
+    }
+    mStepLog.beginMinorStep(mMajorStepCount, mLastMinorStep);
+    stepLinks(timeStep);
+    buildSourceVector();
+
+    /// - The adaptive decomposition mode isn't used this pass, so forget its saved base.
+    if (mAdaptiveRefining) {
+        mRebuild = true;
+    }
+    mAdaptiveBaseValid = false;
+    mAdaptiveRefining  = false;
+    mSorLastIteration  = -1;
+
+    bool needDecomposition = false;
+    if (mRebuild) {
+        buildAdmittanceMatrix();
+        conditionAdmittanceMatrix();
+        needDecomposition = true;
+        mRebuild = false;
+        mLastDecomposition++;
+        mDecompositionCount++;
+    }
+    mStepLog.recordLinkContributions();
+    return needDecomposition;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  timeStep  (s) The time step of the major frame
+/// @param[in]  solveTime (s) This network's share of the batched decomposition & solution time.
+///
+/// @details  Finishes a major step after the batched solution has been stored in the potential
+///           vector, the same as the rest of the single minor step of a linear network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::finishBatchStep(const double timeStep, const double solveTime)
+{
+    mSolveTimeWorking += solveTime;
+    cleanPotentialVector();
+    computeNetworkCapacitances(timeStep);
+    overridePotential();
+    outputPotentialVector();
+    mStepLog.recordPotential(mPotentialVector);
+    mStepLog.recordStepResult(mLastDecomposition, GunnsMinorStepData::CONFIRM);
+
+    /// - Leave the minor step count where the minor step loop leaves it.
+    ++mLastMinorStep;
+    finishMajorStep(true, timeStep);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Ends a major step after the batched decomposition of the admittance matrix failed, the
+///           same as step does when the decomposition throws.  The matrix is rebuilt next pass,
+///           since it wasn't decomposed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::failBatchStep()
+{
+    mRebuild = true;
+    mStepLog.recordStepResult(mLastDecomposition, GunnsMinorStepData::MATH_FAIL);
+    mStepLog.endMajorStep();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @throws   TsInitializationException
 ///
@@ -1505,7 +2115,7 @@ inline void Gunns::cleanPotentialVector()
 void Gunns::perturbNetworkCapacitances()
 {
     for (int node = 0; node < mNetworkSize; ++node) {
-        const double fluxPerturbation = mNodes[node]->getNetworkCapacitanceRequest();
+        const double fluxPerturbation = mNetCapRequests[node];
         if (fluxPerturbation > DBL_EPSILON) {
             /// - When requested, perturb the node's source vector, solve, store the perturbed
             ///   potential in the node's capacitance term, and reset the source vector.
@@ -1513,20 +2123,64 @@ void Gunns::perturbNetworkCapacitances()
             mSourceVector[node] += fluxPerturbation;
             solveCholesky();
             mNodes[node]->setNetworkCapacitance(mPotentialVector[node]);
+            mNetCapIsSet[node]  = true;
             mSourceVector[node] = savedSourceVector;
 
             /// - Initially set the node's delta-potential array to the perturbed potentials.
-            const int offset = node * mNetworkSize;
-            for (int i=0,j=offset; i<mNetworkSize; ++i,++j) {
-                mNetCapDeltaPotential[j] = mPotentialVector[i];
-            }
-        } else {
+            storeNetCapDeltaPotential(node);
+        } else if (mNetCapIsSet[node]) {
             /// - Reset the node's capacitance term when not requested.
             mNodes[node]->setNetworkCapacitance(0.0);
+            mNetCapIsSet[node] = false;
         }
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  node  (--)  The node number whose delta-potentials array is stored.
+///
+/// @details  Stores the perturbed potential solution in the given node's network capacitance
+///           delta-potentials array, allocating the array the first time.  The array includes the
+///           Ground node, which is always zero.  In the island modes, only the potentials of the
+///           node's island are stored, since the perturbation has no effect on the other islands.
+///           This avoids touching the whole array in large networks split into many islands.  The
+///           entries stored last time are zeroed first, in case the node's island has changed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::storeNetCapDeltaPotential(const int node)
+{
+    if (not mNetCapDeltaPotential[node]) {
+        std::ostringstream name;
+        name << mName << ".mNetCapDeltaPotential_" << node;
+        TS_NEW_PRIM_ARRAY_EXT(mNetCapDeltaPotential[node], mNumNodes, double, name.str());
+        for (int i = 0; i < mNumNodes; ++i) {
+            mNetCapDeltaPotential[node][i] = 0.0;
+        }
+        mNetCapDeltaIndices[node].reserve(mNetworkSize);
+        mNodes[node]->setNetCapDeltaPotential(mNetCapDeltaPotential[node]);
+    }
+
+    double*           deltaPotential = mNetCapDeltaPotential[node];
+    std::vector<int>& indices        = mNetCapDeltaIndices[node];
+    for (unsigned int i = 0; i < indices.size(); ++i) {
+        deltaPotential[indices[i]] = 0.0;
+    }
+
+    /// - The island vectors are empty if the matrix hasn't been rebuilt since island mode was
+    ///   turned on, so then store all nodes.
+    const std::vector<int>& island = mIslandVectors[mNodeIslandNumbers[node]];
+    if (OFF != mIslandMode and not island.empty()) {
+        indices = island;
+    } else if (static_cast<int>(indices.size()) != mNetworkSize) {
+        indices.clear();
+        for (int i = 0; i < mNetworkSize; ++i) {
+            indices.push_back(i);
+        }
+    }
+    for (unsigned int i = 0; i < indices.size(); ++i) {
+        deltaPotential[indices[i]] = mPotentialVector[indices[i]];
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  timeStep  (s)  Execution time step.
 ///
@@ -1538,7 +2192,7 @@ void Gunns::perturbNetworkCapacitances()
 void Gunns::computeNetworkCapacitances(const double timeStep)
 {
     for (int node = 0; node < mNetworkSize; ++node) {
-        const double fluxPerturbation = mNodes[node]->getNetworkCapacitanceRequest();
+        const double fluxPerturbation = mNetCapRequests[node];
         if (fluxPerturbation > DBL_EPSILON) {
             /// - Generic GUNNS capacitance is the flux needed to cause a unit increase in node
             ///   potential.  The perturbed node potential was temporarily stored in the node in
@@ -1553,9 +2207,10 @@ void Gunns::computeNetworkCapacitances(const double timeStep)
             }
 
             /// - Subtract the final node potentials to finish the node's delta-potential array.
-            const int offset = node * mNetworkSize;
-            for (int i=0,j=offset; i<mNetworkSize; ++i,++j) {
-                mNetCapDeltaPotential[j] -= mPotentialVector[i];
+            double*                 deltaArray = mNetCapDeltaPotential[node];
+            const std::vector<int>& indices    = mNetCapDeltaIndices[node];
+            for (unsigned int i = 0; i < indices.size(); ++i) {
+                deltaArray[indices[i]] -= mPotentialVector[indices[i]];
             }
 
             /// - Reset the node's request when done.
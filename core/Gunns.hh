@@ -66,6 +66,7 @@ class  GunnsBasicFlowOrchestrator;
 struct GunnsNodeList;
 class  PolyFluidConfigData;
 class  CholeskyLdu;
+class  GunnsSnapshot;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Gunns Configuration Data
@@ -165,6 +166,18 @@ class Gunns
         /// @brief This method restarts this Gunns object.
         void restart();
 
+        /// @brief Saves the network state to the given snapshot.
+        void saveSnapshot(GunnsSnapshot& snapshot);
+
+        /// @brief Restores the network state from the given snapshot.
+        void restoreSnapshot(GunnsSnapshot& snapshot);
+
+        /// @brief Saves or restores the solver, nodes and links state in a network snapshot.
+        void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether all of the network's links support snapshots.
+        bool isSnapshotSupported() const;
+
         /// @brief Cycles this Gunns object to iterate the network in run-time.
         void step(const double timeStep);
 
@@ -192,6 +205,12 @@ class Gunns
         /// @brief Sets the solver worst-case timing flag.
         void setWorstCaseTiming(const bool flag);
 
+        /// @brief Sets the solver adaptive decomposition mode and its tolerances.
+        void setAdaptiveDecomposition(const bool   flag,
+                                      const double tolerance,
+                                      const double refineTolerance,
+                                      const int    maxRefinements);
+
         /// @brief Points the solver to use the given flow orchestrator.
         void setFlowOrchestrator(GunnsBasicFlowOrchestrator* orchestrator);
 
@@ -228,6 +247,12 @@ class Gunns
         /// @brief Gets the number of admittance matrix decompositions.
         int getDecompositionCount() const;
 
+        /// @brief Gets the number of decompositions skipped by the adaptive decomposition mode.
+        int getAdaptiveSkipCount() const;
+
+        /// @brief Gets the number of adaptive decomposition refinement failures.
+        int getAdaptiveFallbackCount() const;
+
         /// @brief Gets the most recent solve time value.
         double getSolveTime() const;
 
@@ -287,7 +312,24 @@ class Gunns
         double* mMinorPotentialVector;    /**<    (--) trick_chkpnt_io(**) Last minor step pass of mPotentialVector */
         double* mMajorPotentialVector;    /**<    (--) trick_chkpnt_io(**) Last major step pass of mPotentialVector */
         double* mSlavePotentialVector;    /**<    (--) trick_chkpnt_io(**) Input potential vector for SLAVE mode */
-        double* mNetCapDeltaPotential;    /**<    (--) trick_chkpnt_io(**) Network capacitance delta-potential arrays for each node */
+
+        /// @details  The network capacitance delta-potentials of each node are the changes in all
+        ///           node potentials in response to that node's network capacitance flux
+        ///           perturbation.  A node's array is only allocated the first time the node
+        ///           requests its network capacitance, and in the island modes only the entries for
+        ///           the node's island are computed, the rest being zero.  The node indices stored
+        ///           last time are kept so that the entries can be cleared when the island changes.
+        double** mNetCapDeltaPotential;   /**< ** (--) trick_chkpnt_io(**) Network capacitance delta-potential arrays for each node, null until requested */
+        std::vector< std::vector<int> > mNetCapDeltaIndices; /**< ** (--) trick_chkpnt_io(**) Node indices last stored in each delta-potential array */
+
+        /// @details  Contiguous mirrors of per-node data, so that the per-node passes of the solver
+        ///           sweep arrays instead of visiting every node object, which are scattered in
+        ///           memory.  The nodes keep mNetCapRequests coherent through their request setter.
+        ///           mNetCapIsSet flags the nodes whose network capacitance may be non-zero, so
+        ///           only those need to be reset when they stop requesting it.  The node potentials
+        ///           and island numbers are mirrored by mPotentialVector and mNodeIslandNumbers.
+        double* mNetCapRequests;          /**< ** (--) trick_chkpnt_io(**) Mirror of the nodes' network capacitance requests */
+        bool*   mNetCapIsSet;             /**< ** (--) trick_chkpnt_io(**) The node network capacitance may be non-zero */
 
         // I will surely be yelled at for this...
         // don't bother checkpoint/restarting these because they're rebuilt every pass anyway
@@ -421,6 +463,32 @@ class Gunns
         int     mSorFailCount;            /**<    (--)                     SOR number of convergence failures */
         /// @}
 
+        /// @name     Adaptive decomposition attributes.
+        /// @{
+        /// @details  In the optional adaptive decomposition mode, a rebuilt admittance matrix that
+        ///           differs from the last decomposed matrix by less than mAdaptiveTolerance
+        ///           (relative infinity-norm of the difference) is not decomposed.  Instead, the
+        ///           last decomposition is re-used as the base for iterative refinement of the
+        ///           solution against the new matrix.  The matrix is only decomposed again when the
+        ///           refinement fails to converge, or the change exceeds the tolerance.  This saves
+        ///           CPU time in networks whose link admittances vary slowly, such as non-linear
+        ///           pipes and fans.  The mode is ignored in SOLVE island mode, GPU_SPARSE mode,
+        ///           with SOR, debug pre-decomposition slices, or worst-case timing.  Network
+        ///           capacitance perturbations are solved with the un-refined last decomposition.
+        bool    mAdaptiveDecomposition;   /**<    (--)                     Use the adaptive decomposition mode */
+        double  mAdaptiveTolerance;       /**<    (--)                     Maximum relative matrix change for re-using the last decomposition */
+        double  mAdaptiveRefineTolerance; /**<    (--)                     Relative residual tolerance for the iterative refinement to converge */
+        int     mAdaptiveMaxRefinements;  /**<    (--)                     Iterative refinement limit before decomposing again */
+        bool    mAdaptiveBaseValid;       /**< ** (--) trick_chkpnt_io(**) The saved base matrix & decomposition are valid for re-use */
+        bool    mAdaptiveRefining;        /**< ** (--) trick_chkpnt_io(**) The current matrix is being solved by refinement of the base decomposition */
+        double  mAdaptiveLastChange;      /**<    (--) trick_chkpnt_io(**) The last relative change of the admittance matrix from the base */
+        int     mAdaptiveSkipCount;       /**<    (--)                     Total matrix decompositions skipped since init */
+        int     mAdaptiveFallbackCount;   /**<    (--)                     Total refinement failures causing a decomposition since init */
+        double* mAdaptiveBaseMatrix;      /**< ** (--) trick_chkpnt_io(**) Admittance matrix of the last decomposition */
+        double* mAdaptiveBaseDecomp;      /**< ** (--) trick_chkpnt_io(**) The last decomposition of the admittance matrix */
+        double* mAdaptiveMatrix;          /**< ** (--) trick_chkpnt_io(**) Current admittance matrix being solved by refinement */
+        /// @}
+
         /// @name     Last-pass states.
         /// @{
         /// @details  Some last-pass values are saved for responding to state changes.
@@ -429,13 +497,16 @@ class Gunns
         RunMode    mLastRunMode;          /**< ** (--) trick_chkpnt_io(**) The last-pass run mode. */
         /// @}
 
+        /// @brief Deletes allocated memory objects.
+        void       cleanup();
+
     private:
+        /// @brief Ensembles step their networks through the batched solution methods below.
+        friend class GunnsEnsemble;
+
         /// @brief Copy constructor unavailable since declared private and not implemented.
         Gunns(const Gunns& that);
 
-        /// @brief Deletes allocated memory objects.
-        void       cleanup();
-
         /// @brief Verifies the network configuration data is properly set.
         void       validateConfigData(const GunnsConfigData& configData);
 
@@ -451,12 +522,48 @@ class Gunns
         /// @brief Decomposes an admittance matrix based on size and GPU options.
         void       decompose(double *A, const int size, const int island = -1);
 
+        /// @brief Allocates the adaptive decomposition mode arrays.
+        void       allocateAdaptiveArrays();
+
+        /// @brief Returns whether the adaptive decomposition mode can be used this pass.
+        bool       isAdaptiveEligible() const;
+
+        /// @brief Returns the relative change of the admittance matrix from the adaptive base.
+        double     computeAdaptiveChange() const;
+
+        /// @brief Decomposes the full admittance matrix and saves it as the adaptive base.
+        void       decomposeAdaptiveBase();
+
+        /// @brief Iteratively refines the potential vector solution with the base decomposition.
+        bool       refineAdaptiveSolution();
+
+        /// @brief Returns whether the network can be stepped in a GunnsEnsemble batched solution.
+        bool       isBatchEligible() const;
+
+        /// @brief Steps the links and builds the system of equations for a batched solution.
+        bool       assembleBatchStep(const double timeStep);
+
+        /// @brief Finishes a major step after a batched solution.
+        void       finishBatchStep(const double timeStep, const double solveTime);
+
+        /// @brief Ends a major step after a failed batched decomposition.
+        void       failBatchStep();
+
         /// @brief Verifies network initialization and step method arguments.
         void       checkStepInputs();
 
+        /// @brief Starts a major step and calls the links to process their inputs.
+        bool       beginMajorStep();
+
+        /// @brief Finishes a major step and calls the links to process their outputs.
+        void       finishMajorStep(const bool isConverged, const double timeStep);
+
         /// @brief Iterates through minor steps for network solution convergence.
         bool       iterateMinorSteps(const double timeStep);
 
+        /// @brief Steps the links for the current minor step.
+        void       stepLinks(const double timeStep);
+
         /// @brief Builds and solves the system of equations.
         int        buildAndSolveSystem(const int minorStep, const double timeStep);
 
@@ -481,6 +588,9 @@ class Gunns
         /// @brief Finds potential deltas for network capacitances.
         void       perturbNetworkCapacitances();
 
+        /// @brief Stores the perturbed potentials in a node's network capacitance delta-potentials.
+        void       storeNetCapDeltaPotential(const int node);
+
         /// @brief Updates the node network capacitances.
         void       computeNetworkCapacitances(const double timeStep);
 
@@ -608,6 +718,28 @@ inline void Gunns::setWorstCaseTiming(const bool flag)
     mWorstCaseTiming = flag;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return int -- Returns the adaptive decomposition skip count.
+///
+/// @details  This method gets the number of decompositions skipped by the adaptive decomposition
+///           mode since init.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int Gunns::getAdaptiveSkipCount() const
+{
+    return mAdaptiveSkipCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return int -- Returns the adaptive decomposition fallback count.
+///
+/// @details  This method gets the number of times the adaptive decomposition mode iterative
+///           refinement failed to converge and the matrix was decomposed again, since init.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int Gunns::getAdaptiveFallbackCount() const
+{
+    return mAdaptiveFallbackCount;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] potentials (--) Array of node potentials to use for SLAVE mode.
 ///
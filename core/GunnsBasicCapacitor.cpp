@@ -29,6 +29,8 @@ LIBRARY DEPENDENCY:
     )
 */
 #include "GunnsBasicCapacitor.hh"
+#include <typeinfo>
+#include "GunnsSnapshot.hh"
 #include "math/MsMath.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
@@ -192,6 +194,31 @@ void GunnsBasicCapacitor::restartModel()
     mEditCapacitance     = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot, including the
+///           capacitance edit controls.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicCapacitor::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicLink::snapshotState(snapshot);
+
+    snapshot.sync(mCapacitance);
+    snapshot.sync(mEditCapacitanceFlag);
+    snapshot.sync(mEditCapacitance);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsBasicCapacitor.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicCapacitor::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsBasicCapacitor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
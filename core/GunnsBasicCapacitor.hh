@@ -125,6 +125,12 @@ class GunnsBasicCapacitor : public GunnsBasicLink
         /// @brief Method for computing the flows across the link
         virtual void computeFlows(const double dt);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
         /// @brief Returns Capacitance
         double getCapacitance() const;
 
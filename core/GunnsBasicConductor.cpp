@@ -29,6 +29,8 @@ LIBRARY DEPENDENCY:
     )
 */
 #include "GunnsBasicConductor.hh"
+#include <typeinfo>
+#include "GunnsSnapshot.hh"
 #include "math/MsMath.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
@@ -188,6 +190,30 @@ void GunnsBasicConductor::restartModel()
     mSystemConductance     = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicConductor::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicLink::snapshotState(snapshot);
+
+    snapshot.sync(mEffectiveConductivity);
+    snapshot.sync(mDefaultConductivity);
+    snapshot.sync(mSystemConductance);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsBasicConductor.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicConductor::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsBasicConductor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
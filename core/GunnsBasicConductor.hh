@@ -116,6 +116,12 @@ class GunnsBasicConductor : public GunnsBasicLink
         /// @brief Method for computing the flows across the link
         virtual void computeFlows(const double dt);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
         /// @brief Sets the default conductivity of the link
         void   setDefaultConductivity(const double conductivity);
 
@@ -20,6 +20,7 @@
 LIBRARY DEPENDENCY:
     (
      (GunnsBasicNode.o)
+     (GunnsSnapshot.o)
      (simulation/hs/TsHsMsg.o)
      (software/exceptions/TsInitializationException.o)
      (software/exceptions/TsOutOfBoundsException.o)
@@ -32,6 +33,7 @@ LIBRARY DEPENDENCY:
     )
 */
 #include "GunnsBasicLink.hh"
+#include "GunnsSnapshot.hh"
 #include "math/MsMath.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
@@ -303,6 +305,66 @@ void GunnsBasicLink::restartModel()
     /// - Base class implementation is empty.
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot, including its
+///           contributions to the network system of equations, malfunctions and node map.  If the
+///           restored node map differs from the current one, the node pointers and admittance map
+///           are updated to match, without the checks and messages of a user port command.
+///
+///           Derived links with their own dynamic state should override this and call their base
+///           class implementation too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicLink::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mPotentialVector,  mNumPorts);
+    snapshot.sync(mAdmittanceMatrix, static_cast<int>(mAdmittanceMap.mSize));
+    snapshot.sync(mSourceVector,     mNumPorts);
+    snapshot.sync(mOverrideVector,   mNumPorts);
+    snapshot.sync(mPortDirections,   mNumPorts);
+    snapshot.sync(mAdmittanceUpdate);
+    snapshot.sync(mFlux);
+    snapshot.sync(mPotentialDrop);
+    snapshot.sync(mPower);
+    snapshot.sync(mMinLinearizationPotential);
+    snapshot.sync(mMalfBlockageFlag);
+    snapshot.sync(mMalfBlockageValue);
+    snapshot.sync(mNodeMapLocked);
+    snapshot.sync(mUserPortSelect);
+    snapshot.sync(mUserPortSelectNode);
+    snapshot.sync(mUserPortSetControl);
+
+    bool mapChanged = false;
+    for (int port = 0; port < mNumPorts; ++port) {
+        int node = mNodeMap[port];
+        snapshot.sync(node);
+        if (node != mNodeMap[port]) {
+            mNodeMap[port] = node;
+            updateNodePointer(port);
+            mapChanged = true;
+        }
+    }
+    if (mapChanged) {
+        updateAdmittanceMap();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if snapshotState includes all of this link's dynamic state.
+///
+/// @details  This base class returns false, so that snapshots of networks containing links without
+///           a complete snapshotState fail to save, rather than silently restoring those links
+///           only partially.  Links that override snapshotState also override this, returning true
+///           only when this object is exactly their class, since a derived class may add dynamic
+///           state of its own.  Derived classes that have no more dynamic state than their base
+///           class can override this alone.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicLink::isSnapshotSupported() const
+{
+    return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] portMap (--) Network port mapping array
 /// @param[in] source  (--) Source of the port assignment command for output message (i.e. "user")
@@ -187,6 +187,12 @@ class GunnsBasicLink
         /// @brief Restarts the link after a checkpoint load
         void           restart();
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void   snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool   isSnapshotSupported() const;
+
         /// @brief Returns the object name
         const char*    getName() const;
 
@@ -18,7 +18,8 @@ ASSUMPTIONS AND LIMITATIONS:
    ()
 
 LIBRARY DEPENDENCY:
-   ((software/exceptions/TsInitializationException.o))
+   ((core/GunnsSnapshot.o)
+    (software/exceptions/TsInitializationException.o))
 
 PROGRAMMERS:
    (
@@ -28,6 +29,7 @@ PROGRAMMERS:
 */
 
 #include "GunnsBasicNode.hh"
+#include "GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -61,6 +63,7 @@ GunnsBasicNode::GunnsBasicNode()
     mScheduledOutflux         (0.0),
     mIslandVector             (0),
     mNetCapDeltaPotential     (0),
+    mNetCapRequestMirror      (0),
     mInitFlag                 (false)
 {
     // nothing to do
@@ -94,7 +97,7 @@ void GunnsBasicNode::initialize(const std::string& name, const double potential)
     mNetFlux                   = 0.0;
     mFluxThrough               = 0.0;
     mNetworkCapacitance        = 0.0;
-    mNetworkCapacitanceRequest = 0.0;
+    setNetworkCapacitanceRequest(0.0);
     mScheduledOutflux          = 0.0;
     mIslandVector              = 0;
     mNetCapDeltaPotential      = 0;
@@ -111,11 +114,35 @@ void GunnsBasicNode::restart()
     mOutfluxRate               = 0.0;
     mNetFlux                   = 0.0;
     mFluxThrough               = 0.0;
-    mNetworkCapacitanceRequest = 0.0;
+    setNetworkCapacitanceRequest(0.0);
     mScheduledOutflux          = 0.0;
     mIslandVector              = 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this node's dynamic state in the given snapshot.  The island vector
+///           pointer isn't included, since it points into the solver, which restores its islands
+///           in place or rebuilds them.  Derived classes should call their base class
+///           implementation too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicNode::snapshotState(GunnsSnapshot& snapshot)
+{
+    snapshot.sync(mPotential);
+    snapshot.sync(mInfluxRate);
+    snapshot.sync(mOutfluxRate);
+    snapshot.sync(mNetFlux);
+    snapshot.sync(mFluxThrough);
+    snapshot.sync(mNetworkCapacitance);
+    snapshot.sync(mScheduledOutflux);
+
+    /// - Restore the network capacitance request through its setter, to update the solver's copy.
+    double netCapRequest = mNetworkCapacitanceRequest;
+    snapshot.sync(netCapRequest);
+    setNetworkCapacitanceRequest(netCapRequest);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Validates this Gunns Basic Node initial state.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,6 +60,7 @@ PROGRAMMERS:
 class PolyFluid;
 class PolyFluidConfigData;
 class GunnsBasicNode;
+class GunnsSnapshot;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief Gunns Node List Structure
@@ -127,6 +128,9 @@ class GunnsBasicNode
         /// @brief Returns the network capacitance delta-potentials array.
         const double*  getNetCapDeltaPotential() const;
 
+        /// @brief Returns the network capacitance delta-potential of the given node.
+        double         getNetCapDeltaPotential(const int node) const;
+
         /// @brief Sets the node potential
         virtual void   setPotential(const double potential);
 
@@ -142,6 +146,9 @@ class GunnsBasicNode
         /// @brief Sets the network capacitance delta-potentials array.
         void           setNetCapDeltaPotential(const double* array);
 
+        /// @brief Sets the solver's mirror of this node's network capacitance request.
+        void           setNetCapRequestMirror(double* mirror);
+
         /// @brief Adds the given value to the scheduled out flux.
         virtual void   scheduleOutflux(const double fluxRate);
 
@@ -169,6 +176,9 @@ class GunnsBasicNode
         /// @brief Restarts the node after a checkpoint load
         virtual void   restart();
 
+        /// @brief Saves or restores the node dynamic state in a network snapshot
+        virtual void   snapshotState(GunnsSnapshot& snapshot);
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         // The following are all dummy placeholder methods to allow polymorphism with the derived
         // GunnsFluidNode class.
@@ -239,10 +249,17 @@ class GunnsBasicNode
         double                  mNetFlux;                   /**<    (--) trick_chkpnt_io(**) Net accumulation rate in the node from all in & out fluxes */
         double                  mFluxThrough;               /**<    (--) trick_chkpnt_io(**) Net flux rate through the node */
         double                  mNetworkCapacitance;        /**<    (--)                     Generic network effective capacitance at this node */
+        /// @details  The network capacitance request must only be written through
+        ///           setNetworkCapacitanceRequest(), which also writes the solver's copy through
+        ///           mNetCapRequestMirror.  The solver only reads its copy, so it ignores direct writes
+        ///           to mNetworkCapacitanceRequest, such as from an input file.  The solver sets the
+        ///           mirror at its initialization and restart, and clears it in its cleanup, except
+        ///           when it is destroyed, since the network may have deleted its nodes first.
         double                  mNetworkCapacitanceRequest; /**<    (--) trick_chkpnt_io(**) Generic flux requested to be used to calculate network capacitance for this node */
         double                  mScheduledOutflux;          /**<    (--) trick_chkpnt_io(**) Storage of total flux rate value out of the node before actual transport logic */
         const std::vector<int>* mIslandVector;              /**< ** (--) trick_chkpnt_io(**) Pointer to the node's island vector */
-        const double*           mNetCapDeltaPotential;      /**< *o (--) trick_chpint_io(**) Network capacitance delta-potentials array */
+        const double*           mNetCapDeltaPotential;      /**< *o (--) trick_chpint_io(**) Network capacitance delta-potentials array, null until first requested */
+        double*                 mNetCapRequestMirror;       /**< ** (--) trick_chkpnt_io(**) Solver's contiguous copy of the network capacitance request, or null */
         bool                    mInitFlag;                  /**< *o (--) trick_chkpnt_io(**) Initialization status flag (T is good) */
 
     private:
@@ -452,6 +469,9 @@ inline void GunnsBasicNode::setNetworkCapacitance(const double capacitance)
 inline void GunnsBasicNode::setNetworkCapacitanceRequest(const double flux)
 {
     mNetworkCapacitanceRequest = flux;
+    if (mNetCapRequestMirror) {
+        *mNetCapRequestMirror = flux;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -571,12 +591,33 @@ inline const std::vector<int>* GunnsBasicNode::getIslandVector() const
 /// @returns  const double*  (--)  Array of network capacitance delta-potentials.
 ///
 /// @details  Returns the mNetCapDeltaPotential pointer.
+///
+/// @note     The solver only allocates this array the first time this node requests its network
+///           capacitance, so the pointer is null until then, and the caller must check for null
+///           before dereferencing.  Prefer getNetCapDeltaPotential(node).
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline const double* GunnsBasicNode::getNetCapDeltaPotential() const
 {
     return mNetCapDeltaPotential;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  node  (--)  Network node number to get the delta-potential of, including Ground.
+///
+/// @returns  double  (--)  Network capacitance delta-potential of the given node.
+///
+/// @details  Returns the change in the given node's potential in response to this node's last
+///           network capacitance flux perturbation.  Returns zero if this node has not requested
+///           its network capacitance yet, or the given node is not on this node's island.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsBasicNode::getNetCapDeltaPotential(const int node) const
+{
+    if (mNetCapDeltaPotential and node >= 0) {
+        return mNetCapDeltaPotential[node];
+    }
+    return 0.0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  array  (--)  Pointer to the network capacitance delta-potentials.
 ///
@@ -587,6 +628,22 @@ inline void GunnsBasicNode::setNetCapDeltaPotential(const double* array)
     mNetCapDeltaPotential = array;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  mirror  (--)  Pointer to the solver's copy of this node's capacitance request.
+///
+/// @details  Sets mNetCapRequestMirror to the given pointer and copies the current network
+///           capacitance request into it.  The solver keeps the requests of all its nodes in one
+///           contiguous array so it can sweep them without visiting every node object, and
+///           setNetworkCapacitanceRequest() keeps the copy coherent.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsBasicNode::setNetCapRequestMirror(double* mirror)
+{
+    mNetCapRequestMirror = mirror;
+    if (mNetCapRequestMirror) {
+        *mNetCapRequestMirror = mNetworkCapacitanceRequest;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] fluxRate (--) Node outflux Rate
 ///
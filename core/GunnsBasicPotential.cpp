@@ -29,6 +29,8 @@ LIBRARY DEPENDENCY:
     )
 */
 #include "GunnsBasicPotential.hh"
+#include <typeinfo>
+#include "GunnsSnapshot.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name                (--) Link name
@@ -175,6 +177,28 @@ void GunnsBasicPotential::restartModel()
     GunnsBasicConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicPotential::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicConductor::snapshotState(snapshot);
+
+    snapshot.sync(mSourcePotential);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsBasicPotential.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicPotential::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsBasicPotential);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
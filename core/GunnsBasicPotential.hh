@@ -118,6 +118,12 @@ class GunnsBasicPotential : public GunnsBasicConductor
         /// @brief step method for updating the link
         virtual void step(const double dt);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
         /// @brief Sets the potential rise created by the link
         void         setSourcePotential(const double toPotential);
 
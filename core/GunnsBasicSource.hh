@@ -122,6 +122,12 @@ class GunnsBasicSource : public GunnsBasicLink
         /// @brief Calculates flow across the link
         virtual void computeFlows(const double dt);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
         /// @brief Sets the flux demand
         void setFluxDemand(const double toFlux);
 
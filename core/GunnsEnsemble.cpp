@@ -0,0 +1,349 @@
+/**
+@file
+@brief    GUNNS Network Ensemble implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   ((core/Gunns.o)
+    (core/GunnsInfraFunctions.o)
+    (math/linear_algebra/CholeskyLduBatch.o)
+    (simulation/hs/TsHsMsg.o)
+    (software/exceptions/TsInitializationException.o)
+    (software/exceptions/TsNumericalException.o))
+*/
+
+#include <algorithm>
+#include <sstream>
+#include "core/GunnsEnsemble.hh"
+#include "core/Gunns.hh"
+#include "core/GunnsInfraFunctions.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsNumericalException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name (--) Instance name for H&S messages.
+///
+/// @details  Default constructs this GUNNS Network Ensemble, with no instances.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsEnsemble::GunnsEnsemble(const std::string& name)
+    :
+    mName(name),
+    mInstances(),
+    mNetworkSize(0),
+    mSolver(),
+    mMatrices(),
+    mSources(),
+    mPotentials(),
+    mDecompMatrices(),
+    mDecompInstances(),
+    mFailedRows(),
+    mBatchInstances(),
+    mLoadedMajorSteps(),
+    mBatchStepCount(0),
+    mSoloStepCount(0),
+    mSolveTime(0.0),
+    mStepTime(0.0),
+    mInitFlag(false)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Network Ensemble.  The instances are not owned by the
+///           ensemble and are not deleted.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsEnsemble::~GunnsEnsemble()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] network (--) Pointer to the network instance to add.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the given network to the ensemble.  Instances are added before initialize(), and
+///           are stepped in the order they were added.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::addInstance(Gunns* network)
+{
+    if (not network) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "null network pointer.");
+    }
+    for (unsigned int i = 0; i < mInstances.size(); ++i) {
+        if (network == mInstances[i]) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "network has already been added.");
+        }
+    }
+    mInstances.push_back(network);
+    mInitFlag = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsInitializationException
+///
+/// @details  Checks that the instances have been initialized with the same network size, and
+///           allocates the batch arrays for them.  The batch matrices start as the identity, and
+///           each instance's matrix is loaded on its first step in the batch.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::initialize()
+{
+    mInitFlag = false;
+    if (mInstances.empty()) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "ensemble has no instances.");
+    }
+    mNetworkSize = mInstances[0]->getNetworkSize();
+    if (mNetworkSize < 1) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "instances have not been initialized.");
+    }
+    for (unsigned int i = 1; i < mInstances.size(); ++i) {
+        if (mNetworkSize != mInstances[i]->getNetworkSize()) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "instances have different network sizes.");
+        }
+    }
+
+    const int numInstances = getNumInstances();
+    mMatrices.assign(mNetworkSize * mNetworkSize * numInstances, 0.0);
+    mSources.assign(mNetworkSize * numInstances, 0.0);
+    mPotentials.assign(mNetworkSize * numInstances, 0.0);
+    mDecompMatrices.assign(mNetworkSize * mNetworkSize * numInstances, 0.0);
+    mFailedRows.assign(numInstances, -1);
+    mLoadedMajorSteps.assign(numInstances, -1);
+    mDecompInstances.reserve(numInstances);
+    mBatchInstances.reserve(numInstances);
+    invalidate();
+
+    mBatchStepCount = 0;
+    mSoloStepCount  = 0;
+    mSolveTime      = 0.0;
+    mStepTime       = 0.0;
+    mInitFlag       = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] timeStep (s) The time step of the major frame.
+///
+/// @throws   TsInitializationException, TsNumericalException
+///
+/// @details  Steps all instances.  Instances that aren't eligible for the batch are stepped by
+///           themselves.  The others are stepped in three passes: each instance assembles its
+///           system of equations, then the rebuilt matrices are decomposed and all systems solved
+///           in the batch, then each instance finishes its step with its solution.
+///
+///           A numerical failure in an instance doesn't stop the others from stepping.  After all
+///           instances are done, the failure is thrown for the lowest failed instance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::step(const double timeStep)
+{
+    if (not mInitFlag) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "ensemble has not been initialized.");
+    }
+    const double startTime    = GunnsInfraFunctions::clockTime();
+    const int    numInstances = getNumInstances();
+    int          failedInstance = -1;
+    mSolveTime = 0.0;
+
+    /// - Step the instances that aren't eligible for the batch by themselves.  Start the major
+    ///   step of the others, and assemble their systems of equations.
+    mBatchInstances.clear();
+    mDecompInstances.clear();
+    for (int k = 0; k < numInstances; ++k) {
+        Gunns* network = mInstances[k];
+        if (not network->isBatchEligible()) {
+            if (mLoadedMajorSteps[k] > -1) {
+                clearBatchMatrix(k);
+            }
+            ++mSoloStepCount;
+            try {
+                network->step(timeStep);
+            } catch (TsNumericalException&) {
+                if (failedInstance < 0) {
+                    failedInstance = k;
+                }
+            }
+            continue;
+        }
+
+        /// - An instance stepped or restored outside of the ensemble since its batch matrix was
+        ///   loaded must have its matrix reloaded.
+        if (mLoadedMajorSteps[k] != network->getMajorStepCount()) {
+            clearBatchMatrix(k);
+        }
+        if (network->beginMajorStep()) {
+            if (network->assembleBatchStep(timeStep)) {
+                mDecompInstances.push_back(k);
+            } else if (mLoadedMajorSteps[k] < 0) {
+                loadBatchMatrix(k);
+            }
+            mBatchInstances.push_back(k);
+        }
+    }
+
+    /// - Decompose the rebuilt matrices.
+    if (not mDecompInstances.empty()) {
+        decomposeBatch(failedInstance);
+    }
+
+    /// - Solve all instances' systems in the batch, and finish their steps.  The network
+    ///   capacitances are perturbed by each instance, using its copy of the decomposed matrix.
+    if (not mBatchInstances.empty()) {
+        const int numBatch = static_cast<int>(mBatchInstances.size());
+        for (int b = 0; b < numBatch; ++b) {
+            const int k       = mBatchInstances[b];
+            Gunns*    network = mInstances[k];
+            network->perturbNetworkCapacitances();
+            const double* source = network->mSourceVector;
+            for (int i = 0, ik = k; i < mNetworkSize; ++i, ik += numInstances) {
+                mSources[ik] = source[i];
+            }
+        }
+
+        const double solveStart = GunnsInfraFunctions::clockTime();
+        mSolver.Solve(&mMatrices[0], &mSources[0], &mPotentials[0], mNetworkSize, numInstances);
+        mSolveTime += GunnsInfraFunctions::clockTime() - solveStart;
+
+        const double solveShare = mSolveTime / numBatch;
+        for (int b = 0; b < numBatch; ++b) {
+            const int k       = mBatchInstances[b];
+            Gunns*    network = mInstances[k];
+            double*   potential = network->mPotentialVector;
+            for (int i = 0, ik = k; i < mNetworkSize; ++i, ik += numInstances) {
+                potential[i] = mPotentials[ik];
+            }
+            network->finishBatchStep(timeStep, solveShare);
+            mLoadedMajorSteps[k] = network->getMajorStepCount();
+            ++mBatchStepCount;
+        }
+    }
+
+    mStepTime = GunnsInfraFunctions::clockTime() - startTime;
+    for (int b = 0; b < static_cast<int>(mBatchInstances.size()); ++b) {
+        mInstances[mBatchInstances[b]]->mStepTime = mStepTime / numInstances;
+    }
+
+    if (failedInstance > -1) {
+        std::ostringstream msg;
+        msg << "numerical failure in instance " << failedInstance << ".";
+        GUNNS_ERROR(TsNumericalException, "Error Return Value", msg.str());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] failedInstance (--) Updated to the lowest instance whose decomposition failed.
+///
+/// @details  Gathers the rebuilt matrices of the instances to be decomposed into their own batch,
+///           decomposes them, and copies the results into the batch of decomposed matrices of all
+///           instances and back to each instance.  Instances whose decomposition failed end their
+///           major step and are removed from this step's batch solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::decomposeBatch(int& failedInstance)
+{
+    const int numInstances = getNumInstances();
+    const int numDecomp    = static_cast<int>(mDecompInstances.size());
+    const int matrixSize   = mNetworkSize * mNetworkSize;
+
+    for (int d = 0; d < numDecomp; ++d) {
+        const double* A = mInstances[mDecompInstances[d]]->mAdmittanceMatrix;
+        for (int i = 0, id = d; i < matrixSize; ++i, id += numDecomp) {
+            mDecompMatrices[id] = A[i];
+        }
+    }
+
+    const double startTime = GunnsInfraFunctions::clockTime();
+    mSolver.Decompose(&mDecompMatrices[0], mNetworkSize, numDecomp, &mFailedRows[0]);
+    mSolveTime += GunnsInfraFunctions::clockTime() - startTime;
+
+    for (int d = 0; d < numDecomp; ++d) {
+        const int k       = mDecompInstances[d];
+        Gunns*    network = mInstances[k];
+        if (mFailedRows[d] > -1) {
+            GUNNS_WARNING("decomposition failed at row " << mFailedRows[d] << " in instance "
+                          << k << ".");
+            network->failBatchStep();
+            clearBatchMatrix(k);
+            mBatchInstances.erase(std::find(mBatchInstances.begin(), mBatchInstances.end(), k));
+            if (failedInstance < 0 or k < failedInstance) {
+                failedInstance = k;
+            }
+            continue;
+        }
+        double* A = network->mAdmittanceMatrix;
+        for (int i = 0, id = d, ik = k; i < matrixSize; ++i, id += numDecomp, ik += numInstances) {
+            A[i]          = mDecompMatrices[id];
+            mMatrices[ik] = mDecompMatrices[id];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] instance (--) Index of the instance.
+///
+/// @details  Replaces the instance's batch matrix with the identity matrix, so that the batch
+///           solution stays finite for it, and marks it to be reloaded from the instance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::clearBatchMatrix(const int instance)
+{
+    const int numInstances = getNumInstances();
+    for (int row = 0, ik = instance; row < mNetworkSize; ++row) {
+        for (int col = 0; col < mNetworkSize; ++col, ik += numInstances) {
+            mMatrices[ik] = (row == col) ? 1.0 : 0.0;
+        }
+    }
+    mLoadedMajorSteps[instance] = -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] instance (--) Index of the instance.
+///
+/// @details  Copies the instance's decomposed admittance matrix into its batch matrix.  This is
+///           used for instances whose matrix wasn't rebuilt this step, but that were stepped or
+///           restored outside of the ensemble.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::loadBatchMatrix(const int instance)
+{
+    const int     numInstances = getNumInstances();
+    const int     matrixSize   = mNetworkSize * mNetworkSize;
+    const double* A            = mInstances[instance]->mAdmittanceMatrix;
+    for (int i = 0, ik = instance; i < matrixSize; ++i, ik += numInstances) {
+        mMatrices[ik] = A[i];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Marks the batch matrices of all instances to be reloaded from the instances on their
+///           next step.  Call this after changing an instance's decomposed matrix outside of the
+///           ensemble in a way that doesn't change its major step count.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::invalidate()
+{
+    for (int k = 0; k < static_cast<int>(mLoadedMajorSteps.size()); ++k) {
+        clearBatchMatrix(k);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] index (--) Index of the instance, in the order they were added.
+///
+/// @returns  Gunns* (--) Pointer to the instance.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Returns the instance at the given index.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+Gunns* GunnsEnsemble::getInstance(const int index) const
+{
+    if (index < 0 or index >= getNumInstances()) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "instance index out of range.");
+    }
+    return mInstances[index];
+}
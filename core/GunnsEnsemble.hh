@@ -0,0 +1,184 @@
+#ifndef GunnsEnsemble_EXISTS
+#define GunnsEnsemble_EXISTS
+
+/**
+@file
+@brief    GUNNS Network Ensemble declarations
+
+@defgroup  TSM_GUNNS_CORE_ENSEMBLE    GUNNS Network Ensemble
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Steps many instances of the same network together in one process, with their systems of
+   equations decomposed and solved as one batch, for Monte Carlo runs and scenario sweeps.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- ((All instances must have the same network size.  They are normally copies of the same network
+    initialized from the same config data, with different input data or run-time parameters.)
+   (Only linear networks in NORMAL mode are batched, see Gunns::isBatchEligible.  Other instances
+    are stepped by themselves.)
+   (The instances' links, nodes and matrix assembly are still their own, and are stepped one
+    instance at a time.  Only the decomposition and solution of the system are batched.))
+
+LIBRARY DEPENDENCY:
+- ((GunnsEnsemble.o))
+
+PROGRAMMERS:
+- ()
+
+@{
+*/
+
+#include <string>
+#include <vector>
+#include "math/linear_algebra/CholeskyLduBatch.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+
+class Gunns;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Network Ensemble
+///
+/// @details  This steps K instances of the same network in lock-step.  Each instance is started
+///           and assembles its system of equations as in Gunns::step, then the admittance matrices
+///           that need decomposing are decomposed together by CholeskyLduBatch, and the systems of
+///           all instances are solved together.  The batch stores element e of instance k at
+///           [e*K + k], so the kernels stream through the instances' matrices in one pass with
+///           their inner loops across the instances, rather than one instance at a time.  Then
+///           each instance finishes its step with its new potential vector.
+///
+///           The ensemble keeps the decomposed matrices of all instances in the batch, and
+///           decomposes only those whose matrix was rebuilt this step.  A decomposed matrix is also
+///           copied back to its instance, so the instances can still be stepped by themselves, and
+///           their snapshots include it.  An instance that has been stepped or restored outside of
+///           the ensemble is reloaded into the batch on the next ensemble step.  Call invalidate()
+///           after changing an instance's decomposed matrix by other means.
+///
+///           A failed decomposition or numerical error in one instance doesn't stop the others.
+///           The rest of the instances finish their step, then the error is thrown for the first
+///           failed instance.
+///
+///           Identical instances can share their constant data, such as a DefinedFluidProperties
+///           given to the fluid config data of all of them, so it isn't duplicated per instance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsEnsemble
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsEnsemble);
+    public:
+        /// @brief Default constructs this GUNNS Network Ensemble.
+        GunnsEnsemble(const std::string& name = "");
+        /// @brief Default destructs this GUNNS Network Ensemble.
+        virtual ~GunnsEnsemble();
+        /// @brief Adds the given initialized network instance to the ensemble.
+        void   addInstance(Gunns* network);
+        /// @brief Initializes the ensemble for its instances.
+        void   initialize();
+        /// @brief Steps all instances of the ensemble.
+        void   step(const double timeStep);
+        /// @brief Reloads the decomposed matrices of all instances into the batch next step.
+        void   invalidate();
+        /// @brief Returns the number of instances in the ensemble.
+        int    getNumInstances() const;
+        /// @brief Returns the instance at the given index.
+        Gunns* getInstance(const int index) const;
+        /// @brief Returns the total number of instance steps solved in the batch.
+        int    getBatchStepCount() const;
+        /// @brief Returns the total number of instance steps not eligible for the batch.
+        int    getSoloStepCount() const;
+        /// @brief Returns the duration of the batched decompositions and solutions last step.
+        double getSolveTime() const;
+        /// @brief Returns the duration of the last step.
+        double getStepTime() const;
+
+    protected:
+        std::string         mName;             /**< *o (--) trick_chkpnt_io(**) Instance name for H&S messages. */
+        std::vector<Gunns*> mInstances;        /**< ** (--) trick_chkpnt_io(**) The network instances. */
+        int                 mNetworkSize;      /**< *o (--) trick_chkpnt_io(**) Network size of all instances. */
+        CholeskyLduBatch    mSolver;           /**< ** (--) trick_chkpnt_io(**) Batched decomposition and solution. */
+        std::vector<double> mMatrices;         /**< ** (--) trick_chkpnt_io(**) Decomposed matrices of all instances, interleaved. */
+        std::vector<double> mSources;          /**< ** (--) trick_chkpnt_io(**) Source vectors of all instances, interleaved. */
+        std::vector<double> mPotentials;       /**< ** (--) trick_chkpnt_io(**) Potential vectors of all instances, interleaved. */
+        std::vector<double> mDecompMatrices;   /**< ** (--) trick_chkpnt_io(**) Matrices being decomposed this step, interleaved. */
+        std::vector<int>    mDecompInstances;  /**< ** (--) trick_chkpnt_io(**) Instances being decomposed this step. */
+        std::vector<int>    mFailedRows;       /**< ** (--) trick_chkpnt_io(**) Failed decomposition row of the instances decomposed this step. */
+        std::vector<int>    mBatchInstances;   /**< ** (--) trick_chkpnt_io(**) Instances being solved in the batch this step. */
+        std::vector<int>    mLoadedMajorSteps; /**< ** (--) trick_chkpnt_io(**) Instance major step count when its batch matrix was last loaded, or -1 if invalid. */
+        int                 mBatchStepCount;   /**< *o (--) trick_chkpnt_io(**) Total number of instance steps solved in the batch. */
+        int                 mSoloStepCount;    /**< *o (--) trick_chkpnt_io(**) Total number of instance steps not eligible for the batch. */
+        double              mSolveTime;        /**< *o (s)  trick_chkpnt_io(**) Duration of the batched decompositions and solutions last step. */
+        double              mStepTime;         /**< *o (s)  trick_chkpnt_io(**) Duration of the last step. */
+        bool                mInitFlag;         /**< *o (--) trick_chkpnt_io(**) The ensemble is initialized. */
+        /// @brief Replaces an instance's batch matrix with the identity until it is reloaded.
+        void   clearBatchMatrix(const int instance);
+        /// @brief Loads an instance's decomposed matrix into the batch.
+        void   loadBatchMatrix(const int instance);
+        /// @brief Decomposes the instances' matrices that were rebuilt this step.
+        void   decomposeBatch(int& failedInstance);
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsEnsemble(const GunnsEnsemble& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsEnsemble& operator =(const GunnsEnsemble& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The number of instances in the ensemble.
+///
+/// @details  Returns the number of instances that have been added to the ensemble.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsEnsemble::getNumInstances() const
+{
+    return static_cast<int>(mInstances.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Total number of instance steps solved in the batch.
+///
+/// @details  Returns the mBatchStepCount value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsEnsemble::getBatchStepCount() const
+{
+    return mBatchStepCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Total number of instance steps not eligible for the batch.
+///
+/// @details  Returns the mSoloStepCount value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsEnsemble::getSoloStepCount() const
+{
+    return mSoloStepCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (s) Duration of the batched decompositions and solutions last step.
+///
+/// @details  Returns the mSolveTime value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsEnsemble::getSolveTime() const
+{
+    return mSolveTime;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (s) Duration of the last step.
+///
+/// @details  Returns the mStepTime value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsEnsemble::getStepTime() const
+{
+    return mStepTime;
+}
+
+#endif
@@ -31,6 +31,8 @@ LIBRARY DEPENDENCY:
 #include "GunnsFluidCapacitor.hh"
 #include "GunnsFluidUtils.hh"
 #include <cmath>
+#include <typeinfo>
+#include "GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -253,6 +255,32 @@ void GunnsFluidCapacitor::restartModel()
     mEditVolume          = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           volume edit controls.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidCapacitor::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidLink::snapshotState(snapshot);
+
+    snapshot.sync(mCapacitance);
+    snapshot.sync(mDisablePressureCorrection);
+    snapshot.sync(mEditVolumeFlag);
+    snapshot.sync(mEditVolume);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidCapacitor.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidCapacitor::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidCapacitor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
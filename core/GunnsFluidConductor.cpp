@@ -26,6 +26,8 @@ PROGRAMMERS:
    ((Jason Harvey) (L3) (2011-02) (Design))
 */
 #include "GunnsFluidConductor.hh"
+#include <typeinfo>
+#include "GunnsSnapshot.hh"
 #include "math/MsMath.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
@@ -222,6 +224,35 @@ void GunnsFluidConductor::restartModel()
     mTuneDeltaT            = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.  This includes the
+///           link tuning controls.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidConductor::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidLink::snapshotState(snapshot);
+
+    snapshot.sync(mEffectiveConductivity);
+    snapshot.sync(mMaxConductivity);
+    snapshot.sync(mSystemConductance);
+    snapshot.sync(mTuneMode);
+    snapshot.sync(mTuneMassFlow);
+    snapshot.sync(mTuneVolFlow);
+    snapshot.sync(mTuneDeltaT);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidConductor.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidConductor::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidConductor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
@@ -18,6 +18,7 @@ LIBRARY DEPENDENCY:
 #include "math/MsMath.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
+#include <algorithm>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Default constructs this Fluid Distributed Interface data.
@@ -106,7 +107,8 @@ GunnsFluidDistributedIfConfigData::GunnsFluidDistributedIfConfigData(
     mDemandFilterConstB(0.75),
     mFluidSizesOverride(false),
     mNumFluidOverride(0),
-    mNumTcOverride(0)
+    mNumTcOverride(0),
+    mLagPrediction(false)
 {
     // nothing to do
 }
@@ -182,6 +184,9 @@ GunnsFluidDistributedIf::GunnsFluidDistributedIf()
     mDemandFlux            (0.0),
     mDemandFluxGain        (0.0),
     mSuppliedCapacitance   (0.0),
+    mLagPrediction         (false),
+    mPressurePredictor     (),
+    mCapacitancePredictor  (),
     mTempMassFractions     (0),
     mTempMoleFractions     (0),
     mTempTcMoleFractions   (0),
@@ -232,6 +237,9 @@ void GunnsFluidDistributedIf::initialize(const GunnsFluidDistributedIfConfigData
     mUseEnthalpy            = configData.mUseEnthalpy;
     mDemandOption           = configData.mDemandOption;
     mCapacitorLink          = configData.mCapacitorLink;
+    mLagPrediction          = configData.mLagPrediction;
+    mPressurePredictor.initialize();
+    mCapacitancePredictor.initialize();
 
     /// - Initialize from input data.
     if (inputData.mForceDemandMode) {
@@ -380,6 +388,8 @@ void GunnsFluidDistributedIf::restartModel()
     for (int i = 0; i < mNodes[0]->getFluidConfig()->mNTypes; ++i) {
         mTempMassFractions[i] = 0.0;
     }
+    mPressurePredictor.reset();
+    mCapacitancePredictor.reset();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -509,16 +519,27 @@ void GunnsFluidDistributedIf::processInputsDemand()
 {
     if (mInterface.isInDemandRole()) {
         if (mInterface.getFluidState(mWorkFluidState)) {
+            /// - Optionally extrapolate the Supply side pressure across the loop lag.
+            double pressure = mWorkFluidState.mPressure;
+            if (mLagPrediction) {
+                pressure = std::max(0.0, mPressurePredictor.predict(pressure,
+                        mInterface.mInData.mFrameCount, mInterface.getLoopLatency()));
+            }
             /// - Convert (Pa) to (kPa).
-            mSourcePressure = mWorkFluidState.mPressure * UnitConversion::KILO_PER_UNIT;
+            mSourcePressure = pressure * UnitConversion::KILO_PER_UNIT;
             inputFluid(mSourcePressure, mNodes[0]->getContent());
             mFluidState.setState(mNodes[0]->getContent());
-        } else {
-            /// - When we are in Demand mode but have not yet received Supply data from the other
-            ///   side, we hold the node at its initial state.
-            mSourcePressure = mNodes[0]->getPotential();
+            return;
         }
+        /// - When we are in Demand mode but have not yet received Supply data from the other
+        ///   side, we hold the node at its initial state.
+        mSourcePressure = mNodes[0]->getPotential();
     }
+
+    /// - The Supply side history is discarded whenever we aren't receiving Supply data, so it
+    ///   isn't extrapolated across role changes.
+    mPressurePredictor.reset();
+    mCapacitancePredictor.reset();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -671,10 +692,9 @@ double GunnsFluidDistributedIf::outputCapacitance()
     for (unsigned int i=0; i<mOtherIfs.size(); ++i) {
         const double otherSuppliedCap = mOtherIfs[i]->getSuppliedCapacitance();
         if (otherSuppliedCap > DBL_EPSILON) {    // they are in Demand mode
-            const double* ourNetCapDp = getNetCapDeltaPotential();
-            const double  otherDp     = ourNetCapDp[mOtherIfs[i]->getNodeMap()[0]];
+            const double otherDp = mNodes[0]->getNetCapDeltaPotential(mOtherIfs[i]->getNodeMap()[0]);
             if (otherDp > DBL_EPSILON) {         // they affect us thru the conductive network
-                const double ourDp = ourNetCapDp[mNodeMap[0]];
+                const double ourDp = mNodes[0]->getNetCapDeltaPotential(mNodeMap[0]);
                 const double ratio = otherDp / std::max(ourDp, DBL_EPSILON);
                 capacitance       -= (otherSuppliedCap * ratio);
             }
@@ -709,8 +729,16 @@ void GunnsFluidDistributedIf::step(const double dt)
         ///     limit_correct = fabs(Pd*gain/(dt*(1/Cs + 1/Cd)) - limit_wrong)
         mInterface.computeDemandLimit(dt, 0.0);
         mDemandFluxGain = mInterface.getDemandLimitGain();
-        if (mInterface.mOutData.mCapacitance > DBL_EPSILON and mInterface.mInData.mCapacitance > DBL_EPSILON) {
-            const double conductance = mDemandFluxGain * mInterface.mInData.mCapacitance / dt;
+
+        /// - Optionally extrapolate the Supply side capacitance across the loop lag.
+        double supplyCapacitance = mInterface.mInData.mCapacitance;
+        if (mLagPrediction) {
+            supplyCapacitance = std::max(0.0, mCapacitancePredictor.predict(supplyCapacitance,
+                    mInterface.mInData.mFrameCount, mInterface.getLoopLatency()));
+        }
+
+        if (mInterface.mOutData.mCapacitance > DBL_EPSILON and supplyCapacitance > DBL_EPSILON) {
+            const double conductance = mDemandFluxGain * supplyCapacitance / dt;
             /// - The default for this option = false follows the interface design standard, but our
             ///   GUNNS implementation sometimes restricts the resulting flow rate too much.  Use
             ///   this option = true to relax the stability in favor of increased flow rate.  You
@@ -722,7 +750,7 @@ void GunnsFluidDistributedIf::step(const double dt)
             }
         } else {
             mDemandFluxGain = 1.0;
-            mEffectiveConductivity = mDemandFluxGain * mInterface.mInData.mCapacitance / dt;
+            mEffectiveConductivity = mDemandFluxGain * supplyCapacitance / dt;
         }
         /// - Reduce the effective conductance from the blockage malfunction.
         if (mMalfBlockageFlag) {
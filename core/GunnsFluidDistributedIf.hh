@@ -86,6 +86,7 @@ class GunnsFluidDistributedIfConfigData : public GunnsFluidLinkConfigData
         bool                 mFluidSizesOverride;     /**< (1) trick_chkpnt_io(**) Override of fluid mixture sizes is active. */
         unsigned int         mNumFluidOverride;       /**< (1) trick_chkpnt_io(**) Number of primary fluid compounds override value. */
         unsigned int         mNumTcOverride;          /**< (1) trick_chkpnt_io(**) Number of trace compounds override value. */
+        bool                 mLagPrediction;          /**< (1) trick_chkpnt_io(**) Extrapolate the Supply side pressure and capacitance across the loop lag in Demand mode. */
         /// @brief Default constructs this Fluid Distributed Interface configuration data.
         GunnsFluidDistributedIfConfigData(
                 const std::string&   name           = "",
@@ -170,6 +171,12 @@ class GunnsFluidDistributedIfInputData : public GunnsFluidLinkInputData
 ///
 ///           Note that in interfaces with a large conductance, such as hatches, this works best
 ///           with a minLinearizationPotential of 1e-8 or less.
+///
+///           The optional lag prediction extrapolates the Supply side pressure and capacitance
+///           received in Demand mode across half the measured loop lag, to estimate their current
+///           values on the Supply side.  This can allow larger lags or lower interface frame rates
+///           for the same stability.  Only the Supply side's state is extrapolated, never the
+///           Demand side's flows, so this doesn't affect mass conservation.
 ///           \verbatim
 ///
 ///              Master-Side Network                                          Slave-Side Network
@@ -233,6 +240,9 @@ class GunnsFluidDistributedIf : public GunnsFluidLink
         double                                mDemandFlux;             /**<    (kg*mol/s) trick_chkpnt_io(**) Source molar flow added to the node in Supply mode. */
         double                                mDemandFluxGain;         /**<    (1)        trick_chkpnt_io(**) Demand mode flow factor due to lag frames. */
         double                                mSuppliedCapacitance;    /**<    (mol/Pa)   trick_chkpnt_io(**) Network capacitance applied to the Demand node from the Supply side. */
+        bool                                  mLagPrediction;          /**<    (1)        trick_chkpnt_io(**) Extrapolate the Supply side pressure and capacitance across the loop lag in Demand mode. */
+        Distributed2WayBusLagPredictor        mPressurePredictor;      /**<    (1)                            Extrapolates the Supply side pressure across the loop lag. */
+        Distributed2WayBusLagPredictor        mCapacitancePredictor;   /**<    (1)                            Extrapolates the Supply side capacitance across the loop lag. */
         double*                               mTempMassFractions;      /**< ** (1)        trick_chkpnt_io(**) Scratch array for mass-mole mixture conversions. */
         double*                               mTempMoleFractions;      /**< ** (1)        trick_chkpnt_io(**) Scratch array for bulk fluid mole fraction adjustments. */
         double*                               mTempTcMoleFractions;    /**< ** (1)        trick_chkpnt_io(**) Scratch array for trace compound mole fraction adjustments. */
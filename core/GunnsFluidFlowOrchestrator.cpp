@@ -183,8 +183,8 @@ bool GunnsFluidFlowOrchestrator::checkAllComplete(const double dt)
         const unsigned int link = getFirstIncompleteLink();
         mLinks[link]->transportFlows(dt);
         mLinkStates[link] = true;
-        GUNNS_WARNING("early overflow transport in link " << mLinks[link]->getName() <<
-                      ", conservation errors may result.");
+        GUNNS_WARNING_DEFERRED("early overflow transport in link %s, conservation errors may result.",
+                               mLinks[link]->getName());
     }
     mNumIncompleteLinks = incompleteLinks;
     return false;
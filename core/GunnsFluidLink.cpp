@@ -21,6 +21,7 @@ LIBRARY DEPENDENCY:
     (
      (GunnsBasicLink.o)
      (GunnsFluidNode.o)
+     (GunnsSnapshot.o)
      (software/exceptions/TsInitializationException.o)
      (software/exceptions/TsOutOfBoundsException.o)
     )
@@ -36,6 +37,8 @@ LIBRARY DEPENDENCY:
 #include <cfloat>
 
 #include "GunnsFluidLink.hh"
+#include <typeinfo>
+#include "GunnsSnapshot.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 
@@ -178,6 +181,33 @@ void GunnsFluidLink::restartModel()
     GunnsBasicLink::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot, including the
+///           internal fluid if the link has one.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidLink::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicLink::snapshotState(snapshot);
+
+    snapshot.sync(mFlowRate);
+    snapshot.sync(mVolFlowRate);
+    if (mInternalFluid) {
+        mInternalFluid->snapshotState(snapshot);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidLink.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidLink::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidLink);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] forcedOutflow (--) Indicates that this flow is leaving the node, but changes the
 ///                               mixture of the node (by only flowing out certain constituents), so
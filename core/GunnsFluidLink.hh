@@ -128,6 +128,12 @@ class GunnsFluidLink : public GunnsBasicLink
                                         const int  fromPort = 0,
                                         const int  toPort   = 1);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void     snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool     isSnapshotSupported() const;
+
     protected:
         /// @details  Pointer to the link internal fluid.  The internal fluid is optional - it is
         ///           only needed when a link needs to change the properties of the fluid passing
@@ -21,6 +21,7 @@ LIBRARY DEPENDENCY:
    (
     (GunnsBasicNode.o)
     (GunnsFluidUtils.o)
+    (GunnsSnapshot.o)
     (aspects/fluid/fluid/PolyFluid.o)
    )
 
@@ -33,6 +34,7 @@ PROGRAMMERS:
 */
 #include "GunnsFluidNode.hh"
 #include "GunnsFluidUtils.hh"
+#include "GunnsSnapshot.hh"
 #include "properties/FluidProperties.hh"
 #include <cmath>
 #include <cfloat>
@@ -280,6 +282,43 @@ void GunnsFluidNode::restart()
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this node's dynamic state in the given snapshot, including the
+///           content, inflow and outflow fluids and their trace compounds.  Unlike restart(), this
+///           restores the node exactly as it was, with no mass reset, since the node volume is part
+///           of the snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidNode::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsBasicNode::snapshotState(snapshot);
+
+    mContent.snapshotState(snapshot);
+    mInflow.snapshotState(snapshot);
+    mOutflow.snapshotState(snapshot);
+    const GunnsFluidTraceCompounds* traceCompounds = mContent.getTraceCompounds();
+    if (traceCompounds) {
+        snapshot.sync(mTcInflow.mState, traceCompounds->getConfig()->mNTypes);
+    }
+    snapshot.sync(mVolume);
+    snapshot.sync(mPreviousVolume);
+    snapshot.sync(mThermalCapacitance);
+    snapshot.sync(mCompression);
+    snapshot.sync(mInflowHeatFlux);
+    snapshot.sync(mNetHeatFlux);
+    snapshot.sync(mUndampedHeatFlux);
+    snapshot.sync(mThermalDampingMass);
+    snapshot.sync(mThermalDampingHeat);
+    snapshot.sync(mExpansionDeltaT);
+    snapshot.sync(mExpansionScaleFactor);
+    snapshot.sync(mPreviousPressure);
+    snapshot.sync(mPreviousTemperature);
+    snapshot.sync(mMassError);
+    snapshot.sync(mPressureCorrection);
+    snapshot.sync(mCorrectGain);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] volume (m3) Desired node volume
 ///
@@ -73,6 +73,9 @@ class GunnsFluidNode : public GunnsBasicNode
         /// @brief Restarts the node after a checkpoint load
         virtual void   restart();
 
+        /// @brief Saves or restores the node dynamic state in a network snapshot
+        virtual void   snapshotState(GunnsSnapshot& snapshot);
+
         /// @brief Initializes the node volume for the beginning of the run
         virtual void   initVolume(const double toVolume);
 
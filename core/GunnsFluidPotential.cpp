@@ -31,6 +31,8 @@ LIBRARY DEPENDENCY:
     )
 */
 #include "GunnsFluidPotential.hh"
+#include <typeinfo>
+#include "GunnsSnapshot.hh"
 #include "aspects/fluid/fluid/PolyFluid.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,6 +184,28 @@ void GunnsFluidPotential::restartModel()
     GunnsFluidConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidPotential::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidConductor::snapshotState(snapshot);
+
+    snapshot.sync(mSourcePressure);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidPotential.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidPotential::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidPotential);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
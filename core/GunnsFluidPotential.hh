@@ -119,6 +119,12 @@ class GunnsFluidPotential : public GunnsFluidConductor
         /// @brief Updates link for the frame
         virtual void step(const double dt);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
         /// @brief Sets the Source Pressure
         void setSourcePressure(const double toPressure);
 
@@ -31,6 +31,8 @@ LIBRARY DEPENDENCY:
     )
 */
 #include "GunnsFluidSource.hh"
+#include <typeinfo>
+#include "GunnsSnapshot.hh"
 #include "aspects/fluid/fluid/PolyFluid.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,6 +177,28 @@ void GunnsFluidSource::restartModel()
     GunnsFluidLink::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores this link's dynamic state in the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidSource::snapshotState(GunnsSnapshot& snapshot)
+{
+    GunnsFluidLink::snapshotState(snapshot);
+
+    snapshot.sync(mFlowDemand);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this object is exactly a GunnsFluidSource.
+///
+/// @details  Derived classes aren't supported unless they override this too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidSource::isSnapshotSupported() const
+{
+    return typeid(*this) == typeid(GunnsFluidSource);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
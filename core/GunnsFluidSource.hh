@@ -125,6 +125,12 @@ class GunnsFluidSource : public GunnsFluidLink
         /// @brief Transports the flows through the link between the nodes
         virtual void transportFlows(const double dt);
 
+        /// @brief Saves or restores the link dynamic state in a network snapshot
+        virtual void snapshotState(GunnsSnapshot& snapshot);
+
+        /// @brief Returns whether snapshotState includes all of the link's dynamic state
+        virtual bool isSnapshotSupported() const;
+
         /// @brief Sets the flow demand for the link
         virtual void setFlowDemand(const double toFlowDemand);
 
@@ -18,11 +18,16 @@ LIBRARY DEPENDENCY:
 #include "sim_services/Clock/include/clock_proto.h"
 #endif
 #include "sim_services/MonteCarlo/include/montecarlo_c_intf.h"
+#else
+#include <time.h>
 #endif
 
 /// @details Defines the static variable, useful for non-Trick implementations like testing.
 double GunnsInfraFunctions::mClockTime = 0.0;
 
+/// @details Defines the static variable, useful for non-Trick benchmarking.
+bool GunnsInfraFunctions::mUseWallClock = false;
+
 /// @details Defines the static variable, useful for non-Trick implementations like testing.
 bool GunnsInfraFunctions::mMcIsSlave = false;
 
@@ -39,13 +44,21 @@ std::vector<double> GunnsInfraFunctions::mMcWrite = GunnsInfraFunctions::makeEmp
 /// @returns  double  (s)  A clock time value.
 ///
 /// @details  In the Trick environment, returns the Trick's clock_time() value converted to units of
-///           seconds.  In non-Trick environments, returns the value of mClockTime.
+///           seconds.  In non-Trick environments, returns the value of mClockTime, or if
+///           mUseWallClock is set, the system monotonic clock in seconds.  The wall clock option
+///           lets Trick-less benchmarks use the solver's step & solve time outputs, while unit
+///           tests keep the deterministic mClockTime default.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 double GunnsInfraFunctions::clockTime()
 {
 #ifndef no_TRICK_ENV
     return clock_time() / 1000000.0;
 #else  // non-Trick
+    if (mUseWallClock) {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<double>(ts.tv_sec) + 1.0E-9 * static_cast<double>(ts.tv_nsec);
+    }
     return mClockTime;
 #endif
 }
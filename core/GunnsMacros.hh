@@ -330,6 +330,40 @@ PROGRAMMERS:
     hsSendMsg(gunnsMsg); \
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]   format    const char*     The printf-style format of the text, a string literal.
+/// @param[in]   args      ...             The arguments used by the format.
+///
+/// @details  This macro logs the same H&S warning message as GUNNS_WARNING, but for use in code that
+///           runs every frame.  Only the format and the raw argument values are recorded on the
+///           calling thread, and the text is formatted later by the H&S output thread, so the call
+///           doesn't build a stream or allocate memory.  String arguments must be passed as char*,
+///           and are copied.
+///
+/// @par      Example:
+/// @code
+///           GUNNS_WARNING_DEFERRED("failed to converge in %d iterations.", iterations);
+/// @endcode
+/// @hideinitializer
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#define GUNNS_WARNING_DEFERRED(format, args...) \
+{ \
+    hsSendDeferredMsg(TS_HS_WARNING, TS_HS_GUNNS, "%s " format, mName.c_str(), ##args); \
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]   format    const char*     The printf-style format of the text, a string literal.
+/// @param[in]   args      ...             The arguments used by the format.
+///
+/// @details  This macro logs the same H&S info message as GUNNS_INFO, with the text formatted later
+///           by the H&S output thread.  See GUNNS_WARNING_DEFERRED.
+/// @hideinitializer
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#define GUNNS_INFO_DEFERRED(format, args...) \
+{ \
+    hsSendDeferredMsg(TS_HS_INFO, TS_HS_GUNNS, "%s " format, mName.c_str(), ##args); \
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Macro to copy name.
 ///
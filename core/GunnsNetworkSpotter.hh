@@ -32,6 +32,8 @@ PROGRAMMERS:
 #include <string>
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 
+class GunnsSnapshot;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    GUNNS Network Spotter Configuration Data Class.
 ///
@@ -106,6 +108,8 @@ class GunnsNetworkSpotter
         virtual void stepPreSolver(const double dt)  = 0;
         /// @brief  GUNNS Network Spotter processing performed after the GUNNS solver step.
         virtual void stepPostSolver(const double dt) = 0;
+        /// @brief  Saves or restores the GUNNS Network Spotter dynamic state in a network snapshot.
+        virtual void snapshotState(GunnsSnapshot& snapshot);
         /// @brief  Returns whether the GUNNS Network Spotter has been successfully initialized & validated.
         bool         isInitialized() const;
         /// @brief  Returns the instance name of this GUNNS Network Spotter.
@@ -144,4 +148,15 @@ inline const std::string& GunnsNetworkSpotter::getName() const
     return mName;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored (not used).
+///
+/// @details  This default implementation does nothing, for spotters that have no dynamic state of
+///           their own.  Derived spotters with dynamic state should override this.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsNetworkSpotter::snapshotState(GunnsSnapshot& snapshot __attribute__((unused)))
+{
+    // nothing to do
+}
+
 #endif
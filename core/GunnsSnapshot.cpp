@@ -0,0 +1,160 @@
+/**
+@file
+@brief    GUNNS Network State Snapshot implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   ((simulation/hs/TsHsMsg.o)
+    (software/exceptions/TsInitializationException.o)
+    (software/exceptions/TsOutOfBoundsException.o))
+*/
+
+#include "core/GunnsSnapshot.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsOutOfBoundsException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name          (--) Instance name for H&S messages.
+/// @param[in] includeMatrix (--) Saves include the solver's decomposed admittance matrix.
+///
+/// @details  Default constructs this GUNNS Network State Snapshot, with an empty buffer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsSnapshot::GunnsSnapshot(const std::string& name, const bool includeMatrix)
+    :
+    mName(name),
+    mMode(IDLE),
+    mIncludeMatrix(includeMatrix),
+    mBuffer(),
+    mSize(0),
+    mPosition(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Network State Snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsSnapshot::~GunnsSnapshot()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Starts a new save at the start of the buffer.  The previous snapshot is discarded, but
+///           the buffer keeps its capacity.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSnapshot::beginSave()
+{
+    mMode     = SAVE;
+    mSize     = 0;
+    mPosition = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsInitializationException
+///
+/// @details  Starts restoring the saved snapshot from the start of the buffer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSnapshot::beginRestore()
+{
+    if (0 == mSize) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "there is no saved snapshot to restore.");
+    }
+    mMode     = RESTORE;
+    mPosition = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsOutOfBoundsException
+///
+/// @details  Finishes saving or restoring.  A save sets the snapshot size to the number of bytes
+///           written.  A restore checks that the entire snapshot was read, since anything left over
+///           means the snapshot doesn't match the network it is being restored into.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSnapshot::end()
+{
+    const Mode mode = mMode;
+    mMode = IDLE;
+    if (SAVE == mode) {
+        mSize = mPosition;
+    } else if (RESTORE == mode and mPosition != mSize) {
+        GUNNS_ERROR(TsOutOfBoundsException, "Input Argument Out Of Range",
+                    "the snapshot is larger than the network it was restored into.");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Abandons saving or restoring after an error, so the snapshot can be used again.  An
+///           abandoned save discards the incomplete snapshot, and an abandoned restore keeps it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSnapshot::abort()
+{
+    if (SAVE == mMode) {
+        mSize = 0;
+    }
+    mMode     = IDLE;
+    mPosition = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] buffer (--) Pointer to the snapshot bytes to copy.
+/// @param[in] size   (--) Number of bytes in the snapshot.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Copies the given bytes into the buffer as the saved snapshot, such as one that was
+///           saved by an identical network and copied from its getBuffer().
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSnapshot::setBuffer(const unsigned char* buffer, const std::size_t size)
+{
+    if (IDLE != mMode) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "can't replace the buffer during a save or restore.");
+    }
+    if (size > 0 and not buffer) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "null buffer pointer.");
+    }
+    if (size > mBuffer.size()) {
+        mBuffer.resize(size);
+    }
+    if (size > 0) {
+        std::memcpy(&mBuffer[0], buffer, size);
+    }
+    mSize     = size;
+    mPosition = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] data  (--) Pointer to the state bytes to save or restore.
+/// @param[in]     bytes (--) Number of bytes to save or restore.
+///
+/// @throws   TsInitializationException, TsOutOfBoundsException
+///
+/// @details  In SAVE mode, copies the given bytes to the end of the buffer, growing it if needed.
+///           In RESTORE mode, copies the next bytes from the buffer to the given data.  Restoring
+///           past the end of the snapshot means it doesn't match the network being restored.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSnapshot::copy(void* data, const std::size_t bytes)
+{
+    if (SAVE == mMode) {
+        if (mPosition + bytes > mBuffer.size()) {
+            mBuffer.resize(2 * (mPosition + bytes));
+        }
+        std::memcpy(&mBuffer[mPosition], data, bytes);
+    } else if (RESTORE == mMode) {
+        if (mPosition + bytes > mSize) {
+            GUNNS_ERROR(TsOutOfBoundsException, "Input Argument Out Of Range",
+                        "the snapshot is smaller than the network it was restored into.");
+        }
+        std::memcpy(data, &mBuffer[mPosition], bytes);
+    } else {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "sync called without beginSave or beginRestore.");
+    }
+    mPosition += bytes;
+}
@@ -0,0 +1,266 @@
+#ifndef GunnsSnapshot_EXISTS
+#define GunnsSnapshot_EXISTS
+
+/**
+@file
+@brief    GUNNS Network State Snapshot declarations
+
+@defgroup  TSM_GUNNS_CORE_SNAPSHOT    GUNNS Network State Snapshot
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Stores the dynamic state of a GUNNS network in a contiguous in-memory buffer, so the network can
+   be rolled back to it later without re-initialization.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- ((A snapshot can only be restored into the same network, or an identical copy of it initialized
+    from the same config data.  The buffer is binary, native to the machine that saved it.)
+   (Only the network's dynamic state is stored.  Config data, node mapping and malfunction
+    parameters set after the snapshot are not part of it, except where noted by the objects.)
+   (Networks can only be saved if all of their links support snapshots, otherwise saving throws.  A
+    link is supported only when its own class overrides isSnapshotSupported, since a derived class
+    may have dynamic state that its base class snapshotState doesn't include.  These library links
+    aren't supported yet: GunnsBasicExternalDemand, GunnsBasicExternalSupply,
+    GunnsBasicFlowController, GunnsBasicJumper, GunnsBasicSocket, GunnsDynSingleRigidStateDeriv,
+    GunnsElectConverterInput, GunnsElectConverterOutput, GunnsElectDistributedIf, GunnsElectIps,
+    GunnsElectPvRegConv, GunnsElectSelector, GunnsElectUserLoadSwitch2, GunnsElectricalResistor,
+    GunnsFluid3WayCheckValve, GunnsFluidAdsorber, GunnsFluidBalancedPrv, GunnsFluidBalloon,
+    GunnsFluidCheckValve, GunnsFluidCondensingHx, GunnsFluidCondensingHxSeparator,
+    GunnsFluidDistributedIf, GunnsFluidEqConductor, GunnsFluidEvaporation, GunnsFluidExternalDemand,
+    GunnsFluidExternalSupply, GunnsFluidFireSource, GunnsFluidFlowController, GunnsFluidHatch,
+    GunnsFluidHiFiOrifice, GunnsFluidHiFiValve, GunnsFluidHotAdsorber, GunnsFluidHotReactor,
+    GunnsFluidHxDynHtc, GunnsFluidJumper, GunnsFluidMetabolic, GunnsFluidMetabolic3,
+    GunnsFluidMultiSeparator, GunnsFluidPhaseChangeSource, GunnsFluidReactor,
+    GunnsFluidSelectiveMembrane, GunnsFluidSeparatorGas, GunnsFluidSeparatorLiquid,
+    GunnsFluidShadow, GunnsFluidSimpleH2Redox, GunnsFluidSimpleQd, GunnsFluidSimpleRocket,
+    GunnsFluidSocket, GunnsFluidSorptionBed, GunnsFluidSourceBoundary, GunnsFluidSublimator,
+    GunnsFluidTypeChangeConductor, GunnsGasCooledTurbine, GunnsResistiveLoad,
+    GunnsResistorPowerFunction, GunnsThermalPhaseChangeBattery, GunnsThermalRadiationEnclosure,
+    GunnsThermoelectricDevice, PowerBusElect.))
+
+LIBRARY DEPENDENCY:
+- ((GunnsSnapshot.o))
+
+PROGRAMMERS:
+- ()
+
+@{
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Network State Snapshot
+///
+/// @details  This is a contiguous byte buffer that network objects copy their dynamic state into
+///           when saving, and back out of when restoring.  Objects do both with the same
+///           snapshotState(GunnsSnapshot&) method, which calls sync() on each of its state terms in
+///           order: in SAVE mode sync() appends the term to the buffer, and in RESTORE mode it
+///           overwrites the term with the next value from the buffer.  So the save and restore
+///           orders can't get out of step with each other.
+///
+///           The buffer grows as needed on the first save, and keeps its capacity for later saves,
+///           so repeated snapshots of the same network don't allocate memory.
+///
+///           The snapshot optionally includes the solver's decomposed admittance matrix and island
+///           data, so that the restored network continues without re-building and decomposing the
+///           matrix.  Without it, the snapshot is smaller and the solver rebuilds the matrix on
+///           the next step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsSnapshot
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsSnapshot);
+    public:
+        /// @brief Enumeration of the snapshot modes.
+        enum Mode {
+            IDLE    = 0, ///< Not saving or restoring.
+            SAVE    = 1, ///< Copying state into the buffer.
+            RESTORE = 2  ///< Copying state out of the buffer.
+        };
+        /// @brief Default constructs this GUNNS Network State Snapshot.
+        GunnsSnapshot(const std::string& name = "", const bool includeMatrix = false);
+        /// @brief Default destructs this GUNNS Network State Snapshot.
+        virtual ~GunnsSnapshot();
+        /// @brief Starts saving state into the buffer, replacing its contents.
+        void                 beginSave();
+        /// @brief Starts restoring state from the start of the buffer.
+        void                 beginRestore();
+        /// @brief Finishes saving or restoring.
+        void                 end();
+        /// @brief Abandons saving or restoring after an error.
+        void                 abort();
+        /// @brief Saves or restores the given state term.
+        template <typename T>
+        void                 sync(T& value);
+        /// @brief Saves or restores the given array of state terms.
+        template <typename T>
+        void                 sync(T* values, const int count);
+        /// @brief Saves or restores the size and contents of the given vector of state terms.
+        template <typename T>
+        void                 sync(std::vector<T>& values);
+        /// @brief Returns the current mode.
+        Mode                 getMode() const;
+        /// @brief Returns whether the snapshot is being restored.
+        bool                 isRestoring() const;
+        /// @brief Sets whether saves include the solver's decomposed admittance matrix.
+        void                 setIncludeMatrix(const bool flag);
+        /// @brief Returns whether saves include the solver's decomposed admittance matrix.
+        bool                 getIncludeMatrix() const;
+        /// @brief Returns the size of the saved snapshot.
+        std::size_t          getSize() const;
+        /// @brief Returns the saved snapshot bytes.
+        const unsigned char* getBuffer() const;
+        /// @brief Replaces the saved snapshot with the given bytes.
+        void                 setBuffer(const unsigned char* buffer, const std::size_t size);
+
+    protected:
+        std::string                mName;          /**< *o (--) trick_chkpnt_io(**) Instance name for H&S messages. */
+        Mode                       mMode;          /**< ** (--) trick_chkpnt_io(**) The current mode. */
+        bool                       mIncludeMatrix; /**< ** (--) trick_chkpnt_io(**) Saves include the solver's decomposed admittance matrix. */
+        std::vector<unsigned char> mBuffer;        /**< ** (--) trick_chkpnt_io(**) The snapshot bytes, and spare capacity. */
+        std::size_t                mSize;          /**< ** (--) trick_chkpnt_io(**) Number of bytes in the saved snapshot. */
+        std::size_t                mPosition;      /**< ** (--) trick_chkpnt_io(**) Position of the next byte to save or restore. */
+        /// @brief Saves or restores the given bytes.
+        void                 copy(void* data, const std::size_t bytes);
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsSnapshot(const GunnsSnapshot& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsSnapshot& operator =(const GunnsSnapshot& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] value (--) The state term to save or restore.
+///
+/// @throws   TsInitializationException, TsOutOfBoundsException
+///
+/// @details  In SAVE mode, appends the given term to the buffer.  In RESTORE mode, sets the given
+///           term to the next value in the buffer.  The term must be plain data: numbers, bools,
+///           enumerations or structures of them, but not pointers or classes that own memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+inline void GunnsSnapshot::sync(T& value)
+{
+    copy(&value, sizeof(T));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] values (--) The array of state terms to save or restore.
+/// @param[in]     count  (--) The number of terms in the array.
+///
+/// @throws   TsInitializationException, TsOutOfBoundsException
+///
+/// @details  Saves or restores the given array of plain data terms as one block.  Null or empty
+///           arrays are skipped, so the same count must be given when restoring as when saving.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+inline void GunnsSnapshot::sync(T* values, const int count)
+{
+    if (values and count > 0) {
+        copy(values, sizeof(T) * static_cast<std::size_t>(count));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] values (--) The vector of state terms to save or restore.
+///
+/// @throws   TsInitializationException, TsOutOfBoundsException
+///
+/// @details  Saves or restores the size of the given vector of plain data terms, followed by its
+///           contents.  When restoring, the vector is resized to the saved size first, which only
+///           allocates memory if it has grown beyond its capacity.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+inline void GunnsSnapshot::sync(std::vector<T>& values)
+{
+    std::size_t size = values.size();
+    copy(&size, sizeof(size));
+    if (RESTORE == mMode) {
+        values.resize(size);
+    }
+    if (size > 0) {
+        copy(&values[0], sizeof(T) * size);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  Mode (--) The current mode.
+///
+/// @details  Returns the value of mMode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline GunnsSnapshot::Mode GunnsSnapshot::getMode() const
+{
+    return mMode;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the snapshot is being restored.
+///
+/// @details  Returns true in RESTORE mode, for objects that need to update derived terms after their
+///           state has been restored.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsSnapshot::isRestoring() const
+{
+    return RESTORE == mMode;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] flag (--) True to include the solver's decomposed admittance matrix in saves.
+///
+/// @details  Sets mIncludeMatrix to the given value.  This only affects later saves: a restore
+///           uses whatever the snapshot was saved with.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsSnapshot::setIncludeMatrix(const bool flag)
+{
+    mIncludeMatrix = flag;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if saves include the solver's decomposed admittance matrix.
+///
+/// @details  Returns the value of mIncludeMatrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsSnapshot::getIncludeMatrix() const
+{
+    return mIncludeMatrix;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  std::size_t (--) Number of bytes in the saved snapshot.
+///
+/// @details  Returns the value of mSize.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline std::size_t GunnsSnapshot::getSize() const
+{
+    return mSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  const unsigned char* (--) Pointer to the saved snapshot bytes, or null if empty.
+///
+/// @details  Returns a pointer to the start of the buffer, so the snapshot can be copied elsewhere,
+///           such as to another process with an identical network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const unsigned char* GunnsSnapshot::getBuffer() const
+{
+    if (mBuffer.empty()) {
+        return 0;
+    }
+    return &mBuffer[0];
+}
+
+#endif
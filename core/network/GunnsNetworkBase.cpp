@@ -8,7 +8,8 @@
 LIBRARY DEPENDENCY:
   ((simulation/hs/TsHsMsg.o)
    (software/exceptions/TsInitializationException.o)
-   (core/Gunns.o))
+   (core/Gunns.o)
+   (core/GunnsSnapshot.o))
 */
 
 #include <sstream>
@@ -16,6 +17,7 @@ LIBRARY DEPENDENCY:
 #include "simulation/hs/TsHsMsg.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "GunnsMutexLock.hh"
+#include "core/GunnsSnapshot.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  name     (--) Name of this network instance for H&S messages.
@@ -194,6 +196,70 @@ void GunnsNetworkBase::update(const double timeStep)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The snapshot to save the network state into.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Saves the dynamic state of the solver, nodes, links and spotters into the given
+///           snapshot, replacing its previous contents.  Unlike update, exceptions are passed on to
+///           the caller, so it knows the snapshot is no good.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsNetworkBase::saveSnapshot(GunnsSnapshot& snapshot)
+{
+    /// - In a super-network, this method returns without doing anything, since this solver isn't
+    ///   used.  The super-network saves this network's state instead.
+    if (netIsSubNetwork) return;
+
+    GunnsMutexLock lockHelper(netMutex);
+
+    if (netMutexEnabled) {
+        lockHelper.lock();
+    }
+
+    snapshot.beginSave();
+    try {
+        netSolver.snapshotState(snapshot);
+        snapshotSpotters(snapshot);
+    } catch (...) {
+        snapshot.abort();
+        throw;
+    }
+    snapshot.end();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The snapshot to restore the network state from.
+///
+/// @throws   TsInitializationException, TsOutOfBoundsException
+///
+/// @details  Restores the dynamic state of the solver, nodes, links and spotters from the given
+///           snapshot, which must have been saved from this network or an identical one.  The
+///           network continues from the restored state on the next update, without re-initializing.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsNetworkBase::restoreSnapshot(GunnsSnapshot& snapshot)
+{
+    /// - In a super-network, this method returns without doing anything, since this solver isn't
+    ///   used.  The super-network restores this network's state instead.
+    if (netIsSubNetwork) return;
+
+    GunnsMutexLock lockHelper(netMutex);
+
+    if (netMutexEnabled) {
+        lockHelper.lock();
+    }
+
+    snapshot.beginRestore();
+    try {
+        netSolver.snapshotState(snapshot);
+        snapshotSpotters(snapshot);
+    } catch (...) {
+        snapshot.abort();
+        throw;
+    }
+    snapshot.end();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  node (--) The node's number.
 ///
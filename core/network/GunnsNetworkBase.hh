@@ -37,6 +37,7 @@ PROGRAMMERS:
 
 // Forward declarations for pointer types
 class GunnsBasicLink;
+class GunnsSnapshot;
 class GunnsSuperNetworkBase;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,6 +74,10 @@ class GunnsNetworkBase
         virtual void restart();
         /// @brief  Network update task.
         virtual void update(const double timeStep);
+        /// @brief  Saves the network state to the given snapshot.
+        void         saveSnapshot(GunnsSnapshot& snapshot);
+        /// @brief  Restores the network state from the given snapshot.
+        void         restoreSnapshot(GunnsSnapshot& snapshot);
         /// @brief  Pure virtual initialize nodes function.
         virtual void initNodes(const std::string& name) = 0;
         /// @brief  Pure virtual initialize remaining network objects function.
@@ -81,6 +86,8 @@ class GunnsNetworkBase
         virtual void stepSpottersPre(const double timeStep);
         /// @brief  Update network spotters after the solver solution.
         virtual void stepSpottersPost(const double timeStep);
+        /// @brief  Saves or restores the network spotters state in a network snapshot.
+        virtual void snapshotSpotters(GunnsSnapshot& snapshot);
         /// @brief  Returns this network's fluid configuration.
         virtual const PolyFluidConfigData* getFluidConfig() const;
         /// @brief  Gets this network's drawing node number offset in the super-network.
@@ -155,6 +162,17 @@ inline void GunnsNetworkBase::stepSpottersPost(const double timeStep __attribute
     // nothing to do
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored (not used).
+///
+/// @details  This default implementation does nothing because spotters are optional and this base
+///           class has none.  This can be overridden by derived networks to snapshot their spotters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsNetworkBase::snapshotSpotters(GunnsSnapshot& snapshot __attribute__((unused)))
+{
+    // nothing to do
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @returns  NULL
 ///
@@ -12,7 +12,8 @@ LIBRARY DEPENDENCY:
    (core/Gunns.o)
    (core/network/GunnsNetworkBase.o)
    (core/network/GunnsMultiLinkConnector.o)
-   (core/GunnsBasicLink.o))
+   (core/GunnsBasicLink.o)
+   (core/GunnsSnapshot.o))
 */
 
 #include "GunnsSuperNetworkBase.hh"
@@ -22,6 +23,7 @@ LIBRARY DEPENDENCY:
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 #include "GunnsMutexLock.hh"
+#include "core/GunnsSnapshot.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  net   (--)  Pointer to the joint network.
@@ -480,3 +482,71 @@ void GunnsSuperNetworkBase::update(const double timeStep)
         hsSendMsg(msg);
     }
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The snapshot to save the super-network state into.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Saves the dynamic state of the super-network solver, nodes and links, and the spotters
+///           of all sub-networks, into the given snapshot, replacing its previous contents.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSuperNetworkBase::saveSnapshot(GunnsSnapshot& snapshot)
+{
+    GunnsMutexLock lockHelper(netMutex);
+
+    if (netMutexEnabled) {
+        lockHelper.lock();
+    }
+
+    snapshot.beginSave();
+    try {
+        snapshotState(snapshot);
+    } catch (...) {
+        snapshot.abort();
+        throw;
+    }
+    snapshot.end();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The snapshot to restore the super-network state from.
+///
+/// @throws   TsInitializationException, TsOutOfBoundsException
+///
+/// @details  Restores the dynamic state of the super-network solver, nodes and links, and the
+///           spotters of all sub-networks, from the given snapshot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSuperNetworkBase::restoreSnapshot(GunnsSnapshot& snapshot)
+{
+    GunnsMutexLock lockHelper(netMutex);
+
+    if (netMutexEnabled) {
+        lockHelper.lock();
+    }
+
+    snapshot.beginRestore();
+    try {
+        snapshotState(snapshot);
+    } catch (...) {
+        snapshot.abort();
+        throw;
+    }
+    snapshot.end();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored.
+///
+/// @details  Saves or restores the super-network solver, which includes all the sub-network nodes
+///           and links, then the sub-network spotters and this super-network's spotters, in the
+///           same order they are updated.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsSuperNetworkBase::snapshotState(GunnsSnapshot& snapshot)
+{
+    netSolver.snapshotState(snapshot);
+    for (unsigned int i=0; i<mSubnets.size(); ++i) {
+        mSubnets[i]->snapshotSpotters(snapshot);
+    }
+    snapshotSpotters(snapshot);
+}
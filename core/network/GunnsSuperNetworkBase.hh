@@ -41,6 +41,7 @@ PROGRAMMERS:
 class GunnsNetworkBase;
 class GunnsMultiLinkConnector;
 class GunnsBasicLink;
+class GunnsSnapshot;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    GUNNS Sub-Network Joint Class.
@@ -148,6 +149,10 @@ class GunnsSuperNetworkBase
         void     restart();
         /// @brief  Super-network update task.
         void     update(const double timeStep);
+        /// @brief  Saves the super-network state to the given snapshot.
+        void     saveSnapshot(GunnsSnapshot& snapshot);
+        /// @brief  Restores the super-network state from the given snapshot.
+        void     restoreSnapshot(GunnsSnapshot& snapshot);
         /// @brief  Returns this network's name.
         const std::string& getName() const;
         /// @brief  Returns whether the given sub-network is already added to this super-network.
@@ -194,6 +199,10 @@ class GunnsSuperNetworkBase
         virtual void stepSpottersPre(const double timeStep);
         /// @brief  Update super-network spotters after the solver solution.
         virtual void stepSpottersPost(const double timeStep);
+        /// @brief  Saves or restores the super-network spotters state in a network snapshot.
+        virtual void snapshotSpotters(GunnsSnapshot& snapshot);
+        /// @brief  Saves or restores the solver and all spotters state in a network snapshot.
+        void         snapshotState(GunnsSnapshot& snapshot);
         /// @brief  Removes contained objects from this super-network.
         void         empty();
         /// @brief  Returns the vector of sub-networks.
@@ -266,6 +275,17 @@ inline void GunnsSuperNetworkBase::stepSpottersPost(const double timeStep __attr
     // nothing to do
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] snapshot (--) The network snapshot being saved or restored (not used).
+///
+/// @details  This default implementation does nothing because generic super-networks have no
+///           spotters.  This can be overridden by custom super-networks to snapshot their spotters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsSuperNetworkBase::snapshotSpotters(GunnsSnapshot& snapshot __attribute__((unused)))
+{
+    // nothing to do
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Deletes any allocated nodes, clears out the node list and sub-networks vector.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
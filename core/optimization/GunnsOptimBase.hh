@@ -71,6 +71,8 @@ class GunnsOptimBase
         virtual ~GunnsOptimBase();
         /// @brief Sets the amount of detail output to the console.
         void setVerbosityLevel(const unsigned int level);
+        /// @brief Returns the number of runs per epoch that can be evaluated together.
+        virtual unsigned int getNumEpochRuns() const;
 
         /// @name    Pure-virtual functions.
         /// @{
@@ -125,4 +127,18 @@ inline void GunnsOptimBase::setVerbosityLevel(const unsigned int level)
     mVerbosityLevel = level;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int (--) The number of runs per epoch that can be evaluated together.
+///
+/// @details  Returns the number of consecutive runs, starting from the first run of each epoch,
+///           whose states don't depend on the costs of the other runs in the same group.  These
+///           can be evaluated in parallel, as long as their costs are then assigned in run order
+///           before the next update.  This default of 1 is always safe, and has all runs evaluated
+///           in series.  Derived optimizers override this to allow parallel evaluation.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned int GunnsOptimBase::getNumEpochRuns() const
+{
+    return 1;
+}
+
 #endif
@@ -129,6 +129,8 @@ class GunnsOptimGradientDescent : public GunnsOptimBase
         virtual void update();
         /// @brief Returns the number of individual MC Slave runs this Gradient Descent needs.
         virtual unsigned int getNumRuns() const;
+        /// @brief Returns the number of runs per epoch, the global state and its gradients.
+        virtual unsigned int getNumEpochRuns() const;
         /// @brief Returns the MC input variable state of the active state object to the MC manager.
         virtual const std::vector<double>* getState();
         /// @brief Stores the given cost to the state object associated with the given Slave run.
@@ -168,6 +170,20 @@ inline unsigned int GunnsOptimGradientDescent::getNumRuns() const
     return (mConfigData.mMaxEpoch * (2 * mConfigData.mNumVars + 1));
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int (--) The number of runs per epoch.
+///
+/// @details  Returns the number of runs in each epoch: the global state and its 2*N gradients.
+///           The gradient states only depend on the propagated global state, not its cost, so all
+///           of these can run in parallel.  The cost of the global state must still be assigned
+///           before the costs of its gradients, which is the case when costs are assigned in run
+///           order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned int GunnsOptimGradientDescent::getNumEpochRuns() const
+{
+    return (2 * mConfigData.mNumVars + 1);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @returns  std::vector<double>* (--) Pointer to the vector of the active state.
 ///
@@ -0,0 +1,343 @@
+/**
+@file     GunnsOptimMonteCarloInProcess.cpp
+@brief    GUNNS Optimization In-Process Monte Carlo Manager implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((GunnsOptimMonteCarlo.o))
+*/
+
+/// - GUNNS includes:
+#include "GunnsOptimMonteCarloInProcess.hh"
+
+/// - System includes:
+#include <iostream>
+#include <stdexcept>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Constructs the GUNNS Optimization Model Replica Interface.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsOptimModel::GunnsOptimModel()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Destructs the GUNNS Optimization Model Replica Interface.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsOptimModel::~GunnsOptimModel()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name (--) Instance name for console outputs.
+///
+/// @details  Constructs the In-Process Monte Carlo Manager Object.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsOptimMonteCarloInProcess::GunnsOptimMonteCarloInProcess(const std::string& name)
+    :
+    GunnsOptimMonteCarlo(name),
+    mWorkers(),
+    mNumSteps(0),
+    mStates(),
+    mCosts(),
+    mRunIds(),
+    mNumQueued(0),
+    mNextRun(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Destructs the In-Process Monte Carlo Manager Object.  The model replicas are owned by
+///           the caller and are not deleted.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsOptimMonteCarloInProcess::~GunnsOptimMonteCarloInProcess()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] model (--) Pointer to the model replica to add.
+///
+/// @throws   std::runtime_error
+///
+/// @details  Adds a worker for the given model replica.  Runs are evaluated in parallel on as many
+///           threads as there are replicas.  The first replica is evaluated on the thread that
+///           calls run().
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsOptimMonteCarloInProcess::addModel(GunnsOptimModel* model)
+{
+    if (not model) {
+        throw std::runtime_error(mName + " addModel given a null model.");
+    }
+    Worker newWorker;
+    newWorker.mManager = this;
+    newWorker.mModel   = model;
+    newWorker.mFailed  = false;
+    mWorkers.push_back(newWorker);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   std::runtime_error
+///
+/// @details  Runs the entire optimization.  This initializes the Master role and the optimizer,
+///           then for each epoch of the optimizer, gets the input states for all runs in the epoch,
+///           evaluates them in parallel on the model replicas, and assigns their costs to the
+///           optimizer in run order.  Finally the optimizer is updated and shut down, the same as
+///           by the Trick "monte_master_shutdown" job.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsOptimMonteCarloInProcess::run()
+{
+    if (not mOptimizer) {
+        throw std::runtime_error(mName + " has no optimizer.");
+    }
+
+    initMaster();
+    initWorkers();
+
+    /// - Never queue more runs than the optimizer can take costs for before its next update.
+    unsigned int epochRuns = mOptimizer->getNumEpochRuns();
+    if (epochRuns < 1) {
+        epochRuns = 1;
+    }
+
+    unsigned int remainingRuns = mOptimizer->getNumRuns();
+    while (remainingRuns > 0) {
+        const unsigned int numRuns = (remainingRuns < epochRuns) ? remainingRuns : epochRuns;
+        queueEpoch(numRuns);
+        evaluateEpoch();
+
+        /// - Assign the costs in run order, as they would come back from a single Slave.
+        for (unsigned int i=0; i<numRuns; ++i) {
+            mRunIdReturned = mRunIds.at(i);
+            if (mVerbosityLevel > 0) {
+                std::cout << mName << " run " << mRunIdReturned << " cost: " << mCosts.at(i)
+                          << std::endl;
+            }
+            mOptimizer->assignCost(mCosts.at(i), mRunId, mRunIdReturned);
+        }
+        remainingRuns -= numRuns;
+    }
+
+    updateMasterShutdown();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   std::runtime_error
+///
+/// @details  Maps the input, driver and output variables to each model replica's copies of them,
+///           and resets the worker error flags.  If the number of model steps was not set, it
+///           defaults to the length of the longest driver or output target trajectory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsOptimMonteCarloInProcess::initWorkers()
+{
+    if (mWorkers.empty()) {
+        throw std::runtime_error(mName + " has no models.");
+    }
+
+    if (0 == mNumSteps) {
+        for (unsigned int i=0; i<mDrivers.size(); ++i) {
+            if (mDrivers.at(i).mTrajectory.size() > mNumSteps) {
+                mNumSteps = static_cast<unsigned int>(mDrivers.at(i).mTrajectory.size());
+            }
+        }
+        for (unsigned int i=0; i<mOutputs.size(); ++i) {
+            if (mOutputs.at(i).mTargetTraj.size() > mNumSteps) {
+                mNumSteps = static_cast<unsigned int>(mOutputs.at(i).mTargetTraj.size());
+            }
+        }
+        if (0 == mNumSteps) {
+            throw std::runtime_error(mName + " number of model steps is zero.");
+        }
+    }
+
+    for (unsigned int w=0; w<mWorkers.size(); ++w) {
+        Worker& worker = mWorkers.at(w);
+        worker.mInputs.clear();
+        worker.mDrivers.clear();
+        worker.mOutputs.clear();
+        worker.mFailed = false;
+        worker.mError.clear();
+        for (unsigned int i=0; i<mInputs.size(); ++i) {
+            worker.mInputs.push_back(worker.mModel->getAddress(mInputs.at(i).mAddress));
+        }
+        for (unsigned int i=0; i<mDrivers.size(); ++i) {
+            worker.mDrivers.push_back(worker.mModel->getAddress(mDrivers.at(i).mAddress));
+        }
+        for (unsigned int i=0; i<mOutputs.size(); ++i) {
+            worker.mOutputs.push_back(worker.mModel->getAddress(mOutputs.at(i).mAddress));
+        }
+
+        /// - Throw if the model replica can't map any of the variables.
+        for (unsigned int i=0; i<worker.mInputs.size(); ++i) {
+            if (not worker.mInputs.at(i)) {
+                throw std::runtime_error(mName + " a model has no copy of input: " + mInputs.at(i).mName);
+            }
+        }
+        for (unsigned int i=0; i<worker.mDrivers.size(); ++i) {
+            if (not worker.mDrivers.at(i)) {
+                throw std::runtime_error(mName + " a model has no copy of a driver.");
+            }
+        }
+        for (unsigned int i=0; i<worker.mOutputs.size(); ++i) {
+            if (not worker.mOutputs.at(i)) {
+                throw std::runtime_error(mName + " a model has no copy of output: " + mOutputs.at(i).mName);
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] numRuns (--) The number of runs in the epoch.
+///
+/// @details  Gets the input states of the given number of runs from the optimizer, through the
+///           same updateMasterPre() as with Trick MC, so the original model's input variables and
+///           the optimizer's constraints on them are updated the same way.  The states are copied
+///           for the workers, along with their run ID's.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsOptimMonteCarloInProcess::queueEpoch(const unsigned int numRuns)
+{
+    mStates.resize(numRuns);
+    mCosts.assign(numRuns, 0.0);
+    mRunIds.resize(numRuns);
+
+    for (unsigned int run=0; run<numRuns; ++run) {
+        updateMasterPre();
+        mStates.at(run).resize(mInputs.size());
+        for (unsigned int i=0; i<mInputs.size(); ++i) {
+            mStates.at(run).at(i) = *mInputs.at(i).mAddress;
+        }
+        mRunIds.at(run) = mRunId;
+    }
+
+    mNumQueued = numRuns;
+    mNextRun   = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   std::runtime_error
+///
+/// @details  Starts a thread for each worker after the first, evaluates runs on the first worker in
+///           this thread, and waits for the other threads to finish.  The workers take runs from
+///           the epoch in order until there are none left, so a worker whose thread fails to start
+///           just leaves its share to the others.  Exceptions from the models are caught in their
+///           worker and re-thrown here.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsOptimMonteCarloInProcess::evaluateEpoch()
+{
+    std::vector<bool> started(mWorkers.size(), false);
+    for (unsigned int w=1; w<mWorkers.size(); ++w) {
+        started.at(w) = (0 == pthread_create(&mWorkers.at(w).mThread, 0, workerThread,
+                                             &mWorkers.at(w)));
+    }
+
+    evaluateRuns(mWorkers.at(0));
+
+    for (unsigned int w=1; w<mWorkers.size(); ++w) {
+        if (started.at(w)) {
+            pthread_join(mWorkers.at(w).mThread, 0);
+        }
+    }
+
+    for (unsigned int w=0; w<mWorkers.size(); ++w) {
+        if (mWorkers.at(w).mFailed) {
+            throw std::runtime_error(mName + " model run failed: " + mWorkers.at(w).mError);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] worker (--) The worker to evaluate runs on.
+///
+/// @details  Takes the next run of the current epoch and evaluates it on the given worker, until
+///           there are no runs left or a run throws.  Each run's cost is stored by its index in
+///           the epoch, so they are assigned in order regardless of which worker ran them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsOptimMonteCarloInProcess::evaluateRuns(Worker& worker)
+{
+    try {
+        for (;;) {
+            const unsigned int run = __atomic_fetch_add(&mNextRun, 1, __ATOMIC_RELAXED);
+            if (run >= mNumQueued) {
+                break;
+            }
+            mCosts.at(run) = evaluateRun(worker, mStates.at(run));
+        }
+    } catch (std::exception& e) {
+        worker.mFailed = true;
+        worker.mError  = e.what();
+    } catch (...) {
+        worker.mFailed = true;
+        worker.mError  = "unknown exception.";
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] worker (--) The worker to evaluate the run on.
+/// @param[in]     state  (--) The input variables state for the run.
+///
+/// @returns  double (--) The total cost of the run.
+///
+/// @details  Loads the input state into the worker's model replica and resets the model.  Then
+///           for each model step, drives the model driver variables, steps the model, and
+///           accumulates the cost of the outputs against their target trajectories, the same as
+///           updateSlaveInputs() and updateSlaveOutputs() in the Slave role.  Finally adds the
+///           cost of the outputs against their scalar targets, the same as updateSlavePost().
+///           This only uses the worker's own variables, so runs on different workers are
+///           independent.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsOptimMonteCarloInProcess::evaluateRun(Worker& worker, const std::vector<double>& state) const
+{
+    /// - The inputs are loaded before the reset so the model can initialize from them, like the
+    ///   Slave initializes from the inputs set by the Master.
+    for (unsigned int i=0; i<worker.mInputs.size(); ++i) {
+        *worker.mInputs.at(i) = state.at(i);
+    }
+    worker.mModel->reset();
+
+    double cost = 0.0;
+    for (unsigned int step=0; step<mNumSteps; ++step) {
+        for (unsigned int i=0; i<mDrivers.size(); ++i) {
+            if (step < mDrivers.at(i).mTrajectory.size()) {
+                *worker.mDrivers.at(i) = mDrivers.at(i).mTrajectory.at(step);
+            }
+        }
+
+        worker.mModel->step();
+
+        for (unsigned int i=0; i<mOutputs.size(); ++i) {
+            if (step < mOutputs.at(i).mTargetTraj.size() and not mOutputs.at(i).mIsScalarTarget) {
+                cost += computeCostFunction(*worker.mOutputs.at(i),
+                                            mOutputs.at(i).mTargetTraj.at(step),
+                                            mOutputs.at(i).mCostWeight);
+            }
+        }
+    }
+
+    for (unsigned int i=0; i<mOutputs.size(); ++i) {
+        if (mOutputs.at(i).mIsScalarTarget) {
+            cost += computeCostFunction(*worker.mOutputs.at(i),
+                                        mOutputs.at(i).mTargetScalar,
+                                        mOutputs.at(i).mCostWeight);
+        }
+    }
+    return cost;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] arg (--) Pointer to the worker to run.
+///
+/// @returns  void* (--) Always returns null.
+///
+/// @details  Thread entry point for a worker, evaluates runs from the current epoch on it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void* GunnsOptimMonteCarloInProcess::workerThread(void* arg)
+{
+    Worker* worker = static_cast<Worker*>(arg);
+    worker->mManager->evaluateRuns(*worker);
+    return 0;
+}
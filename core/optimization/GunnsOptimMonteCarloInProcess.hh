@@ -0,0 +1,167 @@
+#ifndef GunnsOptimMonteCarloInProcess_EXISTS
+#define GunnsOptimMonteCarloInProcess_EXISTS
+
+/**
+@file     GunnsOptimMonteCarloInProcess.hh
+@brief    GUNNS Optimization In-Process Monte Carlo Manager declarations
+
+@defgroup  TSM_GUNNS_CORE_OPTIM_MC_IN_PROCESS    GUNNS Optimization In-Process Monte Carlo Manager
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Refer to class details below.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- ((Only variables of type double are supported as model inputs, outputs, and driver inputs.)
+   (Each model replica must be independent of the others, so they can be stepped concurrently.))
+
+LIBRARY_DEPENDENCY:
+- ((GunnsOptimMonteCarloInProcess.o))
+
+PROGRAMMERS:
+- ()
+
+@{
+*/
+
+#include "core/optimization/GunnsOptimMonteCarlo.hh"
+#include <pthread.h>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Optimization Model Replica Interface
+///
+/// @details  This is the interface between the In-Process Monte Carlo Manager and one replica of
+///           the model being optimized.  Each replica is a separate, fully initialized instance of
+///           the model, such as a GUNNS network built and initialized from the same config data as
+///           the original.  The manager evaluates one run at a time on each replica, and different
+///           replicas run concurrently in different threads.
+///
+///           The manager's inputs, outputs and drivers are added with the addresses of the original
+///           model's variables, and each replica maps these to its own copy of the variable.  The
+///           input variables are loaded before reset() is called, so that the replica can
+///           initialize from them, and reset() must not overwrite them.
+///
+/// @note     This is a pure-virtual class and cannot be instantiated directly.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsOptimModel
+{
+    public:
+        /// @brief Constructs the GUNNS Optimization Model Replica Interface.
+        GunnsOptimModel();
+        /// @brief Destructs the GUNNS Optimization Model Replica Interface.
+        virtual ~GunnsOptimModel();
+
+        /// @name    Pure-virtual functions.
+        /// @{
+        /// @details These are the pure-virtual functions that must be implemented by a derived
+        ///          class.
+        /// @brief Resets the model replica to its initial conditions for the start of a run.
+        virtual void reset() = 0;
+        /// @brief Steps the model replica by one model step.
+        virtual void step() = 0;
+        /// @brief Returns this replica's copy of the given original model variable.
+        virtual double* getAddress(const double* original) = 0;
+        /// @}
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsOptimModel(const GunnsOptimModel&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsOptimModel& operator =(const GunnsOptimModel&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Optimization In-Process Monte Carlo Manager
+///
+/// @details  This runs an optimization without Trick Monte Carlo, by evaluating the optimizer's
+///           runs in this process on a set of model replicas, instead of in Trick MC Slave
+///           processes.  This avoids the per-run process startup and model initialization of the
+///           Slave runs, and the runs in each epoch of the optimizer are evaluated in parallel, one
+///           thread per model replica.
+///
+///           The inputs, outputs, drivers, optimizer and their trajectory data are set up the same
+///           as for the base Monte Carlo Manager, then the model replicas are added and run() does
+///           the entire optimization.  Each run loads the optimizer's input state into a replica,
+///           resets it, drives it along the driver trajectories for the number of model steps, and
+///           accumulates the same cost function as the Slave role.  After each epoch, the costs are
+///           assigned to the optimizer in run order.  So the optimizer sees the same sequence of
+///           calls as with Trick MC and a single Slave, and the results don't depend on the number
+///           of replicas.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsOptimMonteCarloInProcess : public GunnsOptimMonteCarlo
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsOptimMonteCarloInProcess);
+
+    public:
+        /// @brief Constructs the GUNNS In-Process Monte Carlo Manager object.
+        GunnsOptimMonteCarloInProcess(const std::string& name = "");
+        /// @brief Destructs the GUNNS In-Process Monte Carlo Manager object.
+        virtual ~GunnsOptimMonteCarloInProcess();
+        /// @brief Adds a model replica to evaluate runs on, one per thread.
+        void addModel(GunnsOptimModel* model);
+        /// @brief Sets the number of model steps in each run.
+        void setNumSteps(const unsigned int steps);
+        /// @brief Runs the entire optimization.
+        void run();
+
+    protected:
+        /// @brief Describes a worker thread and the model replica that it evaluates runs on.
+        struct Worker {
+            GunnsOptimMonteCarloInProcess* mManager; /**< ** (1) The manager this worker belongs to. */
+            GunnsOptimModel*               mModel;   /**< ** (1) The model replica. */
+            std::vector<double*>           mInputs;  /**< ** (1) Replica addresses of the input variables. */
+            std::vector<double*>           mDrivers; /**< ** (1) Replica addresses of the driver variables. */
+            std::vector<double*>           mOutputs; /**< ** (1) Replica addresses of the output variables. */
+            pthread_t                      mThread;  /**< ** (1) The thread running this worker. */
+            bool                           mFailed;  /**< ** (1) An exception was caught during a run. */
+            std::string                    mError;   /**< ** (1) The caught exception message. */
+        };
+        std::vector<Worker>               mWorkers;   /**< ** (1) trick_chkpnt_io(**) The worker threads and model replicas. */
+        unsigned int                      mNumSteps;  /**< *o (1) trick_chkpnt_io(**) Number of model steps in each run, or zero for the longest trajectory. */
+        std::vector<std::vector<double> > mStates;    /**< ** (1) trick_chkpnt_io(**) Input states of the runs in the current epoch. */
+        std::vector<double>               mCosts;     /**< ** (1) trick_chkpnt_io(**) Costs of the runs in the current epoch. */
+        std::vector<double>               mRunIds;    /**< ** (1) trick_chkpnt_io(**) Run ID's of the runs in the current epoch. */
+        unsigned int                      mNumQueued; /**< ** (1) trick_chkpnt_io(**) Number of runs in the current epoch. */
+        unsigned int                      mNextRun;   /**< ** (1) trick_chkpnt_io(**) Index of the next run to be taken by a worker. */
+        /// @brief Initializes the workers and the number of model steps.
+        void initWorkers();
+        /// @brief Gets the input states for the next epoch of runs from the optimizer.
+        void queueEpoch(const unsigned int numRuns);
+        /// @brief Evaluates the current epoch of runs on all workers.
+        void evaluateEpoch();
+        /// @brief Evaluates runs from the current epoch on the given worker until none are left.
+        void evaluateRuns(Worker& worker);
+        /// @brief Evaluates one run on the given worker and returns its cost.
+        double evaluateRun(Worker& worker, const std::vector<double>& state) const;
+        /// @brief Worker thread entry point.
+        static void* workerThread(void* arg);
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsOptimMonteCarloInProcess(const GunnsOptimMonteCarloInProcess&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsOptimMonteCarloInProcess& operator =(const GunnsOptimMonteCarloInProcess&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] steps (--) The number of model steps in each run.
+///
+/// @details  Sets mNumSteps to the given value.  Zero, the default, runs for the length of the
+///           longest driver or output target trajectory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsOptimMonteCarloInProcess::setNumSteps(const unsigned int steps)
+{
+    mNumSteps = steps;
+}
+
+#endif
@@ -141,6 +141,8 @@ class GunnsOptimParticleSwarm : public GunnsOptimBase
         virtual void update();
         /// @brief Returns the number of individual MC Slave runs this PSO needs.
         virtual unsigned int getNumRuns() const;
+        /// @brief Returns the number of runs per epoch, which is the number of swarm particles.
+        virtual unsigned int getNumEpochRuns() const;
         /// @brief Returns the MC input variable state of the active swarm particle to the MC manager.
         virtual const std::vector<double>* getState();
         /// @brief Stores the given cost to the swarm particle associated with the given Slave run.
@@ -194,6 +196,17 @@ inline unsigned int GunnsOptimParticleSwarm::getNumRuns() const
     return (mConfigData.mNumParticles * mConfigData.mMaxEpoch);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int (--) The number of runs per epoch.
+///
+/// @details  Returns the number of swarm particles.  The swarm is only propagated at the start of
+///           each epoch, so all particles in an epoch can be run in parallel.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned int GunnsOptimParticleSwarm::getNumEpochRuns() const
+{
+    return mConfigData.mNumParticles;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @returns  std::vector<double>* (--) Pointer to the vector of the active particle's current state.
 ///
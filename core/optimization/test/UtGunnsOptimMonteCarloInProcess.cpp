@@ -0,0 +1,456 @@
+///@copyright Copyright 2026 United States Government as represented by the Administrator of the
+///           National Aeronautics and Space Administration.  All Rights Reserved.
+
+#include "strings/UtResult.hh"
+
+#include "UtGunnsOptimMonteCarloInProcess.hh"
+#include "core/GunnsInfraFunctions.hh"
+#include "core/optimization/GunnsOptimGradientDescent.hh"
+#include "core/optimization/GunnsOptimParticleSwarm.hh"
+#include "core/optimization/GunnsOptimTest.hh"
+
+#include <cmath>
+#include <sstream>
+
+/// @details  Test identification number.
+int UtGunnsOptimMonteCarloInProcess::TEST_ID = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name (--) Instance name for H&S messages.
+///
+/// @details  Default constructs this test article.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+FriendlyGunnsOptimMonteCarloInProcess::FriendlyGunnsOptimMonteCarloInProcess(const std::string& name)
+    :
+    GunnsOptimMonteCarloInProcess(name)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this test article.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+FriendlyGunnsOptimMonteCarloInProcess::~FriendlyGunnsOptimMonteCarloInProcess()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  original (--) The original model this replicates, or null for the original itself.
+///
+/// @details  Constructs this test model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsOptimLagModel::UtGunnsOptimLagModel(const UtGunnsOptimLagModel* original)
+    :
+    GunnsOptimModel(),
+    mGain(0.0),
+    mDriver(0.0),
+    mOutput(0.0),
+    mInitial(0.0),
+    mResets(0),
+    mSteps(0),
+    mOriginal(original),
+    mThrows(false)
+{
+    if (not mOriginal) {
+        mOriginal = this;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Destructs this test model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsOptimLagModel::~UtGunnsOptimLagModel()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Resets the output to its initial value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsOptimLagModel::reset()
+{
+    mOutput = mInitial;
+    mResets++;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   std::runtime_error
+///
+/// @details  Lags the output towards the driver by the gain.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsOptimLagModel::step()
+{
+    if (mThrows) {
+        throw std::runtime_error("UtGunnsOptimLagModel test exception.");
+    }
+    mOutput += mGain * (mDriver - mOutput);
+    mSteps++;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  original (--) Address of the original model's variable.
+///
+/// @returns  double* (--) Address of this replica's copy of the variable, or null if none.
+///
+/// @details  Maps the original model's variables to this replica's.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double* UtGunnsOptimLagModel::getAddress(const double* original)
+{
+    if (original == &mOriginal->mGain) {
+        return &mGain;
+    } else if (original == &mOriginal->mDriver) {
+        return &mDriver;
+    } else if (original == &mOriginal->mOutput) {
+        return &mOutput;
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS optimization in-process monte carlo manager unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsOptimMonteCarloInProcess::UtGunnsOptimMonteCarloInProcess()
+    :
+    CppUnit::TestFixture(),
+    tName(""),
+    tArticle(0),
+    tOriginal(0),
+    tModels()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS optimization in-process monte carlo manager unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsOptimMonteCarloInProcess::~UtGunnsOptimMonteCarloInProcess()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsOptimMonteCarloInProcess::setUp()
+{
+    GunnsInfraFunctions::mMcIsSlave = false;
+
+    /// - Default construct the nominal test article and models.
+    tName     = "tArticle";
+    tArticle  = new FriendlyGunnsOptimMonteCarloInProcess(tName);
+    tOriginal = new UtGunnsOptimLagModel();
+    for (unsigned int i=0; i<NUM_MODELS; ++i) {
+        tModels[i] = new UtGunnsOptimLagModel(tOriginal);
+    }
+
+    /// - Increment the test identification number.
+    ++TEST_ID;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsOptimMonteCarloInProcess::tearDown()
+{
+    /// - Deletes for news (in reverse order) in setUp.
+    for (unsigned int i=0; i<NUM_MODELS; ++i) {
+        delete tModels[i];
+    }
+    delete tOriginal;
+    delete tArticle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  article   (--) The article to set up.
+/// @param[in]  numModels (--) The number of model replicas to add to the article.
+///
+/// @details  Adds the lag model gain input, output and driver to the given article, with a step
+///           driver and the output trajectory of the lag model for a gain of 0.3.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsOptimMonteCarloInProcess::setupLagModel(GunnsOptimMonteCarloInProcess* article,
+                                                    const unsigned int numModels)
+{
+    article->addInput("gain", &tOriginal->mGain, 0.05, 0.95);
+    article->addOutput("output", &tOriginal->mOutput);
+    article->addDriver(&tOriginal->mDriver);
+
+    double output = 0.0;
+    for (unsigned int i=0; i<20; ++i) {
+        output += 0.3 * (1.0 - output);
+        std::ostringstream driverRow;
+        std::ostringstream outputRow;
+        driverRow.precision(17);
+        outputRow.precision(17);
+        driverRow << i << "," << 1.0;
+        outputRow << i << "," << output;
+        article->addDriverDataRow(driverRow.str());
+        article->addOutputDataRow(outputRow.str());
+    }
+
+    for (unsigned int i=0; i<numModels; ++i) {
+        article->addModel(tModels[i]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS optimization in-process monte carlo manager default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsOptimMonteCarloInProcess::testDefaultConstruction()
+{
+    UT_RESULT_INITIAL("GUNNS Optimization Classes");
+
+    /// @test Default construction values.
+    FriendlyGunnsOptimMonteCarloInProcess* article = new FriendlyGunnsOptimMonteCarloInProcess(tName);
+
+    CPPUNIT_ASSERT(0     == article->mOptimizer);
+    CPPUNIT_ASSERT(tName == article->mName);
+    CPPUNIT_ASSERT(0     == article->mWorkers.size());
+    CPPUNIT_ASSERT(0     == article->mNumSteps);
+    CPPUNIT_ASSERT(0     == article->mStates.size());
+    CPPUNIT_ASSERT(0     == article->mCosts.size());
+    CPPUNIT_ASSERT(0     == article->mRunIds.size());
+    CPPUNIT_ASSERT(0     == article->mNumQueued);
+    CPPUNIT_ASSERT(0     == article->mNextRun);
+
+    delete article;
+
+    /// @test new/delete for code coverage.
+    GunnsOptimMonteCarloInProcess* article2 = new GunnsOptimMonteCarloInProcess();
+    delete article2;
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS optimization in-process monte carlo manager addModel and setNumSteps
+///           methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsOptimMonteCarloInProcess::testAddModel()
+{
+    UT_RESULT;
+
+    /// @test exception thrown for a null model.
+    CPPUNIT_ASSERT_THROW(tArticle->addModel(0), std::runtime_error);
+    CPPUNIT_ASSERT(0 == tArticle->mWorkers.size());
+
+    /// @test nominal models added.
+    tArticle->addModel(tModels[0]);
+    tArticle->addModel(tModels[1]);
+    CPPUNIT_ASSERT(2          == tArticle->mWorkers.size());
+    CPPUNIT_ASSERT(tModels[1] == tArticle->mWorkers.at(1).mModel);
+    CPPUNIT_ASSERT(tArticle   == tArticle->mWorkers.at(1).mManager);
+    CPPUNIT_ASSERT(false      == tArticle->mWorkers.at(1).mFailed);
+
+    /// @test setNumSteps.
+    tArticle->setNumSteps(42);
+    CPPUNIT_ASSERT(42 == tArticle->mNumSteps);
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS optimization in-process monte carlo manager run method with the test
+///           optimizer, which has one run per epoch.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsOptimMonteCarloInProcess::testRun()
+{
+    UT_RESULT;
+
+    setupLagModel(tArticle, NUM_MODELS);
+    tArticle->addOptimizer(GunnsOptimFactory::TEST);
+    GunnsOptimTest* optimizer = dynamic_cast<GunnsOptimTest*>(tArticle->mOptimizer);
+    CPPUNIT_ASSERT(0 != optimizer);
+    CPPUNIT_ASSERT(1 == optimizer->getNumEpochRuns());
+
+    /// @test run with the optimizer state at the true gain gives zero cost.
+    std::vector<double> state(1, 0.3);
+    optimizer->mNumRuns = 3;
+    optimizer->mState   = &state;
+    CPPUNIT_ASSERT_NO_THROW(tArticle->run());
+    CPPUNIT_ASSERT(20   == tArticle->mNumSteps);
+    CPPUNIT_ASSERT(1    == optimizer->mInitCounter);
+    CPPUNIT_ASSERT(4    == optimizer->mUpdateCounter);
+    CPPUNIT_ASSERT(1    == optimizer->mShutdownCounter);
+    CPPUNIT_ASSERT(2.0  == optimizer->mRunIdReturned);
+    CPPUNIT_ASSERT(2.0  == optimizer->mRunId);
+    CPPUNIT_ASSERT(1e-20 > optimizer->mCost);
+    CPPUNIT_ASSERT(0.3  == tOriginal->mGain);
+
+    /// @test all runs were evaluated once, each on a reset model.
+    unsigned int resets = 0;
+    unsigned int steps  = 0;
+    for (unsigned int i=0; i<NUM_MODELS; ++i) {
+        resets += tModels[i]->mResets;
+        steps  += tModels[i]->mSteps;
+    }
+    CPPUNIT_ASSERT(3  == resets);
+    CPPUNIT_ASSERT(60 == steps);
+
+    /// @test run with no optimizer state uses the original model's input, with verbose output.
+    std::cout << std::endl;
+    tArticle->setVerbosityLevel(1);
+    tOriginal->mGain  = 0.5;
+    optimizer->mState = 0;
+    optimizer->mNumRuns = 1;
+    CPPUNIT_ASSERT_NO_THROW(tArticle->run());
+
+    double expectedCost = 0.0;
+    double output       = 0.0;
+    double target       = 0.0;
+    for (unsigned int i=0; i<20; ++i) {
+        output += 0.5 * (1.0 - output);
+        target += 0.3 * (1.0 - target);
+        expectedCost += (output - target) * (output - target);
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedCost, optimizer->mCost, 1.0e-12);
+
+    /// @test a run with an explicit number of steps.
+    tArticle->setNumSteps(10);
+    CPPUNIT_ASSERT_NO_THROW(tArticle->run());
+    expectedCost = 0.0;
+    output       = 0.0;
+    target       = 0.0;
+    for (unsigned int i=0; i<10; ++i) {
+        output += 0.5 * (1.0 - output);
+        target += 0.3 * (1.0 - target);
+        expectedCost += (output - target) * (output - target);
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedCost, optimizer->mCost, 1.0e-12);
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS optimization in-process monte carlo manager run method exceptions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsOptimMonteCarloInProcess::testRunErrors()
+{
+    UT_RESULT;
+
+    /// @test exception thrown with no optimizer.
+    CPPUNIT_ASSERT_THROW(tArticle->run(), std::runtime_error);
+
+    /// @test exception thrown with no models.
+    tArticle->addOptimizer(GunnsOptimFactory::TEST);
+    GunnsOptimTest* optimizer = dynamic_cast<GunnsOptimTest*>(tArticle->mOptimizer);
+    optimizer->mNumRuns = 2;
+    CPPUNIT_ASSERT_THROW(tArticle->run(), std::runtime_error);
+
+    /// @test exception thrown with no trajectories or number of steps.
+    tArticle->addOutput("output", &tOriginal->mOutput, 1.0);
+    tArticle->addModel(tModels[0]);
+    CPPUNIT_ASSERT_THROW(tArticle->run(), std::runtime_error);
+
+    /// @test nominal scalar target cost with a number of steps.
+    tArticle->setNumSteps(5);
+    tOriginal->mGain = 0.5;
+    tArticle->addInput("gain", &tOriginal->mGain, 0.05, 0.95);
+    CPPUNIT_ASSERT_NO_THROW(tArticle->run());
+    CPPUNIT_ASSERT(1.0 == optimizer->mCost);
+    CPPUNIT_ASSERT(10  == tModels[0]->mSteps);
+
+    /// @test exception thrown when a model can't map a variable.
+    double unmapped = 0.0;
+    tArticle->addDriver(&unmapped);
+    CPPUNIT_ASSERT_THROW(tArticle->run(), std::runtime_error);
+
+    /// @test exception thrown by a model during a run is re-thrown.
+    FriendlyGunnsOptimMonteCarloInProcess article("article");
+    article.addOptimizer(GunnsOptimFactory::TEST);
+    dynamic_cast<GunnsOptimTest*>(article.mOptimizer)->mNumRuns = 2;
+    setupLagModel(&article, 2);
+    tModels[0]->mThrows = true;
+    tModels[1]->mThrows = true;
+    CPPUNIT_ASSERT_THROW(article.run(), std::runtime_error);
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS optimization in-process monte carlo manager run method with the
+///           particle swarm optimizer.  The results must be the same regardless of the number of
+///           model replicas.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsOptimMonteCarloInProcess::testParticleSwarm()
+{
+    UT_RESULT;
+
+    GunnsOptimParticleSwarmConfigData config;
+    config.mNumParticles     = 8;
+    config.mMaxEpoch         = 10;
+    config.mInertiaWeight    = 0.5;
+    config.mInertiaWeightEnd = 0.1;
+    config.mCognitiveCoeff   = 2.0;
+    config.mSocialCoeff      = 1.5;
+    config.mMaxVelocity      = 0.2;
+    config.mRandomSeed       = 42;
+    config.mInitDistribution = GunnsOptimParticleSwarmConfigData::RANDOM;
+
+    /// @test run with one model replica, all in series.
+    FriendlyGunnsOptimMonteCarloInProcess serial("serial");
+    setupLagModel(&serial, 1);
+    serial.addOptimizer(GunnsOptimFactory::PSO);
+    serial.mOptimizer->setConfigData(&config);
+    CPPUNIT_ASSERT(8 == serial.mOptimizer->getNumEpochRuns());
+    CPPUNIT_ASSERT_NO_THROW(serial.run());
+    CPPUNIT_ASSERT(80 == tModels[0]->mResets);
+
+    /// @test run with all model replicas in parallel gives the same final epoch.
+    setupLagModel(tArticle, NUM_MODELS);
+    tArticle->addOptimizer(GunnsOptimFactory::PSO);
+    tArticle->mOptimizer->setConfigData(&config);
+    CPPUNIT_ASSERT_NO_THROW(tArticle->run());
+    CPPUNIT_ASSERT(8 == tArticle->mCosts.size());
+    double bestCost = serial.mCosts.at(0);
+    for (unsigned int i=0; i<8; ++i) {
+        CPPUNIT_ASSERT(serial.mRunIds.at(i)        == tArticle->mRunIds.at(i));
+        CPPUNIT_ASSERT(serial.mCosts.at(i)         == tArticle->mCosts.at(i));
+        CPPUNIT_ASSERT(serial.mStates.at(i).at(0)  == tArticle->mStates.at(i).at(0));
+        bestCost = std::min(bestCost, tArticle->mCosts.at(i));
+    }
+
+    /// @test the swarm has converged near the true gain.
+    CPPUNIT_ASSERT(1.0e-4 > bestCost);
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS optimization in-process monte carlo manager run method with the
+///           gradient descent optimizer, whose epochs include the global state and its gradients.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsOptimMonteCarloInProcess::testGradientDescent()
+{
+    UT_RESULT;
+
+    double initialState[1] = {0.6};
+    GunnsOptimGradientDescentConfigData config;
+    config.mNumVars         = 1;
+    config.mMaxEpoch        = 20;
+    config.mPropagationGain = 1.0;
+    config.mInitialState    = initialState;
+
+    setupLagModel(tArticle, NUM_MODELS);
+    tArticle->addOptimizer(GunnsOptimFactory::GRADIENT_DESCENT);
+    tArticle->mOptimizer->setConfigData(&config);
+    CPPUNIT_ASSERT(3 == tArticle->mOptimizer->getNumEpochRuns());
+
+    /// @test the first epoch's global state cost, for comparison with the final epoch.
+    double initialCost = 0.0;
+    double output      = 0.0;
+    double target      = 0.0;
+    for (unsigned int i=0; i<20; ++i) {
+        output += 0.6 * (1.0 - output);
+        target += 0.3 * (1.0 - target);
+        initialCost += (output - target) * (output - target);
+    }
+
+    /// @test the final global state has moved towards the true gain and improved the cost.
+    CPPUNIT_ASSERT_NO_THROW(tArticle->run());
+    CPPUNIT_ASSERT(3 == tArticle->mCosts.size());
+    CPPUNIT_ASSERT(0.6 > tArticle->mStates.at(0).at(0));
+    CPPUNIT_ASSERT(initialCost > tArticle->mCosts.at(0));
+
+    UT_PASS;
+}
@@ -0,0 +1,126 @@
+#ifndef UtGunnsOptimMonteCarloInProcess_EXISTS
+#define UtGunnsOptimMonteCarloInProcess_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_OPTIM_MONTE_CARLO_IN_PROCESS   GUNNS Optimization In-Process Monte Carlo Manager Unit Tests
+/// @ingroup  UT_GUNNS_OPTIM
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS optimization in-process monte carlo manager.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "core/optimization/GunnsOptimMonteCarloInProcess.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsOptimMonteCarloInProcess and befriend UtGunnsOptimMonteCarloInProcess.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsOptimMonteCarloInProcess : public GunnsOptimMonteCarloInProcess
+{
+    public:
+        friend class UtGunnsOptimMonteCarloInProcess;
+        FriendlyGunnsOptimMonteCarloInProcess(const std::string& name = "");
+        virtual ~FriendlyGunnsOptimMonteCarloInProcess();
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Test model replica for the in-process monte carlo manager.
+///
+/// @details  A first-order lag of the output towards the driver, at a rate set by the gain input.
+///           Replicas map the original model's variables to their own.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsOptimLagModel : public GunnsOptimModel
+{
+    public:
+        double                      mGain;     /**< (--) Input, the lag gain. */
+        double                      mDriver;   /**< (--) Driver, the value the output lags towards. */
+        double                      mOutput;   /**< (--) Output, the lagged value. */
+        double                      mInitial;  /**< (--) Initial output value. */
+        unsigned int                mResets;   /**< (--) Number of calls to reset. */
+        unsigned int                mSteps;    /**< (--) Number of calls to step. */
+        const UtGunnsOptimLagModel* mOriginal; /**< (--) The original model this replicates. */
+        bool                        mThrows;   /**< (--) Step throws an exception when true. */
+        /// @brief Constructs this test model, as a replica of the given original model.
+        UtGunnsOptimLagModel(const UtGunnsOptimLagModel* original = 0);
+        /// @brief Destructs this test model.
+        virtual ~UtGunnsOptimLagModel();
+        /// @brief Resets the output to its initial value.
+        virtual void reset();
+        /// @brief Lags the output towards the driver.
+        virtual void step();
+        /// @brief Maps the original model's variables to this replica's.
+        virtual double* getAddress(const double* original);
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        UtGunnsOptimLagModel(const UtGunnsOptimLagModel&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        UtGunnsOptimLagModel& operator =(const UtGunnsOptimLagModel&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS in-process monte carlo manager unit tests.
+///
+/// @details  This class provides the unit tests for the GUNNS in-process monte carlo manager
+///           within the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsOptimMonteCarloInProcess: public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GUNNS in-process monte carlo manager unit test.
+        UtGunnsOptimMonteCarloInProcess();
+        /// @brief    Default destructs this GUNNS in-process monte carlo manager unit test.
+        virtual ~UtGunnsOptimMonteCarloInProcess();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests the addModel and setNumSteps methods.
+        void testAddModel();
+        /// @brief    Tests the run method with the test optimizer.
+        void testRun();
+        /// @brief    Tests the run method exceptions.
+        void testRunErrors();
+        /// @brief    Tests the run method with the particle swarm optimizer.
+        void testParticleSwarm();
+        /// @brief    Tests the run method with the gradient descent optimizer.
+        void testGradientDescent();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsOptimMonteCarloInProcess);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testAddModel);
+        CPPUNIT_TEST(testRun);
+        CPPUNIT_TEST(testRunErrors);
+        CPPUNIT_TEST(testParticleSwarm);
+        CPPUNIT_TEST(testGradientDescent);
+        CPPUNIT_TEST_SUITE_END();
+        /// @brief    Number of model replicas in the nominal test article.
+        static const unsigned int NUM_MODELS = 4;
+        std::string                            tName;               /**< (--) Nominal name. */
+        FriendlyGunnsOptimMonteCarloInProcess* tArticle;            /**< (--) Pointer to the article under test. */
+        UtGunnsOptimLagModel*                  tOriginal;           /**< (--) The original test model. */
+        UtGunnsOptimLagModel*                  tModels[NUM_MODELS]; /**< (--) Test model replicas. */
+        static int                             TEST_ID;             /**< (--) Test identification number. */
+        /// @brief    Adds the lag model variables and trajectories to the given article.
+        void setupLagModel(GunnsOptimMonteCarloInProcess* article, const unsigned int numModels);
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        UtGunnsOptimMonteCarloInProcess(const UtGunnsOptimMonteCarloInProcess&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        UtGunnsOptimMonteCarloInProcess& operator =(const UtGunnsOptimMonteCarloInProcess&);
+};
+
+///@}
+
+#endif
@@ -14,6 +14,7 @@
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "UtGunnsOptimMonteCarlo.hh"
+#include "UtGunnsOptimMonteCarloInProcess.hh"
 #include "UtGunnsOptimParticleSwarm.hh"
 #include "UtGunnsOptimGradientDescent.hh"
 
@@ -29,6 +30,7 @@ int main(int argc, char** argv) {
     CppUnit::TextTestRunner runner;
 
     runner.addTest( UtGunnsOptimMonteCarlo::suite() );
+    runner.addTest( UtGunnsOptimMonteCarloInProcess::suite() );
     runner.addTest( UtGunnsOptimParticleSwarm::suite() );
     runner.addTest( UtGunnsOptimGradientDescent::suite() );
 
@@ -538,7 +538,7 @@ void UtGunns::testNominalInitialization()
     CPPUNIT_ASSERT_DOUBLES_EQUAL(689.475728, tNetwork.mMinorPotentialVector[2], tTolerance);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(689.475728, tNetwork.mMajorPotentialVector[2], tTolerance);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,        tNetwork.mSlavePotentialVector[2], tTolerance);
-    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,        tNetwork.mNetCapDeltaPotential[8], tTolerance);
+    CPPUNIT_ASSERT(0 == tNetwork.mNetCapDeltaPotential[2]);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(101.32501,  tNetwork.mPotentialVector[0],      tTolerance);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(689.475728, tNetwork.mPotentialVector[2],      tTolerance);
 
@@ -2165,12 +2165,42 @@ void UtGunns::testNetworkCapacitance()
     CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedCapacitance, tBasicNodes[0].getNetworkCapacitance(),        tTolerance);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,                 tBasicNodes[0].getNetworkCapacitanceRequest(), 0.0);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,                 tBasicNodes[1].getNetworkCapacitance(),        0.0);
-    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[3] == 0.0);
-    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[2] == 0.0);
-    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[1] >  0.0);
-    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[0] >  tNetwork.mNetCapDeltaPotential[1]);
-    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[0] == tBasicNodes[0].getNetCapDeltaPotential()[0]);
-    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[1] == tBasicNodes[0].getNetCapDeltaPotential()[1]);
+    CPPUNIT_ASSERT(0 != tNetwork.mNetCapDeltaPotential[0]);
+    CPPUNIT_ASSERT(0 == tNetwork.mNetCapDeltaPotential[1]);
+    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[0][2] == 0.0);
+    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[0][1] >  0.0);
+    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[0][0] >  tNetwork.mNetCapDeltaPotential[0][1]);
+    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[0][0] == tBasicNodes[0].getNetCapDeltaPotential(0));
+    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[0][1] == tBasicNodes[0].getNetCapDeltaPotential(1));
+    CPPUNIT_ASSERT(0.0 == tBasicNodes[1].getNetCapDeltaPotential(0));
+
+    /// - Verify the request mirror was reset with the node's request, and the node's capacitance
+    ///   is reset on the next step without a request.
+    CPPUNIT_ASSERT(&tNetwork.mNetCapRequests[0] == tBasicNodes[0].mNetCapRequestMirror);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tNetwork.mNetCapRequests[0], 0.0);
+    CPPUNIT_ASSERT(tNetwork.mNetCapIsSet[0]);
+    CPPUNIT_ASSERT(not tNetwork.mNetCapIsSet[1]);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tBasicNodes[0].getNetworkCapacitance(), 0.0);
+    CPPUNIT_ASSERT(not tNetwork.mNetCapIsSet[0]);
+
+    /// - Verify in island mode, only the node's island is stored, and entries from the previous
+    ///   island are cleared.
+    tNetwork.setIslandMode(Gunns::FIND);
+    tConductor1.setDefaultConductivity(0.0);
+    tBasicNodes[0].setNetworkCapacitanceRequest(1.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT_EQUAL(1, static_cast<int>(tNetwork.mNetCapDeltaIndices[0].size()));
+    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[0][0] > 0.0);
+    CPPUNIT_ASSERT(tNetwork.mNetCapDeltaPotential[0][1] == 0.0);
+
+    /// - Verify cleanup detaches the nodes from the request mirror before deleting it.
+    tNetwork.cleanup();
+    CPPUNIT_ASSERT(0 == tNetwork.mNetCapRequests);
+    CPPUNIT_ASSERT(0 == tBasicNodes[0].mNetCapRequestMirror);
+    CPPUNIT_ASSERT(0 == tBasicNodes[1].mNetCapRequestMirror);
+    tBasicNodes[0].setNetworkCapacitanceRequest(2.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, tBasicNodes[0].getNetworkCapacitanceRequest(), 0.0);
 
     std::cout << "... Pass";
 }
@@ -2516,6 +2546,101 @@ void UtGunns::testGpuDenseIslands()
     std::cout << "... Pass";
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the Gunns class adaptive decomposition mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testAdaptiveDecomposition()
+{
+    std::cout << "\n UtGunns ................ 36: testAdaptiveDecomposition .............";
+
+    setupNominalNonLinearNetwork(true);
+
+    /// - Verify invalid tolerances and refinement limit are rejected.
+    tNetwork.setAdaptiveDecomposition(true, -1.0, 1.0E-12, 10);
+    CPPUNIT_ASSERT(not tNetwork.mAdaptiveDecomposition);
+    tNetwork.setAdaptiveDecomposition(true,  1.0, 0.0,     10);
+    CPPUNIT_ASSERT(not tNetwork.mAdaptiveDecomposition);
+    tNetwork.setAdaptiveDecomposition(true,  1.0, 1.0E-12,  0);
+    CPPUNIT_ASSERT(not tNetwork.mAdaptiveDecomposition);
+    CPPUNIT_ASSERT(0 == tNetwork.mAdaptiveBaseMatrix);
+
+    /// - Enable the mode in the initialized network and verify the arrays are allocated.
+    tNetwork.setAdaptiveDecomposition(true,  1.0, 1.0E-12, 10);
+    CPPUNIT_ASSERT(tNetwork.mAdaptiveDecomposition);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,     tNetwork.mAdaptiveTolerance,       0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0E-12, tNetwork.mAdaptiveRefineTolerance, 0.0);
+    CPPUNIT_ASSERT_EQUAL(10, tNetwork.mAdaptiveMaxRefinements);
+    CPPUNIT_ASSERT(0 != tNetwork.mAdaptiveBaseMatrix);
+    CPPUNIT_ASSERT(0 != tNetwork.mAdaptiveBaseDecomp);
+    CPPUNIT_ASSERT(0 != tNetwork.mAdaptiveMatrix);
+
+    /// - Step the network and verify only the first minor step decomposed, later minor steps were
+    ///   refined from it, and the solution matches the nominal non-linear step.
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT_EQUAL(0, tNetwork.mConvergenceFailCount);
+    CPPUNIT_ASSERT_EQUAL(1, tNetwork.getDecompositionCount());
+    CPPUNIT_ASSERT_EQUAL(tNetwork.mMinorStepCount - 1, tNetwork.getAdaptiveSkipCount());
+    CPPUNIT_ASSERT_EQUAL(0, tNetwork.getAdaptiveFallbackCount());
+    CPPUNIT_ASSERT(tNetwork.mAdaptiveBaseValid);
+    CPPUNIT_ASSERT(tNetwork.mAdaptiveRefining);
+    CPPUNIT_ASSERT(0.0 < tNetwork.mAdaptiveLastChange);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.2499999999999994e+02, tNetwork.mPotentialVector[0], 1.0E-2);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.195580929517748e+02,  tNetwork.mPotentialVector[1], 1.0E-2);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.0993847627749395e+02, tNetwork.mPotentialVector[2], 1.0E-2);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 5.4969238138746974e+01, tNetwork.mPotentialVector[3], 1.0E-2);
+
+    /// - Verify the refined solution satisfies the current admittance matrix.
+    for (int row = 0; row < tNetwork.mNetworkSize; ++row) {
+        double sum = 0.0;
+        for (int col = 0; col < tNetwork.mNetworkSize; ++col) {
+            sum += tNetwork.mAdaptiveMatrix[row*tNetwork.mNetworkSize + col]
+                 * tNetwork.mPotentialVector[col];
+        }
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(tNetwork.mSourceVector[row], sum,
+                1.0E-12 * tNetwork.mSourceVector[0]);
+    }
+
+    /// - Verify restart invalidates the base decomposition.
+    tNetwork.restart();
+    CPPUNIT_ASSERT(not tNetwork.mAdaptiveBaseValid);
+    CPPUNIT_ASSERT(not tNetwork.mAdaptiveRefining);
+    CPPUNIT_ASSERT(tNetwork.mRebuild);
+
+    /// - Verify a refinement that can't converge falls back to decomposing the matrix, with a new
+    ///   load power to make the network iterate again.
+    tNetwork.setAdaptiveDecomposition(true, 1.0, DBL_EPSILON * DBL_EPSILON, 1);
+    tConstantLoad1.setPowerAndNominalPotential(250.0, 120.0);
+    const int decompositions = tNetwork.getDecompositionCount();
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(0 < tNetwork.getAdaptiveFallbackCount());
+    CPPUNIT_ASSERT(decompositions + 1 < tNetwork.getDecompositionCount());
+
+    /// - Verify the mode is not used in SOLVE island mode, and disabling the mode while refining
+    ///   forces a rebuild.
+    tNetwork.setAdaptiveDecomposition(true, 1.0, 1.0E-12, 10);
+    tNetwork.mAdaptiveRefining = true;
+    tNetwork.mRebuild          = false;
+    tNetwork.setAdaptiveDecomposition(false, 1.0, 1.0E-12, 10);
+    CPPUNIT_ASSERT(not tNetwork.mAdaptiveRefining);
+    CPPUNIT_ASSERT(tNetwork.mRebuild);
+
+    /// - Verify the tolerances & limit aren't validated or taken when disabling the mode.
+    tNetwork.setAdaptiveDecomposition(true,  1.0, 1.0E-12, 10);
+    tNetwork.setAdaptiveDecomposition(false, -1.0, 0.0, 0);
+    CPPUNIT_ASSERT(not tNetwork.mAdaptiveDecomposition);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,     tNetwork.mAdaptiveTolerance,       0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0E-12, tNetwork.mAdaptiveRefineTolerance, 0.0);
+    CPPUNIT_ASSERT_EQUAL(10, tNetwork.mAdaptiveMaxRefinements);
+    tNetwork.setAdaptiveDecomposition(true, 1.0, 1.0E-12, 10);
+    tNetwork.mIslandMode = Gunns::SOLVE;
+    const int skips = tNetwork.getAdaptiveSkipCount();
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT_EQUAL(skips, tNetwork.getAdaptiveSkipCount());
+    CPPUNIT_ASSERT(not tNetwork.mAdaptiveBaseValid);
+
+    std::cout << "... Pass";
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] converging (--) When true, network set up to be converging, otherwise non-converging.
 ///
@@ -148,6 +148,7 @@ class UtGunns : public CppUnit::TestFixture
         CPPUNIT_TEST(testGpuDense);
         CPPUNIT_TEST(testGpuSparseIslands);
         CPPUNIT_TEST(testGpuDenseIslands);
+        CPPUNIT_TEST(testAdaptiveDecomposition);
 
         CPPUNIT_TEST_SUITE_END();
 
@@ -266,6 +267,7 @@ class UtGunns : public CppUnit::TestFixture
         void testGpuDense();
         void testGpuSparseIslands();
         void testGpuDenseIslands();
+        void testAdaptiveDecomposition();
 };
 
 ///@}
@@ -104,6 +104,13 @@ void UtGunnsBasicNode::testInitialize()
     CPPUNIT_ASSERT(0                       == tNode.mNetCapDeltaPotential);
     CPPUNIT_ASSERT(false                   == tNode.mInitFlag);
 
+    /// @test re-initialization resets the solver's copy of the network capacitance request.
+    double mirror = 0.0;
+    tNode.setNetCapRequestMirror(&mirror);
+    tNode.setNetworkCapacitanceRequest(1.0);
+    tNode.initialize("TestNode", 1.0);
+    CPPUNIT_ASSERT(0.0                     == mirror);
+
     std::cout << "... Pass";
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,13 +189,28 @@ void UtGunnsBasicNode::testAccessMethods()
     CPPUNIT_ASSERT(7        == (*tPtr)[1]);
 
     /// @test the network capacitance delta potential array setter & getter methods.
+    CPPUNIT_ASSERT_EQUAL(0.0,         tNode.getNetCapDeltaPotential(1));
     const double netCapDp[4] = {0.1, 0.2, 0.3, 0.4};
     tNode.setNetCapDeltaPotential(netCapDp);
+    CPPUNIT_ASSERT_EQUAL(netCapDp[1], tNode.getNetCapDeltaPotential(1));
+    CPPUNIT_ASSERT_EQUAL(0.0,         tNode.getNetCapDeltaPotential(-1));
     CPPUNIT_ASSERT_EQUAL(netCapDp[0], tNode.getNetCapDeltaPotential()[0]);
     CPPUNIT_ASSERT_EQUAL(netCapDp[1], tNode.getNetCapDeltaPotential()[1]);
     CPPUNIT_ASSERT_EQUAL(netCapDp[2], tNode.getNetCapDeltaPotential()[2]);
     CPPUNIT_ASSERT_EQUAL(netCapDp[3], tNode.getNetCapDeltaPotential()[3]);
 
+    /// @test the network capacitance request mirror is loaded and kept coherent.
+    double mirror = 0.0;
+    tNode.setNetworkCapacitanceRequest(2.0);
+    tNode.setNetCapRequestMirror(&mirror);
+    CPPUNIT_ASSERT(&mirror == tNode.mNetCapRequestMirror);
+    CPPUNIT_ASSERT_EQUAL(2.0, mirror);
+    tNode.setNetworkCapacitanceRequest(3.0);
+    CPPUNIT_ASSERT_EQUAL(3.0, mirror);
+    tNode.setNetCapRequestMirror(0);
+    tNode.setNetworkCapacitanceRequest(4.0);
+    CPPUNIT_ASSERT_EQUAL(3.0, mirror);
+
     std::cout << "... Pass";
 }
 
@@ -303,6 +325,8 @@ void UtGunnsBasicNode::testRestart()
     tNode.mNetFlux                   = 3.0;
     tNode.mFluxThrough               = 4.0;
     tNode.mNetworkCapacitanceRequest = 5.0;
+    double mirror = 5.0;
+    tNode.mNetCapRequestMirror       = &mirror;
 
     tNode.restart();
 
@@ -311,6 +335,7 @@ void UtGunnsBasicNode::testRestart()
     CPPUNIT_ASSERT(0.0 == tNode.mNetFlux);
     CPPUNIT_ASSERT(0.0 == tNode.mFluxThrough);
     CPPUNIT_ASSERT(0.0 == tNode.mNetworkCapacitanceRequest);
+    CPPUNIT_ASSERT(0.0 == mirror);
     CPPUNIT_ASSERT(0   == tNode.mIslandVector);
 
     std::cout << "... Pass";
@@ -0,0 +1,434 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+ ((core/GunnsEnsemble.o))
+***************************************************************************************************/
+
+#include "UtGunnsEnsemble.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsNumericalException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] conductance (--) Conductance of the conductor link.
+/// @param[in] capacitance (--) Capacitance of the capacitor link.
+/// @param[in] numNodes    (--) Number of network nodes including Ground, 3 or 4.
+///
+/// @details  Constructs this test network with the given parameters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsEnsembleNetwork::UtGunnsEnsembleNetwork(const double conductance, const double capacitance,
+                                               const int numNodes)
+    :
+    mNetworkConfig("tNetwork", 1.0E-6, 1.0E-6, 1, 1),
+    mNetwork(),
+    mNodes(),
+    mNodeList(),
+    mLinks(),
+    mSourceConfig("tSource", &mNodeList, 2.0),
+    mSourceInput(false, 0.0, 100.0),
+    mSource(),
+    mConductorConfig("tConductor", &mNodeList, conductance),
+    mConductorInput(false, 0.0),
+    mConductor(),
+    mCapacitorConfig("tCapacitor", &mNodeList),
+    mCapacitorInput(false, 0.0, capacitance, 0.0),
+    mCapacitor()
+{
+    mNodeList.mNumNodes = numNodes;
+    mNodeList.mNodes    = mNodes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Initializes this test network.  The links are on nodes 0 and 1, and any node between
+///           them and Ground is isolated.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsembleNetwork::initialize()
+{
+    const int ground = mNodeList.mNumNodes - 1;
+    mNetwork.initializeNodes(mNodeList);
+    mSource.initialize   (mSourceConfig,    mSourceInput,    mLinks, ground, 0);
+    mConductor.initialize(mConductorConfig, mConductorInput, mLinks, 0,      1);
+    mCapacitor.initialize(mCapacitorConfig, mCapacitorInput, mLinks, 1,      ground);
+    mNetwork.initialize(mNetworkConfig, mLinks);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsEnsemble class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsEnsemble::UtGunnsEnsemble()
+    :
+    tArticle(0),
+    tName("tArticle"),
+    tInstances(),
+    tReferences(),
+    tTimeStep(0.1)
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsEnsemble class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsEnsemble::~UtGunnsEnsemble()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::tearDown()
+{
+    delete tArticle;
+    for (int k = 0; k < N_INSTANCES; ++k) {
+        delete tReferences[k];
+        delete tInstances[k];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.  Each instance has different link parameters, like
+///           the runs of a Monte Carlo set, and its reference network has the same parameters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::setUp()
+{
+    tArticle = new FriendlyGunnsEnsemble(tName);
+    for (int k = 0; k < N_INSTANCES; ++k) {
+        tInstances[k]  = new UtGunnsEnsembleNetwork(0.5 + 0.25 * k, 1.0 + 0.5 * k);
+        tReferences[k] = new UtGunnsEnsembleNetwork(0.5 + 0.25 * k, 1.0 + 0.5 * k);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Initializes the instance & reference networks, and the test article with the
+///           instances.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::initEnsemble()
+{
+    for (int k = 0; k < N_INSTANCES; ++k) {
+        tInstances[k]->initialize();
+        tReferences[k]->initialize();
+        tArticle->addInstance(&tInstances[k]->mNetwork);
+    }
+    tArticle->initialize();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Steps the test article, and each reference network by itself.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::stepAll()
+{
+    tArticle->step(tTimeStep);
+    for (int k = 0; k < N_INSTANCES; ++k) {
+        tReferences[k]->mNetwork.step(tTimeStep);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Checks that each instance's node potentials, link flux and solver counters match its
+///           reference network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::checkInstances()
+{
+    const double tolerance = 1.0E-12;
+    for (int k = 0; k < N_INSTANCES; ++k) {
+        const UtGunnsEnsembleNetwork* instance  = tInstances[k];
+        const UtGunnsEnsembleNetwork* reference = tReferences[k];
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(reference->mNodes[0].getPotential(),
+                                     instance->mNodes[0].getPotential(), tolerance);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(reference->mNodes[1].getPotential(),
+                                     instance->mNodes[1].getPotential(), tolerance);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(reference->mConductor.getFlux(),
+                                     instance->mConductor.getFlux(), tolerance);
+        CPPUNIT_ASSERT_EQUAL(reference->mNetwork.getMajorStepCount(),
+                             instance->mNetwork.getMajorStepCount());
+        CPPUNIT_ASSERT_EQUAL(reference->mNetwork.getMinorStepCount(),
+                             instance->mNetwork.getMinorStepCount());
+        CPPUNIT_ASSERT_EQUAL(reference->mNetwork.getDecompositionCount(),
+                             instance->mNetwork.getDecompositionCount());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests default construction of the GunnsEnsemble class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsEnsemble ........ 01: testDefaultConstruction ...............";
+
+    CPPUNIT_ASSERT(tName == tArticle->mName);
+    CPPUNIT_ASSERT(0 == tArticle->getNumInstances());
+    CPPUNIT_ASSERT(0 == tArticle->mNetworkSize);
+    CPPUNIT_ASSERT(tArticle->mMatrices.empty());
+    CPPUNIT_ASSERT(tArticle->mSources.empty());
+    CPPUNIT_ASSERT(tArticle->mPotentials.empty());
+    CPPUNIT_ASSERT(tArticle->mDecompMatrices.empty());
+    CPPUNIT_ASSERT(tArticle->mDecompInstances.empty());
+    CPPUNIT_ASSERT(tArticle->mFailedRows.empty());
+    CPPUNIT_ASSERT(tArticle->mBatchInstances.empty());
+    CPPUNIT_ASSERT(tArticle->mLoadedMajorSteps.empty());
+    CPPUNIT_ASSERT(0   == tArticle->getBatchStepCount());
+    CPPUNIT_ASSERT(0   == tArticle->getSoloStepCount());
+    CPPUNIT_ASSERT(0.0 == tArticle->getSolveTime());
+    CPPUNIT_ASSERT(0.0 == tArticle->getStepTime());
+    CPPUNIT_ASSERT(not tArticle->mInitFlag);
+
+    /// - Test new/delete for code coverage.
+    GunnsEnsemble* testArticle = new GunnsEnsemble();
+    delete testArticle;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests initialization of the GunnsEnsemble class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::testInitialize()
+{
+    std::cout << "\n UtGunnsEnsemble ........ 02: testInitialize ........................";
+
+    initEnsemble();
+
+    const int n = tInstances[0]->mNetwork.getNetworkSize();
+    CPPUNIT_ASSERT(tArticle->mInitFlag);
+    CPPUNIT_ASSERT(N_INSTANCES == tArticle->getNumInstances());
+    CPPUNIT_ASSERT(2 == n);
+    CPPUNIT_ASSERT(n == tArticle->mNetworkSize);
+    for (int k = 0; k < N_INSTANCES; ++k) {
+        CPPUNIT_ASSERT(&tInstances[k]->mNetwork == tArticle->getInstance(k));
+    }
+    CPPUNIT_ASSERT(n * n * N_INSTANCES == static_cast<int>(tArticle->mMatrices.size()));
+    CPPUNIT_ASSERT(n * n * N_INSTANCES == static_cast<int>(tArticle->mDecompMatrices.size()));
+    CPPUNIT_ASSERT(n * N_INSTANCES     == static_cast<int>(tArticle->mSources.size()));
+    CPPUNIT_ASSERT(n * N_INSTANCES     == static_cast<int>(tArticle->mPotentials.size()));
+    CPPUNIT_ASSERT(N_INSTANCES         == static_cast<int>(tArticle->mFailedRows.size()));
+    CPPUNIT_ASSERT(N_INSTANCES         == static_cast<int>(tArticle->mLoadedMajorSteps.size()));
+
+    /// - The batch matrices start as interleaved identity matrices to be loaded.
+    for (int k = 0; k < N_INSTANCES; ++k) {
+        CPPUNIT_ASSERT(-1  == tArticle->mLoadedMajorSteps[k]);
+        CPPUNIT_ASSERT(1.0 == tArticle->mMatrices[0 * N_INSTANCES + k]);
+        CPPUNIT_ASSERT(0.0 == tArticle->mMatrices[1 * N_INSTANCES + k]);
+        CPPUNIT_ASSERT(0.0 == tArticle->mMatrices[2 * N_INSTANCES + k]);
+        CPPUNIT_ASSERT(1.0 == tArticle->mMatrices[3 * N_INSTANCES + k]);
+    }
+
+    /// - Adding another instance requires initializing again.
+    UtGunnsEnsembleNetwork extra(1.0, 1.0);
+    extra.initialize();
+    tArticle->addInstance(&extra.mNetwork);
+    CPPUNIT_ASSERT(not tArticle->mInitFlag);
+    tArticle->initialize();
+    CPPUNIT_ASSERT(tArticle->mInitFlag);
+    CPPUNIT_ASSERT(N_INSTANCES + 1 == tArticle->getNumInstances());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests initialization exceptions of the GunnsEnsemble class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::testInitializeExceptions()
+{
+    std::cout << "\n UtGunnsEnsemble ........ 03: testInitializeExceptions ..............";
+
+    /// - Test exception on no instances.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(), TsInitializationException);
+    CPPUNIT_ASSERT(not tArticle->mInitFlag);
+
+    /// - Test exceptions on null and duplicate instances.
+    CPPUNIT_ASSERT_THROW(tArticle->addInstance(0), TsInitializationException);
+    tArticle->addInstance(&tInstances[0]->mNetwork);
+    CPPUNIT_ASSERT_THROW(tArticle->addInstance(&tInstances[0]->mNetwork),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(1 == tArticle->getNumInstances());
+
+    /// - Test exception on an uninitialized instance.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(), TsInitializationException);
+    CPPUNIT_ASSERT(not tArticle->mInitFlag);
+
+    /// - Test exception on instances with different network sizes.
+    tInstances[0]->initialize();
+    UtGunnsEnsembleNetwork larger(1.0, 1.0, 4);
+    larger.initialize();
+    CPPUNIT_ASSERT(3 == larger.mNetwork.getNetworkSize());
+    tArticle->addInstance(&larger.mNetwork);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(), TsInitializationException);
+    CPPUNIT_ASSERT(not tArticle->mInitFlag);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests stepping the instances in the batch, with a capacitance edit in one
+///           instance part way through, so that only that instance's matrix is decomposed again.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::testStep()
+{
+    std::cout << "\n UtGunnsEnsemble ........ 04: testStep ..............................";
+
+    initEnsemble();
+    for (int step = 0; step < N_STEPS; ++step) {
+        if (3 == step) {
+            tInstances[1]->mCapacitor.editCapacitance(true, 2.0);
+            tReferences[1]->mCapacitor.editCapacitance(true, 2.0);
+        }
+        stepAll();
+        checkInstances();
+        CPPUNIT_ASSERT(N_INSTANCES * (step + 1) == tArticle->getBatchStepCount());
+        CPPUNIT_ASSERT(0 == tArticle->getSoloStepCount());
+        CPPUNIT_ASSERT(tArticle->getStepTime()  >= tArticle->getSolveTime());
+        CPPUNIT_ASSERT(tArticle->getSolveTime() >= 0.0);
+
+        /// - Only the edited instance is decomposed on the edit step.
+        if (3 == step) {
+            CPPUNIT_ASSERT(1 == static_cast<int>(tArticle->mDecompInstances.size()));
+            CPPUNIT_ASSERT(1 == tArticle->mDecompInstances[0]);
+        } else if (0 < step) {
+            CPPUNIT_ASSERT(tArticle->mDecompInstances.empty());
+        }
+    }
+
+    /// - The decomposed matrices are copied back to the instances.
+    const int n = tInstances[0]->mNetwork.getNetworkSize();
+    for (int k = 0; k < N_INSTANCES; ++k) {
+        const double* A    = tInstances[k]->mNetwork.getAdmittanceMatrix();
+        const double* Aref = tReferences[k]->mNetwork.getAdmittanceMatrix();
+        for (int i = 0; i < n * n; ++i) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(Aref[i], A[i], 1.0E-12);
+            CPPUNIT_ASSERT(A[i] == tArticle->mMatrices[i * N_INSTANCES + k]);
+        }
+        CPPUNIT_ASSERT(tInstances[k]->mNetwork.getMajorStepCount()
+                       == tArticle->mLoadedMajorSteps[k]);
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests instances that aren't eligible for the batch, paused instances, and
+///           instances stepped outside of the ensemble.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::testSoloSteps()
+{
+    std::cout << "\n UtGunnsEnsemble ........ 05: testSoloSteps .........................";
+
+    initEnsemble();
+    stepAll();
+    checkInstances();
+
+    /// - An instance in SOLVE island mode is stepped by itself, and its batch matrix is cleared.
+    tInstances[2]->mNetwork.setIslandMode(Gunns::SOLVE);
+    tReferences[2]->mNetwork.setIslandMode(Gunns::SOLVE);
+    stepAll();
+    checkInstances();
+    CPPUNIT_ASSERT(1 == tArticle->getSoloStepCount());
+    CPPUNIT_ASSERT(2 * N_INSTANCES - 1 == tArticle->getBatchStepCount());
+    CPPUNIT_ASSERT(-1 == tArticle->mLoadedMajorSteps[2]);
+    CPPUNIT_ASSERT(1.0 == tArticle->mMatrices[0 * N_INSTANCES + 2]);
+    CPPUNIT_ASSERT(0.0 == tArticle->mMatrices[1 * N_INSTANCES + 2]);
+
+    /// - Back in the batch, its decomposed matrix is loaded without decomposing it again.
+    tInstances[2]->mNetwork.setIslandMode(Gunns::FIND);
+    tReferences[2]->mNetwork.setIslandMode(Gunns::FIND);
+    const int decompositions = tInstances[2]->mNetwork.getDecompositionCount();
+    stepAll();
+    checkInstances();
+    CPPUNIT_ASSERT(decompositions == tInstances[2]->mNetwork.getDecompositionCount());
+    CPPUNIT_ASSERT(tArticle->mDecompInstances.empty());
+    CPPUNIT_ASSERT(tInstances[2]->mNetwork.getMajorStepCount() == tArticle->mLoadedMajorSteps[2]);
+
+    /// - A paused instance isn't stepped and keeps its batch matrix.
+    tInstances[1]->mNetwork.setPauseMode();
+    tReferences[1]->mNetwork.setPauseMode();
+    const int majorSteps = tInstances[1]->mNetwork.getMajorStepCount();
+    stepAll();
+    checkInstances();
+    CPPUNIT_ASSERT(majorSteps == tInstances[1]->mNetwork.getMajorStepCount());
+    CPPUNIT_ASSERT(majorSteps == tArticle->mLoadedMajorSteps[1]);
+    CPPUNIT_ASSERT(2 == static_cast<int>(tArticle->mBatchInstances.size()));
+    tInstances[1]->mNetwork.setRunMode();
+    tReferences[1]->mNetwork.setRunMode();
+
+    /// - An instance stepped outside of the ensemble has its matrix reloaded, including a matrix
+    ///   that was decomposed outside of the ensemble.
+    tInstances[0]->mCapacitor.editCapacitance(true, 3.0);
+    tReferences[0]->mCapacitor.editCapacitance(true, 3.0);
+    tInstances[0]->mNetwork.step(tTimeStep);
+    tReferences[0]->mNetwork.step(tTimeStep);
+    for (int step = 0; step < 3; ++step) {
+        stepAll();
+        checkInstances();
+    }
+
+    /// - Invalidated matrices are reloaded.
+    tArticle->invalidate();
+    for (int k = 0; k < N_INSTANCES; ++k) {
+        CPPUNIT_ASSERT(-1 == tArticle->mLoadedMajorSteps[k]);
+    }
+    stepAll();
+    checkInstances();
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests that a failed decomposition in one instance lets the others finish
+///           their step before the exception is thrown, and that the instance recovers.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::testDecompositionFailure()
+{
+    std::cout << "\n UtGunnsEnsemble ........ 06: testDecompositionFailure ..............";
+
+    initEnsemble();
+    stepAll();
+    checkInstances();
+
+    /// - A negative capacitance makes the matrix of instance 1 not positive-definite.
+    tInstances[1]->mCapacitor.setCapacitance(-1.0);
+    CPPUNIT_ASSERT_THROW(tArticle->step(tTimeStep), TsNumericalException);
+    tReferences[0]->mNetwork.step(tTimeStep);
+    tReferences[2]->mNetwork.step(tTimeStep);
+    CPPUNIT_ASSERT(-1 == tArticle->mLoadedMajorSteps[1]);
+    CPPUNIT_ASSERT(2 == static_cast<int>(tArticle->mBatchInstances.size()));
+    CPPUNIT_ASSERT(2 * N_INSTANCES - 1 == tArticle->getBatchStepCount());
+    const double potential = tInstances[1]->mNodes[1].getPotential();
+
+    /// - The other instances finished their step.
+    for (int k = 0; k < N_INSTANCES; k += 2) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(tReferences[k]->mNodes[1].getPotential(),
+                                     tInstances[k]->mNodes[1].getPotential(), 1.0E-12);
+        CPPUNIT_ASSERT_EQUAL(tReferences[k]->mNetwork.getMajorStepCount(),
+                             tInstances[k]->mNetwork.getMajorStepCount());
+    }
+
+    /// - The failed instance rebuilds and recovers.
+    tInstances[1]->mCapacitor.setCapacitance(1.5);
+    CPPUNIT_ASSERT_NO_THROW(tArticle->step(tTimeStep));
+    CPPUNIT_ASSERT(1 == static_cast<int>(tArticle->mDecompInstances.size()));
+    CPPUNIT_ASSERT(1 == tArticle->mDecompInstances[0]);
+    CPPUNIT_ASSERT(tInstances[1]->mNodes[1].getPotential() > potential);
+    CPPUNIT_ASSERT(3 * N_INSTANCES - 1 == tArticle->getBatchStepCount());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests step and accessor exceptions of the GunnsEnsemble class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::testStepExceptions()
+{
+    std::cout << "\n UtGunnsEnsemble ........ 07: testStepExceptions ....................";
+
+    /// - Test exception on stepping before initialization.
+    CPPUNIT_ASSERT_THROW(tArticle->step(tTimeStep), TsInitializationException);
+
+    /// - Test exceptions on an invalid instance index.
+    initEnsemble();
+    CPPUNIT_ASSERT_THROW(tArticle->getInstance(-1),          TsInitializationException);
+    CPPUNIT_ASSERT_THROW(tArticle->getInstance(N_INSTANCES), TsInitializationException);
+
+    std::cout << "... Pass";
+}
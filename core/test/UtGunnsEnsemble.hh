@@ -0,0 +1,147 @@
+#ifndef UtGunnsEnsemble_EXISTS
+#define UtGunnsEnsemble_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_ENSEMBLE    Gunns Network Ensemble Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Network Ensemble class
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "core/Gunns.hh"
+#include "core/GunnsBasicCapacitor.hh"
+#include "core/GunnsBasicConductor.hh"
+#include "core/GunnsBasicNode.hh"
+#include "core/GunnsBasicPotential.hh"
+#include "core/GunnsEnsemble.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsEnsemble and befriend UtGunnsEnsemble.
+///
+/// @details  Class derived from the unit under test.  It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsEnsemble : public GunnsEnsemble
+{
+    public:
+        FriendlyGunnsEnsemble(const std::string& name = "") : GunnsEnsemble(name) {}
+        virtual ~FriendlyGunnsEnsemble() {}
+        friend class UtGunnsEnsemble;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Network Ensemble unit test network.
+///
+/// @details  A potential source charging a capacitor through a conductor, so the node potentials
+///           change every step.  An optional extra isolated node gives a different network size.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsEnsembleNetwork
+{
+    public:
+        /// @brief    Enumeration of the maximum number of network nodes.
+        enum {MAX_NODES = 4};
+        /// @brief    Constructs this test network with the given parameters.
+        UtGunnsEnsembleNetwork(const double conductance, const double capacitance,
+                               const int numNodes = 3);
+        /// @brief    Destructs this test network.
+        virtual ~UtGunnsEnsembleNetwork() {}
+        /// @brief    Initializes this test network.
+        void initialize();
+        GunnsConfigData               mNetworkConfig;    /**< (--) Network config data */
+        Gunns                         mNetwork;          /**< (--) Network solver */
+        GunnsBasicNode                mNodes[MAX_NODES]; /**< (--) Network nodes */
+        GunnsNodeList                 mNodeList;         /**< (--) Network node list */
+        std::vector<GunnsBasicLink*>  mLinks;            /**< (--) Network links */
+        GunnsBasicPotentialConfigData mSourceConfig;     /**< (--) Potential source config data */
+        GunnsBasicPotentialInputData  mSourceInput;      /**< (--) Potential source input data */
+        GunnsBasicPotential           mSource;           /**< (--) Potential source link */
+        GunnsBasicConductorConfigData mConductorConfig;  /**< (--) Conductor config data */
+        GunnsBasicConductorInputData  mConductorInput;   /**< (--) Conductor input data */
+        GunnsBasicConductor           mConductor;        /**< (--) Conductor link */
+        GunnsBasicCapacitorConfigData mCapacitorConfig;  /**< (--) Capacitor config data */
+        GunnsBasicCapacitorInputData  mCapacitorInput;   /**< (--) Capacitor input data */
+        GunnsBasicCapacitor           mCapacitor;        /**< (--) Capacitor link */
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsEnsembleNetwork(const UtGunnsEnsembleNetwork& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsEnsembleNetwork& operator =(const UtGunnsEnsembleNetwork& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Network Ensemble unit tests.
+///
+/// @details  This class provides the unit tests for the GunnsEnsemble class within the CPPUnit
+///           framework.  The ensemble instances are compared to identical reference networks that
+///           are stepped by themselves.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsEnsemble : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GunnsEnsemble unit test.
+        UtGunnsEnsemble();
+        /// @brief    Default destructs this GunnsEnsemble unit test.
+        virtual ~UtGunnsEnsemble();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests initialization.
+        void testInitialize();
+        /// @brief    Tests initialization exceptions.
+        void testInitializeExceptions();
+        /// @brief    Tests stepping the instances in the batch.
+        void testStep();
+        /// @brief    Tests instances stepped by themselves, paused and stepped outside the ensemble.
+        void testSoloSteps();
+        /// @brief    Tests a failed decomposition in one instance.
+        void testDecompositionFailure();
+        /// @brief    Tests step and accessor exceptions.
+        void testStepExceptions();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsEnsemble);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialize);
+        CPPUNIT_TEST(testInitializeExceptions);
+        CPPUNIT_TEST(testStep);
+        CPPUNIT_TEST(testSoloSteps);
+        CPPUNIT_TEST(testDecompositionFailure);
+        CPPUNIT_TEST(testStepExceptions);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief    Enumeration of the number of ensemble instances.
+        enum {N_INSTANCES = 3};
+        /// @brief    Enumeration of the number of steps in the step tests.
+        enum {N_STEPS = 10};
+        FriendlyGunnsEnsemble*  tArticle;                 /**< (--) Test article */
+        std::string             tName;                    /**< (--) Instance name */
+        UtGunnsEnsembleNetwork* tInstances[N_INSTANCES];  /**< (--) Ensemble instance networks */
+        UtGunnsEnsembleNetwork* tReferences[N_INSTANCES]; /**< (--) Reference networks */
+        double                  tTimeStep;                /**< (s)  Network time step */
+        /// @brief    Initializes the instance & reference networks and the test article.
+        void initEnsemble();
+        /// @brief    Steps the test article and the reference networks.
+        void stepAll();
+        /// @brief    Checks that the instances match their reference networks.
+        void checkInstances();
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsEnsemble(const UtGunnsEnsemble& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsEnsemble& operator =(const UtGunnsEnsemble& that);
+};
+
+///@}
+
+#endif
@@ -141,6 +141,7 @@ void UtGunnsFluidDistributedIf::testConfig()
     CPPUNIT_ASSERT(false           == tConfigData->mFluidSizesOverride);
     CPPUNIT_ASSERT(0               == tConfigData->mNumFluidOverride);
     CPPUNIT_ASSERT(0               == tConfigData->mNumTcOverride);
+    CPPUNIT_ASSERT(false           == tConfigData->mLagPrediction);
 
     /// - Check default config construction
     GunnsFluidDistributedIfConfigData defaultConfig;
@@ -157,6 +158,7 @@ void UtGunnsFluidDistributedIf::testConfig()
     CPPUNIT_ASSERT(false           == defaultConfig.mFluidSizesOverride);
     CPPUNIT_ASSERT(0               == defaultConfig.mNumFluidOverride);
     CPPUNIT_ASSERT(0               == defaultConfig.mNumTcOverride);
+    CPPUNIT_ASSERT(false           == defaultConfig.mLagPrediction);
 
     /// @test overrideInterfaceMixtureSizes function
     defaultConfig.overrideInterfaceMixtureSizes(5, 4);
@@ -229,6 +231,7 @@ void UtGunnsFluidDistributedIf::testDefaultConstruction()
     CPPUNIT_ASSERT(0     == tArticleInterface->mLoopLatency);
     CPPUNIT_ASSERT(0.0   == tArticle->mDemandFluxGain);
     CPPUNIT_ASSERT(0.0   == tArticle->mSuppliedCapacitance);
+    CPPUNIT_ASSERT(false == tArticle->mLagPrediction);
     CPPUNIT_ASSERT(0     == tArticle->mTempMassFractions);
     CPPUNIT_ASSERT(0     == tArticle->mOtherIfs.size());
     CPPUNIT_ASSERT(0.0   == tArticle->mFluidState.getTemperature());
@@ -282,6 +285,7 @@ void UtGunnsFluidDistributedIf::testNominalInitialization()
     CPPUNIT_ASSERT(tUseEnthalpy    == tArticle->mUseEnthalpy);
     CPPUNIT_ASSERT(tDemandOption   == tArticle->mDemandOption);
     CPPUNIT_ASSERT(&tCapacitorLink == tArticle->mCapacitorLink);
+    CPPUNIT_ASSERT(false           == tArticle->mLagPrediction);
 
     /// @test internal fluid.
     CPPUNIT_ASSERT(tArticle->mInternalFluid);
@@ -1283,3 +1287,73 @@ void UtGunnsFluidDistributedIf::testForceModes()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the lag prediction of the Supply side pressure and capacitance in Demand mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIf::testLagPrediction()
+{
+    std::cout << "\n UtGunnsFluidDistributedIf 15: testLagPrediction ....................";
+
+    tConfigData->mLagPrediction  = true;
+    tInputData->mForceDemandMode = true;
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0);
+    CPPUNIT_ASSERT(true == tArticle->mLagPrediction);
+
+    /// @test first Supply data in Demand mode isn't extrapolated.
+    tNodes[0].setVolume(1.0);
+    tArticle->mInData.mFrameCount         = 1;
+    tArticle->mInData.mDemandMode         = false;
+    tArticle->mInData.mCapacitance        = 1.0;
+    tArticle->mInData.mSource             = 1.0e5;
+    tArticle->mInData.mEnergy             = 3.0e5;
+    tArticle->mInData.mMoleFractions[0]   = 0.7;
+    tArticle->mInData.mMoleFractions[1]   = 0.3;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(true == tArticleInterface->mOutData.mDemandMode);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.0, tArticle->mSourcePressure, DBL_EPSILON);
+    tArticle->step(tTimeStep);
+    double expectedG = tArticle->mDemandFluxGain * 1.0 / tTimeStep;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedG, tArticle->mEffectiveConductivity, DBL_EPSILON);
+
+    /// @test Supply pressure and capacitance are extrapolated by half the loop latency, with the
+    ///       default rate filter gain of 0.5.
+    tArticle->mInData.mFrameCount  = 2;
+    tArticle->mInData.mSource      = 1.1e5;
+    tArticle->mInData.mCapacitance = 1.5;
+    tArticle->processInputs();
+    double horizon          = 0.5 * tArticleInterface->mLoopLatency;
+    double expectedPressure = 0.001 * (1.1e5 + 0.5 * 1.0e4 * horizon);
+    CPPUNIT_ASSERT(0 < tArticleInterface->mLoopLatency);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(horizon,          tArticle->mPressurePredictor.getHorizon(), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedPressure, tArticle->mSourcePressure,                 FLT_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedPressure, tNodes[0].getContent()->getPressure(),     FLT_EPSILON);
+    tArticle->step(tTimeStep);
+    const double expectedCap = 1.5 + 0.5 * 0.5 * horizon;
+    expectedG = tArticle->mDemandFluxGain * expectedCap / tTimeStep;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedG, tArticle->mEffectiveConductivity, FLT_EPSILON);
+
+    /// @test predictors are reset in Supply mode.
+    tArticle->mInData.mFrameCount = 3;
+    tArticle->mInData.mDemandMode = true;
+    tArticleInterface->forceSupplyRole();
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(false == tArticleInterface->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(0.0   == tArticle->mPressurePredictor.getRate());
+    CPPUNIT_ASSERT(0.0   == tArticle->mCapacitancePredictor.getRate());
+
+    /// @test predictors are reset on restart.
+    tArticleInterface->forceDemandRole();
+    tArticle->mInData.mFrameCount = 4;
+    tArticle->mInData.mDemandMode = false;
+    tArticle->processInputs();
+    tArticle->mInData.mFrameCount = 5;
+    tArticle->mInData.mSource     = 1.2e5;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT(0.0 < tArticle->mPressurePredictor.getRate());
+    tArticle->restartModel();
+    CPPUNIT_ASSERT(0.0 == tArticle->mPressurePredictor.getRate());
+    CPPUNIT_ASSERT(0.0 == tArticle->mCapacitancePredictor.getRate());
+
+    std::cout << "... Pass";
+}
@@ -85,6 +85,7 @@ class UtGunnsFluidDistributedIf: public CppUnit::TestFixture
         CPPUNIT_TEST(testRestart);
         CPPUNIT_TEST(testData);
         CPPUNIT_TEST(testForceModes);
+        CPPUNIT_TEST(testLagPrediction);
         CPPUNIT_TEST_SUITE_END();
 
         GunnsFluidDistributedIfConfigData*    tConfigData;            /**< (--)   Nominal config data */
@@ -129,6 +130,7 @@ class UtGunnsFluidDistributedIf: public CppUnit::TestFixture
         void testRestart();
         void testData();
         void testForceModes();
+        void testLagPrediction();
 };
 
 ///@}
@@ -0,0 +1,129 @@
+#ifndef UtGunnsFluidDistributedIfLag_EXISTS
+#define UtGunnsFluidDistributedIfLag_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_FLUID_DISTRIBUTED_IF_LAG    GUNNS Fluid Distributed Interface Lag Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for a pair of GUNNS Fluid Distributed Interface links in two networks,
+///           interfaced through a lag buffer in the same process.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+
+#include "core/Gunns.hh"
+#include "core/GunnsFluidCapacitor.hh"
+#include "core/GunnsFluidConductor.hh"
+#include "core/GunnsFluidDistributedIf.hh"
+#include "core/test/GunnsFluidDistributedIfLagBuffer.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsFluidDistributedIf and befriend UtGunnsFluidDistributedIfLag.
+///
+/// @details  Class derived from the unit under test. It just has a default constructor and
+///           destructor, but it befriends the unit test case driver class to allow it access to
+///           protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsFluidDistributedIfLag : public GunnsFluidDistributedIf
+{
+    public:
+        FriendlyGunnsFluidDistributedIfLag() {;}
+        virtual ~FriendlyGunnsFluidDistributedIfLag() {;}
+        friend class UtGunnsFluidDistributedIfLag;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Test network for one side of the interface.
+///
+/// @details  A tank node is connected through a conductor to the interface node, which has a
+///           GunnsFluidDistributedIf link and its capacitor link.  The last node is vacuum.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsFluidDistributedIfLagNetwork
+{
+    public:
+        GunnsFluidNode               mNodes[3];     /**< (--) Network nodes. */
+        GunnsNodeList                mNodeList;     /**< (--) Network node list. */
+        std::vector<GunnsBasicLink*> mLinks;        /**< (--) Network links vector. */
+        GunnsFluidCapacitor          mTank;         /**< (--) Tank capacitor link. */
+        GunnsFluidConductor          mConductor;    /**< (--) Tank to interface node conductor. */
+        GunnsFluidCapacitor          mIfCapacitor;  /**< (--) Interface node capacitor link. */
+        FriendlyGunnsFluidDistributedIfLag mIf;     /**< (--) Distributed interface link. */
+        Gunns                        mNetwork;      /**< (--) Network solver. */
+        /// @brief  Default constructs this test network.
+        UtGunnsFluidDistributedIfLagNetwork();
+        /// @brief  Default destructs this test network.
+        virtual ~UtGunnsFluidDistributedIfLagNetwork();
+        /// @brief  Initializes this test network.
+        void initialize(const std::string&   name,
+                        PolyFluidConfigData* fluidConfig,
+                        PolyFluidInputData*  tankFluid,
+                        PolyFluidInputData*  ifFluid,
+                        const double         tankVolume,
+                        const bool           isPairMaster,
+                        const bool           lagPrediction);
+        /// @brief  Returns the total fluid mass in this network.
+        double getMass() const;
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        UtGunnsFluidDistributedIfLagNetwork(const UtGunnsFluidDistributedIfLagNetwork&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        UtGunnsFluidDistributedIfLagNetwork& operator =(const UtGunnsFluidDistributedIfLagNetwork&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Fluid Distributed Interface lag unit tests.
+////
+/// @details  This class runs two networks interfaced by a pair of GunnsFluidDistributedIf links
+///           through a GunnsFluidDistributedIfLagBuffer, and reports the mass conservation error,
+///           the equalization and the interface pressure error versus the round-trip data lag, with
+///           and without the lag prediction option.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsFluidDistributedIfLag: public CppUnit::TestFixture
+{
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsFluidDistributedIfLag(const UtGunnsFluidDistributedIfLag& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsFluidDistributedIfLag& operator =(const UtGunnsFluidDistributedIfLag& that);
+
+        CPPUNIT_TEST_SUITE(UtGunnsFluidDistributedIfLag);
+        CPPUNIT_TEST(testMassConservationVsLag);
+        CPPUNIT_TEST_SUITE_END();
+
+        DefinedFluidProperties* tFluidProperties; /**< (--) Test fluid properties. */
+        PolyFluidConfigData*    tFluidConfig;     /**< (--) Test fluid config. */
+        PolyFluidInputData*     tFluidInputHi;    /**< (--) Test high pressure fluid input. */
+        PolyFluidInputData*     tFluidInputLo;    /**< (--) Test low pressure fluid input. */
+        double                  tTimeStep;        /**< (s)  Test time step. */
+        unsigned int            tNumSteps;        /**< (--) Number of frames to run. */
+        unsigned int            tStartSteps;      /**< (--) Number of start transient frames. */
+        /// @brief  Results of one run of the pair of networks.
+        struct RunResult {
+            int    mLoopLatency;   /**< (--)  Round-trip loop lag measured by the pair master. */
+            double mMaxMassError;  /**< (--)  Maximum relative total mass error during the run. */
+            double mEndMassError;  /**< (--)  Relative total mass error at the end of the run. */
+            double mEndDeltaPress; /**< (kPa) Tank pressure difference at the end of the run. */
+            double mStartIfError;  /**< (kPa) RMS interface pressure error, start transient. */
+            double mSettleIfError; /**< (kPa) RMS interface pressure error, settling. */
+        };
+        /// @brief  Runs the pair of networks with the given lag and prediction option.
+        RunResult run(const unsigned int delayFrames, const bool lagPrediction);
+
+    public:
+        UtGunnsFluidDistributedIfLag();
+        virtual ~UtGunnsFluidDistributedIfLag();
+        void tearDown();
+        void setUp();
+        void testMassConservationVsLag();
+};
+
+///@}
+
+#endif
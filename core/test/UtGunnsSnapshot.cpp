@@ -0,0 +1,416 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+ ((core/GunnsSnapshot.o))
+***************************************************************************************************/
+
+#include "UtGunnsSnapshot.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsOutOfBoundsException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsSnapshot class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsSnapshot::UtGunnsSnapshot()
+    :
+    tArticle(0),
+    tName("tArticle"),
+    tNetworkConfig("tNetwork", 1.0E-6, 1.0E-6, 1, 1),
+    tNetwork(),
+    tNodes(),
+    tNodeList(),
+    tLinks(),
+    tSourceConfig("tSource", &tNodeList, 2.0),
+    tSourceInput(false, 0.0, 100.0),
+    tSource(),
+    tConductorConfig("tConductor", &tNodeList, 0.5),
+    tConductorInput(false, 0.0),
+    tConductor(),
+    tCapacitorConfig("tCapacitor", &tNodeList),
+    tCapacitorInput(false, 0.0, 1.0, 0.0),
+    tCapacitor(),
+    tTimeStep(0.1)
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsSnapshot class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsSnapshot::~UtGunnsSnapshot()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSnapshot::tearDown()
+{
+    delete tArticle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSnapshot::setUp()
+{
+    tArticle = new FriendlyGunnsSnapshot(tName);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Initializes the test network: a potential source charging a capacitor through a
+///           conductor, so the node potentials change every step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSnapshot::initNetwork()
+{
+    tNodeList.mNumNodes = N_NODES;
+    tNodeList.mNodes    = tNodes;
+    tNetwork.initializeNodes(tNodeList);
+    tSource.initialize   (tSourceConfig,    tSourceInput,    tLinks, 2, 0);
+    tConductor.initialize(tConductorConfig, tConductorInput, tLinks, 0, 1);
+    tCapacitor.initialize(tCapacitorConfig, tCapacitorInput, tLinks, 1, 2);
+    tNetwork.initialize(tNetworkConfig, tLinks);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] includeMatrix (--) Whether the snapshot includes the decomposed admittance matrix.
+///
+/// @details  Steps the test network, saves a snapshot and records the node potentials over the
+///           following steps, with a capacitance edit part way through to change the admittance
+///           matrix.  Then restores the snapshot and checks that the network repeats exactly the
+///           same potentials.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSnapshot::checkNetworkRollback(const bool includeMatrix)
+{
+    initNetwork();
+    tArticle->setIncludeMatrix(includeMatrix);
+    for (int step = 0; step < 5; ++step) {
+        tNetwork.step(tTimeStep);
+    }
+
+    tNetwork.saveSnapshot(*tArticle);
+    CPPUNIT_ASSERT(tArticle->getSize() > 0);
+    CPPUNIT_ASSERT(GunnsSnapshot::IDLE == tArticle->getMode());
+    const int savedStepCount = tNetwork.getMajorStepCount();
+
+    double expected[N_STEPS][N_NODES];
+    for (int step = 0; step < N_STEPS; ++step) {
+        if (3 == step) {
+            tCapacitor.editCapacitance(true, 2.0);
+        }
+        tNetwork.step(tTimeStep);
+        for (int node = 0; node < N_NODES - 1; ++node) {
+            expected[step][node] = tNodes[node].getPotential();
+        }
+    }
+
+    tNetwork.restoreSnapshot(*tArticle);
+    CPPUNIT_ASSERT_EQUAL(savedStepCount, tNetwork.getMajorStepCount());
+    CPPUNIT_ASSERT_EQUAL(1.0, tCapacitor.getCapacitance());
+
+    for (int step = 0; step < N_STEPS; ++step) {
+        if (3 == step) {
+            tCapacitor.editCapacitance(true, 2.0);
+        }
+        tNetwork.step(tTimeStep);
+        for (int node = 0; node < N_NODES - 1; ++node) {
+            CPPUNIT_ASSERT_EQUAL(expected[step][node], tNodes[node].getPotential());
+        }
+    }
+
+    /// - The snapshot can be restored again.
+    tNetwork.restoreSnapshot(*tArticle);
+    CPPUNIT_ASSERT_EQUAL(savedStepCount, tNetwork.getMajorStepCount());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests default construction of the GunnsSnapshot class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSnapshot::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsSnapshot ........ 01: testDefaultConstruction ...............";
+
+    CPPUNIT_ASSERT(tName == tArticle->mName);
+    CPPUNIT_ASSERT(GunnsSnapshot::IDLE == tArticle->getMode());
+    CPPUNIT_ASSERT(not tArticle->getIncludeMatrix());
+    CPPUNIT_ASSERT(not tArticle->isRestoring());
+    CPPUNIT_ASSERT(tArticle->mBuffer.empty());
+    CPPUNIT_ASSERT(0 == tArticle->getSize());
+    CPPUNIT_ASSERT(0 == tArticle->mPosition);
+    CPPUNIT_ASSERT(0 == tArticle->getBuffer());
+
+    /// - Test the include matrix option.
+    FriendlyGunnsSnapshot article("article", true);
+    CPPUNIT_ASSERT(article.getIncludeMatrix());
+    article.setIncludeMatrix(false);
+    CPPUNIT_ASSERT(not article.getIncludeMatrix());
+
+    /// - Test new/delete for code coverage.
+    GunnsSnapshot* testArticle = new GunnsSnapshot();
+    delete testArticle;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests saving and restoring scalars, arrays and vectors of state terms.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSnapshot::testSaveRestore()
+{
+    std::cout << "\n UtGunnsSnapshot ........ 02: testSaveRestore .......................";
+
+    double              scalar   = 1.5;
+    bool                flag     = true;
+    int                 array[3] = {1, 2, 3};
+    std::vector<double> vector(2, 4.0);
+    int*                nullArray = 0;
+
+    /// - Save the terms.
+    tArticle->beginSave();
+    CPPUNIT_ASSERT(GunnsSnapshot::SAVE == tArticle->getMode());
+    CPPUNIT_ASSERT(not tArticle->isRestoring());
+    tArticle->sync(scalar);
+    tArticle->sync(flag);
+    tArticle->sync(array, 3);
+    tArticle->sync(vector);
+    tArticle->sync(nullArray, 3);
+    tArticle->sync(array, 0);
+    tArticle->end();
+    const std::size_t expectedSize = sizeof(double) + sizeof(bool) + 3 * sizeof(int)
+                                   + sizeof(std::size_t) + 2 * sizeof(double);
+    CPPUNIT_ASSERT(GunnsSnapshot::IDLE == tArticle->getMode());
+    CPPUNIT_ASSERT(expectedSize == tArticle->getSize());
+    CPPUNIT_ASSERT(tArticle->mBuffer.size() >= expectedSize);
+    CPPUNIT_ASSERT(0 != tArticle->getBuffer());
+
+    /// - Change the terms and restore them.
+    scalar   = 0.0;
+    flag     = false;
+    array[1] = 0;
+    vector.clear();
+    tArticle->beginRestore();
+    CPPUNIT_ASSERT(GunnsSnapshot::RESTORE == tArticle->getMode());
+    CPPUNIT_ASSERT(tArticle->isRestoring());
+    tArticle->sync(scalar);
+    tArticle->sync(flag);
+    tArticle->sync(array, 3);
+    tArticle->sync(vector);
+    tArticle->sync(nullArray, 3);
+    tArticle->sync(array, 0);
+    tArticle->end();
+    CPPUNIT_ASSERT(GunnsSnapshot::IDLE == tArticle->getMode());
+    CPPUNIT_ASSERT_EQUAL(1.5, scalar);
+    CPPUNIT_ASSERT(flag);
+    CPPUNIT_ASSERT_EQUAL(2, array[1]);
+    CPPUNIT_ASSERT(2 == vector.size());
+    CPPUNIT_ASSERT_EQUAL(4.0, vector[1]);
+
+    /// - Test that a repeated save of the same size re-uses the buffer.
+    const unsigned char* buffer = tArticle->getBuffer();
+    tArticle->beginSave();
+    tArticle->sync(scalar);
+    tArticle->sync(flag);
+    tArticle->sync(array, 3);
+    tArticle->sync(vector);
+    tArticle->end();
+    CPPUNIT_ASSERT(buffer == tArticle->getBuffer());
+    CPPUNIT_ASSERT(expectedSize == tArticle->getSize());
+
+    /// - Test that a restored vector is resized to the saved size.
+    vector.resize(5, 1.0);
+    tArticle->beginRestore();
+    tArticle->sync(scalar);
+    tArticle->sync(flag);
+    tArticle->sync(array, 3);
+    tArticle->sync(vector);
+    tArticle->end();
+    CPPUNIT_ASSERT(2 == vector.size());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests copying a saved snapshot into another snapshot and restoring it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSnapshot::testSetBuffer()
+{
+    std::cout << "\n UtGunnsSnapshot ........ 03: testSetBuffer .........................";
+
+    double value = 3.0;
+    tArticle->beginSave();
+    tArticle->sync(value);
+    tArticle->end();
+
+    FriendlyGunnsSnapshot copy("copy");
+    copy.setBuffer(tArticle->getBuffer(), tArticle->getSize());
+    CPPUNIT_ASSERT(tArticle->getSize() == copy.getSize());
+    CPPUNIT_ASSERT(tArticle->getBuffer() != copy.getBuffer());
+
+    value = 0.0;
+    copy.beginRestore();
+    copy.sync(value);
+    copy.end();
+    CPPUNIT_ASSERT_EQUAL(3.0, value);
+
+    /// - Test setting an empty snapshot.
+    copy.setBuffer(0, 0);
+    CPPUNIT_ASSERT(0 == copy.getSize());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests abandoning a save or restore.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSnapshot::testAbort()
+{
+    std::cout << "\n UtGunnsSnapshot ........ 04: testAbort .............................";
+
+    /// - An abandoned save discards the incomplete snapshot.
+    double value = 3.0;
+    tArticle->beginSave();
+    tArticle->sync(value);
+    tArticle->abort();
+    CPPUNIT_ASSERT(GunnsSnapshot::IDLE == tArticle->getMode());
+    CPPUNIT_ASSERT(0 == tArticle->getSize());
+    CPPUNIT_ASSERT(0 == tArticle->mPosition);
+
+    /// - An abandoned restore keeps the snapshot.
+    tArticle->beginSave();
+    tArticle->sync(value);
+    tArticle->end();
+    tArticle->beginRestore();
+    tArticle->abort();
+    CPPUNIT_ASSERT(GunnsSnapshot::IDLE == tArticle->getMode());
+    CPPUNIT_ASSERT(sizeof(double) == tArticle->getSize());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests exceptions thrown by the GunnsSnapshot class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSnapshot::testExceptions()
+{
+    std::cout << "\n UtGunnsSnapshot ........ 05: testExceptions ........................";
+
+    /// - Test exception thrown on restoring an empty snapshot.
+    CPPUNIT_ASSERT_THROW(tArticle->beginRestore(), TsInitializationException);
+
+    /// - Test exception thrown on sync outside of a save or restore.
+    double value = 1.0;
+    CPPUNIT_ASSERT_THROW(tArticle->sync(value), TsInitializationException);
+
+    /// - Test exception thrown on restoring past the end of the snapshot.
+    float small = 1.0;
+    tArticle->beginSave();
+    tArticle->sync(small);
+    tArticle->end();
+    tArticle->beginRestore();
+    CPPUNIT_ASSERT_THROW(tArticle->sync(value), TsOutOfBoundsException);
+    tArticle->abort();
+
+    /// - Test exception thrown on not restoring the entire snapshot.
+    tArticle->beginSave();
+    tArticle->sync(value);
+    tArticle->end();
+    tArticle->beginRestore();
+    tArticle->sync(small);
+    CPPUNIT_ASSERT_THROW(tArticle->end(), TsOutOfBoundsException);
+    CPPUNIT_ASSERT(GunnsSnapshot::IDLE == tArticle->getMode());
+
+    /// - Test exception thrown on replacing the buffer during a save.
+    tArticle->beginSave();
+    CPPUNIT_ASSERT_THROW(tArticle->setBuffer(tArticle->getBuffer(), 1), TsInitializationException);
+    tArticle->abort();
+
+    /// - Test exception thrown on a null buffer.
+    CPPUNIT_ASSERT_THROW(tArticle->setBuffer(0, 1), TsInitializationException);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests saving and restoring a network without its decomposed matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSnapshot::testNetwork()
+{
+    std::cout << "\n UtGunnsSnapshot ........ 06: testNetwork ...........................";
+
+    checkNetworkRollback(false);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests saving and restoring a network with its decomposed matrix, which
+///           makes the snapshot larger.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSnapshot::testNetworkMatrix()
+{
+    std::cout << "\n UtGunnsSnapshot ........ 07: testNetworkMatrix .....................";
+
+    checkNetworkRollback(true);
+
+    /// - The snapshot with the matrix is larger than without.
+    FriendlyGunnsSnapshot smaller("smaller", false);
+    tNetwork.saveSnapshot(smaller);
+    tNetwork.saveSnapshot(*tArticle);
+    CPPUNIT_ASSERT(tArticle->getSize() > smaller.getSize());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests exceptions thrown by saving and restoring network snapshots.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsSnapshot::testNetworkExceptions()
+{
+    std::cout << "\n UtGunnsSnapshot ........ 08: testNetworkExceptions .................";
+
+    /// - Test exceptions thrown on saving or restoring an uninitialized network.
+    CPPUNIT_ASSERT_THROW(tNetwork.saveSnapshot(*tArticle),    TsInitializationException);
+    CPPUNIT_ASSERT_THROW(tNetwork.restoreSnapshot(*tArticle), TsInitializationException);
+
+    /// - Test exception thrown on restoring a snapshot from a different network, and that the
+    ///   snapshot is left usable.
+    initNetwork();
+    int otherNetworkSize = N_NODES + 1;
+    tArticle->beginSave();
+    tArticle->sync(otherNetworkSize);
+    tArticle->sync(otherNetworkSize);
+    tArticle->end();
+    CPPUNIT_ASSERT_THROW(tNetwork.restoreSnapshot(*tArticle), TsOutOfBoundsException);
+    CPPUNIT_ASSERT(GunnsSnapshot::IDLE == tArticle->getMode());
+
+    /// - Test exception thrown on restoring a truncated snapshot.
+    tNetwork.saveSnapshot(*tArticle);
+    FriendlyGunnsSnapshot truncated("truncated");
+    truncated.setBuffer(tArticle->getBuffer(), tArticle->getSize() - 1);
+    CPPUNIT_ASSERT_THROW(tNetwork.restoreSnapshot(truncated), TsOutOfBoundsException);
+    CPPUNIT_ASSERT(GunnsSnapshot::IDLE == truncated.getMode());
+
+    /// - Test exception thrown on saving a network containing a link that doesn't support
+    ///   snapshots, such as one derived from a supported link class.
+    CPPUNIT_ASSERT(tNetwork.isSnapshotSupported());
+    GunnsBasicNode               nodes[2];
+    GunnsNodeList                nodeList(2, nodes);
+    std::vector<GunnsBasicLink*> links;
+    DerivedGunnsBasicConductor   derived;
+    Gunns                        network;
+    network.initializeNodes(nodeList);
+    derived.initialize(GunnsBasicConductorConfigData("derived", &nodeList, 0.5), tConductorInput,
+                       links, 0, 1);
+    network.initialize(GunnsConfigData("network", 1.0E-6, 1.0E-6, 1, 1), links);
+    CPPUNIT_ASSERT(tConductor.isSnapshotSupported());
+    CPPUNIT_ASSERT(not derived.isSnapshotSupported());
+    CPPUNIT_ASSERT(not network.isSnapshotSupported());
+    CPPUNIT_ASSERT_THROW(network.saveSnapshot(*tArticle), TsInitializationException);
+    CPPUNIT_ASSERT(GunnsSnapshot::IDLE == tArticle->getMode());
+
+    std::cout << "... Pass";
+}
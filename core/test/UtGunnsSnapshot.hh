@@ -0,0 +1,133 @@
+#ifndef UtGunnsSnapshot_EXISTS
+#define UtGunnsSnapshot_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_SNAPSHOT    Gunns Network State Snapshot Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Network State Snapshot class
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "core/Gunns.hh"
+#include "core/GunnsBasicCapacitor.hh"
+#include "core/GunnsBasicConductor.hh"
+#include "core/GunnsBasicNode.hh"
+#include "core/GunnsBasicPotential.hh"
+#include "core/GunnsSnapshot.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsSnapshot and befriend UtGunnsSnapshot.
+///
+/// @details  Class derived from the unit under test.  It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsSnapshot : public GunnsSnapshot
+{
+    public:
+        FriendlyGunnsSnapshot(const std::string& name = "", const bool includeMatrix = false)
+            : GunnsSnapshot(name, includeMatrix) {}
+        virtual ~FriendlyGunnsSnapshot() {}
+        friend class UtGunnsSnapshot;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Derived conductor that doesn't support snapshots.
+///
+/// @details  Class derived from a link that supports snapshots, but without its own snapshotState,
+///           to test that networks containing it refuse to save.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class DerivedGunnsBasicConductor : public GunnsBasicConductor
+{
+    public:
+        DerivedGunnsBasicConductor() : GunnsBasicConductor() {}
+        virtual ~DerivedGunnsBasicConductor() {}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Network State Snapshot unit tests.
+///
+/// @details  This class provides the unit tests for the GunnsSnapshot class within the CPPUnit
+///           framework, and for saving and restoring a small Gunns network with it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsSnapshot : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GunnsSnapshot unit test.
+        UtGunnsSnapshot();
+        /// @brief    Default destructs this GunnsSnapshot unit test.
+        virtual ~UtGunnsSnapshot();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests saving and restoring state terms.
+        void testSaveRestore();
+        /// @brief    Tests copying a snapshot between buffers.
+        void testSetBuffer();
+        /// @brief    Tests abandoning a save or restore.
+        void testAbort();
+        /// @brief    Tests exceptions.
+        void testExceptions();
+        /// @brief    Tests saving and restoring a network.
+        void testNetwork();
+        /// @brief    Tests saving and restoring a network with its decomposed matrix.
+        void testNetworkMatrix();
+        /// @brief    Tests network snapshot exceptions.
+        void testNetworkExceptions();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsSnapshot);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testSaveRestore);
+        CPPUNIT_TEST(testSetBuffer);
+        CPPUNIT_TEST(testAbort);
+        CPPUNIT_TEST(testExceptions);
+        CPPUNIT_TEST(testNetwork);
+        CPPUNIT_TEST(testNetworkMatrix);
+        CPPUNIT_TEST(testNetworkExceptions);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief    Enumeration of the test network nodes.
+        enum {N_NODES = 3};
+        /// @brief    Number of steps run after the snapshot in the network tests.
+        enum {N_STEPS = 10};
+        FriendlyGunnsSnapshot*        tArticle;         /**< (--) Test article */
+        std::string                   tName;            /**< (--) Instance name */
+        GunnsConfigData               tNetworkConfig;   /**< (--) Test network config data */
+        Gunns                         tNetwork;         /**< (--) Test network */
+        GunnsBasicNode                tNodes[N_NODES];  /**< (--) Test network nodes */
+        GunnsNodeList                 tNodeList;        /**< (--) Test network node list */
+        std::vector<GunnsBasicLink*>  tLinks;           /**< (--) Test network links */
+        GunnsBasicPotentialConfigData tSourceConfig;    /**< (--) Potential source config data */
+        GunnsBasicPotentialInputData  tSourceInput;     /**< (--) Potential source input data */
+        GunnsBasicPotential           tSource;          /**< (--) Potential source link */
+        GunnsBasicConductorConfigData tConductorConfig; /**< (--) Conductor config data */
+        GunnsBasicConductorInputData  tConductorInput;  /**< (--) Conductor input data */
+        GunnsBasicConductor           tConductor;       /**< (--) Conductor link */
+        GunnsBasicCapacitorConfigData tCapacitorConfig; /**< (--) Capacitor config data */
+        GunnsBasicCapacitorInputData  tCapacitorInput;  /**< (--) Capacitor input data */
+        GunnsBasicCapacitor           tCapacitor;       /**< (--) Capacitor link */
+        double                        tTimeStep;        /**< (s)  Network time step */
+        /// @brief    Initializes the test network.
+        void initNetwork();
+        /// @brief    Checks that a restored network repeats the steps after its snapshot.
+        void checkNetworkRollback(const bool includeMatrix);
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsSnapshot(const UtGunnsSnapshot& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsSnapshot& operator =(const UtGunnsSnapshot& that);
+};
+
+///@}
+
+#endif
@@ -46,6 +46,7 @@ LIBRARY DEPENDENCY:
 #include "UtGunnsFluidExternalSupply.hh"
 #include "UtGunnsFluidExternalDemand.hh"
 #include "UtGunnsFluidDistributedIf.hh"
+#include "UtGunnsFluidDistributedIfLag.hh"
 #include "UtGunnsFluidShadow.hh"
 #include "UtGunnsFluidFlowController.hh"
 #include "UtGunnsFluidIslandAnalyzer.hh"
@@ -54,6 +55,8 @@ LIBRARY DEPENDENCY:
 #include "UtGunnsFluidFlowIntegrator.hh"
 #include "UtGunnsFluidVolumeMonitor.hh"
 #include "UtGunnsSensorAnalogWrapper.hh"
+#include "UtGunnsSnapshot.hh"
+#include "UtGunnsEnsemble.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param    argc  int     --  not used
@@ -95,6 +98,7 @@ int main(int argc, char** argv) {
     runner.addTest( UtGunnsFluidExternalSupply::suite() );
     runner.addTest( UtGunnsFluidExternalDemand::suite() );
     runner.addTest( UtGunnsFluidDistributedIf::suite() );
+    runner.addTest( UtGunnsFluidDistributedIfLag::suite() );
     runner.addTest( UtGunnsFluidShadow::suite() );
     runner.addTest( UtGunnsFluidFlowController::suite());
     runner.addTest( UtGunnsFluidIslandAnalyzer::suite() );
@@ -103,6 +107,8 @@ int main(int argc, char** argv) {
     runner.addTest( UtGunnsFluidFlowIntegrator::suite() );
     runner.addTest( UtGunnsFluidVolumeMonitor::suite() );
     runner.addTest( UtGunnsSensorAnalogWrapper::suite() );
+    runner.addTest( UtGunnsSnapshot::suite() );
+    runner.addTest( UtGunnsEnsemble::suite() );
 
     runner.run();
 
@@ -277,6 +277,18 @@ class BasicNetworkBodyTemplate:
         '    /// - Step network spotters after solver step.\n')
     for spotter in self.data['spotters']:
       r = r+('    ' + spotter[1] + '.stepPostSolver(timeStep);\n')
+    r = r+('}\n'
+        '\n'
+        '////////////////////////////////////////////////////////////////////////////////////////////////////\n'
+        '/// @param[in,out] snapshot (--) The network snapshot being saved or restored.\n'
+        '///\n'
+        '/// @details  Saves or restores this network\'s spotters state in a network snapshot.\n'
+        '////////////////////////////////////////////////////////////////////////////////////////////////////\n'
+        'void ' + self.data['networkName'] + '::snapshotSpotters(GunnsSnapshot& snapshot)\n'
+        '{\n'
+        '    /// - Snapshot network spotters.\n')
+    for spotter in self.data['spotters']:
+      r = r+('    ' + spotter[1] + '.snapshotState(snapshot);\n')
     r = r+('}\n')
 # TODO end namespace #}
     return r.encode('ascii', 'ignore').decode('ascii')
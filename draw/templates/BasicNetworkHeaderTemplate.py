@@ -292,7 +292,9 @@ class BasicNetworkHeaderTemplate:
         '        /// @brief  Update network spotters before the solver solution.\n'
         '        virtual void stepSpottersPre(const double timeStep);\n'
         '        /// @brief  Update network spotters after the solver solution.\n'
-        '        virtual void stepSpottersPost(const double timeStep);\n')
+        '        virtual void stepSpottersPost(const double timeStep);\n'
+        '        /// @brief  Saves or restores network spotters state in a network snapshot.\n'
+        '        virtual void snapshotSpotters(GunnsSnapshot& snapshot);\n')
     r = r + self.blockDeclarationsEndPublic()
     r = r + (
         '\n'
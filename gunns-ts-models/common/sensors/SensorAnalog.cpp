@@ -4,7 +4,8 @@
 
 LIBRARY DEPENDENCY:
     ((math/UnitConversion.o)
-     (SensorBase.o))
+     (SensorBase.o)
+     (TsNoiseStream.o))
 
 PROGRAMMERS:
     ((Jason Harvey) (L-3 Communications) (2012-04) (Initial))
@@ -236,7 +237,9 @@ SensorAnalog::SensorAnalog()
     mUnitConversion     (UnitConversion::NO_CONVERSION),
     mTruthInput         (0.0),
     mTruthOutput        (0.0),
-    mSensedOutput       (0.0)
+    mSensedOutput       (0.0),
+    mNoiseStreamFlag    (false),
+    mNoiseStream        ()
 {
     // nothing to do
 }
@@ -470,9 +473,10 @@ void SensorAnalog::applyDrift(const double timeStep)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void SensorAnalog::applyNoise()
 {
-    /// - Skip all processing if no noise function was provided in config data.  This makes it easy
-    ///   to configure noise-less sensors - just leave the noise function null.
-    if (mNoiseFunction) {
+    /// - Skip all processing if no noise function was provided in config data and no noise stream
+    ///   is enabled.  This makes it easy to configure noise-less sensors - just leave the noise
+    ///   function null.
+    if (mNoiseFunction or mNoiseStreamFlag) {
 
         /// - Noise malfunction overrides both components simultaneously.
         float activeNoiseScale = mNominalNoiseScale;
@@ -494,12 +498,12 @@ void SensorAnalog::applyNoise()
         /// - Apply the input-scaling noise component.
         activeNoiseMult *= std::fabs(mSensedOutput - mOffValue);
         if (std::fabs(activeNoiseMult) > FLT_EPSILON) {
-            mSensedOutput += static_cast<float>((*mNoiseFunction)()) * activeNoiseMult;
+            mSensedOutput += static_cast<float>(getNoise()) * activeNoiseMult;
         }
 
         /// - Apply the constant scale noise component.
         if (std::fabs(activeNoiseScale) > FLT_EPSILON) {
-            mSensedOutput += static_cast<float>((*mNoiseFunction)()) * activeNoiseScale;
+            mSensedOutput += static_cast<float>(getNoise()) * activeNoiseScale;
         }
     }
 }
@@ -530,3 +534,18 @@ void SensorAnalog::applyResolution()
         mSensedOutput = value * MsMath::round(mSensedOutput/value);
     }
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] seed     (--) Seed shared by the related sensors' noise streams.
+/// @param[in] streamId (--) Identifies this sensor's noise stream among those with the same seed.
+///
+/// @details  Sets this sensor to draw its noise from its own noise stream instead of the noise
+///           function from config data, and restarts the stream with the given key.  Each sensor
+///           should have a unique stream ID, such as its index, so their noise is independent.  The
+///           noise is then the same for a given seed regardless of which thread updates the sensor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SensorAnalog::setNoiseStream(const unsigned int seed, const unsigned int streamId)
+{
+    mNoiseStream.initialize(seed, streamId);
+    mNoiseStreamFlag = true;
+}
@@ -33,6 +33,7 @@ PROGRAMMERS:
 */
 
 #include "SensorBase.hh"
+#include "TsNoiseStream.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "math/UnitConversion.hh"
 
@@ -134,7 +135,9 @@ class SensorAnalogInputData : public SensorBaseInputData
 ///           malfunctions common with the other sensor classes, this class also models nominal and
 ///           malfunction sensor scale, bias, drift, noise, and resolution.  All of these effects
 ///           are optional.  The noise logic can use any external function supplied by the config
-///           data as long as it has the correct method signature.
+///           data as long as it has the correct method signature.  Alternatively, the sensor can
+///           draw its noise from its own counter-based TsNoiseStream, enabled by setNoiseStream,
+///           which makes the noise reproducible regardless of how sensors are spread across threads.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class SensorAnalog : public SensorBase
 {
@@ -195,6 +198,12 @@ class SensorAnalog : public SensorBase
         /// @brief Determines the degradation state of the sensor.
         virtual bool determineDegradation() const;
 
+        /// @brief Sets the sensor to draw noise from its own noise stream with the given key.
+        void         setNoiseStream(const unsigned int seed, const unsigned int streamId);
+
+        /// @brief Returns the sensor's noise stream.
+        TsNoiseStream& getNoiseStream();
+
     protected:
         float  mMinRange;          /**< (--) trick_chkpnt_io(**) Minimum sensed output value, in output units */
         float  mMaxRange;          /**< (--) trick_chkpnt_io(**) Maximum sensed output value, in output units */
@@ -209,6 +218,8 @@ class SensorAnalog : public SensorBase
         double mTruthInput;        /**< (--) Input truth value to sense in input units */
         double mTruthOutput;       /**< (--) Input truth value converted to output units */
         float  mSensedOutput;      /**< (--) Sensed output value of the sensor, in output units */
+        bool   mNoiseStreamFlag;   /**< (--) trick_chkpnt_io(**) Noise is drawn from mNoiseStream instead of mNoiseFunction */
+        TsNoiseStream mNoiseStream; /**< (--) Counter-based noise stream of this sensor */
 
         /// @brief Validates the initial conditions.
         void         validate() const;
@@ -231,6 +242,9 @@ class SensorAnalog : public SensorBase
         /// @brief Applies nominal and malfunction noise to the sensor output.
         void         applyNoise();
 
+        /// @brief Returns the next noise value from the noise stream or noise function.
+        double       getNoise();
+
         /// @brief Applies nominal and malfunction resolution to the sensor output.
         void         applyResolution();
 
@@ -312,4 +326,29 @@ inline bool SensorAnalog::determineDegradation() const
              and not mMalfPerfectSensor);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  TsNoiseStream& (--) The noise stream of this sensor.
+///
+/// @details  Allows other objects to checkpoint the noise stream, or to batch noise generation
+///           for many sensors with the TsNoiseStream batch methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline TsNoiseStream& SensorAnalog::getNoiseStream()
+{
+    return mNoiseStream;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (--) The next noise value.
+///
+/// @details  Returns the next noise value from this sensor's noise stream if enabled, otherwise
+///           from the noise function.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double SensorAnalog::getNoise()
+{
+    if (mNoiseStreamFlag) {
+        return mNoiseStream.getNoise();
+    }
+    return (*mNoiseFunction)();
+}
+
 #endif
@@ -0,0 +1,270 @@
+/************************** TRICK HEADER **********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   ()
+**************************************************************************************************/
+
+#include <cmath>
+
+#include "TsNoiseStream.hh"
+
+/// @details  Sigma is the same as TsNoise: 1/number of standard deviations which contain 99.999% of
+///           the random variables in a standard normal distribution.
+const double  TsNoiseStream::SIGMA_INV  = 1.0 / 4.417173413469;
+const double  TsNoiseStream::TWO_PI     = 2.0 * 3.14159265358979323846;
+const double  TsNoiseStream::UINT_SCALE = 1.0 / 4294967296.0;
+
+/// @details  Number of blocks generated at a time by the batch methods.  This sizes their local
+///           buffers.
+static const unsigned int NUM_BATCH_BLOCKS = 64;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Noise Stream, keyed with seed and stream ID zero.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsNoiseStream::TsNoiseStream()
+    :
+    mKey(),
+    mCounter(0),
+    mBlock(),
+    mBlockIndex(BLOCK_SIZE)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Noise Stream.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsNoiseStream::~TsNoiseStream()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  seed      (--)  Seed shared by related streams, e.g. one per Monte Carlo run.
+/// @param[in]  streamId  (--)  Identifies this stream among those with the same seed, e.g. an index.
+///
+/// @return     void
+///
+/// @details    Initializes this Noise Stream to the start of the stream with the given key.  Streams
+///             with different keys are statistically independent.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsNoiseStream::initialize(const unsigned int seed, const unsigned int streamId)
+{
+    mKey[0]     = seed;
+    mKey[1]     = streamId;
+    mCounter    = 0;
+    mBlockIndex = BLOCK_SIZE;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] bits     (--)  The block of 4 random 32-bit words.
+/// @param[in]  key      (--)  The 2-word key of the stream.
+/// @param[in]  counter  (--)  Index of the block in the stream.
+///
+/// @return     void
+///
+/// @details    Computes the Philox4x32-10 block of random bits for a key and counter: 10 rounds of
+///             multiplies and xors of the counter words with the key, which is bumped by the Weyl
+///             constants each round.  The upper 2 counter words are zero.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsNoiseStream::philox(unsigned int bits[4], const unsigned int key[2],
+                           const unsigned long long counter)
+{
+    unsigned int c0 = static_cast<unsigned int>(counter);
+    unsigned int c1 = static_cast<unsigned int>(counter >> 32);
+    unsigned int c2 = 0;
+    unsigned int c3 = 0;
+    unsigned int k0 = key[0];
+    unsigned int k1 = key[1];
+
+    for (int round = 0; round < 10; ++round) {
+        const unsigned long long p0 = 0xD2511F53ULL * c0;
+        const unsigned long long p1 = 0xCD9E8D57ULL * c2;
+        c0 = static_cast<unsigned int>(p1 >> 32) ^ c1 ^ k0;
+        c1 = static_cast<unsigned int>(p1);
+        c2 = static_cast<unsigned int>(p0 >> 32) ^ c3 ^ k1;
+        c3 = static_cast<unsigned int>(p0);
+        k0 += 0x9E3779B9U;
+        k1 += 0xBB67AE85U;
+    }
+
+    bits[0] = c0;
+    bits[1] = c1;
+    bits[2] = c2;
+    bits[3] = c3;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] values     (--)  The scaled normal deviates, BLOCK_SIZE per block.
+/// @param[in]  bits       (--)  The random bits, BLOCK_SIZE words per block.
+/// @param[in]  numBlocks  (--)  Number of blocks to transform.
+///
+/// @return     void
+///
+/// @details    Transforms each pair of random words to uniform variates on (0,1), which exclude 0
+///             so the log is finite, and then to a pair of independent normal deviates with the
+///             Box-Muller method, scaled by the inverse of sigma.  The loop has no branches or
+///             dependencies between iterations, so the compiler can vectorize it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsNoiseStream::boxMuller(double* values, const unsigned int* bits, const unsigned int numBlocks)
+{
+    const unsigned int numPairs = numBlocks * BLOCK_SIZE / 2;
+    for (unsigned int i = 0; i < numPairs; ++i) {
+        const double u1    = (static_cast<double>(bits[2 * i])     + 0.5) * UINT_SCALE;
+        const double u2    = (static_cast<double>(bits[2 * i + 1]) + 0.5) * UINT_SCALE;
+        const double r     = SIGMA_INV * std::sqrt(-2.0 * std::log(u1));
+        const double theta = TWO_PI * u2;
+        values[2 * i]      = r * std::cos(theta);
+        values[2 * i + 1]  = r * std::sin(theta);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return     void
+///
+/// @details    Generates the next block of noise values into mBlock.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsNoiseStream::refill()
+{
+    unsigned int bits[BLOCK_SIZE];
+    philox(bits, mKey, mCounter++);
+    boxMuller(mBlock, bits, 1);
+    mBlockIndex = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return     double  (--)  Gaussian noise on [-1, 1].
+///
+/// @details    Gets the next noise value from this Noise Stream.  Values outside [-1, 1] are
+///             rejected and the next one is taken, so unlike TsNoise this can't fail.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double TsNoiseStream::getNoise()
+{
+    for (;;) {
+        if (mBlockIndex >= BLOCK_SIZE) {
+            refill();
+        }
+        const double noise = mBlock[mBlockIndex++];
+        if (std::fabs(noise) <= 1.0) {
+            return noise;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] noise  (--)  Array of at least count values to fill with Gaussian noise on [-1, 1].
+/// @param[in]  count  (--)  Number of noise values to get.
+///
+/// @return     void
+///
+/// @details    Fills an array with the next noise values from this Noise Stream, the same values as
+///             count calls to getNoise() would return.  The values left in the current block are
+///             used first, then only as many more blocks as are needed are generated in batches.
+///             The unused values of the last block are kept for the next call.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsNoiseStream::getNoise(double* noise, const unsigned int count)
+{
+    unsigned int filled = 0;
+    while (filled < count and mBlockIndex < BLOCK_SIZE) {
+        const double value = mBlock[mBlockIndex++];
+        if (std::fabs(value) <= 1.0) {
+            noise[filled++] = value;
+        }
+    }
+
+    unsigned int bits[NUM_BATCH_BLOCKS * BLOCK_SIZE];
+    double values[NUM_BATCH_BLOCKS * BLOCK_SIZE];
+    while (filled < count) {
+        /// - Generate just enough blocks for the remaining values, absent rejections, so only the
+        ///   last block can have unused values left over.
+        unsigned int numBlocks = (count - filled + BLOCK_SIZE - 1) / BLOCK_SIZE;
+        if (numBlocks > NUM_BATCH_BLOCKS) {
+            numBlocks = NUM_BATCH_BLOCKS;
+        }
+        for (unsigned int block = 0; block < numBlocks; ++block) {
+            philox(&bits[block * BLOCK_SIZE], mKey, mCounter++);
+        }
+        boxMuller(values, bits, numBlocks);
+
+        unsigned int i = 0;
+        for ( ; i < numBlocks * BLOCK_SIZE and filled < count; ++i) {
+            if (std::fabs(values[i]) <= 1.0) {
+                noise[filled++] = values[i];
+            }
+        }
+
+        /// - Keep the last block and where its unused values start.
+        const unsigned int last = (numBlocks - 1) * BLOCK_SIZE;
+        for (int j = 0; j < BLOCK_SIZE; ++j) {
+            mBlock[j] = values[last + j];
+        }
+        mBlockIndex = static_cast<int>(i - last);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] noise    (--)  Array of at least count values to fill with Gaussian noise on [-1, 1].
+/// @param[in]  streams  (--)  Array of count pointers to distinct Noise Streams.
+/// @param[in]  count    (--)  Number of Noise Streams.
+///
+/// @return     void
+///
+/// @details    Fills an array with the next noise value from each of many Noise Streams, for example
+///             one stream per sensor, the same values as calling getNoise() on each stream would
+///             return.  The streams that need a new block have their random bits generated first,
+///             and then all are transformed together in a batch.
+///
+/// @note       A stream must not appear more than once in the array.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsNoiseStream::getNoise(double* noise, TsNoiseStream* const* streams, const unsigned int count)
+{
+    unsigned int bits[NUM_BATCH_BLOCKS * BLOCK_SIZE];
+    double values[NUM_BATCH_BLOCKS * BLOCK_SIZE];
+    unsigned int refills[NUM_BATCH_BLOCKS];
+    bool done[NUM_BATCH_BLOCKS];
+
+    for (unsigned int base = 0; base < count; base += NUM_BATCH_BLOCKS) {
+        const unsigned int numStreams = (count - base < NUM_BATCH_BLOCKS) ? count - base : NUM_BATCH_BLOCKS;
+        for (unsigned int i = 0; i < numStreams; ++i) {
+            done[i] = false;
+        }
+
+        unsigned int numRemaining = numStreams;
+        while (numRemaining > 0) {
+            /// - Take the next value left in each stream's block, or generate the bits of a new
+            ///   block for the streams that have none.
+            unsigned int numBlocks = 0;
+            for (unsigned int i = 0; i < numStreams; ++i) {
+                if (done[i]) {
+                    continue;
+                }
+                TsNoiseStream* stream = streams[base + i];
+                while (stream->mBlockIndex < BLOCK_SIZE) {
+                    const double value = stream->mBlock[stream->mBlockIndex++];
+                    if (std::fabs(value) <= 1.0) {
+                        noise[base + i] = value;
+                        done[i] = true;
+                        --numRemaining;
+                        break;
+                    }
+                }
+                if (not done[i]) {
+                    philox(&bits[numBlocks * BLOCK_SIZE], stream->mKey, stream->mCounter++);
+                    refills[numBlocks++] = i;
+                }
+            }
+
+            /// - Transform the new blocks together, and give them to their streams.
+            boxMuller(values, bits, numBlocks);
+            for (unsigned int block = 0; block < numBlocks; ++block) {
+                TsNoiseStream* stream = streams[base + refills[block]];
+                for (int j = 0; j < BLOCK_SIZE; ++j) {
+                    stream->mBlock[j] = values[block * BLOCK_SIZE + j];
+                }
+                stream->mBlockIndex = 0;
+            }
+        }
+    }
+}
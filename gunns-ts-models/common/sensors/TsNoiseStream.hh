@@ -0,0 +1,118 @@
+#ifndef TsNoiseStream_EXISTS
+#define TsNoiseStream_EXISTS
+
+/**
+@defgroup TSM_SENSORS_NOISE_STREAM  Noise Stream
+@ingroup  TSM_SENSORS
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- ( Counter-based Normalized Noise over [-1, 1].\n
+    This class provides an independent, reproducible stream of pseudorandom noise with the same
+    distribution as TsNoise: standard normal deviates scaled by 1/4.41717... so that 99.999 percent
+    fall onto the [-1,+1] interval, with the remaining few rejected.\n
+    Uniform random bits come from the Philox4x32-10 counter-based generator.  Each stream is keyed
+    by a seed and a stream ID, and the Nth block of 4 32-bit words in the stream is a pure function
+    of the key and N.  So there is no shared generator state: streams owned by different objects,
+    such as one per sensor, give the same values regardless of which thread updates them, or in
+    what order.  The uniform bits are transformed to normal deviates in pairs with the Box-Muller
+    method.  The batch methods generate the bits for many blocks first and then transform them in a
+    single branch-free loop that the compiler can vectorize.)
+
+REQUIREMENTS:
+- ()
+
+REFERENCE:
+- ((Salmon, John K., Moraes, Mark A., Dror, Ron O., Shaw, David E., Parallel Random Numbers: As
+    Easy as 1, 2, 3, SC '11: Proceedings of the 2011 International Conference for High Performance
+    Computing, Networking, Storage and Analysis, 11/11.)
+   (Box, G. E. P., Muller, Mervin E., A Note on the Generation of Random Normal Deviates, Annals of
+    Mathematical Statistics, Vol. 29, No. 2, 6/58, 610-611.))
+
+ASSUMPTIONS AND LIMITATIONS:
+- ((A stream repeats after 2^64 blocks.)
+   (The values differ from TsNoise for the same seed, since the underlying generators differ.))
+
+LIBRARY DEPENDENCY:
+- ((TsNoiseStream.o))
+
+PROGRAMMERS:
+- ()
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Counter-based noise stream.
+///
+/// @details  Provides reproducible noise from a normal distribution with range limiting, from a
+///           generator state owned by each stream.  The state is plain data, so a checkpoint and
+///           restart continues the same sequence.  Values are generated 4 at a time and are used
+///           in order, so the sequence of values returned is the same whether they are taken one at
+///           a time or with the batch methods.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class TsNoiseStream {
+    TS_MAKE_SIM_COMPATIBLE(TsNoiseStream);
+    public:
+        /// @brief  Number of normal deviates generated per block of the stream.
+        static const int BLOCK_SIZE = 4;
+        /// @brief  Default constructs this Noise Stream, keyed with seed and stream ID zero.
+        TsNoiseStream();
+        /// @brief  Default destructs this Noise Stream.
+        virtual ~TsNoiseStream();
+        /// @brief  Initializes this Noise Stream to the start of the stream with the given key.
+        void initialize(const unsigned int seed, const unsigned int streamId);
+        /// @brief  Gets the next noise value from this Noise Stream.
+        double getNoise();
+        /// @brief  Fills an array with the next noise values from this Noise Stream.
+        void getNoise(double* noise, const unsigned int count);
+        /// @brief  Fills an array with the next noise value from each of many Noise Streams.
+        static void getNoise(double* noise, TsNoiseStream* const* streams, const unsigned int count);
+        /// @brief  Returns the number of blocks generated since initialization.
+        unsigned long long getCounter() const;
+        /// @brief  Computes the Philox4x32-10 block of random bits for a key and counter.
+        static void philox(unsigned int bits[4], const unsigned int key[2],
+                           const unsigned long long counter);
+
+    protected:
+        unsigned int       mKey[2];                 /**< (--)  Seed and stream ID keying the generator. */
+        unsigned long long mCounter;                /**< (--)  Number of blocks generated. */
+        double             mBlock[BLOCK_SIZE];      /**< (--)  Noise values of the last block generated. */
+        int                mBlockIndex;             /**< (--)  Index of the next unused value in mBlock. */
+        static const double SIGMA_INV;              /**< (--)  Inverse of sigma. */
+        static const double TWO_PI;                 /**< (--)  Two pi. */
+        static const double UINT_SCALE;             /**< (--)  Scale from 32-bit words to (0, 1). */
+        /// @brief  Generates the next block of noise values into mBlock.
+        void refill();
+        /// @brief  Transforms blocks of random bits to blocks of scaled normal deviates.
+        static void boxMuller(double* values, const unsigned int* bits, const unsigned int numBlocks);
+
+    private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        TsNoiseStream(const TsNoiseStream&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        TsNoiseStream& operator=(const TsNoiseStream&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   unsigned long long  (--)  Number of blocks generated since initialization.
+///
+/// @details  Returns the number of blocks generated since initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long long TsNoiseStream::getCounter() const
+{
+    return mCounter;
+}
+
+#endif
@@ -647,6 +647,24 @@ void UtSensorAnalog::testNoise()
     article2.applyNoise();
     CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, article2.mSensedOutput, FLT_EPSILON);
 
+    /// - Verify the noise stream is used in place of the missing noise function, giving the same
+    ///   values as a separate stream with the same key.
+    CPPUNIT_ASSERT(false == article2.mNoiseStreamFlag);
+    article2.setNoiseStream(42, 7);
+    CPPUNIT_ASSERT(true  == article2.mNoiseStreamFlag);
+    CPPUNIT_ASSERT(&article2.mNoiseStream == &article2.getNoiseStream());
+    TsNoiseStream stream;
+    stream.initialize(42, 7);
+    article2.mSensedOutput        = 10.0F;
+    article2.mMalfNoiseMultiplier = 0.1F;
+    const float noiseMult         = 0.1F * std::fabs(10.0F - tOffValue);
+    expected                      = 10.0F;
+    expected                     += static_cast<float>(stream.getNoise()) * noiseMult;
+    expected                     += static_cast<float>(stream.getNoise()) * 0.5F;
+    article2.applyNoise();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, article2.mSensedOutput, FLT_EPSILON);
+    CPPUNIT_ASSERT(10.0F != article2.mSensedOutput);
+
     std::cout << "... Pass";
 }
 
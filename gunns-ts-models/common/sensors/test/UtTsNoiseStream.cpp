@@ -0,0 +1,216 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((common/sensors/TsNoiseStream.o))
+ ***************************************************************************************************/
+
+#include <cmath>
+#include <iostream>
+
+#include "UtTsNoiseStream.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructor
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtTsNoiseStream::UtTsNoiseStream()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructor
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtTsNoiseStream::~UtTsNoiseStream()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  unit test infrastructure
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsNoiseStream::setUp()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  unit test infrastructure
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsNoiseStream::tearDown()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Tests the Philox4x32-10 generator against its published known answer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsNoiseStream::testPhilox()
+{
+    std::cout << "\n--------------------------------------------------------------------------------";
+    std::cout << "\n UtTsNoiseStream ...... 01: testPhilox.................................";
+
+    const unsigned int key[2] = {0, 0};
+    unsigned int bits[4];
+    TsNoiseStream::philox(bits, key, 0);
+    CPPUNIT_ASSERT_EQUAL(0x6627e8d5U, bits[0]);
+    CPPUNIT_ASSERT_EQUAL(0xe169c58dU, bits[1]);
+    CPPUNIT_ASSERT_EQUAL(0xbc57ac4cU, bits[2]);
+    CPPUNIT_ASSERT_EQUAL(0x9b00dbd8U, bits[3]);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Tests the distribution range.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsNoiseStream::testRange()
+{
+    std::cout << "\n UtTsNoiseStream ...... 02: testRange..................................";
+
+    // Produce 1,000,000 samples of noise and show that they all fall within [-1,1].
+    TsNoiseStream stream;
+    stream.initialize(314159265, 0);
+    for (int i = 0; i <= 1000000; ++i) {
+        const double noise = stream.getNoise();
+        CPPUNIT_ASSERT(-1.0 <= noise && noise <= 1.0);
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Tests the distribution mean and standard deviation.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsNoiseStream::testDistribution()
+{
+    std::cout << "\n UtTsNoiseStream ...... 03: testDistribution...........................";
+
+    // Mean of 1,000,000 samples of noise is close to zero, and the standard deviation is close to
+    // 1/4.417, like TsNoise.
+    TsNoiseStream stream;
+    stream.initialize(23, 5);
+    const int count = 1000000;
+    double sum   = 0.0;
+    double sumSq = 0.0;
+    for (int i = 0; i < count; ++i) {
+        const double noise = stream.getNoise();
+        sum   += noise;
+        sumSq += noise * noise;
+    }
+    const double mean = sum / count;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, mean, 0.001);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0 / 4.417173413469, std::sqrt(sumSq / count - mean * mean), 0.001);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Tests the repeatability and independence of streams.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsNoiseStream::testRepeatability()
+{
+    std::cout << "\n UtTsNoiseStream ...... 04: testRepeatability..........................";
+
+    // Streams with the same key give the same values, interleaved with other streams or not.
+    TsNoiseStream stream1;
+    TsNoiseStream stream2;
+    TsNoiseStream other;
+    stream1.initialize(123456789, 3);
+    stream2.initialize(123456789, 3);
+    other.initialize(123456789, 4);
+    double expected[10000];
+    for (int i = 0; i < 10000; ++i) {
+        expected[i] = stream1.getNoise();
+    }
+    for (int i = 0; i < 10000; ++i) {
+        other.getNoise();
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[i], stream2.getNoise(), 0.0);
+    }
+    CPPUNIT_ASSERT(stream1.getCounter() == stream2.getCounter());
+    CPPUNIT_ASSERT(stream1.getCounter() >= 2500);
+
+    // Streams with a different seed or stream ID differ, and values don't repeat.
+    CPPUNIT_ASSERT(expected[9999] != other.getNoise());
+    CPPUNIT_ASSERT(expected[0] != expected[1]);
+
+    // Re-initializing restarts the stream.
+    stream1.initialize(123456789, 3);
+    CPPUNIT_ASSERT(0 == stream1.getCounter());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[0], stream1.getNoise(), 0.0);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Tests the batch fill gives the same values as single calls, in any mix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsNoiseStream::testBatch()
+{
+    std::cout << "\n UtTsNoiseStream ...... 05: testBatch..................................";
+
+    TsNoiseStream single;
+    TsNoiseStream batch;
+    single.initialize(99, 1);
+    batch.initialize(99, 1);
+
+    // Batch sizes that start and end mid-block and span more than one batch of blocks.
+    const unsigned int sizes[6] = {1, 3, 7, 256, 1001, 2};
+    double values[1001];
+    for (unsigned int size = 0; size < 6; ++size) {
+        batch.getNoise(values, sizes[size]);
+        for (unsigned int i = 0; i < sizes[size]; ++i) {
+            CPPUNIT_ASSERT(-1.0 <= values[i] && values[i] <= 1.0);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(single.getNoise(), values[i], 0.0);
+        }
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(single.getNoise(), batch.getNoise(), 0.0);
+    }
+    CPPUNIT_ASSERT(single.getCounter() == batch.getCounter());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Tests the multiple stream batch gives each stream's values regardless of how the
+///         streams are batched.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsNoiseStream::testMultipleStreams()
+{
+    std::cout << "\n UtTsNoiseStream ...... 06: testMultipleStreams........................";
+
+    const unsigned int numStreams = 150;
+    TsNoiseStream singles[numStreams];
+    TsNoiseStream batches[numStreams];
+    TsNoiseStream* pointers[numStreams];
+    for (unsigned int i = 0; i < numStreams; ++i) {
+        singles[i].initialize(2026, i);
+        batches[i].initialize(2026, i);
+        pointers[i] = &batches[i];
+    }
+
+    // Advance some streams out of step with the others first.
+    for (unsigned int i = 0; i < numStreams; i += 3) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(singles[i].getNoise(), batches[i].getNoise(), 0.0);
+    }
+
+    // Fill all streams at once, then in two uneven parts with the later streams first.
+    double noise[numStreams];
+    for (int step = 0; step < 10; ++step) {
+        TsNoiseStream::getNoise(noise, pointers, numStreams);
+        for (unsigned int i = 0; i < numStreams; ++i) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(singles[i].getNoise(), noise[i], 0.0);
+        }
+        TsNoiseStream::getNoise(noise, pointers + 70, numStreams - 70);
+        TsNoiseStream::getNoise(noise + numStreams - 70, pointers, 70);
+        for (unsigned int i = 0; i < numStreams; ++i) {
+            const unsigned int j = (i + numStreams - 70) % numStreams;
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(singles[i].getNoise(), noise[j], 0.0);
+        }
+    }
+
+    // Each stream's noise is independent of the others.
+    CPPUNIT_ASSERT(noise[0] != noise[1]);
+
+    std::cout << "... Pass";
+}
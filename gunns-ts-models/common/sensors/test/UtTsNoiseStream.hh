@@ -0,0 +1,58 @@
+#ifndef UtTsNoiseStream_EXISTS
+#define UtTsNoiseStream_EXISTS
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_TS_SENSOR_NOISE_STREAM    Noise Stream Unit Tests
+/// @ingroup  UT_TS_SENSOR
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the noise stream model.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "common/sensors/TsNoiseStream.hh"
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Noise stream unit tests.
+///
+/// @details  This class provides the unit tests for the Noise Stream model within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtTsNoiseStream : public CppUnit::TestFixture {
+
+public:
+    UtTsNoiseStream();
+    virtual ~UtTsNoiseStream();
+    void setUp();
+    void tearDown();
+    void testPhilox();
+    void testRange();
+    void testDistribution();
+    void testRepeatability();
+    void testBatch();
+    void testMultipleStreams();
+private:
+    CPPUNIT_TEST_SUITE(UtTsNoiseStream);
+    CPPUNIT_TEST(testPhilox);
+    CPPUNIT_TEST(testRange);
+    CPPUNIT_TEST(testDistribution);
+    CPPUNIT_TEST(testRepeatability);
+    CPPUNIT_TEST(testBatch);
+    CPPUNIT_TEST(testMultipleStreams);
+    CPPUNIT_TEST_SUITE_END();
+    /// @brief Copy constructor is not implemented.
+    UtTsNoiseStream(const UtTsNoiseStream &rhs);
+    /// @brief Assignment operator is not implemented.
+    UtTsNoiseStream& operator= (const UtTsNoiseStream &rhs);
+};
+
+/// @}
+
+#endif
@@ -10,6 +10,7 @@
 #include "UtTsLimitSwitch.hh"
 #include "UtTsLimitSwitchAnalog.hh"
 #include "UtTsNoise.hh"
+#include "UtTsNoiseStream.hh"
 #include "UtTsOpticSmokeDetector.hh"
 #include "UtSensorBase.hh"
 #include "UtSensorAnalog.hh"
@@ -49,6 +50,7 @@ int main(int argc, char** argv) {
    CppUnit::TextTestRunner runner;
 
    runner.addTest( UtTsNoise::suite() );
+   runner.addTest( UtTsNoiseStream::suite() );
    runner.addTest( UtTsLimitSwitch::suite() );
    runner.addTest( UtTsLimitSwitchAnalog::suite() );
    runner.addTest( UtTsOpticSmokeDetector::suite() );
@@ -10,6 +10,7 @@ LIBRARY DEPENDENCY:
 */
 
 #include "Distributed2WayBusBase.hh"
+#include <algorithm>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] level   (--) Severity level of the message.
@@ -97,6 +98,51 @@ Distributed2WayBusBaseInterfaceData& Distributed2WayBusBaseInterfaceData::operat
     return *this;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  Size in bytes of this data packed into a flat frame.
+///
+/// @details  Returns the size of the frame packed by packFrame.  Derived classes override this to
+///           add the size of their own data to this.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int Distributed2WayBusBaseInterfaceData::getFrameSize() const
+{
+    return sizeof(mFrameCount) + sizeof(mFrameLoopback) + sizeof(mDemandMode);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] frame  (--)  Flat frame of at least getFrameSize() bytes to pack into.
+///
+/// @returns  unsigned int  (--)  Number of bytes packed.
+///
+/// @details  Packs this data into a flat frame, for transports that can't send this object
+///           directly, such as shared memory.  Derived classes override this to pack their own data
+///           after the bytes returned by this.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int Distributed2WayBusBaseInterfaceData::packFrame(unsigned char* frame) const
+{
+    unsigned int offset = 0;
+    packValue(frame, offset, mFrameCount);
+    packValue(frame, offset, mFrameLoopback);
+    packValue(frame, offset, mDemandMode);
+    return offset;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] frame  (--)  Flat frame packed by packFrame to unpack from.
+///
+/// @returns  unsigned int  (--)  Number of bytes unpacked.
+///
+/// @details  Unpacks this data from a flat frame packed by another instance's packFrame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int Distributed2WayBusBaseInterfaceData::unpackFrame(const unsigned char* frame)
+{
+    unsigned int offset = 0;
+    unpackValue(frame, offset, mFrameCount);
+    unpackValue(frame, offset, mFrameLoopback);
+    unpackValue(frame, offset, mDemandMode);
+    return offset;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] inDataPtr  (--) Pointer to the interface incoming data object.
 /// @param[in] outDataPtr (--) Pointer to the interface outgoing data object.
@@ -176,3 +222,92 @@ unsigned int Distributed2WayBusBase::popNotification(Distributed2WayBusNotificat
     }
     return mNotifications.size();
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Distributed 2-Way Bus Lag Predictor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+Distributed2WayBusLagPredictor::Distributed2WayBusLagPredictor()
+    :
+    mRateFilterGain(0.5),
+    mMaxHorizon(8.0),
+    mValid(false),
+    mLastFrameCount(0),
+    mLastValue(0.0),
+    mRate(0.0),
+    mHorizon(0.0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Distributed 2-Way Bus Lag Predictor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+Distributed2WayBusLagPredictor::~Distributed2WayBusLagPredictor()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] rateFilterGain (--) Filter gain on new rates of change, limited to 0-1.
+/// @param[in] maxHorizon     (--) Maximum number of frames to extrapolate by, limited to >= 0.
+///
+/// @details  Initializes this Distributed 2-Way Bus Lag Predictor with the given filter gain and
+///           extrapolation limit, and discards the received value history.  A smaller filter gain
+///           reduces overshoot from step changes in the received value, at the cost of slower
+///           response to ramps.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Distributed2WayBusLagPredictor::initialize(const double rateFilterGain, const double maxHorizon)
+{
+    mRateFilterGain = std::min(1.0, std::max(0.0, rateFilterGain));
+    mMaxHorizon     = std::max(0.0, maxHorizon);
+    reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Discards the received value history, so the next value is not extrapolated.  This
+///           should be called when the received value changes meaning, such as on a role change.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Distributed2WayBusLagPredictor::reset()
+{
+    mValid          = false;
+    mLastFrameCount = 0;
+    mLastValue      = 0.0;
+    mRate           = 0.0;
+    mHorizon        = 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] value       (--) The value received from the other side.
+/// @param[in] frameCount  (--) The other side's frame count sent with the value.
+/// @param[in] loopLatency (--) The measured round-trip loop lag, in frames.
+///
+/// @returns  double (--) The received value extrapolated across the data lag.
+///
+/// @details  Updates the rate of change of the received value when a new frame is received, and
+///           returns the value extrapolated by half the loop lag, limited to mMaxHorizon frames.
+///           The rate is per frame of the other side, which is assumed to run at the same rate as
+///           this side.  Repeated frames keep the last rate.  The history restarts when the other
+///           side's frame count resets, and nothing is extrapolated until the loop lag is known.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double Distributed2WayBusLagPredictor::predict(const double       value,
+                                               const unsigned int frameCount,
+                                               const int          loopLatency)
+{
+    if (not mValid or frameCount < mLastFrameCount) {
+        mValid          = (frameCount > 0);
+        mLastFrameCount = frameCount;
+        mLastValue      = value;
+        mRate           = 0.0;
+    } else if (frameCount > mLastFrameCount) {
+        const double newRate = (value - mLastValue) / static_cast<double>(frameCount - mLastFrameCount);
+        mRate          += mRateFilterGain * (newRate - mRate);
+        mLastFrameCount = frameCount;
+        mLastValue      = value;
+    }
+
+    mHorizon = 0.0;
+    if (loopLatency > 0) {
+        mHorizon = std::min(mMaxHorizon, 0.5 * static_cast<double>(loopLatency));
+    }
+    return value + mRate * mHorizon;
+}
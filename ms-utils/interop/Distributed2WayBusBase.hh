@@ -30,6 +30,7 @@ PROGRAMMERS:
 @{
 */
 
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -56,6 +57,20 @@ class Distributed2WayBusBaseInterfaceData // !!! NOTE this must remain a base cl
         virtual bool hasValidData() const = 0;
         /// @brief Assignment operator for this Distributed 2-Way Bus Base interface data.
         Distributed2WayBusBaseInterfaceData& operator =(const Distributed2WayBusBaseInterfaceData& that);
+        /// @brief Returns the size of this data packed into a flat frame.
+        virtual unsigned int getFrameSize() const;
+        /// @brief Packs this data into the given flat frame.
+        virtual unsigned int packFrame(unsigned char* frame) const;
+        /// @brief Unpacks this data from the given flat frame.
+        virtual unsigned int unpackFrame(const unsigned char* frame);
+
+    protected:
+        /// @brief Packs a value into a flat frame and advances the offset.
+        template <typename T>
+        static void packValue(unsigned char* frame, unsigned int& offset, const T& value);
+        /// @brief Unpacks a value from a flat frame and advances the offset.
+        template <typename T>
+        static void unpackValue(const unsigned char* frame, unsigned int& offset, T& value);
 
     private:
         /// @brief Copy constructor unavailable since declared private and not implemented.
@@ -119,6 +134,8 @@ class Distributed2WayBusBase
         void resetForceRole();
         /// @brief Returns whether this Distributed 2-Way Bus Interface is in the Demand role.
         bool isInDemandRole() const;
+        /// @brief Returns the round-trip loop data lag measurement.
+        int getLoopLatency() const;
         /// @brief Pops a notification message off of the queue and returns the remaining queue size.
         unsigned int popNotification(Distributed2WayBusNotification& notification);
 
@@ -144,8 +161,89 @@ class Distributed2WayBusBase
         Distributed2WayBusBase& operator =(const Distributed2WayBusBase& that);
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Distributed 2-Way Bus Lag Predictor
+///
+/// @details  This extrapolates a value received from the other side of the interface across the
+///           data lag, to estimate the other side's current value.  The value's rate of change is
+///           taken from successive values received with different frame counts, and is filtered to
+///           reduce the overshoot from step changes.  The value is extrapolated by half of the
+///           measured round-trip loop lag, which is the age of the received data if the lag is the
+///           same in both directions.
+///
+///           This should only be used for potential-like values such as pressure and voltage,
+///           not for flows that must be conserved across the interface.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class Distributed2WayBusLagPredictor
+{
+    public:
+        /// @brief Default constructs this Distributed 2-Way Bus Lag Predictor.
+        Distributed2WayBusLagPredictor();
+        /// @brief Default destructs this Distributed 2-Way Bus Lag Predictor.
+        virtual ~Distributed2WayBusLagPredictor();
+        /// @brief Initializes this Distributed 2-Way Bus Lag Predictor.
+        void initialize(const double rateFilterGain = 0.5, const double maxHorizon = 8.0);
+        /// @brief Discards the received value history.
+        void reset();
+        /// @brief Returns the given received value extrapolated across the data lag.
+        double predict(const double value, const unsigned int frameCount, const int loopLatency);
+        /// @brief Returns the filtered rate of change of the received value.
+        double getRate() const;
+        /// @brief Returns the number of frames the last value was extrapolated by.
+        double getHorizon() const;
+
+    protected:
+        double       mRateFilterGain; /**< (1)       trick_chkpnt_io(**) Filter gain on new rates of change, 0-1. */
+        double       mMaxHorizon;     /**< (1)       trick_chkpnt_io(**) Maximum number of frames to extrapolate by. */
+        bool         mValid;          /**< (1)                           The last received value is valid for computing rates. */
+        unsigned int mLastFrameCount; /**< (1)                           The other side's frame count of the last received value. */
+        double       mLastValue;      /**< (1)                           The last received value. */
+        double       mRate;           /**< (1/frame)                     Filtered rate of change of the received value. */
+        double       mHorizon;        /**< (1)                           Number of frames the last value was extrapolated by. */
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        Distributed2WayBusLagPredictor(const Distributed2WayBusLagPredictor& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        Distributed2WayBusLagPredictor& operator =(const Distributed2WayBusLagPredictor& that);
+};
+
 /// @}
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]     frame  (--) Flat frame to pack into.
+/// @param[in,out] offset (--) Byte offset in the frame to pack at, advanced past the value.
+/// @param[in]     value  (--) Value to pack.
+///
+/// @details  Copies the bytes of the given value into the frame at the offset.  The frame has no
+///           alignment or byte order conversion, since it is only exchanged between instances
+///           built for the same host.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+inline void Distributed2WayBusBaseInterfaceData::packValue(unsigned char*      frame,
+                                                           unsigned int&       offset,
+                                                           const T&            value)
+{
+    std::memcpy(frame + offset, &value, sizeof(T));
+    offset += sizeof(T);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]     frame  (--) Flat frame to unpack from.
+/// @param[in,out] offset (--) Byte offset in the frame to unpack at, advanced past the value.
+/// @param[out]    value  (--) Value to unpack.
+///
+/// @details  Copies the bytes of the given value from the frame at the offset.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+inline void Distributed2WayBusBaseInterfaceData::unpackValue(const unsigned char* frame,
+                                                             unsigned int&        offset,
+                                                             T&                   value)
+{
+    std::memcpy(&value, frame + offset, sizeof(T));
+    offset += sizeof(T);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Sets the mForcedRole attribute to DEMAND.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -180,6 +278,16 @@ inline bool Distributed2WayBusBase::isInDemandRole() const
     return mOutDataPtr->mDemandMode;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (1) Round-trip loop data lag measurement, in frames.
+///
+/// @details  Returns the value of mLoopLatency.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int Distributed2WayBusBase::getLoopLatency() const
+{
+    return mLoopLatency;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] level   (--) Severity level of the message.
 /// @param[in] message (--) Detailed message string.
@@ -193,4 +301,24 @@ inline void Distributed2WayBusBase::pushNotification(
     mNotifications.push_back(Distributed2WayBusNotification(level, message));
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (1/frame) Filtered rate of change of the received value.
+///
+/// @details  Returns the value of mRate.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double Distributed2WayBusLagPredictor::getRate() const
+{
+    return mRate;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (1) Number of frames the last value was extrapolated by.
+///
+/// @details  Returns the value of mHorizon.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double Distributed2WayBusLagPredictor::getHorizon() const
+{
+    return mHorizon;
+}
+
 #endif
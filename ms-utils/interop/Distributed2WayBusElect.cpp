@@ -47,6 +47,47 @@ Distributed2WayBusElectInterfaceData& Distributed2WayBusElectInterfaceData::oper
     return *this;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  Size in bytes of this data packed into a flat frame.
+///
+/// @details  Returns the base class frame size plus the size of this class's data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int Distributed2WayBusElectInterfaceData::getFrameSize() const
+{
+    return Distributed2WayBusBaseInterfaceData::getFrameSize()
+         + sizeof(mDemandPower) + sizeof(mSupplyVoltage);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] frame  (--)  Flat frame of at least getFrameSize() bytes to pack into.
+///
+/// @returns  unsigned int  (--)  Number of bytes packed.
+///
+/// @details  Packs the base class data followed by this class's data into the flat frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int Distributed2WayBusElectInterfaceData::packFrame(unsigned char* frame) const
+{
+    unsigned int offset = Distributed2WayBusBaseInterfaceData::packFrame(frame);
+    packValue(frame, offset, mDemandPower);
+    packValue(frame, offset, mSupplyVoltage);
+    return offset;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] frame  (--)  Flat frame packed by packFrame to unpack from.
+///
+/// @returns  unsigned int  (--)  Number of bytes unpacked.
+///
+/// @details  Unpacks the base class data followed by this class's data from the flat frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int Distributed2WayBusElectInterfaceData::unpackFrame(const unsigned char* frame)
+{
+    unsigned int offset = Distributed2WayBusBaseInterfaceData::unpackFrame(frame);
+    unpackValue(frame, offset, mDemandPower);
+    unpackValue(frame, offset, mSupplyVoltage);
+    return offset;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Electrical Distributed 2-Way Bus Interface default constructor.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -68,6 +68,12 @@ class Distributed2WayBusElectInterfaceData : public Distributed2WayBusBaseInterf
         virtual bool hasValidData() const;
         /// @brief Assignment operator for this Electrical Distributed 2-Way Bus interface data.
         Distributed2WayBusElectInterfaceData& operator =(const Distributed2WayBusElectInterfaceData& that);
+        /// @brief Returns the size of this data packed into a flat frame.
+        virtual unsigned int getFrameSize() const;
+        /// @brief Packs this data into the given flat frame.
+        virtual unsigned int packFrame(unsigned char* frame) const;
+        /// @brief Unpacks this data from the given flat frame.
+        virtual unsigned int unpackFrame(const unsigned char* frame);
 
     private:
         /// @brief Copy constructor unavailable since declared private and not implemented.
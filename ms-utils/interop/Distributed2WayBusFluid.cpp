@@ -10,8 +10,10 @@ LIBRARY DEPENDENCY:
 */
 
 #include "Distributed2WayBusFluid.hh"
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <cstring>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Default constructs this distributed fluid mixture data.
@@ -117,12 +119,8 @@ void FluidDistributedMixtureData::initialize(const unsigned int nBulk,
 void FluidDistributedMixtureData::setMoleFractions(const double* fractions, const unsigned int size)
 {
     const unsigned int smallerSize = std::min(mNumFluid, size);
-    for (unsigned int i=0; i<smallerSize; ++i) {
-        mMoleFractions[i] = fractions[i];
-    }
-    for (unsigned int i=smallerSize; i<mNumFluid; ++i) {
-        mMoleFractions[i] = 0.0;
-    }
+    std::copy(fractions, fractions + smallerSize, mMoleFractions);
+    std::fill(mMoleFractions + smallerSize, mMoleFractions + mNumFluid, 0.0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -136,12 +134,8 @@ void FluidDistributedMixtureData::setMoleFractions(const double* fractions, cons
 void FluidDistributedMixtureData::setTcMoleFractions(const double* fractions, const unsigned int size)
 {
     const unsigned int smallerSize = std::min(mNumTc, size);
-    for (unsigned int i=0; i<smallerSize; ++i) {
-        mTcMoleFractions[i] = fractions[i];
-    }
-    for (unsigned int i=smallerSize; i<mNumTc; ++i) {
-        mTcMoleFractions[i] = 0.0;
-    }
+    std::copy(fractions, fractions + smallerSize, mTcMoleFractions);
+    std::fill(mTcMoleFractions + smallerSize, mTcMoleFractions + mNumTc, 0.0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,12 +149,8 @@ void FluidDistributedMixtureData::setTcMoleFractions(const double* fractions, co
 void FluidDistributedMixtureData::getMoleFractions(double* fractions, const unsigned int size) const
 {
     const unsigned int smallerSize = std::min(mNumFluid, size);
-    for (unsigned int i=0; i<smallerSize; ++i) {
-        fractions[i] = mMoleFractions[i];
-    }
-    for (unsigned int i=smallerSize; i<size; ++i) {
-        fractions[i] = 0.0;
-    }
+    std::copy(mMoleFractions, mMoleFractions + smallerSize, fractions);
+    std::fill(fractions + smallerSize, fractions + size, 0.0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -174,12 +164,8 @@ void FluidDistributedMixtureData::getMoleFractions(double* fractions, const unsi
 void FluidDistributedMixtureData::getTcMoleFractions(double* fractions, const unsigned int size) const
 {
     const unsigned int smallerSize = std::min(mNumTc, size);
-    for (unsigned int i=0; i<smallerSize; ++i) {
-        fractions[i] = mTcMoleFractions[i];
-    }
-    for (unsigned int i=smallerSize; i<size; ++i) {
-        fractions[i] = 0.0;
-    }
+    std::copy(mTcMoleFractions, mTcMoleFractions + smallerSize, fractions);
+    std::fill(fractions + smallerSize, fractions + size, 0.0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -285,6 +271,69 @@ Distributed2WayBusFluidInterfaceData& Distributed2WayBusFluidInterfaceData::oper
     return *this;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  Size in bytes of this data packed into a flat frame.
+///
+/// @details  Returns the base class frame size plus the size of this class's data, including the
+///           mixture arrays.  Both sides of the interface must have the same mixture array sizes
+///           for their frames to match.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int Distributed2WayBusFluidInterfaceData::getFrameSize() const
+{
+    return Distributed2WayBusBaseInterfaceData::getFrameSize()
+         + sizeof(mEnergy) + sizeof(mCapacitance) + sizeof(mSource)
+         + (mNumFluid + mNumTc) * sizeof(double);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] frame  (--)  Flat frame of at least getFrameSize() bytes to pack into.
+///
+/// @returns  unsigned int  (--)  Number of bytes packed.
+///
+/// @details  Packs the base class data followed by this class's data into the flat frame.  The
+///           mixture arrays are each packed with a single block copy.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int Distributed2WayBusFluidInterfaceData::packFrame(unsigned char* frame) const
+{
+    unsigned int offset = Distributed2WayBusBaseInterfaceData::packFrame(frame);
+    packValue(frame, offset, mEnergy);
+    packValue(frame, offset, mCapacitance);
+    packValue(frame, offset, mSource);
+    if (mNumFluid > 0) {
+        std::memcpy(frame + offset, mMoleFractions, mNumFluid * sizeof(double));
+        offset += mNumFluid * sizeof(double);
+    }
+    if (mNumTc > 0) {
+        std::memcpy(frame + offset, mTcMoleFractions, mNumTc * sizeof(double));
+        offset += mNumTc * sizeof(double);
+    }
+    return offset;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] frame  (--)  Flat frame packed by packFrame to unpack from.
+///
+/// @returns  unsigned int  (--)  Number of bytes unpacked.
+///
+/// @details  Unpacks the base class data followed by this class's data from the flat frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int Distributed2WayBusFluidInterfaceData::unpackFrame(const unsigned char* frame)
+{
+    unsigned int offset = Distributed2WayBusBaseInterfaceData::unpackFrame(frame);
+    unpackValue(frame, offset, mEnergy);
+    unpackValue(frame, offset, mCapacitance);
+    unpackValue(frame, offset, mSource);
+    if (mNumFluid > 0) {
+        std::memcpy(mMoleFractions, frame + offset, mNumFluid * sizeof(double));
+        offset += mNumFluid * sizeof(double);
+    }
+    if (mNumTc > 0) {
+        std::memcpy(mTcMoleFractions, frame + offset, mNumTc * sizeof(double));
+        offset += mNumTc * sizeof(double);
+    }
+    return offset;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @returns  (--)  True if all data validation checks passed.
 ///
@@ -99,6 +99,12 @@ class Distributed2WayBusFluidInterfaceData : public FluidDistributedMixtureData,
         virtual bool hasValidData() const;
         /// @brief Assignment operator for this Fluid Distributed 2-Way Bus interface data.
         Distributed2WayBusFluidInterfaceData& operator =(const Distributed2WayBusFluidInterfaceData& that);
+        /// @brief Returns the size of this data packed into a flat frame.
+        virtual unsigned int getFrameSize() const;
+        /// @brief Packs this data into the given flat frame.
+        virtual unsigned int packFrame(unsigned char* frame) const;
+        /// @brief Unpacks this data from the given flat frame.
+        virtual unsigned int unpackFrame(const unsigned char* frame);
 
     private:
         /// @brief Copy constructor unavailable since declared private and not implemented.
@@ -0,0 +1,426 @@
+/**
+@file     Distributed2WayBusShm.cpp
+@brief    Distributed 2-Way Bus Shared Memory Transport implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   ((Distributed2WayBusBase.o))
+*/
+
+#include "Distributed2WayBusShm.hh"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>     //needed for open()
+#include <sstream>
+#include <sys/mman.h>  //needed for mmap()
+#include <sys/stat.h>  //needed for fstat()
+#include <unistd.h>    //needed for ftruncate(), close(), unlink()
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Distributed 2-Way Bus shared memory channel.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+Distributed2WayBusShmChannel::Distributed2WayBusShmChannel()
+    :
+    mHeader(0),
+    mSlots(0),
+    mFrameSize(0),
+    mNumSlots(0),
+    mSlotSize(0),
+    mWriteSequence(0),
+    mReadSequence(0),
+    mNumDropped(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Distributed 2-Way Bus shared memory channel.  The channel
+///           memory is owned by the caller and is not freed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+Distributed2WayBusShmChannel::~Distributed2WayBusShmChannel()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] frameSize (--) Size in bytes of each frame.
+///
+/// @returns  unsigned int  (--)  Size in bytes of each slot.
+///
+/// @details  Each slot is the slot's sequence number followed by the frame, padded so the next
+///           slot's sequence number is 8-byte aligned for atomic access.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int Distributed2WayBusShmChannel::getSlotSize(const unsigned int frameSize)
+{
+    return sizeof(unsigned long long) + ((frameSize + 7) & ~7u);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] frameSize (--) Size in bytes of each frame.
+/// @param[in] numSlots  (--) Number of frame slots in the ring.
+///
+/// @returns  unsigned int  (--)  Size in bytes of the channel memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int Distributed2WayBusShmChannel::getMemorySize(const unsigned int frameSize,
+                                                         const unsigned int numSlots)
+{
+    return sizeof(Distributed2WayBusShmChannelHeader) + numSlots * getSlotSize(frameSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] memory    (--) Pointer to 8-byte aligned memory of at least getMemorySize() bytes.
+/// @param[in] frameSize (--) Size in bytes of each frame.
+/// @param[in] numSlots  (--) Number of frame slots in the ring, at least 2.
+///
+/// @details  Clears the given memory, sets up the channel header and attaches to it.  The magic
+///           number is stored last, so the other side doesn't attach to a partial header.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Distributed2WayBusShmChannel::create(unsigned char*     memory,
+                                          const unsigned int frameSize,
+                                          const unsigned int numSlots)
+{
+    std::memset(memory, 0, getMemorySize(frameSize, numSlots));
+    mHeader             = reinterpret_cast<Distributed2WayBusShmChannelHeader*>(memory);
+    mHeader->mFrameSize = frameSize;
+    mHeader->mNumSlots  = numSlots;
+    __atomic_store_n(&mHeader->mMagic, MAGIC, __ATOMIC_RELEASE);
+
+    mSlots         = memory + sizeof(Distributed2WayBusShmChannelHeader);
+    mFrameSize     = frameSize;
+    mNumSlots      = numSlots;
+    mSlotSize      = getSlotSize(frameSize);
+    mWriteSequence = 0;
+    mReadSequence  = 0;
+    mNumDropped    = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] memory    (--) Pointer to the channel memory created by the other side.
+/// @param[in] frameSize (--) Size in bytes of each frame this side expects.
+///
+/// @returns  bool  (--)  True if attached, false if the channel isn't created yet or its frame size
+///                       doesn't match.
+///
+/// @details  Attaches to a channel created by the other side.  The number of slots is taken from
+///           the channel header.  Writing resumes after the last frame written to the channel, and
+///           reading starts with the newest frame in the channel.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Distributed2WayBusShmChannel::attach(unsigned char* memory, const unsigned int frameSize)
+{
+    Distributed2WayBusShmChannelHeader* header =
+            reinterpret_cast<Distributed2WayBusShmChannelHeader*>(memory);
+    if (MAGIC != __atomic_load_n(&header->mMagic, __ATOMIC_ACQUIRE)
+            or frameSize != header->mFrameSize or header->mNumSlots < 2) {
+        return false;
+    }
+
+    mHeader        = header;
+    mSlots         = memory + sizeof(Distributed2WayBusShmChannelHeader);
+    mFrameSize     = frameSize;
+    mNumSlots      = header->mNumSlots;
+    mSlotSize      = getSlotSize(frameSize);
+    mWriteSequence = __atomic_load_n(&header->mWriteSequence, __ATOMIC_ACQUIRE);
+    mReadSequence  = 0;
+    mNumDropped    = 0;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Detaches from the channel memory, without changing it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Distributed2WayBusShmChannel::detach()
+{
+    mHeader = 0;
+    mSlots  = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] sequence (--) Frame sequence number.
+///
+/// @returns  unsigned long long*  (--)  Pointer to the sequence number of the slot for the frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned long long* Distributed2WayBusShmChannel::getSlotSequence(
+        const unsigned long long sequence) const
+{
+    return reinterpret_cast<unsigned long long*>(mSlots + (sequence % mNumSlots) * mSlotSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] frame (--) Frame of mFrameSize bytes to write.
+///
+/// @details  Copies the frame into the next slot in the ring, then publishes its sequence number in
+///           the slot and the channel header.  The slot's sequence number is cleared during the
+///           copy, so a reader of that slot knows to retry.  This never waits on the reader.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Distributed2WayBusShmChannel::write(const unsigned char* frame)
+{
+    if (not mHeader) {
+        return;
+    }
+    const unsigned long long sequence = mWriteSequence + 1;
+    unsigned long long* slotSequence  = getSlotSequence(sequence);
+
+    __atomic_store_n(slotSequence, 0ull, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    std::memcpy(slotSequence + 1, frame, mFrameSize);
+    __atomic_store_n(slotSequence, sequence, __ATOMIC_RELEASE);
+    __atomic_store_n(&mHeader->mWriteSequence, sequence, __ATOMIC_RELEASE);
+    mWriteSequence = sequence;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] frame (--) Frame of mFrameSize bytes to read into.
+///
+/// @returns  bool  (--)  True if a new frame was read, false if there is no new frame since the
+///                       last read or the writer kept overwriting the frame during the read.
+///
+/// @details  Copies the newest frame out of its slot.  If the slot's sequence number changed during
+///           the copy, the writer has lapped this reader, so this retries with the writer's newest
+///           frame.  Any frames between the last frame read and this one are counted as dropped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Distributed2WayBusShmChannel::read(unsigned char* frame)
+{
+    if (not mHeader) {
+        return false;
+    }
+    for (unsigned int i = 0; i < MAX_READ_TRIES; ++i) {
+        const unsigned long long sequence =
+                __atomic_load_n(&mHeader->mWriteSequence, __ATOMIC_ACQUIRE);
+        if (0 == sequence or mReadSequence == sequence) {
+            return false;
+        }
+        unsigned long long* slotSequence = getSlotSequence(sequence);
+        if (sequence != __atomic_load_n(slotSequence, __ATOMIC_ACQUIRE)) {
+            continue;
+        }
+        std::memcpy(frame, slotSequence + 1, mFrameSize);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (sequence != __atomic_load_n(slotSequence, __ATOMIC_RELAXED)) {
+            continue;
+        }
+        if (0 != mReadSequence and sequence > mReadSequence + 1) {
+            mNumDropped += sequence - mReadSequence - 1;
+        }
+        mReadSequence = sequence;
+        return true;
+    }
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Distributed 2-Way Bus shared memory transport.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+Distributed2WayBusShm::Distributed2WayBusShm()
+    :
+    mPath(),
+    mIsCreator(false),
+    mMemory(0),
+    mMemorySize(0),
+    mFrameSize(0),
+    mTxChannel(),
+    mRxChannel(),
+    mFrame(),
+    mLastError()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Distributed 2-Way Bus shared memory transport, closing the
+///           shared memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+Distributed2WayBusShm::~Distributed2WayBusShm()
+{
+    close();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] path      (--) Path of the shared memory file, such as in /dev/shm.
+/// @param[in] frameSize (--) Size in bytes of the interface data frames, from getFrameSize().
+/// @param[in] isCreator (--) True if this side creates the file, false if it attaches to it.
+/// @param[in] numSlots  (--) Number of frame slots in each channel, only used by the creator.
+///
+/// @returns  bool  (--)  True if the shared memory is open, false if there was an error.
+///
+/// @details  The creator creates the file, sizes and maps it, and sets up both channels.  The
+///           attacher maps the existing file and attaches to both channels, which fails if the
+///           creator hasn't set them up yet; the attacher may simply call this again later.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Distributed2WayBusShm::open(const std::string& path,
+                                 const unsigned int frameSize,
+                                 const bool         isCreator,
+                                 const unsigned int numSlots)
+{
+    close();
+    if (0 == frameSize) {
+        return setError("frame size is zero.");
+    }
+    if (isCreator and numSlots < 2) {
+        return setError("number of slots is less than 2.");
+    }
+
+    int fd = 0;
+    if (isCreator) {
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    } else {
+        fd = ::open(path.c_str(), O_RDWR);
+    }
+    if (fd < 0) {
+        return setError("cannot open " + path + ": " + std::strerror(errno));
+    }
+
+    /// - The creator sizes the file for both channels.  The attacher maps the file as sized by the
+    ///   creator, then checks it against the channel headers.
+    unsigned int size = 0;
+    if (isCreator) {
+        size = 2 * Distributed2WayBusShmChannel::getMemorySize(frameSize, numSlots);
+        if (0 != ftruncate(fd, size)) {
+            const std::string error = std::strerror(errno);
+            ::close(fd);
+            unlink(path.c_str());
+            return setError("cannot size " + path + ": " + error);
+        }
+    } else {
+        struct stat status;
+        if (0 != fstat(fd, &status) or
+                static_cast<size_t>(status.st_size) < sizeof(Distributed2WayBusShmChannelHeader)) {
+            ::close(fd);
+            return setError(path + " is not created yet.");
+        }
+        size = static_cast<unsigned int>(status.st_size);
+    }
+
+    void* memory = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (MAP_FAILED == memory) {
+        if (isCreator) {
+            unlink(path.c_str());
+        }
+        return setError("cannot map " + path + ": " + std::strerror(errno));
+    }
+
+    mPath       = path;
+    mIsCreator  = isCreator;
+    mMemory     = static_cast<unsigned char*>(memory);
+    mMemorySize = size;
+    mFrameSize  = frameSize;
+    mFrame.assign(frameSize, 0);
+
+    if (isCreator) {
+        const unsigned int channelSize = size / 2;
+        mTxChannel.create(mMemory,               frameSize, numSlots);
+        mRxChannel.create(mMemory + channelSize, frameSize, numSlots);
+    } else {
+        const Distributed2WayBusShmChannelHeader* header =
+                reinterpret_cast<const Distributed2WayBusShmChannelHeader*>(mMemory);
+        if (Distributed2WayBusShmChannel::MAGIC != __atomic_load_n(&header->mMagic, __ATOMIC_ACQUIRE)) {
+            close();
+            return setError(path + " is not created yet.");
+        }
+        if (frameSize != header->mFrameSize) {
+            std::ostringstream msg;
+            msg << path << " frame size " << header->mFrameSize << " doesn't match " << frameSize << ".";
+            close();
+            return setError(msg.str());
+        }
+        const unsigned int channelSize =
+                Distributed2WayBusShmChannel::getMemorySize(frameSize, header->mNumSlots);
+        if (size < 2 * channelSize
+                or not mRxChannel.attach(mMemory,               frameSize)
+                or not mTxChannel.attach(mMemory + channelSize, frameSize)) {
+            close();
+            return setError(path + " is not created yet.");
+        }
+    }
+    mLastError.clear();
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Unmaps the shared memory.  The creator also removes the file, which the other side
+///           keeps mapped until it closes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Distributed2WayBusShm::close()
+{
+    mTxChannel.detach();
+    mRxChannel.detach();
+    if (mMemory) {
+        munmap(mMemory, mMemorySize);
+        if (mIsCreator) {
+            unlink(mPath.c_str());
+        }
+    }
+    mMemory     = 0;
+    mMemorySize = 0;
+    mIsCreator  = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] data (--) Interface data to send.
+///
+/// @returns  bool  (--)  True if the data was sent, false if there was an error.
+///
+/// @details  Packs the given interface data into a frame and writes it as the newest frame to the
+///           other side.  This never waits on the other side.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Distributed2WayBusShm::transmit(const Distributed2WayBusBaseInterfaceData& data)
+{
+    if (not checkFrameSize(data)) {
+        return false;
+    }
+    data.packFrame(&mFrame[0]);
+    mTxChannel.write(&mFrame[0]);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] data (--) Interface data to receive into.
+///
+/// @returns  bool  (--)  True if new data was received, false if there was no new data or an error.
+///
+/// @details  Reads the newest frame from the other side and unpacks it into the given interface
+///           data.  The data is unchanged if there is no new frame since the last receive.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Distributed2WayBusShm::receive(Distributed2WayBusBaseInterfaceData& data)
+{
+    if (not checkFrameSize(data)) {
+        return false;
+    }
+    if (not mRxChannel.read(&mFrame[0])) {
+        return false;
+    }
+    data.unpackFrame(&mFrame[0]);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] data (--) Interface data to check.
+///
+/// @returns  bool  (--)  True if the shared memory is open and the data matches its frame size.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Distributed2WayBusShm::checkFrameSize(const Distributed2WayBusBaseInterfaceData& data)
+{
+    if (not mMemory) {
+        return setError("shared memory is not open.");
+    }
+    if (data.getFrameSize() != mFrameSize) {
+        std::ostringstream msg;
+        msg << "interface data frame size " << data.getFrameSize() << " doesn't match "
+            << mFrameSize << ".";
+        return setError(msg.str());
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] error (--) Description of the error.
+///
+/// @returns  bool  (--)  Always false.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Distributed2WayBusShm::setError(const std::string& error)
+{
+    mLastError = "Distributed2WayBusShm: " + error;
+    return false;
+}
@@ -0,0 +1,283 @@
+#ifndef Distributed2WayBusShm_EXISTS
+#define Distributed2WayBusShm_EXISTS
+
+/**
+@file     Distributed2WayBusShm.hh
+@brief    Distributed 2-Way Bus Shared Memory Transport declarations
+
+@defgroup  TSM_INTEROP_DISTR_2WAY_BUS_SHM    Distributed 2-Way Bus Shared Memory Transport
+@ingroup   TSM_INTEROP
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Classes for exchanging Distributed 2-Way Bus interface data between sims on the same host through
+   a memory-mapped file, without a middleware transport such as HLA.)
+
+REFERENCE:
+- ()
+
+ASSUMPTIONS AND LIMITATIONS:
+- ((Both sides of the interface run on the same host, and are built for the same architecture.)
+   (Each direction of the interface has exactly one writer and one reader.)
+   (Both sides' interface data objects pack to the same frame size, e.g. the same fluid mixture
+    sizes.)
+   (The reader only receives the newest frame; older frames overwritten before they are read are
+    counted as dropped.)
+   (The sim moves the interface data between this and the Distributed 2-Way Bus or
+    GunnsFluidDistributedIf objects; they don't use this transport on their own.))
+
+LIBRARY DEPENDENCY:
+- ((Distributed2WayBusShm.o))
+
+PROGRAMMERS:
+- ()
+
+@{
+*/
+
+#include "Distributed2WayBusBase.hh"
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Distributed 2-Way Bus Shared Memory Channel Header
+///
+/// @details  This is the header of one channel in the shared memory region.  It is followed in the
+///           region by the channel's frame slots.  It must remain plain old data, since it is
+///           shared between processes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct Distributed2WayBusShmChannelHeader
+{
+    unsigned int       mMagic;         /**< (1) Marks the channel as initialized by the creator. */
+    unsigned int       mFrameSize;     /**< (1) Size in bytes of each frame. */
+    unsigned int       mNumSlots;      /**< (1) Number of frame slots in the ring. */
+    unsigned int       mPad;           /**< (1) Pads the header to 8-byte alignment. */
+    unsigned long long mWriteSequence; /**< (1) Sequence number of the last frame written. */
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Distributed 2-Way Bus Shared Memory Channel
+///
+/// @details  This is one direction of the shared memory transport: a ring of frame slots with a
+///           single writer and a single reader.  Each slot holds a frame and the sequence number of
+///           the frame, which the writer clears while it copies the frame into the slot.  The
+///           reader copies the newest frame out of its slot, and retries if the slot's sequence
+///           number changes during the copy.  Neither side ever blocks the other.
+///
+///           With the default of 3 slots, the writer can write 2 more frames during the reader's
+///           copy before it can overwrite the slot being read.
+///
+///           The writer numbers the frames starting at 1.  The reader compares the sequence
+///           numbers it receives to detect new frames, and frames dropped between its reads.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class Distributed2WayBusShmChannel
+{
+    public:
+        /// @brief  Magic number marking an initialized channel header.
+        static const unsigned int MAGIC = 0x44324253;
+        /// @brief  Default constructs this Distributed 2-Way Bus shared memory channel.
+        Distributed2WayBusShmChannel();
+        /// @brief  Default destructs this Distributed 2-Way Bus shared memory channel.
+        virtual ~Distributed2WayBusShmChannel();
+        /// @brief  Returns the size of the memory for a channel with the given frame size and slots.
+        static unsigned int getMemorySize(const unsigned int frameSize, const unsigned int numSlots);
+        /// @brief  Initializes the given memory as a new channel and attaches to it.
+        void create(unsigned char* memory, const unsigned int frameSize, const unsigned int numSlots);
+        /// @brief  Attaches to a channel in the given memory, created by the other side.
+        bool attach(unsigned char* memory, const unsigned int frameSize);
+        /// @brief  Detaches from the channel memory.
+        void detach();
+        /// @brief  Writes the given frame to the channel as the newest frame.
+        void write(const unsigned char* frame);
+        /// @brief  Reads the newest frame from the channel, if there is a new one.
+        bool read(unsigned char* frame);
+        /// @brief  Returns whether this is attached to channel memory.
+        bool isAttached() const;
+        /// @brief  Returns the sequence number of the last frame written by this channel.
+        unsigned long long getWriteSequence() const;
+        /// @brief  Returns the sequence number of the last frame read by this channel.
+        unsigned long long getReadSequence() const;
+        /// @brief  Returns the number of frames written but not read by this channel.
+        unsigned long long getNumDroppedFrames() const;
+
+    protected:
+        Distributed2WayBusShmChannelHeader* mHeader;        /**< ** (1) Pointer to the channel header in shared memory. */
+        unsigned char*                      mSlots;         /**< ** (1) Pointer to the first frame slot in shared memory. */
+        unsigned int                        mFrameSize;     /**<    (1) Size in bytes of each frame. */
+        unsigned int                        mNumSlots;      /**<    (1) Number of frame slots in the ring. */
+        unsigned int                        mSlotSize;      /**<    (1) Size in bytes of each slot, including its sequence number. */
+        unsigned long long                  mWriteSequence; /**<    (1) Sequence number of the last frame written. */
+        unsigned long long                  mReadSequence;  /**<    (1) Sequence number of the last frame read. */
+        unsigned long long                  mNumDropped;    /**<    (1) Number of frames written but not read. */
+        /// @brief  Maximum number of attempts to read a frame the writer is overwriting.
+        static const unsigned int MAX_READ_TRIES = 4;
+        /// @brief  Returns the size in bytes of each slot for the given frame size.
+        static unsigned int getSlotSize(const unsigned int frameSize);
+        /// @brief  Returns a pointer to the sequence number of the slot for the given sequence.
+        unsigned long long* getSlotSequence(const unsigned long long sequence) const;
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        Distributed2WayBusShmChannel(const Distributed2WayBusShmChannel&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        Distributed2WayBusShmChannel& operator =(const Distributed2WayBusShmChannel&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Distributed 2-Way Bus Shared Memory Transport
+///
+/// @details  This exchanges the interface data of a Distributed 2-Way Bus between two sims on the
+///           same host, through a file mapped into both sims' memory, such as in /dev/shm.  This is
+///           an alternative to a middleware transport such as HLA for co-hosted sims.
+///
+///           This is a standalone transport, not built into Distributed2WayBusBase or
+///           GunnsFluidDistributedIf, which leave the transport of their mInData and mOutData to the
+///           sim.  The sim calls transmit with the interface's mOutData after the interface updates
+///           it, and receive with its mInData before the interface processes it, in place of the
+///           middleware's send and receive.
+///
+///           This isn't zero-copy.  Each transmit packs the interface data into a scratch frame and
+///           copies the frame into a slot of the mapped memory, and each receive copies a slot out
+///           and unpacks it.  The copy out of the slot lets the reader detect and retry a frame the
+///           writer overwrote during the read.
+///
+///           One side creates the file and the other attaches to it.  The file holds a channel in
+///           each direction: the creator writes channel 0 and reads channel 1, and the attacher
+///           does the reverse.  Each frame of interface data is packed with the data's packFrame
+///           method and unpacked with unpackFrame, so any interface data type can be sent as long
+///           as both sides pack to the same frame size.
+///
+///           The frame counters in the interface data are still sent, so the Distributed 2-Way Bus
+///           loop latency measurement and role negotiation work the same over this transport.  The
+///           channel sequence numbers add detection of new and dropped frames.
+///
+///           Like the Distributed 2-Way Bus classes, this has no dependencies on 3rd-party code
+///           and doesn't throw exceptions; errors are returned and described by getLastError.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class Distributed2WayBusShm
+{
+    public:
+        /// @brief  Default constructs this Distributed 2-Way Bus shared memory transport.
+        Distributed2WayBusShm();
+        /// @brief  Default destructs this Distributed 2-Way Bus shared memory transport.
+        virtual ~Distributed2WayBusShm();
+        /// @brief  Creates or attaches to the shared memory file.
+        bool open(const std::string& path, const unsigned int frameSize, const bool isCreator,
+                  const unsigned int numSlots = 3);
+        /// @brief  Unmaps the shared memory, and removes the file if this side created it.
+        void close();
+        /// @brief  Sends the given interface data to the other side.
+        bool transmit(const Distributed2WayBusBaseInterfaceData& data);
+        /// @brief  Receives the newest interface data from the other side, if there is new data.
+        bool receive(Distributed2WayBusBaseInterfaceData& data);
+        /// @brief  Returns whether the shared memory is open.
+        bool isOpen() const;
+        /// @brief  Returns the description of the last error.
+        const std::string& getLastError() const;
+        /// @brief  Returns the sequence number of the last frame sent.
+        unsigned long long getTxSequence() const;
+        /// @brief  Returns the sequence number of the last frame received.
+        unsigned long long getRxSequence() const;
+        /// @brief  Returns the number of frames from the other side that were never received.
+        unsigned long long getNumDroppedFrames() const;
+
+    protected:
+        std::string                  mPath;       /**< *o (1) trick_chkpnt_io(**) Path of the shared memory file. */
+        bool                         mIsCreator;  /**< *o (1) trick_chkpnt_io(**) This side created the shared memory file. */
+        unsigned char*               mMemory;     /**< ** (1) Pointer to the mapped shared memory. */
+        unsigned int                 mMemorySize; /**< *o (1) trick_chkpnt_io(**) Size in bytes of the mapped shared memory. */
+        unsigned int                 mFrameSize;  /**< *o (1) trick_chkpnt_io(**) Size in bytes of each frame. */
+        Distributed2WayBusShmChannel mTxChannel;  /**< ** (1) Channel this side writes. */
+        Distributed2WayBusShmChannel mRxChannel;  /**< ** (1) Channel this side reads. */
+        std::vector<unsigned char>   mFrame;      /**< ** (1) Scratch frame for packing and unpacking. */
+        std::string                  mLastError;  /**< *o (1) trick_chkpnt_io(**) Description of the last error. */
+        /// @brief  Records the given error description and returns false.
+        bool setError(const std::string& error);
+        /// @brief  Checks that the given interface data packs to this transport's frame size.
+        bool checkFrameSize(const Distributed2WayBusBaseInterfaceData& data);
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        Distributed2WayBusShm(const Distributed2WayBusShm&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        Distributed2WayBusShm& operator =(const Distributed2WayBusShm&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this is attached to channel memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool Distributed2WayBusShmChannel::isAttached() const
+{
+    return 0 != mHeader;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long long  (--)  Sequence number of the last frame written by this channel.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long long Distributed2WayBusShmChannel::getWriteSequence() const
+{
+    return mWriteSequence;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long long  (--)  Sequence number of the last frame read by this channel.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long long Distributed2WayBusShmChannel::getReadSequence() const
+{
+    return mReadSequence;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long long  (--)  Number of frames written but not read by this channel.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long long Distributed2WayBusShmChannel::getNumDroppedFrames() const
+{
+    return mNumDropped;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if the shared memory is open.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool Distributed2WayBusShm::isOpen() const
+{
+    return 0 != mMemory;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  std::string&  (--)  Description of the last error.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const std::string& Distributed2WayBusShm::getLastError() const
+{
+    return mLastError;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long long  (--)  Sequence number of the last frame sent.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long long Distributed2WayBusShm::getTxSequence() const
+{
+    return mTxChannel.getWriteSequence();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long long  (--)  Sequence number of the last frame received.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long long Distributed2WayBusShm::getRxSequence() const
+{
+    return mRxChannel.getReadSequence();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long long  (--)  Number of frames from the other side that were never received.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long long Distributed2WayBusShm::getNumDroppedFrames() const
+{
+    return mRxChannel.getNumDroppedFrames();
+}
+
+#endif
@@ -183,6 +183,67 @@ void UtDistributed2WayBusBase::testNotifications()
     UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test the lag predictor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtDistributed2WayBusBase::testLagPredictor()
+{
+    UT_RESULT;
+
+    /// @test default construction and initialization with limits.
+    FriendlyDistributed2WayBusLagPredictor predictor;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, predictor.mRateFilterGain, 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(8.0, predictor.mMaxHorizon,     0.0);
+    CPPUNIT_ASSERT(false == predictor.mValid);
+    predictor.initialize(2.0, -1.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, predictor.mRateFilterGain, 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, predictor.mMaxHorizon,     0.0);
+    predictor.initialize(1.0, 2.0);
+
+    /// @test no extrapolation until a frame has been received.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(10.0, predictor.predict(10.0, 0, 4), DBL_EPSILON);
+    CPPUNIT_ASSERT(false == predictor.mValid);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(10.0, predictor.predict(10.0, 1, 4), DBL_EPSILON);
+    CPPUNIT_ASSERT(true  == predictor.mValid);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,  predictor.getRate(),           DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0,  predictor.getHorizon(),        DBL_EPSILON);
+
+    /// @test extrapolation of a ramp by half the loop lag.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(14.0, predictor.predict(12.0, 2, 2), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0,  predictor.getRate(),           DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,  predictor.getHorizon(),        DBL_EPSILON);
+
+    /// @test rate over skipped frames, and horizon limited to the maximum.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(20.0, predictor.predict(16.0, 4, 9), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0,  predictor.getRate(),           DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0,  predictor.getHorizon(),        DBL_EPSILON);
+
+    /// @test repeated frames keep the last rate, and unknown loop lag doesn't extrapolate.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(20.0, predictor.predict(16.0, 4, 4), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(16.0, predictor.predict(16.0, 4, 0), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0,  predictor.getRate(),           DBL_EPSILON);
+
+    /// @test filtered rate with a gain less than 1.
+    predictor.mRateFilterGain = 0.5;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(18.0, predictor.predict(16.0, 5, 4), DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,  predictor.getRate(),           DBL_EPSILON);
+
+    /// @test history restarts when the other side's frame count resets.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(5.0,  predictor.predict(5.0, 3, 4),  DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,  predictor.getRate(),           DBL_EPSILON);
+    CPPUNIT_ASSERT(3 == predictor.mLastFrameCount);
+
+    /// @test reset.
+    predictor.reset();
+    CPPUNIT_ASSERT(false == predictor.mValid);
+    CPPUNIT_ASSERT(0     == predictor.mLastFrameCount);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, predictor.mLastValue, 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, predictor.getRate(),  0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, predictor.getHorizon(), 0.0);
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Test for the mode forcing flags.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,21 @@ class FriendlyDistributed2WayBusBase : public Distributed2WayBusBase
         friend class UtDistributed2WayBusBase;
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from Distributed2WayBusLagPredictor and befriend UtDistributed2WayBusBase.
+///
+/// @details  Class derived from the unit under test. It just has a default constructor and
+///           destructor, but it befriends the unit test case driver class to allow it access to
+///           protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyDistributed2WayBusLagPredictor : public Distributed2WayBusLagPredictor
+{
+    public:
+        FriendlyDistributed2WayBusLagPredictor() {;}
+        virtual ~FriendlyDistributed2WayBusLagPredictor() {;}
+        friend class UtDistributed2WayBusBase;
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Test interface data class
 ///
@@ -77,6 +92,7 @@ class UtDistributed2WayBusBase: public CppUnit::TestFixture
         CPPUNIT_TEST(testInitialization);
         CPPUNIT_TEST(testFrameCounts);
         CPPUNIT_TEST(testNotifications);
+        CPPUNIT_TEST(testLagPredictor);
         CPPUNIT_TEST(testAccessors);
         CPPUNIT_TEST_SUITE_END();
 
@@ -95,6 +111,7 @@ class UtDistributed2WayBusBase: public CppUnit::TestFixture
         void testInitialization();
         void testFrameCounts();
         void testNotifications();
+        void testLagPredictor();
         void testAccessors();
 };
 
@@ -0,0 +1,385 @@
+/**
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "UtDistributed2WayBusShm.hh"
+#include "interop/Distributed2WayBusElect.hh"
+#include "interop/Distributed2WayBusFluid.hh"
+#include "strings/UtResult.hh"
+#include <pthread.h>
+#include <sstream>
+#include <unistd.h>
+
+/// @details  Test identification number.
+int UtDistributed2WayBusShm::TEST_ID = 0;
+
+/// @details  Number of 8-byte words in each frame of the concurrent channel test.
+static const unsigned int CONCURRENT_WORDS = 8;
+
+/// @details  Number of frames written in the concurrent channel test.
+static const unsigned long long CONCURRENT_FRAMES = 200000;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] arg (--) Pointer to the channel to write.
+///
+/// @returns  void* (--) Always null.
+///
+/// @details  Writes frames to the given channel with every word of each frame equal to the frame
+///           number, for the concurrent channel test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void* writeConcurrentFrames(void* arg)
+{
+    Distributed2WayBusShmChannel* channel = static_cast<Distributed2WayBusShmChannel*>(arg);
+    unsigned long long frame[CONCURRENT_WORDS];
+    for (unsigned long long i = 1; i <= CONCURRENT_FRAMES; ++i) {
+        for (unsigned int j = 0; j < CONCURRENT_WORDS; ++j) {
+            frame[j] = i;
+        }
+        channel->write(reinterpret_cast<const unsigned char*>(frame));
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtDistributed2WayBusShm class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtDistributed2WayBusShm::UtDistributed2WayBusShm()
+    :
+    tCreator(0),
+    tAttacher(0),
+    tPath()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtDistributed2WayBusShm class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtDistributed2WayBusShm::~UtDistributed2WayBusShm()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtDistributed2WayBusShm::setUp()
+{
+    /// - Default construct the nominal test articles.
+    tCreator  = new FriendlyDistributed2WayBusShm;
+    tAttacher = new FriendlyDistributed2WayBusShm;
+
+    /// - Use a unique file for each test process.
+    std::ostringstream path;
+    path << "/tmp/UtDistributed2WayBusShm_" << getpid();
+    tPath = path.str();
+
+    /// - Increment the test identification number.
+    ++TEST_ID;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtDistributed2WayBusShm::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tAttacher;
+    delete tCreator;
+    unlink(tPath.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests packing and unpacking interface data frames.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtDistributed2WayBusShm::testPackFrames()
+{
+    UT_RESULT_FIRST;
+
+    /// @test Electrical interface data frame size and round trip.
+    Distributed2WayBusElectInterfaceData electOut;
+    Distributed2WayBusElectInterfaceData electIn;
+    electOut.mFrameCount    = 42;
+    electOut.mFrameLoopback = 41;
+    electOut.mDemandMode    = true;
+    electOut.mDemandPower   = 100.0;
+    electOut.mSupplyVoltage = 120.0;
+    const unsigned int electSize = 2 * sizeof(unsigned int) + sizeof(bool) + 2 * sizeof(float);
+    CPPUNIT_ASSERT_EQUAL(electSize, electOut.getFrameSize());
+
+    std::vector<unsigned char> frame(electSize);
+    CPPUNIT_ASSERT_EQUAL(electSize, electOut.packFrame(&frame[0]));
+    CPPUNIT_ASSERT_EQUAL(electSize, electIn.unpackFrame(&frame[0]));
+    CPPUNIT_ASSERT_EQUAL(42u,    electIn.mFrameCount);
+    CPPUNIT_ASSERT_EQUAL(41u,    electIn.mFrameLoopback);
+    CPPUNIT_ASSERT(electIn.mDemandMode);
+    CPPUNIT_ASSERT_EQUAL(100.0f, electIn.mDemandPower);
+    CPPUNIT_ASSERT_EQUAL(120.0f, electIn.mSupplyVoltage);
+
+    /// @test Fluid interface data frame size and round trip, including the mixture arrays.
+    Distributed2WayBusFluidInterfaceData fluidOut;
+    Distributed2WayBusFluidInterfaceData fluidIn;
+    fluidOut.initialize(3, 2);
+    fluidIn.initialize(3, 2);
+    const double fractions[3]   = {0.7, 0.2, 0.1};
+    const double tcFractions[2] = {1.0e-6, 2.0e-6};
+    fluidOut.mFrameCount  = 7;
+    fluidOut.mEnergy      = 300.0;
+    fluidOut.mCapacitance = 0.5;
+    fluidOut.mSource      = 101325.0;
+    fluidOut.setMoleFractions(fractions, 3);
+    fluidOut.setTcMoleFractions(tcFractions, 2);
+    const unsigned int fluidSize = 2 * sizeof(unsigned int) + sizeof(bool) + 8 * sizeof(double);
+    CPPUNIT_ASSERT_EQUAL(fluidSize, fluidOut.getFrameSize());
+
+    frame.assign(fluidSize, 0);
+    CPPUNIT_ASSERT_EQUAL(fluidSize, fluidOut.packFrame(&frame[0]));
+    CPPUNIT_ASSERT_EQUAL(fluidSize, fluidIn.unpackFrame(&frame[0]));
+    CPPUNIT_ASSERT_EQUAL(7u,       fluidIn.mFrameCount);
+    CPPUNIT_ASSERT_EQUAL(300.0,    fluidIn.mEnergy);
+    CPPUNIT_ASSERT_EQUAL(0.5,      fluidIn.mCapacitance);
+    CPPUNIT_ASSERT_EQUAL(101325.0, fluidIn.mSource);
+    for (unsigned int i = 0; i < 3; ++i) {
+        CPPUNIT_ASSERT_EQUAL(fractions[i], fluidIn.mMoleFractions[i]);
+    }
+    for (unsigned int i = 0; i < 2; ++i) {
+        CPPUNIT_ASSERT_EQUAL(tcFractions[i], fluidIn.mTcMoleFractions[i]);
+    }
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests writing and reading a channel in local memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtDistributed2WayBusShm::testChannel()
+{
+    UT_RESULT;
+
+    /// @test Memory size for the header and slots, with frames padded to 8 bytes.
+    const unsigned int frameSize = 12;
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned int>(sizeof(Distributed2WayBusShmChannelHeader) + 3 * 24),
+                         Distributed2WayBusShmChannel::getMemorySize(frameSize, 3));
+
+    /// @test Attach fails before the channel is created.
+    std::vector<unsigned long long> memory(
+            Distributed2WayBusShmChannel::getMemorySize(frameSize, 3) / 8, 0);
+    unsigned char* memoryPtr = reinterpret_cast<unsigned char*>(&memory[0]);
+    Distributed2WayBusShmChannel writer;
+    Distributed2WayBusShmChannel reader;
+    CPPUNIT_ASSERT(not reader.attach(memoryPtr, frameSize));
+    CPPUNIT_ASSERT(not reader.isAttached());
+
+    /// @test Create and attach, and attach fails with the wrong frame size.
+    writer.create(memoryPtr, frameSize, 3);
+    CPPUNIT_ASSERT(writer.isAttached());
+    CPPUNIT_ASSERT(not reader.attach(memoryPtr, frameSize + 1));
+    CPPUNIT_ASSERT(reader.attach(memoryPtr, frameSize));
+    CPPUNIT_ASSERT(reader.isAttached());
+
+    /// @test No frame to read before the first write.
+    unsigned char out[frameSize];
+    unsigned char in[frameSize];
+    CPPUNIT_ASSERT(not reader.read(in));
+    CPPUNIT_ASSERT_EQUAL(0ull, reader.getReadSequence());
+
+    /// @test Write and read a frame, and no new frame on the next read.
+    for (unsigned int i = 0; i < frameSize; ++i) {
+        out[i] = static_cast<unsigned char>(i + 1);
+    }
+    writer.write(out);
+    CPPUNIT_ASSERT_EQUAL(1ull, writer.getWriteSequence());
+    CPPUNIT_ASSERT(reader.read(in));
+    CPPUNIT_ASSERT_EQUAL(1ull, reader.getReadSequence());
+    for (unsigned int i = 0; i < frameSize; ++i) {
+        CPPUNIT_ASSERT_EQUAL(out[i], in[i]);
+    }
+    CPPUNIT_ASSERT(not reader.read(in));
+
+    /// @test Reader gets the newest frame and counts dropped frames, after the writer laps the ring.
+    for (unsigned int frame = 2; frame <= 6; ++frame) {
+        out[0] = static_cast<unsigned char>(frame);
+        writer.write(out);
+    }
+    CPPUNIT_ASSERT(reader.read(in));
+    CPPUNIT_ASSERT_EQUAL(6ull, reader.getReadSequence());
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned char>(6), in[0]);
+    CPPUNIT_ASSERT_EQUAL(4ull, reader.getNumDroppedFrames());
+
+    /// @test Reader retries and fails if the newest slot is being written.
+    out[0] = 7;
+    writer.write(out);
+    *reinterpret_cast<unsigned long long*>(memoryPtr + sizeof(Distributed2WayBusShmChannelHeader)
+                                           + (7 % 3) * 24) = 0;
+    CPPUNIT_ASSERT(not reader.read(in));
+    CPPUNIT_ASSERT_EQUAL(6ull, reader.getReadSequence());
+
+    /// @test Write and read do nothing after detaching.
+    writer.detach();
+    reader.detach();
+    writer.write(out);
+    CPPUNIT_ASSERT(not reader.read(in));
+    CPPUNIT_ASSERT(not writer.isAttached());
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests opening the shared memory file and exchanging data in both directions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtDistributed2WayBusShm::testOpen()
+{
+    UT_RESULT;
+
+    Distributed2WayBusElectInterfaceData creatorOut;
+    Distributed2WayBusElectInterfaceData creatorIn;
+    Distributed2WayBusElectInterfaceData attacherOut;
+    Distributed2WayBusElectInterfaceData attacherIn;
+    const unsigned int frameSize = creatorOut.getFrameSize();
+
+    /// @test Open the creator and the attacher.
+    CPPUNIT_ASSERT(tCreator->open(tPath, frameSize, true));
+    CPPUNIT_ASSERT(tCreator->isOpen());
+    CPPUNIT_ASSERT(tCreator->mIsCreator);
+    CPPUNIT_ASSERT_EQUAL(2 * Distributed2WayBusShmChannel::getMemorySize(frameSize, 3),
+                         tCreator->mMemorySize);
+    CPPUNIT_ASSERT(tAttacher->open(tPath, frameSize, false));
+    CPPUNIT_ASSERT(tAttacher->isOpen());
+    CPPUNIT_ASSERT(not tAttacher->mIsCreator);
+    CPPUNIT_ASSERT(tAttacher->getLastError().empty());
+
+    /// @test No data received before any is sent.
+    CPPUNIT_ASSERT(not tAttacher->receive(attacherIn));
+    CPPUNIT_ASSERT(not tCreator->receive(creatorIn));
+
+    /// @test Creator to attacher.
+    creatorOut.mFrameCount    = 1;
+    creatorOut.mDemandMode    = true;
+    creatorOut.mDemandPower   = 50.0;
+    CPPUNIT_ASSERT(tCreator->transmit(creatorOut));
+    CPPUNIT_ASSERT_EQUAL(1ull, tCreator->getTxSequence());
+    CPPUNIT_ASSERT(tAttacher->receive(attacherIn));
+    CPPUNIT_ASSERT_EQUAL(1ull, tAttacher->getRxSequence());
+    CPPUNIT_ASSERT_EQUAL(1u,    attacherIn.mFrameCount);
+    CPPUNIT_ASSERT(attacherIn.mDemandMode);
+    CPPUNIT_ASSERT_EQUAL(50.0f, attacherIn.mDemandPower);
+    CPPUNIT_ASSERT(not tAttacher->receive(attacherIn));
+
+    /// @test Attacher to creator, with the frame loopback echoed.
+    attacherOut.mFrameCount    = 10;
+    attacherOut.mFrameLoopback = attacherIn.mFrameCount;
+    attacherOut.mSupplyVoltage = 120.0;
+    CPPUNIT_ASSERT(tAttacher->transmit(attacherOut));
+    CPPUNIT_ASSERT(tCreator->receive(creatorIn));
+    CPPUNIT_ASSERT_EQUAL(10u,    creatorIn.mFrameCount);
+    CPPUNIT_ASSERT_EQUAL(1u,     creatorIn.mFrameLoopback);
+    CPPUNIT_ASSERT_EQUAL(120.0f, creatorIn.mSupplyVoltage);
+
+    /// @test Dropped frames are counted by the receiver.
+    for (unsigned int i = 2; i <= 5; ++i) {
+        creatorOut.mFrameCount = i;
+        CPPUNIT_ASSERT(tCreator->transmit(creatorOut));
+    }
+    CPPUNIT_ASSERT(tAttacher->receive(attacherIn));
+    CPPUNIT_ASSERT_EQUAL(5u,   attacherIn.mFrameCount);
+    CPPUNIT_ASSERT_EQUAL(3ull, tAttacher->getNumDroppedFrames());
+
+    /// @test Close, and the creator removes the file.
+    tAttacher->close();
+    CPPUNIT_ASSERT(not tAttacher->isOpen());
+    tCreator->close();
+    CPPUNIT_ASSERT(not tCreator->isOpen());
+    CPPUNIT_ASSERT(0 != access(tPath.c_str(), F_OK));
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests errors opening the shared memory file and exchanging data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtDistributed2WayBusShm::testErrors()
+{
+    UT_RESULT;
+
+    Distributed2WayBusElectInterfaceData elect;
+    Distributed2WayBusFluidInterfaceData fluid;
+    fluid.initialize(2, 0);
+    const unsigned int frameSize = elect.getFrameSize();
+
+    /// @test Transmit and receive before open.
+    CPPUNIT_ASSERT(not tCreator->transmit(elect));
+    CPPUNIT_ASSERT(not tCreator->getLastError().empty());
+    CPPUNIT_ASSERT(not tCreator->receive(elect));
+
+    /// @test Attach before the file is created.
+    CPPUNIT_ASSERT(not tAttacher->open(tPath, frameSize, false));
+    CPPUNIT_ASSERT(not tAttacher->isOpen());
+    CPPUNIT_ASSERT(not tAttacher->getLastError().empty());
+
+    /// @test Zero frame size and too few slots.
+    CPPUNIT_ASSERT(not tCreator->open(tPath, 0, true));
+    CPPUNIT_ASSERT(not tCreator->open(tPath, frameSize, true, 1));
+    CPPUNIT_ASSERT(not tCreator->isOpen());
+
+    /// @test Attach with a mismatched frame size.
+    CPPUNIT_ASSERT(tCreator->open(tPath, frameSize, true));
+    CPPUNIT_ASSERT(not tAttacher->open(tPath, frameSize + 4, false));
+    CPPUNIT_ASSERT(not tAttacher->isOpen());
+    CPPUNIT_ASSERT(std::string::npos != tAttacher->getLastError().find("frame size"));
+
+    /// @test Transmit and receive interface data with a mismatched frame size.
+    CPPUNIT_ASSERT(not tCreator->transmit(fluid));
+    CPPUNIT_ASSERT(std::string::npos != tCreator->getLastError().find("frame size"));
+    CPPUNIT_ASSERT(not tCreator->receive(fluid));
+    CPPUNIT_ASSERT_EQUAL(0ull, tCreator->getTxSequence());
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that frames read from a channel are never torn while another thread writes it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtDistributed2WayBusShm::testConcurrentChannel()
+{
+    UT_RESULT;
+
+    const unsigned int frameSize = CONCURRENT_WORDS * sizeof(unsigned long long);
+    std::vector<unsigned long long> memory(
+            Distributed2WayBusShmChannel::getMemorySize(frameSize, 3) / 8, 0);
+    unsigned char* memoryPtr = reinterpret_cast<unsigned char*>(&memory[0]);
+    Distributed2WayBusShmChannel writer;
+    Distributed2WayBusShmChannel reader;
+    writer.create(memoryPtr, frameSize, 3);
+    CPPUNIT_ASSERT(reader.attach(memoryPtr, frameSize));
+
+    /// @test Every frame read has all words from the same write, in increasing order.
+    pthread_t thread;
+    CPPUNIT_ASSERT(0 == pthread_create(&thread, 0, writeConcurrentFrames, &writer));
+    unsigned long long frame[CONCURRENT_WORDS];
+    unsigned long long first    = 0;
+    unsigned long long last     = 0;
+    unsigned long long numReads = 0;
+    bool               torn     = false;
+    while (last < CONCURRENT_FRAMES) {
+        if (reader.read(reinterpret_cast<unsigned char*>(frame))) {
+            for (unsigned int j = 1; j < CONCURRENT_WORDS; ++j) {
+                torn = torn or (frame[j] != frame[0]);
+            }
+            torn = torn or (frame[0] <= last) or (frame[0] != reader.getReadSequence());
+            if (0 == first) {
+                first = frame[0];
+            }
+            last = frame[0];
+            ++numReads;
+        }
+    }
+    pthread_join(thread, 0);
+    CPPUNIT_ASSERT(not torn);
+    CPPUNIT_ASSERT_EQUAL(CONCURRENT_FRAMES, reader.getReadSequence());
+
+    /// @test Every frame after the first one read is either read or counted as dropped.
+    CPPUNIT_ASSERT_EQUAL(CONCURRENT_FRAMES - first + 1, numReads + reader.getNumDroppedFrames());
+
+    UT_PASS_LAST;
+}
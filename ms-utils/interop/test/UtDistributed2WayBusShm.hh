@@ -0,0 +1,85 @@
+#ifndef UtDistributed2WayBusShm_EXISTS
+#define UtDistributed2WayBusShm_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_UTILS_INTEROP_DISTR_2WAY_BUS_SHM    Distributed 2-Way Bus Shared Memory Transport Unit Test
+/// @ingroup  UT_UTILS_INTEROP
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Distributed 2-Way Bus Shared Memory Transport
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "interop/Distributed2WayBusShm.hh"
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from Distributed2WayBusShm and befriend UtDistributed2WayBusShm.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyDistributed2WayBusShm : public Distributed2WayBusShm
+{
+    public:
+        FriendlyDistributed2WayBusShm() {;}
+        virtual ~FriendlyDistributed2WayBusShm() {;}
+        friend class UtDistributed2WayBusShm;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Distributed 2-Way Bus Shared Memory Transport unit tests.
+////
+/// @details  This class provides the unit tests for the Distributed2WayBusShm within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtDistributed2WayBusShm : public CppUnit::TestFixture
+{
+    public:
+        /// @brief  Nominal constructor
+        UtDistributed2WayBusShm();
+        /// @brief  Nominal destructs
+        virtual ~UtDistributed2WayBusShm();
+        /// @brief  Executes before each test.
+        void setUp();
+        /// @brief  Executes after each test.
+        void tearDown();
+        /// @brief  Tests packing and unpacking interface data frames.
+        void testPackFrames();
+        /// @brief  Tests writing and reading a channel.
+        void testChannel();
+        /// @brief  Tests opening the shared memory and exchanging data in both directions.
+        void testOpen();
+        /// @brief  Tests errors opening the shared memory and exchanging data.
+        void testErrors();
+        /// @brief  Tests reading a channel while another thread writes it.
+        void testConcurrentChannel();
+
+    private:
+        /// @brief  Sets up the suite of tests for the Distributed2WayBusShm unit testing.
+        CPPUNIT_TEST_SUITE(UtDistributed2WayBusShm);
+        CPPUNIT_TEST(testPackFrames);
+        CPPUNIT_TEST(testChannel);
+        CPPUNIT_TEST(testOpen);
+        CPPUNIT_TEST(testErrors);
+        CPPUNIT_TEST(testConcurrentChannel);
+        CPPUNIT_TEST_SUITE_END();
+        FriendlyDistributed2WayBusShm* tCreator;  /**< (--) Pointer to the creator side article under test. */
+        FriendlyDistributed2WayBusShm* tAttacher; /**< (--) Pointer to the attacher side article under test. */
+        std::string                    tPath;     /**< (--) Path of the shared memory file. */
+        static int                     TEST_ID;   /**< (--) Test identification number. */
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        UtDistributed2WayBusShm(const UtDistributed2WayBusShm& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        UtDistributed2WayBusShm& operator =(const UtDistributed2WayBusShm& that);
+};
+
+///@}
+
+#endif
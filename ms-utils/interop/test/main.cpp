@@ -12,6 +12,7 @@
 #include "UtDistributed2WayBusBase.hh"
 #include "UtDistributed2WayBusFluid.hh"
 #include "UtDistributed2WayBusElect.hh"
+#include "UtDistributed2WayBusShm.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param    argc  int     --  not used
@@ -27,6 +28,7 @@ int main() {
     runner.addTest(UtDistributed2WayBusBase::suite());
     runner.addTest(UtDistributed2WayBusFluid::suite());
     runner.addTest(UtDistributed2WayBusElect::suite());
+    runner.addTest(UtDistributed2WayBusShm::suite());
 
     runner.run();
 
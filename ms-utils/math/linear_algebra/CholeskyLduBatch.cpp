@@ -0,0 +1,175 @@
+/*
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@file
+@brief    Batched Cholesky LDU Decomposition implementation
+
+LIBRARY DEPENDENCY:
+     ()
+*/
+
+#include "CholeskyLduBatch.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Batched Cholesky LDU Decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CholeskyLduBatch::CholeskyLduBatch()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Batched Cholesky LDU Decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CholeskyLduBatch::~CholeskyLduBatch()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] A         (--) On input, the pointer to the first element of the interleaved
+///                               batch of matrices A[n][n][m].  On output, each matrix is replaced
+///                               by its LDU factorization, as in CholeskyLdu::Decompose.
+/// @param[in]     n         (--) The number of rows and/or columns of each matrix.
+/// @param[in]     m         (--) The number of matrices in the batch.
+/// @param[out]    failedRow (--) Array of size m, set to the row each member's decomposition failed
+///                               at, or -1 for the members that succeeded.
+///
+/// @returns  int (--) The number of batch members whose decomposition failed.
+///
+/// @details  This is the CholeskyLdu::Decompose algorithm, with each of its operations applied to
+///           all members of the batch in an inner loop.  The zero-skipping and underflow protection
+///           are done per member, so each member's result is the same as CholeskyLdu would give.
+///
+///           When a member's diagonal element is not positive, its failing row is recorded and the
+///           element is set to 1 so that the rest of its decomposition doesn't divide by zero.  The
+///           rest of that member's decomposition is invalid and must not be used for solving.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int CholeskyLduBatch::Decompose(double *A, int n, int m, int* failedRow)
+{
+    const double limit = -1.0E-100;
+    const int    rowStride = n * m;
+    for (int l = 0; l < m; ++l) {
+        failedRow[l] = -1;
+    }
+
+    double *p_i = A + rowStride;                   // pointer to L[i][0]
+    for (int i = 1; i < n; p_i += rowStride, i++) {
+
+        /// - Calculate elements given by the product L[i][j]*D[j].
+        double *p_j = A;                           // pointer to L[j][0]
+        for (int j = 0; j < i; j++, p_j += rowStride) {
+            double* p_ij = p_i + j * m;
+            for (int k = 0; k < j; k++) {
+                const double* p_ik = p_i + k * m;
+                const double* p_jk = p_j + k * m;
+                /// - Skip operations on zero to save time.
+                for (int l = 0; l < m; ++l) {
+                    if (limit > p_ik[l] and limit > p_jk[l]) {
+                        p_ij[l] -= p_ik[l] * p_jk[l];
+                    }
+                }
+            }
+            /// - Protect for underflow, as in CholeskyLdu.
+            for (int l = 0; l < m; ++l) {
+                if ( (p_ij[l] > limit) and (p_ij[l] < -limit) ) {
+                    p_ij[l] = 0.0;
+                }
+            }
+        }
+
+        /// - Calculate the diagonal element D[i] and L[i][j].  Store the transpose L[k][i];
+        double* p_ii = p_i + i * m;
+        double *p_k  = A;                          // pointer to L[k][0]
+        for (int k = 0; k < i; p_k += rowStride, k++) {
+            double*       p_ik = p_i + k * m;
+            double*       p_ki = p_k + i * m;
+            const double* p_kk = p_k + k * m;
+            for (int l = 0; l < m; ++l) {
+                const double ld = p_ik[l] / p_kk[l];   // temp storage
+                p_ii[l] -= p_ik[l] * ld;
+                p_ik[l]  = ld;
+                p_ki[l]  = ld;
+            }
+        }
+
+        /// - Record the first failing row number of each member to aid debugging.
+        for (int l = 0; l < m; ++l) {
+            if (p_ii[l] <= 0.0) {
+                if (failedRow[l] < 0) {
+                    failedRow[l] = i;
+                }
+                p_ii[l] = 1.0;
+            }
+        }
+    }
+
+    int failures = 0;
+    for (int l = 0; l < m; ++l) {
+        if (failedRow[l] > -1) {
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  LDU (--) Pointer to the first element of the interleaved batch of decomposed
+///                      matrices.
+/// @param[in]  B   (--) Pointer to the interleaved batch of column vectors B[n][m].
+/// @param[out] x   (--) Interleaved batch of solutions x[n][m] to the equations Ax = B.
+/// @param[in]  n   (--) The number of rows or columns of each matrix.
+/// @param[in]  m   (--) The number of systems in the batch.
+///
+/// @details  This is the CholeskyLdu::Solve algorithm, with each of its operations applied to all
+///           members of the batch in an inner loop: solve Ly = B for y, then Dz = y for z, and
+///           finally Ux = z for x.  The diagonal of each member must be non-zero, which is ensured
+///           by a successful decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduBatch::Solve(const double *LDU, const double B[], double x[], int n, int m)
+{
+    const int rowStride = n * m;
+
+    /// - Solve the linear equations Ly = B for y, where L is a unit lower triangular matrix.
+    for (int l = 0; l < m; ++l) {
+        x[l] = B[l];
+    }
+    const double* p_k = LDU + rowStride;
+    for (int k = 1; k < n; p_k += rowStride, k++) {
+        double* x_k = x + k * m;
+        for (int l = 0; l < m; ++l) {
+            x_k[l] = B[k * m + l];
+        }
+        for (int i = 0; i < k; i++) {
+            const double* x_i  = x + i * m;
+            const double* p_ki = p_k + i * m;
+            for (int l = 0; l < m; ++l) {
+                x_k[l] -= x_i[l] * p_ki[l];
+            }
+        }
+    }
+
+    /// - Solve the linear equations Dz = y for z, where D is the diagonal matrix.
+    p_k = LDU;
+    for (int k = 0; k < n; p_k += rowStride, k++) {
+        double*       x_k  = x + k * m;
+        const double* p_kk = p_k + k * m;
+        for (int l = 0; l < m; ++l) {
+            x_k[l] /= p_kk[l];
+        }
+    }
+
+    /// - Solve the linear equations Ux = z, where U is a unit upper triangular matrix.
+    for (int k = n - 2; k >= 0; k--) {
+        p_k = LDU + k * rowStride;
+        double* x_k = x + k * m;
+        for (int i = k + 1; i < n; i++) {
+            const double* x_i  = x + i * m;
+            const double* p_ki = p_k + i * m;
+            for (int l = 0; l < m; ++l) {
+                x_k[l] -= x_i[l] * p_ki[l];
+            }
+        }
+    }
+}
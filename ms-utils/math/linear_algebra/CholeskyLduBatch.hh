@@ -0,0 +1,74 @@
+#ifndef CholeskyLduBatch_EXISTS
+#define CholeskyLduBatch_EXISTS
+
+/**
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@file
+@brief    Batched Cholesky LDU Decomposition declarations
+
+@defgroup  TSM_UTILITIES_MATH_LINEAR_ALGEBRA_CHOLESKY_LDU_BATCH Batched Cholesky LDU Decomposition
+@ingroup   TSM_UTILITIES_MATH_LINEAR_ALGEBRA
+
+@details
+PURPOSE:
+- (These algorithms are the CholeskyLdu decomposition and solution, applied to a batch of equal
+   size systems of equations at once.  The batch is stored interleaved, so the innermost loops run
+   across the batch over contiguous memory.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- ((The matrices are dense, and the zero-skipping of CholeskyLdu is done per batch member.)
+   (Each batch member gets the same result as CholeskyLdu would give it by itself.))
+
+LIBRARY_DEPENDENCY:
+- ((CholeskyLduBatch.o))
+
+PROGRAMMERS:
+- ()
+
+@{
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Batched Cholesky LDU Matrix Decomposition Utilities
+///
+/// @details  These algorithms decompose and solve a batch of m systems of equations [A]{x} = {b},
+///           each of size n, in one pass.  Element e of batch member l is stored at [e*m + l], so
+///           matrix element [i][j] of member l is at A[(i*n + j)*m + l], and vector element [i] is
+///           at x[i*m + l].  This puts each operation of the CholeskyLdu algorithm in an inner loop
+///           over the batch, on contiguous memory that the compiler can vectorize.
+///
+///           Rather than throwing on the first failed decomposition, the failing row of each member
+///           is returned so the caller can handle it while keeping the results of the others.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class CholeskyLduBatch
+{
+    public:
+        /// @brief Default constructor.
+        CholeskyLduBatch();
+
+        /// @brief Default destructor.
+        virtual ~CholeskyLduBatch();
+
+        /// @brief Decomposes the batch of admittance matrices [A].
+        virtual int Decompose(double *A, int n, int m, int* failedRow);
+
+        /// @brief Uses the batch of decomposed admittance matrices to solve [A]{x} = {b} for {x}.
+        virtual void Solve(const double *LDU, const double B[], double x[], int n, int m);
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        CholeskyLduBatch(const CholeskyLduBatch& that);
+
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        CholeskyLduBatch& operator =(const CholeskyLduBatch&);
+
+};
+
+/// @}
+
+#endif
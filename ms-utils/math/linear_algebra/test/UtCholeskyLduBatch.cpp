@@ -0,0 +1,190 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((math/linear_algebra/CholeskyLduBatch.o)
+     (math/linear_algebra/CholeskyLdu.o))
+***************************************************************************************************/
+
+#include "UtCholeskyLduBatch.hh"
+#include "math/linear_algebra/CholeskyLdu.hh"
+#include "software/exceptions/TsNumericalException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Batched Cholesky Ldu Decomposition unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtCholeskyLduBatch::UtCholeskyLduBatch()
+    :
+    tArticle()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Batched Cholesky Ldu Decomposition unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtCholeskyLduBatch::~UtCholeskyLduBatch()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduBatch::setUp()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduBatch::tearDown()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that the batch decomposition and solution of each member match CholeskyLdu, for
+///           members with different values and different zero terms.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduBatch::testNormalSolution()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtCholeskyLduBatch  01: testNormalSolution .........................";
+
+    const double tolerance = 1.0E-14;
+    const int    n = 4;
+    const int    m = 3;
+
+    /// - Make-up systems, the last with positive off-diagonals.
+    double A[m][n*n] = {{10.0,  -0.001, -0.002,  0.0,
+                         -0.001, 8.0,   -0.003, -0.001,
+                         -0.002,-0.003, 12.0,    0.0,
+                          0.0,  -0.001,  0.0,    9.0},
+                        { 4.0,  -1.0,    0.0,   -1.0,
+                         -1.0,   4.0,   -1.0,    0.0,
+                          0.0,  -1.0,    4.0,   -1.0,
+                         -1.0,   0.0,   -1.0,    4.0},
+                        { 5.0,   1.0,   -1.0,    0.5,
+                          1.0,   6.0,    0.0,   -2.0,
+                         -1.0,   0.0,    7.0,    1.0,
+                          0.5,  -2.0,    1.0,    8.0}};
+    double b[m][n]     = {{27.0,  0.03,  0.0, -1.5},
+                          { 1.0,  2.0,   3.0,  4.0},
+                          {-1.0,  0.5,   0.0,  2.0}};
+
+    /// - Interleave the batch.
+    double batchA[n*n*m];
+    double batchB[n*m];
+    double batchX[n*m];
+    for (int l = 0; l < m; ++l) {
+        for (int e = 0; e < n*n; ++e) {
+            batchA[e*m + l] = A[l][e];
+        }
+        for (int e = 0; e < n; ++e) {
+            batchB[e*m + l] = b[l][e];
+        }
+    }
+
+    int failedRow[m];
+    CPPUNIT_ASSERT(0 == tArticle.Decompose(batchA, n, m, failedRow));
+    tArticle.Solve(batchA, batchB, batchX, n, m);
+
+    /// - Compare each member with CholeskyLdu.
+    CholeskyLdu reference;
+    for (int l = 0; l < m; ++l) {
+        CPPUNIT_ASSERT(-1 == failedRow[l]);
+        double x[n];
+        CPPUNIT_ASSERT_NO_THROW(reference.Decompose(A[l], n));
+        CPPUNIT_ASSERT_NO_THROW(reference.Solve(A[l], b[l], x, n));
+        for (int e = 0; e < n*n; ++e) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(A[l][e], batchA[e*m + l], tolerance);
+        }
+        for (int e = 0; e < n; ++e) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(x[e], batchX[e*m + l], tolerance);
+        }
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that the failing row of each failed member is returned, and the other members
+///           are still decomposed and solved correctly.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduBatch::testFailedRows()
+{
+    std::cout << "\n UtCholeskyLduBatch  02: testFailedRows .............................";
+
+    const double tolerance = 1.0E-14;
+    const int    n = 3;
+    const int    m = 3;
+
+    /// - The first member is singular at row 2, the last is not positive-definite at row 1.
+    double A[m][n*n] = {{ 1.0, -1.0,  0.0,
+                         -1.0,  2.0, -1.0,
+                          0.0, -1.0,  1.0},
+                        { 2.0, -1.0,  0.0,
+                         -1.0,  2.0, -1.0,
+                          0.0, -1.0,  2.0},
+                        { 1.0,  2.0,  0.0,
+                          2.0,  1.0,  0.0,
+                          0.0,  0.0,  1.0}};
+    double b[n] = {1.0, 0.0, 1.0};
+
+    double batchA[n*n*m];
+    double batchB[n*m];
+    double batchX[n*m];
+    for (int l = 0; l < m; ++l) {
+        for (int e = 0; e < n*n; ++e) {
+            batchA[e*m + l] = A[l][e];
+        }
+        for (int e = 0; e < n; ++e) {
+            batchB[e*m + l] = b[e];
+        }
+    }
+
+    int failedRow[m];
+    CPPUNIT_ASSERT(2 == tArticle.Decompose(batchA, n, m, failedRow));
+    CPPUNIT_ASSERT( 2 == failedRow[0]);
+    CPPUNIT_ASSERT(-1 == failedRow[1]);
+    CPPUNIT_ASSERT( 1 == failedRow[2]);
+    tArticle.Solve(batchA, batchB, batchX, n, m);
+
+    /// - CholeskyLdu fails at the same rows, and gives the same solution of the valid member.
+    CholeskyLdu reference;
+    CPPUNIT_ASSERT_THROW(reference.Decompose(A[0], n), TsNumericalException);
+    CPPUNIT_ASSERT_THROW(reference.Decompose(A[2], n), TsNumericalException);
+    double x[n];
+    reference.Decompose(A[1], n);
+    reference.Solve(A[1], b, x, n);
+    for (int e = 0; e < n; ++e) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(x[e], batchX[e*m + 1], tolerance);
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests a batch of 1x1 systems, which have nothing to decompose.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduBatch::testSingleRow()
+{
+    std::cout << "\n UtCholeskyLduBatch  03: testSingleRow ..............................";
+
+    double A[2] = {2.0, 0.5};
+    double b[2] = {3.0, 1.0};
+    double x[2] = {0.0, 0.0};
+    int    failedRow[2];
+
+    CPPUNIT_ASSERT(0 == tArticle.Decompose(A, 1, 2, failedRow));
+    CPPUNIT_ASSERT(-1 == failedRow[0]);
+    CPPUNIT_ASSERT(-1 == failedRow[1]);
+    tArticle.Solve(A, b, x, 1, 2);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.5, x[0], 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, x[1], 0.0);
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,60 @@
+#ifndef UtCholeskyLduBatch_EXISTS
+#define UtCholeskyLduBatch_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @defgroup UT_UTILITIES_MATH_LINEAR_ALGEBRA_CHOLESKY_LDU_BATCH Batched Cholesky LDU Unit Tests
+/// @ingroup  UT_UTILITIES_MATH_LINEAR_ALGEBRA
+///
+/// @details  Unit Tests for the CholeskyLduBatch class.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+
+#include "math/linear_algebra/CholeskyLduBatch.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Utilities unit tests.
+////
+/// @details  This class provides the unit tests for the CholeskyLduBatch class within the
+///           CPPUnit framework.  The batch results are compared to CholeskyLdu for each member.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtCholeskyLduBatch : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this Utilities unit test.
+        UtCholeskyLduBatch();
+        /// @brief    Default destructs this Utilities unit test.
+        virtual ~UtCholeskyLduBatch();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests the batch decomposition and solution against CholeskyLdu.
+        void testNormalSolution();
+        /// @brief    Tests failed decompositions of some batch members.
+        void testFailedRows();
+        /// @brief    Tests a batch of 1x1 systems.
+        void testSingleRow();
+    private:
+        CholeskyLduBatch tArticle;              /**< (--) Unit under test. */
+        CPPUNIT_TEST_SUITE(UtCholeskyLduBatch);
+        CPPUNIT_TEST(testNormalSolution);
+        CPPUNIT_TEST(testFailedRows);
+        CPPUNIT_TEST(testSingleRow);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtCholeskyLduBatch(const UtCholeskyLduBatch& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtCholeskyLduBatch& operator =(const UtCholeskyLduBatch& that);
+};
+
+///@}
+
+#endif
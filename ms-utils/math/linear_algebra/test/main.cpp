@@ -17,6 +17,7 @@ LIBRARY DEPENDENCY:
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "UtCholeskyLdu.hh"
+#include "UtCholeskyLduBatch.hh"
 #include "UtSor.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,6 +47,7 @@ int main(int argc, char** argv) {
     CppUnit::TextTestRunner runner;
 
     runner.addTest( UtCholeskyLdu::suite() );
+    runner.addTest( UtCholeskyLduBatch::suite() );
     runner.addTest( UtSor::suite() );
 
     runner.run(testresult);
@@ -0,0 +1,315 @@
+/************************************** TRICK HEADER **********************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+   (Reads the child elements of an XML file's root element one at a time, without loading the
+    whole document.)
+
+REQUIREMENTS:
+   ()
+
+REFERENCE:
+   ()
+
+ASSUMPTIONS AND LIMITATIONS:
+   ()
+
+LIBRARY DEPENDENCY:
+    ((parsing/tinyxml/tinyxml.o)
+     (simulation/hs/TsHsMsg.o)
+     (software/exceptions/TsParseException.o))
+
+PROGRAMMERS:
+   ()
+***************************************************************************************************/
+#include "XmlElementStream.hh"
+#include "software/exceptions/TsHsException.hh"
+#include "software/exceptions/TsParseException.hh"
+#include <cstring>   //needed for strlen
+#include <sstream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this XML element stream.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+XmlElementStream::XmlElementStream()
+    :
+    mFile(),
+    mFileName(),
+    mLine(0),
+    mOpenTags(),
+    mToken(),
+    mElementText(),
+    mElementDoc()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this XML element stream.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+XmlElementStream::~XmlElementStream()
+{
+    close();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fileName  (--)  Path and name of the XML file.
+/// @param[in]  rootTag   (--)  Name of the root element whose children are to be streamed.
+///
+/// @throw      TsParseException if the file can't be opened, the root element isn't found, or the
+///             file is ill-formed before the root element.
+///
+/// @details    Opens the XML file and reads up to the start of the contents of the first top-level
+///             element with the given name.  Any other top-level elements before it are skipped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void XmlElementStream::open(const std::string& fileName, const std::string& rootTag)
+{
+    close();
+    mFileName = fileName;
+    mLine     = 1;
+
+    if (0 == mFile.open(fileName.c_str(), std::ios::in | std::ios::binary)) {
+        throwError("cannot open file");
+    }
+
+    /// - Find the root element, skipping over the prolog and any other top-level elements.
+    for (TokenType type = readToken(); END_FILE != type; type = readToken()) {
+        if (mOpenTags.empty() and (START_TAG == type or EMPTY_TAG == type)
+                and getTagName() == rootTag) {
+            /// - An empty root element is left closed, so next() finds no children.
+            updateOpenTags(type);
+            return;
+        }
+        updateOpenTags(type);
+    }
+    throwError("XML tag not found, " + rootTag);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  tag  (--)  Name of the child elements to return.
+///
+/// @returns    TiXmlElement* (--)  The next child element of the root with the given name, or null
+///                                 at the end of the root element.
+///
+/// @throw      TsParseException if the file is ill-formed or ends before the root element is closed.
+///
+/// @details    Reads the file up to the next child element of the root with the given name, skipping
+///             all other children, and returns that element parsed on its own.  The previous element
+///             is discarded.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TiXmlElement* XmlElementStream::next(const std::string& tag)
+{
+    mElementDoc.Clear();
+
+    while (not mOpenTags.empty()) {
+        const TokenType type = readToken();
+        if (END_FILE == type) {
+            throwError("unexpected end of file, missing </" + mOpenTags.back() + ">");
+        }
+
+        if (1 == mOpenTags.size() and (START_TAG == type or EMPTY_TAG == type)
+                and getTagName() == tag) {
+            /// - Collect the text of this child element through its end tag.
+            mElementText = mToken;
+            updateOpenTags(type);
+            while (mOpenTags.size() > 1) {
+                const TokenType inner = readToken();
+                if (END_FILE == inner) {
+                    throwError("unexpected end of file, missing </" + mOpenTags.back() + ">");
+                }
+                updateOpenTags(inner);
+                mElementText += mToken;
+            }
+
+            /// - Parse the element text on its own.
+            mElementDoc.Parse(mElementText.c_str());
+            if (mElementDoc.Error()) {
+                throwError(mElementDoc.ErrorDesc());
+            }
+            return mElementDoc.FirstChildElement(tag.c_str());
+        }
+        updateOpenTags(type);
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Closes the XML file and discards the current element.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void XmlElementStream::close()
+{
+    if (mFile.is_open()) {
+        mFile.close();
+    }
+    mOpenTags.clear();
+    mToken.clear();
+    mElementText.clear();
+    mElementDoc.Clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  The next character, or EOF at the end of the file.
+///
+/// @details  Reads the next character from the file, counting lines for error messages.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int XmlElementStream::getChar()
+{
+    const int c = mFile.sbumpc();
+    if ('\n' == c) {
+        ++mLine;
+    }
+    return c;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  TokenType  (--)  The type of token read.
+///
+/// @throw    TsParseException if the file ends within a tag, comment or other markup.
+///
+/// @details  Reads the next markup token from the file into mToken.  Character data is read up to,
+///           but not including, the next '<'.  In a start tag, a '>' within a quoted attribute
+///           value does not end the tag.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+XmlElementStream::TokenType XmlElementStream::readToken()
+{
+    mToken.clear();
+    int c = getChar();
+    if (EOF == c) {
+        return END_FILE;
+    }
+    mToken += static_cast<char>(c);
+
+    /// - Character data.
+    if ('<' != c) {
+        while (EOF != (c = mFile.sgetc()) and '<' != c) {
+            mToken += static_cast<char>(getChar());
+        }
+        return TEXT;
+    }
+
+    c = mFile.sgetc();
+    if ('!' == c) {
+        mToken += static_cast<char>(getChar());
+        c = mFile.sgetc();
+        if ('-' == c) {
+            /// - Comment.
+            readUntil("-->");
+            return MISC;
+        } else if ('[' == c) {
+            /// - CDATA section.
+            readUntil("]]>");
+            return TEXT;
+        }
+        /// - Declaration, such as DOCTYPE.
+        readUntil(">");
+        return MISC;
+
+    } else if ('?' == c) {
+        /// - Processing instruction or XML declaration.
+        readUntil("?>");
+        return MISC;
+
+    } else if ('/' == c) {
+        readUntil(">");
+        return END_TAG;
+    }
+
+    /// - Start or empty tag, ignoring '>' within quoted attribute values.
+    char quote = 0;
+    for (;;) {
+        c = getChar();
+        if (EOF == c) {
+            throwError("unexpected end of file in tag " + mToken);
+        }
+        mToken += static_cast<char>(c);
+        if (0 != quote) {
+            if (quote == c) {
+                quote = 0;
+            }
+        } else if ('"' == c or '\'' == c) {
+            quote = static_cast<char>(c);
+        } else if ('>' == c) {
+            break;
+        }
+    }
+    return ('/' == mToken[mToken.size() - 2]) ? EMPTY_TAG : START_TAG;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  terminator  (--)  Characters that end the token.
+///
+/// @throw      TsParseException if the file ends before the terminator.
+///
+/// @details    Reads characters into mToken up to and including the given terminator.  Only the
+///             characters read by this call are checked for the terminator.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void XmlElementStream::readUntil(const char* terminator)
+{
+    const size_t length = std::strlen(terminator);
+    const size_t start  = mToken.size();
+    for (;;) {
+        const int c = getChar();
+        if (EOF == c) {
+            throwError("unexpected end of file, missing " + std::string(terminator));
+        }
+        mToken += static_cast<char>(c);
+        if (mToken.size() - start >= length
+                and 0 == mToken.compare(mToken.size() - length, length, terminator)) {
+            return;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  std::string  (--)  The element name in the last tag token read.
+///
+/// @details  Returns the element name from a start, end or empty tag token, which follows the '<'
+///           or '</' and ends at whitespace, '/' or '>'.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string XmlElementStream::getTagName() const
+{
+    const size_t start = ('/' == mToken[1]) ? 2 : 1;
+    const size_t end   = mToken.find_first_of(" \t\r\n/>", start);
+    return mToken.substr(start, end - start);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  type  (--)  The type of the last token read.
+///
+/// @throw      TsParseException if an end tag doesn't match the open element.
+///
+/// @details    Pushes the element name of a start tag, and pops the open element for a matching end
+///             tag.  Other tokens don't change the open elements.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void XmlElementStream::updateOpenTags(const TokenType type)
+{
+    if (START_TAG == type) {
+        mOpenTags.push_back(getTagName());
+
+    } else if (END_TAG == type) {
+        const std::string name = getTagName();
+        if (mOpenTags.empty()) {
+            throwError("unexpected end tag </" + name + ">");
+        } else if (mOpenTags.back() != name) {
+            throwError("mismatched end tag </" + name + ">, expected </" + mOpenTags.back() + ">");
+        }
+        mOpenTags.pop_back();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  cause  (--)  Description of the error.
+///
+/// @throw      TsParseException always.
+///
+/// @details    Closes the file and throws a parse exception with the given cause, file and line.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void XmlElementStream::throwError(const std::string& cause)
+{
+    std::ostringstream location;
+    location << mFileName << " line " << mLine;
+    close();
+    TS_HS_EXCEPTION(TS_HS_ERROR, "Parse", cause, TsParseException, "XML stream error",
+            location.str());
+}
@@ -0,0 +1,118 @@
+#ifndef XmlElementStream_EXISTS
+#define XmlElementStream_EXISTS
+/**
+@defgroup TSM_UTILITIES_PARSING_XmlElementStream Streaming XML element reader
+@ingroup  TSM_UTILITIES_PARSING
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+   (Reads the child elements of an XML file's root element one at a time, without loading the
+    whole document.  The file is scanned as a stream of markup tokens, and only the text of the
+    current child element of interest is kept.  That element alone is parsed into a tinyxml element
+    and handed to the caller, and is discarded when the next element is read.  Peak memory is then
+    set by the largest single element, rather than by several times the size of the file as with a
+    TiXmlDocument of the whole file.)
+
+REQUIREMENTS:
+   ()
+
+REFERENCE:
+   ()
+
+ASSUMPTIONS AND LIMITATIONS:
+   ((Only the child elements of the root element are streamed.  Deeper elements are parsed as part
+     of their child element.)
+    (Well-formedness is checked as the file is read, by matching each closing tag against its
+     opening tag, so elements preceding an error in the file are returned before the error is
+     thrown.)
+    (A DOCTYPE declaration with an internal subset is not supported.))
+
+LIBRARY DEPENDENCY:
+   (parsing/XmlElementStream.o)
+
+PROGRAMMERS:
+   ()
+
+@{
+*/
+
+#include "parsing/tinyxml/tinyxml.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <fstream>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Streams the child elements of an XML file's root element.
+///
+/// @details  Typical use is to open() the file with the expected root element name, then call
+///           next() with the child element name until it returns null:
+///           \verbatim
+///           XmlElementStream stream;
+///           stream.open("links.xml", "list");
+///           while (TiXmlElement* elem = stream.next("radiation")) {
+///               registerRad(elem);
+///           }
+///           \endverbatim
+///           The returned element is owned by this stream, and is only valid until the next call
+///           to next(), open() or close().
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class XmlElementStream
+{
+    TS_MAKE_SIM_COMPATIBLE(XmlElementStream);
+
+    public:
+        /// @brief  Default constructs this XML element stream.
+        XmlElementStream();
+        /// @brief  Default destructs this XML element stream.
+        virtual ~XmlElementStream();
+        /// @brief  Opens the XML file and advances to the contents of the given root element.
+        void open(const std::string& fileName, const std::string& rootTag);
+        /// @brief  Returns the next child element of the root with the given tag, or null at the end.
+        TiXmlElement* next(const std::string& tag);
+        /// @brief  Closes the XML file.
+        void close();
+
+    protected:
+        /// @brief  Enumeration of the types of markup tokens in the file.
+        enum TokenType {
+            START_TAG = 0, ///< Element start tag, <name ...>
+            END_TAG   = 1, ///< Element end tag, </name>
+            EMPTY_TAG = 2, ///< Empty element tag, <name .../>
+            TEXT      = 3, ///< Character data or CDATA section
+            MISC      = 4, ///< Comment, declaration or processing instruction
+            END_FILE  = 5  ///< End of the file
+        };
+        std::filebuf             mFile;        /**< ** (--) trick_chkpnt_io(**) Buffer of the XML file being read */
+        std::string              mFileName;    /**< ** (--) trick_chkpnt_io(**) Name of the XML file being read */
+        int                      mLine;        /**< ** (--) trick_chkpnt_io(**) Current line number in the XML file */
+        std::vector<std::string> mOpenTags;    /**< ** (--) trick_chkpnt_io(**) Names of the currently open elements */
+        std::string              mToken;       /**< ** (--) trick_chkpnt_io(**) Text of the last token read */
+        std::string              mElementText; /**< ** (--) trick_chkpnt_io(**) Text of the current child element */
+        TiXmlDocument            mElementDoc;  /**< ** (--) trick_chkpnt_io(**) Document holding the current child element */
+        /// @brief  Reads the next character from the file, counting lines.
+        int  getChar();
+        /// @brief  Reads the next markup token from the file.
+        TokenType readToken();
+        /// @brief  Reads characters into the token up to and including the given terminator.
+        void readUntil(const char* terminator);
+        /// @brief  Returns the element name from a start, end or empty tag token.
+        std::string getTagName() const;
+        /// @brief  Updates the open element names for the last token read.
+        void updateOpenTags(const TokenType type);
+        /// @brief  Throws a parse exception with the given cause.
+        void throwError(const std::string& cause);
+
+    private:
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        XmlElementStream(const XmlElementStream&);
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        XmlElementStream& operator =(const XmlElementStream&);
+};
+
+/// @}
+
+#endif
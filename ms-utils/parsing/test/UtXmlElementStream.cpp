@@ -0,0 +1,210 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((software/exceptions/TsParseException.o)
+     (parsing/XmlElementStream.o))
+***************************************************************************************************/
+#include <iostream>
+#include "software/exceptions/TsParseException.hh"
+#include "parsing/XmlElementStream.hh"
+#include "UtXmlElementStream.hh"
+#include <cstdio>
+#include <fstream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this XmlElementStream unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtXmlElementStream::UtXmlElementStream()
+    :
+    CppUnit::TestFixture(),
+    tFileName()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this XmlElementStream unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtXmlElementStream::~UtXmlElementStream()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtXmlElementStream::setUp()
+{
+    tFileName = "UtXmlElementStream_temp.xml";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtXmlElementStream::tearDown()
+{
+    std::remove(tFileName.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  contents  (--)  Contents to write to the file.
+///
+/// @details  Writes the given contents to the temporary XML file.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtXmlElementStream::writeFile(const std::string& contents)
+{
+    std::ofstream file(tFileName.c_str());
+    file << contents;
+    file.close();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests streaming of the root element's children.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtXmlElementStream::testNominal()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n XmlElementStream 01: Testing nominal streaming ........................";
+
+    writeFile("<?xml version=\"1.0\" ?>\n"
+              "<!-- a comment with <tags> in it -->\n"
+              "<list>\n"
+              "    <link name='first'>\n"
+              "        <node>A</node>\n"
+              "        <link>nested</link>\n"
+              "    </link>\n"
+              "    <other><link>not a child of the root</link></other>\n"
+              "    <!-- <link name='commented'/> -->\n"
+              "    <link name='a > b'><node>B &amp; C</node><data><![CDATA[<x>]]></data></link>\n"
+              "    <link name='empty'/>\n"
+              "    <other/>\n"
+              "</list>\n");
+
+    XmlElementStream article;
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+
+    /// @test  Each <link> child of the root is returned in order, parsed with its contents.
+    TiXmlElement* elem = article.next("link");
+    CPPUNIT_ASSERT(0 != elem);
+    CPPUNIT_ASSERT_EQUAL(std::string("first"), std::string(elem->Attribute("name")));
+    CPPUNIT_ASSERT_EQUAL(std::string("A"),      std::string(elem->FirstChildElement("node")->GetText()));
+    CPPUNIT_ASSERT_EQUAL(std::string("nested"), std::string(elem->FirstChildElement("link")->GetText()));
+    CPPUNIT_ASSERT(0 == elem->NextSiblingElement());
+
+    /// @test  Quoted '>' in attributes, entities and CDATA.
+    elem = article.next("link");
+    CPPUNIT_ASSERT(0 != elem);
+    CPPUNIT_ASSERT_EQUAL(std::string("a > b"), std::string(elem->Attribute("name")));
+    CPPUNIT_ASSERT_EQUAL(std::string("B & C"), std::string(elem->FirstChildElement("node")->GetText()));
+    CPPUNIT_ASSERT_EQUAL(std::string("<x>"),   std::string(elem->FirstChildElement("data")->GetText()));
+
+    /// @test  Empty element.
+    elem = article.next("link");
+    CPPUNIT_ASSERT(0 != elem);
+    CPPUNIT_ASSERT_EQUAL(std::string("empty"), std::string(elem->Attribute("name")));
+    CPPUNIT_ASSERT(0 == elem->FirstChild());
+
+    /// @test  End of the root element, and repeated calls after the end.
+    CPPUNIT_ASSERT(0 == article.next("link"));
+    CPPUNIT_ASSERT(0 == article.next("link"));
+
+    /// @test  A second pass for a different tag.
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+    CPPUNIT_ASSERT(0 != article.next("other"));
+    elem = article.next("other");
+    CPPUNIT_ASSERT(0 != elem);
+    CPPUNIT_ASSERT(0 == elem->FirstChild());
+    CPPUNIT_ASSERT(0 == article.next("other"));
+
+    /// @test  No matching children.
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+    CPPUNIT_ASSERT(0 == article.next("node"));
+    article.close();
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests finding the root element.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtXmlElementStream::testRoot()
+{
+    std::cout << "\n XmlElementStream 02: Testing root element .............................";
+
+    XmlElementStream article;
+
+    /// @test  Missing root element.
+    writeFile("<?xml version=\"1.0\" ?>\n<node><link/></node>\n<node/>\n");
+    CPPUNIT_ASSERT_THROW(article.open(tFileName, "list"), TsParseException);
+
+    /// @test  Root element after other top-level elements.
+    writeFile("<other><list><link/></list></other>\n<list><link name='x'/></list>\n");
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+    TiXmlElement* elem = article.next("link");
+    CPPUNIT_ASSERT(0 != elem);
+    CPPUNIT_ASSERT_EQUAL(std::string("x"), std::string(elem->Attribute("name")));
+    CPPUNIT_ASSERT(0 == article.next("link"));
+
+    /// @test  Empty root element.
+    writeFile("<list/>\n");
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+    CPPUNIT_ASSERT(0 == article.next("link"));
+
+    /// @test  Root element with attributes.
+    writeFile("<list version='2'>\n<link/>\n</list>\n");
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+    CPPUNIT_ASSERT(0 != article.next("link"));
+    CPPUNIT_ASSERT(0 == article.next("link"));
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests handling of ill-formed files.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtXmlElementStream::testErrors()
+{
+    std::cout << "\n XmlElementStream 03: Testing ill-formed files .........................";
+
+    XmlElementStream article;
+
+    /// @test  File doesn't exist.
+    CPPUNIT_ASSERT_THROW(article.open("calabria.xml", "list"), TsParseException);
+
+    /// @test  Mismatched end tag within a child, after the preceding child is returned.
+    writeFile("<list>\n<link><a>1</a></link>\n<link><a>2<a></link>\n</list>\n");
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+    CPPUNIT_ASSERT(0 != article.next("link"));
+    CPPUNIT_ASSERT_THROW(article.next("link"), TsParseException);
+
+    /// @test  Mismatched end tag in a skipped child.
+    writeFile("<list>\n<other><a></other>\n<link/>\n</list>\n");
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+    CPPUNIT_ASSERT_THROW(article.next("link"), TsParseException);
+
+    /// @test  File ends before the root element is closed.
+    writeFile("<list>\n<link/>\n");
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+    CPPUNIT_ASSERT(0 != article.next("link"));
+    CPPUNIT_ASSERT_THROW(article.next("link"), TsParseException);
+
+    /// @test  File ends within a tag, comment and CDATA section.
+    writeFile("<list>\n<link name='x");
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+    CPPUNIT_ASSERT_THROW(article.next("link"), TsParseException);
+    writeFile("<list>\n<!-- <link/>\n</list>\n");
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+    CPPUNIT_ASSERT_THROW(article.next("link"), TsParseException);
+    writeFile("<list>\n<link><![CDATA[</link>\n</list>\n");
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+    CPPUNIT_ASSERT_THROW(article.next("link"), TsParseException);
+
+    /// @test  Element that is well-nested but rejected by the element parser.
+    writeFile("<list>\n<link a='1' a='2'/>\n</list>\n");
+    CPPUNIT_ASSERT_NO_THROW(article.open(tFileName, "list"));
+    CPPUNIT_ASSERT_THROW(article.next("link"), TsParseException);
+
+    std::cout << " Pass";
+}
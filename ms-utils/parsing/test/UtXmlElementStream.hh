@@ -0,0 +1,64 @@
+#ifndef UtXmlElementStream_EXISTS
+#define UtXmlElementStream_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup  UT_TSM_UTILITIES_PARSING_XmlElementStream    XmlElementStream Unit Tests
+/// @ingroup   UT_TSM_UTILITIES_PARSING
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details   Unit Tests for the XmlElementStream class.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <string>
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    XmlElementStream unit tests.
+///
+/// @details  This class provides the unit tests for the XmlElementStream class within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtXmlElementStream : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this XmlElementStream unit test.
+        UtXmlElementStream();
+        /// @brief    Default destructs this XmlElementStream unit test.
+        virtual ~UtXmlElementStream();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief  Tests streaming of the root element's children.
+        void testNominal();
+        /// @brief  Tests finding the root element.
+        void testRoot();
+        /// @brief  Tests handling of ill-formed files.
+        void testErrors();
+    private:
+        CPPUNIT_TEST_SUITE(UtXmlElementStream);
+        CPPUNIT_TEST(testNominal);
+        CPPUNIT_TEST(testRoot);
+        CPPUNIT_TEST(testErrors);
+        CPPUNIT_TEST_SUITE_END();
+
+        std::string tFileName; /**< (--) Name of the temporary XML file used by each test */
+
+        /// @brief  Writes the given contents to the temporary XML file.
+        void writeFile(const std::string& contents);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        UtXmlElementStream(const UtXmlElementStream&);
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        UtXmlElementStream& operator =(const UtXmlElementStream&);
+};
+
+/// @}
+
+#endif
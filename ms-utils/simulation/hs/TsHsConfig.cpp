@@ -37,6 +37,7 @@ TsHsConfig::TsHsConfig() :
     mTerminationSubsystems(""),
     mQueueBlockingEnabled(1),
     mQueueCapacity(4000),
+    mQueueLockFreeEnabled(0),
     mTextPluginEnabled(1),
     mTextPluginBlockingEnabled(1),
     mTextPluginOverwriteEnabled(1),
@@ -73,6 +74,7 @@ TsHsConfig::TsHsConfig(const TsHsConfig& config) :
     mTerminationSubsystems(config.mTerminationSubsystems),
     mQueueBlockingEnabled(config.mQueueBlockingEnabled),
     mQueueCapacity(config.mQueueCapacity),
+    mQueueLockFreeEnabled(config.mQueueLockFreeEnabled),
     mTextPluginEnabled(config.mTextPluginEnabled),
     mTextPluginBlockingEnabled(config.mTextPluginBlockingEnabled),
     mTextPluginOverwriteEnabled(config.mTextPluginOverwriteEnabled),
@@ -272,6 +274,13 @@ bool TsHsConfig::loadConfigFile(ifstream& file)
         return false;
    }
 
+   // Line 8 is optional so older config files still load.
+   int lock_free = 0;
+   if (file >> lock_free)
+   {
+        mQueueLockFreeEnabled = lock_free;
+   }
+
    return true;
 }
 
@@ -319,4 +328,7 @@ void TsHsConfig::dumpConfig() const
         << " " << mCategoryFilterErrorsEnabled
         << " " << mCategoryFilterFatalsEnabled
         << endl;
+
+   cout << " " << mQueueLockFreeEnabled
+        << endl;
 }
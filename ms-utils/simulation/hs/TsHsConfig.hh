@@ -74,6 +74,7 @@ public:
    // Queue config
    int    mQueueBlockingEnabled;            //    (--) If non-zero simultaneous attempt to insert into queue will result in threads waiting.
    int    mQueueCapacity;                   //    (--) The maximum number of logging requests that will fit in the queue without overflow.
+   int    mQueueLockFreeEnabled;            //    (--) If non-zero threads insert into the lock-free ring without waiting, and the newest request is dropped on overflow.
 
    // Text plugin
    int    mTextPluginEnabled;               //    (--) Enables the text plugin.
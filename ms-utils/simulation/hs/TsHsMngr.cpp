@@ -18,6 +18,7 @@ LIBRARY DEPENDENCY:
    (
     (TsHsTextPlugin.o)
     (TsHsOutputPlugin.o)
+    (TsHsMsgDeferred.o)
    )
 
 PROGRAMMERS:
@@ -65,3 +66,23 @@ void TsHsMngr::registerSelf()
     tsGlobalHsMngr = this;
 }
 
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Logs a message recorded as a format and its arguments. This formats the text now and
+///          logs it with msg. Managers which queue messages can override this to format the text
+///          later, off the caller's thread.
+///
+/// @param[in] file      (--) name of file which initiated logging the message.
+/// @param[in] line      (--) line of file which initiated logging the message.
+/// @param[in] function  (--) function which initiated logging the message.
+/// @param[in] type      (--) the type of message (e.g. info, warning, etc.).
+/// @param[in] subsys    (--) the subsystem from which the message originated.
+/// @param[in] deferred  (--) the message format and arguments.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMngr::msgDeferred(const char* file, const int line, const char* function,
+        TS_HS_MSG_TYPE type, const char* subsys, const TsHsMsgDeferred& deferred)
+{
+    std::string mtext;
+    deferred.format(mtext);
+    msg(file, line, function, type, subsys, mtext);
+}
@@ -22,6 +22,7 @@ PROGRAMMERS:
 #include <string>
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "TS_hs_msg_types.h"
+#include "TsHsMsgDeferred.hh"
 
 /// @brief Health and Status (HS) logging base class. Provides interfaces for init, update, msg,
 ///        and shutdown methods. Provides an implementation for registerSelf method.
@@ -62,6 +63,10 @@ class TsHsMngr
         virtual void msg(const std::string& file, const int line, const std::string& function,
                 TS_HS_MSG_TYPE  type, const std::string& subsys, const std::string& mtext) = 0;
 
+        /// @brief Should be called as needed to log a message whose text can be formatted later.
+        virtual void msgDeferred(const char* file, const int line, const char* function,
+                TS_HS_MSG_TYPE  type, const char* subsys, const TsHsMsgDeferred& deferred);
+
         /// @brief Should be called once to shut down the manager. Typically called as a trick shutdown job.
         virtual void shutdown() = 0;
 
@@ -35,6 +35,7 @@ PROGRAMMERS:
 #include <iostream>
 #include <sstream>
 #include <cstdlib>
+#include <cstdarg>
 #include <vector>
 
 #include <cxxabi.h>
@@ -396,3 +397,35 @@ void tsHsSendMsgFileLine(const std::string& file, unsigned line, const std::stri
     tsGlobalHsMngr->msg(file, line, function, severity, simsubsys, mtext.c_str());
 #endif
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   A non-class function which sends a message to the message log, recorded as its format
+///            and argument values so the text can be formatted later. This version is intended for
+///            use by the hsSendDeferredMsg macro. Nothing is allocated or formatted here.
+///
+/// @param[in] file     (--) Source file name invoking 'send'; typically __FILE__ macro is used.
+/// @param[in] line     (--) Line in file invoking 'send'; typically __LINE__ macro is used.
+/// @param[in] function (--) The name of the function logging the message; typically __func__.
+/// @param[in] severity (--) Enumeration constant that represents the type of message.
+/// @param[in] subsys   (--) The subsystem that is logging the message.
+/// @param[in] format   (--) The printf-style format of the message text, must be a string literal.
+/// @param[in] ...      (--) The arguments used by the format.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void tsHsSendDeferredMsgFileLine(const char* file, unsigned line, const char* function,
+        TS_HS_MSG_TYPE severity, const char* subsys, const char* format, ...)
+{
+    if (!TsHsMsg::isEnabled() || tsGlobalHsMngr == 0)
+        return;
+
+    TsHsMsgDeferred deferred;
+    va_list args;
+    va_start(args, format);
+    deferred.capture(format, args);
+    va_end(args);
+
+#ifdef no_TRICK_ENV
+    tsGlobalHsMngr->msgDeferred(file, line, function, severity, subsys, deferred);
+#else
+    tsGlobalHsMngr->msgDeferred(file, line, function, severity, tsHsGetSubstringFromJob(subsys), deferred);
+#endif
+}
@@ -72,6 +72,18 @@ ICG: (No)
 ///          the use of stream manipulators, i.e. setw, setfill, etc. Just remember to include
 ///          "<iomanip>".
 ///
+/// @details In code that runs every frame, such as a solver that may warn every step, the cost of
+///          building the text can be moved off the model thread with the hsSendDeferredMsg macro.
+///          It takes a printf-style format, which must be a string literal, and its arguments:
+/// @code
+///          hsSendDeferredMsg(TS_HS_WARNING, "ECLSS", "%s failed to converge in %d iterations.",
+///                            name.c_str(), iterations);
+/// @endcode
+/// @details Only the format's address and the raw argument values are recorded on the calling
+///          thread. When the H&S manager's queue is in lock-free mode, the text is formatted when
+///          the output thread removes the message from the queue, otherwise it is formatted right
+///          away. See TsHsMsgDeferred.
+///
 /// @details There are other ways to use the TsHsMsg class which involve using setters and the
 ///          send methods, but the ways outlined above will usually suffice. The 'send' methods
 ///          have a slight disadvantage compared to the macros in that they do not automatically
@@ -153,6 +165,15 @@ void tsHsSendMsgFileLine(const std::string&, unsigned, const std::string&, const
 /// @brief Used by the hsSendMsg macro when the macro is invoked with severity, subsystem, and message text arguments.
 void tsHsSendMsgFileLine(const std::string&, unsigned, const std::string&, TS_HS_MSG_TYPE, const std::string&, const std::string&);
 
+/// @brief Convenience macro which records a message's format and arguments, supplies file name and line
+///        information, and sends the message to be formatted later.
+#define hsSendDeferredMsg(severity, subsys, format, args...) \
+    tsHsSendDeferredMsgFileLine(__FILE__, __LINE__, __func__, severity, subsys, format, ##args)
+
+/// @brief Used by the hsSendDeferredMsg macro.
+void tsHsSendDeferredMsgFileLine(const char*, unsigned, const char*, TS_HS_MSG_TYPE, const char*, const char*, ...)
+    __attribute__((format(printf, 6, 7)));
+
 /// @brief Generate a stack trace string
 std::string tsStackTrace();
 
@@ -0,0 +1,449 @@
+/**
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+- (Records a health and status message as a static printf-style format and its raw argument
+   values, so that formatting the message text can be deferred to the H&S output thread.)
+
+REQUIREMENTS:
+   ()
+
+REFERENCE:
+   ()
+
+ASSUMPTIONS AND LIMITATIONS:
+   ()
+
+LIBRARY DEPENDENCY:
+   ()
+
+PROGRAMMERS:
+   ()
+*/
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "TsHsMsgDeferred.hh"
+
+namespace {
+
+/// @brief Length modifiers of a printf conversion specification.
+enum TsHsMsgLength {
+    LENGTH_NONE = 0, LENGTH_HH, LENGTH_H, LENGTH_L, LENGTH_LL, LENGTH_J, LENGTH_Z, LENGTH_T,
+    LENGTH_BIG_L
+};
+
+/// @brief The parts of a printf conversion specification, e.g. "%-*.3lld".
+struct TsHsMsgSpec {
+    const char*   mFlags;          // ** (--) Start of the flag characters.
+    int           mNumFlags;       // ** (--) Number of flag characters.
+    const char*   mWidth;          // ** (--) Start of the width digits.
+    int           mNumWidth;       // ** (--) Number of width digits.
+    bool          mWidthStar;      // ** (--) Width is given by an argument.
+    bool          mPrecision;      // ** (--) Precision is present.
+    const char*   mPrecisionText;  // ** (--) Start of the precision digits.
+    int           mNumPrecision;   // ** (--) Number of precision digits.
+    bool          mPrecisionStar;  // ** (--) Precision is given by an argument.
+    TsHsMsgLength mLength;         // ** (--) Length modifier.
+    char          mConversion;     // ** (--) Conversion character, or 0 if malformed.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  format (--) Points to the '%' starting the conversion specification.
+/// @param[out] spec   (--) The parts of the conversion specification.
+///
+/// @returns    const char* (--) Points just past the conversion character.
+///
+/// @details    Parses a printf conversion specification. If it is malformed or uses an unknown
+///             conversion, the conversion is returned as 0.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const char* parseSpec(const char* format, TsHsMsgSpec& spec)
+{
+    const char* p = format + 1;
+
+    spec.mFlags = p;
+    while (0 != *p and 0 != strchr("-+ #0'", *p)) {
+        ++p;
+    }
+    spec.mNumFlags = static_cast<int>(p - spec.mFlags);
+
+    spec.mWidth     = p;
+    spec.mWidthStar = ('*' == *p);
+    if (spec.mWidthStar) {
+        ++p;
+    } else {
+        while (*p >= '0' and *p <= '9') {
+            ++p;
+        }
+    }
+    spec.mNumWidth = spec.mWidthStar ? 0 : static_cast<int>(p - spec.mWidth);
+
+    spec.mPrecision     = ('.' == *p);
+    spec.mPrecisionStar = false;
+    spec.mNumPrecision  = 0;
+    if (spec.mPrecision) {
+        ++p;
+        spec.mPrecisionText = p;
+        spec.mPrecisionStar = ('*' == *p);
+        if (spec.mPrecisionStar) {
+            ++p;
+        } else {
+            while (*p >= '0' and *p <= '9') {
+                ++p;
+            }
+            spec.mNumPrecision = static_cast<int>(p - spec.mPrecisionText);
+        }
+    } else {
+        spec.mPrecisionText = p;
+    }
+
+    spec.mLength = LENGTH_NONE;
+    switch (*p) {
+        case 'h': ++p; if ('h' == *p) {++p; spec.mLength = LENGTH_HH;} else {spec.mLength = LENGTH_H;} break;
+        case 'l': ++p; if ('l' == *p) {++p; spec.mLength = LENGTH_LL;} else {spec.mLength = LENGTH_L;} break;
+        case 'q': ++p; spec.mLength = LENGTH_LL;    break;
+        case 'j': ++p; spec.mLength = LENGTH_J;     break;
+        case 'z': ++p; spec.mLength = LENGTH_Z;     break;
+        case 't': ++p; spec.mLength = LENGTH_T;     break;
+        case 'L': ++p; spec.mLength = LENGTH_BIG_L; break;
+        default: break;
+    }
+
+    spec.mConversion = 0;
+    if (0 != *p and 0 != strchr("%diuoxXcsfFeEgGaApn", *p)) {
+        spec.mConversion = *p;
+        ++p;
+    }
+    return p;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this deferred message with no format.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgDeferred::TsHsMsgDeferred()
+    :
+    mFormat(0),
+    mNumArgs(0),
+    mArgs(),
+    mStringsSize(0),
+    mStrings(),
+    mTruncated(false)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this deferred message.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgDeferred::~TsHsMsgDeferred()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Clears the format, arguments and strings.  The last character of the strings buffer
+///           is kept as a terminator for strings that didn't fit.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgDeferred::clear()
+{
+    mFormat      = 0;
+    mNumArgs     = 0;
+    mStringsSize = 0;
+    mTruncated   = false;
+    mStrings[STRINGS_SIZE - 1] = '\0';
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] type     (--) Type of the argument.
+/// @param[in] integer  (--) Integer, pointer or string offset value.
+/// @param[in] floating (--) Floating-point value.
+///
+/// @details  Adds the argument if there is room, otherwise flags the message as truncated.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgDeferred::addArg(const ArgType type, const long long integer, const double floating)
+{
+    if (mNumArgs < MAX_ARGS) {
+        mArgs[mNumArgs].mType     = type;
+        mArgs[mNumArgs].mInteger  = integer;
+        mArgs[mNumArgs].mFloating = floating;
+        ++mNumArgs;
+    } else {
+        mTruncated = true;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] value (--) The string argument, may be null.
+///
+/// @details  Copies as much of the string as fits in the strings buffer, and adds its offset as a
+///           string argument.  A string that doesn't fit is recorded as cut short, so it is marked
+///           when formatted, and flags the message as truncated.  A null string is recorded as
+///           "(null)", like glibc prints it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgDeferred::addString(const char* value)
+{
+    if (0 == value) {
+        value = "(null)";
+    }
+
+    int offset = STRINGS_SIZE - 1;
+    if (mStringsSize < STRINGS_SIZE - 1) {
+        offset = mStringsSize;
+        while (0 != *value and mStringsSize < STRINGS_SIZE - 2) {
+            mStrings[mStringsSize++] = *value++;
+        }
+        mStrings[mStringsSize++] = '\0';
+    }
+    if (0 != *value) {
+        mTruncated = true;
+        addArg(STRING_CUT, offset, 0.0);
+    } else {
+        addArg(STRING, offset, 0.0);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] format (--) The printf-style format of the message, e.g. a string literal.
+/// @param[in] args   (--) The arguments used by the format.
+///
+/// @details  Walks the format and pulls each argument it uses off the argument list with the type
+///           its conversion specification says, and records it.  Integers are recorded with the
+///           conversion their length modifier implies, so they format the same later.  Nothing is
+///           formatted.  A malformed conversion specification ends the walk, and is formatted
+///           literally with the rest of the format.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgDeferred::capture(const char* format, va_list args)
+{
+    clear();
+    mFormat = format;
+    if (0 == format) {
+        return;
+    }
+
+    const char* p = format;
+    while (0 != *p) {
+        if ('%' != *p) {
+            ++p;
+            continue;
+        }
+
+        TsHsMsgSpec spec;
+        p = parseSpec(p, spec);
+        if ('%' == spec.mConversion) {
+            continue;
+        } else if (0 == spec.mConversion) {
+            break;
+        }
+
+        if (spec.mWidthStar) {
+            addArg(SIGNED, va_arg(args, int), 0.0);
+        }
+        if (spec.mPrecisionStar) {
+            addArg(SIGNED, va_arg(args, int), 0.0);
+        }
+
+        switch (spec.mConversion) {
+            case 'd':
+            case 'i': {
+                long long value;
+                switch (spec.mLength) {
+                    case LENGTH_HH: value = static_cast<signed char>(va_arg(args, int)); break;
+                    case LENGTH_H:  value = static_cast<short>(va_arg(args, int));       break;
+                    case LENGTH_L:  value = va_arg(args, long);                          break;
+                    case LENGTH_LL: value = va_arg(args, long long);                     break;
+                    case LENGTH_J:  value = va_arg(args, intmax_t);                      break;
+                    case LENGTH_Z:  value = va_arg(args, ssize_t);                       break;
+                    case LENGTH_T:  value = va_arg(args, ptrdiff_t);                     break;
+                    default:        value = va_arg(args, int);                           break;
+                }
+                addArg(SIGNED, value, 0.0);
+            } break;
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X': {
+                unsigned long long value;
+                switch (spec.mLength) {
+                    case LENGTH_HH: value = static_cast<unsigned char>(va_arg(args, unsigned int));  break;
+                    case LENGTH_H:  value = static_cast<unsigned short>(va_arg(args, unsigned int)); break;
+                    case LENGTH_L:  value = va_arg(args, unsigned long);                             break;
+                    case LENGTH_LL: value = va_arg(args, unsigned long long);                        break;
+                    case LENGTH_J:  value = va_arg(args, uintmax_t);                                 break;
+                    case LENGTH_Z:  value = va_arg(args, size_t);                                    break;
+                    case LENGTH_T:  value = static_cast<unsigned long long>(va_arg(args, ptrdiff_t)); break;
+                    default:        value = va_arg(args, unsigned int);                              break;
+                }
+                addArg(UNSIGNED, static_cast<long long>(value), 0.0);
+            } break;
+            case 'c':
+                addArg(UNSIGNED, static_cast<unsigned char>(va_arg(args, int)), 0.0);
+                break;
+            case 's':
+                if (LENGTH_NONE == spec.mLength) {
+                    addString(va_arg(args, const char*));
+                } else {
+                    // Wide strings aren't supported, they are recorded as empty strings.
+                    (void) va_arg(args, const void*);
+                    addString("");
+                    mTruncated = true;
+                }
+                break;
+            case 'p':
+                addArg(POINTER, static_cast<long long>(reinterpret_cast<intptr_t>(va_arg(args, void*))), 0.0);
+                break;
+            case 'n':
+                // Nothing is written back to the caller, the pointer is just skipped.
+                (void) va_arg(args, void*);
+                break;
+            default:
+                // Floating-point conversions.
+                if (LENGTH_BIG_L == spec.mLength) {
+                    addArg(FLOATING, 0, static_cast<double>(va_arg(args, long double)));
+                } else {
+                    addArg(FLOATING, 0, va_arg(args, double));
+                }
+                break;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] format (--) The printf-style format of the message, e.g. a string literal.
+/// @param[in] ...    (--) The arguments used by the format.
+///
+/// @details  Convenience overload of capture taking the arguments directly.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgDeferred::capturef(const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    capture(format, args);
+    va_end(args);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] text (--) The formatted message text.
+///
+/// @details  Walks the format again and formats each conversion with its recorded argument.  Each
+///           conversion specification is rebuilt with any '*' width and precision replaced by their
+///           recorded values, and with the length modifier that matches the recorded type.  If
+///           arguments were dropped to fit, the rest of the format is output literally.  Each
+///           conversion is limited to 511 characters.  A string argument that was cut short, or a
+///           conversion cut to this limit, is followed by "..." to mark the truncation.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgDeferred::format(std::string& text) const
+{
+    text.clear();
+    if (0 == mFormat) {
+        return;
+    }
+
+    int arg = 0;
+    const char* literal = mFormat;
+    const char* p       = mFormat;
+    while (0 != *p) {
+        if ('%' != *p) {
+            ++p;
+            continue;
+        }
+
+        text.append(literal, p - literal);
+        literal = p;
+
+        TsHsMsgSpec spec;
+        const char* next = parseSpec(p, spec);
+        if ('%' == spec.mConversion) {
+            text += '%';
+            p = literal = next;
+            continue;
+        }
+
+        const int numArgs = (spec.mWidthStar ? 1 : 0) + (spec.mPrecisionStar ? 1 : 0)
+                          + ('n' == spec.mConversion ? 0 : 1);
+        if (0 == spec.mConversion or arg + numArgs > mNumArgs) {
+            break;
+        }
+
+        /// - Rebuild the conversion specification.
+        char conversion[64];
+        int  length = snprintf(conversion, sizeof(conversion), "%%%.*s", spec.mNumFlags, spec.mFlags);
+        if (spec.mWidthStar) {
+            length += snprintf(conversion + length, sizeof(conversion) - length, "%lld",
+                               mArgs[arg++].mInteger);
+        } else {
+            length += snprintf(conversion + length, sizeof(conversion) - length, "%.*s",
+                               spec.mNumWidth, spec.mWidth);
+        }
+        if (spec.mPrecisionStar) {
+            /// - A negative '*' precision is taken as if the precision were omitted.
+            const long long precision = mArgs[arg++].mInteger;
+            if (precision >= 0) {
+                length += snprintf(conversion + length, sizeof(conversion) - length, ".%lld",
+                                   precision);
+            }
+        } else if (spec.mPrecision) {
+            length += snprintf(conversion + length, sizeof(conversion) - length, ".%.*s",
+                               spec.mNumPrecision, spec.mPrecisionText);
+        }
+        const bool isInteger = (0 != strchr("diuoxX", spec.mConversion));
+        snprintf(conversion + length, sizeof(conversion) - length, "%s%c",
+                 isInteger ? "ll" : "", spec.mConversion);
+
+        /// - Format the argument with the rebuilt specification.
+        char buffer[512];
+        int  written = 0;
+        bool cut     = false;
+        if ('n' != spec.mConversion) {
+            const Arg& value = mArgs[arg++];
+            cut = (STRING_CUT == value.mType);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+            switch (value.mType) {
+                case SIGNED:
+                    written = snprintf(buffer, sizeof(buffer), conversion, value.mInteger);
+                    break;
+                case UNSIGNED:
+                    if ('c' == spec.mConversion) {
+                        written = snprintf(buffer, sizeof(buffer), conversion,
+                                           static_cast<int>(value.mInteger));
+                    } else {
+                        written = snprintf(buffer, sizeof(buffer), conversion,
+                                           static_cast<unsigned long long>(value.mInteger));
+                    }
+                    break;
+                case FLOATING:
+                    written = snprintf(buffer, sizeof(buffer), conversion, value.mFloating);
+                    break;
+                case STRING:
+                case STRING_CUT:
+                    written = snprintf(buffer, sizeof(buffer), conversion,
+                                       mStrings + value.mInteger);
+                    break;
+                default:
+                    written = snprintf(buffer, sizeof(buffer), conversion,
+                                       reinterpret_cast<void*>(static_cast<intptr_t>(value.mInteger)));
+                    break;
+            }
+#pragma GCC diagnostic pop
+        }
+        if (written >= static_cast<int>(sizeof(buffer))) {
+            written = static_cast<int>(sizeof(buffer)) - 1;
+            cut     = true;
+        }
+        if (written > 0) {
+            text.append(buffer, written);
+        }
+        if (cut) {
+            text += "...";
+        }
+        p = literal = next;
+    }
+    text.append(literal);
+}
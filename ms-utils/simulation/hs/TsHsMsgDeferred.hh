@@ -0,0 +1,125 @@
+#ifndef TsHsMsgDeferred_EXISTS
+#define TsHsMsgDeferred_EXISTS
+
+/**
+@defgroup  TSM_UTILITIES_SIMULATION_HS_MSG_DEFERRED Deferred Message
+@ingroup   TSM_UTILITIES_SIMULATION_HS
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Records a health and status message as a static printf-style format and its raw argument
+   values, so that formatting the message text can be deferred to the H&S output thread.)
+
+REQUIREMENTS:
+- (TBD)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- ((The format must be a string literal or otherwise outlive the message, since only its address is
+    recorded.)
+   (At most MAX_ARGS arguments are recorded, including '*' widths and precisions. String arguments
+    are copied and share STRINGS_SIZE characters, so long names can be cut short. Arguments or
+    strings past these limits are dropped and the message is flagged as truncated, and a string
+    cut short is followed by "..." in the formatted text.)
+   (Long double arguments are recorded as double. The %n conversion is not supported.))
+
+LIBRARY DEPENDENCY:
+- ((TsHsMsgDeferred.o))
+
+PROGRAMMERS:
+- ()
+
+ICG: (No)
+
+@{
+*/
+
+#include <cstdarg>
+#include <string>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief   A health and status message's format and raw argument values.
+///
+/// @details Capturing a message only walks its format to pull the arguments off the va_list and
+///          copies string arguments into a fixed buffer, so it never allocates memory and does no
+///          number to text conversion. The message uses the implicit copy constructor and
+///          assignment operator, so it can be copied as a plain fixed-size object, for example into
+///          a TsHsMsgQueue ring slot, and formatted to text later, typically on the H&S output
+///          thread. Formatting gives the same text as vsnprintf would have at the call
+///          site, as long as the arguments fit in the capacity Limits below.
+//////////////////////////////////////////////////////////////////////////////////////////////////
+class TsHsMsgDeferred
+{
+public:
+    /// @brief Capacity limits of the recorded arguments.
+    enum Limits {
+        MAX_ARGS     = 8,   ///< Maximum number of recorded arguments.
+        STRINGS_SIZE = 256  ///< Size of the buffer for string arguments, including terminators.
+    };
+
+    /// @brief Types of the recorded arguments.
+    enum ArgType {
+        SIGNED     = 0,     ///< Signed integer argument, or '*' width or precision.
+        UNSIGNED   = 1,     ///< Unsigned integer or character argument.
+        FLOATING   = 2,     ///< Floating-point argument.
+        STRING     = 3,     ///< String argument, an offset into mStrings.
+        POINTER    = 4,     ///< Pointer argument.
+        STRING_CUT = 5      ///< String argument cut short to fit, an offset into mStrings.
+    };
+
+    /// @brief A recorded argument value.
+    struct Arg {
+        ArgType     mType;            // ** (--) Type of the argument.
+        long long   mInteger;         // ** (--) Integer, pointer or string offset value.
+        double      mFloating;        // ** (--) Floating-point value.
+    };
+
+    /// @brief Default constructor.
+    TsHsMsgDeferred();
+
+    /// @brief Default destructor.
+    ~TsHsMsgDeferred();
+
+    /// @brief Records the format and the arguments it uses from the argument list.
+    void capture(const char* format, va_list args);
+
+    /// @brief Records the format and the arguments it uses.
+    void capturef(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+    /// @brief Clears the recorded message.
+    void clear();
+
+    /// @brief Formats the recorded message to text.
+    void format(std::string& text) const;
+
+    /// @brief Returns the recorded format, or null if none.
+    const char* getFormat() const { return mFormat; }
+
+    /// @brief Returns the number of recorded arguments.
+    int getNumArgs() const { return mNumArgs; }
+
+    /// @brief Returns true if arguments or strings were dropped to fit.
+    bool isTruncated() const { return mTruncated; }
+
+protected:
+    const char* mFormat;                  // ** (--) The static format of the message.
+    int         mNumArgs;                 // ** (--) Number of recorded arguments.
+    Arg         mArgs[MAX_ARGS];          // ** (--) Recorded argument values.
+    int         mStringsSize;             // ** (--) Number of characters used in mStrings.
+    char        mStrings[STRINGS_SIZE];   // ** (--) Copies of the string arguments.
+    bool        mTruncated;               // ** (--) Arguments or strings were dropped to fit.
+
+    /// @brief Adds an argument to the recorded arguments.
+    void addArg(const ArgType type, const long long integer, const double floating);
+    /// @brief Adds a copy of a string argument to the recorded arguments.
+    void addString(const char* value);
+};
+
+/// @}
+
+#endif /* TsHsMsgDeferred_EXISTS */
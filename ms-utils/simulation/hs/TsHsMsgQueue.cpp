@@ -31,6 +31,7 @@ PROGRAMMERS:
 #include <algorithm>
 #include <execinfo.h>
 #include <pthread.h>
+#include <sched.h>
 
 #include "TsHsMsgQueue.hh"
 
@@ -52,6 +53,23 @@ TsHsMsgQueueNode::TsHsMsgQueueNode() :
 {
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Default constructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgRingSlot::TsHsMsgRingSlot() :
+    mSequence(0),
+    mFile(),
+    mLine(0),
+    mFunction(),
+    mType(TS_HS_DEBUG),
+    mSubsys(),
+    mText(),
+    mMet(),
+    mTimestamp(0L),
+    mDeferred()
+{
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details   Default constructor.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,7 +81,15 @@ TsHsMsgQueue::TsHsMsgQueue(void) :
     mMutex(),
     mBlocking(false),
     mTryLockFailures(0),
-    mOverflowCount(0)
+    mOverflowCount(0),
+    mLockFree(false),
+    mRing(0),
+    mRingSize(0),
+    mRingInsertPos(0),
+    mRingRemovePos(0),
+    mTruncations(0),
+    mInserting(0),
+    mReinitializing(false)
 {
 }
 
@@ -81,7 +107,15 @@ TsHsMsgQueue::TsHsMsgQueue(int size, bool blocking) :
     mMutex(),
     mBlocking(blocking),
     mTryLockFailures(0),
-    mOverflowCount(0)
+    mOverflowCount(0),
+    mLockFree(false),
+    mRing(0),
+    mRingSize(0),
+    mRingInsertPos(0),
+    mRingRemovePos(0),
+    mTruncations(0),
+    mInserting(0),
+    mReinitializing(false)
 {
     pthread_mutex_init(&mMutex, NULL);
     allocQueue(size);
@@ -93,6 +127,7 @@ TsHsMsgQueue::TsHsMsgQueue(int size, bool blocking) :
 TsHsMsgQueue::~TsHsMsgQueue()
 {
     delete [] mAllocation;
+    delete [] mRing;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -100,6 +135,9 @@ TsHsMsgQueue::~TsHsMsgQueue()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 int TsHsMsgQueue::getCapacity() const
 {
+    if (mLockFree)
+        return static_cast<int>(mRingSize);
+
     if (mAllocatedSize == 0)
         return 0;
 
@@ -112,33 +150,119 @@ int TsHsMsgQueue::getCapacity() const
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 int TsHsMsgQueue::getSize() const
 {
+    // Messages claimed in the ring but not yet published are counted.
+    int size = 0;
+    if (mRing != 0)
+    {
+        size = static_cast<int>(__atomic_load_n(&mRingInsertPos, __ATOMIC_RELAXED) -
+                                __atomic_load_n(&mRingRemovePos, __ATOMIC_RELAXED));
+    }
+
     if (mHead == 0 || mTail == 0 || mAllocatedSize == 0)
-       return 0;
+       return size;
 
     if (mHead <= mTail)
-       return mTail-mHead;
+       return size + (mTail-mHead);
     else
-       return mAllocatedSize - (mHead-mTail);
+       return size + mAllocatedSize - (mHead-mTail);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Returns true if the next insert would overflow. In lock-free mode that is when every
+///            ring slot is occupied, including the slots claimed but not yet published, since the
+///            inserts don't go to the locked queue.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsMsgQueue::isFull() const
+{
+    if (mLockFree)
+    {
+        return __atomic_load_n(&mRingInsertPos, __ATOMIC_RELAXED) -
+               __atomic_load_n(&mRingRemovePos, __ATOMIC_RELAXED) >= mRingSize;
+    }
+    return isQueueFull();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Returns true if the message at the ring remove position has not been published yet.
+///            Only meaningful to the consumer, since producers may publish at any time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsMsgQueue::isRingEmpty() const
+{
+    if (mRing == 0)
+        return true;
+
+    const unsigned long pos = __atomic_load_n(&mRingRemovePos, __ATOMIC_RELAXED);
+    return __atomic_load_n(&mRing[pos % mRingSize].mSequence, __ATOMIC_ACQUIRE) != pos + 1;
 }
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details   Initializes (or re-initializes) the queue.
+/// @details   Initializes (or re-initializes) the queue. In lock-free mode the locked queue is
+///            kept to hold any messages outstanding from before the re-initialization, and these
+///            are removed before the messages in the ring. The queue and ring are only re-allocated
+///            once the threads already inserting have finished, and new inserts are held off until
+///            this returns.
 ///
 /// @param[in] size     (--) The maximum number of messages the queue can hold before overflow occurs.
 /// @param[in] blocking (--) True if user is willing to allow insertMsg to block.
+/// @param[in] lockFree (--) True to insert into the lock-free ring instead of the locked queue.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void TsHsMsgQueue::initialize(int size, bool blocking)
+void TsHsMsgQueue::initialize(int size, bool blocking, bool lockFree)
 {
-    mBlocking = blocking;
+    __atomic_store_n(&mReinitializing, true, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&mInserting, __ATOMIC_SEQ_CST) != 0)
+    {
+        sched_yield();
+    }
+
+    __atomic_store_n(&mBlocking, blocking, __ATOMIC_RELAXED);
+
+    // Messages moved from the old queue and ring are re-inserted into the locked queue.
+    mLockFree = false;
     reallocQueue(size);
+    allocRing(lockFree ? size : 0);
+    mLockFree = lockFree;
+
+    __atomic_store_n(&mReinitializing, false, __ATOMIC_SEQ_CST);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details   Inserts a message request at the tail of the queue. If queue overflows, the oldest
-///            message will be silently overwritten. A counter is kept to record how many time
-///            this happens. Inserts can be blocking or not. If not blocking then messages will
-///            be dropped if a lock cannot be achieved.
+/// @details   Registers the calling thread as inserting, so a re-initialization waits for it to
+///            finish before re-allocating the queue and ring. While a re-initialization is under
+///            way, a blocking insert waits for it, and a non-blocking insert is skipped and counted
+///            as a lock failure.
+///
+/// @return Returns true if the thread may insert, and must then call exitInsert.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsMsgQueue::enterInsert()
+{
+    for (;;)
+    {
+        __atomic_fetch_add(&mInserting, 1, __ATOMIC_SEQ_CST);
+        if (not __atomic_load_n(&mReinitializing, __ATOMIC_SEQ_CST))
+            return true;
+
+        exitInsert();
+        if (not __atomic_load_n(&mBlocking, __ATOMIC_RELAXED))
+        {
+            __atomic_fetch_add(&mTryLockFailures, 1, __ATOMIC_RELAXED);
+            return false;
+        }
+        sched_yield();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Unregisters a thread registered by enterInsert.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgQueue::exitInsert()
+{
+    __atomic_fetch_sub(&mInserting, 1, __ATOMIC_RELEASE);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Inserts a message request at the tail of the queue, or into the lock-free ring in
+///            lock-free mode.
 ///
 /// @param[in] file       (--) Source file name invoking 'send'; typically __FILE__ macro is used.
 /// @param[in] line       (--) Line in file invoking 'send'; typically __LINE__ macro is used.
@@ -158,6 +282,46 @@ void TsHsMsgQueue::insertMsg(
     const std::string& mtext,
     TS_TIMER_TYPE      met,
     unsigned long      timestamp)
+{
+    if (not enterInsert())
+        return;
+
+    if (mLockFree)
+    {
+        insertRingMsg(file, line, function, type, subsys, mtext, met, timestamp);
+    }
+    else
+    {
+        insertQueueMsg(file, line, function, type, subsys, mtext, met, timestamp);
+    }
+
+    exitInsert();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Inserts a message request at the tail of the locked queue. If queue overflows, the
+///            oldest message will be silently overwritten. A counter is kept to record how many
+///            time this happens. Inserts can be blocking or not. If not blocking then messages will
+///            be dropped if a lock cannot be achieved.
+///
+/// @param[in] file       (--) Source file name invoking 'send'; typically __FILE__ macro is used.
+/// @param[in] line       (--) Line in file invoking 'send'; typically __LINE__ macro is used.
+/// @param[in] function   (--) The name of the function logging the message; typically __func__.
+/// @param[in] type       (--) Enumeration constant that represents the type of message.
+/// @param[in] subsys     (--) The subsystem that is logging the message.
+/// @param[in] mtext      (--) The message text.
+/// @param[in] met        (--) The mission elapsed time.
+/// @param[in] timestamp  (--) The Unix timestamp.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgQueue::insertQueueMsg(
+    const std::string& file,
+    const int          line,
+    const std::string& function,
+    TS_HS_MSG_TYPE     type,
+    const std::string& subsys,
+    const std::string& mtext,
+    TS_TIMER_TYPE      met,
+    unsigned long      timestamp)
 {
     if (mBlocking)
     {
@@ -183,7 +347,7 @@ void TsHsMsgQueue::insertMsg(
     mTail->mTimestamp = timestamp;
 
     // If we have filled the queue, overwrite the oldest node by moving the read pointer
-    if (isFull())
+    if (isQueueFull())
     {
         //cout << "overwriting message '" << mtext << "'" << endl;
         mHead = mHead->mNext;
@@ -199,16 +363,15 @@ void TsHsMsgQueue::insertMsg(
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details   Inserts a message request at the tail of the queue. If queue overflows, the oldest
-///            message will be silently overwritten. A counter is kept to record how many time
-///            this happens. Inserts can be blocking or not. If not blocking then messages will
-///            be dropped if a lock cannot be achieved.
+/// @details   Inserts a message request at the tail of the locked queue, as insertQueueMsg does.
+///            This is used to move messages while re-initializing, so it doesn't wait for the
+///            re-initialization to finish.
 ///
 /// @param[in] node     (--) node to add to queue.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void TsHsMsgQueue::insertMsg(TsHsMsgQueueNode& node)
 {
-    insertMsg(node.mFile, node.mLine, node.mFunction, node.mType, node.mSubsys, node.mText, node.mMet, node.mTimestamp);
+    insertQueueMsg(node.mFile, node.mLine, node.mFunction, node.mType, node.mSubsys, node.mText, node.mMet, node.mTimestamp);
 }
 
 
@@ -228,24 +391,295 @@ bool TsHsMsgQueue::removeMsg(TsHsMsgQueueNode& node)
 
     pthread_mutex_lock(&mMutex);
 
-    // Copy message at head of queue to return node
-    node.mFile      = mHead->mFile;
-    node.mLine      = mHead->mLine;
-    node.mFunction  = mHead->mFunction;
-    node.mType      = mHead->mType;
-    node.mSubsys    = mHead->mSubsys;
-    node.mText      = mHead->mText;
-    node.mMet       = mHead->mMet;
-    node.mTimestamp = mHead->mTimestamp;
-
-    // Update the head pointer
-    mHead = mHead->mNext;
+    // Messages in the locked queue are older than those in the ring, so are removed first.
+    bool removed = false;
+    if (mHead != mTail)
+    {
+        // Copy message at head of queue to return node
+        node.mFile      = mHead->mFile;
+        node.mLine      = mHead->mLine;
+        node.mFunction  = mHead->mFunction;
+        node.mType      = mHead->mType;
+        node.mSubsys    = mHead->mSubsys;
+        node.mText      = mHead->mText;
+        node.mMet       = mHead->mMet;
+        node.mTimestamp = mHead->mTimestamp;
+
+        // Update the head pointer
+        mHead = mHead->mNext;
+        removed = true;
+    }
+    else
+    {
+        removed = removeRingMsg(node);
+    }
 
     pthread_mutex_unlock(&mMutex);
 
+    return removed;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Inserts a message request into the lock-free ring. Any number of threads can insert
+///            at once: each claims the next ring position with a compare-and-swap, fills in the
+///            slot and then publishes it by advancing the slot's sequence number. If the ring is
+///            full, the new message is dropped and counted as an overflow, because the oldest
+///            message may be in the middle of being removed. Fields longer than the slots are
+///            truncated and counted. No memory is allocated and no lock is taken.
+///
+/// @param[in] file       (--) Source file name invoking 'send'; typically __FILE__ macro is used.
+/// @param[in] line       (--) Line in file invoking 'send'; typically __LINE__ macro is used.
+/// @param[in] function   (--) The name of the function logging the message; typically __func__.
+/// @param[in] type       (--) Enumeration constant that represents the type of message.
+/// @param[in] subsys     (--) The subsystem that is logging the message.
+/// @param[in] mtext      (--) The message text.
+/// @param[in] met        (--) The mission elapsed time.
+/// @param[in] timestamp  (--) The Unix timestamp.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgQueue::insertRingMsg(
+    const std::string& file,
+    const int          line,
+    const std::string& function,
+    TS_HS_MSG_TYPE     type,
+    const std::string& subsys,
+    const std::string& mtext,
+    TS_TIMER_TYPE      met,
+    unsigned long      timestamp)
+{
+    unsigned long pos = 0;
+    TsHsMsgRingSlot* slot = claimRingSlot(pos);
+    if (slot == 0)
+        return;
+
+    bool truncated = false;
+    truncated |= copyRingField(slot->mFile,     TsHsMsgRingSlot::FILE_SIZE,     file);
+    truncated |= copyRingField(slot->mFunction, TsHsMsgRingSlot::FUNCTION_SIZE, function);
+    truncated |= copyRingField(slot->mSubsys,   TsHsMsgRingSlot::SUBSYS_SIZE,   subsys);
+    truncated |= copyRingField(slot->mText,     TsHsMsgRingSlot::TEXT_SIZE,     mtext);
+    slot->mDeferred.clear();
+    slot->mLine      = line;
+    slot->mType      = type;
+    slot->mMet       = met;
+    slot->mTimestamp = timestamp;
+
+    publishRingSlot(slot, pos, truncated);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Inserts a message request whose text is to be formatted later. In lock-free mode the
+///            recorded format and arguments are copied into a ring slot as they are, and the text is
+///            only formatted when the message is removed, on the output thread. Otherwise the text
+///            is formatted now and inserted as usual.
+///
+/// @param[in] file       (--) Source file name invoking 'send'; typically __FILE__ macro is used.
+/// @param[in] line       (--) Line in file invoking 'send'; typically __LINE__ macro is used.
+/// @param[in] function   (--) The name of the function logging the message; typically __func__.
+/// @param[in] type       (--) Enumeration constant that represents the type of message.
+/// @param[in] subsys     (--) The subsystem that is logging the message.
+/// @param[in] deferred   (--) The message format and arguments.
+/// @param[in] met        (--) The mission elapsed time.
+/// @param[in] timestamp  (--) The Unix timestamp.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgQueue::insertDeferredMsg(
+    const char*            file,
+    const int              line,
+    const char*            function,
+    TS_HS_MSG_TYPE         type,
+    const char*            subsys,
+    const TsHsMsgDeferred& deferred,
+    TS_TIMER_TYPE          met,
+    unsigned long          timestamp)
+{
+    if (not enterInsert())
+        return;
+
+    if (mLockFree)
+    {
+        insertDeferredRingMsg(file, line, function, type, subsys, deferred, met, timestamp);
+    }
+    else
+    {
+        std::string mtext;
+        deferred.format(mtext);
+        insertQueueMsg(file, line, function, type, subsys, mtext, met, timestamp);
+    }
+
+    exitInsert();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Copies the recorded format and arguments of a deferred message into a ring slot as
+///            they are. Like insertRingMsg, this doesn't allocate memory or take a lock.
+///
+/// @param[in] file       (--) Source file name invoking 'send'; typically __FILE__ macro is used.
+/// @param[in] line       (--) Line in file invoking 'send'; typically __LINE__ macro is used.
+/// @param[in] function   (--) The name of the function logging the message; typically __func__.
+/// @param[in] type       (--) Enumeration constant that represents the type of message.
+/// @param[in] subsys     (--) The subsystem that is logging the message.
+/// @param[in] deferred   (--) The message format and arguments.
+/// @param[in] met        (--) The mission elapsed time.
+/// @param[in] timestamp  (--) The Unix timestamp.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgQueue::insertDeferredRingMsg(
+    const char*            file,
+    const int              line,
+    const char*            function,
+    TS_HS_MSG_TYPE         type,
+    const char*            subsys,
+    const TsHsMsgDeferred& deferred,
+    TS_TIMER_TYPE          met,
+    unsigned long          timestamp)
+{
+    unsigned long pos = 0;
+    TsHsMsgRingSlot* slot = claimRingSlot(pos);
+    if (slot == 0)
+        return;
+
+    bool truncated = deferred.isTruncated();
+    truncated |= copyRingField(slot->mFile,     TsHsMsgRingSlot::FILE_SIZE,     file);
+    truncated |= copyRingField(slot->mFunction, TsHsMsgRingSlot::FUNCTION_SIZE, function);
+    truncated |= copyRingField(slot->mSubsys,   TsHsMsgRingSlot::SUBSYS_SIZE,   subsys);
+    slot->mText[0]   = '\0';
+    slot->mDeferred  = deferred;
+    slot->mLine      = line;
+    slot->mType      = type;
+    slot->mMet       = met;
+    slot->mTimestamp = timestamp;
+
+    publishRingSlot(slot, pos, truncated);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Claims the next ring position for a producer. A slot is free for position pos when
+///            its sequence equals pos, and still holds the message from the last lap when its
+///            sequence is behind pos. If the ring is full, the overflow is counted.
+///
+/// @param[out] pos    (--) The claimed ring position.
+///
+/// @return Returns the claimed slot, or null if the ring is full.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgRingSlot* TsHsMsgQueue::claimRingSlot(unsigned long& pos)
+{
+    pos = __atomic_load_n(&mRingInsertPos, __ATOMIC_RELAXED);
+    for (;;)
+    {
+        TsHsMsgRingSlot* slot = &mRing[pos % mRingSize];
+        const long diff = static_cast<long>(__atomic_load_n(&slot->mSequence, __ATOMIC_ACQUIRE))
+                        - static_cast<long>(pos);
+        if (diff == 0)
+        {
+            if (__atomic_compare_exchange_n(&mRingInsertPos, &pos, pos + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                return slot;
+            }
+        }
+        else if (diff < 0)
+        {
+            __atomic_fetch_add(&mOverflowCount, 1, __ATOMIC_RELAXED);
+            return 0;
+        }
+        else
+        {
+            // Another producer claimed this position first.
+            pos = __atomic_load_n(&mRingInsertPos, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Publishes a filled slot to the consumer, and counts it if it was truncated.
+///
+/// @param[in] slot       (--) The filled slot.
+/// @param[in] pos        (--) The ring position claimed for the slot.
+/// @param[in] truncated  (--) True if any of the slot's fields were truncated.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgQueue::publishRingSlot(TsHsMsgRingSlot* slot, const unsigned long pos, const bool truncated)
+{
+    if (truncated)
+    {
+        __atomic_fetch_add(&mTruncations, 1, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&slot->mSequence, pos + 1, __ATOMIC_RELEASE);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Removes the oldest published message from the lock-free ring and places it in node,
+///            then frees its slot for the producers' next lap. The caller must hold the mutex.
+///
+/// @param[out] node   (--) The message request info from the ring is returned in this.
+///
+/// @return Returns true if successful, false if no message was ready to remove.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsMsgQueue::removeRingMsg(TsHsMsgQueueNode& node)
+{
+    if (mRing == 0)
+        return false;
+
+    const unsigned long pos = mRingRemovePos;
+    TsHsMsgRingSlot& slot = mRing[pos % mRingSize];
+    if (__atomic_load_n(&slot.mSequence, __ATOMIC_ACQUIRE) != pos + 1)
+        return false;
+
+    node.mFile      = slot.mFile;
+    node.mLine      = slot.mLine;
+    node.mFunction  = slot.mFunction;
+    node.mType      = slot.mType;
+    node.mSubsys    = slot.mSubsys;
+    if (slot.mDeferred.getFormat() != 0)
+    {
+        // Deferred messages are formatted here, on the consumer's thread.
+        slot.mDeferred.format(node.mText);
+    }
+    else
+    {
+        node.mText  = slot.mText;
+    }
+    node.mMet       = slot.mMet;
+    node.mTimestamp = slot.mTimestamp;
+
+    __atomic_store_n(&slot.mSequence, pos + mRingSize, __ATOMIC_RELEASE);
+    __atomic_store_n(&mRingRemovePos, pos + 1, __ATOMIC_RELAXED);
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Copies value into the null-terminated field, truncating it to fit if needed.
+///
+/// @param[out] field  (--) The ring slot field to copy into.
+/// @param[in]  size   (--) The size of the field, including the null terminator.
+/// @param[in]  value  (--) The string to copy.
+///
+/// @return Returns true if the value was truncated.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsMsgQueue::copyRingField(char* field, const unsigned int size, const std::string& value)
+{
+    const size_t length = value.copy(field, size - 1);
+    field[length] = '\0';
+    return length < value.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Copies value into the null-terminated field, truncating it to fit if needed.
+///
+/// @param[out] field  (--) The ring slot field to copy into.
+/// @param[in]  size   (--) The size of the field, including the null terminator.
+/// @param[in]  value  (--) The null-terminated string to copy.
+///
+/// @return Returns true if the value was truncated.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsMsgQueue::copyRingField(char* field, const unsigned int size, const char* value)
+{
+    unsigned int length = 0;
+    while (length < size - 1 and value[length] != '\0')
+    {
+        field[length] = value[length];
+        ++length;
+    }
+    field[length] = '\0';
+    return value[length] != '\0';
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details   Allocates memory for the queue. If size is <1, a queue big enough to hold 1 message
 ///            will be allocated.
@@ -279,6 +713,47 @@ void TsHsMsgQueue::allocQueue(int size)
     mHead = mTail;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Allocates the lock-free ring. Messages outstanding in an existing ring are first
+///            moved to the locked queue, oldest first. This is only called by initialize, once no
+///            thread is inserting, so no producer can still be using the ring it deletes. The ring
+///            has at least 2 slots, since a slot's sequence number must not reach the next
+///            position's until the consumer frees it. If size is <1, no ring is allocated.
+///
+/// @param[in] size     (--) The maximum number of messages the ring can hold before overflow occurs.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgQueue::allocRing(int size)
+{
+    if (mRing != 0)
+    {
+        TsHsMsgQueueNode node;
+        for (;;)
+        {
+            pthread_mutex_lock(&mMutex);
+            const bool removed = removeRingMsg(node);
+            pthread_mutex_unlock(&mMutex);
+            if (not removed)
+                break;
+            insertMsg(node);
+        }
+        delete [] mRing;
+        mRing = 0;
+    }
+
+    mRingSize      = 0;
+    mRingInsertPos = 0;
+    mRingRemovePos = 0;
+    if (size < 1)
+        return;
+
+    mRingSize = static_cast<unsigned long>(max(size, 2));
+    mRing     = new TsHsMsgRingSlot[mRingSize];
+    for (unsigned long i = 0; i < mRingSize; ++i)
+    {
+        mRing[i].mSequence = i;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details   Reallocates memory for the queue. Copies outstanding request from original queue to
 ///            resized queue. If resized queue is smaller, older request will be discarded.
@@ -23,7 +23,7 @@ ASSUMPTIONS AND LIMITATIONS:
 - (TBD)
 
 LIBRARY DEPENDENCY:
-- ((TsHsMsgQueue.o))
+- ((TsHsMsgQueue.o) (TsHsMsgDeferred.o))
 
 PROGRAMMERS:
 - (
@@ -39,6 +39,7 @@ PROGRAMMERS:
 
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "TS_hs_msg_types.h"
+#include "TsHsMsgDeferred.hh"
 #include "simulation/timer/TS_timer.h"
 //#include "TS_timer.h"
 
@@ -65,6 +66,37 @@ private:
     const TsHsMsgQueueNode& operator=(const TsHsMsgQueueNode&);
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief   Fixed size message slot used by the lock-free ring in TsHsMsgQueue. The strings are
+///          truncated to fit, so inserting a message never allocates memory.
+//////////////////////////////////////////////////////////////////////////////////////////////////
+class TsHsMsgRingSlot
+{
+    TS_MAKE_SIM_COMPATIBLE(TsHsMsgRingSlot);
+public:
+    /// @brief Sizes of the string fields, including the null terminator.
+    enum FieldSizes {
+        FILE_SIZE     = 128,
+        FUNCTION_SIZE = 64,
+        SUBSYS_SIZE   = 16,
+        TEXT_SIZE     = 512
+    };
+    TsHsMsgRingSlot();
+    unsigned long     mSequence;                // ** (--) Ring position this slot is ready for
+    char              mFile[FILE_SIZE];         // ** (--) Name of file logging the message
+    int               mLine;                    // ** (--) Number of line logging the message
+    char              mFunction[FUNCTION_SIZE]; // ** (--) Name of function logging the message
+    TS_HS_MSG_TYPE    mType;                    // ** (--) Severity of message, e.g. warning, error, info, etc.
+    char              mSubsys[SUBSYS_SIZE];     // ** (--) Subsystem issuing message
+    char              mText[TEXT_SIZE];         // ** (--) The text to log, e.g. description of the error
+    TS_TIMER_TYPE     mMet;                     // ** (--) MET time related to logging event
+    unsigned long     mTimestamp;               // ** (--) Unix time stamp related to logging event
+    TsHsMsgDeferred   mDeferred;                // ** (--) Format and arguments of a deferred message, replaces mText
+private:
+    TsHsMsgRingSlot(const TsHsMsgRingSlot&);
+    const TsHsMsgRingSlot& operator=(const TsHsMsgRingSlot&);
+};
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief   A queue which allows logging input/output to be decoupled from the main thread.
 ///
@@ -73,6 +105,18 @@ private:
 ///          blocking or non-blocking. If non-blocking, messages will be skipped (not output) if
 ///          a thread fails to get a lock during the operation. Removals are always
 ///          blocking, since the main thread is not doing the removing.
+///
+///          Optionally, inserts go to a bounded lock-free ring of preallocated fixed size slots
+///          instead, so any number of model threads can insert without waiting on each other or
+///          on the output thread, and without allocating memory. On overflow the ring drops the
+///          newest message instead, since the oldest may be in the middle of being removed. Long
+///          fields are truncated to fit the slots. Both are counted. Removals still take the mutex,
+///          so the output, freeze and shutdown jobs can safely overlap.
+///
+///          Re-initialization waits for the threads already inserting to finish, and holds off new
+///          inserts until the queue and ring are re-allocated, so it is safe with model threads
+///          still logging. Blocking inserts wait for it, and non-blocking inserts are skipped and
+///          counted as lock failures. It must not overlap a removal.
 //////////////////////////////////////////////////////////////////////////////////////////////////
 class TsHsMsgQueue
 {
@@ -88,8 +132,8 @@ public:
     /// @brief Destructor.
     virtual ~TsHsMsgQueue();
 
-    /// @brief Initializes (or re-initializes) queue size and blocking flag.
-    void initialize(int size, bool blocking);
+    /// @brief Initializes (or re-initializes) queue size, blocking and lock-free flags.
+    void initialize(int size, bool blocking, bool lockFree = false);
 
     /// @brief Inserts a message request at the tail of the queue.
     void insertMsg(
@@ -102,20 +146,37 @@ public:
             TS_TIMER_TYPE      met,
             unsigned long      timestamp);
 
+    /// @brief Inserts a message request whose text is to be formatted when it is removed.
+    void insertDeferredMsg(
+            const char*            file,
+            const int              line,
+            const char*            function,
+            TS_HS_MSG_TYPE         type,
+            const char*            subsys,
+            const TsHsMsgDeferred& deferred,
+            TS_TIMER_TYPE          met,
+            unsigned long          timestamp);
+
     /// @brief Removes a message request from the head of the queue.
     bool removeMsg(TsHsMsgQueueNode& node);
 
     /// @brief Returns the number of messages skipped due to lock failures.
     int getLockFailures() const { return mTryLockFailures; }
 
-    /// @brief Returns the number of messages overwritten due to overflow.
+    /// @brief Returns the number of messages overwritten or dropped due to overflow.
     int getOverflows() const { return mOverflowCount; }
 
+    /// @brief Returns the number of lock-free ring messages with truncated fields.
+    int getTruncations() const { return mTruncations; }
+
     /// @brief Returns true if the queue is empty.
-    bool isEmpty() const { return mHead == mTail; }
+    bool isEmpty() const { return mHead == mTail and isRingEmpty(); }
 
-    /// @brief Returns true if the queue is full.
-    bool isFull() const { return mTail->mNext == mHead; }
+    /// @brief Returns true if the queue, or the lock-free ring when inserts go to it, is full.
+    bool isFull() const;
+
+    /// @brief Returns true if inserts go to the lock-free ring.
+    bool getLockFree() const { return mLockFree; }
 
     /// @brief Return the capacity of the queue.
     int getCapacity() const;
@@ -143,6 +204,69 @@ protected:
     /// @brief Inserts a message request at the tail of the queue.
     void insertMsg(TsHsMsgQueueNode& node);
 
+    /// @brief Inserts a message request at the tail of the locked queue.
+    void insertQueueMsg(
+            const std::string& file,
+            const int          line,
+            const std::string& function,
+            TS_HS_MSG_TYPE     type,
+            const std::string& subsys,
+            const std::string& mtext,
+            TS_TIMER_TYPE      met,
+            unsigned long      timestamp);
+
+    /// @brief Returns true if the locked queue is full.
+    bool isQueueFull() const { return mTail->mNext == mHead; }
+
+    /// @brief Registers an inserting thread, unless the queue is being re-initialized.
+    bool enterInsert();
+
+    /// @brief Unregisters an inserting thread.
+    void exitInsert();
+
+    /// @brief Allocates the lock-free ring, moving any messages in it to the locked queue.
+    void allocRing(int size);
+
+    /// @brief Inserts a message request into the lock-free ring.
+    void insertRingMsg(
+            const std::string& file,
+            const int          line,
+            const std::string& function,
+            TS_HS_MSG_TYPE     type,
+            const std::string& subsys,
+            const std::string& mtext,
+            TS_TIMER_TYPE      met,
+            unsigned long      timestamp);
+
+    /// @brief Inserts a deferred message request into the lock-free ring.
+    void insertDeferredRingMsg(
+            const char*            file,
+            const int              line,
+            const char*            function,
+            TS_HS_MSG_TYPE         type,
+            const char*            subsys,
+            const TsHsMsgDeferred& deferred,
+            TS_TIMER_TYPE          met,
+            unsigned long          timestamp);
+
+    /// @brief Claims the next slot in the lock-free ring for a producer.
+    TsHsMsgRingSlot* claimRingSlot(unsigned long& pos);
+
+    /// @brief Publishes a filled lock-free ring slot to the consumer.
+    void publishRingSlot(TsHsMsgRingSlot* slot, const unsigned long pos, const bool truncated);
+
+    /// @brief Removes a message request from the lock-free ring.
+    bool removeRingMsg(TsHsMsgQueueNode& node);
+
+    /// @brief Returns true if the lock-free ring has no message ready to remove.
+    bool isRingEmpty() const;
+
+    /// @brief Copies a string into a fixed size ring slot field, returns true if truncated.
+    static bool copyRingField(char* field, const unsigned int size, const std::string& value);
+
+    /// @brief Copies a C string into a fixed size ring slot field, returns true if truncated.
+    static bool copyRingField(char* field, const unsigned int size, const char* value);
+
     TsHsMsgQueueNode* mAllocation;        // ** (--) Points to the top of the block of memory allocation.
     int               mAllocatedSize;     // *o (--) trick_chkpnt_io(*io) Number of nodes allocated
 
@@ -155,6 +279,15 @@ protected:
     int               mTryLockFailures;   // *o (--) trick_chkpnt_io(*io) Number of messages skipped due to mutex conflicts.
     int               mOverflowCount;     // *o (--) trick_chkpnt_io(*io) Number of messages dropped due to queue overflow.
 
+    bool              mLockFree;          //    (--) Inserts go to the lock-free ring instead of the locked queue.
+    TsHsMsgRingSlot*  mRing;              // ** (--) Lock-free ring message slots.
+    unsigned long     mRingSize;          // ** (--) Number of slots in the lock-free ring.
+    unsigned long     mRingInsertPos;     // ** (--) Next ring position to insert, claimed by producers.
+    unsigned long     mRingRemovePos;     // ** (--) Next ring position to remove.
+    int               mTruncations;       // *o (--) trick_chkpnt_io(*io) Number of ring messages with truncated fields.
+    int               mInserting;         // ** (--) Number of threads inside an insert, which re-initialization waits for.
+    bool              mReinitializing;    // ** (--) Holds off inserts while the queue and ring are re-allocated.
+
 private:
     TsHsMsgQueue(const TsHsMsgQueue&);
     const TsHsMsgQueue& operator=(const TsHsMsgQueue&);
@@ -23,8 +23,8 @@ LIBRARY DEPENDENCY:
 PROGRAMMERS:
    (((Wesley A. White) (Tietronix Software) (August 2011)))
 **************************************************************************************************/
+#include <algorithm>
 #include <iostream>
-#include <sstream>
 
 #include "sim_services/Message/include/message_proto.h"
 #include "TsHsMsgStdFilter.hh"
@@ -33,7 +33,12 @@ PROGRAMMERS:
 /// @details   Constructor
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsHsMsgStdFilter::TsHsMsgStdFilter() :
-    mMessageMap(),
+    mEntries(),
+    mBuckets(),
+    mNumMessages(0),
+    mLruHead(-1),
+    mLruTail(-1),
+    mFreeHead(-1),
     mTryLockFailures(0),
     mResourceLock()
 {
@@ -49,10 +54,7 @@ TsHsMsgStdFilter::TsHsMsgStdFilter() :
 void TsHsMsgStdFilter::restart()
 {
     // Clear the message history
-    if (mMessageMap.size() > 0)
-    {
-        mMessageMap.clear();
-    }
+    clearMessages();
 
     // Reset try-lock failure count. Maybe we should checkpoint and restore this value?
     mTryLockFailures = 0;
@@ -72,40 +74,320 @@ TsHsMsgStdFilter::~TsHsMsgStdFilter()
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details       Removes times from the deque which precede the current interval of interest.
+/// @details   Default constructs a message entry.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgStdFilter::TsHsMessageEntry::TsHsMessageEntry() :
+    mHash(0),
+    mFile(),
+    mLine(0),
+    mSubsys(),
+    mText(),
+    mTimes(),
+    mTimesHead(0),
+    mTimesSize(0),
+    mHashNext(-1),
+    mLruPrev(-1),
+    mLruNext(-1)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Computes a 64-bit FNV-1a hash of the message fields, without building a message
+///            string. A separator is hashed between fields so that, for example, moving characters
+///            from the subsystem to the text changes the hash.
 ///
-/// @param[in,out] times         (--) The deque containing times that a particular message occurred.
-/// @param[in]     intervalStart (--) We are not interested in times earlier that this.
+/// @param[in] file      (--) Source file name of the message.
+/// @param[in] line      (--) Source line number of the message.
+/// @param[in] subsys    (--) The subsystem of the message.
+/// @param[in] mtext     (--) The message text.
+///
+/// @return    The hash of the message.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void TsHsMsgStdFilter::purgeTimes(TsHsTimesDeque& times, double intervalStart)
+unsigned long long TsHsMsgStdFilter::hashMessage(
+        const std::string& file,
+        const int          line,
+        const std::string& subsys,
+        const std::string& mtext)
 {
-    while (!times.empty() && times.front() < intervalStart)
+    const unsigned long long prime = 1099511628211ULL;
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for (std::string::size_type i = 0; i < file.size(); ++i)
+    {
+        hash = (hash ^ static_cast<unsigned char>(file[i])) * prime;
+    }
+    hash = (hash ^ '|') * prime;
+    for (unsigned int i = 0; i < sizeof(line); ++i)
+    {
+        hash = (hash ^ ((static_cast<unsigned int>(line) >> (8 * i)) & 0xff)) * prime;
+    }
+    hash = (hash ^ '|') * prime;
+    for (std::string::size_type i = 0; i < subsys.size(); ++i)
+    {
+        hash = (hash ^ static_cast<unsigned char>(subsys[i])) * prime;
+    }
+    hash = (hash ^ '|') * prime;
+    for (std::string::size_type i = 0; i < mtext.size(); ++i)
     {
-        times.pop_front();
+        hash = (hash ^ static_cast<unsigned char>(mtext[i])) * prime;
     }
+    return hash;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details Finds and removes the oldest message in the map.
+/// @details   Searches the message's hash bucket for the message. The fields are only compared
+///            when the hashes match, which guards against hash collisions.
+///
+/// @param[in] hash      (--) Hash of the message.
+/// @param[in] file      (--) Source file name of the message.
+/// @param[in] line      (--) Source line number of the message.
+/// @param[in] subsys    (--) The subsystem of the message.
+/// @param[in] mtext     (--) The message text.
+///
+/// @return    Index of the message entry, or -1 if the message isn't in the table.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void TsHsMsgStdFilter::purgeMessages()
+int TsHsMsgStdFilter::findMessage(
+        const unsigned long long hash,
+        const std::string&       file,
+        const int                line,
+        const std::string&       subsys,
+        const std::string&       mtext) const
+{
+    if (mBuckets.empty())
+    {
+        return -1;
+    }
+
+    for (int index = mBuckets[hash & (mBuckets.size() - 1)]; index >= 0; index = mEntries[index].mHashNext)
+    {
+        const TsHsMessageEntry& entry = mEntries[index];
+        if (entry.mHash == hash and entry.mLine == line and entry.mText == mtext and
+            entry.mSubsys == subsys and entry.mFile == file)
+        {
+            return index;
+        }
+    }
+    return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Takes an unused entry from the pool, fills it with the message and links it into its
+///            hash bucket and at the most-recently displayed end of the list. The caller must make
+///            sure the pool has an unused entry.
+///
+/// @param[in] hash      (--) Hash of the message.
+/// @param[in] file      (--) Source file name of the message.
+/// @param[in] line      (--) Source line number of the message.
+/// @param[in] subsys    (--) The subsystem of the message.
+/// @param[in] mtext     (--) The message text.
+///
+/// @return    Index of the new message entry.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int TsHsMsgStdFilter::insertMessage(
+        const unsigned long long hash,
+        const std::string&       file,
+        const int                line,
+        const std::string&       subsys,
+        const std::string&       mtext)
+{
+    const int index = mFreeHead;
+    TsHsMessageEntry& entry = mEntries[index];
+    mFreeHead = entry.mHashNext;
+
+    // Assigning keeps the strings' capacity, so reused entries don't usually allocate.
+    entry.mHash      = hash;
+    entry.mFile      = file;
+    entry.mLine      = line;
+    entry.mSubsys    = subsys;
+    entry.mText      = mtext;
+    entry.mTimesHead = 0;
+    entry.mTimesSize = 0;
+
+    int& bucket = mBuckets[hash & (mBuckets.size() - 1)];
+    entry.mHashNext = bucket;
+    bucket = index;
+
+    entry.mLruPrev = -1;
+    entry.mLruNext = mLruHead;
+    if (mLruHead >= 0)
+    {
+        mEntries[mLruHead].mLruPrev = index;
+    }
+    else
+    {
+        mLruTail = index;
+    }
+    mLruHead = index;
+
+    ++mNumMessages;
+    return index;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Grows the entry pool to the given size and adds the new entries to the free list.
+///            The hash table is resized to the smallest power of 2 that is at least twice the pool
+///            size, and the messages in it are re-hashed. Entry indexes don't change, so the list
+///            links stay valid. This only happens when the history setting is increased.
+///
+/// @param[in] size      (--) The number of messages the table must be able to hold.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgStdFilter::reserveMessages(int size)
 {
-    if (mMessageMap.size() == 0)
+    const int oldSize = static_cast<int>(mEntries.size());
+    if (size <= oldSize)
     {
         return;
     }
 
-    TsHsMessageMap::iterator oldest = mMessageMap.begin();
+    mEntries.resize(size);
+    for (int i = size - 1; i >= oldSize; --i)
+    {
+        mEntries[i].mHashNext = mFreeHead;
+        mFreeHead = i;
+    }
 
-    for (TsHsMessageMap::iterator iter = ++oldest; iter != mMessageMap.end(); iter++)
+    std::vector<int>::size_type numBuckets = 1;
+    while (numBuckets < 2 * mEntries.size())
     {
-        if ((*iter).second.back() < (*oldest).second.back())
+        numBuckets *= 2;
+    }
+    mBuckets.assign(numBuckets, -1);
+    for (int index = mLruHead; index >= 0; index = mEntries[index].mLruNext)
+    {
+        int& bucket = mBuckets[mEntries[index].mHash & (numBuckets - 1)];
+        mEntries[index].mHashNext = bucket;
+        bucket = index;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Moves the message entry to the most-recently displayed end of the list.
+///
+/// @param[in] index     (--) Index of the message entry.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgStdFilter::touchMessage(int index)
+{
+    if (index == mLruHead)
+    {
+        return;
+    }
+
+    // Unlink the entry, it can't be the head so it has a previous entry.
+    TsHsMessageEntry& entry = mEntries[index];
+    mEntries[entry.mLruPrev].mLruNext = entry.mLruNext;
+    if (entry.mLruNext >= 0)
+    {
+        mEntries[entry.mLruNext].mLruPrev = entry.mLruPrev;
+    }
+    else
+    {
+        mLruTail = entry.mLruPrev;
+    }
+
+    // Link it at the head.
+    entry.mLruPrev = -1;
+    entry.mLruNext = mLruHead;
+    mEntries[mLruHead].mLruPrev = index;
+    mLruHead = index;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Removes all messages from the table and returns their entries to the free list. The
+///            pool and table keep their size.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgStdFilter::clearMessages()
+{
+    mBuckets.assign(mBuckets.size(), -1);
+    mFreeHead = -1;
+    for (int i = static_cast<int>(mEntries.size()) - 1; i >= 0; --i)
+    {
+        mEntries[i].mHashNext = mFreeHead;
+        mFreeHead = i;
+    }
+    mNumMessages = 0;
+    mLruHead     = -1;
+    mLruTail     = -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details       Removes times from the message entry which precede the current interval of
+///                interest.
+///
+/// @param[in,out] entry         (--) The entry containing times that a particular message occurred.
+/// @param[in]     intervalStart (--) We are not interested in times earlier that this.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgStdFilter::purgeTimes(TsHsMessageEntry& entry, double intervalStart)
+{
+    while (entry.mTimesSize > 0 && entry.mTimes[entry.mTimesHead] < intervalStart)
+    {
+        entry.mTimesHead = (entry.mTimesHead + 1) % static_cast<int>(entry.mTimes.size());
+        --entry.mTimesSize;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details       Adds a display time to the back of the message entry's times. The circular buffer
+///                is only grown when the count setting is larger than it, and then its times are
+///                moved to the front in order.
+///
+/// @param[in,out] entry         (--) The entry containing times that a particular message occurred.
+/// @param[in]     time          (--) The display time to add.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgStdFilter::addTime(TsHsMessageEntry& entry, double time)
+{
+    const int capacity = static_cast<int>(entry.mTimes.size());
+    if (entry.mTimesSize >= capacity)
+    {
+        std::vector<double> times(std::max(mCount, entry.mTimesSize + 1));
+        for (int i = 0; i < entry.mTimesSize; ++i)
         {
-            oldest = iter;
+            times[i] = entry.mTimes[(entry.mTimesHead + i) % capacity];
         }
+        entry.mTimes.swap(times);
+        entry.mTimesHead = 0;
     }
 
-    mMessageMap.erase(oldest);
+    entry.mTimes[(entry.mTimesHead + entry.mTimesSize) % entry.mTimes.size()] = time;
+    ++entry.mTimesSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Removes the oldest message, at the least-recently displayed end of the list, from the
+///          table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgStdFilter::purgeMessages()
+{
+    if (mLruTail < 0)
+    {
+        return;
+    }
+
+    const int index = mLruTail;
+    TsHsMessageEntry& entry = mEntries[index];
+
+    // Unlink from the hash bucket.
+    int* link = &mBuckets[entry.mHash & (mBuckets.size() - 1)];
+    while (*link != index)
+    {
+        link = &mEntries[*link].mHashNext;
+    }
+    *link = entry.mHashNext;
+
+    // Unlink from the list, it is the tail so it has no next entry.
+    mLruTail = entry.mLruPrev;
+    if (mLruTail >= 0)
+    {
+        mEntries[mLruTail].mLruNext = -1;
+    }
+    else
+    {
+        mLruHead = -1;
+    }
+
+    // Return it to the free list.
+    entry.mHashNext = mFreeHead;
+    mFreeHead = index;
+    --mNumMessages;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -135,8 +417,6 @@ bool TsHsMsgStdFilter::shouldSendMessage(
         const std::string& mtext
         )
 {
-    typedef std::pair< std::string,TsHsTimesDeque > TsHsMessageMapPair;
-
     if (!mEnabled)
     {
         return true;
@@ -172,45 +452,45 @@ bool TsHsMsgStdFilter::shouldSendMessage(
         return false;
     }
 
-    // Construct a message string to present to the filter. This doesn't have to
+    // Hash the message fields to present to the filter. This doesn't have to
     // be identical to the message string that actually gets output to the log.
-    std::ostringstream oss;
-    oss << file << "|" << line << "|" << subsys << "|" << mtext << std::ends;
-    std::string message(oss.str());
+    const unsigned long long hash = hashMessage(file, line, subsys, mtext);
 
-    // Attempt to locate this message in the message map.
-    TsHsMessageMap::iterator iter = mMessageMap.find(message);
+    // Attempt to locate this message in the message table.
+    int index = findMessage(hash, file, line, subsys, mtext);
 
-    if (iter == mMessageMap.end())
+    if (index < 0)
     {
-        // The message was not found in map. If the map is full, bump the oldest message.
+        // The message was not found in table. If the table is full, bump the oldest message.
         // Insert the new message/time. Return a value indicating the message should be displayed.
 
-        while (static_cast<int>(mMessageMap.size()) >= mHistory)
+        reserveMessages(mHistory);
+        while (mNumMessages >= mHistory)
         {
             purgeMessages();
         }
 
-        TsHsTimesDeque times;
-        times.push_back(timestamp);
-        mMessageMap.insert(TsHsMessageMapPair(message, times));
+        index = insertMessage(hash, file, line, subsys, mtext);
+        addTime(mEntries[index], timestamp);
 
         pthread_mutex_unlock(&mResourceLock);
         return true;
     }
     else
     {
-        // The message was found in map. Compute the beginning of the interval
-        // and get rid of any times that precede it. If the deque is not full,
-        // add the new time to it. Otherwise, if the deque is full, then the count has
+        // The message was found in table. Compute the beginning of the interval
+        // and get rid of any times that precede it. If the times are not full,
+        // add the new time to them. Otherwise, if the times are full, then the count has
         // been reached or exceeded, so suppress the message.
 
+        TsHsMessageEntry& entry = mEntries[index];
         double interval_start = timestamp - mInterval;
-        purgeTimes((*iter).second, interval_start);
+        purgeTimes(entry, interval_start);
 
-        if (static_cast<int>((*iter).second.size()) < mCount)
+        if (entry.mTimesSize < mCount)
         {
-            (*iter).second.push_back(timestamp);
+            addTime(entry, timestamp);
+            touchMessage(index);
             pthread_mutex_unlock(&mResourceLock);
             return true;
         }
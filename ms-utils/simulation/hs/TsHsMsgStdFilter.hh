@@ -22,8 +22,8 @@ PROGRAMMERS:
 @{
 */
 
-#include <deque>
-#include <map>
+#include <string>
+#include <vector>
 #include <pthread.h>
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "TsHsMsgFilter.hh"
@@ -38,17 +38,21 @@ PROGRAMMERS:
 ///          See TsHsMsgFilter documentation for an overview. Detailed implementation information
 ///          follows.
 ///
-/// @details <b>Design:</b> Recently displayed messages are stored in a map. The
-///          message itself if the map key. The map value is a deque of display times for that
-///          message. Message counts are not added for suppressed messages.
+/// @details <b>Design:</b> Recently displayed messages are stored in a hash table. Each entry
+///          keeps the message's file, line, subsystem and text, their hash, and a small circular
+///          buffer of display times for that message. The entries also form a doubly-linked list in
+///          least-recently displayed order. Entries come from a pool which is only grown when the
+///          history setting is increased, and evicted entries are reused. Message counts are not
+///          added for suppressed messages.
 ///
-/// @details <b>Algorithm:</b> When the filter is presented a message, the message is located in the
-///          map (inserted if necessary). Its display times deque is obtained and the display
-///          time is added as follows. The deque is purged of any display times outside of the
-///          current interval. If the deque contains more than 'count' items, the filter
-///          returns a value indicating that the message should be suppressed. If the deque
-///          contains fewer than 'count' items the time is added to the back of the deque and
-///          the filter returns a value indicating that the message should be displayed.
+/// @details <b>Algorithm:</b> When the filter is presented a message, the message's hash is computed
+///          from its fields in place, and the message is located in the table (inserted if
+///          necessary, evicting the least-recently displayed message if the table holds 'history'
+///          messages). Its display times are updated as follows. Any display times outside of the
+///          current interval are purged. If 'count' or more times remain, the filter returns a value
+///          indicating that the message should be suppressed. Otherwise the time is added, the
+///          message is moved to the most-recently displayed end of the list, and the filter returns
+///          a value indicating that the message should be displayed.
 ///
 /// @details <b>Memory Usage:</b> The filter is designed to limit the amount of memory used in a
 ///          'worst-case' scenario in which the filter is bombarded with a large number of
@@ -58,29 +62,24 @@ PROGRAMMERS:
 ///          each message at most C display times will be stored. Therefore the maximum size
 ///          of the filter is roughly given by \n
 ///
-///          deque_overhead_size = sizeof(TsHsTimesDeque) = 80 bytes \n
-///          deque_size          = deque_overhead_size + (C * sizeof(double) = 80+(C*8) bytes \n
-///          map_node_size       = sizeof(std::_Rb_tree_node_base) = 32 bytes \n
-///          map_overhead_size   = sizeof(TsHsMessageMap) = 48 bytes \n
-///          map_size           ~= map_overhead_size + H*[max_message_size + deque_size + map_node_size] \n
+///          entry_size ~= sizeof(TsHsMessageEntry) + max_message_size + (C * sizeof(double)) \n
+///          table_size ~= H * entry_size + (2 * H * sizeof(int)) \n
 ///
 ///          Example (C=2, H=20, max_message_size=256): \n
 ///
-///          deque_size = 80+(2*8) = 96 bytes \n
-///          map_size = 48+20[256+96+32] = 7728 bytes \n
+///          table_size ~= 20*[160+256+16] + 160 = 8800 bytes \n
 ///
 /// @details Currently the filter does not truncate strings to any max length. However, the
-///          average length of messages tends to be running around 129 bytes.
+///          average length of messages tends to be running around 129 bytes. An entry's strings
+///          keep their capacity when it is reused, so once the pool has filled memory is only
+///          allocated for a message longer than the entry's last one.
 ///
-/// @details <b>Processor Usage:</b> Deque insertion/deletion operations are performed in amortized
-///          constant time.Map search, insertion, and deletion operations are performed in
-///          O(log n) time. Finding and removing the oldest message in the map requires
-///          (worst-case) iterating through all the maps elements. This is performed in O(n) time.
-///          Therefore worst-case performance is O(n), which is not bad considering the filter
-///          will work effectively with fairly small values of n=H. For example, it is very
-///          likely that for n=H=20, the 20th message will probably be outside of the interval
-///          of interest well before it is deleted, therefore its deletion will have no impact
-///          on the performance of the filter.
+/// @details <b>Processor Usage:</b> Hashing the message is linear in its length, and is done once
+///          per message. Finding, inserting and evicting messages are performed in constant
+///          expected time, since the table has at least twice as many buckets as entries and the
+///          oldest message is always at the end of the list. Display times are added and purged in
+///          amortized constant time. Therefore the cost per message doesn't grow with the history
+///          or with the number of unique messages being logged.
 ///
 /// @see TsHsMsgFilter for more information.
 //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -112,20 +111,73 @@ public:
 
 protected:
 
-    // Make reading the STL stuff more comprehensible with some typedefs
-
-    typedef std::deque< double > TsHsTimesDeque;
-    typedef std::map< std::string, TsHsTimesDeque > TsHsMessageMap;
-
-    /// @brief Removes times from a times deque if the times precede the interval start time
-    void purgeTimes(TsHsTimesDeque& times, double intervalStart);
-
-    /// @brief Find and remove the oldest message in the message map
+    /// @brief Redundancy filter history entry for one unique message.
+    struct TsHsMessageEntry
+    {
+        unsigned long long  mHash;       // ** (--)  Hash of the message's file, line, subsystem and text
+        std::string         mFile;       // ** (--)  Source file name of the message
+        int                 mLine;       // ** (--)  Source line number of the message
+        std::string         mSubsys;     // ** (--)  Subsystem of the message
+        std::string         mText;       // ** (--)  Text of the message
+        std::vector<double> mTimes;      // ** (--)  Circular buffer of display times within the interval
+        int                 mTimesHead;  // ** (--)  Index of the oldest display time in mTimes
+        int                 mTimesSize;  // ** (--)  Number of display times in mTimes
+        int                 mHashNext;   // ** (--)  Next entry in the same bucket, or in the free list
+        int                 mLruPrev;    // ** (--)  Next more-recently displayed entry
+        int                 mLruNext;    // ** (--)  Next less-recently displayed entry
+        /// @brief Default constructor.
+        TsHsMessageEntry();
+    };
+
+    /// @brief Computes the hash of a message's file, line, subsystem and text.
+    static unsigned long long hashMessage(
+            const std::string& file,
+            const int          line,
+            const std::string& subsys,
+            const std::string& mtext);
+
+    /// @brief Returns the index of the message entry in the table, or -1 if not found.
+    int findMessage(
+            const unsigned long long hash,
+            const std::string&       file,
+            const int                line,
+            const std::string&       subsys,
+            const std::string&       mtext) const;
+
+    /// @brief Inserts a new message entry in the table and returns its index.
+    int insertMessage(
+            const unsigned long long hash,
+            const std::string&       file,
+            const int                line,
+            const std::string&       subsys,
+            const std::string&       mtext);
+
+    /// @brief Grows the entry pool and hash table to hold the given number of messages.
+    void reserveMessages(int size);
+
+    /// @brief Moves a message entry to the most-recently displayed end of the list.
+    void touchMessage(int index);
+
+    /// @brief Removes all message entries from the table.
+    void clearMessages();
+
+    /// @brief Removes times from a message entry if the times precede the interval start time
+    void purgeTimes(TsHsMessageEntry& entry, double intervalStart);
+
+    /// @brief Adds a display time to a message entry
+    void addTime(TsHsMessageEntry& entry, double time);
+
+    /// @brief Find and remove the oldest message in the table
     void purgeMessages();
 
-    TsHsMessageMap  mMessageMap;       // ** (--)  Tracks which messages have been displayed and when
-    int             mTryLockFailures;  // ** (--)  Number of times trylock failed to get the lock (== number of dropped messages)
-    pthread_mutex_t mResourceLock;     // ** (--)  Mutex which controls access to database files
+    std::vector<TsHsMessageEntry> mEntries;         // ** (--)  Pool of message entries, tracks which messages have been displayed and when
+    std::vector<int>              mBuckets;         // ** (--)  Hash table buckets, index of first entry in each bucket or -1
+    int                           mNumMessages;     // ** (--)  Number of messages in the table
+    int                           mLruHead;         // ** (--)  Index of the most-recently displayed entry, or -1
+    int                           mLruTail;         // ** (--)  Index of the least-recently displayed entry, or -1
+    int                           mFreeHead;        // ** (--)  Index of the first unused entry in the pool, or -1
+    int                           mTryLockFailures; // ** (--)  Number of times trylock failed to get the lock (== number of dropped messages)
+    pthread_mutex_t               mResourceLock;    // ** (--)  Mutex which controls access to database files
 
 private:
     // Disable copy constructor and assignment operator
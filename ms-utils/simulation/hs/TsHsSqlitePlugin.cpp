@@ -25,16 +25,40 @@ PROGRAMMERS:
 **************************************************************************************************/
 
 #include <iostream>
+#include <cerrno>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <cmath>
+#include <ctime>
 #include <sqlite3.h>
+#ifndef no_TRICK_ENV
 #include "sim_services/Message/include/message_proto.h"
+#else
+#include <cstdarg>
+
+namespace {
+    /// @brief Trick message levels used by this plugin.
+    enum { MSG_WARNING = 2, MSG_ERROR = 3 };
+
+    /// @brief Outside of Trick, the plugin's own messages go to standard error.
+    int message_publish(int level __attribute__((unused)), const char* format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        const int result = vfprintf(stderr, format, args);
+        va_end(args);
+        return result;
+    }
+}
+#endif
 #include "simulation/timer/TS_timer.h"
 #include "TS_hs_msg_types.h"
 #include "TsHsSqlitePlugin.hh"
 
+/// @details  One second, so a message is in the database file shortly after it is logged.
+const double TsHsSqlitePlugin::DEFAULT_FLUSH_PERIOD = 1.0;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Constructs a SQLite plugin object given the name of a database file to generate.
 ///
@@ -48,9 +72,29 @@ TsHsSqlitePlugin::TsHsSqlitePlugin(int id) :
     mDatabaseHandle(0),
     mTryLockFailures(0),
     mResourceLock(),
-    mBlocking(false)
+    mBlocking(false),
+    mBatchSize(DEFAULT_BATCH_SIZE),
+    mFlushPeriod(DEFAULT_FLUSH_PERIOD),
+    mActiveBatchSize(DEFAULT_BATCH_SIZE),
+    mActiveFlushPeriod(DEFAULT_FLUSH_PERIOD),
+    mPending(),
+    mNumPending(0),
+    mWriting(),
+    mOverflows(0),
+    mBatchReady(),
+    mBatchTaken(),
+    mWriteLock(),
+    mWriter(),
+    mWriterRunning(false),
+    mWriterStop(false),
+    mInsertMessageStmt(0),
+    mUpdateCountStmt(0),
+    mInsertTimestampStmt(0)
 {
     pthread_mutex_init(&mResourceLock, NULL);
+    pthread_mutex_init(&mWriteLock, NULL);
+    pthread_cond_init(&mBatchReady, NULL);
+    pthread_cond_init(&mBatchTaken, NULL);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -58,6 +102,11 @@ TsHsSqlitePlugin::TsHsSqlitePlugin(int id) :
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsHsSqlitePlugin::~TsHsSqlitePlugin()
 {
+    shutdown();
+    pthread_cond_destroy(&mBatchTaken);
+    pthread_cond_destroy(&mBatchReady);
+    pthread_mutex_destroy(&mWriteLock);
+    pthread_mutex_destroy(&mResourceLock);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,6 +122,20 @@ void TsHsSqlitePlugin::configure(const TsHsPluginConfig& configData)
     mBlocking  = configData.mBlocking;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Sets the batching of messages written to the database. This takes effect at the next
+///          init, which latches these values, so it is safe to call while messages are logged.
+///
+/// @param[in] batchSize   (--) Number of messages written per transaction, minimum 1.
+/// @param[in] flushPeriod (s)  Maximum time a message waits before its batch is written, minimum
+///                             0.001.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsSqlitePlugin::setBatching(const int batchSize, const double flushPeriod)
+{
+    mBatchSize   = (batchSize   > 1)     ? batchSize   : 1;
+    mFlushPeriod = (flushPeriod > 0.001) ? flushPeriod : 0.001;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Display database errors message to the console (standard error device) and close the
 ///          database if the error is considered fatal.
@@ -91,22 +154,21 @@ void TsHsSqlitePlugin::handleSqlError(const std::string& file __attribute__((unu
 
         if (fatal)
         {
-            sqlite3_close(mDatabaseHandle);
-            mTransactionOpen = false;
-            mDatabaseHandle = 0;
+            closeDatabase();
         }
     }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Opens the SQLite database used for logging health and status messages. If the
-///          database does not already exists, it will be created.
+///          database does not already exists, it will be created. Only one thread at a time writes
+///          to the database, under mWriteLock, so SQLite's own serialization isn't needed.
 ///
 /// @return  True if the open succeeds, otherwise false.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool TsHsSqlitePlugin::openDatabase()
 {
-    const int open_flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX;
+    const int open_flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX;
 
     if (sqlite3_open_v2(mFilename.c_str(), &mDatabaseHandle, open_flags, NULL) != SQLITE_OK)
     {
@@ -119,9 +181,58 @@ bool TsHsSqlitePlugin::openDatabase()
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Prepares the statements used to insert each message, so the SQL is compiled once
+///          rather than per message.
+///
+/// @return  True if all statements were prepared, otherwise false.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsSqlitePlugin::prepareStatements()
+{
+    const char* insert_message =
+            // insert the hash-message entry (if it's already there, carry on)
+            "INSERT OR IGNORE INTO messages VALUES (?1, ?2, ?3, ?4, ?5, ?6, 0, ?7);";
+    const char* update_count =
+            // increment the count
+            "UPDATE messages SET count = count + 1, last_time = ?1 WHERE id = ?2;";
+    const char* insert_timestamp =
+            // insert the timestamp entry
+            "INSERT INTO timestamps VALUES (?1, ?2, ?3);";
+
+    if (sqlite3_prepare_v2(mDatabaseHandle, insert_message,   -1, &mInsertMessageStmt,   NULL) != SQLITE_OK or
+        sqlite3_prepare_v2(mDatabaseHandle, update_count,     -1, &mUpdateCountStmt,     NULL) != SQLITE_OK or
+        sqlite3_prepare_v2(mDatabaseHandle, insert_timestamp, -1, &mInsertTimestampStmt, NULL) != SQLITE_OK)
+    {
+        message_publish(MSG_ERROR, "TsHsSqlitePlugin error preparing statements: %s\n", sqlite3_errmsg(mDatabaseHandle));
+        closeDatabase();
+        return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Finalizes the prepared statements, which must be done before the database can close,
+///          and closes the database.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsSqlitePlugin::closeDatabase()
+{
+    sqlite3_finalize(mInsertMessageStmt);
+    sqlite3_finalize(mUpdateCountStmt);
+    sqlite3_finalize(mInsertTimestampStmt);
+    mInsertMessageStmt   = 0;
+    mUpdateCountStmt     = 0;
+    mInsertTimestampStmt = 0;
+
+    sqlite3_close(mDatabaseHandle);
+    mDatabaseHandle  = 0;
+    mTransactionOpen = false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Opens the SQLite database and creates the database tables used for logging
-///          Health and Status messages.
+///          Health and Status messages. The database uses the write-ahead log, so commits append
+///          to the log instead of rewriting the database file. Then starts the background writer.
 ///
 /// @return  True if the initialization succeeds, else false.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -163,6 +274,8 @@ bool TsHsSqlitePlugin::init(void)
         char* sql_error;
 
         const char* creation_command =
+                "PRAGMA journal_mode = WAL;"
+                "PRAGMA synchronous = NORMAL;"
                 "CREATE TABLE IF NOT EXISTS timestamps(id INTEGER, met INTEGER, timestamp INTEGER);"
                 "CREATE TABLE IF NOT EXISTS messages("
                     "id INTEGER PRIMARY KEY, file TEXT, line INTEGER, "
@@ -174,6 +287,28 @@ bool TsHsSqlitePlugin::init(void)
         handleSqlError(__FILE__, __LINE__, &sql_error, true);
     }
 
+    if (!mDatabaseHandle or !prepareStatements())
+    {
+        return false;
+    }
+
+    // Latch the batching, which msg() and the writer only read from these copies, and size the
+    // batch buffers with room for the next batch while one is waiting to be taken. The latched
+    // batch size is at most half the buffer, so a pending batch always fills before the buffer.
+    mActiveBatchSize   = (mBatchSize   > 1)     ? mBatchSize   : 1;
+    mActiveFlushPeriod = (mFlushPeriod > 0.001) ? mFlushPeriod : 0.001;
+    mNumPending = 0;
+    mPending.resize(2 * mActiveBatchSize);
+    mWriting.resize(2 * mActiveBatchSize);
+
+    // Start the background writer. Without it, batches are written by the thread that fills them.
+    mWriterStop    = false;
+    mWriterRunning = (pthread_create(&mWriter, NULL, writerThread, this) == 0);
+    if (!mWriterRunning)
+    {
+        message_publish(MSG_WARNING, "TsHsSqlitePlugin could not start the writer thread, writing from the logging thread\n");
+    }
+
     return true;
 }
 
@@ -226,25 +361,129 @@ void TsHsSqlitePlugin::shutdown(void)
         return;
     }
 
+    stopWriter();
+
     if (!mDatabaseHandle)
     {
         return;
     }
 
-    // Wait on any threads that may still be logging messages
+    // Write anything logged since, and wait on any threads that may still be logging messages.
+    flushPending();
 
-    if (pthread_mutex_lock(&mResourceLock) == 0) // 0 means lock granted
+    if (pthread_mutex_lock(&mWriteLock) == 0) // 0 means lock granted
     {
-        sqlite3_close(mDatabaseHandle);
-        pthread_mutex_unlock(&mResourceLock);
+        closeDatabase();
+        pthread_mutex_unlock(&mWriteLock);
     }
 
-    mDatabaseHandle = 0;
-
     if (mTryLockFailures > 0)
     {
         message_publish(MSG_WARNING, "TsHsSqlitePlugin skipped %d messages due to mutex conflicts\n", mTryLockFailures);
     }
+
+    if (mOverflows > 0)
+    {
+        message_publish(MSG_WARNING, "TsHsSqlitePlugin skipped %d messages due to a full batch buffer\n", mOverflows);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Stops the writer after it writes the last batch, and releases any loggers waiting for
+///          room in the pending batch. Messages logged after this are written by the logging
+///          thread as each batch fills, and the rest by shutdown.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsSqlitePlugin::stopWriter()
+{
+    if (!mWriterRunning)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&mResourceLock);
+    mWriterStop = true;
+    pthread_cond_signal(&mBatchReady);
+    pthread_mutex_unlock(&mResourceLock);
+    pthread_join(mWriter, NULL);
+
+    pthread_mutex_lock(&mResourceLock);
+    mWriterRunning = false;
+    pthread_cond_broadcast(&mBatchTaken);
+    pthread_mutex_unlock(&mResourceLock);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Entry point of the background writer thread.
+///
+/// @param[in] plugin (--) Pointer to the plugin that started the thread.
+///
+/// @return  Always null.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void* TsHsSqlitePlugin::writerThread(void* plugin)
+{
+    static_cast<TsHsSqlitePlugin*>(plugin)->runWriter();
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Waits until a full batch is pending or the flush period has elapsed, then writes the
+///          pending messages. Repeats until shutdown, writing the last batch before it returns.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsSqlitePlugin::runWriter()
+{
+    bool stop = false;
+    while (!stop)
+    {
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        const double whole = std::floor(mActiveFlushPeriod);
+        deadline.tv_sec  += static_cast<time_t>(whole);
+        deadline.tv_nsec += static_cast<long>((mActiveFlushPeriod - whole) * 1.0e9);
+        if (deadline.tv_nsec >= 1000000000L)
+        {
+            deadline.tv_sec  += 1;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        pthread_mutex_lock(&mResourceLock);
+        while (!mWriterStop and mNumPending < mActiveBatchSize)
+        {
+            if (pthread_cond_timedwait(&mBatchReady, &mResourceLock, &deadline) == ETIMEDOUT)
+            {
+                break;
+            }
+        }
+        stop = mWriterStop;
+        pthread_mutex_unlock(&mResourceLock);
+
+        flushPending();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Swaps the pending messages with the writing buffer under the resource lock, so loggers
+///          only wait for the swap, and then writes them to the database.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsSqlitePlugin::flushPending()
+{
+    pthread_mutex_lock(&mWriteLock);
+
+    pthread_mutex_lock(&mResourceLock);
+    const int numRecords = mNumPending;
+    if (numRecords > 0)
+    {
+        mPending.swap(mWriting);
+        mNumPending = 0;
+        pthread_cond_broadcast(&mBatchTaken);
+    }
+    pthread_mutex_unlock(&mResourceLock);
+
+    if (numRecords > 0)
+    {
+        insertMessages(mWriting, numRecords);
+    }
+
+    pthread_mutex_unlock(&mWriteLock);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -303,72 +542,142 @@ bool TsHsSqlitePlugin::msg(
         return false;
     }
 
-    // Use a hash function to generate a unique database key value.
-    long long int msg_hash;
-    msg_hash = hashString(0, file);
-    msg_hash = 101 * msg_hash + line;
-    msg_hash = hashString(msg_hash, subsys);
-    msg_hash = hashString(msg_hash, mtext);
-
-    // This is not optimal - for new entries, we should just insert (skip the update)
-    const char* insert_command_template =
-            // insert the hash-message entry (if it's already there, carry on)
-            "INSERT OR IGNORE INTO messages VALUES (%lld, '%q', %d, %d, '%q', '%q', 0, %d);"
-            // increment the count
-            "UPDATE messages SET count = count + 1, last_time = %d WHERE id = %lld;"
-            // insert the timestamp entry
-            "INSERT INTO timestamps VALUES (%lld, %d, %d);";
-
-    // Fill-in the command template to produce a complete SQL command
-
-    int met_seconds = static_cast<int> (std::floor(met.seconds));
-
-    char* insert_command = sqlite3_mprintf(insert_command_template,
-            msg_hash, file.c_str(), line, type, subsys.c_str(), mtext.c_str(), met_seconds, // INSERT
-            met_seconds, msg_hash,                                  // UPDATE
-            msg_hash, met_seconds, timestamp);                      // INSERT
-
     if (mBlocking)
     {
-        // We will wait if necessary, no messages will be lost.
-        if (pthread_mutex_lock(&mResourceLock) == 0) // 0 means lock granted
+        // We will wait if necessary, no messages will be lost. Without the writer, write the
+        // pending messages from this thread to make room.
+        if (pthread_mutex_lock(&mResourceLock) != 0) // 0 means lock granted
+        {
+            return true;
+        }
+        while (mNumPending >= static_cast<int>(mPending.size()))
         {
-            insertMessage(insert_command);
-            pthread_mutex_unlock(&mResourceLock);
+            if (mWriterRunning)
+            {
+                pthread_cond_wait(&mBatchTaken, &mResourceLock);
+            }
+            else
+            {
+                pthread_mutex_unlock(&mResourceLock);
+                flushPending();
+                pthread_mutex_lock(&mResourceLock);
+            }
         }
     }
-    else
+    else if (pthread_mutex_trylock(&mResourceLock) != 0) // 0 means lock granted
     {
         // Don't wait. Discard message if resource conflict.
-        if (pthread_mutex_trylock(&mResourceLock) == 0) // 0 means lock granted
-        {
-            insertMessage(insert_command);
-            pthread_mutex_unlock(&mResourceLock);
-            sqlite3_free(insert_command);
-        }
-        else
-        {
-            mTryLockFailures++;
-        }
+        mTryLockFailures++;
+        return true;
+    }
+
+    if (mNumPending >= static_cast<int>(mPending.size()))
+    {
+        mOverflows++;
+        pthread_mutex_unlock(&mResourceLock);
+        return true;
+    }
+
+    // Copy the message into a pending record, reusing the record's string storage.
+    TsHsSqliteRecord& record = mPending[mNumPending++];
+    record.mFile      = file;
+    record.mLine      = line;
+    record.mType      = type;
+    record.mSubsys    = subsys;
+    record.mText      = mtext;
+    record.mMet       = static_cast<int> (std::floor(met.seconds));
+    record.mTimestamp = timestamp;
+
+    const bool batchFull = (mNumPending >= mActiveBatchSize);
+    if (batchFull and mWriterRunning)
+    {
+        pthread_cond_signal(&mBatchReady);
+    }
+    pthread_mutex_unlock(&mResourceLock);
+
+    if (batchFull and !mWriterRunning)
+    {
+        flushPending();
     }
 
     return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details Log a health and status message to a SQLite database file.
+/// @details Write a batch of health and status messages to the SQLite database file in a single
+///          transaction.
 ///
-/// @param[in] insertCommand (--) sql command to insert message into database.
+/// @param[in] records    (--) The messages to write.
+/// @param[in] numRecords (--) Number of messages at the start of records to write.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-bool TsHsSqlitePlugin::insertMessage(char* insertCommand)
+void TsHsSqlitePlugin::insertMessages(const std::vector<TsHsSqliteRecord>& records, const int numRecords)
 {
-    // todo: try catch here to ensure resource unlocks if exception
-    char* sql_error;
-    // Execute the SQL command to insert the new message into the database
+    if (!mDatabaseHandle)
+    {
+        return;
+    }
+
+    char* sql_error = 0;
     sqlite3_exec(mDatabaseHandle, "BEGIN TRANSACTION;", NULL, NULL, &sql_error);
-    sqlite3_exec(mDatabaseHandle, insertCommand, NULL, NULL, &sql_error);
+    handleSqlError(__FILE__, __LINE__, &sql_error, false);
+    mTransactionOpen = true;
+
+    for (int i = 0; i < numRecords; ++i)
+    {
+        if (!insertMessage(records[i]))
+        {
+            message_publish(MSG_ERROR, "TsHsSqlitePlugin sqlite error: %s\n", sqlite3_errmsg(mDatabaseHandle));
+        }
+    }
+
     sqlite3_exec(mDatabaseHandle, "COMMIT;", NULL, NULL, &sql_error);
     handleSqlError(__FILE__, __LINE__, &sql_error, false);
+    mTransactionOpen = false;
+}
 
-    return true;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Log a health and status message to a SQLite database file with the prepared
+///          statements.
+///
+/// @param[in] record (--) The message to insert into the database.
+///
+/// @return  True if successful, or false on failure.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsSqlitePlugin::insertMessage(const TsHsSqliteRecord& record)
+{
+    // Use a hash function to generate a unique database key value.
+    long long int msg_hash;
+    msg_hash = hashString(0, record.mFile);
+    msg_hash = 101 * msg_hash + record.mLine;
+    msg_hash = hashString(msg_hash, record.mSubsys);
+    msg_hash = hashString(msg_hash, record.mText);
+
+    // This is not optimal - for new entries, we should just insert (skip the update)
+    sqlite3_bind_int64(mInsertMessageStmt, 1, msg_hash);
+    sqlite3_bind_text (mInsertMessageStmt, 2, record.mFile.c_str(),   -1, SQLITE_STATIC);
+    sqlite3_bind_int  (mInsertMessageStmt, 3, record.mLine);
+    sqlite3_bind_int  (mInsertMessageStmt, 4, record.mType);
+    sqlite3_bind_text (mInsertMessageStmt, 5, record.mSubsys.c_str(), -1, SQLITE_STATIC);
+    sqlite3_bind_text (mInsertMessageStmt, 6, record.mText.c_str(),   -1, SQLITE_STATIC);
+    sqlite3_bind_int  (mInsertMessageStmt, 7, record.mMet);
+
+    sqlite3_bind_int  (mUpdateCountStmt, 1, record.mMet);
+    sqlite3_bind_int64(mUpdateCountStmt, 2, msg_hash);
+
+    sqlite3_bind_int64(mInsertTimestampStmt, 1, msg_hash);
+    sqlite3_bind_int  (mInsertTimestampStmt, 2, record.mMet);
+    sqlite3_bind_int64(mInsertTimestampStmt, 3, static_cast<sqlite3_int64>(record.mTimestamp));
+
+    bool result = true;
+    sqlite3_stmt* statements[3] = {mInsertMessageStmt, mUpdateCountStmt, mInsertTimestampStmt};
+    for (int i = 0; i < 3; ++i)
+    {
+        if (sqlite3_step(statements[i]) != SQLITE_DONE)
+        {
+            result = false;
+        }
+        sqlite3_reset(statements[i]);
+    }
+
+    return result;
 }
@@ -16,7 +16,8 @@ REFERENCE:
 - (TBD)
 
 ASSUMPTIONS AND LIMITATIONS:
-- (TBD)
+- ((Messages are buffered and written to the database in batches by a background writer thread, so
+    the last messages can be up to the flush period old before they are in the database file.))
 
 LIBRARY DEPENDENCY:
 - (
@@ -30,16 +31,40 @@ PROGRAMMERS:
 */
 
 #include <string>
+#include <vector>
 #include <sqlite3.h>
 #include <pthread.h>
 #include "TsHsOutputPlugin.hh"
 #include "TsHsPluginConfig.hh"
 
+/// @brief A message buffered by the SQLite plugin until it is written to the database.
+struct TsHsSqliteRecord
+{
+    std::string    mFile;       // ** (--) Name of the file which logged the message.
+    int            mLine;       // ** (--) Line of the file which logged the message.
+    int            mType;       // ** (--) Type of the message.
+    std::string    mSubsys;     // ** (--) Subsystem the message originated from.
+    std::string    mText;       // ** (--) The message text.
+    int            mMet;        // ** (--) Whole seconds of mission-elapsed time of the message.
+    unsigned long  mTimestamp;  // ** (--) Unix timestamp of the message.
+};
+
 /// @brief An output plugin used to log messages to an SQLite database.
+///
+/// @details Logging a message only copies it into a pending batch. A background writer thread
+///          swaps out the batch when it reaches the batch size or the flush period elapses, and
+///          writes it in a single transaction with prepared statements. The database uses the
+///          write-ahead log journal mode. The record buffers are reused, so after they warm up the
+///          cost of logging a message doesn't depend on the database.
 class TsHsSqlitePlugin: public TsHsOutputPlugin
 {
 public:
 
+    /// @brief Default number of messages written per transaction.
+    static const int    DEFAULT_BATCH_SIZE = 256;
+    /// @brief Default maximum time (s) a message waits before its batch is written.
+    static const double DEFAULT_FLUSH_PERIOD;
+
     /// @brief Constructor
     TsHsSqlitePlugin(int id);
 
@@ -68,9 +93,34 @@ public:
     virtual bool msg(const std::string& file, int line, const std::string& function, TS_HS_MSG_TYPE type, const std::string& subsys,
                      const TS_TIMER_TYPE& met, unsigned long timestamp, const std::string& hsmsg);
 
+    /// @brief Sets the number of messages per transaction and the maximum time between writes.
+    void setBatching(const int batchSize, const double flushPeriod);
+
 protected:
 
-    bool insertMessage(char* insertCommand);
+    /// @brief Entry point of the background writer thread.
+    static void* writerThread(void* plugin);
+
+    /// @brief Writes batches of pending messages until shutdown.
+    void runWriter();
+
+    /// @brief Stops the writer thread after it writes the last batch.
+    void stopWriter();
+
+    /// @brief Swaps out the pending messages and writes them to the database.
+    void flushPending();
+
+    /// @brief Writes a batch of messages to the database in a single transaction.
+    void insertMessages(const std::vector<TsHsSqliteRecord>& records, const int numRecords);
+
+    /// @brief Binds a message to the prepared statements and executes them.
+    bool insertMessage(const TsHsSqliteRecord& record);
+
+    /// @brief Prepares the statements used to insert messages.
+    bool prepareStatements();
+
+    /// @brief Finalizes the prepared statements and closes the database.
+    void closeDatabase();
 
     /// @brief Displays the error message and, if fatal, close the database.
     void handleSqlError(const std::string&, int, char**, bool);
@@ -89,8 +139,25 @@ protected:
     bool            mTransactionOpen;  // ** (--) True if a transaction is in progress
     sqlite3*        mDatabaseHandle;   // ** (--) SQLite db handle
     int             mTryLockFailures;  // ** (--) Number of times trylock failed to get the lock (== number of dropped messages)
-    pthread_mutex_t mResourceLock;     // ** (--) Mutex which controls access to database files
+    pthread_mutex_t mResourceLock;     // ** (--) Mutex which controls access to the pending messages
     bool            mBlocking;         // ** (--) Wait on mutex if true, else skip message
+    int             mBatchSize;        // ** (--) Number of messages written per transaction
+    double          mFlushPeriod;      // ** (s)  Maximum time a message waits before its batch is written
+    int             mActiveBatchSize;  // ** (--) Batch size latched at init, used while logging
+    double          mActiveFlushPeriod; // ** (s)  Flush period latched at init, used while logging
+    std::vector<TsHsSqliteRecord> mPending;  // ** (--) Messages waiting to be written
+    int             mNumPending;       // ** (--) Number of messages in mPending
+    std::vector<TsHsSqliteRecord> mWriting;  // ** (--) Messages being written by the writer thread
+    int             mOverflows;        // ** (--) Number of messages dropped because the pending batch was full
+    pthread_cond_t  mBatchReady;       // ** (--) Signals the writer that a batch is ready or to stop
+    pthread_cond_t  mBatchTaken;       // ** (--) Signals waiting loggers that the pending batch was taken
+    pthread_mutex_t mWriteLock;        // ** (--) Serializes writes to the database
+    pthread_t       mWriter;           // ** (--) The background writer thread
+    bool            mWriterRunning;    // ** (--) True if the writer thread is running
+    bool            mWriterStop;       // ** (--) Tells the writer thread to write the last batch and stop
+    sqlite3_stmt*   mInsertMessageStmt;    // ** (--) Inserts a new unique message
+    sqlite3_stmt*   mUpdateCountStmt;      // ** (--) Increments the count of a unique message
+    sqlite3_stmt*   mInsertTimestampStmt;  // ** (--) Inserts the time of a message occurrence
 
 private:
 
@@ -149,7 +149,8 @@ void TsHsStdMngr::configure()
     mMsgFilter.init();
 
     // Configure the message queue
-    mMsgQueue.initialize(mConfig.mQueueCapacity, mConfig.mQueueBlockingEnabled);
+    mMsgQueue.initialize(mConfig.mQueueCapacity, mConfig.mQueueBlockingEnabled,
+                         mConfig.mQueueLockFreeEnabled != 0);
 
     // Sets the global tsGlobalHsMngr pointer to point to the manager. If more than one manager is
     // created (which should never happen), the pointer will point to the most recent one created.
@@ -327,6 +328,55 @@ void TsHsStdMngr::msg(
     mTermination.msg(file, line, function,type, subsys, mtext);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Logs a message recorded as a format and its arguments. When messages are queued in
+///          lock-free mode, the recorded message is queued as it is and its text is formatted by
+///          the output thread. Otherwise, and for fatal messages which may terminate the sim, the
+///          text is formatted now and logged with msg.
+///
+/// @param[in] file     (--) name of file which initiated logging the message.
+/// @param[in] line     (--) line of file which initiated logging the message.
+/// @param[in] function (--) The name of the function logging the message; typically __func__.
+/// @param[in] type     (--) the type of message (e.g. info, warning, etc.).
+/// @param[in] subsys   (--) the subsystem from which the message originated.
+/// @param[in] deferred (--) the message format and arguments.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsStdMngr::msgDeferred(
+   const char*            file,
+   const int              line,
+   const char*            function,
+   TS_HS_MSG_TYPE         type,
+   const char*            subsys,
+   const TsHsMsgDeferred& deferred)
+{
+    if (mImmediateMode or type == TS_HS_FATAL or not mMsgQueue.getLockFree())
+    {
+        TsHsMngr::msgDeferred(file, line, function, type, subsys, deferred);
+        return;
+    }
+
+    mRequestCount++;
+
+    // Initialize MET to an obviously invalid value
+    TS_TIMER_TYPE met = {-1, 99, 23, 59, 59, -9999.0, 0};
+
+    // Set met to global pointer of MET data
+    if (ts_global_met_ptr)
+    {
+        met = *ts_global_met_ptr;
+    }
+
+    unsigned long timestamp = time(NULL);
+
+    // Limit the length of the subsystem field. Truncate if necessary.
+    const int SUBSYS_MAX_SIZE = 13;
+    char truncatedSubsys[SUBSYS_MAX_SIZE];
+    strncpy(truncatedSubsys, subsys, SUBSYS_MAX_SIZE-1);
+    truncatedSubsys[SUBSYS_MAX_SIZE-1] = '\0';
+
+    mMsgQueue.insertDeferredMsg(file, line, function, type, truncatedSubsys, deferred, met, timestamp);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Processes messages on the message request queue.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -404,7 +454,20 @@ void TsHsStdMngr::shutdown()
     int queue_overwrites = mMsgQueue.getOverflows();
     if (queue_overwrites > 0)
     {
-        message_publish(MSG_WARNING, "TsHsMsgQueue overwrote %d messages due to queue overflow\n", queue_overwrites);
+        if (mMsgQueue.getLockFree())
+        {
+            message_publish(MSG_WARNING, "TsHsMsgQueue dropped %d messages due to queue overflow\n", queue_overwrites);
+        }
+        else
+        {
+            message_publish(MSG_WARNING, "TsHsMsgQueue overwrote %d messages due to queue overflow\n", queue_overwrites);
+        }
+    }
+
+    int truncations = mMsgQueue.getTruncations();
+    if (truncations > 0)
+    {
+        message_publish(MSG_WARNING, "TsHsMsgQueue truncated %d messages to fit the queue\n", truncations);
     }
 
     mPluginMngr.shutdown();
@@ -99,6 +99,9 @@ public:
     /// @brief Should be called as needed to log a message.
     virtual void msg(const std::string&, const int, const std::string&, TS_HS_MSG_TYPE, const std::string&, const std::string&);
 
+    /// @brief Should be called as needed to log a message whose text can be formatted later.
+    virtual void msgDeferred(const char*, const int, const char*, TS_HS_MSG_TYPE, const char*, const TsHsMsgDeferred&);
+
     /// @brief Processes messages on the message request queue.
     void inputOutputThread();
 
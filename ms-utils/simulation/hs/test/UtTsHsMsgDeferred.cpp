@@ -0,0 +1,177 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsMsgDeferred class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsMsgDeferred.o)
+)
+
+PROGRAMMERS:
+(
+)
+*******************************************************************************/
+
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include "UtTsHsMsgDeferred.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the beginning of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgDeferred::setUp()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the end of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgDeferred::tearDown()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test construction and clearing of the deferred message.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgDeferred::testConstructors()
+{
+    TsHsMsgDeferred deferred;
+    CPPUNIT_ASSERT(0 == deferred.getFormat());
+    CPPUNIT_ASSERT_EQUAL(0,     deferred.getNumArgs());
+    CPPUNIT_ASSERT_EQUAL(false, deferred.isTruncated());
+
+    std::string text("not empty");
+    deferred.format(text);
+    CPPUNIT_ASSERT_EQUAL(std::string(""), text);
+
+    deferred.capturef("%d", 1);
+    CPPUNIT_ASSERT_EQUAL(1, deferred.getNumArgs());
+    deferred.clear();
+    CPPUNIT_ASSERT(0 == deferred.getFormat());
+    CPPUNIT_ASSERT_EQUAL(0, deferred.getNumArgs());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the formatted text matches snprintf for each kind of conversion, and that string
+///          arguments are copied at capture.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgDeferred::testConversions()
+{
+    char expected[512];
+    std::string text;
+    TsHsMsgDeferred deferred;
+
+    char name[] = "GunnsFluidValve";
+    const short          s  = -12;
+    const unsigned char  uc = 200;
+    const long           l  = -1234567890L;
+    const unsigned long long ull = 18446744073709551615ULL;
+    const size_t         z  = 4096;
+    const double         d  = 3.14159265358979;
+    const void*          p  = &d;
+
+    deferred.capturef("%s: %d %hd %hhu %ld %llu %zu %c %%", name, 42, s, uc, l, ull, z, 'q');
+    std::snprintf(expected, sizeof(expected), "%s: %d %hd %hhu %ld %llu %zu %c %%", name, 42, s, uc, l, ull, z, 'q');
+    name[0] = 'X';
+    deferred.format(text);
+    CPPUNIT_ASSERT_EQUAL(std::string(expected), text);
+    CPPUNIT_ASSERT_EQUAL(8,     deferred.getNumArgs());
+    CPPUNIT_ASSERT_EQUAL(false, deferred.isTruncated());
+
+    deferred.capturef("%x %#o %X %i", 255u, 8u, 0xabcu, -7);
+    std::snprintf(expected, sizeof(expected), "%x %#o %X %i", 255u, 8u, 0xabcu, -7);
+    deferred.format(text);
+    CPPUNIT_ASSERT_EQUAL(std::string(expected), text);
+
+    deferred.capturef("%f %-10.3e| %+g %G %a %p", d, d, d, 1.0e-20, 0.5, p);
+    std::snprintf(expected, sizeof(expected), "%f %-10.3e| %+g %G %a %p", d, d, d, 1.0e-20, 0.5, p);
+    deferred.format(text);
+    CPPUNIT_ASSERT_EQUAL(std::string(expected), text);
+
+    // A null string argument is recorded as "(null)" rather than faulting.
+    const char* nullName = 0;
+    deferred.capturef("[%s]", nullName);
+    deferred.format(text);
+    CPPUNIT_ASSERT_EQUAL(std::string("[(null)]"), text);
+
+    // A format without conversions is copied as is.
+    deferred.capturef("failed to converge.");
+    deferred.format(text);
+    CPPUNIT_ASSERT_EQUAL(std::string("failed to converge."), text);
+    CPPUNIT_ASSERT_EQUAL(0, deferred.getNumArgs());
+
+    // The copy formats the same as the original.
+    deferred.capturef("%s %d", name, 7);
+    const TsHsMsgDeferred copy(deferred);
+    name[0] = 'Y';
+    copy.format(text);
+    CPPUNIT_ASSERT_EQUAL(std::string("XunnsFluidValve 7"), text);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test '*' widths and precisions are recorded as arguments.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgDeferred::testStars()
+{
+    char expected[512];
+    std::string text;
+    TsHsMsgDeferred deferred;
+
+    deferred.capturef("[%*d] [%-*.*f] [%.*s]", 6, 42, 12, 3, 2.5, 3, "abcdef");
+    std::snprintf(expected, sizeof(expected), "[%*d] [%-*.*f] [%.*s]", 6, 42, 12, 3, 2.5, 3, "abcdef");
+    deferred.format(text);
+    CPPUNIT_ASSERT_EQUAL(std::string(expected), text);
+    CPPUNIT_ASSERT_EQUAL(7, deferred.getNumArgs());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test an unsupported or incomplete conversion stops capture, and the remaining format
+///          is copied literally.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgDeferred::testMalformed()
+{
+    std::string text;
+    TsHsMsgDeferred deferred;
+
+    const char* format = "100%% of value %y then %d";
+    deferred.capturef(format, 5);
+    deferred.format(text);
+    CPPUNIT_ASSERT_EQUAL(std::string("100% of value %y then %d"), text);
+    CPPUNIT_ASSERT_EQUAL(0, deferred.getNumArgs());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test arguments and strings past the capacity limits are dropped and flagged.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgDeferred::testTruncation()
+{
+    std::string text;
+    TsHsMsgDeferred deferred;
+
+    deferred.capturef("%d %d %d %d %d %d %d %d %d %d", 1, 2, 3, 4, 5, 6, 7, 8, 9, 10);
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(TsHsMsgDeferred::MAX_ARGS), deferred.getNumArgs());
+    CPPUNIT_ASSERT_EQUAL(true, deferred.isTruncated());
+    deferred.format(text);
+    CPPUNIT_ASSERT_EQUAL(std::string("1 2 3 4 5 6 7 8 %d %d"), text);
+
+    // A long name is cut short and marked, and a string with no room left is just the mark.
+    const std::string longString(TsHsMsgDeferred::STRINGS_SIZE + 10, 'x');
+    deferred.capturef("<%s> <%s> <%s>", longString.c_str(), "", "link");
+    CPPUNIT_ASSERT_EQUAL(true, deferred.isTruncated());
+    deferred.format(text);
+    CPPUNIT_ASSERT_EQUAL("<" + longString.substr(0, TsHsMsgDeferred::STRINGS_SIZE - 2) + "...> <> <...>",
+                         text);
+
+    // A conversion longer than the format limit is cut and marked too.
+    deferred.capturef("%600d|", 1);
+    CPPUNIT_ASSERT_EQUAL(false, deferred.isTruncated());
+    deferred.format(text);
+    CPPUNIT_ASSERT_EQUAL(std::string(511, ' ') + "...|", text);
+
+    deferred.capturef("%d", 1);
+    CPPUNIT_ASSERT_EQUAL(false, deferred.isTruncated());
+}
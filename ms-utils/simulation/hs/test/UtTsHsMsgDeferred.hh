@@ -0,0 +1,59 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsMsgDeferred class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsMsgDeferred.o)
+)
+
+PROGRAMMERS:
+(
+)
+*******************************************************************************/
+#ifndef UtTsHsMsgDeferred_EXISTS
+#define UtTsHsMsgDeferred_EXISTS
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "TsHsMsgDeferred.hh"
+
+/// @brief Unit test for TsHsMsgDeferred, i.e. the health and status deferred message
+class UtTsHsMsgDeferred: public CppUnit::TestFixture
+{
+public:
+
+    // Ctor not really needed here, but gets rid of some compiler warnings
+    UtTsHsMsgDeferred() : CppUnit::TestFixture() {}
+
+    void setUp();
+    void tearDown();
+
+    void testConstructors();
+    void testConversions();
+    void testStars();
+    void testMalformed();
+    void testTruncation();
+
+private:
+
+    CPPUNIT_TEST_SUITE(UtTsHsMsgDeferred);
+
+    CPPUNIT_TEST(testConstructors);
+    CPPUNIT_TEST(testConversions);
+    CPPUNIT_TEST(testStars);
+    CPPUNIT_TEST(testMalformed);
+    CPPUNIT_TEST(testTruncation);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // Disable these to prevent compiler warnings about them being not implemented
+    UtTsHsMsgDeferred(const UtTsHsMsgDeferred&);
+    const UtTsHsMsgDeferred& operator=(const UtTsHsMsgDeferred&);
+};
+
+#endif /* UtTsHsMsgDeferred_EXISTS */
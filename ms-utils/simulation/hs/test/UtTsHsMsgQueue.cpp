@@ -17,8 +17,36 @@ PROGRAMMERS:
 *******************************************************************************/
 
 #include <string>
+#include <sstream>
+#include <map>
+#include <utility>
+#include <cstdlib>
+#include <pthread.h>
 #include "UtTsHsMsgQueue.hh"
 
+/// @brief Number of producer threads and messages per thread in the multiple producer test.
+static const int NUM_PRODUCERS = 4;
+static const int NUM_PRODUCER_MSGS = 2000;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Producer thread for the multiple producer test. Inserts messages numbered in order.
+///
+/// @param[in] arg (--) Pointer to the producer's queue and subsystem name.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void* insertProducerMsgs(void* arg)
+{
+    std::pair<TsHsMsgQueue*, std::string>* producer = static_cast<std::pair<TsHsMsgQueue*, std::string>*>(arg);
+    TsHsMsgQueue* queue = producer->first;
+    TS_TIMER_TYPE met;
+    for (int i = 0; i < NUM_PRODUCER_MSGS; ++i)
+    {
+        std::ostringstream text;
+        text << i;
+        queue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, producer->second, text.str(), met, 0);
+    }
+    return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Required by cppunit. Called at the beginning of each testXXX method.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,3 +203,247 @@ void UtTsHsMsgQueue::testQueueReinitializationUpsize()
 
 
 
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the lock-free ring drops the newest messages on overflow, and truncates long
+///          fields.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgQueue::testLockFreeOverflow()
+{
+    TS_TIMER_TYPE met;
+    unsigned long timestamp = 42;
+
+    msgQueue->initialize(3, false, true);
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->getLockFree());
+    CPPUNIT_ASSERT_EQUAL(3,     msgQueue->getCapacity());
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->isEmpty());
+
+    const std::string longText(TsHsMsgRingSlot::TEXT_SIZE + 10, 'x');
+    msgQueue->insertMsg(__FILE__, 7, __func__, TS_HS_WARNING, TS_HS_GENERIC, "this is message 1", met, timestamp);
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, longText, met, timestamp);
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "this is message 3", met, timestamp);
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "this is message 4", met, timestamp);
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "this is message 5", met, timestamp);
+
+    // Messages 4 and 5 are dropped, and message 2 is truncated.
+    CPPUNIT_ASSERT_EQUAL(2,     msgQueue->getOverflows());
+    CPPUNIT_ASSERT_EQUAL(1,     msgQueue->getTruncations());
+    CPPUNIT_ASSERT_EQUAL(3,     msgQueue->getSize());
+    CPPUNIT_ASSERT_EQUAL(false, msgQueue->isEmpty());
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->isFull());
+
+    TsHsMsgQueueNode node;
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->removeMsg(node) );
+    CPPUNIT_ASSERT_EQUAL(true,  std::string("this is message 1") == node.mText );
+    CPPUNIT_ASSERT_EQUAL(true,  std::string(__FILE__) == node.mFile );
+    CPPUNIT_ASSERT_EQUAL(true,  std::string(__func__) == node.mFunction );
+    CPPUNIT_ASSERT_EQUAL(true,  std::string(TS_HS_GENERIC) == node.mSubsys );
+    CPPUNIT_ASSERT_EQUAL(7,     node.mLine);
+    CPPUNIT_ASSERT_EQUAL(true,  TS_HS_WARNING == node.mType);
+    CPPUNIT_ASSERT_EQUAL(42UL,  node.mTimestamp);
+
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->removeMsg(node) );
+    CPPUNIT_ASSERT_EQUAL(true,  longText.substr(0, TsHsMsgRingSlot::TEXT_SIZE - 1) == node.mText );
+    CPPUNIT_ASSERT_EQUAL(false, msgQueue->isFull());
+
+    // There is room again after a removal.
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "this is message 6", met, timestamp);
+    CPPUNIT_ASSERT_EQUAL(2,     msgQueue->getOverflows());
+
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->removeMsg(node) );
+    CPPUNIT_ASSERT_EQUAL(true,  std::string("this is message 3") == node.mText );
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->removeMsg(node) );
+    CPPUNIT_ASSERT_EQUAL(true,  std::string("this is message 6") == node.mText );
+    CPPUNIT_ASSERT_EQUAL(false, msgQueue->removeMsg(node) ); // empty remove fails
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->isEmpty());
+    CPPUNIT_ASSERT_EQUAL(0,     msgQueue->getSize());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test messages outstanding when switching to and from the lock-free ring are kept and
+///          removed in order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgQueue::testLockFreeReinitialization()
+{
+    TS_TIMER_TYPE met;
+    unsigned long timestamp;
+
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "this is message 1", met, timestamp);
+    msgQueue->initialize(4, false, true);
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "this is message 2", met, timestamp);
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "this is message 3", met, timestamp);
+    CPPUNIT_ASSERT_EQUAL(3, msgQueue->getSize());
+
+    // Resizing the ring moves its messages to the locked queue, which is resized to match.
+    msgQueue->initialize(3, false, true);
+    CPPUNIT_ASSERT_EQUAL(3, msgQueue->getCapacity());
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "this is message 4", met, timestamp);
+    CPPUNIT_ASSERT_EQUAL(0, msgQueue->getOverflows());
+
+    // Switching back to the locked queue moves the ring messages to it.
+    msgQueue->initialize(5, false);
+    CPPUNIT_ASSERT_EQUAL(false, msgQueue->getLockFree());
+    CPPUNIT_ASSERT_EQUAL(5,     msgQueue->getCapacity());
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "this is message 5", met, timestamp);
+    CPPUNIT_ASSERT_EQUAL(5,     msgQueue->getSize());
+
+    TsHsMsgQueueNode node;
+    for (int i = 1; i <= 5; ++i)
+    {
+        std::ostringstream text;
+        text << "this is message " << i;
+        CPPUNIT_ASSERT_EQUAL(true, msgQueue->removeMsg(node) );
+        CPPUNIT_ASSERT_EQUAL(text.str(), node.mText);
+    }
+    CPPUNIT_ASSERT_EQUAL(false, msgQueue->removeMsg(node) ); // empty remove fails
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test several threads inserting into the lock-free ring while this thread removes. Every
+///          message is either removed or counted as an overflow, and each thread's messages are
+///          removed in the order they were inserted.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgQueue::testLockFreeMultipleProducers()
+{
+    msgQueue->initialize(64, false, true);
+
+    pthread_t threads[NUM_PRODUCERS];
+    std::pair<TsHsMsgQueue*, std::string> producers[NUM_PRODUCERS];
+    for (int i = 0; i < NUM_PRODUCERS; ++i)
+    {
+        std::ostringstream subsys;
+        subsys << "P" << i;
+        producers[i] = std::make_pair(msgQueue, subsys.str());
+        CPPUNIT_ASSERT_EQUAL(0, pthread_create(&threads[i], 0, insertProducerMsgs, &producers[i]));
+    }
+
+    std::map<std::string, int> lastMsg;
+    TsHsMsgQueueNode node;
+    int removed = 0;
+    bool ordered = true;
+    int running = NUM_PRODUCERS;
+    while (running > 0 or not msgQueue->isEmpty())
+    {
+        if (msgQueue->removeMsg(node))
+        {
+            ++removed;
+            const int msg = atoi(node.mText.c_str());
+            std::map<std::string, int>::iterator last = lastMsg.find(node.mSubsys);
+            if (last != lastMsg.end() and msg <= last->second)
+            {
+                ordered = false;
+            }
+            lastMsg[node.mSubsys] = msg;
+        }
+        else if (removed + msgQueue->getOverflows() == NUM_PRODUCERS * NUM_PRODUCER_MSGS)
+        {
+            running = 0;
+        }
+    }
+
+    for (int i = 0; i < NUM_PRODUCERS; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(0, pthread_join(threads[i], 0));
+    }
+    CPPUNIT_ASSERT_EQUAL(true, ordered);
+    CPPUNIT_ASSERT_EQUAL(NUM_PRODUCERS * NUM_PRODUCER_MSGS, removed + msgQueue->getOverflows());
+    CPPUNIT_ASSERT_EQUAL(0, msgQueue->getTruncations());
+    CPPUNIT_ASSERT_EQUAL(true, msgQueue->isEmpty());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test re-initializing the queue, switching between the lock-free ring and the locked
+///          queue and resizing them, while several threads insert. Every message is either removed
+///          or counted as an overflow, and each thread's messages are removed in the order they
+///          were inserted.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgQueue::testReinitializationWhileInserting()
+{
+    msgQueue->initialize(64, true, true);
+
+    pthread_t threads[NUM_PRODUCERS];
+    std::pair<TsHsMsgQueue*, std::string> producers[NUM_PRODUCERS];
+    for (int i = 0; i < NUM_PRODUCERS; ++i)
+    {
+        std::ostringstream subsys;
+        subsys << "P" << i;
+        producers[i] = std::make_pair(msgQueue, subsys.str());
+        CPPUNIT_ASSERT_EQUAL(0, pthread_create(&threads[i], 0, insertProducerMsgs, &producers[i]));
+    }
+
+    std::map<std::string, int> lastMsg;
+    TsHsMsgQueueNode node;
+    int removed = 0;
+    bool ordered = true;
+    for (int reinit = 0; removed + msgQueue->getOverflows() < NUM_PRODUCERS * NUM_PRODUCER_MSGS;
+         ++reinit)
+    {
+        msgQueue->initialize(8 + 24 * (reinit % 3), true, 0 == reinit % 2);
+        for (int i = 0; i < 16 and msgQueue->removeMsg(node); ++i)
+        {
+            ++removed;
+            const int msg = atoi(node.mText.c_str());
+            std::map<std::string, int>::iterator last = lastMsg.find(node.mSubsys);
+            if (last != lastMsg.end() and msg <= last->second)
+            {
+                ordered = false;
+            }
+            lastMsg[node.mSubsys] = msg;
+        }
+    }
+
+    for (int i = 0; i < NUM_PRODUCERS; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(0, pthread_join(threads[i], 0));
+    }
+    CPPUNIT_ASSERT_EQUAL(true, ordered);
+    CPPUNIT_ASSERT_EQUAL(NUM_PRODUCERS * NUM_PRODUCER_MSGS, removed + msgQueue->getOverflows());
+    CPPUNIT_ASSERT_EQUAL(0, msgQueue->getLockFailures());
+    CPPUNIT_ASSERT_EQUAL(true, msgQueue->isEmpty());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test deferred messages are formatted when removed from the lock-free ring, and when
+///          inserted into the locked queue.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgQueue::testDeferredMsg()
+{
+    TS_TIMER_TYPE met;
+    unsigned long timestamp = 42;
+    TsHsMsgDeferred deferred;
+    char link[] = "link1";
+
+    // The locked queue formats the text on insert.
+    deferred.capturef("%s failed to converge after %d iterations.", link, 10);
+    msgQueue->insertDeferredMsg(__FILE__, 7, __func__, TS_HS_WARNING, TS_HS_GENERIC, deferred, met, timestamp);
+    link[4] = '2';
+
+    // The ring keeps the format and the arguments, including a copy of the string.
+    msgQueue->initialize(3, false, true);
+    deferred.capturef("%s failed to converge after %d iterations.", link, 20);
+    msgQueue->insertDeferredMsg(__FILE__, 8, __func__, TS_HS_WARNING, TS_HS_GENERIC, deferred, met, timestamp);
+    link[4] = '3';
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "this is message 3", met, timestamp);
+    CPPUNIT_ASSERT_EQUAL(3, msgQueue->getSize());
+
+    TsHsMsgQueueNode node;
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->removeMsg(node) );
+    CPPUNIT_ASSERT_EQUAL(std::string("link1 failed to converge after 10 iterations."), node.mText);
+    CPPUNIT_ASSERT_EQUAL(7,     node.mLine);
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->removeMsg(node) );
+    CPPUNIT_ASSERT_EQUAL(std::string("link2 failed to converge after 20 iterations."), node.mText);
+    CPPUNIT_ASSERT_EQUAL(8,     node.mLine);
+    CPPUNIT_ASSERT_EQUAL(true,  TS_HS_WARNING == node.mType);
+    CPPUNIT_ASSERT_EQUAL(42UL,  node.mTimestamp);
+
+    // An ordinary message reusing the slot isn't formatted from the old deferred message.
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->removeMsg(node) );
+    CPPUNIT_ASSERT_EQUAL(std::string("this is message 3"), node.mText);
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "this is message 4", met, timestamp);
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "this is message 5", met, timestamp);
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->removeMsg(node) );
+    CPPUNIT_ASSERT_EQUAL(std::string("this is message 4"), node.mText);
+    CPPUNIT_ASSERT_EQUAL(true,  msgQueue->removeMsg(node) );
+    CPPUNIT_ASSERT_EQUAL(std::string("this is message 5"), node.mText);
+    CPPUNIT_ASSERT_EQUAL(false, msgQueue->removeMsg(node) );
+}
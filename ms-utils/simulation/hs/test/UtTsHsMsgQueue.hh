@@ -41,6 +41,11 @@ public:
     void testOrdinaryOverflow();
     void testQueueReinitializationDownsize();
     void testQueueReinitializationUpsize();
+    void testLockFreeOverflow();
+    void testLockFreeReinitialization();
+    void testLockFreeMultipleProducers();
+    void testReinitializationWhileInserting();
+    void testDeferredMsg();
 
 private:
 
@@ -51,6 +56,11 @@ private:
     CPPUNIT_TEST(testOrdinaryOverflow);
     CPPUNIT_TEST(testQueueReinitializationDownsize);
     CPPUNIT_TEST(testQueueReinitializationUpsize);
+    CPPUNIT_TEST(testLockFreeOverflow);
+    CPPUNIT_TEST(testLockFreeReinitialization);
+    CPPUNIT_TEST(testLockFreeMultipleProducers);
+    CPPUNIT_TEST(testReinitializationWhileInserting);
+    CPPUNIT_TEST(testDeferredMsg);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -19,6 +19,7 @@ PROGRAMMERS:
 )
 *******************************************************************************/
 
+#include <sstream>
 #include "UtTsHsMsgStdFilter.hh"
 #include "TsHsMsgStdFilter.hh"
 
@@ -248,3 +249,51 @@ void UtTsHsMsgStdFilter::testTypeFilter()
 
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the redundancy filter evicts the least-recently displayed message when its history
+///          is full, with a large history and with the count and history changed at run-time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgStdFilter::testHistoryEviction()
+{
+    msgFilter->setInterval(100);
+    msgFilter->setCount(1);
+    msgFilter->setHistory(1000);
+
+    // Fill the history with unique messages, then overflow it by 500 more. All are displayed.
+    for (int i = 0; i < 1500; ++i)
+    {
+        std::ostringstream text;
+        text << "message " << i;
+        CPPUNIT_ASSERT_EQUAL(true, msgFilter->shouldSendMessage(1.0, "file", 123, TS_HS_DEBUG, "subsys", text.str()));
+    }
+    CPPUNIT_ASSERT_EQUAL(0, msgFilter->getMessagesSuppressed());
+
+    // The last 1000 messages are remembered and suppressed, the first 500 were evicted.
+    CPPUNIT_ASSERT_EQUAL(false, msgFilter->shouldSendMessage(2.0, "file", 123, TS_HS_DEBUG, "subsys", "message 500"));
+    CPPUNIT_ASSERT_EQUAL(false, msgFilter->shouldSendMessage(2.0, "file", 123, TS_HS_DEBUG, "subsys", "message 1499"));
+    CPPUNIT_ASSERT_EQUAL(true,  msgFilter->shouldSendMessage(2.0, "file", 123, TS_HS_DEBUG, "subsys", "message 0"));
+    CPPUNIT_ASSERT_EQUAL(2, msgFilter->getMessagesSuppressed());
+
+    // Messages differing only in file, line or subsystem are unique.
+    CPPUNIT_ASSERT_EQUAL(true,  msgFilter->shouldSendMessage(2.0, "file2", 123, TS_HS_DEBUG, "subsys",  "message 1499"));
+    CPPUNIT_ASSERT_EQUAL(true,  msgFilter->shouldSendMessage(2.0, "file",  124, TS_HS_DEBUG, "subsys",  "message 1499"));
+    CPPUNIT_ASSERT_EQUAL(true,  msgFilter->shouldSendMessage(2.0, "file",  123, TS_HS_DEBUG, "subsys2", "message 1499"));
+
+    // Shrink the history and allow a duplicate. Displaying A again makes B the oldest, so B is
+    // evicted by C and A is still remembered.
+    msgFilter->setCount(2);
+    msgFilter->setHistory(2);
+    CPPUNIT_ASSERT_EQUAL(true,  msgFilter->shouldSendMessage(3.0, "file", 123, TS_HS_DEBUG, "subsys", "A"));
+    CPPUNIT_ASSERT_EQUAL(true,  msgFilter->shouldSendMessage(3.1, "file", 123, TS_HS_DEBUG, "subsys", "B"));
+    CPPUNIT_ASSERT_EQUAL(true,  msgFilter->shouldSendMessage(3.2, "file", 123, TS_HS_DEBUG, "subsys", "A"));
+    CPPUNIT_ASSERT_EQUAL(true,  msgFilter->shouldSendMessage(3.3, "file", 123, TS_HS_DEBUG, "subsys", "C"));
+    CPPUNIT_ASSERT_EQUAL(false, msgFilter->shouldSendMessage(3.4, "file", 123, TS_HS_DEBUG, "subsys", "A"));
+    CPPUNIT_ASSERT_EQUAL(true,  msgFilter->shouldSendMessage(3.5, "file", 123, TS_HS_DEBUG, "subsys", "B"));
+    CPPUNIT_ASSERT_EQUAL(3, msgFilter->getMessagesSuppressed());
+
+    // Restart clears the history.
+    msgFilter->restart();
+    CPPUNIT_ASSERT_EQUAL(true,  msgFilter->shouldSendMessage(3.6, "file", 123, TS_HS_DEBUG, "subsys", "B"));
+    CPPUNIT_ASSERT_EQUAL(true,  msgFilter->shouldSendMessage(3.7, "file", 123, TS_HS_DEBUG, "subsys", "B"));
+    CPPUNIT_ASSERT_EQUAL(false, msgFilter->shouldSendMessage(3.8, "file", 123, TS_HS_DEBUG, "subsys", "B"));
+}
@@ -42,6 +42,7 @@ public:
     void testSettersRuntime();
     void testRedundancyFilter();
     void testTypeFilter();
+    void testHistoryEviction();
 
 private:
 
@@ -52,6 +53,7 @@ private:
     CPPUNIT_TEST(testSettersRuntime);
     CPPUNIT_TEST(testRedundancyFilter);
     CPPUNIT_TEST(testTypeFilter);
+    CPPUNIT_TEST(testHistoryEviction);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -0,0 +1,295 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsSqlitePlugin class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsSqlitePlugin.o)
+)
+
+PROGRAMMERS:
+(
+)
+*******************************************************************************/
+
+#include <cstdio>
+#include <string>
+#include <pthread.h>
+#include <sqlite3.h>
+#include <unistd.h>
+#include "TsHsPluginConfig.hh"
+#include "UtTsHsSqlitePlugin.hh"
+
+/// @brief Database file written by the tests.
+static const std::string DB_FILE = "UtTsHsSqlitePlugin.db";
+
+/// @brief Number of logging threads and messages per thread in the shutdown flush test.
+static const int NUM_LOGGERS = 4;
+static const int NUM_LOGGER_MSGS = 1000;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Logging thread for the shutdown flush test. Logs messages numbered in order.
+///
+/// @param[in] arg (--) Pointer to the plugin.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void* logLoggerMsgs(void* arg)
+{
+    TsHsSqlitePlugin* plugin = static_cast<TsHsSqlitePlugin*>(arg);
+    TS_TIMER_TYPE met;
+    for (int i = 0; i < NUM_LOGGER_MSGS; ++i)
+    {
+        plugin->msg(__FILE__, __LINE__, __func__, TS_HS_INFO, "LOGGER", met, i, "logger message");
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the beginning of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::setUp()
+{
+    plugin = new FriendlyTsHsSqlitePlugin();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the end of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::tearDown()
+{
+    delete plugin;
+    remove(DB_FILE.c_str());
+    remove((DB_FILE + "-wal").c_str());
+    remove((DB_FILE + "-shm").c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] blocking    (--) Whether the plugin waits for room in the pending batch.
+/// @param[in] batchSize   (--) Number of messages written per transaction.
+/// @param[in] flushPeriod (s)  Maximum time a message waits before its batch is written.
+///
+/// @details Configures the plugin to overwrite the test database, and initializes it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::initPlugin(const bool blocking, const int batchSize, const double flushPeriod)
+{
+    TsHsPluginConfig config;
+    config.mEnabled   = true;
+    config.mOverwrite = true;
+    config.mPath      = DB_FILE;
+    config.mBlocking  = blocking;
+    plugin->configure(config);
+    plugin->setBatching(batchSize, flushPeriod);
+    CPPUNIT_ASSERT_EQUAL(true, plugin->init());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] numMsgs (--) Number of messages to log.
+///
+/// @details Logs distinct messages to the plugin from this thread.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::logMsgs(const int numMsgs)
+{
+    TS_TIMER_TYPE met;
+    for (int i = 0; i < numMsgs; ++i)
+    {
+        plugin->msg(__FILE__, __LINE__, __func__, TS_HS_INFO, "TEST", met, i, "test message");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Counts the message occurrences in the database file with a separate connection, so
+///          only committed messages are counted.
+///
+/// @return  The number of messages in the database file, or zero if it has no timestamps table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int UtTsHsSqlitePlugin::countRecords()
+{
+    int count = 0;
+    sqlite3* db = 0;
+    if (sqlite3_open_v2(DB_FILE.c_str(), &db, SQLITE_OPEN_READWRITE, NULL) == SQLITE_OK)
+    {
+        sqlite3_stmt* stmt = 0;
+        if (sqlite3_prepare_v2(db, "SELECT COUNT(*) FROM timestamps;", -1, &stmt, NULL) == SQLITE_OK
+                and sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            count = sqlite3_column_int(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+    }
+    sqlite3_close(db);
+    return count;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] numRecords (--) Number of messages to wait for.
+/// @param[in] timeout    (s)  Maximum time to wait.
+///
+/// @details Polls the database file until it holds at least the given number of messages or the
+///          timeout expires.
+///
+/// @return  The number of messages in the database file.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int UtTsHsSqlitePlugin::waitForRecords(const int numRecords, const double timeout)
+{
+    int count = countRecords();
+    for (double waited = 0.0; count < numRecords and waited < timeout; waited += 0.01)
+    {
+        usleep(10000);
+        count = countRecords();
+    }
+    return count;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the writer writes a batch as soon as it is full, and not before.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::testBatchSizeFlush()
+{
+    initPlugin(true, 4, 60.0);
+    CPPUNIT_ASSERT_EQUAL(true, plugin->mWriterRunning);
+
+    logMsgs(3);
+    usleep(200000);
+    CPPUNIT_ASSERT_EQUAL(0, countRecords());
+
+    logMsgs(1);
+    CPPUNIT_ASSERT_EQUAL(4, waitForRecords(4, 5.0));
+
+    logMsgs(3);
+    usleep(200000);
+    CPPUNIT_ASSERT_EQUAL(4, countRecords());
+
+    logMsgs(1);
+    CPPUNIT_ASSERT_EQUAL(8, waitForRecords(8, 5.0));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the writer writes a partial batch once the flush period elapses.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::testFlushPeriod()
+{
+    initPlugin(true, 100, 0.05);
+
+    logMsgs(1);
+    CPPUNIT_ASSERT_EQUAL(1, waitForRecords(1, 5.0));
+
+    logMsgs(2);
+    CPPUNIT_ASSERT_EQUAL(3, waitForRecords(3, 5.0));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the batching is limited and latched at init, so changing it while messages are
+///          logged takes effect at the next init.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::testLatchedBatching()
+{
+    plugin->setBatching(0, 0.0);
+    CPPUNIT_ASSERT_EQUAL(1,     plugin->mBatchSize);
+    CPPUNIT_ASSERT_EQUAL(0.001, plugin->mFlushPeriod);
+
+    initPlugin(true, 4, 60.0);
+    plugin->setBatching(1000, 0.5);
+    CPPUNIT_ASSERT_EQUAL(4,    plugin->mActiveBatchSize);
+    CPPUNIT_ASSERT_EQUAL(60.0, plugin->mActiveFlushPeriod);
+    CPPUNIT_ASSERT_EQUAL(8,    static_cast<int>(plugin->mPending.size()));
+
+    logMsgs(4);
+    CPPUNIT_ASSERT_EQUAL(4, waitForRecords(4, 5.0));
+
+    plugin->shutdown();
+    CPPUNIT_ASSERT_EQUAL(true, plugin->init());
+    CPPUNIT_ASSERT_EQUAL(1000, plugin->mActiveBatchSize);
+    CPPUNIT_ASSERT_EQUAL(0.5,  plugin->mActiveFlushPeriod);
+    CPPUNIT_ASSERT_EQUAL(2000, static_cast<int>(plugin->mPending.size()));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test shutdown writes every message logged by several threads, including the last
+///          partial batch.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::testShutdownFlush()
+{
+    initPlugin(true, 256, 60.0);
+
+    pthread_t threads[NUM_LOGGERS];
+    for (int i = 0; i < NUM_LOGGERS; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(0, pthread_create(&threads[i], 0, logLoggerMsgs, plugin));
+    }
+    for (int i = 0; i < NUM_LOGGERS; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(0, pthread_join(threads[i], 0));
+    }
+    logMsgs(3);
+
+    plugin->shutdown();
+    CPPUNIT_ASSERT_EQUAL(0, plugin->mOverflows);
+    CPPUNIT_ASSERT_EQUAL(0, plugin->mTryLockFailures);
+    CPPUNIT_ASSERT_EQUAL(NUM_LOGGERS * NUM_LOGGER_MSGS + 3, countRecords());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test non-blocking mode counts the messages dropped while the pending buffer is full,
+///          and writes the messages it kept.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::testOverflow()
+{
+    initPlugin(false, 2, 60.0);
+
+    // Holding the write lock keeps the writer from taking the pending batch.
+    pthread_mutex_lock(&plugin->mWriteLock);
+    int attempts = 0;
+    while (plugin->mOverflows < 3 and attempts < 1000)
+    {
+        logMsgs(1);
+        ++attempts;
+    }
+    pthread_mutex_lock(&plugin->mResourceLock);
+    const int numPending = plugin->mNumPending;
+    pthread_mutex_unlock(&plugin->mResourceLock);
+    pthread_mutex_unlock(&plugin->mWriteLock);
+
+    CPPUNIT_ASSERT_EQUAL(3, plugin->mOverflows);
+    CPPUNIT_ASSERT_EQUAL(4, numPending);
+    CPPUNIT_ASSERT_EQUAL(attempts, numPending + plugin->mOverflows + plugin->mTryLockFailures);
+
+    plugin->shutdown();
+    CPPUNIT_ASSERT_EQUAL(numPending, countRecords());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the logging thread writes each full batch when there is no writer thread, in both
+///          modes, even after the batching is changed since init.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::testNoWriterFallback()
+{
+    initPlugin(true, 3, 60.0);
+    plugin->stopWriter();
+    CPPUNIT_ASSERT_EQUAL(false, plugin->mWriterRunning);
+
+    logMsgs(2);
+    CPPUNIT_ASSERT_EQUAL(0, countRecords());
+    logMsgs(1);
+    CPPUNIT_ASSERT_EQUAL(3, countRecords());
+    logMsgs(7);
+    CPPUNIT_ASSERT_EQUAL(9, countRecords());
+
+    plugin->shutdown();
+    CPPUNIT_ASSERT_EQUAL(10, countRecords());
+
+    // Non-blocking mode, with a batch size larger than the buffers set since init.
+    tearDown();
+    setUp();
+    initPlugin(false, 3, 60.0);
+    plugin->stopWriter();
+    plugin->setBatching(100, 60.0);
+
+    logMsgs(20);
+    CPPUNIT_ASSERT_EQUAL(0,  plugin->mOverflows);
+    CPPUNIT_ASSERT_EQUAL(18, countRecords());
+
+    plugin->shutdown();
+    CPPUNIT_ASSERT_EQUAL(20, countRecords());
+}
@@ -0,0 +1,85 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsSqlitePlugin class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsSqlitePlugin.o)
+)
+
+PROGRAMMERS:
+(
+)
+*******************************************************************************/
+#ifndef UtTsHsSqlitePlugin_EXISTS
+#define UtTsHsSqlitePlugin_EXISTS
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "TsHsSqlitePlugin.hh"
+
+/// @brief Inherit from TsHsSqlitePlugin and befriend UtTsHsSqlitePlugin.
+class FriendlyTsHsSqlitePlugin : public TsHsSqlitePlugin
+{
+public:
+    FriendlyTsHsSqlitePlugin() : TsHsSqlitePlugin(0) {}
+    virtual ~FriendlyTsHsSqlitePlugin() {}
+    friend class UtTsHsSqlitePlugin;
+};
+
+/// @brief Unit test for TsHsSqlitePlugin, i.e. the health and status SQLite output plugin
+class UtTsHsSqlitePlugin: public CppUnit::TestFixture
+{
+public:
+
+    // Ctor not really needed here, but gets rid of some compiler warnings
+    UtTsHsSqlitePlugin() : CppUnit::TestFixture(), plugin(0) {}
+
+    void setUp();
+    void tearDown();
+
+    void testBatchSizeFlush();
+    void testFlushPeriod();
+    void testLatchedBatching();
+    void testShutdownFlush();
+    void testOverflow();
+    void testNoWriterFallback();
+
+private:
+
+    CPPUNIT_TEST_SUITE(UtTsHsSqlitePlugin);
+
+    CPPUNIT_TEST(testBatchSizeFlush);
+    CPPUNIT_TEST(testFlushPeriod);
+    CPPUNIT_TEST(testLatchedBatching);
+    CPPUNIT_TEST(testShutdownFlush);
+    CPPUNIT_TEST(testOverflow);
+    CPPUNIT_TEST(testNoWriterFallback);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    /// @brief Configures and initializes the plugin with the given blocking and batching.
+    void initPlugin(const bool blocking, const int batchSize, const double flushPeriod);
+
+    /// @brief Logs the given number of messages to the plugin.
+    void logMsgs(const int numMsgs);
+
+    /// @brief Returns the number of messages written to the database file.
+    int countRecords();
+
+    /// @brief Waits up to the given time for the database file to hold the given number of messages.
+    int waitForRecords(const int numRecords, const double timeout);
+
+    // Data members
+    FriendlyTsHsSqlitePlugin* plugin;
+
+    // Disable these to prevent compiler warnings about them being not implemented
+    UtTsHsSqlitePlugin(const UtTsHsSqlitePlugin&);
+    const UtTsHsSqlitePlugin& operator=(const UtTsHsSqlitePlugin&);
+};
+
+#endif /* UtTsHsSqlitePlugin_EXISTS */
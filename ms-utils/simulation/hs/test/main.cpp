@@ -20,6 +20,8 @@ PROGRAMMERS:
 #include "UT_TS_hs.hh"
 #include "UtTsHsMsgStdFilter.hh"
 #include "UtTsHsMsgQueue.hh"
+#include "UtTsHsMsgDeferred.hh"
+#include "UtTsHsSqlitePlugin.hh"
 
 #include <cppunit/XmlOutputter.h>
 #include <cppunit/TestResult.h>
@@ -49,6 +51,8 @@ int main(int argc, char** argv) {
     runner.addTest(UT_TS_hs::suite());
     runner.addTest(UtTsHsMsgStdFilter::suite());
     runner.addTest(UtTsHsMsgQueue::suite());
+    runner.addTest(UtTsHsMsgDeferred::suite());
+    runner.addTest(UtTsHsSqlitePlugin::suite());
 
     runner.run(testresult);
     // Output results in compiler format
@@ -0,0 +1,324 @@
+/*
+ * @copyright Copyright 2026 United States Government as represented by the Administrator of the
+ *            National Aeronautics and Space Administration.  All Rights Reserved.
+ *
+ * Trick-less GUNNS solver benchmark.  Builds a synthetic basic, thermal, electrical or fluid network
+ * over a ladder, mesh, random sparse or island-heavy topology, runs it for a number of steps, and
+ * reports per-phase wall-clock timing and solver statistics in JSON or CSV.  Run with --help for the
+ * options.
+ */
+
+#include "core/GunnsInfraFunctions.hh"
+#include "sims/networks/benchmark/BenchmarkBasicNetwork.hh"
+#include "sims/networks/benchmark/BenchmarkElectNetwork.hh"
+#include "sims/networks/benchmark/BenchmarkFluidNetwork.hh"
+#include "sims/networks/benchmark/BenchmarkThermalNetwork.hh"
+#include "software/exceptions/TsBaseException.hh"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/// @brief  Benchmark run options, with their defaults.
+struct Options {
+    std::string        network;
+    std::string        topology;
+    int                nodes;
+    double             density;
+    double             nonLinear;
+    int                islands;
+    std::string        islandMode;
+    bool               dither;
+    double             adaptive;
+    int                warmup;
+    int                steps;
+    double             dt;
+    unsigned long long seed;
+    std::string        format;
+    std::string        trace;
+    Options()
+        : network("basic"), topology("mesh"), nodes(100), density(0.0), nonLinear(0.0),
+          islands(0), islandMode("off"), dither(false), adaptive(0.0), warmup(10), steps(1000), dt(0.1), seed(1),
+          format("json"), trace("") {}
+};
+
+/// @brief  Summary statistics of a timing phase.
+struct Stats {
+    double mean, min, max, p50, p95, total;
+};
+
+static void usage(const char* program)
+{
+    std::cout
+        << "Usage: " << program << " [options]\n"
+        << "  --network basic|thermal|elect|fluid   network aspect (basic)\n"
+        << "  --topology ladder|mesh|random|islands graph type (mesh)\n"
+        << "  --nodes N         number of interior nodes (100)\n"
+        << "  --density D       extra edges: diagonal probability for ladder & mesh, chords per\n"
+        << "                    node for random & islands (0)\n"
+        << "  --nonlinear F     fraction (0-1) of non-linear edges & node loads (0)\n"
+        << "  --islands K       number of disconnected blocks, 0 for the topology default (0)\n"
+        << "  --island-mode off|find|solve          solver island mode (off)\n"
+        << "  --dither          vary a conductance every step to force decompositions\n"
+        << "  --adaptive TOL    solver adaptive decomposition matrix change tolerance, 0 for off (0)\n"
+        << "  --warmup N        untimed steps before the timed steps (10)\n"
+        << "  --steps N         number of timed steps (1000)\n"
+        << "  --dt S            time step, seconds (0.1)\n"
+        << "  --seed S          topology random seed (1)\n"
+        << "  --format json|csv summary output format (json)\n"
+        << "  --trace FILE      also write per-step samples to FILE as CSV\n";
+}
+
+static bool parseArgs(int argc, char** argv, Options& opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = (i + 1 < argc);
+        if ("--help" == arg or "-h" == arg) {
+            return false;
+        } else if ("--dither" == arg) {
+            opts.dither = true;
+        } else if (not hasValue) {
+            std::cerr << "missing value for option: " << arg << std::endl;
+            return false;
+        } else if ("--network"     == arg) { opts.network    = argv[++i];
+        } else if ("--topology"    == arg) { opts.topology   = argv[++i];
+        } else if ("--nodes"       == arg) { opts.nodes      = std::atoi(argv[++i]);
+        } else if ("--density"     == arg) { opts.density    = std::atof(argv[++i]);
+        } else if ("--nonlinear"   == arg) { opts.nonLinear  = std::atof(argv[++i]);
+        } else if ("--islands"     == arg) { opts.islands    = std::atoi(argv[++i]);
+        } else if ("--island-mode" == arg) { opts.islandMode = argv[++i];
+        } else if ("--adaptive"    == arg) { opts.adaptive   = std::atof(argv[++i]);
+        } else if ("--warmup"      == arg) { opts.warmup     = std::atoi(argv[++i]);
+        } else if ("--steps"       == arg) { opts.steps      = std::atoi(argv[++i]);
+        } else if ("--dt"          == arg) { opts.dt         = std::atof(argv[++i]);
+        } else if ("--seed"        == arg) { opts.seed       = std::strtoull(argv[++i], 0, 10);
+        } else if ("--format"      == arg) { opts.format     = argv[++i];
+        } else if ("--trace"       == arg) { opts.trace      = argv[++i];
+        } else {
+            std::cerr << "unknown option: " << arg << std::endl;
+            return false;
+        }
+    }
+    if (opts.steps < 1 or opts.warmup < 0 or opts.dt <= 0.0) {
+        std::cerr << "steps must be > 0, warmup >= 0 and dt > 0." << std::endl;
+        return false;
+    }
+    if ("json" != opts.format and "csv" != opts.format) {
+        std::cerr << "unknown format: " << opts.format << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static BenchmarkNetwork* createNetwork(const Options& opts)
+{
+    const std::string name = "bench";
+    if ("basic"   == opts.network) return new BenchmarkBasicNetwork  (name, opts.dither);
+    if ("thermal" == opts.network) return new BenchmarkThermalNetwork(name, opts.dither);
+    if ("elect"   == opts.network) return new BenchmarkElectNetwork  (name, opts.dither);
+    if ("fluid"   == opts.network) return new BenchmarkFluidNetwork  (name, opts.dither);
+    return 0;
+}
+
+static Stats computeStats(std::vector<double> samples)
+{
+    Stats stats = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    if (samples.empty()) {
+        return stats;
+    }
+    std::sort(samples.begin(), samples.end());
+    const size_t n = samples.size();
+    for (size_t i = 0; i < n; ++i) {
+        stats.total += samples[i];
+    }
+    stats.mean = stats.total / n;
+    stats.min  = samples.front();
+    stats.max  = samples.back();
+    stats.p50  = samples[(n - 1) / 2];
+    stats.p95  = samples[std::min(n - 1, static_cast<size_t>(0.95 * n))];
+    return stats;
+}
+
+static void writeJsonStats(std::ostream& out, const char* name, const Stats& s, const bool last)
+{
+    out << "    \"" << name << "\": {\"mean\": " << s.mean << ", \"min\": " << s.min
+        << ", \"max\": " << s.max << ", \"p50\": " << s.p50 << ", \"p95\": " << s.p95
+        << ", \"total\": " << s.total << "}" << (last ? "\n" : ",\n");
+}
+
+int main(int argc, char** argv)
+{
+    Options opts;
+    if (not parseArgs(argc, argv, opts)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    /// - Use a real clock for the solver's internal step & solve timers.
+    GunnsInfraFunctions::mUseWallClock = true;
+
+    BenchmarkNetwork* network = createNetwork(opts);
+    if (not network) {
+        std::cerr << "unknown network: " << opts.network << std::endl;
+        usage(argv[0]);
+        return 1;
+    }
+
+    BenchmarkTopology topology;
+    Gunns::IslandMode islandMode = Gunns::OFF;
+    double initTime = 0.0;
+    try {
+        const BenchmarkTopology::Type type = BenchmarkTopology::parseType(opts.topology);
+        topology.build(type, opts.nodes, opts.density, opts.nonLinear, opts.islands, opts.seed);
+        if      ("find"  == opts.islandMode) islandMode = Gunns::FIND;
+        else if ("solve" == opts.islandMode) islandMode = Gunns::SOLVE;
+        else if ("off"   != opts.islandMode) {
+            std::cerr << "unknown island mode: " << opts.islandMode << std::endl;
+            delete network;
+            return 1;
+        }
+        const double start = GunnsInfraFunctions::clockTime();
+        network->initialize(topology, islandMode);
+        initTime = GunnsInfraFunctions::clockTime() - start;
+        if (opts.adaptive > 0.0) {
+            network->netSolver.setAdaptiveDecomposition(true, opts.adaptive, 1.0E-10, 5);
+        }
+    } catch (TsBaseException& e) {
+        std::cerr << "initialization failed: " << e.getMessage() << ": " << e.getCause() << std::endl;
+        delete network;
+        return 1;
+    }
+
+    /// - Untimed warm-up steps let the network settle out of its initial conditions.
+    for (int i = 0; i < opts.warmup; ++i) {
+        network->stimulate(opts.dt);
+        network->step(opts.dt);
+    }
+
+    /// - Timed steps.  The stimulus phase models the sim's other models writing to the links, the
+    ///   step phase is the whole solver step, the solve phase is the solver's own timer for matrix
+    ///   decomposition & solution, and the links phase is the remainder of the step spent in link
+    ///   and node updates.
+    std::vector<double> stimulateTime(opts.steps);
+    std::vector<double> stepTime(opts.steps);
+    std::vector<double> solveTime(opts.steps);
+    std::vector<double> linksTime(opts.steps);
+    std::vector<int>    decompositions(opts.steps);
+    std::vector<int>    minorSteps(opts.steps);
+    const int    decompStart = network->netSolver.getDecompositionCount();
+    const int    minorStart  = network->netSolver.getMinorStepCount();
+    const int    failStart   = network->netSolver.getConvergenceFailCount();
+    const int    skipStart   = network->netSolver.getAdaptiveSkipCount();
+    int          lastDecomp  = decompStart;
+    int          lastMinor   = minorStart;
+    for (int i = 0; i < opts.steps; ++i) {
+        const double t0 = GunnsInfraFunctions::clockTime();
+        network->stimulate(opts.dt);
+        const double t1 = GunnsInfraFunctions::clockTime();
+        network->step(opts.dt);
+        const double t2 = GunnsInfraFunctions::clockTime();
+        stimulateTime[i]  = t1 - t0;
+        stepTime[i]       = t2 - t1;
+        solveTime[i]      = network->netSolver.getSolveTime();
+        linksTime[i]      = std::max(0.0, stepTime[i] - solveTime[i]);
+        decompositions[i] = network->netSolver.getDecompositionCount() - lastDecomp;
+        minorSteps[i]     = network->netSolver.getMinorStepCount()     - lastMinor;
+        lastDecomp        = network->netSolver.getDecompositionCount();
+        lastMinor         = network->netSolver.getMinorStepCount();
+    }
+
+    const Stats  stimulateStats = computeStats(stimulateTime);
+    const Stats  stepStats      = computeStats(stepTime);
+    const Stats  solveStats     = computeStats(solveTime);
+    const Stats  linksStats     = computeStats(linksTime);
+    const double decompPerStep  = double(lastDecomp - decompStart) / opts.steps;
+    const double minorPerStep   = double(lastMinor  - minorStart)  / opts.steps;
+    const int    convergeFails  = network->netSolver.getConvergenceFailCount() - failStart;
+    const double skipPerStep    = double(network->netSolver.getAdaptiveSkipCount() - skipStart)
+                                / opts.steps;
+    const double checksum       = network->computeChecksum();
+
+    /// - Optional per-step trace.
+    if (not opts.trace.empty()) {
+        std::ofstream trace(opts.trace.c_str());
+        trace << std::setprecision(9)
+              << "step,stimulate_s,step_s,solve_s,links_s,decompositions,minor_steps\n";
+        for (int i = 0; i < opts.steps; ++i) {
+            trace << i << "," << stimulateTime[i] << "," << stepTime[i] << "," << solveTime[i]
+                  << "," << linksTime[i] << "," << decompositions[i] << "," << minorSteps[i]
+                  << "\n";
+        }
+    }
+
+    /// - Summary.
+    std::cout << std::setprecision(9);
+    if ("json" == opts.format) {
+        std::cout
+            << "{\n"
+            << "  \"network\": \"" << opts.network << "\",\n"
+            << "  \"topology\": \"" << opts.topology << "\",\n"
+            << "  \"nodes\": " << network->getNumNodes() << ",\n"
+            << "  \"links\": " << network->getNumLinks() << ",\n"
+            << "  \"edges\": " << topology.mEdges.size() << ",\n"
+            << "  \"nonlinear_edges\": " << topology.getNumNonLinearEdges() << ",\n"
+            << "  \"blocks\": " << topology.getNumBlocks() << ",\n"
+            << "  \"density\": " << opts.density << ",\n"
+            << "  \"nonlinear\": " << opts.nonLinear << ",\n"
+            << "  \"island_mode\": \"" << opts.islandMode << "\",\n"
+            << "  \"dither\": " << (opts.dither ? "true" : "false") << ",\n"
+            << "  \"adaptive\": " << opts.adaptive << ",\n"
+            << "  \"seed\": " << opts.seed << ",\n"
+            << "  \"dt\": " << opts.dt << ",\n"
+            << "  \"warmup\": " << opts.warmup << ",\n"
+            << "  \"steps\": " << opts.steps << ",\n"
+            << "  \"init_s\": " << initTime << ",\n"
+            << "  \"phases_s\": {\n";
+        writeJsonStats(std::cout, "stimulate", stimulateStats, false);
+        writeJsonStats(std::cout, "step",      stepStats,      false);
+        writeJsonStats(std::cout, "solve",     solveStats,     false);
+        writeJsonStats(std::cout, "links",     linksStats,     true);
+        std::cout
+            << "  },\n"
+            << "  \"decompositions_per_step\": " << decompPerStep << ",\n"
+            << "  \"minor_steps_per_step\": " << minorPerStep << ",\n"
+            << "  \"adaptive_skips_per_step\": " << skipPerStep << ",\n"
+            << "  \"max_minor_steps\": " << network->netSolver.getMaxMinorStepCount() << ",\n"
+            << "  \"convergence_failures\": " << convergeFails << ",\n"
+            << "  \"checksum\": " << checksum << "\n"
+            << "}" << std::endl;
+    } else {
+        std::cout << "network,topology,nodes,links,edges,nonlinear_edges,blocks,density,nonlinear,"
+                     "island_mode,dither,adaptive,seed,dt,warmup,steps,init_s";
+        const char* phases[] = {"stimulate", "step", "solve", "links"};
+        const char* fields[] = {"mean", "min", "max", "p50", "p95", "total"};
+        for (int p = 0; p < 4; ++p) {
+            for (int f = 0; f < 6; ++f) {
+                std::cout << "," << phases[p] << "_" << fields[f] << "_s";
+            }
+        }
+        std::cout << ",decompositions_per_step,minor_steps_per_step,adaptive_skips_per_step,"
+                     "max_minor_steps,convergence_failures,checksum\n";
+        std::cout << opts.network << "," << opts.topology << "," << network->getNumNodes() << ","
+                  << network->getNumLinks() << "," << topology.mEdges.size() << ","
+                  << topology.getNumNonLinearEdges() << "," << topology.getNumBlocks() << ","
+                  << opts.density << "," << opts.nonLinear << "," << opts.islandMode << ","
+                  << (opts.dither ? 1 : 0) << "," << opts.adaptive << "," << opts.seed << "," << opts.dt << ","
+                  << opts.warmup << "," << opts.steps << "," << initTime;
+        const Stats* stats[] = {&stimulateStats, &stepStats, &solveStats, &linksStats};
+        for (int p = 0; p < 4; ++p) {
+            std::cout << "," << stats[p]->mean << "," << stats[p]->min << "," << stats[p]->max
+                      << "," << stats[p]->p50  << "," << stats[p]->p95 << "," << stats[p]->total;
+        }
+        std::cout << "," << decompPerStep << "," << minorPerStep << "," << skipPerStep << ","
+                  << network->netSolver.getMaxMinorStepCount() << "," << convergeFails << ","
+                  << checksum << std::endl;
+    }
+
+    delete network;
+    return 0;
+}
@@ -0,0 +1,863 @@
+/*
+ * @copyright Copyright 2026 United States Government as represented by the Administrator of the
+ *            National Aeronautics and Space Administration.  All Rights Reserved.
+ *
+ * Trick-less GUNNS vehicle regression harness.  Runs the example space vehicle, Harvey and Brayton
+ * networks exported from their GunnsDraw drawings through a fixed, deterministic scenario, and
+ * reports per-network wall-clock step timing, heap allocation counts, solver statistics and final
+ * state checksums in JSON or CSV.  The checksums can be written to and checked against a reference
+ * file, so that performance and correctness regressions are caught by the same run.  Run with
+ * --help for the options.
+ *
+ * With --snapshot-check, each scenario's networks are also saved to in-memory snapshots at the given
+ * step, and after the run are restored from them and re-run to the end, to check that the restored
+ * run reproduces the same checksums exactly.
+ *
+ * The networks are coupled the way their Trick sims couple them: Harvey with the data transfer jobs
+ * in SIM_harvey/S_define, and the vehicle & Brayton with the heat exchanger, cold plate, radiator,
+ * fan and pump thermal interfaces from sims/icd, done here as direct calls between the links
+ * instead of through the simbus.  The vehicle's signal aspect and its electrical, fan & pump
+ * controller interfaces are not modeled, so its valves are driven by a scripted schedule instead.
+ */
+
+#include "ClosedBraytonCycleFluid.hh"
+#include "ClosedBraytonCycleHx.hh"
+#include "ExampleCabinFluid.hh"
+#include "ExampleCoolantLoopFluid.hh"
+#include "ExampleHxThermal.hh"
+#include "ExamplePassiveThermal.hh"
+#include "ExamplePowerElect.hh"
+#include "HarveyFluid.hh"
+#include "HarveySignal.hh"
+#include "HarveyThermal.hh"
+#include "core/GunnsInfraFunctions.hh"
+#include "core/GunnsSnapshot.hh"
+#include "simulation/hs/TsHsMngr.hh"
+#include "software/exceptions/TsBaseException.hh"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/// - Heap allocation counters, incremented by the global operator new replacements below.
+static unsigned long long gAllocCount = 0;
+static unsigned long long gAllocBytes = 0;
+
+static void* countedAlloc(const std::size_t size)
+{
+    ++gAllocCount;
+    gAllocBytes += size;
+    void* ptr = std::malloc(size ? size : 1);
+    if (not ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new(std::size_t size)                   { return countedAlloc(size); }
+void* operator new[](std::size_t size)                 { return countedAlloc(size); }
+void  operator delete(void* ptr) noexcept              { std::free(ptr); }
+void  operator delete[](void* ptr) noexcept            { std::free(ptr); }
+void  operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void  operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+/// @brief  H&S manager that counts the messages by severity, and echoes warnings & worse to stderr,
+///         so that a network that fails to initialize or step is not silently ignored.
+class RegressionHsMngr : public TsHsMngr
+{
+    public:
+        unsigned long long mCount[TS_HS_FATAL + 1];
+        bool               mEcho;
+        RegressionHsMngr() : TsHsMngr(), mCount(), mEcho(true) {}
+        virtual void restart() {}
+        virtual void update() {}
+        virtual void shutdown() {}
+        virtual void msg(const std::string& file, const int line, const std::string& function,
+                         TS_HS_MSG_TYPE type, const std::string& subsys, const std::string& mtext)
+        {
+            (void) file; (void) line; (void) function;
+            ++mCount[type];
+            if (mEcho and type >= TS_HS_WARNING) {
+                static const char* names[] = {"DEBUG", "INFO", "WARNING", "ERROR", "FATAL"};
+                std::cerr << names[type] << " " << subsys << ": " << mtext << std::endl;
+            }
+        }
+};
+
+/// @brief  Harness run options, with their defaults.
+struct Options {
+    std::string scenario;
+    int         steps;
+    double      dt;
+    std::string format;
+    std::string reference;
+    std::string writeReference;
+    double      tolerance;
+    std::string trace;
+    int         snapshotCheck;
+    Options()
+        : scenario("all"), steps(600), dt(0.1), format("json"), reference(""), writeReference(""),
+          tolerance(1.0E-6), trace(""), snapshotCheck(-1) {}
+};
+
+/// @brief  Summary statistics of a network's step times.
+struct Stats {
+    double mean, min, max, p50, p95, total;
+};
+
+/// @brief  Returns a checksum of the network's node states: the index-weighted sum of the node
+///         potentials, plus the fluid temperatures and masses of fluid nodes.
+template <class T>
+static double networkChecksum(GunnsNetworkBase& base)
+{
+    T& network = static_cast<T&>(base);
+    double sum = 0.0;
+    for (int i = 0; i < T::N_NODES; ++i) {
+        const double weight = i + 1.0;
+        sum += weight * network.netNodes[i].getPotential();
+        PolyFluid* fluid = network.netNodes[i].getContent();
+        if (fluid) {
+            sum += weight * (fluid->getTemperature() + network.netNodes[i].getMass());
+        }
+    }
+    return sum;
+}
+
+/// @brief  A network under test, with its step timing and solver counter baselines.
+struct Tracked {
+    std::string         mName;
+    GunnsNetworkBase*   mNetwork;
+    double            (*mChecksum)(GunnsNetworkBase&);
+    int                 mDivisor;
+    std::vector<double> mStepTime;
+    int                 mDecompStart;
+    int                 mMinorStart;
+    int                 mFailStart;
+    GunnsSnapshot*      mSnapshot;
+};
+
+/// @brief  Base class for a regression scenario: a set of coupled networks stepped in a fixed
+///         order with deterministic inputs.
+class Scenario
+{
+    public:
+        std::string          mName;
+        std::vector<Tracked> mNetworks;
+        Scenario(const std::string& name)
+            : mName(name), mNetworks(), mTime(0.0), mStep(0), mSnapshot(name) {}
+        virtual ~Scenario()
+        {
+            for (unsigned int i = 0; i < mNetworks.size(); ++i) {
+                delete mNetworks[i].mSnapshot;
+            }
+        }
+        /// @brief  Initializes the networks and registers them for tracking.
+        virtual void initialize() = 0;
+        /// @brief  Applies the scenario inputs and updates the networks for one base step.
+        virtual void step(const double dt) = 0;
+        /// @brief  Records the solver counter baselines at the start of the timed steps.
+        void startCounters()
+        {
+            for (unsigned int i = 0; i < mNetworks.size(); ++i) {
+                Tracked& tracked    = mNetworks[i];
+                tracked.mDecompStart = tracked.mNetwork->netSolver.getDecompositionCount();
+                tracked.mMinorStart  = tracked.mNetwork->netSolver.getMinorStepCount();
+                tracked.mFailStart   = tracked.mNetwork->netSolver.getConvergenceFailCount();
+            }
+        }
+        /// @brief  Saves or restores the scenario's own state that the networks don't hold, and
+        ///         returns false if the scenario has state outside the networks that can't be.
+        virtual bool snapshotState(GunnsSnapshot& snapshot)
+        {
+            snapshot.sync(mTime);
+            snapshot.sync(mStep);
+            return true;
+        }
+        /// @brief  Saves the networks and scenario state to snapshots, which includes the
+        ///         decomposed admittance matrices so the restored run does exactly the same math.
+        void saveSnapshots()
+        {
+            for (unsigned int i = 0; i < mNetworks.size(); ++i) {
+                Tracked& tracked = mNetworks[i];
+                if (not tracked.mSnapshot) {
+                    tracked.mSnapshot = new GunnsSnapshot(mName + "." + tracked.mName, true);
+                }
+                tracked.mNetwork->saveSnapshot(*tracked.mSnapshot);
+            }
+            mSnapshot.beginSave();
+            snapshotState(mSnapshot);
+            mSnapshot.end();
+        }
+        /// @brief  Restores the networks and scenario state from the saved snapshots.
+        void restoreSnapshots()
+        {
+            for (unsigned int i = 0; i < mNetworks.size(); ++i) {
+                mNetworks[i].mNetwork->restoreSnapshot(*mNetworks[i].mSnapshot);
+            }
+            mSnapshot.beginRestore();
+            snapshotState(mSnapshot);
+            mSnapshot.end();
+        }
+        /// @brief  Returns the total size of the saved network snapshots.
+        std::size_t getSnapshotSize() const
+        {
+            std::size_t size = 0;
+            for (unsigned int i = 0; i < mNetworks.size(); ++i) {
+                if (mNetworks[i].mSnapshot) {
+                    size += mNetworks[i].mSnapshot->getSize();
+                }
+            }
+            return size;
+        }
+        /// @brief  Advances the base step count and scenario time.
+        void advance(const double dt)
+        {
+            ++mStep;
+            mTime += dt;
+        }
+
+    protected:
+        double        mTime;
+        int           mStep;
+        GunnsSnapshot mSnapshot;
+        /// @brief  Registers a network for tracking, updated every divisor base steps.
+        template <class T>
+        void track(const std::string& name, T& network, const int divisor = 1)
+        {
+            Tracked tracked = {name, &network, &networkChecksum<T>, divisor,
+                               std::vector<double>(), 0, 0, 0, 0};
+            mNetworks.push_back(tracked);
+        }
+        /// @brief  Updates the given tracked network if it is due this step, and times the update.
+        void update(const unsigned int index, const double dt)
+        {
+            Tracked& tracked = mNetworks[index];
+            if (0 == mStep % tracked.mDivisor) {
+                const double start = GunnsInfraFunctions::clockTime();
+                tracked.mNetwork->update(dt * tracked.mDivisor);
+                tracked.mStepTime.push_back(GunnsInfraFunctions::clockTime() - start);
+            }
+        }
+
+    private:
+        Scenario(const Scenario&);
+        Scenario& operator =(const Scenario&);
+};
+
+/// @brief  The example space vehicle, as in S_modules/ExampleSpaceVehicle.sm with the setup of
+///         SIM_example_space_vehicle/RUN_test, and the thermal interfaces of
+///         icd/EXAMPLE_SPACE_VEHICLE.txt.  The passive thermal network runs at 1 Hz.
+class VehicleScenario : public Scenario
+{
+    public:
+        ExamplePowerElect       powerElect;
+        ExamplePassiveThermal   passiveThermal;
+        ExampleHxThermal        hxThermal;
+        ExampleCabinFluid       cabinFluid;
+        ExampleCoolantLoopFluid coolantLoopFluid;
+        VehicleScenario()
+            : Scenario("vehicle"),
+              powerElect("vehicle.powerElect"),
+              passiveThermal("vehicle.passiveThermal"),
+              hxThermal("vehicle.hxThermal"),
+              cabinFluid("vehicle.cabinFluid"),
+              coolantLoopFluid("vehicle.coolantLoopFluid"),
+              mBoilerStarted(false) {}
+        virtual void initialize()
+        {
+            /// - RUN_test input file setup.
+            cabinFluid.netConfig.scrubbers.addCompound(ChemicalCompound::CO2, 10.0, 0.095, 0.0,
+                                                       0.0, 0.0, -189.9);
+            cabinFluid.netConfig.scrubbers.addCompound(ChemicalCompound::H2O, 10.0, 0.065, 0.0,
+                                                       0.0, 0.0, -200.0);
+            cabinFluid.netInput.tcv.mPosition                = 0.15;
+            cabinFluid.netInput.gasSelectValve.mPosition     = 1.0;
+            cabinFluid.netInput.cabinLeak.mMalfLeakHoleFlag  = true;
+            cabinFluid.netInput.cabinLeak.mMalfLeakHoleValue = 2.8e-10;
+            coolantLoopFluid.netInput.nh3ControlVlv.mPosition = 0.0;
+            powerElect.loadSwitch3.addUserLoad(&powerElect.fwdShellHeater);
+            powerElect.loadSwitch4.addUserLoad(&powerElect.aftShellHeater);
+            powerElect.loadSwitch5.addUserLoad(&powerElect.cabinFan);
+            powerElect.loadSwitch6.addUserLoad(&powerElect.pump);
+            powerElect.loadSwitch7.addUserLoad(&powerElect.tcv);
+            powerElect.loadSwitch8.addUserLoad(&powerElect.radBypassVlv);
+            powerElect.loadSwitch9.addUserLoad(&powerElect.gasSelectValve);
+
+            powerElect.initialize();
+            passiveThermal.initialize();
+            hxThermal.initialize();
+            cabinFluid.initialize();
+            coolantLoopFluid.initialize();
+            hxThermal.netSolver.setDummyMode();
+            track("powerElect",       powerElect);
+            track("passiveThermal",   passiveThermal, 10);
+            track("hxThermal",        hxThermal);
+            track("cabinFluid",       cabinFluid);
+            track("coolantLoopFluid", coolantLoopFluid);
+        }
+        virtual void step(const double dt)
+        {
+            /// - RUN_test timed events: solar array absorbed heat and ammonia boiler start.
+            if (not mBoilerStarted and mTime >= 1.0) {
+                mBoilerStarted = true;
+                passiveThermal.solarArray.setExternalHeatFlux(1, 1825.0);
+                coolantLoopFluid.nh3ControlVlv.setPosition(1.0);
+            }
+
+            /// - Scripted valve commands in place of the signal aspect's controllers, including
+            ///   switching the gas select valve from N2 to O2.
+            cabinFluid.tcv.setPosition(0.15 + 0.05 * std::sin(0.05 * mTime));
+            cabinFluid.gasSelectValve.setPosition(mTime < 30.0 ? 1.0 : 0.0);
+            coolantLoopFluid.radBypassVlv.setPosition(0.2 + 0.2 * std::sin(0.02 * mTime));
+
+            update(0, dt);
+            update(1, dt);
+            update(2, dt);
+
+            /// - Thermal to fluid: wall & segment temperatures.
+            GunnsThermalCapacitor* chxSeg[] = {&hxThermal.chxSeg0, &hxThermal.chxSeg1,
+                                               &hxThermal.chxSeg2, &hxThermal.chxSeg3,
+                                               &hxThermal.chxSeg4, &hxThermal.chxSeg5,
+                                               &hxThermal.chxSeg6, &hxThermal.chxSeg7,
+                                               &hxThermal.chxSeg8, &hxThermal.chxSeg9};
+            const int numChxSegs = sizeof(chxSeg) / sizeof(chxSeg[0]);
+            for (int i = 0; i < numChxSegs; ++i) {
+                coolantLoopFluid.chx.setSegTemperature(i, chxSeg[i]->getTemperature());
+                cabinFluid.chx.setSegTemperature(numChxSegs - 1 - i, chxSeg[i]->getTemperature());
+            }
+            coolantLoopFluid.nh3BoilerHx.setSegTemperature(0, hxThermal.absSeg0.getTemperature());
+            coolantLoopFluid.nh3BoilerSpray.setWallTemperature(hxThermal.absSeg0.getTemperature());
+            coolantLoopFluid.coldplate.setSegTemperature(0, passiveThermal.coldplate.getTemperature());
+            coolantLoopFluid.radiator.setSegTemperature(0, passiveThermal.radiator.getTemperature());
+            coolantLoopFluid.pump.setWallTemperature(passiveThermal.pump.getTemperature());
+            cabinFluid.cabinFan.setWallTemperature(passiveThermal.cabinFan.getTemperature());
+
+            update(3, dt);
+            update(4, dt);
+
+            /// - Fluid to thermal: heat fluxes.
+            for (int i = 0; i < numChxSegs; ++i) {
+                chxSeg[i]->setExternalHeatFlux(0, coolantLoopFluid.chx.getSegEnergyGain(i));
+                chxSeg[i]->setExternalHeatFlux(1, cabinFluid.chx.getSegEnergyGain(numChxSegs - 1 - i));
+            }
+            hxThermal.absSeg0.setExternalHeatFlux(0, coolantLoopFluid.nh3BoilerSpray.getWallHeatFlux());
+            hxThermal.absSeg0.setExternalHeatFlux(1, coolantLoopFluid.nh3BoilerHx.getSegEnergyGain(0));
+            passiveThermal.coldplate.setExternalHeatFlux(0, coolantLoopFluid.coldplate.getSegEnergyGain(0));
+            passiveThermal.radiator.setExternalHeatFlux(0, coolantLoopFluid.radiator.getSegEnergyGain(0));
+            passiveThermal.pump.setExternalHeatFlux(0, coolantLoopFluid.pump.getWallHeatFlux());
+            passiveThermal.cabinFan.setExternalHeatFlux(0, cabinFluid.cabinFan.getWallHeatFlux());
+        }
+
+        virtual bool snapshotState(GunnsSnapshot& snapshot)
+        {
+            snapshot.sync(mBoilerStarted);
+            return Scenario::snapshotState(snapshot);
+        }
+
+    private:
+        bool mBoilerStarted;
+};
+
+/// @brief  Harvey, with the setup of SIM_harvey/RUN_test and the data transfer jobs of its S_define.
+class HarveyScenario : public Scenario
+{
+    public:
+        ExamplePowerElect elect;
+        HarveySignal      signal;
+        HarveyFluid       fluid;
+        HarveyThermal     thermal;
+        HarveyScenario()
+            : Scenario("harvey"),
+              elect("harvey.elect"),
+              signal(),
+              fluid("harvey.fluid"),
+              thermal("harvey.thermal") {}
+        virtual void initialize()
+        {
+            /// - RUN_test input file setup.
+            elect.netInput.loadSwitch6.mSwitch.mSwitchIsAutoClosed = false;
+
+            elect.initialize();
+            signal.initialize();
+            fluid.initialize();
+            thermal.initialize();
+            track("elect",   elect);
+            track("fluid",   fluid);
+            track("thermal", thermal);
+        }
+        virtual void step(const double dt)
+        {
+            /// - Scripted crew command to close the pump's load switch, which RUN_test leaves open.
+            elect.loadSwitch6.mSwitch.setSwitchCommandedClosed(mTime >= 5.0);
+
+            update(0, dt);
+            signal.pc.setVoltage(elect.loadSwitch6.mSwitch.getOutputVolts());
+            signal.update(dt);
+            fluid.pump.setMotorSpeed(signal.pc.getMotorSpeed());
+            fluid.coldplate.setSegTemperature(0, thermal.coldplate.getTemperature());
+            update(1, dt);
+            thermal.avionics.setExternalHeatFlux(0, elect.constantPowerLoad.getPowerDraw());
+            thermal.coldplate.setExternalHeatFlux(0, fluid.coldplate.getTotalEnergyGain());
+            update(2, dt);
+        }
+        /// - The signal aspect's pump motor controller is not a GUNNS object and has no snapshot.
+        virtual bool snapshotState(GunnsSnapshot& snapshot)
+        {
+            (void) snapshot;
+            return false;
+        }
+};
+
+/// @brief  The closed Brayton cycle, as in S_modules/ClosedBraytonCycle.sm with the setup of
+///         SIM_brayton/RUN_test, and the heat exchanger interfaces of icd/BRAYTON_ICD.txt.
+class BraytonScenario : public Scenario
+{
+    public:
+        ClosedBraytonCycleHx    hx;
+        ClosedBraytonCycleFluid fluid;
+        BraytonScenario()
+            : Scenario("brayton"),
+              hx("brayton.hx"),
+              fluid("brayton.fluid") {}
+        virtual void initialize()
+        {
+            /// - RUN_test input file setup.
+            fluid.driveShaft.addImpeller(&fluid.compressor);
+            fluid.driveShaft.addImpeller(&fluid.turbine);
+
+            hx.initialize();
+            fluid.initialize();
+            track("hx",    hx);
+            track("fluid", fluid);
+        }
+        virtual void step(const double dt)
+        {
+            GunnsThermalCapacitor* recupSeg[] = {&hx.hxRecupSeg0, &hx.hxRecupSeg1, &hx.hxRecupSeg2,
+                                                 &hx.hxRecupSeg3, &hx.hxRecupSeg4, &hx.hxRecupSeg5,
+                                                 &hx.hxRecupSeg6, &hx.hxRecupSeg7, &hx.hxRecupSeg8,
+                                                 &hx.hxRecupSeg9};
+            const int numRecupSegs = sizeof(recupSeg) / sizeof(recupSeg[0]);
+
+            update(0, dt);
+            for (int i = 0; i < numRecupSegs; ++i) {
+                fluid.hxRecupLowT.setSegTemperature(i, recupSeg[i]->getTemperature());
+                fluid.hxRecupHighT.setSegTemperature(numRecupSegs - 1 - i, recupSeg[i]->getTemperature());
+            }
+            fluid.hxWithReactor.setSegTemperature(0, hx.hxWithReactorSeg0.getTemperature());
+            update(1, dt);
+            for (int i = 0; i < numRecupSegs; ++i) {
+                recupSeg[i]->setExternalHeatFlux(0, fluid.hxRecupLowT.getSegEnergyGain(i));
+                recupSeg[i]->setExternalHeatFlux(1, fluid.hxRecupHighT.getSegEnergyGain(numRecupSegs - 1 - i));
+            }
+        }
+};
+
+/// @brief  Results of a scenario run, per network.
+struct Result {
+    std::string        mScenario;
+    std::string        mNetwork;
+    int                mUpdates;
+    Stats              mStats;
+    double             mDecompPerUpdate;
+    double             mMinorPerUpdate;
+    int                mConvergenceFails;
+    double             mChecksum;
+};
+
+static void usage(const char* program)
+{
+    std::cout
+        << "Usage: " << program << " [options]\n"
+        << "  --scenario all|vehicle|harvey|brayton  scenario to run (all)\n"
+        << "  --steps N            number of base steps (600)\n"
+        << "  --dt S               base time step, seconds (0.1)\n"
+        << "  --format json|csv    summary output format (json)\n"
+        << "  --reference FILE     check the final checksums against FILE, and exit with 2 if\n"
+        << "                       any differs by more than the tolerance\n"
+        << "  --write-reference FILE  write the final checksums to FILE\n"
+        << "  --tolerance T        relative checksum tolerance (1e-6)\n"
+        << "  --trace FILE         also write per-step network update times to FILE as CSV\n"
+        << "  --snapshot-check K   snapshot the networks at step K, then restore and re-run them\n"
+        << "                       from K, and exit with 3 if the checksums aren't identical\n";
+}
+
+static bool parseArgs(int argc, char** argv, Options& opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = (i + 1 < argc);
+        if ("--help" == arg or "-h" == arg) {
+            return false;
+        } else if (not hasValue) {
+            std::cerr << "missing value for option: " << arg << std::endl;
+            return false;
+        } else if ("--scenario"        == arg) { opts.scenario       = argv[++i];
+        } else if ("--steps"           == arg) { opts.steps          = std::atoi(argv[++i]);
+        } else if ("--dt"              == arg) { opts.dt             = std::atof(argv[++i]);
+        } else if ("--format"          == arg) { opts.format         = argv[++i];
+        } else if ("--reference"       == arg) { opts.reference      = argv[++i];
+        } else if ("--write-reference" == arg) { opts.writeReference = argv[++i];
+        } else if ("--tolerance"       == arg) { opts.tolerance      = std::atof(argv[++i]);
+        } else if ("--trace"           == arg) { opts.trace          = argv[++i];
+        } else if ("--snapshot-check"  == arg) { opts.snapshotCheck  = std::atoi(argv[++i]);
+        } else {
+            std::cerr << "unknown option: " << arg << std::endl;
+            return false;
+        }
+    }
+    if (opts.steps < 1 or opts.dt <= 0.0 or opts.tolerance < 0.0) {
+        std::cerr << "steps must be > 0, dt > 0 and tolerance >= 0." << std::endl;
+        return false;
+    }
+    if (opts.snapshotCheck >= opts.steps) {
+        std::cerr << "snapshot-check step must be < steps." << std::endl;
+        return false;
+    }
+    if ("json" != opts.format and "csv" != opts.format) {
+        std::cerr << "unknown format: " << opts.format << std::endl;
+        return false;
+    }
+    if ("all" != opts.scenario and "vehicle" != opts.scenario and "harvey" != opts.scenario
+            and "brayton" != opts.scenario) {
+        std::cerr << "unknown scenario: " << opts.scenario << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static Stats computeStats(std::vector<double> samples)
+{
+    Stats stats = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    if (samples.empty()) {
+        return stats;
+    }
+    std::sort(samples.begin(), samples.end());
+    const size_t n = samples.size();
+    for (size_t i = 0; i < n; ++i) {
+        stats.total += samples[i];
+    }
+    stats.mean = stats.total / n;
+    stats.min  = samples.front();
+    stats.max  = samples.back();
+    stats.p50  = samples[(n - 1) / 2];
+    stats.p95  = samples[std::min(n - 1, static_cast<size_t>(0.95 * n))];
+    return stats;
+}
+
+/// @brief  Reads "scenario.network checksum" lines from a reference file.
+static bool readReference(const std::string& fileName, std::map<std::string, double>& reference)
+{
+    std::ifstream file(fileName.c_str());
+    if (not file) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() or '#' == line[0]) {
+            continue;
+        }
+        std::istringstream fields(line);
+        std::string key;
+        double      value;
+        if (fields >> key >> value) {
+            reference[key] = value;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    Options opts;
+    if (not parseArgs(argc, argv, opts)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    /// - Use a real clock for the step timing and the solvers' internal timers.
+    GunnsInfraFunctions::mUseWallClock = true;
+
+    /// - Count & echo the networks' H&S messages.
+    RegressionHsMngr hsMngr;
+    hsMngr.init();
+
+    std::vector<Scenario*> scenarios;
+    if ("all" == opts.scenario or "vehicle" == opts.scenario) scenarios.push_back(new VehicleScenario());
+    if ("all" == opts.scenario or "harvey"  == opts.scenario) scenarios.push_back(new HarveyScenario());
+    if ("all" == opts.scenario or "brayton" == opts.scenario) scenarios.push_back(new BraytonScenario());
+
+    std::vector<Result>             results;
+    std::vector<unsigned long long> initAllocs(scenarios.size());
+    std::vector<unsigned long long> initBytes(scenarios.size());
+    std::vector<unsigned long long> stepAllocs(scenarios.size());
+    std::vector<unsigned long long> stepBytes(scenarios.size());
+    std::vector<double>             initTime(scenarios.size());
+    std::vector<std::string>        snapshotCheck(scenarios.size(), "off");
+    std::vector<std::size_t>        snapshotBytes(scenarios.size());
+    std::vector<double>             snapshotSaveTime(scenarios.size());
+    std::vector<double>             snapshotRestoreTime(scenarios.size());
+    std::vector<std::string>        snapshotMismatches;
+    int status = 0;
+
+    for (unsigned int s = 0; s < scenarios.size(); ++s) {
+        Scenario& scenario = *scenarios[s];
+        try {
+            const unsigned long long allocs = gAllocCount;
+            const unsigned long long bytes  = gAllocBytes;
+            const double start = GunnsInfraFunctions::clockTime();
+            scenario.initialize();
+            initTime[s]   = GunnsInfraFunctions::clockTime() - start;
+            initAllocs[s] = gAllocCount - allocs;
+            initBytes[s]  = gAllocBytes - bytes;
+        } catch (TsBaseException& e) {
+            std::cerr << scenario.mName << " initialization failed: " << e.getMessage() << ": "
+                      << e.getCause() << std::endl;
+            status = 1;
+            break;
+        }
+
+        /// - Reserve the timing samples up front so that their growth is not counted as step
+        ///   allocations.
+        for (unsigned int n = 0; n < scenario.mNetworks.size(); ++n) {
+            scenario.mNetworks[n].mStepTime.reserve(opts.steps);
+        }
+        /// - Scenarios with state outside of their networks, or with links that don't support
+        ///   snapshots, can't be snapshot.
+        bool snapshotting = (opts.snapshotCheck >= 0);
+        if (snapshotting) {
+            GunnsSnapshot probe;
+            probe.beginSave();
+            snapshotting = scenario.snapshotState(probe);
+            probe.abort();
+            for (unsigned int n = 0; n < scenario.mNetworks.size(); ++n) {
+                snapshotting = snapshotting
+                           and scenario.mNetworks[n].mNetwork->netSolver.isSnapshotSupported();
+            }
+            if (not snapshotting) {
+                snapshotCheck[s] = "unsupported";
+            }
+        }
+        scenario.startCounters();
+        const unsigned long long allocs = gAllocCount;
+        const unsigned long long bytes  = gAllocBytes;
+        unsigned long long saveAllocs = 0;
+        unsigned long long saveBytes  = 0;
+        for (int i = 0; i < opts.steps; ++i) {
+            if (snapshotting and i == opts.snapshotCheck) {
+                /// - The snapshot buffers' first growth isn't counted as step allocations.
+                const unsigned long long saveStartAllocs = gAllocCount;
+                const unsigned long long saveStartBytes  = gAllocBytes;
+                const double start = GunnsInfraFunctions::clockTime();
+                scenario.saveSnapshots();
+                snapshotSaveTime[s] = GunnsInfraFunctions::clockTime() - start;
+                snapshotBytes[s]    = scenario.getSnapshotSize();
+                saveAllocs          = gAllocCount - saveStartAllocs;
+                saveBytes           = gAllocBytes - saveStartBytes;
+            }
+            scenario.step(opts.dt);
+            scenario.advance(opts.dt);
+        }
+        stepAllocs[s] = gAllocCount - allocs - saveAllocs;
+        stepBytes[s]  = gAllocBytes - bytes  - saveBytes;
+
+        for (unsigned int n = 0; n < scenario.mNetworks.size(); ++n) {
+            Tracked& tracked = scenario.mNetworks[n];
+            const Gunns& solver = tracked.mNetwork->netSolver;
+            const int updates = static_cast<int>(tracked.mStepTime.size());
+            Result result;
+            result.mScenario         = scenario.mName;
+            result.mNetwork          = tracked.mName;
+            result.mUpdates          = updates;
+            result.mStats            = computeStats(tracked.mStepTime);
+            result.mDecompPerUpdate  = double(solver.getDecompositionCount() - tracked.mDecompStart)
+                                     / std::max(1, updates);
+            result.mMinorPerUpdate   = double(solver.getMinorStepCount() - tracked.mMinorStart)
+                                     / std::max(1, updates);
+            result.mConvergenceFails = solver.getConvergenceFailCount() - tracked.mFailStart;
+            result.mChecksum         = tracked.mChecksum(*tracked.mNetwork);
+            results.push_back(result);
+        }
+
+        /// - Restore the snapshots and re-run from the snapshot step, which must reproduce the
+        ///   checksums exactly.  The re-run's step times are discarded.
+        if (snapshotting) {
+            std::vector<std::size_t> updates(scenario.mNetworks.size());
+            for (unsigned int n = 0; n < scenario.mNetworks.size(); ++n) {
+                updates[n] = scenario.mNetworks[n].mStepTime.size();
+            }
+            const double start = GunnsInfraFunctions::clockTime();
+            scenario.restoreSnapshots();
+            snapshotRestoreTime[s] = GunnsInfraFunctions::clockTime() - start;
+            for (int i = opts.snapshotCheck; i < opts.steps; ++i) {
+                scenario.step(opts.dt);
+                scenario.advance(opts.dt);
+            }
+            snapshotCheck[s] = "pass";
+            const unsigned int first = results.size() - scenario.mNetworks.size();
+            for (unsigned int n = 0; n < scenario.mNetworks.size(); ++n) {
+                Tracked& tracked = scenario.mNetworks[n];
+                tracked.mStepTime.resize(updates[n]);
+                const double checksum = tracked.mChecksum(*tracked.mNetwork);
+                if (checksum != results[first + n].mChecksum) {
+                    std::ostringstream msg;
+                    msg << std::setprecision(17) << scenario.mName << "." << tracked.mName
+                        << " (expected " << results[first + n].mChecksum << ", got " << checksum
+                        << ")";
+                    snapshotMismatches.push_back(msg.str());
+                    snapshotCheck[s] = "fail";
+                }
+            }
+        }
+    }
+    if (not snapshotMismatches.empty() and 0 == status) {
+        status = 3;
+    }
+
+    /// - Optional per-step trace.
+    if (not opts.trace.empty()) {
+        std::ofstream trace(opts.trace.c_str());
+        trace << std::setprecision(9) << "scenario,network,update,step_s\n";
+        for (unsigned int s = 0; s < scenarios.size(); ++s) {
+            for (unsigned int n = 0; n < scenarios[s]->mNetworks.size(); ++n) {
+                const Tracked& tracked = scenarios[s]->mNetworks[n];
+                for (unsigned int i = 0; i < tracked.mStepTime.size(); ++i) {
+                    trace << scenarios[s]->mName << "," << tracked.mName << "," << i << ","
+                          << tracked.mStepTime[i] << "\n";
+                }
+            }
+        }
+    }
+
+    /// - Reference checksums.
+    if (not opts.writeReference.empty()) {
+        std::ofstream file(opts.writeReference.c_str());
+        file << "# scenario.network final state checksum, " << opts.steps << " steps of "
+             << opts.dt << " s\n" << std::setprecision(17);
+        for (unsigned int r = 0; r < results.size(); ++r) {
+            file << results[r].mScenario << "." << results[r].mNetwork << " "
+                 << results[r].mChecksum << "\n";
+        }
+    }
+    std::vector<std::string> mismatches;
+    if (not opts.reference.empty()) {
+        std::map<std::string, double> reference;
+        if (not readReference(opts.reference, reference)) {
+            std::cerr << "cannot read reference file: " << opts.reference << std::endl;
+            status = 1;
+        }
+        for (unsigned int r = 0; r < results.size(); ++r) {
+            const std::string key = results[r].mScenario + "." + results[r].mNetwork;
+            std::map<std::string, double>::const_iterator it = reference.find(key);
+            if (reference.end() == it) {
+                mismatches.push_back(key + " (missing)");
+            } else {
+                const double scale = std::max(1.0, std::fabs(it->second));
+                if (not (std::fabs(results[r].mChecksum - it->second) <= opts.tolerance * scale)) {
+                    std::ostringstream msg;
+                    msg << std::setprecision(17) << key << " (expected " << it->second
+                        << ", got " << results[r].mChecksum << ")";
+                    mismatches.push_back(msg.str());
+                }
+            }
+        }
+        if (not mismatches.empty() and 0 == status) {
+            status = 2;
+        }
+    }
+
+    /// - Summary.
+    std::cout << std::setprecision(9);
+    if ("json" == opts.format) {
+        std::cout << "{\n"
+                  << "  \"steps\": " << opts.steps << ",\n"
+                  << "  \"dt\": " << opts.dt << ",\n"
+                  << "  \"hs_warnings\": " << hsMngr.mCount[TS_HS_WARNING] << ",\n"
+                  << "  \"hs_errors\": " << hsMngr.mCount[TS_HS_ERROR] + hsMngr.mCount[TS_HS_FATAL]
+                  << ",\n"
+                  << "  \"scenarios\": [\n";
+        for (unsigned int s = 0; s < scenarios.size(); ++s) {
+            std::cout << "    {\"scenario\": \"" << scenarios[s]->mName << "\", \"init_s\": "
+                      << initTime[s] << ", \"init_allocs\": " << initAllocs[s]
+                      << ", \"init_alloc_bytes\": " << initBytes[s] << ", \"step_allocs\": "
+                      << stepAllocs[s] << ", \"step_alloc_bytes\": " << stepBytes[s];
+            if (opts.snapshotCheck >= 0) {
+                std::cout << ", \"snapshot_check\": \"" << snapshotCheck[s]
+                          << "\", \"snapshot_bytes\": " << snapshotBytes[s]
+                          << ", \"snapshot_save_s\": " << snapshotSaveTime[s]
+                          << ", \"snapshot_restore_s\": " << snapshotRestoreTime[s];
+            }
+            std::cout << "}"
+                      << (s + 1 < scenarios.size() ? ",\n" : "\n");
+        }
+        std::cout << "  ],\n"
+                  << "  \"networks\": [\n";
+        for (unsigned int r = 0; r < results.size(); ++r) {
+            const Result& res = results[r];
+            std::cout << "    {\"scenario\": \"" << res.mScenario << "\", \"network\": \""
+                      << res.mNetwork << "\", \"updates\": " << res.mUpdates
+                      << ", \"step_s\": {\"mean\": " << res.mStats.mean << ", \"min\": "
+                      << res.mStats.min << ", \"max\": " << res.mStats.max << ", \"p50\": "
+                      << res.mStats.p50 << ", \"p95\": " << res.mStats.p95 << ", \"total\": "
+                      << res.mStats.total << "}, \"decompositions_per_update\": "
+                      << res.mDecompPerUpdate << ", \"minor_steps_per_update\": "
+                      << res.mMinorPerUpdate << ", \"convergence_failures\": "
+                      << res.mConvergenceFails << ", \"checksum\": " << std::setprecision(17)
+                      << res.mChecksum << std::setprecision(9) << "}"
+                      << (r + 1 < results.size() ? ",\n" : "\n");
+        }
+        std::cout << "  ],\n"
+                  << "  \"reference\": \"" << opts.reference << "\",\n"
+                  << "  \"mismatches\": [";
+        for (unsigned int m = 0; m < mismatches.size(); ++m) {
+            std::cout << (m ? ", " : "") << "\"" << mismatches[m] << "\"";
+        }
+        std::cout << "]";
+        if (opts.snapshotCheck >= 0) {
+            std::cout << ",\n  \"snapshot_step\": " << opts.snapshotCheck << ",\n"
+                      << "  \"snapshot_mismatches\": [";
+            for (unsigned int m = 0; m < snapshotMismatches.size(); ++m) {
+                std::cout << (m ? ", " : "") << "\"" << snapshotMismatches[m] << "\"";
+            }
+            std::cout << "]";
+        }
+        std::cout << "\n"
+                  << "}" << std::endl;
+    } else {
+        std::cout << "scenario,network,updates,step_mean_s,step_min_s,step_max_s,step_p50_s,"
+                     "step_p95_s,step_total_s,decompositions_per_update,minor_steps_per_update,"
+                     "convergence_failures,checksum,scenario_init_allocs,scenario_step_allocs\n";
+        for (unsigned int r = 0; r < results.size(); ++r) {
+            const Result& res = results[r];
+            unsigned int s = 0;
+            while (scenarios[s]->mName != res.mScenario) {
+                ++s;
+            }
+            std::cout << res.mScenario << "," << res.mNetwork << "," << res.mUpdates << ","
+                      << res.mStats.mean << "," << res.mStats.min << "," << res.mStats.max << ","
+                      << res.mStats.p50 << "," << res.mStats.p95 << "," << res.mStats.total << ","
+                      << res.mDecompPerUpdate << "," << res.mMinorPerUpdate << ","
+                      << res.mConvergenceFails << "," << std::setprecision(17) << res.mChecksum
+                      << std::setprecision(9) << "," << initAllocs[s] << "," << stepAllocs[s]
+                      << "\n";
+        }
+        std::cout << std::flush;
+    }
+    for (unsigned int m = 0; m < mismatches.size(); ++m) {
+        std::cerr << "checksum mismatch: " << mismatches[m] << std::endl;
+    }
+    for (unsigned int m = 0; m < snapshotMismatches.size(); ++m) {
+        std::cerr << "snapshot checksum mismatch: " << snapshotMismatches[m] << std::endl;
+    }
+
+    for (unsigned int s = 0; s < scenarios.size(); ++s) {
+        delete scenarios[s];
+    }
+    return status;
+}
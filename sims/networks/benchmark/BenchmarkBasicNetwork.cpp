@@ -0,0 +1,145 @@
+/**
+@file
+@brief    GUNNS Benchmark Synthetic Basic Network implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((BenchmarkNetwork.o)
+   (core/GunnsBasicCapacitor.o)
+   (core/GunnsBasicConductor.o)
+   (core/GunnsBasicPotential.o)
+   (aspects/electrical/resistive/GunnsResistorPowerFunction.o))
+*/
+
+#include "BenchmarkBasicNetwork.hh"
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name   (--) Instance name for H&S messages.
+/// @param[in] dither (--) Dither the sink conductivities each step to force decompositions.
+///
+/// @details  Default constructs this Benchmark Basic Network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkBasicNetwork::BenchmarkBasicNetwork(const std::string& name, const bool dither)
+    :
+    BenchmarkNetwork(name, 1.0E-3),
+    mDither(dither),
+    mNumCond(0),
+    mNumPower(0),
+    mNumCap(0),
+    mNumBlock(0),
+    mNodes(0),
+    mCond(0),
+    mPower(0),
+    mCap(0),
+    mSource(0),
+    mSink(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Benchmark Basic Network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkBasicNetwork::~BenchmarkBasicNetwork()
+{
+    TS_DELETE_ARRAY(mSink);
+    TS_DELETE_ARRAY(mSource);
+    TS_DELETE_ARRAY(mCap);
+    TS_DELETE_ARRAY(mPower);
+    TS_DELETE_ARRAY(mCond);
+    TS_DELETE_ARRAY(mNodes);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] topology (--) The synthetic network graph.
+///
+/// @details  Allocates & initializes the interior nodes and Ground, and loads them into the solver.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkBasicNetwork::initNodes(const BenchmarkTopology& topology)
+{
+    const int numNodes = topology.getNumNodes() + 1;
+    TS_NEW_CLASS_ARRAY_EXT(mNodes, numNodes, GunnsBasicNode, (), mName + ".mNodes");
+    netNodeList.mNumNodes = numNodes;
+    netNodeList.mNodes    = mNodes;
+    for (int i = 0; i < numNodes - 1; ++i) {
+        mNodes[i].initialize(linkName("mNodes", i), 100.0);
+    }
+    mNodes[numNodes - 1].initialize(linkName("mNodes", numNodes - 1), 0.0);
+    netSolver.initializeNodes(netNodeList);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] topology (--) The synthetic network graph.
+///
+/// @details  Allocates & initializes the edge links, node capacitors, and block sources & sinks.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkBasicNetwork::initLinks(const BenchmarkTopology& topology)
+{
+    mNumPower = topology.getNumNonLinearEdges();
+    mNumCond  = static_cast<int>(topology.mEdges.size()) - mNumPower;
+    mNumCap   = topology.getNumNodes();
+    mNumBlock = topology.getNumBlocks();
+    TS_NEW_CLASS_ARRAY_EXT(mCond,   mNumCond,  GunnsBasicConductor,        (), mName + ".mCond");
+    TS_NEW_CLASS_ARRAY_EXT(mPower,  mNumPower, GunnsResistorPowerFunction, (), mName + ".mPower");
+    TS_NEW_CLASS_ARRAY_EXT(mCap,    mNumCap,   GunnsBasicCapacitor,        (), mName + ".mCap");
+    TS_NEW_CLASS_ARRAY_EXT(mSource, mNumBlock, GunnsBasicPotential,        (), mName + ".mSource");
+    TS_NEW_CLASS_ARRAY_EXT(mSink,   mNumBlock, GunnsBasicConductor,        (), mName + ".mSink");
+
+    GunnsBasicConductorConfigData        condConfig("", &netNodeList, 1.0);
+    GunnsBasicConductorInputData         condInput;
+    GunnsResistorPowerFunctionConfigData powerConfig("", &netNodeList, 1.0, 1.5, false);
+    GunnsResistorPowerFunctionInputData  powerInput;
+    GunnsBasicCapacitorConfigData        capConfig("", &netNodeList);
+    GunnsBasicCapacitorInputData         capInput(false, 0.0, 1.0, 100.0);
+    GunnsBasicPotentialConfigData        sourceConfig("", &netNodeList, 1.0);
+    GunnsBasicPotentialInputData         sourceInput(false, 0.0, 100.0);
+
+    /// - Edges.
+    int cond  = 0;
+    int power = 0;
+    for (unsigned int i = 0; i < topology.mEdges.size(); ++i) {
+        const BenchmarkTopology::Edge& edge = topology.mEdges[i];
+        if (edge.mNonLinear) {
+            powerConfig.mName = linkName("mPower", power);
+            mPower[power++].initialize(powerConfig, powerInput, netLinks, edge.mNode0, edge.mNode1);
+        } else {
+            condConfig.mName = linkName("mCond", cond);
+            mCond[cond++].initialize(condConfig, condInput, netLinks, edge.mNode0, edge.mNode1);
+        }
+    }
+
+    /// - Node capacitors.
+    for (int i = 0; i < mNumCap; ++i) {
+        capConfig.mName = linkName("mCap", i);
+        mCap[i].initialize(capConfig, capInput, netLinks, i, mGround);
+    }
+
+    /// - Block sources & sinks.
+    for (int i = 0; i < mNumBlock; ++i) {
+        sourceConfig.mName = linkName("mSource", i);
+        mSource[i].initialize(sourceConfig, sourceInput, netLinks, mGround, topology.mSources[i]);
+        condConfig.mName   = linkName("mSink", i);
+        mSink[i].initialize(condConfig, condInput, netLinks, topology.mSinks[i], mGround);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] timeStep (s) Integration time step.
+///
+/// @details  Drives each block's source potential with a sinusoid of a slightly different
+///           frequency, and when dithering, varies the sink conductivities.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkBasicNetwork::stimulate(const double timeStep)
+{
+    mTime += timeStep;
+    for (int i = 0; i < mNumBlock; ++i) {
+        const double phase = mTime * (1.0 + 0.1 * i);
+        mSource[i].setSourcePotential(100.0 + 10.0 * std::sin(phase));
+        if (mDither) {
+            mSink[i].setDefaultConductivity(1.0 + 0.1 * std::cos(phase));
+        }
+    }
+}
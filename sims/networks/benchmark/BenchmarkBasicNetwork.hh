@@ -0,0 +1,79 @@
+#ifndef BenchmarkBasicNetwork_EXISTS
+#define BenchmarkBasicNetwork_EXISTS
+
+/**
+@file
+@brief    GUNNS Benchmark Synthetic Basic Network declarations
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE: (Synthetic basic network for the Trick-less solver benchmark.)
+
+REQUIREMENTS:
+- ()
+
+REFERENCE:
+- ()
+
+ASSUMPTIONS AND LIMITATIONS:
+- ()
+
+LIBRARY DEPENDENCY:
+- ((BenchmarkBasicNetwork.o))
+
+PROGRAMMERS:
+- ()
+*/
+
+#include "BenchmarkNetwork.hh"
+#include "core/GunnsBasicCapacitor.hh"
+#include "core/GunnsBasicConductor.hh"
+#include "core/GunnsBasicPotential.hh"
+#include "aspects/electrical/resistive/GunnsResistorPowerFunction.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Benchmark Synthetic Basic Network
+///
+/// @details  Linear edges are GunnsBasicConductor and non-linear edges are
+///           GunnsResistorPowerFunction.  Every interior node has a GunnsBasicCapacitor to Ground.
+///           Each block's source node is driven by a GunnsBasicPotential from Ground with a
+///           sinusoidal source potential, and each block's sink node leaks to Ground through a
+///           GunnsBasicConductor.  When dithering, the sink conductivity varies every step, forcing
+///           a matrix decomposition every major step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class BenchmarkBasicNetwork : public BenchmarkNetwork
+{
+    public:
+        /// @brief  Default constructs this Benchmark Basic Network.
+        BenchmarkBasicNetwork(const std::string& name, const bool dither);
+        /// @brief  Default destructs this Benchmark Basic Network.
+        virtual ~BenchmarkBasicNetwork();
+        /// @brief  Changes the source potentials and, when dithering, the sink conductivities.
+        virtual void stimulate(const double timeStep);
+
+    protected:
+        bool                        mDither;   /**< (--) Dither the sink conductivities each step. */
+        int                         mNumCond;  /**< (--) Number of linear edge conductors. */
+        int                         mNumPower; /**< (--) Number of non-linear edge links. */
+        int                         mNumCap;   /**< (--) Number of node capacitors. */
+        int                         mNumBlock; /**< (--) Number of sources & sinks. */
+        GunnsBasicNode*             mNodes;    /**< (--) The network nodes. */
+        GunnsBasicConductor*        mCond;     /**< (--) Linear edge conductors. */
+        GunnsResistorPowerFunction* mPower;    /**< (--) Non-linear edge links. */
+        GunnsBasicCapacitor*        mCap;      /**< (--) Node capacitors. */
+        GunnsBasicPotential*        mSource;   /**< (--) Block sources. */
+        GunnsBasicConductor*        mSink;     /**< (--) Block sinks. */
+        /// @brief  Allocates & initializes the nodes.
+        virtual void initNodes(const BenchmarkTopology& topology);
+        /// @brief  Allocates & initializes the links.
+        virtual void initLinks(const BenchmarkTopology& topology);
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        BenchmarkBasicNetwork(const BenchmarkBasicNetwork&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        BenchmarkBasicNetwork& operator =(const BenchmarkBasicNetwork&);
+};
+
+#endif
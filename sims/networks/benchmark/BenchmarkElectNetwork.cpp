@@ -0,0 +1,155 @@
+/**
+@file
+@brief    GUNNS Benchmark Synthetic Electrical Network implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((BenchmarkNetwork.o)
+   (core/GunnsBasicConductor.o)
+   (core/GunnsBasicPotential.o)
+   (aspects/electrical/ConstantPowerLoad/EpsConstantPowerLoad.o)
+   (aspects/electrical/resistive/GunnsElectricalResistor.o))
+*/
+
+#include "BenchmarkElectNetwork.hh"
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name   (--) Instance name for H&S messages.
+/// @param[in] dither (--) Dither the resistive load conductivities each step to force
+///                        decompositions.
+///
+/// @details  Default constructs this Benchmark Electrical Network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkElectNetwork::BenchmarkElectNetwork(const std::string& name, const bool dither)
+    :
+    BenchmarkNetwork(name, 1.0E-6),
+    mDither(dither),
+    mNumFeed(0),
+    mNumLoad(0),
+    mNumCpl(0),
+    mNumBlock(0),
+    mNodes(0),
+    mFeed(0),
+    mLoad(0),
+    mCpl(0),
+    mSource(0),
+    mSink(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Benchmark Electrical Network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkElectNetwork::~BenchmarkElectNetwork()
+{
+    TS_DELETE_ARRAY(mSink);
+    TS_DELETE_ARRAY(mSource);
+    TS_DELETE_ARRAY(mCpl);
+    TS_DELETE_ARRAY(mLoad);
+    TS_DELETE_ARRAY(mFeed);
+    TS_DELETE_ARRAY(mNodes);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] topology (--) The synthetic network graph.
+///
+/// @details  Allocates & initializes the interior nodes and Ground, and loads them into the solver.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkElectNetwork::initNodes(const BenchmarkTopology& topology)
+{
+    const int numNodes = topology.getNumNodes() + 1;
+    TS_NEW_CLASS_ARRAY_EXT(mNodes, numNodes, GunnsBasicNode, (), mName + ".mNodes");
+    netNodeList.mNumNodes = numNodes;
+    netNodeList.mNodes    = mNodes;
+    for (int i = 0; i < numNodes - 1; ++i) {
+        mNodes[i].initialize(linkName("mNodes", i), 120.0);
+    }
+    mNodes[numNodes - 1].initialize(linkName("mNodes", numNodes - 1), 0.0);
+    netSolver.initializeNodes(netNodeList);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] topology (--) The synthetic network graph.
+///
+/// @details  Allocates & initializes the edge feeders, node loads, and block supplies & bleeds.
+///           Each load draws about 5 W at the 120 V nominal bus voltage.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkElectNetwork::initLinks(const BenchmarkTopology& topology)
+{
+    mNumFeed  = static_cast<int>(topology.mEdges.size());
+    mNumCpl   = 0;
+    for (int i = 0; i < topology.getNumNodes(); ++i) {
+        if (topology.mNodeNonLinear[i]) {
+            ++mNumCpl;
+        }
+    }
+    mNumLoad  = topology.getNumNodes() - mNumCpl;
+    mNumBlock = topology.getNumBlocks();
+    TS_NEW_CLASS_ARRAY_EXT(mFeed,   mNumFeed,  GunnsElectricalResistor, (), mName + ".mFeed");
+    TS_NEW_CLASS_ARRAY_EXT(mLoad,   mNumLoad,  GunnsBasicConductor,     (), mName + ".mLoad");
+    TS_NEW_CLASS_ARRAY_EXT(mCpl,    mNumCpl,   EpsConstantPowerLoad,    (), mName + ".mCpl");
+    TS_NEW_CLASS_ARRAY_EXT(mSource, mNumBlock, GunnsBasicPotential,     (), mName + ".mSource");
+    TS_NEW_CLASS_ARRAY_EXT(mSink,   mNumBlock, GunnsBasicConductor,     (), mName + ".mSink");
+
+    GunnsElectricalResistorConfigData feedConfig("", &netNodeList, 0.01, 0.99);
+    GunnsElectricalResistorInputData  feedInput;
+    GunnsBasicConductorConfigData     loadConfig("", &netNodeList, 5.0 / 14400.0);
+    GunnsBasicConductorInputData      loadInput;
+    EpsConstantPowerLoadConfigData    cplConfig("", &netNodeList, 5.0 / 14400.0, 5.0, 60.0);
+    EpsConstantPowerLoadInputData     cplInput;
+    GunnsBasicPotentialConfigData     sourceConfig("", &netNodeList, 100.0);
+    GunnsBasicPotentialInputData      sourceInput(false, 0.0, 120.0);
+    GunnsBasicConductorConfigData     sinkConfig("", &netNodeList, 1.0E-3);
+
+    /// - Edge feeders.
+    for (int i = 0; i < mNumFeed; ++i) {
+        const BenchmarkTopology::Edge& edge = topology.mEdges[i];
+        feedConfig.mName = linkName("mFeed", i);
+        mFeed[i].initialize(feedConfig, feedInput, netLinks, edge.mNode0, edge.mNode1);
+    }
+
+    /// - Node loads.
+    int load = 0;
+    int cpl  = 0;
+    for (int i = 0; i < topology.getNumNodes(); ++i) {
+        if (topology.mNodeNonLinear[i]) {
+            cplConfig.mName = linkName("mCpl", cpl);
+            mCpl[cpl++].initialize(cplConfig, cplInput, netLinks, i, mGround);
+        } else {
+            loadConfig.mName = linkName("mLoad", load);
+            mLoad[load++].initialize(loadConfig, loadInput, netLinks, i, mGround);
+        }
+    }
+
+    /// - Block supplies & bleeds.
+    for (int i = 0; i < mNumBlock; ++i) {
+        sourceConfig.mName = linkName("mSource", i);
+        mSource[i].initialize(sourceConfig, sourceInput, netLinks, mGround, topology.mSources[i]);
+        sinkConfig.mName   = linkName("mSink", i);
+        mSink[i].initialize(sinkConfig, loadInput, netLinks, topology.mSinks[i], mGround);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] timeStep (s) Integration time step.
+///
+/// @details  Varies each block's supply voltage with a small sinusoid, like regulator ripple, and
+///           when dithering, varies the resistive load conductivities.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkElectNetwork::stimulate(const double timeStep)
+{
+    mTime += timeStep;
+    for (int i = 0; i < mNumBlock; ++i) {
+        mSource[i].setSourcePotential(120.0 + 2.0 * std::sin(mTime * (1.0 + 0.1 * i)));
+    }
+    if (mDither) {
+        const double scale = 1.0 + 0.1 * std::cos(mTime);
+        for (int i = 0; i < mNumLoad; ++i) {
+            mLoad[i].setDefaultConductivity(scale * 5.0 / 14400.0);
+        }
+    }
+}
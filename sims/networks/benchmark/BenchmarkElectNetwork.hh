@@ -0,0 +1,81 @@
+#ifndef BenchmarkElectNetwork_EXISTS
+#define BenchmarkElectNetwork_EXISTS
+
+/**
+@file
+@brief    GUNNS Benchmark Synthetic Electrical Network declarations
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE: (Synthetic basic network for the Trick-less solver benchmark.)
+
+REQUIREMENTS:
+- ()
+
+REFERENCE:
+- ()
+
+ASSUMPTIONS AND LIMITATIONS:
+- ()
+
+LIBRARY DEPENDENCY:
+- ((BenchmarkElectNetwork.o))
+
+PROGRAMMERS:
+- ()
+*/
+
+#include "BenchmarkNetwork.hh"
+#include "core/GunnsBasicConductor.hh"
+#include "core/GunnsBasicPotential.hh"
+#include "aspects/electrical/ConstantPowerLoad/EpsConstantPowerLoad.hh"
+#include "aspects/electrical/resistive/GunnsElectricalResistor.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Benchmark Synthetic Electrical Network
+///
+/// @details  A resistive power distribution grid: all edges are GunnsElectricalResistor feeders.
+///           Every interior node has a load to Ground: an EpsConstantPowerLoad for nodes flagged
+///           non-linear in the topology, otherwise a resistive GunnsBasicConductor load.  Since
+///           the non-linearity comes from the node loads, the topology's edge non-linear flags are
+///           not used.  Each block's source node is driven by a GunnsBasicPotential bus supply with
+///           a slightly varying voltage, and each block's sink node has a GunnsBasicConductor bleed
+///           resistor to Ground.  When dithering, the resistive load conductivities vary every
+///           step, forcing a matrix decomposition every major step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class BenchmarkElectNetwork : public BenchmarkNetwork
+{
+    public:
+        /// @brief  Default constructs this Benchmark Electrical Network.
+        BenchmarkElectNetwork(const std::string& name, const bool dither);
+        /// @brief  Default destructs this Benchmark Electrical Network.
+        virtual ~BenchmarkElectNetwork();
+        /// @brief  Changes the supply voltages and, when dithering, the resistive load conductivities.
+        virtual void stimulate(const double timeStep);
+
+    protected:
+        bool                     mDither;   /**< (--) Dither the load conductivities each step. */
+        int                      mNumFeed;  /**< (--) Number of edge feeders. */
+        int                      mNumLoad;  /**< (--) Number of resistive node loads. */
+        int                      mNumCpl;   /**< (--) Number of constant-power node loads. */
+        int                      mNumBlock; /**< (--) Number of sources & sinks. */
+        GunnsBasicNode*          mNodes;    /**< (--) The network nodes. */
+        GunnsElectricalResistor* mFeed;     /**< (--) Edge feeders. */
+        GunnsBasicConductor*     mLoad;     /**< (--) Resistive node loads. */
+        EpsConstantPowerLoad*    mCpl;      /**< (--) Constant-power node loads. */
+        GunnsBasicPotential*     mSource;   /**< (--) Block bus supplies. */
+        GunnsBasicConductor*     mSink;     /**< (--) Block bleed resistors. */
+        /// @brief  Allocates & initializes the nodes.
+        virtual void initNodes(const BenchmarkTopology& topology);
+        /// @brief  Allocates & initializes the links.
+        virtual void initLinks(const BenchmarkTopology& topology);
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        BenchmarkElectNetwork(const BenchmarkElectNetwork&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        BenchmarkElectNetwork& operator =(const BenchmarkElectNetwork&);
+};
+
+#endif
@@ -0,0 +1,163 @@
+/**
+@file
+@brief    GUNNS Benchmark Synthetic Fluid Network implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((BenchmarkNetwork.o)
+   (aspects/fluid/conductor/GunnsFluidValve.o)
+   (core/GunnsFluidCapacitor.o)
+   (core/GunnsFluidConductor.o)
+   (core/GunnsFluidNode.o)
+   (core/GunnsFluidPotential.o))
+*/
+
+#include "BenchmarkFluidNetwork.hh"
+#include <cmath>
+
+/// @details  Loads the constituent fluid types into the network's fluid types array.
+FluidProperties::FluidType BenchmarkFluidNetwork::mFluidTypes[BenchmarkFluidNetwork::N_FLUIDS] =
+{
+    FluidProperties::GUNNS_N2,
+    FluidProperties::GUNNS_O2
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name   (--) Instance name for H&S messages.
+/// @param[in] dither (--) Dither the sink blockages each step.
+///
+/// @details  Default constructs this Benchmark Fluid Network.  The initial fluid is air-like N2/O2
+///           at room temperature & pressure.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkFluidNetwork::BenchmarkFluidNetwork(const std::string& name, const bool dither)
+    :
+    BenchmarkNetwork(name, 1.0E-3),
+    mDither(dither),
+    mNumCond(0),
+    mNumValve(0),
+    mNumCap(0),
+    mNumBlock(0),
+    mFluidProperties(),
+    mFluidConfig(&mFluidProperties, mFluidTypes, N_FLUIDS),
+    mFractions(),
+    mFluidInput(294.261, 101.325, 0.0, 0.0, mFractions),
+    mNodes(0),
+    mCond(0),
+    mValve(0),
+    mCap(0),
+    mSource(0),
+    mSink(0)
+{
+    mFractions[0] = 0.77;
+    mFractions[1] = 0.23;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Benchmark Fluid Network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkFluidNetwork::~BenchmarkFluidNetwork()
+{
+    TS_DELETE_ARRAY(mSink);
+    TS_DELETE_ARRAY(mSource);
+    TS_DELETE_ARRAY(mCap);
+    TS_DELETE_ARRAY(mValve);
+    TS_DELETE_ARRAY(mCond);
+    TS_DELETE_ARRAY(mNodes);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] topology (--) The synthetic network graph.
+///
+/// @details  Allocates & initializes the interior nodes and Ground, and loads them into the solver.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkFluidNetwork::initNodes(const BenchmarkTopology& topology)
+{
+    const int numNodes = topology.getNumNodes() + 1;
+    TS_NEW_CLASS_ARRAY_EXT(mNodes, numNodes, GunnsFluidNode, (), mName + ".mNodes");
+    netNodeList.mNumNodes = numNodes;
+    netNodeList.mNodes    = mNodes;
+    for (int i = 0; i < numNodes - 1; ++i) {
+        mNodes[i].initialize(linkName("mNodes", i), &mFluidConfig, &mFluidInput);
+    }
+    mNodes[numNodes - 1].initialize(linkName("mNodes", numNodes - 1), &mFluidConfig, 0);
+    netSolver.initializeFluidNodes(netNodeList);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] topology (--) The synthetic network graph.
+///
+/// @details  Allocates & initializes the edge links, node volumes, and block supplies & vents.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkFluidNetwork::initLinks(const BenchmarkTopology& topology)
+{
+    mNumValve = topology.getNumNonLinearEdges();
+    mNumCond  = static_cast<int>(topology.mEdges.size()) - mNumValve;
+    mNumCap   = topology.getNumNodes();
+    mNumBlock = topology.getNumBlocks();
+    TS_NEW_CLASS_ARRAY_EXT(mCond,   mNumCond,  GunnsFluidConductor, (), mName + ".mCond");
+    TS_NEW_CLASS_ARRAY_EXT(mValve,  mNumValve, GunnsFluidValve,     (), mName + ".mValve");
+    TS_NEW_CLASS_ARRAY_EXT(mCap,    mNumCap,   GunnsFluidCapacitor, (), mName + ".mCap");
+    TS_NEW_CLASS_ARRAY_EXT(mSource, mNumBlock, GunnsFluidPotential, (), mName + ".mSource");
+    TS_NEW_CLASS_ARRAY_EXT(mSink,   mNumBlock, GunnsFluidPotential, (), mName + ".mSink");
+
+    GunnsFluidConductorConfigData condConfig("", &netNodeList, 1.0E-4, 0.0);
+    GunnsFluidConductorInputData  condInput;
+    GunnsFluidValveConfigData     valveConfig("", &netNodeList, 1.0E-4, 0.0, 0.0, 0.0, 0.0);
+    GunnsFluidValveInputData      valveInput(false, 0.0, 0.5, false, 0.0, 294.261);
+    GunnsFluidCapacitorConfigData capConfig("", &netNodeList, 0.0);
+    GunnsFluidCapacitorInputData  capInput(false, 0.0, 0.1, &mFluidInput);
+    GunnsFluidPotentialConfigData potConfig("", &netNodeList, 1.0E-3, 0.0);
+    GunnsFluidPotentialInputData  sourceInput(false, 0.0, 110.0);
+    GunnsFluidPotentialInputData  sinkInput(false, 0.0, 100.0);
+
+    /// - Edges.
+    int cond  = 0;
+    int valve = 0;
+    for (unsigned int i = 0; i < topology.mEdges.size(); ++i) {
+        const BenchmarkTopology::Edge& edge = topology.mEdges[i];
+        if (edge.mNonLinear) {
+            valveConfig.mName = linkName("mValve", valve);
+            mValve[valve++].initialize(valveConfig, valveInput, netLinks, edge.mNode0, edge.mNode1);
+        } else {
+            condConfig.mName = linkName("mCond", cond);
+            mCond[cond++].initialize(condConfig, condInput, netLinks, edge.mNode0, edge.mNode1);
+        }
+    }
+
+    /// - Node volumes.
+    for (int i = 0; i < mNumCap; ++i) {
+        capConfig.mName = linkName("mCap", i);
+        mCap[i].initialize(capConfig, capInput, netLinks, i, mGround);
+    }
+
+    /// - Block supplies & vents.
+    for (int i = 0; i < mNumBlock; ++i) {
+        potConfig.mName = linkName("mSource", i);
+        mSource[i].initialize(potConfig, sourceInput, netLinks, mGround, topology.mSources[i]);
+        potConfig.mName = linkName("mSink", i);
+        mSink[i].initialize(potConfig, sinkInput, netLinks, mGround, topology.mSinks[i]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] timeStep (s) Integration time step.
+///
+/// @details  Drives each block's supply pressure with a sinusoid of a slightly different frequency,
+///           strokes the valves, and when dithering, varies the vent blockage malfunctions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkFluidNetwork::stimulate(const double timeStep)
+{
+    mTime += timeStep;
+    for (int i = 0; i < mNumBlock; ++i) {
+        const double phase = mTime * (1.0 + 0.1 * i);
+        mSource[i].setSourcePressure(110.0 + 5.0 * std::sin(phase));
+        if (mDither) {
+            mSink[i].setMalfBlockage(true, 0.1 + 0.1 * std::cos(phase));
+        }
+    }
+    for (int i = 0; i < mNumValve; ++i) {
+        mValve[i].setPosition(0.5 + 0.4 * std::sin(mTime + 0.1 * i));
+    }
+}
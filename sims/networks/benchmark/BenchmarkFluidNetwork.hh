@@ -0,0 +1,88 @@
+#ifndef BenchmarkFluidNetwork_EXISTS
+#define BenchmarkFluidNetwork_EXISTS
+
+/**
+@file
+@brief    GUNNS Benchmark Synthetic Fluid Network declarations
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE: (Synthetic fluid network for the Trick-less solver benchmark.)
+
+REQUIREMENTS:
+- ()
+
+REFERENCE:
+- ()
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The fluid is a two-constituent N2/O2 gas mixture, with no trace compounds.)
+
+LIBRARY DEPENDENCY:
+- ((BenchmarkFluidNetwork.o))
+
+PROGRAMMERS:
+- ()
+*/
+
+#include "BenchmarkNetwork.hh"
+#include "aspects/fluid/conductor/GunnsFluidValve.hh"
+#include "core/GunnsFluidCapacitor.hh"
+#include "core/GunnsFluidConductor.hh"
+#include "core/GunnsFluidNode.hh"
+#include "core/GunnsFluidPotential.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Benchmark Synthetic Fluid Network
+///
+/// @details  Linear edges are GunnsFluidConductor and non-linear edges are GunnsFluidValve, whose
+///           positions are stroked each step.  Every interior node has a GunnsFluidCapacitor volume.
+///           Each block's source node is fed by a GunnsFluidPotential supply with a sinusoidal
+///           pressure, and each block's sink node vents through a fixed-pressure GunnsFluidPotential.
+///           When dithering, the sink blockage varies every step.  Note that fluid conductances
+///           depend on the flow regime, so these networks usually decompose every step regardless.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class BenchmarkFluidNetwork : public BenchmarkNetwork
+{
+    public:
+        /// @brief  Default constructs this Benchmark Fluid Network.
+        BenchmarkFluidNetwork(const std::string& name, const bool dither);
+        /// @brief  Default destructs this Benchmark Fluid Network.
+        virtual ~BenchmarkFluidNetwork();
+        /// @brief  Changes the supply pressures & valve positions and, when dithering, the sink
+        ///         blockages.
+        virtual void stimulate(const double timeStep);
+
+    protected:
+        /// @brief  Enumeration of the number of fluid constituents.
+        enum {N_FLUIDS = 2};
+        static FluidProperties::FluidType mFluidTypes[N_FLUIDS]; /**< (--) Fluid constituent types. */
+        bool                   mDither;              /**< (--) Dither the sink blockages each step. */
+        int                    mNumCond;             /**< (--) Number of linear edge conductors. */
+        int                    mNumValve;            /**< (--) Number of non-linear edge valves. */
+        int                    mNumCap;              /**< (--) Number of node volumes. */
+        int                    mNumBlock;            /**< (--) Number of supplies & vents. */
+        DefinedFluidProperties mFluidProperties;     /**< (--) Fluid properties. */
+        PolyFluidConfigData    mFluidConfig;         /**< (--) Network fluid config data. */
+        double                 mFractions[N_FLUIDS]; /**< (--) Initial fluid mass fractions. */
+        PolyFluidInputData     mFluidInput;          /**< (--) Initial fluid state. */
+        GunnsFluidNode*        mNodes;               /**< (--) The network nodes. */
+        GunnsFluidConductor*   mCond;                /**< (--) Linear edge conductors. */
+        GunnsFluidValve*       mValve;               /**< (--) Non-linear edge valves. */
+        GunnsFluidCapacitor*   mCap;                 /**< (--) Node volumes. */
+        GunnsFluidPotential*   mSource;              /**< (--) Block supplies. */
+        GunnsFluidPotential*   mSink;                /**< (--) Block vents. */
+        /// @brief  Allocates & initializes the nodes.
+        virtual void initNodes(const BenchmarkTopology& topology);
+        /// @brief  Allocates & initializes the links.
+        virtual void initLinks(const BenchmarkTopology& topology);
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        BenchmarkFluidNetwork(const BenchmarkFluidNetwork&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        BenchmarkFluidNetwork& operator =(const BenchmarkFluidNetwork&);
+};
+
+#endif
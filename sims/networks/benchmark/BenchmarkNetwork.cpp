@@ -0,0 +1,95 @@
+/**
+@file
+@brief    GUNNS Benchmark Synthetic Network Base implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((core/Gunns.o)
+   (BenchmarkTopology.o))
+*/
+
+#include "BenchmarkNetwork.hh"
+#include <sstream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name                 (--) Instance name for H&S messages.
+/// @param[in] convergenceTolerance (--) Solver non-linear convergence tolerance, in the units of the
+///                                      network's potential.
+///
+/// @details  Default constructs this Benchmark Network.  The solver allows up to 10 minor steps &
+///           decompositions per major step, so non-linear topologies can converge.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkNetwork::BenchmarkNetwork(const std::string& name, const double convergenceTolerance)
+    :
+    netSolver(),
+    mName(name),
+    netSolverConfig(name + ".netSolver", convergenceTolerance, 1.0E-6, 10, 10),
+    netNodeList(),
+    netLinks(),
+    mGround(0),
+    mTime(0.0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Benchmark Network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkNetwork::~BenchmarkNetwork()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] topology   (--) The synthetic network graph.
+/// @param[in] islandMode (--) The solver island mode.
+///
+/// @details  Builds the nodes & links over the given topology, then initializes the solver.  The
+///           Ground node is the last node after the topology's interior nodes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkNetwork::initialize(const BenchmarkTopology& topology,
+                                  const Gunns::IslandMode  islandMode)
+{
+    mGround = topology.getNumNodes();
+    mTime   = 0.0;
+    netLinks.clear();
+    initNodes(topology);
+    initLinks(topology);
+    netSolver.initialize(netSolverConfig, netLinks);
+    netSolver.setIslandMode(islandMode);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double  (--)  Checksum of the solution potential vector.
+///
+/// @details  Returns the sum of the solution potentials, each weighted by its position in the
+///           vector so that swapped values change the checksum.  This is for comparing runs of the
+///           same configuration for repeatability, not for checking the physics.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double BenchmarkNetwork::computeChecksum() const
+{
+    const double* potential = netSolver.getPotentialVector();
+    const int     size      = mGround;
+    double sum = 0.0;
+    for (int i = 0; i < size; ++i) {
+        sum += potential[i] * (1.0 + static_cast<double>(i) / size);
+    }
+    return sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] prefix (--) The link array name.
+/// @param[in] index  (--) The link's index in its array.
+///
+/// @returns  std::string  (--)  The link instance name.
+///
+/// @details  Returns a link instance name like "name.prefix_index", for the links' H&S messages.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string BenchmarkNetwork::linkName(const std::string& prefix, const int index) const
+{
+    std::ostringstream name;
+    name << mName << "." << prefix << "_" << index;
+    return name.str();
+}
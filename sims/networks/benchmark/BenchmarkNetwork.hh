@@ -0,0 +1,116 @@
+#ifndef BenchmarkNetwork_EXISTS
+#define BenchmarkNetwork_EXISTS
+
+/**
+@file
+@brief    GUNNS Benchmark Synthetic Network Base declarations
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE: (Base class for the synthetic networks of the Trick-less solver benchmark.  Derived classes
+          build basic, thermal, electrical or fluid links over a BenchmarkTopology graph.)
+
+REQUIREMENTS:
+- ()
+
+REFERENCE:
+- ()
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The networks own their nodes & links in dynamic arrays sized from the topology, like the
+   TimingBasic network, rather than being generated by GunnsDraw.)
+
+LIBRARY DEPENDENCY:
+- ((BenchmarkNetwork.o))
+
+PROGRAMMERS:
+- ()
+*/
+
+#include "core/Gunns.hh"
+#include "BenchmarkTopology.hh"
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Benchmark Synthetic Network Base
+///
+/// @details  Holds the solver, node list and link vector common to all benchmark networks, and
+///           defines the phases the benchmark driver times separately: stimulate() changes the
+///           boundary conditions & link inputs the way a sim's models would before the network
+///           update, then step() runs the solver.  The last node is always Ground.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class BenchmarkNetwork
+{
+    public:
+        Gunns netSolver; /**< (--) The network solver. */
+        /// @brief  Default constructs this Benchmark Network.
+        BenchmarkNetwork(const std::string& name, const double convergenceTolerance);
+        /// @brief  Default destructs this Benchmark Network.
+        virtual ~BenchmarkNetwork();
+        /// @brief  Builds the network over the given topology and initializes the solver.
+        void initialize(const BenchmarkTopology& topology, const Gunns::IslandMode islandMode);
+        /// @brief  Changes boundary conditions & link inputs for the coming step.
+        virtual void stimulate(const double timeStep) = 0;
+        /// @brief  Steps the network solver.
+        void step(const double timeStep);
+        /// @brief  Returns a checksum of the solution potential vector.
+        double computeChecksum() const;
+        /// @brief  Returns the number of nodes, including Ground.
+        int getNumNodes() const;
+        /// @brief  Returns the number of links.
+        int getNumLinks() const;
+
+    protected:
+        std::string                  mName;           /**< (--) Instance name for H&S messages. */
+        GunnsConfigData              netSolverConfig; /**< (--) The solver config data. */
+        GunnsNodeList                netNodeList;     /**< (--) The network node list. */
+        std::vector<GunnsBasicLink*> netLinks;        /**< (--) The network links vector. */
+        int                          mGround;         /**< (--) Node number of the Ground node. */
+        double                       mTime;           /**< (s)  Elapsed time for the stimulus. */
+        /// @brief  Allocates & initializes the nodes, and loads them into the node list & solver.
+        virtual void initNodes(const BenchmarkTopology& topology) = 0;
+        /// @brief  Allocates & initializes the links.
+        virtual void initLinks(const BenchmarkTopology& topology) = 0;
+        /// @brief  Returns a unique link name from the given prefix and index.
+        std::string linkName(const std::string& prefix, const int index) const;
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        BenchmarkNetwork(const BenchmarkNetwork&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        BenchmarkNetwork& operator =(const BenchmarkNetwork&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] timeStep (s) Integration time step.
+///
+/// @details  Steps the network solver.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void BenchmarkNetwork::step(const double timeStep)
+{
+    netSolver.step(timeStep);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  Number of nodes, including Ground.
+///
+/// @details  Returns the number of nodes, including Ground.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int BenchmarkNetwork::getNumNodes() const
+{
+    return netNodeList.mNumNodes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  Number of links.
+///
+/// @details  Returns the number of links.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int BenchmarkNetwork::getNumLinks() const
+{
+    return static_cast<int>(netLinks.size());
+}
+
+#endif
@@ -0,0 +1,148 @@
+/**
+@file
+@brief    GUNNS Benchmark Synthetic Thermal Network implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((BenchmarkNetwork.o)
+   (core/GunnsBasicConductor.o)
+   (aspects/thermal/GunnsThermalCapacitor.o)
+   (aspects/thermal/GunnsThermalPotential.o)
+   (aspects/thermal/GunnsThermalRadiation.o))
+*/
+
+#include "BenchmarkThermalNetwork.hh"
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name   (--) Instance name for H&S messages.
+/// @param[in] dither (--) Dither the sink conductivities each step to force decompositions.
+///
+/// @details  Default constructs this Benchmark Thermal Network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkThermalNetwork::BenchmarkThermalNetwork(const std::string& name, const bool dither)
+    :
+    BenchmarkNetwork(name, 1.0E-3),
+    mDither(dither),
+    mNumCond(0),
+    mNumRad(0),
+    mNumCap(0),
+    mNumBlock(0),
+    mNodes(0),
+    mCond(0),
+    mRad(0),
+    mCap(0),
+    mSource(0),
+    mSink(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Benchmark Thermal Network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkThermalNetwork::~BenchmarkThermalNetwork()
+{
+    TS_DELETE_ARRAY(mSink);
+    TS_DELETE_ARRAY(mSource);
+    TS_DELETE_ARRAY(mCap);
+    TS_DELETE_ARRAY(mRad);
+    TS_DELETE_ARRAY(mCond);
+    TS_DELETE_ARRAY(mNodes);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] topology (--) The synthetic network graph.
+///
+/// @details  Allocates & initializes the interior nodes and Ground, and loads them into the solver.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkThermalNetwork::initNodes(const BenchmarkTopology& topology)
+{
+    const int numNodes = topology.getNumNodes() + 1;
+    TS_NEW_CLASS_ARRAY_EXT(mNodes, numNodes, GunnsBasicNode, (), mName + ".mNodes");
+    netNodeList.mNumNodes = numNodes;
+    netNodeList.mNodes    = mNodes;
+    for (int i = 0; i < numNodes - 1; ++i) {
+        mNodes[i].initialize(linkName("mNodes", i), 290.0);
+    }
+    mNodes[numNodes - 1].initialize(linkName("mNodes", numNodes - 1), 0.0);
+    netSolver.initializeNodes(netNodeList);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] topology (--) The synthetic network graph.
+///
+/// @details  Allocates & initializes the edge links, node capacitors, and block sources & sinks.
+///           The radiation coefficient gives a linearized conductance near 1 W/K at room
+///           temperature, similar to the conduction edges.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkThermalNetwork::initLinks(const BenchmarkTopology& topology)
+{
+    mNumRad   = topology.getNumNonLinearEdges();
+    mNumCond  = static_cast<int>(topology.mEdges.size()) - mNumRad;
+    mNumCap   = topology.getNumNodes();
+    mNumBlock = topology.getNumBlocks();
+    TS_NEW_CLASS_ARRAY_EXT(mCond,   mNumCond,  GunnsBasicConductor,   (), mName + ".mCond");
+    TS_NEW_CLASS_ARRAY_EXT(mRad,    mNumRad,   GunnsThermalRadiation, (), mName + ".mRad");
+    TS_NEW_CLASS_ARRAY_EXT(mCap,    mNumCap,   GunnsThermalCapacitor, (), mName + ".mCap");
+    TS_NEW_CLASS_ARRAY_EXT(mSource, mNumBlock, GunnsThermalPotential, (), mName + ".mSource");
+    TS_NEW_CLASS_ARRAY_EXT(mSink,   mNumBlock, GunnsThermalPotential, (), mName + ".mSink");
+
+    GunnsBasicConductorConfigData   condConfig("", &netNodeList, 1.0);
+    GunnsBasicConductorInputData    condInput;
+    GunnsThermalRadiationConfigData radConfig("", &netNodeList, 1.0E-8);
+    GunnsThermalRadiationInputData  radInput(false, 0.0, 1.0);
+    GunnsThermalCapacitorConfigData capConfig("", &netNodeList);
+    GunnsThermalCapacitorInputData  capInput(false, 0.0, 100.0, 290.0);
+    GunnsThermalPotentialConfigData potConfig("", &netNodeList, 1.0);
+    GunnsThermalPotentialInputData  sourceInput(false, 0.0, 300.0);
+    GunnsThermalPotentialInputData  sinkInput(false, 0.0, 250.0);
+
+    /// - Edges.
+    int cond = 0;
+    int rad  = 0;
+    for (unsigned int i = 0; i < topology.mEdges.size(); ++i) {
+        const BenchmarkTopology::Edge& edge = topology.mEdges[i];
+        if (edge.mNonLinear) {
+            radConfig.mName = linkName("mRad", rad);
+            mRad[rad++].initialize(radConfig, radInput, netLinks, edge.mNode0, edge.mNode1);
+        } else {
+            condConfig.mName = linkName("mCond", cond);
+            mCond[cond++].initialize(condConfig, condInput, netLinks, edge.mNode0, edge.mNode1);
+        }
+    }
+
+    /// - Node capacitors.
+    for (int i = 0; i < mNumCap; ++i) {
+        capConfig.mName = linkName("mCap", i);
+        mCap[i].initialize(capConfig, capInput, netLinks, i, mGround);
+    }
+
+    /// - Block sources & sinks.
+    for (int i = 0; i < mNumBlock; ++i) {
+        potConfig.mName = linkName("mSource", i);
+        mSource[i].initialize(potConfig, sourceInput, netLinks, mGround, topology.mSources[i]);
+        potConfig.mName = linkName("mSink", i);
+        mSink[i].initialize(potConfig, sinkInput, netLinks, mGround, topology.mSinks[i]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] timeStep (s) Integration time step.
+///
+/// @details  Drives each block's source temperature with a sinusoid of a slightly different
+///           frequency, and when dithering, varies the sink conductivities.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkThermalNetwork::stimulate(const double timeStep)
+{
+    mTime += timeStep;
+    for (int i = 0; i < mNumBlock; ++i) {
+        const double phase = mTime * (1.0 + 0.1 * i);
+        mSource[i].setSourcePotential(300.0 + 20.0 * std::sin(phase));
+        if (mDither) {
+            mSink[i].setDefaultConductivity(1.0 + 0.1 * std::cos(phase));
+        }
+    }
+}
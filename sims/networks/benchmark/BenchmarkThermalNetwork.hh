@@ -0,0 +1,79 @@
+#ifndef BenchmarkThermalNetwork_EXISTS
+#define BenchmarkThermalNetwork_EXISTS
+
+/**
+@file
+@brief    GUNNS Benchmark Synthetic Thermal Network declarations
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE: (Synthetic basic network for the Trick-less solver benchmark.)
+
+REQUIREMENTS:
+- ()
+
+REFERENCE:
+- ()
+
+ASSUMPTIONS AND LIMITATIONS:
+- ()
+
+LIBRARY DEPENDENCY:
+- ((BenchmarkThermalNetwork.o))
+
+PROGRAMMERS:
+- ()
+*/
+
+#include "BenchmarkNetwork.hh"
+#include "core/GunnsBasicConductor.hh"
+#include "aspects/thermal/GunnsThermalCapacitor.hh"
+#include "aspects/thermal/GunnsThermalPotential.hh"
+#include "aspects/thermal/GunnsThermalRadiation.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Benchmark Synthetic Thermal Network
+///
+/// @details  Linear edges are GunnsBasicConductor conduction paths and non-linear edges are
+///           GunnsThermalRadiation.  Every interior node has a GunnsThermalCapacitor to Ground.
+///           Each block's source node is heated by a GunnsThermalPotential with a sinusoidal
+///           temperature, like an orbital sink, and each block's sink node rejects to a fixed
+///           temperature GunnsThermalPotential.  When dithering, the sink conductivity varies every
+///           step, forcing a matrix decomposition every major step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class BenchmarkThermalNetwork : public BenchmarkNetwork
+{
+    public:
+        /// @brief  Default constructs this Benchmark Thermal Network.
+        BenchmarkThermalNetwork(const std::string& name, const bool dither);
+        /// @brief  Default destructs this Benchmark Thermal Network.
+        virtual ~BenchmarkThermalNetwork();
+        /// @brief  Changes the source temperatures and, when dithering, the sink conductivities.
+        virtual void stimulate(const double timeStep);
+
+    protected:
+        bool                   mDither;   /**< (--) Dither the sink conductivities each step. */
+        int                    mNumCond;  /**< (--) Number of linear edge conductors. */
+        int                    mNumRad;   /**< (--) Number of non-linear edge radiation links. */
+        int                    mNumCap;   /**< (--) Number of node capacitors. */
+        int                    mNumBlock; /**< (--) Number of sources & sinks. */
+        GunnsBasicNode*        mNodes;    /**< (--) The network nodes. */
+        GunnsBasicConductor*   mCond;     /**< (--) Linear edge conductors. */
+        GunnsThermalRadiation* mRad;      /**< (--) Non-linear edge radiation links. */
+        GunnsThermalCapacitor* mCap;      /**< (--) Node capacitors. */
+        GunnsThermalPotential* mSource;   /**< (--) Block sources. */
+        GunnsThermalPotential* mSink;     /**< (--) Block sinks. */
+        /// @brief  Allocates & initializes the nodes.
+        virtual void initNodes(const BenchmarkTopology& topology);
+        /// @brief  Allocates & initializes the links.
+        virtual void initLinks(const BenchmarkTopology& topology);
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        BenchmarkThermalNetwork(const BenchmarkThermalNetwork&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        BenchmarkThermalNetwork& operator =(const BenchmarkThermalNetwork&);
+};
+
+#endif
@@ -0,0 +1,313 @@
+/**
+@file
+@brief    GUNNS Benchmark Synthetic Network Topology implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((software/exceptions/TsInitializationException.o))
+*/
+
+#include "BenchmarkTopology.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <utility>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Benchmark Topology.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkTopology::BenchmarkTopology()
+    :
+    mEdges(),
+    mNodeNonLinear(),
+    mBlockOfNode(),
+    mSources(),
+    mSinks(),
+    mNumNodes(0),
+    mState(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Benchmark Topology.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkTopology::~BenchmarkTopology()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] type              (--) The topology type.
+/// @param[in] numNodes          (--) Number of interior nodes, not including Ground.
+/// @param[in] density           (--) Extra edge density, see the class description.
+/// @param[in] nonLinearFraction (--) Probability (0-1) of each edge & node being non-linear.
+/// @param[in] numBlocks         (--) Number of disconnected node blocks, or 0 for the type default.
+/// @param[in] seed              (--) Seed for the pseudo-random sequence.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Clears any previous topology and generates a new one.  The nodes are divided into
+///           numBlocks contiguous blocks of nearly equal size.  When numBlocks is zero, the ISLANDS
+///           type defaults to one block per 16 nodes, and the other types default to one block.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkTopology::build(const Type               type,
+                              const int                numNodes,
+                              const double             density,
+                              const double             nonLinearFraction,
+                              const int                numBlocks,
+                              const unsigned long long seed)
+{
+    /// - Validate the parameters.
+    if (numNodes < 2) {
+        throw TsInitializationException("Invalid Input Argument", "BenchmarkTopology",
+                                        "number of nodes < 2.");
+    }
+    if (density < 0.0) {
+        throw TsInitializationException("Invalid Input Argument", "BenchmarkTopology",
+                                        "density < 0.");
+    }
+    if (nonLinearFraction < 0.0 or nonLinearFraction > 1.0) {
+        throw TsInitializationException("Invalid Input Argument", "BenchmarkTopology",
+                                        "non-linear fraction not in (0-1).");
+    }
+    int blocks = numBlocks;
+    if (blocks < 1) {
+        blocks = (ISLANDS == type) ? std::max(2, numNodes / 16) : 1;
+    }
+    if (numNodes < 2 * blocks) {
+        throw TsInitializationException("Invalid Input Argument", "BenchmarkTopology",
+                                        "fewer than 2 nodes per block.");
+    }
+
+    mNumNodes = numNodes;
+    mState    = seed;
+    mEdges.clear();
+    mSources.clear();
+    mSinks.clear();
+    mBlockOfNode.assign(numNodes, 0);
+    mNodeNonLinear.assign(numNodes, false);
+
+    /// - Build each block, spreading the remainder nodes over the first blocks.
+    int first = 0;
+    for (int block = 0; block < blocks; ++block) {
+        const int size = numNodes / blocks + ((block < numNodes % blocks) ? 1 : 0);
+        for (int node = first; node < first + size; ++node) {
+            mBlockOfNode[node] = block;
+        }
+        switch (type) {
+            case LADDER :
+                buildLadder(first, size, density, nonLinearFraction);
+                break;
+            case MESH :
+                buildMesh(first, size, density, nonLinearFraction);
+                break;
+            default :
+                buildRandom(first, size, density, nonLinearFraction);
+                break;
+        }
+        mSources.push_back(first);
+        mSinks.push_back(first + size - 1);
+        first += size;
+    }
+
+    /// - Flag non-linear nodes.
+    for (int node = 0; node < numNodes; ++node) {
+        mNodeNonLinear[node] = (uniform() < nonLinearFraction);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  Number of edges flagged non-linear.
+///
+/// @details  Counts and returns the number of edges flagged as non-linear.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int BenchmarkTopology::getNumNonLinearEdges() const
+{
+    int count = 0;
+    for (unsigned int i = 0; i < mEdges.size(); ++i) {
+        if (mEdges[i].mNonLinear) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name (--) Topology name: ladder, mesh, random or islands.
+///
+/// @returns  Type  (--)  The topology type.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Returns the topology type matching the given name.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkTopology::Type BenchmarkTopology::parseType(const std::string& name)
+{
+    if ("ladder"  == name) return LADDER;
+    if ("mesh"    == name) return MESH;
+    if ("random"  == name) return RANDOM;
+    if ("islands" == name) return ISLANDS;
+    throw TsInitializationException("Invalid Input Argument", "BenchmarkTopology",
+                                    "unknown topology name: " + name);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] type (--) The topology type.
+///
+/// @returns  const char*  (--)  The topology name.
+///
+/// @details  Returns the name of the given topology type, the inverse of parseType.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const char* BenchmarkTopology::typeName(const Type type)
+{
+    switch (type) {
+        case LADDER : return "ladder";
+        case MESH   : return "mesh";
+        case RANDOM : return "random";
+        default     : return "islands";
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double  (--)  Pseudo-random number in [0, 1).
+///
+/// @details  Returns the next number in a splitmix64 sequence, scaled to [0, 1).  We use our own
+///           generator rather than the standard library so the topology doesn't depend on the
+///           platform's rand() implementation.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double BenchmarkTopology::uniform()
+{
+    mState += 0x9E3779B97F4A7C15ULL;
+    unsigned long long z = mState;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z =  z ^ (z >> 31);
+    return static_cast<double>(z >> 11) * (1.0 / 9007199254740992.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] n (--) Upper limit (exclusive) of the returned integer.
+///
+/// @returns  int  (--)  Pseudo-random integer in [0, n).
+///
+/// @details  Returns the next pseudo-random integer in [0, n).
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int BenchmarkTopology::uniformInt(const int n)
+{
+    return std::min(n - 1, static_cast<int>(uniform() * n));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] node0             (--) Node index of the edge's first end.
+/// @param[in] node1             (--) Node index of the edge's second end.
+/// @param[in] nonLinearFraction (--) Probability (0-1) of the edge being non-linear.
+///
+/// @details  Adds an edge between the given nodes, randomly flagged as non-linear.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkTopology::addEdge(const int node0, const int node1, const double nonLinearFraction)
+{
+    Edge edge;
+    edge.mNode0     = node0;
+    edge.mNode1     = node1;
+    edge.mNonLinear = (uniform() < nonLinearFraction);
+    mEdges.push_back(edge);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] first             (--) Index of the first node in the block.
+/// @param[in] size              (--) Number of nodes in the block.
+/// @param[in] density           (--) Probability (0-1) of a diagonal edge at each rung.
+/// @param[in] nonLinearFraction (--) Probability (0-1) of each edge being non-linear.
+///
+/// @details  Builds a ladder: even nodes form one rail and odd nodes form the other, with rungs
+///           between each even/odd pair.  Diagonals cross each ladder cell with the given
+///           probability.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkTopology::buildLadder(const int first, const int size, const double density,
+                                    const double nonLinearFraction)
+{
+    for (int i = 0; i < size; ++i) {
+        const int node = first + i;
+        if (i + 2 < size) {
+            addEdge(node, node + 2, nonLinearFraction);
+        }
+        if (0 == i % 2 and i + 1 < size) {
+            addEdge(node, node + 1, nonLinearFraction);
+            if (i + 3 < size and uniform() < density) {
+                addEdge(node, node + 3, nonLinearFraction);
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] first             (--) Index of the first node in the block.
+/// @param[in] size              (--) Number of nodes in the block.
+/// @param[in] density           (--) Probability (0-1) of a diagonal edge at each cell.
+/// @param[in] nonLinearFraction (--) Probability (0-1) of each edge being non-linear.
+///
+/// @details  Builds a square grid of the smallest width that holds the block, filled row by row.
+///           The last row may be partial.  Diagonals cross each grid cell with the given
+///           probability.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkTopology::buildMesh(const int first, const int size, const double density,
+                                  const double nonLinearFraction)
+{
+    const int width = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(size))));
+    for (int i = 0; i < size; ++i) {
+        const int node = first + i;
+        const int col  = i % width;
+        if (col + 1 < width and i + 1 < size) {
+            addEdge(node, node + 1, nonLinearFraction);
+        }
+        if (i + width < size) {
+            addEdge(node, node + width, nonLinearFraction);
+            if (col + 1 < width and i + width + 1 < size and uniform() < density) {
+                addEdge(node, node + width + 1, nonLinearFraction);
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] first             (--) Index of the first node in the block.
+/// @param[in] size              (--) Number of nodes in the block.
+/// @param[in] density           (--) Number of extra random chords per node.
+/// @param[in] nonLinearFraction (--) Probability (0-1) of each edge being non-linear.
+///
+/// @details  Builds a random spanning tree, where each node connects to a random lower node, so
+///           the block is always connected.  Then adds density * size random chords between
+///           distinct node pairs not already connected, up to the number of such pairs.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkTopology::buildRandom(const int first, const int size, const double density,
+                                    const double nonLinearFraction)
+{
+    std::set<std::pair<int, int> > connected;
+    for (int i = 1; i < size; ++i) {
+        const int other = first + uniformInt(i);
+        addEdge(other, first + i, nonLinearFraction);
+        connected.insert(std::make_pair(other, first + i));
+    }
+
+    const long maxPairs = static_cast<long>(size) * (size - 1) / 2;
+    const long chords   = std::min(static_cast<long>(density * size + 0.5),
+                                   maxPairs - static_cast<long>(connected.size()));
+    for (long chord = 0; chord < chords; ) {
+        int node0 = first + uniformInt(size);
+        int node1 = first + uniformInt(size);
+        if (node0 == node1) {
+            continue;
+        }
+        if (node0 > node1) {
+            std::swap(node0, node1);
+        }
+        if (connected.insert(std::make_pair(node0, node1)).second) {
+            addEdge(node0, node1, nonLinearFraction);
+            ++chord;
+        }
+    }
+}
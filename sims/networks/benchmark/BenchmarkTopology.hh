@@ -0,0 +1,135 @@
+#ifndef BenchmarkTopology_EXISTS
+#define BenchmarkTopology_EXISTS
+
+/**
+@file
+@brief    GUNNS Benchmark Synthetic Network Topology declarations
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE: (Generates repeatable synthetic network graphs (ladder, mesh, random sparse and island-
+          heavy) used to build the Trick-less solver benchmark networks.)
+
+REQUIREMENTS:
+- ()
+
+REFERENCE:
+- ()
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The graph is generated from a seeded pseudo-random sequence, so the same parameters always
+   produce the same topology on any platform.)
+
+LIBRARY DEPENDENCY:
+- ((BenchmarkTopology.o))
+
+PROGRAMMERS:
+- ()
+*/
+
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Benchmark Synthetic Network Topology
+///
+/// @details  Describes a synthetic network as a list of node-to-node edges.  The interior nodes are
+///           divided into one or more contiguous blocks, and each block is built with the selected
+///           topology and no edges to the other blocks, so each block forms its own island in the
+///           solver.  Each block has a source node (its first node) and a sink node (its last node),
+///           where the benchmark networks attach their boundary conditions to Ground.
+///
+///           The density term adds edges beyond the minimum connected structure: for the ladder and
+///           mesh it is the probability (0-1) of a diagonal edge at each node, and for the random
+///           and island topologies it is the number of extra random chords per node.  The
+///           non-linear fraction is the probability (0-1) that each edge and node is flagged for a
+///           non-linear link type in the benchmark networks.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class BenchmarkTopology
+{
+    public:
+        /// @brief  Enumeration of the synthetic topology types.
+        enum Type {
+            LADDER  = 0, ///< Two rails with rungs, like a long pipe run or harness.
+            MESH    = 1, ///< Square grid, like a thermal panel or cold plate.
+            RANDOM  = 2, ///< Random spanning tree plus random chords.
+            ISLANDS = 3  ///< Many small random blocks, each its own island.
+        };
+        /// @brief  An edge between two interior nodes.
+        struct Edge {
+            int  mNode0;     /**< (--) Node index of the edge's first end. */
+            int  mNode1;     /**< (--) Node index of the edge's second end. */
+            bool mNonLinear; /**< (--) Edge should be a non-linear link. */
+        };
+        std::vector<Edge> mEdges;         /**< (--) The edges between interior nodes. */
+        std::vector<bool> mNodeNonLinear; /**< (--) Per-node non-linear flags, for node loads. */
+        std::vector<int>  mBlockOfNode;   /**< (--) Block (island) number of each node. */
+        std::vector<int>  mSources;       /**< (--) Source node of each block. */
+        std::vector<int>  mSinks;         /**< (--) Sink node of each block. */
+        /// @brief  Default constructs this Benchmark Topology.
+        BenchmarkTopology();
+        /// @brief  Default destructs this Benchmark Topology.
+        virtual ~BenchmarkTopology();
+        /// @brief  Generates the topology from the given parameters.
+        void build(const Type               type,
+                   const int                numNodes,
+                   const double             density,
+                   const double             nonLinearFraction,
+                   const int                numBlocks,
+                   const unsigned long long seed);
+        /// @brief  Returns the number of interior nodes, not including Ground.
+        int getNumNodes() const;
+        /// @brief  Returns the number of disconnected blocks.
+        int getNumBlocks() const;
+        /// @brief  Returns the number of edges flagged non-linear.
+        int getNumNonLinearEdges() const;
+        /// @brief  Returns the topology type for the given name, or throws if not recognized.
+        static Type parseType(const std::string& name);
+        /// @brief  Returns the name of the given topology type.
+        static const char* typeName(const Type type);
+
+    protected:
+        int                mNumNodes; /**< (--) Number of interior nodes. */
+        unsigned long long mState;    /**< (--) State of the pseudo-random sequence. */
+        /// @brief  Returns the next pseudo-random number, uniform in [0, 1).
+        double uniform();
+        /// @brief  Returns the next pseudo-random integer, uniform in [0, n).
+        int    uniformInt(const int n);
+        /// @brief  Adds an edge with a random non-linear flag.
+        void   addEdge(const int node0, const int node1, const double nonLinearFraction);
+        /// @brief  Builds the ladder topology in the given node block.
+        void   buildLadder(const int first, const int size, const double density, const double nonLinearFraction);
+        /// @brief  Builds the mesh topology in the given node block.
+        void   buildMesh(const int first, const int size, const double density, const double nonLinearFraction);
+        /// @brief  Builds the random sparse topology in the given node block.
+        void   buildRandom(const int first, const int size, const double density, const double nonLinearFraction);
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        BenchmarkTopology(const BenchmarkTopology&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        BenchmarkTopology& operator =(const BenchmarkTopology&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  Number of interior nodes.
+///
+/// @details  Returns the number of interior nodes, not including Ground.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int BenchmarkTopology::getNumNodes() const
+{
+    return mNumNodes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  Number of disconnected node blocks.
+///
+/// @details  Returns the number of disconnected node blocks, which become the solver's islands.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int BenchmarkTopology::getNumBlocks() const
+{
+    return static_cast<int>(mSources.size());
+}
+
+#endif